@@ -1534,27 +1534,50 @@ MainThread_FinishCycle (unsigned long long CycleNo64)
 ** MARK: NONSTANDARD CM_MAIN STARTS HERE 
 ***************************************************************/
 
+#include <math.h>
+
 #include "CM_Main.h"
+#include "cmbatch.h"
+#include "cmimu.h"
+#include "cmlog.h"
+#include "cmlidar.h"
+#include "cmlidar_convert.h"
 
 static unsigned long long CycleNo64 = 0;
 
-static int lidarIndex = -1;
-static tLidarRSI* lidar;
-
 static int imuIndex = -1;
 static tBdySensor* imu;
 static tBdyFrame* bodyFrame;
 
 
-#define LIDAR_BEAMS_WIDTH (360)
-#define LIDAR_BEAMS_HEIGHT (16)
-#define LIDAR_BEAM_COUNT (LIDAR_BEAMS_WIDTH * LIDAR_BEAMS_HEIGHT)
-static vector4_t lidar_buffer[LIDAR_BEAM_COUNT];
+#define LIDAR_BEAM_FILE "Data/Sensor/LidarRSI_FS_autonomous"
 
+/* scan period of sensors without a sensor cluster cycle time, ms */
+#define LIDAR_CYCLE_TIME 50
 
-//static tbrert_pointcloud_callback_t lidar_callback = NULL;
+typedef struct
+{
+    char name[64];
+    int index;              // into LidarRSI[], -1 until the sensor exists
+    int id;                 // cmlidar sensor
+    int scanNumber;         // last scan handed to cmlidar
+    double scanTime;
+} tLidar;
+
+static const char *lidarBeamFile = LIDAR_BEAM_FILE; // for sensors whose parameters name no beam file
+static cmlidar_output_t lidarOutput = CMLIDAR_CLOUD_MERGED;
+static bool lidarDeskew = true;
+static float lidarVoxel = 0.0f; // m, 0 publishes every point
+static bool lidarVoxelCentroid = true;
+
+static tLidar lidars[CMLIDAR_MAX_SENSORS];
+static int nLidars;
+
+static void lidar_find_sensors(void);
+static int lidar_add(const char *name, const char *beamFile, const double rot[3], const double pos[3], double period);
 
-//extern beam_entry_t beam_table[];
+
+//static tbrert_pointcloud_callback_t lidar_callback = NULL;
 
 int CM_Main_init(int argc, char **argv)
 {
@@ -1591,6 +1614,12 @@ int CM_Main_init(int argc, char **argv)
 	    }
     }
 
+    if (cmbatch_enabled() && !SimCore.OnlyOneSimulation)
+    {
+        fprintf(stderr, "Batch mode needs a test run on the command line\n");
+        return 1;
+    }
+
     /*** Second initialisation of modules/structures */
     if (App_Init_Second() < 0 || Log_nError > nError) 
     {
@@ -1617,6 +1646,11 @@ int CM_Main_init(int argc, char **argv)
 
 bool CM_Main_running(void)
 {
+    // no pacing to the wall clock; set every cycle as a test run start loads its own
+    if (cmbatch_enabled())
+    {
+        SimCore.TAccel = CMBATCH_TACCEL;
+    }
 
     return (
             (MainThread_BeginCycle(CycleNo64) == 0)
@@ -1634,6 +1668,9 @@ void CM_Main_update(void)
 
 int CM_Main_quit(void)
 {
+    cmlidar_close();
+    cmimu_quit();
+
     /* shut testrig down */
     App_ShutDown (0);	/* shutdown desired	*/
     App_ShutDown (1);	/* shutdown forced	*/
@@ -1648,86 +1685,166 @@ int CM_Main_quit(void)
 
 void CM_Main_capture_pointcloud(void)
 {
-    if (lidarIndex == -1)
+    if (SimCore.State != SCState_Simulate || nLidars == 0)
     {
+        return; // the beam tables are only stable while a test run is simulating
+    }
 
-        lidarIndex = LidarRSI_FindIndexForName("Lidar_F");
-    } else {
-
-        printf("LidarRSICount %d\n", LidarRSICount);
-        lidar = &LidarRSI[0];
+    // called every cycle, sensors that finished a scan since the last call are copied and handed to the worker
+    for (int i = 0; i < nLidars; ++i)
+    {
+        tLidar *l = &lidars[i];
 
-        //lidar = LidarRSI_GetByIndex(lidarIndex);
-        if (lidar == NULL)
-        { 
-            printf("Lidar not found at index %d\n", lidarIndex);
-            return; // Lidar not found
+        if (l->index < 0)
+        {
+            l->index = LidarRSI_FindIndexForName(l->name);
         }
 
-        printf("Lidar ScanNumber %d ScanTime %f nScanPoints %d\n",
-               lidar->ScanNumber, lidar->ScanTime, lidar->nScanPoints);
-        
-        lidar->nScanPoints = LIDAR_BEAM_COUNT; // Ensure we have the expected number of scan points
+        if (l->index < 0 || l->index >= LidarRSICount)
+            continue;
 
-        if (lidar->nScanPoints != LIDAR_BEAM_COUNT)
-        {
-            printf("Lidar scan points count mismatch: %d != %d\n", lidar->nScanPoints, LIDAR_BEAM_COUNT);
-            return; // Mismatch in expected scan points
-        }
+        const tLidarRSI *sensor = &LidarRSI[l->index];
 
+        if (sensor->ScanNumber == l->scanNumber && sensor->ScanTime == l->scanTime)
+            continue;
 
-        const float hMin = -60.0f;
-        const float hMax =  60.0f;
-        const float vMin =  -5.0f;
-        const float vMax =   5.0f;
+        l->scanNumber = sensor->ScanNumber;
+        l->scanTime = sensor->ScanTime;
 
+        CMLOG(CMLOG_LIDAR, CMLOG_DEBUG, "%s ScanNumber %d ScanTime %f nScanPoints %d",
+              l->name, sensor->ScanNumber, sensor->ScanTime, sensor->nScanPoints);
 
-        const float dh = (hMax - hMin) / (float)(LIDAR_BEAMS_WIDTH); // 0.4 deg
-        const float dv = (vMax - vMin) / (float)(LIDAR_BEAMS_HEIGHT); // 0.2 deg
+        // a scan without returns is handed on too, it completes a merged cloud
+        cmlidar_copy(l->id, sensor->ScanPoint, sensor->nScanPoints, sensor->ScanTime);
+    }
 
-        const float h0 = hMin + dh * 0.5f; // -59.8 deg
-        const float v0 = vMin + dv * 0.5f; // -4.9 deg
+    cmlidar_submit();
+}
 
-         // Fill the point cloud
+void CM_Main_set_beam_file(const char *path)
+{
+    lidarBeamFile = path;
+}
 
-        size_t points = 0;
+int CM_Main_set_lidar_cloud(const char *mode)
+{
+    if (strcmp(mode, "merged") == 0)
+    {
+        lidarOutput = CMLIDAR_CLOUD_MERGED;
+    }
+    else if (strcmp(mode, "sensor") == 0)
+    {
+        lidarOutput = CMLIDAR_CLOUD_SENSOR;
+    }
+    else if (strcmp(mode, "range") == 0)
+    {
+        lidarOutput = CMLIDAR_RANGE_IMAGES;
+    }
+    else
+    {
+        fprintf(stderr, "Lidar cloud must be 'merged', 'sensor' or 'range'\n");
+        return -1;
+    }
 
-        for (int i = 0; (i < lidar->nScanPoints) && (i < LIDAR_BEAM_COUNT); ++i) {
-            const tScanPoint scanPoint = lidar->ScanPoint[i];
-            int beam_id = scanPoint.BeamID;
+    return 0;
+}
 
-            // Extract beam indices
-            int vi = beam_id / LIDAR_BEAMS_WIDTH;
-            int hi = beam_id % LIDAR_BEAMS_WIDTH;
+int CM_Main_set_lidar_deskew(const char *mode)
+{
+    if (strcmp(mode, "on") == 0)
+    {
+        lidarDeskew = true;
+    }
+    else if (strcmp(mode, "off") == 0)
+    {
+        lidarDeskew = false;
+    }
+    else
+    {
+        fprintf(stderr, "Lidar deskew must be 'on' or 'off'\n");
+        return -1;
+    }
 
-            // Compute angles in radians
-            double azimuth = (h0 + hi * dh) * (M_PI / 180.0);   // Horizontal angle
-            double elevation = (v0 + vi * dv) * (M_PI / 180.0); // Vertical angle
+    return 0;
+}
 
-            // Ray length
-            double ray_length = scanPoint.LengthOF * 0.5;
+int CM_Main_set_lidar_voxel(const char *size)
+{
+    char *end;
+    double value = strtod(size, &end);
 
-            // Convert spherical to Cartesian coordinates
-            lidar_buffer[i].x = (float)(ray_length * cos(elevation) * sin(azimuth)) * -1.0f; // Flip X
-            lidar_buffer[i].y = (float)(ray_length * cos(elevation) * cos(azimuth));
-            lidar_buffer[i].z = (float)(ray_length * sin(elevation));
-            lidar_buffer[i].w = (float)(scanPoint.Intensity);
+    if (end == size || *end != '\0' || !(value >= 0.0))
+    {
+        fprintf(stderr, "Lidar voxel size must be a length in metres, 0 to turn it off\n");
+        return -1;
+    }
 
-            points++;
-        }
-        
-        xif_pointcloud_t pointcloud;
-        pointcloud.num_points = points;
-        pointcloud.points = lidar_buffer;
-        pointcloud.timestamp = CM_Main_get_ms();
+    lidarVoxel = (float)value;
+
+    return 0;
+}
 
-        xifs_transmit_pointcloud(pointcloud);
+int CM_Main_set_lidar_voxel_point(const char *mode)
+{
+    if (strcmp(mode, "centroid") == 0)
+    {
+        lidarVoxelCentroid = true;
     }
+    else if (strcmp(mode, "first") == 0)
+    {
+        lidarVoxelCentroid = false;
+    }
+    else
+    {
+        fprintf(stderr, "Lidar voxel point must be 'centroid' or 'first'\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+int CM_Main_set_imu_rate(const char *rate)
+{
+    char *end;
+    double value = strtod(rate, &end);
+
+    if (end == rate || *end != '\0')
+    {
+        fprintf(stderr, "IMU rate must be a number in Hz, 0 to send every sample\n");
+        return -1;
+    }
+
+    return cmimu_init(value);
+}
+
+int CM_Main_lidar_setup(void)
+{
+    const cmlidar_layout_t layout = {
+        sizeof(tScanPoint),
+        offsetof(tScanPoint, BeamID), offsetof(tScanPoint, LengthOF), offsetof(tScanPoint, Intensity)
+    };
+
+    cmlidar_convert_init("auto");
+
+    nLidars = 0;
+    cmlidar_open(&layout, lidarOutput, lidarDeskew);
+    cmlidar_set_voxel(lidarVoxel, lidarVoxelCentroid);
+    lidar_find_sensors();
+
+    if (nLidars == 0)
+    {
+        // vehicle parameters name no LidarRSI, keep publishing the front lidar as before
+        const double zero[3] = { 0.0, 0.0, 0.0 };
+        if (lidar_add("Lidar_F", lidarBeamFile, zero, zero, LIDAR_CYCLE_TIME / 1000.0) != 0)
+            return -1;
+    }
+
+    return cmlidar_start();
 }
 
 void CM_Main_capture_imu(void)
 {
-    if (lidarIndex == -1)
+    if (imuIndex == -1)
     {
         imuIndex = InertialSensor_FindIndexForName("B00");
     } else {
@@ -1760,15 +1877,15 @@ void CM_Main_capture_imu(void)
 
             imu_update.timestamp = CM_Main_get_ms();
 
-            printf("IMU Update: Orientation (roll: %f, pitch: %f, yaw: %f), "
-                   "Angular Velocity (x: %f, y: %f, z: %f), "
-                   "Linear Acceleration (x: %f, y: %f, z: %f)\n",
-                   imu_update.orientation.x, imu_update.orientation.y, imu_update.orientation.z,
-                   imu_update.angular_velocity.x, imu_update.angular_velocity.y, imu_update.angular_velocity.z,
-                   imu_update.linear_acceleration.x, imu_update.linear_acceleration.y, imu_update.linear_acceleration.z);
-
-            xifs_transmit_imu(imu_update);
+            cmimu_add(&imu_update);
 
+            // v_0 is in the global frame, the lidar deskew wants it along the vehicle's heading
+            const double v[3] = {
+                cos(yaw) * bodyFrame->v_0[0] + sin(yaw) * bodyFrame->v_0[1],
+                -sin(yaw) * bodyFrame->v_0[0] + cos(yaw) * bodyFrame->v_0[1],
+                bodyFrame->v_0[2]
+            };
+            cmlidar_motion(v, bodyFrame->omega_0[2]);
         }
     }
 }
@@ -1780,4 +1897,83 @@ uint64_t CM_Main_get_ms(void)
     return (SimCore.Time * 1000.0);
 }
 
+/* every active LidarRSI instance of the vehicle, with its beam file and mounting */
+static void lidar_find_sensors(void)
+{
+    const tInfos *inf = SimCore.Vhcl.Inf;
+    char key[64];
+    char path[512];
+
+    if (inf == NULL)
+        return;
+
+    int n = iGetIntOpt(inf, "Sensor.N", 0);
+
+    for (int k = 0; k < n; ++k)
+    {
+        snprintf(key, sizeof(key), "Sensor.%d.Active", k);
+        if (iGetIntOpt(inf, key, 1) == 0)
+            continue;
+
+        snprintf(key, sizeof(key), "Sensor.%d.Ref.Param", k);
+        int param = iGetIntOpt(inf, key, -1);
+
+        snprintf(key, sizeof(key), "Sensor.Param.%d.Type", param);
+        if (param < 0 || strcmp(iGetStrOpt(inf, key, ""), "LidarRSI") != 0)
+            continue;
+
+        double pos[3] = { 0.0, 0.0, 0.0 };
+        double rot[3] = { 0.0, 0.0, 0.0 };
+
+        snprintf(key, sizeof(key), "Sensor.%d.pos", k);
+        sscanf(iGetStrOpt(inf, key, ""), "%lf %lf %lf", &pos[0], &pos[1], &pos[2]);
+        snprintf(key, sizeof(key), "Sensor.%d.rot", k);
+        sscanf(iGetStrOpt(inf, key, ""), "%lf %lf %lf", &rot[0], &rot[1], &rot[2]);
+
+        // the sensor cluster's cycle time is the closest thing to a scan period the parameters have
+        snprintf(key, sizeof(key), "Sensor.%d.Ref.Cluster", k);
+        int cluster = iGetIntOpt(inf, key, -1);
+        snprintf(key, sizeof(key), "SensorCluster.%d.CycleTime", cluster);
+        double period = (cluster >= 0 ? iGetIntOpt(inf, key, LIDAR_CYCLE_TIME) : LIDAR_CYCLE_TIME) / 1000.0;
+
+        snprintf(key, sizeof(key), "Sensor.Param.%d.Beams.FName", param);
+        const char *beams = iGetStrOpt(inf, key, "");
+
+        if (beams[0] != '\0')
+        {
+            snprintf(path, sizeof(path), "Data/Sensor/%s", beams);
+        }
+        else
+        {
+            snprintf(path, sizeof(path), "%s", lidarBeamFile);
+        }
+
+        snprintf(key, sizeof(key), "Sensor.%d.name", k);
+        lidar_add(iGetStrOpt(inf, key, ""), path, rot, pos, period);
+    }
+}
+
+static int lidar_add(const char *name, const char *beamFile, const double rot[3], const double pos[3], double period)
+{
+    if (nLidars == CMLIDAR_MAX_SENSORS)
+    {
+        CMLOG(CMLOG_LIDAR, CMLOG_WARN, "%s ignored, at most %d lidars are captured", name, CMLIDAR_MAX_SENSORS);
+        return -1;
+    }
+
+    tLidar *l = &lidars[nLidars];
+
+    memset(l, 0, sizeof(*l));
+    snprintf(l->name, sizeof(l->name), "%s", name);
+    l->index = -1;
+    l->scanNumber = -1;
+    l->scanTime = -1.0;
+
+    if ((l->id = cmlidar_add(name, beamFile, rot, pos, period)) < 0)
+        return -1;
+
+    nLidars++;
+    return 0;
+}
+
 
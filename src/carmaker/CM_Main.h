@@ -33,15 +33,6 @@ extern "C" {
 ** MARK: TYPEDEFS
 ***************************************************************/
 
-typedef struct
-{
-    double x;
-    double y;
-    double z;
-    double azimuth;
-    double elevation;
-} beam_entry_t;
-
 
 /***************************************************************
 ** MARK: FUNCTION DEFS
@@ -56,6 +47,20 @@ void CM_Main_update(void);
 
 int CM_Main_quit(void);
 
+void CM_Main_set_beam_file(const char *path);
+
+int CM_Main_set_lidar_cloud(const char *mode);
+
+int CM_Main_set_lidar_deskew(const char *mode);
+
+int CM_Main_set_lidar_voxel(const char *size);
+
+int CM_Main_set_lidar_voxel_point(const char *mode);
+
+int CM_Main_set_imu_rate(const char *rate);
+
+int CM_Main_lidar_setup(void);
+
 void CM_Main_capture_pointcloud(void);
 
 void CM_Main_capture_imu(void);
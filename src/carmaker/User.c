@@ -91,6 +91,13 @@
 #include "IOVec.h"
 #include "User.h"
 
+#include "cmbatch.h"
+#include "cmimg.h"
+#include "cmlog.h"
+#include "cmsched.h"
+#include "cmxif.h"
+#include "CM_Main.h"
+
 /* @@PLUGIN-BEGIN-INCLUDE@@ - Automatically generated code - don't edit! */
 /* @@PLUGIN-END@@ */
 
@@ -136,6 +143,17 @@ User_PrintUsage (const char *Pgm)
     LogUsage("\n");
     LogUsage("Usage: %s [options] [testrun]\n", Pgm);
     LogUsage("Options:\n");
+    LogUsage(" -cmimg %-10s Image client option, e.g. PoolDepth=6\n", "Key=Value");
+    LogUsage(" -lidarbeams %-5s Beam file for lidars without one (Data/Sensor/LidarRSI_FS_autonomous)\n", "file");
+    LogUsage(" -lidarcloud %-5s One merged cloud, one per sensor or range images: merged, sensor, range (merged)\n", "mode");
+    LogUsage(" -lidardeskew %-4s Move lidar points to the scan end pose (on)\n", "mode");
+    LogUsage(" -lidarvoxel %-5s Downsample clouds to voxels of this size in m (0, off)\n", "size");
+    LogUsage(" -lidarvoxelpoint %-4s Point kept per voxel, centroid or first (centroid)\n", "mode");
+    LogUsage(" -imurate %-8s Send IMU samples in batches at this rate in Hz (0, every sample)\n", "rate");
+    LogUsage(" -log %-11s Log level, for all or per module, e.g. lidar=debug,rsds=warn (info)\n", "spec");
+    LogUsage(" -sched %-9s Task rates as task=period[:phase[:budget]] in ms/us, e.g. lidar=10:auto:2000\n", "spec");
+    LogUsage(" -xifqueue %-6s XIF queues as stream=depth[:oldest|newest], e.g. camera=4:newest\n", "spec");
+    LogUsage(" -batch %-9s Headless, unthrottled run of the test run, output and timing to dir\n", "dir");
 
 #if defined(CM_HIL)
     {
@@ -174,6 +192,38 @@ User_ScanCmdLine (int argc, char **argv)
 	if (strcmp(*argv, "-io") == 0 && argv[1] != NULL) {
 	    if (IO_Select(*++argv) != 0)
 		return NULL;
+	} else if (strcmp(*argv, "-cmimg") == 0 && argv[1] != NULL) {
+	    if (cmimg_set_option(*++argv) != 0)
+		return NULL;
+	} else if (strcmp(*argv, "-lidarbeams") == 0 && argv[1] != NULL) {
+	    CM_Main_set_beam_file(*++argv);
+	} else if (strcmp(*argv, "-lidarcloud") == 0 && argv[1] != NULL) {
+	    if (CM_Main_set_lidar_cloud(*++argv) != 0)
+		return NULL;
+	} else if (strcmp(*argv, "-lidardeskew") == 0 && argv[1] != NULL) {
+	    if (CM_Main_set_lidar_deskew(*++argv) != 0)
+		return NULL;
+	} else if (strcmp(*argv, "-lidarvoxel") == 0 && argv[1] != NULL) {
+	    if (CM_Main_set_lidar_voxel(*++argv) != 0)
+		return NULL;
+	} else if (strcmp(*argv, "-lidarvoxelpoint") == 0 && argv[1] != NULL) {
+	    if (CM_Main_set_lidar_voxel_point(*++argv) != 0)
+		return NULL;
+	} else if (strcmp(*argv, "-imurate") == 0 && argv[1] != NULL) {
+	    if (CM_Main_set_imu_rate(*++argv) != 0)
+		return NULL;
+	} else if (strcmp(*argv, "-log") == 0 && argv[1] != NULL) {
+	    if (cmlog_set_option(*++argv) != 0)
+		return NULL;
+	} else if (strcmp(*argv, "-sched") == 0 && argv[1] != NULL) {
+	    if (cmsched_set_option(*++argv) != 0)
+		return NULL;
+	} else if (strcmp(*argv, "-xifqueue") == 0 && argv[1] != NULL) {
+	    if (cmxif_set_option(*++argv) != 0)
+		return NULL;
+	} else if (strcmp(*argv, "-batch") == 0 && argv[1] != NULL) {
+	    if (cmbatch_set_option(*++argv) != 0)
+		return NULL;
 	} else if (strcmp(*argv, "-h") == 0 || strcmp(*argv, "-help") == 0) {
 	    User_PrintUsage(Pgm);
 	    SimCore_PrintUsage(Pgm); /* Possible exit(), depending on CM-platform! */
@@ -387,6 +437,11 @@ User_TestRun_Start_atEnd (void)
 #if defined(XENO)
     IOConf_DeclQuants();
 #endif
+
+    /* beam geometry is fixed for the whole run, build the lookup table once */
+    if (CM_Main_lidar_setup() != 0)
+	return -1;
+
     return 0;
 }
 
@@ -1,15004 +0,0 @@
-#include "CM_Main.h"
-
-beam_entry_t beam_table[] = {
-    {0.00, 0.00, 0.00, -59.80, -4.90},
-    {0.00, 0.00, 0.00, -59.40, -4.90},
-    {0.00, 0.00, 0.00, -59.00, -4.90},
-    {0.00, 0.00, 0.00, -58.60, -4.90},
-    {0.00, 0.00, 0.00, -58.20, -4.90},
-    {0.00, 0.00, 0.00, -57.80, -4.90},
-    {0.00, 0.00, 0.00, -57.40, -4.90},
-    {0.00, 0.00, 0.00, -57.00, -4.90},
-    {0.00, 0.00, 0.00, -56.60, -4.90},
-    {0.00, 0.00, 0.00, -56.20, -4.90},
-    {0.00, 0.00, 0.00, -55.80, -4.90},
-    {0.00, 0.00, 0.00, -55.40, -4.90},
-    {0.00, 0.00, 0.00, -55.00, -4.90},
-    {0.00, 0.00, 0.00, -54.60, -4.90},
-    {0.00, 0.00, 0.00, -54.20, -4.90},
-    {0.00, 0.00, 0.00, -53.80, -4.90},
-    {0.00, 0.00, 0.00, -53.40, -4.90},
-    {0.00, 0.00, 0.00, -53.00, -4.90},
-    {0.00, 0.00, 0.00, -52.60, -4.90},
-    {0.00, 0.00, 0.00, -52.20, -4.90},
-    {0.00, 0.00, 0.00, -51.80, -4.90},
-    {0.00, 0.00, 0.00, -51.40, -4.90},
-    {0.00, 0.00, 0.00, -51.00, -4.90},
-    {0.00, 0.00, 0.00, -50.60, -4.90},
-    {0.00, 0.00, 0.00, -50.20, -4.90},
-    {0.00, 0.00, 0.00, -49.80, -4.90},
-    {0.00, 0.00, 0.00, -49.40, -4.90},
-    {0.00, 0.00, 0.00, -49.00, -4.90},
-    {0.00, 0.00, 0.00, -48.60, -4.90},
-    {0.00, 0.00, 0.00, -48.20, -4.90},
-    {0.00, 0.00, 0.00, -47.80, -4.90},
-    {0.00, 0.00, 0.00, -47.40, -4.90},
-    {0.00, 0.00, 0.00, -47.00, -4.90},
-    {0.00, 0.00, 0.00, -46.60, -4.90},
-    {0.00, 0.00, 0.00, -46.20, -4.90},
-    {0.00, 0.00, 0.00, -45.80, -4.90},
-    {0.00, 0.00, 0.00, -45.40, -4.90},
-    {0.00, 0.00, 0.00, -45.00, -4.90},
-    {0.00, 0.00, 0.00, -44.60, -4.90},
-    {0.00, 0.00, 0.00, -44.20, -4.90},
-    {0.00, 0.00, 0.00, -43.80, -4.90},
-    {0.00, 0.00, 0.00, -43.40, -4.90},
-    {0.00, 0.00, 0.00, -43.00, -4.90},
-    {0.00, 0.00, 0.00, -42.60, -4.90},
-    {0.00, 0.00, 0.00, -42.20, -4.90},
-    {0.00, 0.00, 0.00, -41.80, -4.90},
-    {0.00, 0.00, 0.00, -41.40, -4.90},
-    {0.00, 0.00, 0.00, -41.00, -4.90},
-    {0.00, 0.00, 0.00, -40.60, -4.90},
-    {0.00, 0.00, 0.00, -40.20, -4.90},
-    {0.00, 0.00, 0.00, -39.80, -4.90},
-    {0.00, 0.00, 0.00, -39.40, -4.90},
-    {0.00, 0.00, 0.00, -39.00, -4.90},
-    {0.00, 0.00, 0.00, -38.60, -4.90},
-    {0.00, 0.00, 0.00, -38.20, -4.90},
-    {0.00, 0.00, 0.00, -37.80, -4.90},
-    {0.00, 0.00, 0.00, -37.40, -4.90},
-    {0.00, 0.00, 0.00, -37.00, -4.90},
-    {0.00, 0.00, 0.00, -36.60, -4.90},
-    {0.00, 0.00, 0.00, -36.20, -4.90},
-    {0.00, 0.00, 0.00, -35.80, -4.90},
-    {0.00, 0.00, 0.00, -35.40, -4.90},
-    {0.00, 0.00, 0.00, -35.00, -4.90},
-    {0.00, 0.00, 0.00, -34.60, -4.90},
-    {0.00, 0.00, 0.00, -34.20, -4.90},
-    {0.00, 0.00, 0.00, -33.80, -4.90},
-    {0.00, 0.00, 0.00, -33.40, -4.90},
-    {0.00, 0.00, 0.00, -33.00, -4.90},
-    {0.00, 0.00, 0.00, -32.60, -4.90},
-    {0.00, 0.00, 0.00, -32.20, -4.90},
-    {0.00, 0.00, 0.00, -31.80, -4.90},
-    {0.00, 0.00, 0.00, -31.40, -4.90},
-    {0.00, 0.00, 0.00, -31.00, -4.90},
-    {0.00, 0.00, 0.00, -30.60, -4.90},
-    {0.00, 0.00, 0.00, -30.20, -4.90},
-    {0.00, 0.00, 0.00, -29.80, -4.90},
-    {0.00, 0.00, 0.00, -29.40, -4.90},
-    {0.00, 0.00, 0.00, -29.00, -4.90},
-    {0.00, 0.00, 0.00, -28.60, -4.90},
-    {0.00, 0.00, 0.00, -28.20, -4.90},
-    {0.00, 0.00, 0.00, -27.80, -4.90},
-    {0.00, 0.00, 0.00, -27.40, -4.90},
-    {0.00, 0.00, 0.00, -27.00, -4.90},
-    {0.00, 0.00, 0.00, -26.60, -4.90},
-    {0.00, 0.00, 0.00, -26.20, -4.90},
-    {0.00, 0.00, 0.00, -25.80, -4.90},
-    {0.00, 0.00, 0.00, -25.40, -4.90},
-    {0.00, 0.00, 0.00, -25.00, -4.90},
-    {0.00, 0.00, 0.00, -24.60, -4.90},
-    {0.00, 0.00, 0.00, -24.20, -4.90},
-    {0.00, 0.00, 0.00, -23.80, -4.90},
-    {0.00, 0.00, 0.00, -23.40, -4.90},
-    {0.00, 0.00, 0.00, -23.00, -4.90},
-    {0.00, 0.00, 0.00, -22.60, -4.90},
-    {0.00, 0.00, 0.00, -22.20, -4.90},
-    {0.00, 0.00, 0.00, -21.80, -4.90},
-    {0.00, 0.00, 0.00, -21.40, -4.90},
-    {0.00, 0.00, 0.00, -21.00, -4.90},
-    {0.00, 0.00, 0.00, -20.60, -4.90},
-    {0.00, 0.00, 0.00, -20.20, -4.90},
-    {0.00, 0.00, 0.00, -19.80, -4.90},
-    {0.00, 0.00, 0.00, -19.40, -4.90},
-    {0.00, 0.00, 0.00, -19.00, -4.90},
-    {0.00, 0.00, 0.00, -18.60, -4.90},
-    {0.00, 0.00, 0.00, -18.20, -4.90},
-    {0.00, 0.00, 0.00, -17.80, -4.90},
-    {0.00, 0.00, 0.00, -17.40, -4.90},
-    {0.00, 0.00, 0.00, -17.00, -4.90},
-    {0.00, 0.00, 0.00, -16.60, -4.90},
-    {0.00, 0.00, 0.00, -16.20, -4.90},
-    {0.00, 0.00, 0.00, -15.80, -4.90},
-    {0.00, 0.00, 0.00, -15.40, -4.90},
-    {0.00, 0.00, 0.00, -15.00, -4.90},
-    {0.00, 0.00, 0.00, -14.60, -4.90},
-    {0.00, 0.00, 0.00, -14.20, -4.90},
-    {0.00, 0.00, 0.00, -13.80, -4.90},
-    {0.00, 0.00, 0.00, -13.40, -4.90},
-    {0.00, 0.00, 0.00, -13.00, -4.90},
-    {0.00, 0.00, 0.00, -12.60, -4.90},
-    {0.00, 0.00, 0.00, -12.20, -4.90},
-    {0.00, 0.00, 0.00, -11.80, -4.90},
-    {0.00, 0.00, 0.00, -11.40, -4.90},
-    {0.00, 0.00, 0.00, -11.00, -4.90},
-    {0.00, 0.00, 0.00, -10.60, -4.90},
-    {0.00, 0.00, 0.00, -10.20, -4.90},
-    {0.00, 0.00, 0.00, -9.80, -4.90},
-    {0.00, 0.00, 0.00, -9.40, -4.90},
-    {0.00, 0.00, 0.00, -9.00, -4.90},
-    {0.00, 0.00, 0.00, -8.60, -4.90},
-    {0.00, 0.00, 0.00, -8.20, -4.90},
-    {0.00, 0.00, 0.00, -7.80, -4.90},
-    {0.00, 0.00, 0.00, -7.40, -4.90},
-    {0.00, 0.00, 0.00, -7.00, -4.90},
-    {0.00, 0.00, 0.00, -6.60, -4.90},
-    {0.00, 0.00, 0.00, -6.20, -4.90},
-    {0.00, 0.00, 0.00, -5.80, -4.90},
-    {0.00, 0.00, 0.00, -5.40, -4.90},
-    {0.00, 0.00, 0.00, -5.00, -4.90},
-    {0.00, 0.00, 0.00, -4.60, -4.90},
-    {0.00, 0.00, 0.00, -4.20, -4.90},
-    {0.00, 0.00, 0.00, -3.80, -4.90},
-    {0.00, 0.00, 0.00, -3.40, -4.90},
-    {0.00, 0.00, 0.00, -3.00, -4.90},
-    {0.00, 0.00, 0.00, -2.60, -4.90},
-    {0.00, 0.00, 0.00, -2.20, -4.90},
-    {0.00, 0.00, 0.00, -1.80, -4.90},
-    {0.00, 0.00, 0.00, -1.40, -4.90},
-    {0.00, 0.00, 0.00, -1.00, -4.90},
-    {0.00, 0.00, 0.00, -0.60, -4.90},
-    {0.00, 0.00, 0.00, -0.20, -4.90},
-    {0.00, 0.00, 0.00, 0.20, -4.90},
-    {0.00, 0.00, 0.00, 0.60, -4.90},
-    {0.00, 0.00, 0.00, 1.00, -4.90},
-    {0.00, 0.00, 0.00, 1.40, -4.90},
-    {0.00, 0.00, 0.00, 1.80, -4.90},
-    {0.00, 0.00, 0.00, 2.20, -4.90},
-    {0.00, 0.00, 0.00, 2.60, -4.90},
-    {0.00, 0.00, 0.00, 3.00, -4.90},
-    {0.00, 0.00, 0.00, 3.40, -4.90},
-    {0.00, 0.00, 0.00, 3.80, -4.90},
-    {0.00, 0.00, 0.00, 4.20, -4.90},
-    {0.00, 0.00, 0.00, 4.60, -4.90},
-    {0.00, 0.00, 0.00, 5.00, -4.90},
-    {0.00, 0.00, 0.00, 5.40, -4.90},
-    {0.00, 0.00, 0.00, 5.80, -4.90},
-    {0.00, 0.00, 0.00, 6.20, -4.90},
-    {0.00, 0.00, 0.00, 6.60, -4.90},
-    {0.00, 0.00, 0.00, 7.00, -4.90},
-    {0.00, 0.00, 0.00, 7.40, -4.90},
-    {0.00, 0.00, 0.00, 7.80, -4.90},
-    {0.00, 0.00, 0.00, 8.20, -4.90},
-    {0.00, 0.00, 0.00, 8.60, -4.90},
-    {0.00, 0.00, 0.00, 9.00, -4.90},
-    {0.00, 0.00, 0.00, 9.40, -4.90},
-    {0.00, 0.00, 0.00, 9.80, -4.90},
-    {0.00, 0.00, 0.00, 10.20, -4.90},
-    {0.00, 0.00, 0.00, 10.60, -4.90},
-    {0.00, 0.00, 0.00, 11.00, -4.90},
-    {0.00, 0.00, 0.00, 11.40, -4.90},
-    {0.00, 0.00, 0.00, 11.80, -4.90},
-    {0.00, 0.00, 0.00, 12.20, -4.90},
-    {0.00, 0.00, 0.00, 12.60, -4.90},
-    {0.00, 0.00, 0.00, 13.00, -4.90},
-    {0.00, 0.00, 0.00, 13.40, -4.90},
-    {0.00, 0.00, 0.00, 13.80, -4.90},
-    {0.00, 0.00, 0.00, 14.20, -4.90},
-    {0.00, 0.00, 0.00, 14.60, -4.90},
-    {0.00, 0.00, 0.00, 15.00, -4.90},
-    {0.00, 0.00, 0.00, 15.40, -4.90},
-    {0.00, 0.00, 0.00, 15.80, -4.90},
-    {0.00, 0.00, 0.00, 16.20, -4.90},
-    {0.00, 0.00, 0.00, 16.60, -4.90},
-    {0.00, 0.00, 0.00, 17.00, -4.90},
-    {0.00, 0.00, 0.00, 17.40, -4.90},
-    {0.00, 0.00, 0.00, 17.80, -4.90},
-    {0.00, 0.00, 0.00, 18.20, -4.90},
-    {0.00, 0.00, 0.00, 18.60, -4.90},
-    {0.00, 0.00, 0.00, 19.00, -4.90},
-    {0.00, 0.00, 0.00, 19.40, -4.90},
-    {0.00, 0.00, 0.00, 19.80, -4.90},
-    {0.00, 0.00, 0.00, 20.20, -4.90},
-    {0.00, 0.00, 0.00, 20.60, -4.90},
-    {0.00, 0.00, 0.00, 21.00, -4.90},
-    {0.00, 0.00, 0.00, 21.40, -4.90},
-    {0.00, 0.00, 0.00, 21.80, -4.90},
-    {0.00, 0.00, 0.00, 22.20, -4.90},
-    {0.00, 0.00, 0.00, 22.60, -4.90},
-    {0.00, 0.00, 0.00, 23.00, -4.90},
-    {0.00, 0.00, 0.00, 23.40, -4.90},
-    {0.00, 0.00, 0.00, 23.80, -4.90},
-    {0.00, 0.00, 0.00, 24.20, -4.90},
-    {0.00, 0.00, 0.00, 24.60, -4.90},
-    {0.00, 0.00, 0.00, 25.00, -4.90},
-    {0.00, 0.00, 0.00, 25.40, -4.90},
-    {0.00, 0.00, 0.00, 25.80, -4.90},
-    {0.00, 0.00, 0.00, 26.20, -4.90},
-    {0.00, 0.00, 0.00, 26.60, -4.90},
-    {0.00, 0.00, 0.00, 27.00, -4.90},
-    {0.00, 0.00, 0.00, 27.40, -4.90},
-    {0.00, 0.00, 0.00, 27.80, -4.90},
-    {0.00, 0.00, 0.00, 28.20, -4.90},
-    {0.00, 0.00, 0.00, 28.60, -4.90},
-    {0.00, 0.00, 0.00, 29.00, -4.90},
-    {0.00, 0.00, 0.00, 29.40, -4.90},
-    {0.00, 0.00, 0.00, 29.80, -4.90},
-    {0.00, 0.00, 0.00, 30.20, -4.90},
-    {0.00, 0.00, 0.00, 30.60, -4.90},
-    {0.00, 0.00, 0.00, 31.00, -4.90},
-    {0.00, 0.00, 0.00, 31.40, -4.90},
-    {0.00, 0.00, 0.00, 31.80, -4.90},
-    {0.00, 0.00, 0.00, 32.20, -4.90},
-    {0.00, 0.00, 0.00, 32.60, -4.90},
-    {0.00, 0.00, 0.00, 33.00, -4.90},
-    {0.00, 0.00, 0.00, 33.40, -4.90},
-    {0.00, 0.00, 0.00, 33.80, -4.90},
-    {0.00, 0.00, 0.00, 34.20, -4.90},
-    {0.00, 0.00, 0.00, 34.60, -4.90},
-    {0.00, 0.00, 0.00, 35.00, -4.90},
-    {0.00, 0.00, 0.00, 35.40, -4.90},
-    {0.00, 0.00, 0.00, 35.80, -4.90},
-    {0.00, 0.00, 0.00, 36.20, -4.90},
-    {0.00, 0.00, 0.00, 36.60, -4.90},
-    {0.00, 0.00, 0.00, 37.00, -4.90},
-    {0.00, 0.00, 0.00, 37.40, -4.90},
-    {0.00, 0.00, 0.00, 37.80, -4.90},
-    {0.00, 0.00, 0.00, 38.20, -4.90},
-    {0.00, 0.00, 0.00, 38.60, -4.90},
-    {0.00, 0.00, 0.00, 39.00, -4.90},
-    {0.00, 0.00, 0.00, 39.40, -4.90},
-    {0.00, 0.00, 0.00, 39.80, -4.90},
-    {0.00, 0.00, 0.00, 40.20, -4.90},
-    {0.00, 0.00, 0.00, 40.60, -4.90},
-    {0.00, 0.00, 0.00, 41.00, -4.90},
-    {0.00, 0.00, 0.00, 41.40, -4.90},
-    {0.00, 0.00, 0.00, 41.80, -4.90},
-    {0.00, 0.00, 0.00, 42.20, -4.90},
-    {0.00, 0.00, 0.00, 42.60, -4.90},
-    {0.00, 0.00, 0.00, 43.00, -4.90},
-    {0.00, 0.00, 0.00, 43.40, -4.90},
-    {0.00, 0.00, 0.00, 43.80, -4.90},
-    {0.00, 0.00, 0.00, 44.20, -4.90},
-    {0.00, 0.00, 0.00, 44.60, -4.90},
-    {0.00, 0.00, 0.00, 45.00, -4.90},
-    {0.00, 0.00, 0.00, 45.40, -4.90},
-    {0.00, 0.00, 0.00, 45.80, -4.90},
-    {0.00, 0.00, 0.00, 46.20, -4.90},
-    {0.00, 0.00, 0.00, 46.60, -4.90},
-    {0.00, 0.00, 0.00, 47.00, -4.90},
-    {0.00, 0.00, 0.00, 47.40, -4.90},
-    {0.00, 0.00, 0.00, 47.80, -4.90},
-    {0.00, 0.00, 0.00, 48.20, -4.90},
-    {0.00, 0.00, 0.00, 48.60, -4.90},
-    {0.00, 0.00, 0.00, 49.00, -4.90},
-    {0.00, 0.00, 0.00, 49.40, -4.90},
-    {0.00, 0.00, 0.00, 49.80, -4.90},
-    {0.00, 0.00, 0.00, 50.20, -4.90},
-    {0.00, 0.00, 0.00, 50.60, -4.90},
-    {0.00, 0.00, 0.00, 51.00, -4.90},
-    {0.00, 0.00, 0.00, 51.40, -4.90},
-    {0.00, 0.00, 0.00, 51.80, -4.90},
-    {0.00, 0.00, 0.00, 52.20, -4.90},
-    {0.00, 0.00, 0.00, 52.60, -4.90},
-    {0.00, 0.00, 0.00, 53.00, -4.90},
-    {0.00, 0.00, 0.00, 53.40, -4.90},
-    {0.00, 0.00, 0.00, 53.80, -4.90},
-    {0.00, 0.00, 0.00, 54.20, -4.90},
-    {0.00, 0.00, 0.00, 54.60, -4.90},
-    {0.00, 0.00, 0.00, 55.00, -4.90},
-    {0.00, 0.00, 0.00, 55.40, -4.90},
-    {0.00, 0.00, 0.00, 55.80, -4.90},
-    {0.00, 0.00, 0.00, 56.20, -4.90},
-    {0.00, 0.00, 0.00, 56.60, -4.90},
-    {0.00, 0.00, 0.00, 57.00, -4.90},
-    {0.00, 0.00, 0.00, 57.40, -4.90},
-    {0.00, 0.00, 0.00, 57.80, -4.90},
-    {0.00, 0.00, 0.00, 58.20, -4.90},
-    {0.00, 0.00, 0.00, 58.60, -4.90},
-    {0.00, 0.00, 0.00, 59.00, -4.90},
-    {0.00, 0.00, 0.00, 59.40, -4.90},
-    {0.00, 0.00, 0.00, 59.80, -4.90},
-    {0.00, 0.00, 0.00, -59.80, -4.70},
-    {0.00, 0.00, 0.00, -59.40, -4.70},
-    {0.00, 0.00, 0.00, -59.00, -4.70},
-    {0.00, 0.00, 0.00, -58.60, -4.70},
-    {0.00, 0.00, 0.00, -58.20, -4.70},
-    {0.00, 0.00, 0.00, -57.80, -4.70},
-    {0.00, 0.00, 0.00, -57.40, -4.70},
-    {0.00, 0.00, 0.00, -57.00, -4.70},
-    {0.00, 0.00, 0.00, -56.60, -4.70},
-    {0.00, 0.00, 0.00, -56.20, -4.70},
-    {0.00, 0.00, 0.00, -55.80, -4.70},
-    {0.00, 0.00, 0.00, -55.40, -4.70},
-    {0.00, 0.00, 0.00, -55.00, -4.70},
-    {0.00, 0.00, 0.00, -54.60, -4.70},
-    {0.00, 0.00, 0.00, -54.20, -4.70},
-    {0.00, 0.00, 0.00, -53.80, -4.70},
-    {0.00, 0.00, 0.00, -53.40, -4.70},
-    {0.00, 0.00, 0.00, -53.00, -4.70},
-    {0.00, 0.00, 0.00, -52.60, -4.70},
-    {0.00, 0.00, 0.00, -52.20, -4.70},
-    {0.00, 0.00, 0.00, -51.80, -4.70},
-    {0.00, 0.00, 0.00, -51.40, -4.70},
-    {0.00, 0.00, 0.00, -51.00, -4.70},
-    {0.00, 0.00, 0.00, -50.60, -4.70},
-    {0.00, 0.00, 0.00, -50.20, -4.70},
-    {0.00, 0.00, 0.00, -49.80, -4.70},
-    {0.00, 0.00, 0.00, -49.40, -4.70},
-    {0.00, 0.00, 0.00, -49.00, -4.70},
-    {0.00, 0.00, 0.00, -48.60, -4.70},
-    {0.00, 0.00, 0.00, -48.20, -4.70},
-    {0.00, 0.00, 0.00, -47.80, -4.70},
-    {0.00, 0.00, 0.00, -47.40, -4.70},
-    {0.00, 0.00, 0.00, -47.00, -4.70},
-    {0.00, 0.00, 0.00, -46.60, -4.70},
-    {0.00, 0.00, 0.00, -46.20, -4.70},
-    {0.00, 0.00, 0.00, -45.80, -4.70},
-    {0.00, 0.00, 0.00, -45.40, -4.70},
-    {0.00, 0.00, 0.00, -45.00, -4.70},
-    {0.00, 0.00, 0.00, -44.60, -4.70},
-    {0.00, 0.00, 0.00, -44.20, -4.70},
-    {0.00, 0.00, 0.00, -43.80, -4.70},
-    {0.00, 0.00, 0.00, -43.40, -4.70},
-    {0.00, 0.00, 0.00, -43.00, -4.70},
-    {0.00, 0.00, 0.00, -42.60, -4.70},
-    {0.00, 0.00, 0.00, -42.20, -4.70},
-    {0.00, 0.00, 0.00, -41.80, -4.70},
-    {0.00, 0.00, 0.00, -41.40, -4.70},
-    {0.00, 0.00, 0.00, -41.00, -4.70},
-    {0.00, 0.00, 0.00, -40.60, -4.70},
-    {0.00, 0.00, 0.00, -40.20, -4.70},
-    {0.00, 0.00, 0.00, -39.80, -4.70},
-    {0.00, 0.00, 0.00, -39.40, -4.70},
-    {0.00, 0.00, 0.00, -39.00, -4.70},
-    {0.00, 0.00, 0.00, -38.60, -4.70},
-    {0.00, 0.00, 0.00, -38.20, -4.70},
-    {0.00, 0.00, 0.00, -37.80, -4.70},
-    {0.00, 0.00, 0.00, -37.40, -4.70},
-    {0.00, 0.00, 0.00, -37.00, -4.70},
-    {0.00, 0.00, 0.00, -36.60, -4.70},
-    {0.00, 0.00, 0.00, -36.20, -4.70},
-    {0.00, 0.00, 0.00, -35.80, -4.70},
-    {0.00, 0.00, 0.00, -35.40, -4.70},
-    {0.00, 0.00, 0.00, -35.00, -4.70},
-    {0.00, 0.00, 0.00, -34.60, -4.70},
-    {0.00, 0.00, 0.00, -34.20, -4.70},
-    {0.00, 0.00, 0.00, -33.80, -4.70},
-    {0.00, 0.00, 0.00, -33.40, -4.70},
-    {0.00, 0.00, 0.00, -33.00, -4.70},
-    {0.00, 0.00, 0.00, -32.60, -4.70},
-    {0.00, 0.00, 0.00, -32.20, -4.70},
-    {0.00, 0.00, 0.00, -31.80, -4.70},
-    {0.00, 0.00, 0.00, -31.40, -4.70},
-    {0.00, 0.00, 0.00, -31.00, -4.70},
-    {0.00, 0.00, 0.00, -30.60, -4.70},
-    {0.00, 0.00, 0.00, -30.20, -4.70},
-    {0.00, 0.00, 0.00, -29.80, -4.70},
-    {0.00, 0.00, 0.00, -29.40, -4.70},
-    {0.00, 0.00, 0.00, -29.00, -4.70},
-    {0.00, 0.00, 0.00, -28.60, -4.70},
-    {0.00, 0.00, 0.00, -28.20, -4.70},
-    {0.00, 0.00, 0.00, -27.80, -4.70},
-    {0.00, 0.00, 0.00, -27.40, -4.70},
-    {0.00, 0.00, 0.00, -27.00, -4.70},
-    {0.00, 0.00, 0.00, -26.60, -4.70},
-    {0.00, 0.00, 0.00, -26.20, -4.70},
-    {0.00, 0.00, 0.00, -25.80, -4.70},
-    {0.00, 0.00, 0.00, -25.40, -4.70},
-    {0.00, 0.00, 0.00, -25.00, -4.70},
-    {0.00, 0.00, 0.00, -24.60, -4.70},
-    {0.00, 0.00, 0.00, -24.20, -4.70},
-    {0.00, 0.00, 0.00, -23.80, -4.70},
-    {0.00, 0.00, 0.00, -23.40, -4.70},
-    {0.00, 0.00, 0.00, -23.00, -4.70},
-    {0.00, 0.00, 0.00, -22.60, -4.70},
-    {0.00, 0.00, 0.00, -22.20, -4.70},
-    {0.00, 0.00, 0.00, -21.80, -4.70},
-    {0.00, 0.00, 0.00, -21.40, -4.70},
-    {0.00, 0.00, 0.00, -21.00, -4.70},
-    {0.00, 0.00, 0.00, -20.60, -4.70},
-    {0.00, 0.00, 0.00, -20.20, -4.70},
-    {0.00, 0.00, 0.00, -19.80, -4.70},
-    {0.00, 0.00, 0.00, -19.40, -4.70},
-    {0.00, 0.00, 0.00, -19.00, -4.70},
-    {0.00, 0.00, 0.00, -18.60, -4.70},
-    {0.00, 0.00, 0.00, -18.20, -4.70},
-    {0.00, 0.00, 0.00, -17.80, -4.70},
-    {0.00, 0.00, 0.00, -17.40, -4.70},
-    {0.00, 0.00, 0.00, -17.00, -4.70},
-    {0.00, 0.00, 0.00, -16.60, -4.70},
-    {0.00, 0.00, 0.00, -16.20, -4.70},
-    {0.00, 0.00, 0.00, -15.80, -4.70},
-    {0.00, 0.00, 0.00, -15.40, -4.70},
-    {0.00, 0.00, 0.00, -15.00, -4.70},
-    {0.00, 0.00, 0.00, -14.60, -4.70},
-    {0.00, 0.00, 0.00, -14.20, -4.70},
-    {0.00, 0.00, 0.00, -13.80, -4.70},
-    {0.00, 0.00, 0.00, -13.40, -4.70},
-    {0.00, 0.00, 0.00, -13.00, -4.70},
-    {0.00, 0.00, 0.00, -12.60, -4.70},
-    {0.00, 0.00, 0.00, -12.20, -4.70},
-    {0.00, 0.00, 0.00, -11.80, -4.70},
-    {0.00, 0.00, 0.00, -11.40, -4.70},
-    {0.00, 0.00, 0.00, -11.00, -4.70},
-    {0.00, 0.00, 0.00, -10.60, -4.70},
-    {0.00, 0.00, 0.00, -10.20, -4.70},
-    {0.00, 0.00, 0.00, -9.80, -4.70},
-    {0.00, 0.00, 0.00, -9.40, -4.70},
-    {0.00, 0.00, 0.00, -9.00, -4.70},
-    {0.00, 0.00, 0.00, -8.60, -4.70},
-    {0.00, 0.00, 0.00, -8.20, -4.70},
-    {0.00, 0.00, 0.00, -7.80, -4.70},
-    {0.00, 0.00, 0.00, -7.40, -4.70},
-    {0.00, 0.00, 0.00, -7.00, -4.70},
-    {0.00, 0.00, 0.00, -6.60, -4.70},
-    {0.00, 0.00, 0.00, -6.20, -4.70},
-    {0.00, 0.00, 0.00, -5.80, -4.70},
-    {0.00, 0.00, 0.00, -5.40, -4.70},
-    {0.00, 0.00, 0.00, -5.00, -4.70},
-    {0.00, 0.00, 0.00, -4.60, -4.70},
-    {0.00, 0.00, 0.00, -4.20, -4.70},
-    {0.00, 0.00, 0.00, -3.80, -4.70},
-    {0.00, 0.00, 0.00, -3.40, -4.70},
-    {0.00, 0.00, 0.00, -3.00, -4.70},
-    {0.00, 0.00, 0.00, -2.60, -4.70},
-    {0.00, 0.00, 0.00, -2.20, -4.70},
-    {0.00, 0.00, 0.00, -1.80, -4.70},
-    {0.00, 0.00, 0.00, -1.40, -4.70},
-    {0.00, 0.00, 0.00, -1.00, -4.70},
-    {0.00, 0.00, 0.00, -0.60, -4.70},
-    {0.00, 0.00, 0.00, -0.20, -4.70},
-    {0.00, 0.00, 0.00, 0.20, -4.70},
-    {0.00, 0.00, 0.00, 0.60, -4.70},
-    {0.00, 0.00, 0.00, 1.00, -4.70},
-    {0.00, 0.00, 0.00, 1.40, -4.70},
-    {0.00, 0.00, 0.00, 1.80, -4.70},
-    {0.00, 0.00, 0.00, 2.20, -4.70},
-    {0.00, 0.00, 0.00, 2.60, -4.70},
-    {0.00, 0.00, 0.00, 3.00, -4.70},
-    {0.00, 0.00, 0.00, 3.40, -4.70},
-    {0.00, 0.00, 0.00, 3.80, -4.70},
-    {0.00, 0.00, 0.00, 4.20, -4.70},
-    {0.00, 0.00, 0.00, 4.60, -4.70},
-    {0.00, 0.00, 0.00, 5.00, -4.70},
-    {0.00, 0.00, 0.00, 5.40, -4.70},
-    {0.00, 0.00, 0.00, 5.80, -4.70},
-    {0.00, 0.00, 0.00, 6.20, -4.70},
-    {0.00, 0.00, 0.00, 6.60, -4.70},
-    {0.00, 0.00, 0.00, 7.00, -4.70},
-    {0.00, 0.00, 0.00, 7.40, -4.70},
-    {0.00, 0.00, 0.00, 7.80, -4.70},
-    {0.00, 0.00, 0.00, 8.20, -4.70},
-    {0.00, 0.00, 0.00, 8.60, -4.70},
-    {0.00, 0.00, 0.00, 9.00, -4.70},
-    {0.00, 0.00, 0.00, 9.40, -4.70},
-    {0.00, 0.00, 0.00, 9.80, -4.70},
-    {0.00, 0.00, 0.00, 10.20, -4.70},
-    {0.00, 0.00, 0.00, 10.60, -4.70},
-    {0.00, 0.00, 0.00, 11.00, -4.70},
-    {0.00, 0.00, 0.00, 11.40, -4.70},
-    {0.00, 0.00, 0.00, 11.80, -4.70},
-    {0.00, 0.00, 0.00, 12.20, -4.70},
-    {0.00, 0.00, 0.00, 12.60, -4.70},
-    {0.00, 0.00, 0.00, 13.00, -4.70},
-    {0.00, 0.00, 0.00, 13.40, -4.70},
-    {0.00, 0.00, 0.00, 13.80, -4.70},
-    {0.00, 0.00, 0.00, 14.20, -4.70},
-    {0.00, 0.00, 0.00, 14.60, -4.70},
-    {0.00, 0.00, 0.00, 15.00, -4.70},
-    {0.00, 0.00, 0.00, 15.40, -4.70},
-    {0.00, 0.00, 0.00, 15.80, -4.70},
-    {0.00, 0.00, 0.00, 16.20, -4.70},
-    {0.00, 0.00, 0.00, 16.60, -4.70},
-    {0.00, 0.00, 0.00, 17.00, -4.70},
-    {0.00, 0.00, 0.00, 17.40, -4.70},
-    {0.00, 0.00, 0.00, 17.80, -4.70},
-    {0.00, 0.00, 0.00, 18.20, -4.70},
-    {0.00, 0.00, 0.00, 18.60, -4.70},
-    {0.00, 0.00, 0.00, 19.00, -4.70},
-    {0.00, 0.00, 0.00, 19.40, -4.70},
-    {0.00, 0.00, 0.00, 19.80, -4.70},
-    {0.00, 0.00, 0.00, 20.20, -4.70},
-    {0.00, 0.00, 0.00, 20.60, -4.70},
-    {0.00, 0.00, 0.00, 21.00, -4.70},
-    {0.00, 0.00, 0.00, 21.40, -4.70},
-    {0.00, 0.00, 0.00, 21.80, -4.70},
-    {0.00, 0.00, 0.00, 22.20, -4.70},
-    {0.00, 0.00, 0.00, 22.60, -4.70},
-    {0.00, 0.00, 0.00, 23.00, -4.70},
-    {0.00, 0.00, 0.00, 23.40, -4.70},
-    {0.00, 0.00, 0.00, 23.80, -4.70},
-    {0.00, 0.00, 0.00, 24.20, -4.70},
-    {0.00, 0.00, 0.00, 24.60, -4.70},
-    {0.00, 0.00, 0.00, 25.00, -4.70},
-    {0.00, 0.00, 0.00, 25.40, -4.70},
-    {0.00, 0.00, 0.00, 25.80, -4.70},
-    {0.00, 0.00, 0.00, 26.20, -4.70},
-    {0.00, 0.00, 0.00, 26.60, -4.70},
-    {0.00, 0.00, 0.00, 27.00, -4.70},
-    {0.00, 0.00, 0.00, 27.40, -4.70},
-    {0.00, 0.00, 0.00, 27.80, -4.70},
-    {0.00, 0.00, 0.00, 28.20, -4.70},
-    {0.00, 0.00, 0.00, 28.60, -4.70},
-    {0.00, 0.00, 0.00, 29.00, -4.70},
-    {0.00, 0.00, 0.00, 29.40, -4.70},
-    {0.00, 0.00, 0.00, 29.80, -4.70},
-    {0.00, 0.00, 0.00, 30.20, -4.70},
-    {0.00, 0.00, 0.00, 30.60, -4.70},
-    {0.00, 0.00, 0.00, 31.00, -4.70},
-    {0.00, 0.00, 0.00, 31.40, -4.70},
-    {0.00, 0.00, 0.00, 31.80, -4.70},
-    {0.00, 0.00, 0.00, 32.20, -4.70},
-    {0.00, 0.00, 0.00, 32.60, -4.70},
-    {0.00, 0.00, 0.00, 33.00, -4.70},
-    {0.00, 0.00, 0.00, 33.40, -4.70},
-    {0.00, 0.00, 0.00, 33.80, -4.70},
-    {0.00, 0.00, 0.00, 34.20, -4.70},
-    {0.00, 0.00, 0.00, 34.60, -4.70},
-    {0.00, 0.00, 0.00, 35.00, -4.70},
-    {0.00, 0.00, 0.00, 35.40, -4.70},
-    {0.00, 0.00, 0.00, 35.80, -4.70},
-    {0.00, 0.00, 0.00, 36.20, -4.70},
-    {0.00, 0.00, 0.00, 36.60, -4.70},
-    {0.00, 0.00, 0.00, 37.00, -4.70},
-    {0.00, 0.00, 0.00, 37.40, -4.70},
-    {0.00, 0.00, 0.00, 37.80, -4.70},
-    {0.00, 0.00, 0.00, 38.20, -4.70},
-    {0.00, 0.00, 0.00, 38.60, -4.70},
-    {0.00, 0.00, 0.00, 39.00, -4.70},
-    {0.00, 0.00, 0.00, 39.40, -4.70},
-    {0.00, 0.00, 0.00, 39.80, -4.70},
-    {0.00, 0.00, 0.00, 40.20, -4.70},
-    {0.00, 0.00, 0.00, 40.60, -4.70},
-    {0.00, 0.00, 0.00, 41.00, -4.70},
-    {0.00, 0.00, 0.00, 41.40, -4.70},
-    {0.00, 0.00, 0.00, 41.80, -4.70},
-    {0.00, 0.00, 0.00, 42.20, -4.70},
-    {0.00, 0.00, 0.00, 42.60, -4.70},
-    {0.00, 0.00, 0.00, 43.00, -4.70},
-    {0.00, 0.00, 0.00, 43.40, -4.70},
-    {0.00, 0.00, 0.00, 43.80, -4.70},
-    {0.00, 0.00, 0.00, 44.20, -4.70},
-    {0.00, 0.00, 0.00, 44.60, -4.70},
-    {0.00, 0.00, 0.00, 45.00, -4.70},
-    {0.00, 0.00, 0.00, 45.40, -4.70},
-    {0.00, 0.00, 0.00, 45.80, -4.70},
-    {0.00, 0.00, 0.00, 46.20, -4.70},
-    {0.00, 0.00, 0.00, 46.60, -4.70},
-    {0.00, 0.00, 0.00, 47.00, -4.70},
-    {0.00, 0.00, 0.00, 47.40, -4.70},
-    {0.00, 0.00, 0.00, 47.80, -4.70},
-    {0.00, 0.00, 0.00, 48.20, -4.70},
-    {0.00, 0.00, 0.00, 48.60, -4.70},
-    {0.00, 0.00, 0.00, 49.00, -4.70},
-    {0.00, 0.00, 0.00, 49.40, -4.70},
-    {0.00, 0.00, 0.00, 49.80, -4.70},
-    {0.00, 0.00, 0.00, 50.20, -4.70},
-    {0.00, 0.00, 0.00, 50.60, -4.70},
-    {0.00, 0.00, 0.00, 51.00, -4.70},
-    {0.00, 0.00, 0.00, 51.40, -4.70},
-    {0.00, 0.00, 0.00, 51.80, -4.70},
-    {0.00, 0.00, 0.00, 52.20, -4.70},
-    {0.00, 0.00, 0.00, 52.60, -4.70},
-    {0.00, 0.00, 0.00, 53.00, -4.70},
-    {0.00, 0.00, 0.00, 53.40, -4.70},
-    {0.00, 0.00, 0.00, 53.80, -4.70},
-    {0.00, 0.00, 0.00, 54.20, -4.70},
-    {0.00, 0.00, 0.00, 54.60, -4.70},
-    {0.00, 0.00, 0.00, 55.00, -4.70},
-    {0.00, 0.00, 0.00, 55.40, -4.70},
-    {0.00, 0.00, 0.00, 55.80, -4.70},
-    {0.00, 0.00, 0.00, 56.20, -4.70},
-    {0.00, 0.00, 0.00, 56.60, -4.70},
-    {0.00, 0.00, 0.00, 57.00, -4.70},
-    {0.00, 0.00, 0.00, 57.40, -4.70},
-    {0.00, 0.00, 0.00, 57.80, -4.70},
-    {0.00, 0.00, 0.00, 58.20, -4.70},
-    {0.00, 0.00, 0.00, 58.60, -4.70},
-    {0.00, 0.00, 0.00, 59.00, -4.70},
-    {0.00, 0.00, 0.00, 59.40, -4.70},
-    {0.00, 0.00, 0.00, 59.80, -4.70},
-    {0.00, 0.00, 0.00, -59.80, -4.50},
-    {0.00, 0.00, 0.00, -59.40, -4.50},
-    {0.00, 0.00, 0.00, -59.00, -4.50},
-    {0.00, 0.00, 0.00, -58.60, -4.50},
-    {0.00, 0.00, 0.00, -58.20, -4.50},
-    {0.00, 0.00, 0.00, -57.80, -4.50},
-    {0.00, 0.00, 0.00, -57.40, -4.50},
-    {0.00, 0.00, 0.00, -57.00, -4.50},
-    {0.00, 0.00, 0.00, -56.60, -4.50},
-    {0.00, 0.00, 0.00, -56.20, -4.50},
-    {0.00, 0.00, 0.00, -55.80, -4.50},
-    {0.00, 0.00, 0.00, -55.40, -4.50},
-    {0.00, 0.00, 0.00, -55.00, -4.50},
-    {0.00, 0.00, 0.00, -54.60, -4.50},
-    {0.00, 0.00, 0.00, -54.20, -4.50},
-    {0.00, 0.00, 0.00, -53.80, -4.50},
-    {0.00, 0.00, 0.00, -53.40, -4.50},
-    {0.00, 0.00, 0.00, -53.00, -4.50},
-    {0.00, 0.00, 0.00, -52.60, -4.50},
-    {0.00, 0.00, 0.00, -52.20, -4.50},
-    {0.00, 0.00, 0.00, -51.80, -4.50},
-    {0.00, 0.00, 0.00, -51.40, -4.50},
-    {0.00, 0.00, 0.00, -51.00, -4.50},
-    {0.00, 0.00, 0.00, -50.60, -4.50},
-    {0.00, 0.00, 0.00, -50.20, -4.50},
-    {0.00, 0.00, 0.00, -49.80, -4.50},
-    {0.00, 0.00, 0.00, -49.40, -4.50},
-    {0.00, 0.00, 0.00, -49.00, -4.50},
-    {0.00, 0.00, 0.00, -48.60, -4.50},
-    {0.00, 0.00, 0.00, -48.20, -4.50},
-    {0.00, 0.00, 0.00, -47.80, -4.50},
-    {0.00, 0.00, 0.00, -47.40, -4.50},
-    {0.00, 0.00, 0.00, -47.00, -4.50},
-    {0.00, 0.00, 0.00, -46.60, -4.50},
-    {0.00, 0.00, 0.00, -46.20, -4.50},
-    {0.00, 0.00, 0.00, -45.80, -4.50},
-    {0.00, 0.00, 0.00, -45.40, -4.50},
-    {0.00, 0.00, 0.00, -45.00, -4.50},
-    {0.00, 0.00, 0.00, -44.60, -4.50},
-    {0.00, 0.00, 0.00, -44.20, -4.50},
-    {0.00, 0.00, 0.00, -43.80, -4.50},
-    {0.00, 0.00, 0.00, -43.40, -4.50},
-    {0.00, 0.00, 0.00, -43.00, -4.50},
-    {0.00, 0.00, 0.00, -42.60, -4.50},
-    {0.00, 0.00, 0.00, -42.20, -4.50},
-    {0.00, 0.00, 0.00, -41.80, -4.50},
-    {0.00, 0.00, 0.00, -41.40, -4.50},
-    {0.00, 0.00, 0.00, -41.00, -4.50},
-    {0.00, 0.00, 0.00, -40.60, -4.50},
-    {0.00, 0.00, 0.00, -40.20, -4.50},
-    {0.00, 0.00, 0.00, -39.80, -4.50},
-    {0.00, 0.00, 0.00, -39.40, -4.50},
-    {0.00, 0.00, 0.00, -39.00, -4.50},
-    {0.00, 0.00, 0.00, -38.60, -4.50},
-    {0.00, 0.00, 0.00, -38.20, -4.50},
-    {0.00, 0.00, 0.00, -37.80, -4.50},
-    {0.00, 0.00, 0.00, -37.40, -4.50},
-    {0.00, 0.00, 0.00, -37.00, -4.50},
-    {0.00, 0.00, 0.00, -36.60, -4.50},
-    {0.00, 0.00, 0.00, -36.20, -4.50},
-    {0.00, 0.00, 0.00, -35.80, -4.50},
-    {0.00, 0.00, 0.00, -35.40, -4.50},
-    {0.00, 0.00, 0.00, -35.00, -4.50},
-    {0.00, 0.00, 0.00, -34.60, -4.50},
-    {0.00, 0.00, 0.00, -34.20, -4.50},
-    {0.00, 0.00, 0.00, -33.80, -4.50},
-    {0.00, 0.00, 0.00, -33.40, -4.50},
-    {0.00, 0.00, 0.00, -33.00, -4.50},
-    {0.00, 0.00, 0.00, -32.60, -4.50},
-    {0.00, 0.00, 0.00, -32.20, -4.50},
-    {0.00, 0.00, 0.00, -31.80, -4.50},
-    {0.00, 0.00, 0.00, -31.40, -4.50},
-    {0.00, 0.00, 0.00, -31.00, -4.50},
-    {0.00, 0.00, 0.00, -30.60, -4.50},
-    {0.00, 0.00, 0.00, -30.20, -4.50},
-    {0.00, 0.00, 0.00, -29.80, -4.50},
-    {0.00, 0.00, 0.00, -29.40, -4.50},
-    {0.00, 0.00, 0.00, -29.00, -4.50},
-    {0.00, 0.00, 0.00, -28.60, -4.50},
-    {0.00, 0.00, 0.00, -28.20, -4.50},
-    {0.00, 0.00, 0.00, -27.80, -4.50},
-    {0.00, 0.00, 0.00, -27.40, -4.50},
-    {0.00, 0.00, 0.00, -27.00, -4.50},
-    {0.00, 0.00, 0.00, -26.60, -4.50},
-    {0.00, 0.00, 0.00, -26.20, -4.50},
-    {0.00, 0.00, 0.00, -25.80, -4.50},
-    {0.00, 0.00, 0.00, -25.40, -4.50},
-    {0.00, 0.00, 0.00, -25.00, -4.50},
-    {0.00, 0.00, 0.00, -24.60, -4.50},
-    {0.00, 0.00, 0.00, -24.20, -4.50},
-    {0.00, 0.00, 0.00, -23.80, -4.50},
-    {0.00, 0.00, 0.00, -23.40, -4.50},
-    {0.00, 0.00, 0.00, -23.00, -4.50},
-    {0.00, 0.00, 0.00, -22.60, -4.50},
-    {0.00, 0.00, 0.00, -22.20, -4.50},
-    {0.00, 0.00, 0.00, -21.80, -4.50},
-    {0.00, 0.00, 0.00, -21.40, -4.50},
-    {0.00, 0.00, 0.00, -21.00, -4.50},
-    {0.00, 0.00, 0.00, -20.60, -4.50},
-    {0.00, 0.00, 0.00, -20.20, -4.50},
-    {0.00, 0.00, 0.00, -19.80, -4.50},
-    {0.00, 0.00, 0.00, -19.40, -4.50},
-    {0.00, 0.00, 0.00, -19.00, -4.50},
-    {0.00, 0.00, 0.00, -18.60, -4.50},
-    {0.00, 0.00, 0.00, -18.20, -4.50},
-    {0.00, 0.00, 0.00, -17.80, -4.50},
-    {0.00, 0.00, 0.00, -17.40, -4.50},
-    {0.00, 0.00, 0.00, -17.00, -4.50},
-    {0.00, 0.00, 0.00, -16.60, -4.50},
-    {0.00, 0.00, 0.00, -16.20, -4.50},
-    {0.00, 0.00, 0.00, -15.80, -4.50},
-    {0.00, 0.00, 0.00, -15.40, -4.50},
-    {0.00, 0.00, 0.00, -15.00, -4.50},
-    {0.00, 0.00, 0.00, -14.60, -4.50},
-    {0.00, 0.00, 0.00, -14.20, -4.50},
-    {0.00, 0.00, 0.00, -13.80, -4.50},
-    {0.00, 0.00, 0.00, -13.40, -4.50},
-    {0.00, 0.00, 0.00, -13.00, -4.50},
-    {0.00, 0.00, 0.00, -12.60, -4.50},
-    {0.00, 0.00, 0.00, -12.20, -4.50},
-    {0.00, 0.00, 0.00, -11.80, -4.50},
-    {0.00, 0.00, 0.00, -11.40, -4.50},
-    {0.00, 0.00, 0.00, -11.00, -4.50},
-    {0.00, 0.00, 0.00, -10.60, -4.50},
-    {0.00, 0.00, 0.00, -10.20, -4.50},
-    {0.00, 0.00, 0.00, -9.80, -4.50},
-    {0.00, 0.00, 0.00, -9.40, -4.50},
-    {0.00, 0.00, 0.00, -9.00, -4.50},
-    {0.00, 0.00, 0.00, -8.60, -4.50},
-    {0.00, 0.00, 0.00, -8.20, -4.50},
-    {0.00, 0.00, 0.00, -7.80, -4.50},
-    {0.00, 0.00, 0.00, -7.40, -4.50},
-    {0.00, 0.00, 0.00, -7.00, -4.50},
-    {0.00, 0.00, 0.00, -6.60, -4.50},
-    {0.00, 0.00, 0.00, -6.20, -4.50},
-    {0.00, 0.00, 0.00, -5.80, -4.50},
-    {0.00, 0.00, 0.00, -5.40, -4.50},
-    {0.00, 0.00, 0.00, -5.00, -4.50},
-    {0.00, 0.00, 0.00, -4.60, -4.50},
-    {0.00, 0.00, 0.00, -4.20, -4.50},
-    {0.00, 0.00, 0.00, -3.80, -4.50},
-    {0.00, 0.00, 0.00, -3.40, -4.50},
-    {0.00, 0.00, 0.00, -3.00, -4.50},
-    {0.00, 0.00, 0.00, -2.60, -4.50},
-    {0.00, 0.00, 0.00, -2.20, -4.50},
-    {0.00, 0.00, 0.00, -1.80, -4.50},
-    {0.00, 0.00, 0.00, -1.40, -4.50},
-    {0.00, 0.00, 0.00, -1.00, -4.50},
-    {0.00, 0.00, 0.00, -0.60, -4.50},
-    {0.00, 0.00, 0.00, -0.20, -4.50},
-    {0.00, 0.00, 0.00, 0.20, -4.50},
-    {0.00, 0.00, 0.00, 0.60, -4.50},
-    {0.00, 0.00, 0.00, 1.00, -4.50},
-    {0.00, 0.00, 0.00, 1.40, -4.50},
-    {0.00, 0.00, 0.00, 1.80, -4.50},
-    {0.00, 0.00, 0.00, 2.20, -4.50},
-    {0.00, 0.00, 0.00, 2.60, -4.50},
-    {0.00, 0.00, 0.00, 3.00, -4.50},
-    {0.00, 0.00, 0.00, 3.40, -4.50},
-    {0.00, 0.00, 0.00, 3.80, -4.50},
-    {0.00, 0.00, 0.00, 4.20, -4.50},
-    {0.00, 0.00, 0.00, 4.60, -4.50},
-    {0.00, 0.00, 0.00, 5.00, -4.50},
-    {0.00, 0.00, 0.00, 5.40, -4.50},
-    {0.00, 0.00, 0.00, 5.80, -4.50},
-    {0.00, 0.00, 0.00, 6.20, -4.50},
-    {0.00, 0.00, 0.00, 6.60, -4.50},
-    {0.00, 0.00, 0.00, 7.00, -4.50},
-    {0.00, 0.00, 0.00, 7.40, -4.50},
-    {0.00, 0.00, 0.00, 7.80, -4.50},
-    {0.00, 0.00, 0.00, 8.20, -4.50},
-    {0.00, 0.00, 0.00, 8.60, -4.50},
-    {0.00, 0.00, 0.00, 9.00, -4.50},
-    {0.00, 0.00, 0.00, 9.40, -4.50},
-    {0.00, 0.00, 0.00, 9.80, -4.50},
-    {0.00, 0.00, 0.00, 10.20, -4.50},
-    {0.00, 0.00, 0.00, 10.60, -4.50},
-    {0.00, 0.00, 0.00, 11.00, -4.50},
-    {0.00, 0.00, 0.00, 11.40, -4.50},
-    {0.00, 0.00, 0.00, 11.80, -4.50},
-    {0.00, 0.00, 0.00, 12.20, -4.50},
-    {0.00, 0.00, 0.00, 12.60, -4.50},
-    {0.00, 0.00, 0.00, 13.00, -4.50},
-    {0.00, 0.00, 0.00, 13.40, -4.50},
-    {0.00, 0.00, 0.00, 13.80, -4.50},
-    {0.00, 0.00, 0.00, 14.20, -4.50},
-    {0.00, 0.00, 0.00, 14.60, -4.50},
-    {0.00, 0.00, 0.00, 15.00, -4.50},
-    {0.00, 0.00, 0.00, 15.40, -4.50},
-    {0.00, 0.00, 0.00, 15.80, -4.50},
-    {0.00, 0.00, 0.00, 16.20, -4.50},
-    {0.00, 0.00, 0.00, 16.60, -4.50},
-    {0.00, 0.00, 0.00, 17.00, -4.50},
-    {0.00, 0.00, 0.00, 17.40, -4.50},
-    {0.00, 0.00, 0.00, 17.80, -4.50},
-    {0.00, 0.00, 0.00, 18.20, -4.50},
-    {0.00, 0.00, 0.00, 18.60, -4.50},
-    {0.00, 0.00, 0.00, 19.00, -4.50},
-    {0.00, 0.00, 0.00, 19.40, -4.50},
-    {0.00, 0.00, 0.00, 19.80, -4.50},
-    {0.00, 0.00, 0.00, 20.20, -4.50},
-    {0.00, 0.00, 0.00, 20.60, -4.50},
-    {0.00, 0.00, 0.00, 21.00, -4.50},
-    {0.00, 0.00, 0.00, 21.40, -4.50},
-    {0.00, 0.00, 0.00, 21.80, -4.50},
-    {0.00, 0.00, 0.00, 22.20, -4.50},
-    {0.00, 0.00, 0.00, 22.60, -4.50},
-    {0.00, 0.00, 0.00, 23.00, -4.50},
-    {0.00, 0.00, 0.00, 23.40, -4.50},
-    {0.00, 0.00, 0.00, 23.80, -4.50},
-    {0.00, 0.00, 0.00, 24.20, -4.50},
-    {0.00, 0.00, 0.00, 24.60, -4.50},
-    {0.00, 0.00, 0.00, 25.00, -4.50},
-    {0.00, 0.00, 0.00, 25.40, -4.50},
-    {0.00, 0.00, 0.00, 25.80, -4.50},
-    {0.00, 0.00, 0.00, 26.20, -4.50},
-    {0.00, 0.00, 0.00, 26.60, -4.50},
-    {0.00, 0.00, 0.00, 27.00, -4.50},
-    {0.00, 0.00, 0.00, 27.40, -4.50},
-    {0.00, 0.00, 0.00, 27.80, -4.50},
-    {0.00, 0.00, 0.00, 28.20, -4.50},
-    {0.00, 0.00, 0.00, 28.60, -4.50},
-    {0.00, 0.00, 0.00, 29.00, -4.50},
-    {0.00, 0.00, 0.00, 29.40, -4.50},
-    {0.00, 0.00, 0.00, 29.80, -4.50},
-    {0.00, 0.00, 0.00, 30.20, -4.50},
-    {0.00, 0.00, 0.00, 30.60, -4.50},
-    {0.00, 0.00, 0.00, 31.00, -4.50},
-    {0.00, 0.00, 0.00, 31.40, -4.50},
-    {0.00, 0.00, 0.00, 31.80, -4.50},
-    {0.00, 0.00, 0.00, 32.20, -4.50},
-    {0.00, 0.00, 0.00, 32.60, -4.50},
-    {0.00, 0.00, 0.00, 33.00, -4.50},
-    {0.00, 0.00, 0.00, 33.40, -4.50},
-    {0.00, 0.00, 0.00, 33.80, -4.50},
-    {0.00, 0.00, 0.00, 34.20, -4.50},
-    {0.00, 0.00, 0.00, 34.60, -4.50},
-    {0.00, 0.00, 0.00, 35.00, -4.50},
-    {0.00, 0.00, 0.00, 35.40, -4.50},
-    {0.00, 0.00, 0.00, 35.80, -4.50},
-    {0.00, 0.00, 0.00, 36.20, -4.50},
-    {0.00, 0.00, 0.00, 36.60, -4.50},
-    {0.00, 0.00, 0.00, 37.00, -4.50},
-    {0.00, 0.00, 0.00, 37.40, -4.50},
-    {0.00, 0.00, 0.00, 37.80, -4.50},
-    {0.00, 0.00, 0.00, 38.20, -4.50},
-    {0.00, 0.00, 0.00, 38.60, -4.50},
-    {0.00, 0.00, 0.00, 39.00, -4.50},
-    {0.00, 0.00, 0.00, 39.40, -4.50},
-    {0.00, 0.00, 0.00, 39.80, -4.50},
-    {0.00, 0.00, 0.00, 40.20, -4.50},
-    {0.00, 0.00, 0.00, 40.60, -4.50},
-    {0.00, 0.00, 0.00, 41.00, -4.50},
-    {0.00, 0.00, 0.00, 41.40, -4.50},
-    {0.00, 0.00, 0.00, 41.80, -4.50},
-    {0.00, 0.00, 0.00, 42.20, -4.50},
-    {0.00, 0.00, 0.00, 42.60, -4.50},
-    {0.00, 0.00, 0.00, 43.00, -4.50},
-    {0.00, 0.00, 0.00, 43.40, -4.50},
-    {0.00, 0.00, 0.00, 43.80, -4.50},
-    {0.00, 0.00, 0.00, 44.20, -4.50},
-    {0.00, 0.00, 0.00, 44.60, -4.50},
-    {0.00, 0.00, 0.00, 45.00, -4.50},
-    {0.00, 0.00, 0.00, 45.40, -4.50},
-    {0.00, 0.00, 0.00, 45.80, -4.50},
-    {0.00, 0.00, 0.00, 46.20, -4.50},
-    {0.00, 0.00, 0.00, 46.60, -4.50},
-    {0.00, 0.00, 0.00, 47.00, -4.50},
-    {0.00, 0.00, 0.00, 47.40, -4.50},
-    {0.00, 0.00, 0.00, 47.80, -4.50},
-    {0.00, 0.00, 0.00, 48.20, -4.50},
-    {0.00, 0.00, 0.00, 48.60, -4.50},
-    {0.00, 0.00, 0.00, 49.00, -4.50},
-    {0.00, 0.00, 0.00, 49.40, -4.50},
-    {0.00, 0.00, 0.00, 49.80, -4.50},
-    {0.00, 0.00, 0.00, 50.20, -4.50},
-    {0.00, 0.00, 0.00, 50.60, -4.50},
-    {0.00, 0.00, 0.00, 51.00, -4.50},
-    {0.00, 0.00, 0.00, 51.40, -4.50},
-    {0.00, 0.00, 0.00, 51.80, -4.50},
-    {0.00, 0.00, 0.00, 52.20, -4.50},
-    {0.00, 0.00, 0.00, 52.60, -4.50},
-    {0.00, 0.00, 0.00, 53.00, -4.50},
-    {0.00, 0.00, 0.00, 53.40, -4.50},
-    {0.00, 0.00, 0.00, 53.80, -4.50},
-    {0.00, 0.00, 0.00, 54.20, -4.50},
-    {0.00, 0.00, 0.00, 54.60, -4.50},
-    {0.00, 0.00, 0.00, 55.00, -4.50},
-    {0.00, 0.00, 0.00, 55.40, -4.50},
-    {0.00, 0.00, 0.00, 55.80, -4.50},
-    {0.00, 0.00, 0.00, 56.20, -4.50},
-    {0.00, 0.00, 0.00, 56.60, -4.50},
-    {0.00, 0.00, 0.00, 57.00, -4.50},
-    {0.00, 0.00, 0.00, 57.40, -4.50},
-    {0.00, 0.00, 0.00, 57.80, -4.50},
-    {0.00, 0.00, 0.00, 58.20, -4.50},
-    {0.00, 0.00, 0.00, 58.60, -4.50},
-    {0.00, 0.00, 0.00, 59.00, -4.50},
-    {0.00, 0.00, 0.00, 59.40, -4.50},
-    {0.00, 0.00, 0.00, 59.80, -4.50},
-    {0.00, 0.00, 0.00, -59.80, -4.30},
-    {0.00, 0.00, 0.00, -59.40, -4.30},
-    {0.00, 0.00, 0.00, -59.00, -4.30},
-    {0.00, 0.00, 0.00, -58.60, -4.30},
-    {0.00, 0.00, 0.00, -58.20, -4.30},
-    {0.00, 0.00, 0.00, -57.80, -4.30},
-    {0.00, 0.00, 0.00, -57.40, -4.30},
-    {0.00, 0.00, 0.00, -57.00, -4.30},
-    {0.00, 0.00, 0.00, -56.60, -4.30},
-    {0.00, 0.00, 0.00, -56.20, -4.30},
-    {0.00, 0.00, 0.00, -55.80, -4.30},
-    {0.00, 0.00, 0.00, -55.40, -4.30},
-    {0.00, 0.00, 0.00, -55.00, -4.30},
-    {0.00, 0.00, 0.00, -54.60, -4.30},
-    {0.00, 0.00, 0.00, -54.20, -4.30},
-    {0.00, 0.00, 0.00, -53.80, -4.30},
-    {0.00, 0.00, 0.00, -53.40, -4.30},
-    {0.00, 0.00, 0.00, -53.00, -4.30},
-    {0.00, 0.00, 0.00, -52.60, -4.30},
-    {0.00, 0.00, 0.00, -52.20, -4.30},
-    {0.00, 0.00, 0.00, -51.80, -4.30},
-    {0.00, 0.00, 0.00, -51.40, -4.30},
-    {0.00, 0.00, 0.00, -51.00, -4.30},
-    {0.00, 0.00, 0.00, -50.60, -4.30},
-    {0.00, 0.00, 0.00, -50.20, -4.30},
-    {0.00, 0.00, 0.00, -49.80, -4.30},
-    {0.00, 0.00, 0.00, -49.40, -4.30},
-    {0.00, 0.00, 0.00, -49.00, -4.30},
-    {0.00, 0.00, 0.00, -48.60, -4.30},
-    {0.00, 0.00, 0.00, -48.20, -4.30},
-    {0.00, 0.00, 0.00, -47.80, -4.30},
-    {0.00, 0.00, 0.00, -47.40, -4.30},
-    {0.00, 0.00, 0.00, -47.00, -4.30},
-    {0.00, 0.00, 0.00, -46.60, -4.30},
-    {0.00, 0.00, 0.00, -46.20, -4.30},
-    {0.00, 0.00, 0.00, -45.80, -4.30},
-    {0.00, 0.00, 0.00, -45.40, -4.30},
-    {0.00, 0.00, 0.00, -45.00, -4.30},
-    {0.00, 0.00, 0.00, -44.60, -4.30},
-    {0.00, 0.00, 0.00, -44.20, -4.30},
-    {0.00, 0.00, 0.00, -43.80, -4.30},
-    {0.00, 0.00, 0.00, -43.40, -4.30},
-    {0.00, 0.00, 0.00, -43.00, -4.30},
-    {0.00, 0.00, 0.00, -42.60, -4.30},
-    {0.00, 0.00, 0.00, -42.20, -4.30},
-    {0.00, 0.00, 0.00, -41.80, -4.30},
-    {0.00, 0.00, 0.00, -41.40, -4.30},
-    {0.00, 0.00, 0.00, -41.00, -4.30},
-    {0.00, 0.00, 0.00, -40.60, -4.30},
-    {0.00, 0.00, 0.00, -40.20, -4.30},
-    {0.00, 0.00, 0.00, -39.80, -4.30},
-    {0.00, 0.00, 0.00, -39.40, -4.30},
-    {0.00, 0.00, 0.00, -39.00, -4.30},
-    {0.00, 0.00, 0.00, -38.60, -4.30},
-    {0.00, 0.00, 0.00, -38.20, -4.30},
-    {0.00, 0.00, 0.00, -37.80, -4.30},
-    {0.00, 0.00, 0.00, -37.40, -4.30},
-    {0.00, 0.00, 0.00, -37.00, -4.30},
-    {0.00, 0.00, 0.00, -36.60, -4.30},
-    {0.00, 0.00, 0.00, -36.20, -4.30},
-    {0.00, 0.00, 0.00, -35.80, -4.30},
-    {0.00, 0.00, 0.00, -35.40, -4.30},
-    {0.00, 0.00, 0.00, -35.00, -4.30},
-    {0.00, 0.00, 0.00, -34.60, -4.30},
-    {0.00, 0.00, 0.00, -34.20, -4.30},
-    {0.00, 0.00, 0.00, -33.80, -4.30},
-    {0.00, 0.00, 0.00, -33.40, -4.30},
-    {0.00, 0.00, 0.00, -33.00, -4.30},
-    {0.00, 0.00, 0.00, -32.60, -4.30},
-    {0.00, 0.00, 0.00, -32.20, -4.30},
-    {0.00, 0.00, 0.00, -31.80, -4.30},
-    {0.00, 0.00, 0.00, -31.40, -4.30},
-    {0.00, 0.00, 0.00, -31.00, -4.30},
-    {0.00, 0.00, 0.00, -30.60, -4.30},
-    {0.00, 0.00, 0.00, -30.20, -4.30},
-    {0.00, 0.00, 0.00, -29.80, -4.30},
-    {0.00, 0.00, 0.00, -29.40, -4.30},
-    {0.00, 0.00, 0.00, -29.00, -4.30},
-    {0.00, 0.00, 0.00, -28.60, -4.30},
-    {0.00, 0.00, 0.00, -28.20, -4.30},
-    {0.00, 0.00, 0.00, -27.80, -4.30},
-    {0.00, 0.00, 0.00, -27.40, -4.30},
-    {0.00, 0.00, 0.00, -27.00, -4.30},
-    {0.00, 0.00, 0.00, -26.60, -4.30},
-    {0.00, 0.00, 0.00, -26.20, -4.30},
-    {0.00, 0.00, 0.00, -25.80, -4.30},
-    {0.00, 0.00, 0.00, -25.40, -4.30},
-    {0.00, 0.00, 0.00, -25.00, -4.30},
-    {0.00, 0.00, 0.00, -24.60, -4.30},
-    {0.00, 0.00, 0.00, -24.20, -4.30},
-    {0.00, 0.00, 0.00, -23.80, -4.30},
-    {0.00, 0.00, 0.00, -23.40, -4.30},
-    {0.00, 0.00, 0.00, -23.00, -4.30},
-    {0.00, 0.00, 0.00, -22.60, -4.30},
-    {0.00, 0.00, 0.00, -22.20, -4.30},
-    {0.00, 0.00, 0.00, -21.80, -4.30},
-    {0.00, 0.00, 0.00, -21.40, -4.30},
-    {0.00, 0.00, 0.00, -21.00, -4.30},
-    {0.00, 0.00, 0.00, -20.60, -4.30},
-    {0.00, 0.00, 0.00, -20.20, -4.30},
-    {0.00, 0.00, 0.00, -19.80, -4.30},
-    {0.00, 0.00, 0.00, -19.40, -4.30},
-    {0.00, 0.00, 0.00, -19.00, -4.30},
-    {0.00, 0.00, 0.00, -18.60, -4.30},
-    {0.00, 0.00, 0.00, -18.20, -4.30},
-    {0.00, 0.00, 0.00, -17.80, -4.30},
-    {0.00, 0.00, 0.00, -17.40, -4.30},
-    {0.00, 0.00, 0.00, -17.00, -4.30},
-    {0.00, 0.00, 0.00, -16.60, -4.30},
-    {0.00, 0.00, 0.00, -16.20, -4.30},
-    {0.00, 0.00, 0.00, -15.80, -4.30},
-    {0.00, 0.00, 0.00, -15.40, -4.30},
-    {0.00, 0.00, 0.00, -15.00, -4.30},
-    {0.00, 0.00, 0.00, -14.60, -4.30},
-    {0.00, 0.00, 0.00, -14.20, -4.30},
-    {0.00, 0.00, 0.00, -13.80, -4.30},
-    {0.00, 0.00, 0.00, -13.40, -4.30},
-    {0.00, 0.00, 0.00, -13.00, -4.30},
-    {0.00, 0.00, 0.00, -12.60, -4.30},
-    {0.00, 0.00, 0.00, -12.20, -4.30},
-    {0.00, 0.00, 0.00, -11.80, -4.30},
-    {0.00, 0.00, 0.00, -11.40, -4.30},
-    {0.00, 0.00, 0.00, -11.00, -4.30},
-    {0.00, 0.00, 0.00, -10.60, -4.30},
-    {0.00, 0.00, 0.00, -10.20, -4.30},
-    {0.00, 0.00, 0.00, -9.80, -4.30},
-    {0.00, 0.00, 0.00, -9.40, -4.30},
-    {0.00, 0.00, 0.00, -9.00, -4.30},
-    {0.00, 0.00, 0.00, -8.60, -4.30},
-    {0.00, 0.00, 0.00, -8.20, -4.30},
-    {0.00, 0.00, 0.00, -7.80, -4.30},
-    {0.00, 0.00, 0.00, -7.40, -4.30},
-    {0.00, 0.00, 0.00, -7.00, -4.30},
-    {0.00, 0.00, 0.00, -6.60, -4.30},
-    {0.00, 0.00, 0.00, -6.20, -4.30},
-    {0.00, 0.00, 0.00, -5.80, -4.30},
-    {0.00, 0.00, 0.00, -5.40, -4.30},
-    {0.00, 0.00, 0.00, -5.00, -4.30},
-    {0.00, 0.00, 0.00, -4.60, -4.30},
-    {0.00, 0.00, 0.00, -4.20, -4.30},
-    {0.00, 0.00, 0.00, -3.80, -4.30},
-    {0.00, 0.00, 0.00, -3.40, -4.30},
-    {0.00, 0.00, 0.00, -3.00, -4.30},
-    {0.00, 0.00, 0.00, -2.60, -4.30},
-    {0.00, 0.00, 0.00, -2.20, -4.30},
-    {0.00, 0.00, 0.00, -1.80, -4.30},
-    {0.00, 0.00, 0.00, -1.40, -4.30},
-    {0.00, 0.00, 0.00, -1.00, -4.30},
-    {0.00, 0.00, 0.00, -0.60, -4.30},
-    {0.00, 0.00, 0.00, -0.20, -4.30},
-    {0.00, 0.00, 0.00, 0.20, -4.30},
-    {0.00, 0.00, 0.00, 0.60, -4.30},
-    {0.00, 0.00, 0.00, 1.00, -4.30},
-    {0.00, 0.00, 0.00, 1.40, -4.30},
-    {0.00, 0.00, 0.00, 1.80, -4.30},
-    {0.00, 0.00, 0.00, 2.20, -4.30},
-    {0.00, 0.00, 0.00, 2.60, -4.30},
-    {0.00, 0.00, 0.00, 3.00, -4.30},
-    {0.00, 0.00, 0.00, 3.40, -4.30},
-    {0.00, 0.00, 0.00, 3.80, -4.30},
-    {0.00, 0.00, 0.00, 4.20, -4.30},
-    {0.00, 0.00, 0.00, 4.60, -4.30},
-    {0.00, 0.00, 0.00, 5.00, -4.30},
-    {0.00, 0.00, 0.00, 5.40, -4.30},
-    {0.00, 0.00, 0.00, 5.80, -4.30},
-    {0.00, 0.00, 0.00, 6.20, -4.30},
-    {0.00, 0.00, 0.00, 6.60, -4.30},
-    {0.00, 0.00, 0.00, 7.00, -4.30},
-    {0.00, 0.00, 0.00, 7.40, -4.30},
-    {0.00, 0.00, 0.00, 7.80, -4.30},
-    {0.00, 0.00, 0.00, 8.20, -4.30},
-    {0.00, 0.00, 0.00, 8.60, -4.30},
-    {0.00, 0.00, 0.00, 9.00, -4.30},
-    {0.00, 0.00, 0.00, 9.40, -4.30},
-    {0.00, 0.00, 0.00, 9.80, -4.30},
-    {0.00, 0.00, 0.00, 10.20, -4.30},
-    {0.00, 0.00, 0.00, 10.60, -4.30},
-    {0.00, 0.00, 0.00, 11.00, -4.30},
-    {0.00, 0.00, 0.00, 11.40, -4.30},
-    {0.00, 0.00, 0.00, 11.80, -4.30},
-    {0.00, 0.00, 0.00, 12.20, -4.30},
-    {0.00, 0.00, 0.00, 12.60, -4.30},
-    {0.00, 0.00, 0.00, 13.00, -4.30},
-    {0.00, 0.00, 0.00, 13.40, -4.30},
-    {0.00, 0.00, 0.00, 13.80, -4.30},
-    {0.00, 0.00, 0.00, 14.20, -4.30},
-    {0.00, 0.00, 0.00, 14.60, -4.30},
-    {0.00, 0.00, 0.00, 15.00, -4.30},
-    {0.00, 0.00, 0.00, 15.40, -4.30},
-    {0.00, 0.00, 0.00, 15.80, -4.30},
-    {0.00, 0.00, 0.00, 16.20, -4.30},
-    {0.00, 0.00, 0.00, 16.60, -4.30},
-    {0.00, 0.00, 0.00, 17.00, -4.30},
-    {0.00, 0.00, 0.00, 17.40, -4.30},
-    {0.00, 0.00, 0.00, 17.80, -4.30},
-    {0.00, 0.00, 0.00, 18.20, -4.30},
-    {0.00, 0.00, 0.00, 18.60, -4.30},
-    {0.00, 0.00, 0.00, 19.00, -4.30},
-    {0.00, 0.00, 0.00, 19.40, -4.30},
-    {0.00, 0.00, 0.00, 19.80, -4.30},
-    {0.00, 0.00, 0.00, 20.20, -4.30},
-    {0.00, 0.00, 0.00, 20.60, -4.30},
-    {0.00, 0.00, 0.00, 21.00, -4.30},
-    {0.00, 0.00, 0.00, 21.40, -4.30},
-    {0.00, 0.00, 0.00, 21.80, -4.30},
-    {0.00, 0.00, 0.00, 22.20, -4.30},
-    {0.00, 0.00, 0.00, 22.60, -4.30},
-    {0.00, 0.00, 0.00, 23.00, -4.30},
-    {0.00, 0.00, 0.00, 23.40, -4.30},
-    {0.00, 0.00, 0.00, 23.80, -4.30},
-    {0.00, 0.00, 0.00, 24.20, -4.30},
-    {0.00, 0.00, 0.00, 24.60, -4.30},
-    {0.00, 0.00, 0.00, 25.00, -4.30},
-    {0.00, 0.00, 0.00, 25.40, -4.30},
-    {0.00, 0.00, 0.00, 25.80, -4.30},
-    {0.00, 0.00, 0.00, 26.20, -4.30},
-    {0.00, 0.00, 0.00, 26.60, -4.30},
-    {0.00, 0.00, 0.00, 27.00, -4.30},
-    {0.00, 0.00, 0.00, 27.40, -4.30},
-    {0.00, 0.00, 0.00, 27.80, -4.30},
-    {0.00, 0.00, 0.00, 28.20, -4.30},
-    {0.00, 0.00, 0.00, 28.60, -4.30},
-    {0.00, 0.00, 0.00, 29.00, -4.30},
-    {0.00, 0.00, 0.00, 29.40, -4.30},
-    {0.00, 0.00, 0.00, 29.80, -4.30},
-    {0.00, 0.00, 0.00, 30.20, -4.30},
-    {0.00, 0.00, 0.00, 30.60, -4.30},
-    {0.00, 0.00, 0.00, 31.00, -4.30},
-    {0.00, 0.00, 0.00, 31.40, -4.30},
-    {0.00, 0.00, 0.00, 31.80, -4.30},
-    {0.00, 0.00, 0.00, 32.20, -4.30},
-    {0.00, 0.00, 0.00, 32.60, -4.30},
-    {0.00, 0.00, 0.00, 33.00, -4.30},
-    {0.00, 0.00, 0.00, 33.40, -4.30},
-    {0.00, 0.00, 0.00, 33.80, -4.30},
-    {0.00, 0.00, 0.00, 34.20, -4.30},
-    {0.00, 0.00, 0.00, 34.60, -4.30},
-    {0.00, 0.00, 0.00, 35.00, -4.30},
-    {0.00, 0.00, 0.00, 35.40, -4.30},
-    {0.00, 0.00, 0.00, 35.80, -4.30},
-    {0.00, 0.00, 0.00, 36.20, -4.30},
-    {0.00, 0.00, 0.00, 36.60, -4.30},
-    {0.00, 0.00, 0.00, 37.00, -4.30},
-    {0.00, 0.00, 0.00, 37.40, -4.30},
-    {0.00, 0.00, 0.00, 37.80, -4.30},
-    {0.00, 0.00, 0.00, 38.20, -4.30},
-    {0.00, 0.00, 0.00, 38.60, -4.30},
-    {0.00, 0.00, 0.00, 39.00, -4.30},
-    {0.00, 0.00, 0.00, 39.40, -4.30},
-    {0.00, 0.00, 0.00, 39.80, -4.30},
-    {0.00, 0.00, 0.00, 40.20, -4.30},
-    {0.00, 0.00, 0.00, 40.60, -4.30},
-    {0.00, 0.00, 0.00, 41.00, -4.30},
-    {0.00, 0.00, 0.00, 41.40, -4.30},
-    {0.00, 0.00, 0.00, 41.80, -4.30},
-    {0.00, 0.00, 0.00, 42.20, -4.30},
-    {0.00, 0.00, 0.00, 42.60, -4.30},
-    {0.00, 0.00, 0.00, 43.00, -4.30},
-    {0.00, 0.00, 0.00, 43.40, -4.30},
-    {0.00, 0.00, 0.00, 43.80, -4.30},
-    {0.00, 0.00, 0.00, 44.20, -4.30},
-    {0.00, 0.00, 0.00, 44.60, -4.30},
-    {0.00, 0.00, 0.00, 45.00, -4.30},
-    {0.00, 0.00, 0.00, 45.40, -4.30},
-    {0.00, 0.00, 0.00, 45.80, -4.30},
-    {0.00, 0.00, 0.00, 46.20, -4.30},
-    {0.00, 0.00, 0.00, 46.60, -4.30},
-    {0.00, 0.00, 0.00, 47.00, -4.30},
-    {0.00, 0.00, 0.00, 47.40, -4.30},
-    {0.00, 0.00, 0.00, 47.80, -4.30},
-    {0.00, 0.00, 0.00, 48.20, -4.30},
-    {0.00, 0.00, 0.00, 48.60, -4.30},
-    {0.00, 0.00, 0.00, 49.00, -4.30},
-    {0.00, 0.00, 0.00, 49.40, -4.30},
-    {0.00, 0.00, 0.00, 49.80, -4.30},
-    {0.00, 0.00, 0.00, 50.20, -4.30},
-    {0.00, 0.00, 0.00, 50.60, -4.30},
-    {0.00, 0.00, 0.00, 51.00, -4.30},
-    {0.00, 0.00, 0.00, 51.40, -4.30},
-    {0.00, 0.00, 0.00, 51.80, -4.30},
-    {0.00, 0.00, 0.00, 52.20, -4.30},
-    {0.00, 0.00, 0.00, 52.60, -4.30},
-    {0.00, 0.00, 0.00, 53.00, -4.30},
-    {0.00, 0.00, 0.00, 53.40, -4.30},
-    {0.00, 0.00, 0.00, 53.80, -4.30},
-    {0.00, 0.00, 0.00, 54.20, -4.30},
-    {0.00, 0.00, 0.00, 54.60, -4.30},
-    {0.00, 0.00, 0.00, 55.00, -4.30},
-    {0.00, 0.00, 0.00, 55.40, -4.30},
-    {0.00, 0.00, 0.00, 55.80, -4.30},
-    {0.00, 0.00, 0.00, 56.20, -4.30},
-    {0.00, 0.00, 0.00, 56.60, -4.30},
-    {0.00, 0.00, 0.00, 57.00, -4.30},
-    {0.00, 0.00, 0.00, 57.40, -4.30},
-    {0.00, 0.00, 0.00, 57.80, -4.30},
-    {0.00, 0.00, 0.00, 58.20, -4.30},
-    {0.00, 0.00, 0.00, 58.60, -4.30},
-    {0.00, 0.00, 0.00, 59.00, -4.30},
-    {0.00, 0.00, 0.00, 59.40, -4.30},
-    {0.00, 0.00, 0.00, 59.80, -4.30},
-    {0.00, 0.00, 0.00, -59.80, -4.10},
-    {0.00, 0.00, 0.00, -59.40, -4.10},
-    {0.00, 0.00, 0.00, -59.00, -4.10},
-    {0.00, 0.00, 0.00, -58.60, -4.10},
-    {0.00, 0.00, 0.00, -58.20, -4.10},
-    {0.00, 0.00, 0.00, -57.80, -4.10},
-    {0.00, 0.00, 0.00, -57.40, -4.10},
-    {0.00, 0.00, 0.00, -57.00, -4.10},
-    {0.00, 0.00, 0.00, -56.60, -4.10},
-    {0.00, 0.00, 0.00, -56.20, -4.10},
-    {0.00, 0.00, 0.00, -55.80, -4.10},
-    {0.00, 0.00, 0.00, -55.40, -4.10},
-    {0.00, 0.00, 0.00, -55.00, -4.10},
-    {0.00, 0.00, 0.00, -54.60, -4.10},
-    {0.00, 0.00, 0.00, -54.20, -4.10},
-    {0.00, 0.00, 0.00, -53.80, -4.10},
-    {0.00, 0.00, 0.00, -53.40, -4.10},
-    {0.00, 0.00, 0.00, -53.00, -4.10},
-    {0.00, 0.00, 0.00, -52.60, -4.10},
-    {0.00, 0.00, 0.00, -52.20, -4.10},
-    {0.00, 0.00, 0.00, -51.80, -4.10},
-    {0.00, 0.00, 0.00, -51.40, -4.10},
-    {0.00, 0.00, 0.00, -51.00, -4.10},
-    {0.00, 0.00, 0.00, -50.60, -4.10},
-    {0.00, 0.00, 0.00, -50.20, -4.10},
-    {0.00, 0.00, 0.00, -49.80, -4.10},
-    {0.00, 0.00, 0.00, -49.40, -4.10},
-    {0.00, 0.00, 0.00, -49.00, -4.10},
-    {0.00, 0.00, 0.00, -48.60, -4.10},
-    {0.00, 0.00, 0.00, -48.20, -4.10},
-    {0.00, 0.00, 0.00, -47.80, -4.10},
-    {0.00, 0.00, 0.00, -47.40, -4.10},
-    {0.00, 0.00, 0.00, -47.00, -4.10},
-    {0.00, 0.00, 0.00, -46.60, -4.10},
-    {0.00, 0.00, 0.00, -46.20, -4.10},
-    {0.00, 0.00, 0.00, -45.80, -4.10},
-    {0.00, 0.00, 0.00, -45.40, -4.10},
-    {0.00, 0.00, 0.00, -45.00, -4.10},
-    {0.00, 0.00, 0.00, -44.60, -4.10},
-    {0.00, 0.00, 0.00, -44.20, -4.10},
-    {0.00, 0.00, 0.00, -43.80, -4.10},
-    {0.00, 0.00, 0.00, -43.40, -4.10},
-    {0.00, 0.00, 0.00, -43.00, -4.10},
-    {0.00, 0.00, 0.00, -42.60, -4.10},
-    {0.00, 0.00, 0.00, -42.20, -4.10},
-    {0.00, 0.00, 0.00, -41.80, -4.10},
-    {0.00, 0.00, 0.00, -41.40, -4.10},
-    {0.00, 0.00, 0.00, -41.00, -4.10},
-    {0.00, 0.00, 0.00, -40.60, -4.10},
-    {0.00, 0.00, 0.00, -40.20, -4.10},
-    {0.00, 0.00, 0.00, -39.80, -4.10},
-    {0.00, 0.00, 0.00, -39.40, -4.10},
-    {0.00, 0.00, 0.00, -39.00, -4.10},
-    {0.00, 0.00, 0.00, -38.60, -4.10},
-    {0.00, 0.00, 0.00, -38.20, -4.10},
-    {0.00, 0.00, 0.00, -37.80, -4.10},
-    {0.00, 0.00, 0.00, -37.40, -4.10},
-    {0.00, 0.00, 0.00, -37.00, -4.10},
-    {0.00, 0.00, 0.00, -36.60, -4.10},
-    {0.00, 0.00, 0.00, -36.20, -4.10},
-    {0.00, 0.00, 0.00, -35.80, -4.10},
-    {0.00, 0.00, 0.00, -35.40, -4.10},
-    {0.00, 0.00, 0.00, -35.00, -4.10},
-    {0.00, 0.00, 0.00, -34.60, -4.10},
-    {0.00, 0.00, 0.00, -34.20, -4.10},
-    {0.00, 0.00, 0.00, -33.80, -4.10},
-    {0.00, 0.00, 0.00, -33.40, -4.10},
-    {0.00, 0.00, 0.00, -33.00, -4.10},
-    {0.00, 0.00, 0.00, -32.60, -4.10},
-    {0.00, 0.00, 0.00, -32.20, -4.10},
-    {0.00, 0.00, 0.00, -31.80, -4.10},
-    {0.00, 0.00, 0.00, -31.40, -4.10},
-    {0.00, 0.00, 0.00, -31.00, -4.10},
-    {0.00, 0.00, 0.00, -30.60, -4.10},
-    {0.00, 0.00, 0.00, -30.20, -4.10},
-    {0.00, 0.00, 0.00, -29.80, -4.10},
-    {0.00, 0.00, 0.00, -29.40, -4.10},
-    {0.00, 0.00, 0.00, -29.00, -4.10},
-    {0.00, 0.00, 0.00, -28.60, -4.10},
-    {0.00, 0.00, 0.00, -28.20, -4.10},
-    {0.00, 0.00, 0.00, -27.80, -4.10},
-    {0.00, 0.00, 0.00, -27.40, -4.10},
-    {0.00, 0.00, 0.00, -27.00, -4.10},
-    {0.00, 0.00, 0.00, -26.60, -4.10},
-    {0.00, 0.00, 0.00, -26.20, -4.10},
-    {0.00, 0.00, 0.00, -25.80, -4.10},
-    {0.00, 0.00, 0.00, -25.40, -4.10},
-    {0.00, 0.00, 0.00, -25.00, -4.10},
-    {0.00, 0.00, 0.00, -24.60, -4.10},
-    {0.00, 0.00, 0.00, -24.20, -4.10},
-    {0.00, 0.00, 0.00, -23.80, -4.10},
-    {0.00, 0.00, 0.00, -23.40, -4.10},
-    {0.00, 0.00, 0.00, -23.00, -4.10},
-    {0.00, 0.00, 0.00, -22.60, -4.10},
-    {0.00, 0.00, 0.00, -22.20, -4.10},
-    {0.00, 0.00, 0.00, -21.80, -4.10},
-    {0.00, 0.00, 0.00, -21.40, -4.10},
-    {0.00, 0.00, 0.00, -21.00, -4.10},
-    {0.00, 0.00, 0.00, -20.60, -4.10},
-    {0.00, 0.00, 0.00, -20.20, -4.10},
-    {0.00, 0.00, 0.00, -19.80, -4.10},
-    {0.00, 0.00, 0.00, -19.40, -4.10},
-    {0.00, 0.00, 0.00, -19.00, -4.10},
-    {0.00, 0.00, 0.00, -18.60, -4.10},
-    {0.00, 0.00, 0.00, -18.20, -4.10},
-    {0.00, 0.00, 0.00, -17.80, -4.10},
-    {0.00, 0.00, 0.00, -17.40, -4.10},
-    {0.00, 0.00, 0.00, -17.00, -4.10},
-    {0.00, 0.00, 0.00, -16.60, -4.10},
-    {0.00, 0.00, 0.00, -16.20, -4.10},
-    {0.00, 0.00, 0.00, -15.80, -4.10},
-    {0.00, 0.00, 0.00, -15.40, -4.10},
-    {0.00, 0.00, 0.00, -15.00, -4.10},
-    {0.00, 0.00, 0.00, -14.60, -4.10},
-    {0.00, 0.00, 0.00, -14.20, -4.10},
-    {0.00, 0.00, 0.00, -13.80, -4.10},
-    {0.00, 0.00, 0.00, -13.40, -4.10},
-    {0.00, 0.00, 0.00, -13.00, -4.10},
-    {0.00, 0.00, 0.00, -12.60, -4.10},
-    {0.00, 0.00, 0.00, -12.20, -4.10},
-    {0.00, 0.00, 0.00, -11.80, -4.10},
-    {0.00, 0.00, 0.00, -11.40, -4.10},
-    {0.00, 0.00, 0.00, -11.00, -4.10},
-    {0.00, 0.00, 0.00, -10.60, -4.10},
-    {0.00, 0.00, 0.00, -10.20, -4.10},
-    {0.00, 0.00, 0.00, -9.80, -4.10},
-    {0.00, 0.00, 0.00, -9.40, -4.10},
-    {0.00, 0.00, 0.00, -9.00, -4.10},
-    {0.00, 0.00, 0.00, -8.60, -4.10},
-    {0.00, 0.00, 0.00, -8.20, -4.10},
-    {0.00, 0.00, 0.00, -7.80, -4.10},
-    {0.00, 0.00, 0.00, -7.40, -4.10},
-    {0.00, 0.00, 0.00, -7.00, -4.10},
-    {0.00, 0.00, 0.00, -6.60, -4.10},
-    {0.00, 0.00, 0.00, -6.20, -4.10},
-    {0.00, 0.00, 0.00, -5.80, -4.10},
-    {0.00, 0.00, 0.00, -5.40, -4.10},
-    {0.00, 0.00, 0.00, -5.00, -4.10},
-    {0.00, 0.00, 0.00, -4.60, -4.10},
-    {0.00, 0.00, 0.00, -4.20, -4.10},
-    {0.00, 0.00, 0.00, -3.80, -4.10},
-    {0.00, 0.00, 0.00, -3.40, -4.10},
-    {0.00, 0.00, 0.00, -3.00, -4.10},
-    {0.00, 0.00, 0.00, -2.60, -4.10},
-    {0.00, 0.00, 0.00, -2.20, -4.10},
-    {0.00, 0.00, 0.00, -1.80, -4.10},
-    {0.00, 0.00, 0.00, -1.40, -4.10},
-    {0.00, 0.00, 0.00, -1.00, -4.10},
-    {0.00, 0.00, 0.00, -0.60, -4.10},
-    {0.00, 0.00, 0.00, -0.20, -4.10},
-    {0.00, 0.00, 0.00, 0.20, -4.10},
-    {0.00, 0.00, 0.00, 0.60, -4.10},
-    {0.00, 0.00, 0.00, 1.00, -4.10},
-    {0.00, 0.00, 0.00, 1.40, -4.10},
-    {0.00, 0.00, 0.00, 1.80, -4.10},
-    {0.00, 0.00, 0.00, 2.20, -4.10},
-    {0.00, 0.00, 0.00, 2.60, -4.10},
-    {0.00, 0.00, 0.00, 3.00, -4.10},
-    {0.00, 0.00, 0.00, 3.40, -4.10},
-    {0.00, 0.00, 0.00, 3.80, -4.10},
-    {0.00, 0.00, 0.00, 4.20, -4.10},
-    {0.00, 0.00, 0.00, 4.60, -4.10},
-    {0.00, 0.00, 0.00, 5.00, -4.10},
-    {0.00, 0.00, 0.00, 5.40, -4.10},
-    {0.00, 0.00, 0.00, 5.80, -4.10},
-    {0.00, 0.00, 0.00, 6.20, -4.10},
-    {0.00, 0.00, 0.00, 6.60, -4.10},
-    {0.00, 0.00, 0.00, 7.00, -4.10},
-    {0.00, 0.00, 0.00, 7.40, -4.10},
-    {0.00, 0.00, 0.00, 7.80, -4.10},
-    {0.00, 0.00, 0.00, 8.20, -4.10},
-    {0.00, 0.00, 0.00, 8.60, -4.10},
-    {0.00, 0.00, 0.00, 9.00, -4.10},
-    {0.00, 0.00, 0.00, 9.40, -4.10},
-    {0.00, 0.00, 0.00, 9.80, -4.10},
-    {0.00, 0.00, 0.00, 10.20, -4.10},
-    {0.00, 0.00, 0.00, 10.60, -4.10},
-    {0.00, 0.00, 0.00, 11.00, -4.10},
-    {0.00, 0.00, 0.00, 11.40, -4.10},
-    {0.00, 0.00, 0.00, 11.80, -4.10},
-    {0.00, 0.00, 0.00, 12.20, -4.10},
-    {0.00, 0.00, 0.00, 12.60, -4.10},
-    {0.00, 0.00, 0.00, 13.00, -4.10},
-    {0.00, 0.00, 0.00, 13.40, -4.10},
-    {0.00, 0.00, 0.00, 13.80, -4.10},
-    {0.00, 0.00, 0.00, 14.20, -4.10},
-    {0.00, 0.00, 0.00, 14.60, -4.10},
-    {0.00, 0.00, 0.00, 15.00, -4.10},
-    {0.00, 0.00, 0.00, 15.40, -4.10},
-    {0.00, 0.00, 0.00, 15.80, -4.10},
-    {0.00, 0.00, 0.00, 16.20, -4.10},
-    {0.00, 0.00, 0.00, 16.60, -4.10},
-    {0.00, 0.00, 0.00, 17.00, -4.10},
-    {0.00, 0.00, 0.00, 17.40, -4.10},
-    {0.00, 0.00, 0.00, 17.80, -4.10},
-    {0.00, 0.00, 0.00, 18.20, -4.10},
-    {0.00, 0.00, 0.00, 18.60, -4.10},
-    {0.00, 0.00, 0.00, 19.00, -4.10},
-    {0.00, 0.00, 0.00, 19.40, -4.10},
-    {0.00, 0.00, 0.00, 19.80, -4.10},
-    {0.00, 0.00, 0.00, 20.20, -4.10},
-    {0.00, 0.00, 0.00, 20.60, -4.10},
-    {0.00, 0.00, 0.00, 21.00, -4.10},
-    {0.00, 0.00, 0.00, 21.40, -4.10},
-    {0.00, 0.00, 0.00, 21.80, -4.10},
-    {0.00, 0.00, 0.00, 22.20, -4.10},
-    {0.00, 0.00, 0.00, 22.60, -4.10},
-    {0.00, 0.00, 0.00, 23.00, -4.10},
-    {0.00, 0.00, 0.00, 23.40, -4.10},
-    {0.00, 0.00, 0.00, 23.80, -4.10},
-    {0.00, 0.00, 0.00, 24.20, -4.10},
-    {0.00, 0.00, 0.00, 24.60, -4.10},
-    {0.00, 0.00, 0.00, 25.00, -4.10},
-    {0.00, 0.00, 0.00, 25.40, -4.10},
-    {0.00, 0.00, 0.00, 25.80, -4.10},
-    {0.00, 0.00, 0.00, 26.20, -4.10},
-    {0.00, 0.00, 0.00, 26.60, -4.10},
-    {0.00, 0.00, 0.00, 27.00, -4.10},
-    {0.00, 0.00, 0.00, 27.40, -4.10},
-    {0.00, 0.00, 0.00, 27.80, -4.10},
-    {0.00, 0.00, 0.00, 28.20, -4.10},
-    {0.00, 0.00, 0.00, 28.60, -4.10},
-    {0.00, 0.00, 0.00, 29.00, -4.10},
-    {0.00, 0.00, 0.00, 29.40, -4.10},
-    {0.00, 0.00, 0.00, 29.80, -4.10},
-    {0.00, 0.00, 0.00, 30.20, -4.10},
-    {0.00, 0.00, 0.00, 30.60, -4.10},
-    {0.00, 0.00, 0.00, 31.00, -4.10},
-    {0.00, 0.00, 0.00, 31.40, -4.10},
-    {0.00, 0.00, 0.00, 31.80, -4.10},
-    {0.00, 0.00, 0.00, 32.20, -4.10},
-    {0.00, 0.00, 0.00, 32.60, -4.10},
-    {0.00, 0.00, 0.00, 33.00, -4.10},
-    {0.00, 0.00, 0.00, 33.40, -4.10},
-    {0.00, 0.00, 0.00, 33.80, -4.10},
-    {0.00, 0.00, 0.00, 34.20, -4.10},
-    {0.00, 0.00, 0.00, 34.60, -4.10},
-    {0.00, 0.00, 0.00, 35.00, -4.10},
-    {0.00, 0.00, 0.00, 35.40, -4.10},
-    {0.00, 0.00, 0.00, 35.80, -4.10},
-    {0.00, 0.00, 0.00, 36.20, -4.10},
-    {0.00, 0.00, 0.00, 36.60, -4.10},
-    {0.00, 0.00, 0.00, 37.00, -4.10},
-    {0.00, 0.00, 0.00, 37.40, -4.10},
-    {0.00, 0.00, 0.00, 37.80, -4.10},
-    {0.00, 0.00, 0.00, 38.20, -4.10},
-    {0.00, 0.00, 0.00, 38.60, -4.10},
-    {0.00, 0.00, 0.00, 39.00, -4.10},
-    {0.00, 0.00, 0.00, 39.40, -4.10},
-    {0.00, 0.00, 0.00, 39.80, -4.10},
-    {0.00, 0.00, 0.00, 40.20, -4.10},
-    {0.00, 0.00, 0.00, 40.60, -4.10},
-    {0.00, 0.00, 0.00, 41.00, -4.10},
-    {0.00, 0.00, 0.00, 41.40, -4.10},
-    {0.00, 0.00, 0.00, 41.80, -4.10},
-    {0.00, 0.00, 0.00, 42.20, -4.10},
-    {0.00, 0.00, 0.00, 42.60, -4.10},
-    {0.00, 0.00, 0.00, 43.00, -4.10},
-    {0.00, 0.00, 0.00, 43.40, -4.10},
-    {0.00, 0.00, 0.00, 43.80, -4.10},
-    {0.00, 0.00, 0.00, 44.20, -4.10},
-    {0.00, 0.00, 0.00, 44.60, -4.10},
-    {0.00, 0.00, 0.00, 45.00, -4.10},
-    {0.00, 0.00, 0.00, 45.40, -4.10},
-    {0.00, 0.00, 0.00, 45.80, -4.10},
-    {0.00, 0.00, 0.00, 46.20, -4.10},
-    {0.00, 0.00, 0.00, 46.60, -4.10},
-    {0.00, 0.00, 0.00, 47.00, -4.10},
-    {0.00, 0.00, 0.00, 47.40, -4.10},
-    {0.00, 0.00, 0.00, 47.80, -4.10},
-    {0.00, 0.00, 0.00, 48.20, -4.10},
-    {0.00, 0.00, 0.00, 48.60, -4.10},
-    {0.00, 0.00, 0.00, 49.00, -4.10},
-    {0.00, 0.00, 0.00, 49.40, -4.10},
-    {0.00, 0.00, 0.00, 49.80, -4.10},
-    {0.00, 0.00, 0.00, 50.20, -4.10},
-    {0.00, 0.00, 0.00, 50.60, -4.10},
-    {0.00, 0.00, 0.00, 51.00, -4.10},
-    {0.00, 0.00, 0.00, 51.40, -4.10},
-    {0.00, 0.00, 0.00, 51.80, -4.10},
-    {0.00, 0.00, 0.00, 52.20, -4.10},
-    {0.00, 0.00, 0.00, 52.60, -4.10},
-    {0.00, 0.00, 0.00, 53.00, -4.10},
-    {0.00, 0.00, 0.00, 53.40, -4.10},
-    {0.00, 0.00, 0.00, 53.80, -4.10},
-    {0.00, 0.00, 0.00, 54.20, -4.10},
-    {0.00, 0.00, 0.00, 54.60, -4.10},
-    {0.00, 0.00, 0.00, 55.00, -4.10},
-    {0.00, 0.00, 0.00, 55.40, -4.10},
-    {0.00, 0.00, 0.00, 55.80, -4.10},
-    {0.00, 0.00, 0.00, 56.20, -4.10},
-    {0.00, 0.00, 0.00, 56.60, -4.10},
-    {0.00, 0.00, 0.00, 57.00, -4.10},
-    {0.00, 0.00, 0.00, 57.40, -4.10},
-    {0.00, 0.00, 0.00, 57.80, -4.10},
-    {0.00, 0.00, 0.00, 58.20, -4.10},
-    {0.00, 0.00, 0.00, 58.60, -4.10},
-    {0.00, 0.00, 0.00, 59.00, -4.10},
-    {0.00, 0.00, 0.00, 59.40, -4.10},
-    {0.00, 0.00, 0.00, 59.80, -4.10},
-    {0.00, 0.00, 0.00, -59.80, -3.90},
-    {0.00, 0.00, 0.00, -59.40, -3.90},
-    {0.00, 0.00, 0.00, -59.00, -3.90},
-    {0.00, 0.00, 0.00, -58.60, -3.90},
-    {0.00, 0.00, 0.00, -58.20, -3.90},
-    {0.00, 0.00, 0.00, -57.80, -3.90},
-    {0.00, 0.00, 0.00, -57.40, -3.90},
-    {0.00, 0.00, 0.00, -57.00, -3.90},
-    {0.00, 0.00, 0.00, -56.60, -3.90},
-    {0.00, 0.00, 0.00, -56.20, -3.90},
-    {0.00, 0.00, 0.00, -55.80, -3.90},
-    {0.00, 0.00, 0.00, -55.40, -3.90},
-    {0.00, 0.00, 0.00, -55.00, -3.90},
-    {0.00, 0.00, 0.00, -54.60, -3.90},
-    {0.00, 0.00, 0.00, -54.20, -3.90},
-    {0.00, 0.00, 0.00, -53.80, -3.90},
-    {0.00, 0.00, 0.00, -53.40, -3.90},
-    {0.00, 0.00, 0.00, -53.00, -3.90},
-    {0.00, 0.00, 0.00, -52.60, -3.90},
-    {0.00, 0.00, 0.00, -52.20, -3.90},
-    {0.00, 0.00, 0.00, -51.80, -3.90},
-    {0.00, 0.00, 0.00, -51.40, -3.90},
-    {0.00, 0.00, 0.00, -51.00, -3.90},
-    {0.00, 0.00, 0.00, -50.60, -3.90},
-    {0.00, 0.00, 0.00, -50.20, -3.90},
-    {0.00, 0.00, 0.00, -49.80, -3.90},
-    {0.00, 0.00, 0.00, -49.40, -3.90},
-    {0.00, 0.00, 0.00, -49.00, -3.90},
-    {0.00, 0.00, 0.00, -48.60, -3.90},
-    {0.00, 0.00, 0.00, -48.20, -3.90},
-    {0.00, 0.00, 0.00, -47.80, -3.90},
-    {0.00, 0.00, 0.00, -47.40, -3.90},
-    {0.00, 0.00, 0.00, -47.00, -3.90},
-    {0.00, 0.00, 0.00, -46.60, -3.90},
-    {0.00, 0.00, 0.00, -46.20, -3.90},
-    {0.00, 0.00, 0.00, -45.80, -3.90},
-    {0.00, 0.00, 0.00, -45.40, -3.90},
-    {0.00, 0.00, 0.00, -45.00, -3.90},
-    {0.00, 0.00, 0.00, -44.60, -3.90},
-    {0.00, 0.00, 0.00, -44.20, -3.90},
-    {0.00, 0.00, 0.00, -43.80, -3.90},
-    {0.00, 0.00, 0.00, -43.40, -3.90},
-    {0.00, 0.00, 0.00, -43.00, -3.90},
-    {0.00, 0.00, 0.00, -42.60, -3.90},
-    {0.00, 0.00, 0.00, -42.20, -3.90},
-    {0.00, 0.00, 0.00, -41.80, -3.90},
-    {0.00, 0.00, 0.00, -41.40, -3.90},
-    {0.00, 0.00, 0.00, -41.00, -3.90},
-    {0.00, 0.00, 0.00, -40.60, -3.90},
-    {0.00, 0.00, 0.00, -40.20, -3.90},
-    {0.00, 0.00, 0.00, -39.80, -3.90},
-    {0.00, 0.00, 0.00, -39.40, -3.90},
-    {0.00, 0.00, 0.00, -39.00, -3.90},
-    {0.00, 0.00, 0.00, -38.60, -3.90},
-    {0.00, 0.00, 0.00, -38.20, -3.90},
-    {0.00, 0.00, 0.00, -37.80, -3.90},
-    {0.00, 0.00, 0.00, -37.40, -3.90},
-    {0.00, 0.00, 0.00, -37.00, -3.90},
-    {0.00, 0.00, 0.00, -36.60, -3.90},
-    {0.00, 0.00, 0.00, -36.20, -3.90},
-    {0.00, 0.00, 0.00, -35.80, -3.90},
-    {0.00, 0.00, 0.00, -35.40, -3.90},
-    {0.00, 0.00, 0.00, -35.00, -3.90},
-    {0.00, 0.00, 0.00, -34.60, -3.90},
-    {0.00, 0.00, 0.00, -34.20, -3.90},
-    {0.00, 0.00, 0.00, -33.80, -3.90},
-    {0.00, 0.00, 0.00, -33.40, -3.90},
-    {0.00, 0.00, 0.00, -33.00, -3.90},
-    {0.00, 0.00, 0.00, -32.60, -3.90},
-    {0.00, 0.00, 0.00, -32.20, -3.90},
-    {0.00, 0.00, 0.00, -31.80, -3.90},
-    {0.00, 0.00, 0.00, -31.40, -3.90},
-    {0.00, 0.00, 0.00, -31.00, -3.90},
-    {0.00, 0.00, 0.00, -30.60, -3.90},
-    {0.00, 0.00, 0.00, -30.20, -3.90},
-    {0.00, 0.00, 0.00, -29.80, -3.90},
-    {0.00, 0.00, 0.00, -29.40, -3.90},
-    {0.00, 0.00, 0.00, -29.00, -3.90},
-    {0.00, 0.00, 0.00, -28.60, -3.90},
-    {0.00, 0.00, 0.00, -28.20, -3.90},
-    {0.00, 0.00, 0.00, -27.80, -3.90},
-    {0.00, 0.00, 0.00, -27.40, -3.90},
-    {0.00, 0.00, 0.00, -27.00, -3.90},
-    {0.00, 0.00, 0.00, -26.60, -3.90},
-    {0.00, 0.00, 0.00, -26.20, -3.90},
-    {0.00, 0.00, 0.00, -25.80, -3.90},
-    {0.00, 0.00, 0.00, -25.40, -3.90},
-    {0.00, 0.00, 0.00, -25.00, -3.90},
-    {0.00, 0.00, 0.00, -24.60, -3.90},
-    {0.00, 0.00, 0.00, -24.20, -3.90},
-    {0.00, 0.00, 0.00, -23.80, -3.90},
-    {0.00, 0.00, 0.00, -23.40, -3.90},
-    {0.00, 0.00, 0.00, -23.00, -3.90},
-    {0.00, 0.00, 0.00, -22.60, -3.90},
-    {0.00, 0.00, 0.00, -22.20, -3.90},
-    {0.00, 0.00, 0.00, -21.80, -3.90},
-    {0.00, 0.00, 0.00, -21.40, -3.90},
-    {0.00, 0.00, 0.00, -21.00, -3.90},
-    {0.00, 0.00, 0.00, -20.60, -3.90},
-    {0.00, 0.00, 0.00, -20.20, -3.90},
-    {0.00, 0.00, 0.00, -19.80, -3.90},
-    {0.00, 0.00, 0.00, -19.40, -3.90},
-    {0.00, 0.00, 0.00, -19.00, -3.90},
-    {0.00, 0.00, 0.00, -18.60, -3.90},
-    {0.00, 0.00, 0.00, -18.20, -3.90},
-    {0.00, 0.00, 0.00, -17.80, -3.90},
-    {0.00, 0.00, 0.00, -17.40, -3.90},
-    {0.00, 0.00, 0.00, -17.00, -3.90},
-    {0.00, 0.00, 0.00, -16.60, -3.90},
-    {0.00, 0.00, 0.00, -16.20, -3.90},
-    {0.00, 0.00, 0.00, -15.80, -3.90},
-    {0.00, 0.00, 0.00, -15.40, -3.90},
-    {0.00, 0.00, 0.00, -15.00, -3.90},
-    {0.00, 0.00, 0.00, -14.60, -3.90},
-    {0.00, 0.00, 0.00, -14.20, -3.90},
-    {0.00, 0.00, 0.00, -13.80, -3.90},
-    {0.00, 0.00, 0.00, -13.40, -3.90},
-    {0.00, 0.00, 0.00, -13.00, -3.90},
-    {0.00, 0.00, 0.00, -12.60, -3.90},
-    {0.00, 0.00, 0.00, -12.20, -3.90},
-    {0.00, 0.00, 0.00, -11.80, -3.90},
-    {0.00, 0.00, 0.00, -11.40, -3.90},
-    {0.00, 0.00, 0.00, -11.00, -3.90},
-    {0.00, 0.00, 0.00, -10.60, -3.90},
-    {0.00, 0.00, 0.00, -10.20, -3.90},
-    {0.00, 0.00, 0.00, -9.80, -3.90},
-    {0.00, 0.00, 0.00, -9.40, -3.90},
-    {0.00, 0.00, 0.00, -9.00, -3.90},
-    {0.00, 0.00, 0.00, -8.60, -3.90},
-    {0.00, 0.00, 0.00, -8.20, -3.90},
-    {0.00, 0.00, 0.00, -7.80, -3.90},
-    {0.00, 0.00, 0.00, -7.40, -3.90},
-    {0.00, 0.00, 0.00, -7.00, -3.90},
-    {0.00, 0.00, 0.00, -6.60, -3.90},
-    {0.00, 0.00, 0.00, -6.20, -3.90},
-    {0.00, 0.00, 0.00, -5.80, -3.90},
-    {0.00, 0.00, 0.00, -5.40, -3.90},
-    {0.00, 0.00, 0.00, -5.00, -3.90},
-    {0.00, 0.00, 0.00, -4.60, -3.90},
-    {0.00, 0.00, 0.00, -4.20, -3.90},
-    {0.00, 0.00, 0.00, -3.80, -3.90},
-    {0.00, 0.00, 0.00, -3.40, -3.90},
-    {0.00, 0.00, 0.00, -3.00, -3.90},
-    {0.00, 0.00, 0.00, -2.60, -3.90},
-    {0.00, 0.00, 0.00, -2.20, -3.90},
-    {0.00, 0.00, 0.00, -1.80, -3.90},
-    {0.00, 0.00, 0.00, -1.40, -3.90},
-    {0.00, 0.00, 0.00, -1.00, -3.90},
-    {0.00, 0.00, 0.00, -0.60, -3.90},
-    {0.00, 0.00, 0.00, -0.20, -3.90},
-    {0.00, 0.00, 0.00, 0.20, -3.90},
-    {0.00, 0.00, 0.00, 0.60, -3.90},
-    {0.00, 0.00, 0.00, 1.00, -3.90},
-    {0.00, 0.00, 0.00, 1.40, -3.90},
-    {0.00, 0.00, 0.00, 1.80, -3.90},
-    {0.00, 0.00, 0.00, 2.20, -3.90},
-    {0.00, 0.00, 0.00, 2.60, -3.90},
-    {0.00, 0.00, 0.00, 3.00, -3.90},
-    {0.00, 0.00, 0.00, 3.40, -3.90},
-    {0.00, 0.00, 0.00, 3.80, -3.90},
-    {0.00, 0.00, 0.00, 4.20, -3.90},
-    {0.00, 0.00, 0.00, 4.60, -3.90},
-    {0.00, 0.00, 0.00, 5.00, -3.90},
-    {0.00, 0.00, 0.00, 5.40, -3.90},
-    {0.00, 0.00, 0.00, 5.80, -3.90},
-    {0.00, 0.00, 0.00, 6.20, -3.90},
-    {0.00, 0.00, 0.00, 6.60, -3.90},
-    {0.00, 0.00, 0.00, 7.00, -3.90},
-    {0.00, 0.00, 0.00, 7.40, -3.90},
-    {0.00, 0.00, 0.00, 7.80, -3.90},
-    {0.00, 0.00, 0.00, 8.20, -3.90},
-    {0.00, 0.00, 0.00, 8.60, -3.90},
-    {0.00, 0.00, 0.00, 9.00, -3.90},
-    {0.00, 0.00, 0.00, 9.40, -3.90},
-    {0.00, 0.00, 0.00, 9.80, -3.90},
-    {0.00, 0.00, 0.00, 10.20, -3.90},
-    {0.00, 0.00, 0.00, 10.60, -3.90},
-    {0.00, 0.00, 0.00, 11.00, -3.90},
-    {0.00, 0.00, 0.00, 11.40, -3.90},
-    {0.00, 0.00, 0.00, 11.80, -3.90},
-    {0.00, 0.00, 0.00, 12.20, -3.90},
-    {0.00, 0.00, 0.00, 12.60, -3.90},
-    {0.00, 0.00, 0.00, 13.00, -3.90},
-    {0.00, 0.00, 0.00, 13.40, -3.90},
-    {0.00, 0.00, 0.00, 13.80, -3.90},
-    {0.00, 0.00, 0.00, 14.20, -3.90},
-    {0.00, 0.00, 0.00, 14.60, -3.90},
-    {0.00, 0.00, 0.00, 15.00, -3.90},
-    {0.00, 0.00, 0.00, 15.40, -3.90},
-    {0.00, 0.00, 0.00, 15.80, -3.90},
-    {0.00, 0.00, 0.00, 16.20, -3.90},
-    {0.00, 0.00, 0.00, 16.60, -3.90},
-    {0.00, 0.00, 0.00, 17.00, -3.90},
-    {0.00, 0.00, 0.00, 17.40, -3.90},
-    {0.00, 0.00, 0.00, 17.80, -3.90},
-    {0.00, 0.00, 0.00, 18.20, -3.90},
-    {0.00, 0.00, 0.00, 18.60, -3.90},
-    {0.00, 0.00, 0.00, 19.00, -3.90},
-    {0.00, 0.00, 0.00, 19.40, -3.90},
-    {0.00, 0.00, 0.00, 19.80, -3.90},
-    {0.00, 0.00, 0.00, 20.20, -3.90},
-    {0.00, 0.00, 0.00, 20.60, -3.90},
-    {0.00, 0.00, 0.00, 21.00, -3.90},
-    {0.00, 0.00, 0.00, 21.40, -3.90},
-    {0.00, 0.00, 0.00, 21.80, -3.90},
-    {0.00, 0.00, 0.00, 22.20, -3.90},
-    {0.00, 0.00, 0.00, 22.60, -3.90},
-    {0.00, 0.00, 0.00, 23.00, -3.90},
-    {0.00, 0.00, 0.00, 23.40, -3.90},
-    {0.00, 0.00, 0.00, 23.80, -3.90},
-    {0.00, 0.00, 0.00, 24.20, -3.90},
-    {0.00, 0.00, 0.00, 24.60, -3.90},
-    {0.00, 0.00, 0.00, 25.00, -3.90},
-    {0.00, 0.00, 0.00, 25.40, -3.90},
-    {0.00, 0.00, 0.00, 25.80, -3.90},
-    {0.00, 0.00, 0.00, 26.20, -3.90},
-    {0.00, 0.00, 0.00, 26.60, -3.90},
-    {0.00, 0.00, 0.00, 27.00, -3.90},
-    {0.00, 0.00, 0.00, 27.40, -3.90},
-    {0.00, 0.00, 0.00, 27.80, -3.90},
-    {0.00, 0.00, 0.00, 28.20, -3.90},
-    {0.00, 0.00, 0.00, 28.60, -3.90},
-    {0.00, 0.00, 0.00, 29.00, -3.90},
-    {0.00, 0.00, 0.00, 29.40, -3.90},
-    {0.00, 0.00, 0.00, 29.80, -3.90},
-    {0.00, 0.00, 0.00, 30.20, -3.90},
-    {0.00, 0.00, 0.00, 30.60, -3.90},
-    {0.00, 0.00, 0.00, 31.00, -3.90},
-    {0.00, 0.00, 0.00, 31.40, -3.90},
-    {0.00, 0.00, 0.00, 31.80, -3.90},
-    {0.00, 0.00, 0.00, 32.20, -3.90},
-    {0.00, 0.00, 0.00, 32.60, -3.90},
-    {0.00, 0.00, 0.00, 33.00, -3.90},
-    {0.00, 0.00, 0.00, 33.40, -3.90},
-    {0.00, 0.00, 0.00, 33.80, -3.90},
-    {0.00, 0.00, 0.00, 34.20, -3.90},
-    {0.00, 0.00, 0.00, 34.60, -3.90},
-    {0.00, 0.00, 0.00, 35.00, -3.90},
-    {0.00, 0.00, 0.00, 35.40, -3.90},
-    {0.00, 0.00, 0.00, 35.80, -3.90},
-    {0.00, 0.00, 0.00, 36.20, -3.90},
-    {0.00, 0.00, 0.00, 36.60, -3.90},
-    {0.00, 0.00, 0.00, 37.00, -3.90},
-    {0.00, 0.00, 0.00, 37.40, -3.90},
-    {0.00, 0.00, 0.00, 37.80, -3.90},
-    {0.00, 0.00, 0.00, 38.20, -3.90},
-    {0.00, 0.00, 0.00, 38.60, -3.90},
-    {0.00, 0.00, 0.00, 39.00, -3.90},
-    {0.00, 0.00, 0.00, 39.40, -3.90},
-    {0.00, 0.00, 0.00, 39.80, -3.90},
-    {0.00, 0.00, 0.00, 40.20, -3.90},
-    {0.00, 0.00, 0.00, 40.60, -3.90},
-    {0.00, 0.00, 0.00, 41.00, -3.90},
-    {0.00, 0.00, 0.00, 41.40, -3.90},
-    {0.00, 0.00, 0.00, 41.80, -3.90},
-    {0.00, 0.00, 0.00, 42.20, -3.90},
-    {0.00, 0.00, 0.00, 42.60, -3.90},
-    {0.00, 0.00, 0.00, 43.00, -3.90},
-    {0.00, 0.00, 0.00, 43.40, -3.90},
-    {0.00, 0.00, 0.00, 43.80, -3.90},
-    {0.00, 0.00, 0.00, 44.20, -3.90},
-    {0.00, 0.00, 0.00, 44.60, -3.90},
-    {0.00, 0.00, 0.00, 45.00, -3.90},
-    {0.00, 0.00, 0.00, 45.40, -3.90},
-    {0.00, 0.00, 0.00, 45.80, -3.90},
-    {0.00, 0.00, 0.00, 46.20, -3.90},
-    {0.00, 0.00, 0.00, 46.60, -3.90},
-    {0.00, 0.00, 0.00, 47.00, -3.90},
-    {0.00, 0.00, 0.00, 47.40, -3.90},
-    {0.00, 0.00, 0.00, 47.80, -3.90},
-    {0.00, 0.00, 0.00, 48.20, -3.90},
-    {0.00, 0.00, 0.00, 48.60, -3.90},
-    {0.00, 0.00, 0.00, 49.00, -3.90},
-    {0.00, 0.00, 0.00, 49.40, -3.90},
-    {0.00, 0.00, 0.00, 49.80, -3.90},
-    {0.00, 0.00, 0.00, 50.20, -3.90},
-    {0.00, 0.00, 0.00, 50.60, -3.90},
-    {0.00, 0.00, 0.00, 51.00, -3.90},
-    {0.00, 0.00, 0.00, 51.40, -3.90},
-    {0.00, 0.00, 0.00, 51.80, -3.90},
-    {0.00, 0.00, 0.00, 52.20, -3.90},
-    {0.00, 0.00, 0.00, 52.60, -3.90},
-    {0.00, 0.00, 0.00, 53.00, -3.90},
-    {0.00, 0.00, 0.00, 53.40, -3.90},
-    {0.00, 0.00, 0.00, 53.80, -3.90},
-    {0.00, 0.00, 0.00, 54.20, -3.90},
-    {0.00, 0.00, 0.00, 54.60, -3.90},
-    {0.00, 0.00, 0.00, 55.00, -3.90},
-    {0.00, 0.00, 0.00, 55.40, -3.90},
-    {0.00, 0.00, 0.00, 55.80, -3.90},
-    {0.00, 0.00, 0.00, 56.20, -3.90},
-    {0.00, 0.00, 0.00, 56.60, -3.90},
-    {0.00, 0.00, 0.00, 57.00, -3.90},
-    {0.00, 0.00, 0.00, 57.40, -3.90},
-    {0.00, 0.00, 0.00, 57.80, -3.90},
-    {0.00, 0.00, 0.00, 58.20, -3.90},
-    {0.00, 0.00, 0.00, 58.60, -3.90},
-    {0.00, 0.00, 0.00, 59.00, -3.90},
-    {0.00, 0.00, 0.00, 59.40, -3.90},
-    {0.00, 0.00, 0.00, 59.80, -3.90},
-    {0.00, 0.00, 0.00, -59.80, -3.70},
-    {0.00, 0.00, 0.00, -59.40, -3.70},
-    {0.00, 0.00, 0.00, -59.00, -3.70},
-    {0.00, 0.00, 0.00, -58.60, -3.70},
-    {0.00, 0.00, 0.00, -58.20, -3.70},
-    {0.00, 0.00, 0.00, -57.80, -3.70},
-    {0.00, 0.00, 0.00, -57.40, -3.70},
-    {0.00, 0.00, 0.00, -57.00, -3.70},
-    {0.00, 0.00, 0.00, -56.60, -3.70},
-    {0.00, 0.00, 0.00, -56.20, -3.70},
-    {0.00, 0.00, 0.00, -55.80, -3.70},
-    {0.00, 0.00, 0.00, -55.40, -3.70},
-    {0.00, 0.00, 0.00, -55.00, -3.70},
-    {0.00, 0.00, 0.00, -54.60, -3.70},
-    {0.00, 0.00, 0.00, -54.20, -3.70},
-    {0.00, 0.00, 0.00, -53.80, -3.70},
-    {0.00, 0.00, 0.00, -53.40, -3.70},
-    {0.00, 0.00, 0.00, -53.00, -3.70},
-    {0.00, 0.00, 0.00, -52.60, -3.70},
-    {0.00, 0.00, 0.00, -52.20, -3.70},
-    {0.00, 0.00, 0.00, -51.80, -3.70},
-    {0.00, 0.00, 0.00, -51.40, -3.70},
-    {0.00, 0.00, 0.00, -51.00, -3.70},
-    {0.00, 0.00, 0.00, -50.60, -3.70},
-    {0.00, 0.00, 0.00, -50.20, -3.70},
-    {0.00, 0.00, 0.00, -49.80, -3.70},
-    {0.00, 0.00, 0.00, -49.40, -3.70},
-    {0.00, 0.00, 0.00, -49.00, -3.70},
-    {0.00, 0.00, 0.00, -48.60, -3.70},
-    {0.00, 0.00, 0.00, -48.20, -3.70},
-    {0.00, 0.00, 0.00, -47.80, -3.70},
-    {0.00, 0.00, 0.00, -47.40, -3.70},
-    {0.00, 0.00, 0.00, -47.00, -3.70},
-    {0.00, 0.00, 0.00, -46.60, -3.70},
-    {0.00, 0.00, 0.00, -46.20, -3.70},
-    {0.00, 0.00, 0.00, -45.80, -3.70},
-    {0.00, 0.00, 0.00, -45.40, -3.70},
-    {0.00, 0.00, 0.00, -45.00, -3.70},
-    {0.00, 0.00, 0.00, -44.60, -3.70},
-    {0.00, 0.00, 0.00, -44.20, -3.70},
-    {0.00, 0.00, 0.00, -43.80, -3.70},
-    {0.00, 0.00, 0.00, -43.40, -3.70},
-    {0.00, 0.00, 0.00, -43.00, -3.70},
-    {0.00, 0.00, 0.00, -42.60, -3.70},
-    {0.00, 0.00, 0.00, -42.20, -3.70},
-    {0.00, 0.00, 0.00, -41.80, -3.70},
-    {0.00, 0.00, 0.00, -41.40, -3.70},
-    {0.00, 0.00, 0.00, -41.00, -3.70},
-    {0.00, 0.00, 0.00, -40.60, -3.70},
-    {0.00, 0.00, 0.00, -40.20, -3.70},
-    {0.00, 0.00, 0.00, -39.80, -3.70},
-    {0.00, 0.00, 0.00, -39.40, -3.70},
-    {0.00, 0.00, 0.00, -39.00, -3.70},
-    {0.00, 0.00, 0.00, -38.60, -3.70},
-    {0.00, 0.00, 0.00, -38.20, -3.70},
-    {0.00, 0.00, 0.00, -37.80, -3.70},
-    {0.00, 0.00, 0.00, -37.40, -3.70},
-    {0.00, 0.00, 0.00, -37.00, -3.70},
-    {0.00, 0.00, 0.00, -36.60, -3.70},
-    {0.00, 0.00, 0.00, -36.20, -3.70},
-    {0.00, 0.00, 0.00, -35.80, -3.70},
-    {0.00, 0.00, 0.00, -35.40, -3.70},
-    {0.00, 0.00, 0.00, -35.00, -3.70},
-    {0.00, 0.00, 0.00, -34.60, -3.70},
-    {0.00, 0.00, 0.00, -34.20, -3.70},
-    {0.00, 0.00, 0.00, -33.80, -3.70},
-    {0.00, 0.00, 0.00, -33.40, -3.70},
-    {0.00, 0.00, 0.00, -33.00, -3.70},
-    {0.00, 0.00, 0.00, -32.60, -3.70},
-    {0.00, 0.00, 0.00, -32.20, -3.70},
-    {0.00, 0.00, 0.00, -31.80, -3.70},
-    {0.00, 0.00, 0.00, -31.40, -3.70},
-    {0.00, 0.00, 0.00, -31.00, -3.70},
-    {0.00, 0.00, 0.00, -30.60, -3.70},
-    {0.00, 0.00, 0.00, -30.20, -3.70},
-    {0.00, 0.00, 0.00, -29.80, -3.70},
-    {0.00, 0.00, 0.00, -29.40, -3.70},
-    {0.00, 0.00, 0.00, -29.00, -3.70},
-    {0.00, 0.00, 0.00, -28.60, -3.70},
-    {0.00, 0.00, 0.00, -28.20, -3.70},
-    {0.00, 0.00, 0.00, -27.80, -3.70},
-    {0.00, 0.00, 0.00, -27.40, -3.70},
-    {0.00, 0.00, 0.00, -27.00, -3.70},
-    {0.00, 0.00, 0.00, -26.60, -3.70},
-    {0.00, 0.00, 0.00, -26.20, -3.70},
-    {0.00, 0.00, 0.00, -25.80, -3.70},
-    {0.00, 0.00, 0.00, -25.40, -3.70},
-    {0.00, 0.00, 0.00, -25.00, -3.70},
-    {0.00, 0.00, 0.00, -24.60, -3.70},
-    {0.00, 0.00, 0.00, -24.20, -3.70},
-    {0.00, 0.00, 0.00, -23.80, -3.70},
-    {0.00, 0.00, 0.00, -23.40, -3.70},
-    {0.00, 0.00, 0.00, -23.00, -3.70},
-    {0.00, 0.00, 0.00, -22.60, -3.70},
-    {0.00, 0.00, 0.00, -22.20, -3.70},
-    {0.00, 0.00, 0.00, -21.80, -3.70},
-    {0.00, 0.00, 0.00, -21.40, -3.70},
-    {0.00, 0.00, 0.00, -21.00, -3.70},
-    {0.00, 0.00, 0.00, -20.60, -3.70},
-    {0.00, 0.00, 0.00, -20.20, -3.70},
-    {0.00, 0.00, 0.00, -19.80, -3.70},
-    {0.00, 0.00, 0.00, -19.40, -3.70},
-    {0.00, 0.00, 0.00, -19.00, -3.70},
-    {0.00, 0.00, 0.00, -18.60, -3.70},
-    {0.00, 0.00, 0.00, -18.20, -3.70},
-    {0.00, 0.00, 0.00, -17.80, -3.70},
-    {0.00, 0.00, 0.00, -17.40, -3.70},
-    {0.00, 0.00, 0.00, -17.00, -3.70},
-    {0.00, 0.00, 0.00, -16.60, -3.70},
-    {0.00, 0.00, 0.00, -16.20, -3.70},
-    {0.00, 0.00, 0.00, -15.80, -3.70},
-    {0.00, 0.00, 0.00, -15.40, -3.70},
-    {0.00, 0.00, 0.00, -15.00, -3.70},
-    {0.00, 0.00, 0.00, -14.60, -3.70},
-    {0.00, 0.00, 0.00, -14.20, -3.70},
-    {0.00, 0.00, 0.00, -13.80, -3.70},
-    {0.00, 0.00, 0.00, -13.40, -3.70},
-    {0.00, 0.00, 0.00, -13.00, -3.70},
-    {0.00, 0.00, 0.00, -12.60, -3.70},
-    {0.00, 0.00, 0.00, -12.20, -3.70},
-    {0.00, 0.00, 0.00, -11.80, -3.70},
-    {0.00, 0.00, 0.00, -11.40, -3.70},
-    {0.00, 0.00, 0.00, -11.00, -3.70},
-    {0.00, 0.00, 0.00, -10.60, -3.70},
-    {0.00, 0.00, 0.00, -10.20, -3.70},
-    {0.00, 0.00, 0.00, -9.80, -3.70},
-    {0.00, 0.00, 0.00, -9.40, -3.70},
-    {0.00, 0.00, 0.00, -9.00, -3.70},
-    {0.00, 0.00, 0.00, -8.60, -3.70},
-    {0.00, 0.00, 0.00, -8.20, -3.70},
-    {0.00, 0.00, 0.00, -7.80, -3.70},
-    {0.00, 0.00, 0.00, -7.40, -3.70},
-    {0.00, 0.00, 0.00, -7.00, -3.70},
-    {0.00, 0.00, 0.00, -6.60, -3.70},
-    {0.00, 0.00, 0.00, -6.20, -3.70},
-    {0.00, 0.00, 0.00, -5.80, -3.70},
-    {0.00, 0.00, 0.00, -5.40, -3.70},
-    {0.00, 0.00, 0.00, -5.00, -3.70},
-    {0.00, 0.00, 0.00, -4.60, -3.70},
-    {0.00, 0.00, 0.00, -4.20, -3.70},
-    {0.00, 0.00, 0.00, -3.80, -3.70},
-    {0.00, 0.00, 0.00, -3.40, -3.70},
-    {0.00, 0.00, 0.00, -3.00, -3.70},
-    {0.00, 0.00, 0.00, -2.60, -3.70},
-    {0.00, 0.00, 0.00, -2.20, -3.70},
-    {0.00, 0.00, 0.00, -1.80, -3.70},
-    {0.00, 0.00, 0.00, -1.40, -3.70},
-    {0.00, 0.00, 0.00, -1.00, -3.70},
-    {0.00, 0.00, 0.00, -0.60, -3.70},
-    {0.00, 0.00, 0.00, -0.20, -3.70},
-    {0.00, 0.00, 0.00, 0.20, -3.70},
-    {0.00, 0.00, 0.00, 0.60, -3.70},
-    {0.00, 0.00, 0.00, 1.00, -3.70},
-    {0.00, 0.00, 0.00, 1.40, -3.70},
-    {0.00, 0.00, 0.00, 1.80, -3.70},
-    {0.00, 0.00, 0.00, 2.20, -3.70},
-    {0.00, 0.00, 0.00, 2.60, -3.70},
-    {0.00, 0.00, 0.00, 3.00, -3.70},
-    {0.00, 0.00, 0.00, 3.40, -3.70},
-    {0.00, 0.00, 0.00, 3.80, -3.70},
-    {0.00, 0.00, 0.00, 4.20, -3.70},
-    {0.00, 0.00, 0.00, 4.60, -3.70},
-    {0.00, 0.00, 0.00, 5.00, -3.70},
-    {0.00, 0.00, 0.00, 5.40, -3.70},
-    {0.00, 0.00, 0.00, 5.80, -3.70},
-    {0.00, 0.00, 0.00, 6.20, -3.70},
-    {0.00, 0.00, 0.00, 6.60, -3.70},
-    {0.00, 0.00, 0.00, 7.00, -3.70},
-    {0.00, 0.00, 0.00, 7.40, -3.70},
-    {0.00, 0.00, 0.00, 7.80, -3.70},
-    {0.00, 0.00, 0.00, 8.20, -3.70},
-    {0.00, 0.00, 0.00, 8.60, -3.70},
-    {0.00, 0.00, 0.00, 9.00, -3.70},
-    {0.00, 0.00, 0.00, 9.40, -3.70},
-    {0.00, 0.00, 0.00, 9.80, -3.70},
-    {0.00, 0.00, 0.00, 10.20, -3.70},
-    {0.00, 0.00, 0.00, 10.60, -3.70},
-    {0.00, 0.00, 0.00, 11.00, -3.70},
-    {0.00, 0.00, 0.00, 11.40, -3.70},
-    {0.00, 0.00, 0.00, 11.80, -3.70},
-    {0.00, 0.00, 0.00, 12.20, -3.70},
-    {0.00, 0.00, 0.00, 12.60, -3.70},
-    {0.00, 0.00, 0.00, 13.00, -3.70},
-    {0.00, 0.00, 0.00, 13.40, -3.70},
-    {0.00, 0.00, 0.00, 13.80, -3.70},
-    {0.00, 0.00, 0.00, 14.20, -3.70},
-    {0.00, 0.00, 0.00, 14.60, -3.70},
-    {0.00, 0.00, 0.00, 15.00, -3.70},
-    {0.00, 0.00, 0.00, 15.40, -3.70},
-    {0.00, 0.00, 0.00, 15.80, -3.70},
-    {0.00, 0.00, 0.00, 16.20, -3.70},
-    {0.00, 0.00, 0.00, 16.60, -3.70},
-    {0.00, 0.00, 0.00, 17.00, -3.70},
-    {0.00, 0.00, 0.00, 17.40, -3.70},
-    {0.00, 0.00, 0.00, 17.80, -3.70},
-    {0.00, 0.00, 0.00, 18.20, -3.70},
-    {0.00, 0.00, 0.00, 18.60, -3.70},
-    {0.00, 0.00, 0.00, 19.00, -3.70},
-    {0.00, 0.00, 0.00, 19.40, -3.70},
-    {0.00, 0.00, 0.00, 19.80, -3.70},
-    {0.00, 0.00, 0.00, 20.20, -3.70},
-    {0.00, 0.00, 0.00, 20.60, -3.70},
-    {0.00, 0.00, 0.00, 21.00, -3.70},
-    {0.00, 0.00, 0.00, 21.40, -3.70},
-    {0.00, 0.00, 0.00, 21.80, -3.70},
-    {0.00, 0.00, 0.00, 22.20, -3.70},
-    {0.00, 0.00, 0.00, 22.60, -3.70},
-    {0.00, 0.00, 0.00, 23.00, -3.70},
-    {0.00, 0.00, 0.00, 23.40, -3.70},
-    {0.00, 0.00, 0.00, 23.80, -3.70},
-    {0.00, 0.00, 0.00, 24.20, -3.70},
-    {0.00, 0.00, 0.00, 24.60, -3.70},
-    {0.00, 0.00, 0.00, 25.00, -3.70},
-    {0.00, 0.00, 0.00, 25.40, -3.70},
-    {0.00, 0.00, 0.00, 25.80, -3.70},
-    {0.00, 0.00, 0.00, 26.20, -3.70},
-    {0.00, 0.00, 0.00, 26.60, -3.70},
-    {0.00, 0.00, 0.00, 27.00, -3.70},
-    {0.00, 0.00, 0.00, 27.40, -3.70},
-    {0.00, 0.00, 0.00, 27.80, -3.70},
-    {0.00, 0.00, 0.00, 28.20, -3.70},
-    {0.00, 0.00, 0.00, 28.60, -3.70},
-    {0.00, 0.00, 0.00, 29.00, -3.70},
-    {0.00, 0.00, 0.00, 29.40, -3.70},
-    {0.00, 0.00, 0.00, 29.80, -3.70},
-    {0.00, 0.00, 0.00, 30.20, -3.70},
-    {0.00, 0.00, 0.00, 30.60, -3.70},
-    {0.00, 0.00, 0.00, 31.00, -3.70},
-    {0.00, 0.00, 0.00, 31.40, -3.70},
-    {0.00, 0.00, 0.00, 31.80, -3.70},
-    {0.00, 0.00, 0.00, 32.20, -3.70},
-    {0.00, 0.00, 0.00, 32.60, -3.70},
-    {0.00, 0.00, 0.00, 33.00, -3.70},
-    {0.00, 0.00, 0.00, 33.40, -3.70},
-    {0.00, 0.00, 0.00, 33.80, -3.70},
-    {0.00, 0.00, 0.00, 34.20, -3.70},
-    {0.00, 0.00, 0.00, 34.60, -3.70},
-    {0.00, 0.00, 0.00, 35.00, -3.70},
-    {0.00, 0.00, 0.00, 35.40, -3.70},
-    {0.00, 0.00, 0.00, 35.80, -3.70},
-    {0.00, 0.00, 0.00, 36.20, -3.70},
-    {0.00, 0.00, 0.00, 36.60, -3.70},
-    {0.00, 0.00, 0.00, 37.00, -3.70},
-    {0.00, 0.00, 0.00, 37.40, -3.70},
-    {0.00, 0.00, 0.00, 37.80, -3.70},
-    {0.00, 0.00, 0.00, 38.20, -3.70},
-    {0.00, 0.00, 0.00, 38.60, -3.70},
-    {0.00, 0.00, 0.00, 39.00, -3.70},
-    {0.00, 0.00, 0.00, 39.40, -3.70},
-    {0.00, 0.00, 0.00, 39.80, -3.70},
-    {0.00, 0.00, 0.00, 40.20, -3.70},
-    {0.00, 0.00, 0.00, 40.60, -3.70},
-    {0.00, 0.00, 0.00, 41.00, -3.70},
-    {0.00, 0.00, 0.00, 41.40, -3.70},
-    {0.00, 0.00, 0.00, 41.80, -3.70},
-    {0.00, 0.00, 0.00, 42.20, -3.70},
-    {0.00, 0.00, 0.00, 42.60, -3.70},
-    {0.00, 0.00, 0.00, 43.00, -3.70},
-    {0.00, 0.00, 0.00, 43.40, -3.70},
-    {0.00, 0.00, 0.00, 43.80, -3.70},
-    {0.00, 0.00, 0.00, 44.20, -3.70},
-    {0.00, 0.00, 0.00, 44.60, -3.70},
-    {0.00, 0.00, 0.00, 45.00, -3.70},
-    {0.00, 0.00, 0.00, 45.40, -3.70},
-    {0.00, 0.00, 0.00, 45.80, -3.70},
-    {0.00, 0.00, 0.00, 46.20, -3.70},
-    {0.00, 0.00, 0.00, 46.60, -3.70},
-    {0.00, 0.00, 0.00, 47.00, -3.70},
-    {0.00, 0.00, 0.00, 47.40, -3.70},
-    {0.00, 0.00, 0.00, 47.80, -3.70},
-    {0.00, 0.00, 0.00, 48.20, -3.70},
-    {0.00, 0.00, 0.00, 48.60, -3.70},
-    {0.00, 0.00, 0.00, 49.00, -3.70},
-    {0.00, 0.00, 0.00, 49.40, -3.70},
-    {0.00, 0.00, 0.00, 49.80, -3.70},
-    {0.00, 0.00, 0.00, 50.20, -3.70},
-    {0.00, 0.00, 0.00, 50.60, -3.70},
-    {0.00, 0.00, 0.00, 51.00, -3.70},
-    {0.00, 0.00, 0.00, 51.40, -3.70},
-    {0.00, 0.00, 0.00, 51.80, -3.70},
-    {0.00, 0.00, 0.00, 52.20, -3.70},
-    {0.00, 0.00, 0.00, 52.60, -3.70},
-    {0.00, 0.00, 0.00, 53.00, -3.70},
-    {0.00, 0.00, 0.00, 53.40, -3.70},
-    {0.00, 0.00, 0.00, 53.80, -3.70},
-    {0.00, 0.00, 0.00, 54.20, -3.70},
-    {0.00, 0.00, 0.00, 54.60, -3.70},
-    {0.00, 0.00, 0.00, 55.00, -3.70},
-    {0.00, 0.00, 0.00, 55.40, -3.70},
-    {0.00, 0.00, 0.00, 55.80, -3.70},
-    {0.00, 0.00, 0.00, 56.20, -3.70},
-    {0.00, 0.00, 0.00, 56.60, -3.70},
-    {0.00, 0.00, 0.00, 57.00, -3.70},
-    {0.00, 0.00, 0.00, 57.40, -3.70},
-    {0.00, 0.00, 0.00, 57.80, -3.70},
-    {0.00, 0.00, 0.00, 58.20, -3.70},
-    {0.00, 0.00, 0.00, 58.60, -3.70},
-    {0.00, 0.00, 0.00, 59.00, -3.70},
-    {0.00, 0.00, 0.00, 59.40, -3.70},
-    {0.00, 0.00, 0.00, 59.80, -3.70},
-    {0.00, 0.00, 0.00, -59.80, -3.50},
-    {0.00, 0.00, 0.00, -59.40, -3.50},
-    {0.00, 0.00, 0.00, -59.00, -3.50},
-    {0.00, 0.00, 0.00, -58.60, -3.50},
-    {0.00, 0.00, 0.00, -58.20, -3.50},
-    {0.00, 0.00, 0.00, -57.80, -3.50},
-    {0.00, 0.00, 0.00, -57.40, -3.50},
-    {0.00, 0.00, 0.00, -57.00, -3.50},
-    {0.00, 0.00, 0.00, -56.60, -3.50},
-    {0.00, 0.00, 0.00, -56.20, -3.50},
-    {0.00, 0.00, 0.00, -55.80, -3.50},
-    {0.00, 0.00, 0.00, -55.40, -3.50},
-    {0.00, 0.00, 0.00, -55.00, -3.50},
-    {0.00, 0.00, 0.00, -54.60, -3.50},
-    {0.00, 0.00, 0.00, -54.20, -3.50},
-    {0.00, 0.00, 0.00, -53.80, -3.50},
-    {0.00, 0.00, 0.00, -53.40, -3.50},
-    {0.00, 0.00, 0.00, -53.00, -3.50},
-    {0.00, 0.00, 0.00, -52.60, -3.50},
-    {0.00, 0.00, 0.00, -52.20, -3.50},
-    {0.00, 0.00, 0.00, -51.80, -3.50},
-    {0.00, 0.00, 0.00, -51.40, -3.50},
-    {0.00, 0.00, 0.00, -51.00, -3.50},
-    {0.00, 0.00, 0.00, -50.60, -3.50},
-    {0.00, 0.00, 0.00, -50.20, -3.50},
-    {0.00, 0.00, 0.00, -49.80, -3.50},
-    {0.00, 0.00, 0.00, -49.40, -3.50},
-    {0.00, 0.00, 0.00, -49.00, -3.50},
-    {0.00, 0.00, 0.00, -48.60, -3.50},
-    {0.00, 0.00, 0.00, -48.20, -3.50},
-    {0.00, 0.00, 0.00, -47.80, -3.50},
-    {0.00, 0.00, 0.00, -47.40, -3.50},
-    {0.00, 0.00, 0.00, -47.00, -3.50},
-    {0.00, 0.00, 0.00, -46.60, -3.50},
-    {0.00, 0.00, 0.00, -46.20, -3.50},
-    {0.00, 0.00, 0.00, -45.80, -3.50},
-    {0.00, 0.00, 0.00, -45.40, -3.50},
-    {0.00, 0.00, 0.00, -45.00, -3.50},
-    {0.00, 0.00, 0.00, -44.60, -3.50},
-    {0.00, 0.00, 0.00, -44.20, -3.50},
-    {0.00, 0.00, 0.00, -43.80, -3.50},
-    {0.00, 0.00, 0.00, -43.40, -3.50},
-    {0.00, 0.00, 0.00, -43.00, -3.50},
-    {0.00, 0.00, 0.00, -42.60, -3.50},
-    {0.00, 0.00, 0.00, -42.20, -3.50},
-    {0.00, 0.00, 0.00, -41.80, -3.50},
-    {0.00, 0.00, 0.00, -41.40, -3.50},
-    {0.00, 0.00, 0.00, -41.00, -3.50},
-    {0.00, 0.00, 0.00, -40.60, -3.50},
-    {0.00, 0.00, 0.00, -40.20, -3.50},
-    {0.00, 0.00, 0.00, -39.80, -3.50},
-    {0.00, 0.00, 0.00, -39.40, -3.50},
-    {0.00, 0.00, 0.00, -39.00, -3.50},
-    {0.00, 0.00, 0.00, -38.60, -3.50},
-    {0.00, 0.00, 0.00, -38.20, -3.50},
-    {0.00, 0.00, 0.00, -37.80, -3.50},
-    {0.00, 0.00, 0.00, -37.40, -3.50},
-    {0.00, 0.00, 0.00, -37.00, -3.50},
-    {0.00, 0.00, 0.00, -36.60, -3.50},
-    {0.00, 0.00, 0.00, -36.20, -3.50},
-    {0.00, 0.00, 0.00, -35.80, -3.50},
-    {0.00, 0.00, 0.00, -35.40, -3.50},
-    {0.00, 0.00, 0.00, -35.00, -3.50},
-    {0.00, 0.00, 0.00, -34.60, -3.50},
-    {0.00, 0.00, 0.00, -34.20, -3.50},
-    {0.00, 0.00, 0.00, -33.80, -3.50},
-    {0.00, 0.00, 0.00, -33.40, -3.50},
-    {0.00, 0.00, 0.00, -33.00, -3.50},
-    {0.00, 0.00, 0.00, -32.60, -3.50},
-    {0.00, 0.00, 0.00, -32.20, -3.50},
-    {0.00, 0.00, 0.00, -31.80, -3.50},
-    {0.00, 0.00, 0.00, -31.40, -3.50},
-    {0.00, 0.00, 0.00, -31.00, -3.50},
-    {0.00, 0.00, 0.00, -30.60, -3.50},
-    {0.00, 0.00, 0.00, -30.20, -3.50},
-    {0.00, 0.00, 0.00, -29.80, -3.50},
-    {0.00, 0.00, 0.00, -29.40, -3.50},
-    {0.00, 0.00, 0.00, -29.00, -3.50},
-    {0.00, 0.00, 0.00, -28.60, -3.50},
-    {0.00, 0.00, 0.00, -28.20, -3.50},
-    {0.00, 0.00, 0.00, -27.80, -3.50},
-    {0.00, 0.00, 0.00, -27.40, -3.50},
-    {0.00, 0.00, 0.00, -27.00, -3.50},
-    {0.00, 0.00, 0.00, -26.60, -3.50},
-    {0.00, 0.00, 0.00, -26.20, -3.50},
-    {0.00, 0.00, 0.00, -25.80, -3.50},
-    {0.00, 0.00, 0.00, -25.40, -3.50},
-    {0.00, 0.00, 0.00, -25.00, -3.50},
-    {0.00, 0.00, 0.00, -24.60, -3.50},
-    {0.00, 0.00, 0.00, -24.20, -3.50},
-    {0.00, 0.00, 0.00, -23.80, -3.50},
-    {0.00, 0.00, 0.00, -23.40, -3.50},
-    {0.00, 0.00, 0.00, -23.00, -3.50},
-    {0.00, 0.00, 0.00, -22.60, -3.50},
-    {0.00, 0.00, 0.00, -22.20, -3.50},
-    {0.00, 0.00, 0.00, -21.80, -3.50},
-    {0.00, 0.00, 0.00, -21.40, -3.50},
-    {0.00, 0.00, 0.00, -21.00, -3.50},
-    {0.00, 0.00, 0.00, -20.60, -3.50},
-    {0.00, 0.00, 0.00, -20.20, -3.50},
-    {0.00, 0.00, 0.00, -19.80, -3.50},
-    {0.00, 0.00, 0.00, -19.40, -3.50},
-    {0.00, 0.00, 0.00, -19.00, -3.50},
-    {0.00, 0.00, 0.00, -18.60, -3.50},
-    {0.00, 0.00, 0.00, -18.20, -3.50},
-    {0.00, 0.00, 0.00, -17.80, -3.50},
-    {0.00, 0.00, 0.00, -17.40, -3.50},
-    {0.00, 0.00, 0.00, -17.00, -3.50},
-    {0.00, 0.00, 0.00, -16.60, -3.50},
-    {0.00, 0.00, 0.00, -16.20, -3.50},
-    {0.00, 0.00, 0.00, -15.80, -3.50},
-    {0.00, 0.00, 0.00, -15.40, -3.50},
-    {0.00, 0.00, 0.00, -15.00, -3.50},
-    {0.00, 0.00, 0.00, -14.60, -3.50},
-    {0.00, 0.00, 0.00, -14.20, -3.50},
-    {0.00, 0.00, 0.00, -13.80, -3.50},
-    {0.00, 0.00, 0.00, -13.40, -3.50},
-    {0.00, 0.00, 0.00, -13.00, -3.50},
-    {0.00, 0.00, 0.00, -12.60, -3.50},
-    {0.00, 0.00, 0.00, -12.20, -3.50},
-    {0.00, 0.00, 0.00, -11.80, -3.50},
-    {0.00, 0.00, 0.00, -11.40, -3.50},
-    {0.00, 0.00, 0.00, -11.00, -3.50},
-    {0.00, 0.00, 0.00, -10.60, -3.50},
-    {0.00, 0.00, 0.00, -10.20, -3.50},
-    {0.00, 0.00, 0.00, -9.80, -3.50},
-    {0.00, 0.00, 0.00, -9.40, -3.50},
-    {0.00, 0.00, 0.00, -9.00, -3.50},
-    {0.00, 0.00, 0.00, -8.60, -3.50},
-    {0.00, 0.00, 0.00, -8.20, -3.50},
-    {0.00, 0.00, 0.00, -7.80, -3.50},
-    {0.00, 0.00, 0.00, -7.40, -3.50},
-    {0.00, 0.00, 0.00, -7.00, -3.50},
-    {0.00, 0.00, 0.00, -6.60, -3.50},
-    {0.00, 0.00, 0.00, -6.20, -3.50},
-    {0.00, 0.00, 0.00, -5.80, -3.50},
-    {0.00, 0.00, 0.00, -5.40, -3.50},
-    {0.00, 0.00, 0.00, -5.00, -3.50},
-    {0.00, 0.00, 0.00, -4.60, -3.50},
-    {0.00, 0.00, 0.00, -4.20, -3.50},
-    {0.00, 0.00, 0.00, -3.80, -3.50},
-    {0.00, 0.00, 0.00, -3.40, -3.50},
-    {0.00, 0.00, 0.00, -3.00, -3.50},
-    {0.00, 0.00, 0.00, -2.60, -3.50},
-    {0.00, 0.00, 0.00, -2.20, -3.50},
-    {0.00, 0.00, 0.00, -1.80, -3.50},
-    {0.00, 0.00, 0.00, -1.40, -3.50},
-    {0.00, 0.00, 0.00, -1.00, -3.50},
-    {0.00, 0.00, 0.00, -0.60, -3.50},
-    {0.00, 0.00, 0.00, -0.20, -3.50},
-    {0.00, 0.00, 0.00, 0.20, -3.50},
-    {0.00, 0.00, 0.00, 0.60, -3.50},
-    {0.00, 0.00, 0.00, 1.00, -3.50},
-    {0.00, 0.00, 0.00, 1.40, -3.50},
-    {0.00, 0.00, 0.00, 1.80, -3.50},
-    {0.00, 0.00, 0.00, 2.20, -3.50},
-    {0.00, 0.00, 0.00, 2.60, -3.50},
-    {0.00, 0.00, 0.00, 3.00, -3.50},
-    {0.00, 0.00, 0.00, 3.40, -3.50},
-    {0.00, 0.00, 0.00, 3.80, -3.50},
-    {0.00, 0.00, 0.00, 4.20, -3.50},
-    {0.00, 0.00, 0.00, 4.60, -3.50},
-    {0.00, 0.00, 0.00, 5.00, -3.50},
-    {0.00, 0.00, 0.00, 5.40, -3.50},
-    {0.00, 0.00, 0.00, 5.80, -3.50},
-    {0.00, 0.00, 0.00, 6.20, -3.50},
-    {0.00, 0.00, 0.00, 6.60, -3.50},
-    {0.00, 0.00, 0.00, 7.00, -3.50},
-    {0.00, 0.00, 0.00, 7.40, -3.50},
-    {0.00, 0.00, 0.00, 7.80, -3.50},
-    {0.00, 0.00, 0.00, 8.20, -3.50},
-    {0.00, 0.00, 0.00, 8.60, -3.50},
-    {0.00, 0.00, 0.00, 9.00, -3.50},
-    {0.00, 0.00, 0.00, 9.40, -3.50},
-    {0.00, 0.00, 0.00, 9.80, -3.50},
-    {0.00, 0.00, 0.00, 10.20, -3.50},
-    {0.00, 0.00, 0.00, 10.60, -3.50},
-    {0.00, 0.00, 0.00, 11.00, -3.50},
-    {0.00, 0.00, 0.00, 11.40, -3.50},
-    {0.00, 0.00, 0.00, 11.80, -3.50},
-    {0.00, 0.00, 0.00, 12.20, -3.50},
-    {0.00, 0.00, 0.00, 12.60, -3.50},
-    {0.00, 0.00, 0.00, 13.00, -3.50},
-    {0.00, 0.00, 0.00, 13.40, -3.50},
-    {0.00, 0.00, 0.00, 13.80, -3.50},
-    {0.00, 0.00, 0.00, 14.20, -3.50},
-    {0.00, 0.00, 0.00, 14.60, -3.50},
-    {0.00, 0.00, 0.00, 15.00, -3.50},
-    {0.00, 0.00, 0.00, 15.40, -3.50},
-    {0.00, 0.00, 0.00, 15.80, -3.50},
-    {0.00, 0.00, 0.00, 16.20, -3.50},
-    {0.00, 0.00, 0.00, 16.60, -3.50},
-    {0.00, 0.00, 0.00, 17.00, -3.50},
-    {0.00, 0.00, 0.00, 17.40, -3.50},
-    {0.00, 0.00, 0.00, 17.80, -3.50},
-    {0.00, 0.00, 0.00, 18.20, -3.50},
-    {0.00, 0.00, 0.00, 18.60, -3.50},
-    {0.00, 0.00, 0.00, 19.00, -3.50},
-    {0.00, 0.00, 0.00, 19.40, -3.50},
-    {0.00, 0.00, 0.00, 19.80, -3.50},
-    {0.00, 0.00, 0.00, 20.20, -3.50},
-    {0.00, 0.00, 0.00, 20.60, -3.50},
-    {0.00, 0.00, 0.00, 21.00, -3.50},
-    {0.00, 0.00, 0.00, 21.40, -3.50},
-    {0.00, 0.00, 0.00, 21.80, -3.50},
-    {0.00, 0.00, 0.00, 22.20, -3.50},
-    {0.00, 0.00, 0.00, 22.60, -3.50},
-    {0.00, 0.00, 0.00, 23.00, -3.50},
-    {0.00, 0.00, 0.00, 23.40, -3.50},
-    {0.00, 0.00, 0.00, 23.80, -3.50},
-    {0.00, 0.00, 0.00, 24.20, -3.50},
-    {0.00, 0.00, 0.00, 24.60, -3.50},
-    {0.00, 0.00, 0.00, 25.00, -3.50},
-    {0.00, 0.00, 0.00, 25.40, -3.50},
-    {0.00, 0.00, 0.00, 25.80, -3.50},
-    {0.00, 0.00, 0.00, 26.20, -3.50},
-    {0.00, 0.00, 0.00, 26.60, -3.50},
-    {0.00, 0.00, 0.00, 27.00, -3.50},
-    {0.00, 0.00, 0.00, 27.40, -3.50},
-    {0.00, 0.00, 0.00, 27.80, -3.50},
-    {0.00, 0.00, 0.00, 28.20, -3.50},
-    {0.00, 0.00, 0.00, 28.60, -3.50},
-    {0.00, 0.00, 0.00, 29.00, -3.50},
-    {0.00, 0.00, 0.00, 29.40, -3.50},
-    {0.00, 0.00, 0.00, 29.80, -3.50},
-    {0.00, 0.00, 0.00, 30.20, -3.50},
-    {0.00, 0.00, 0.00, 30.60, -3.50},
-    {0.00, 0.00, 0.00, 31.00, -3.50},
-    {0.00, 0.00, 0.00, 31.40, -3.50},
-    {0.00, 0.00, 0.00, 31.80, -3.50},
-    {0.00, 0.00, 0.00, 32.20, -3.50},
-    {0.00, 0.00, 0.00, 32.60, -3.50},
-    {0.00, 0.00, 0.00, 33.00, -3.50},
-    {0.00, 0.00, 0.00, 33.40, -3.50},
-    {0.00, 0.00, 0.00, 33.80, -3.50},
-    {0.00, 0.00, 0.00, 34.20, -3.50},
-    {0.00, 0.00, 0.00, 34.60, -3.50},
-    {0.00, 0.00, 0.00, 35.00, -3.50},
-    {0.00, 0.00, 0.00, 35.40, -3.50},
-    {0.00, 0.00, 0.00, 35.80, -3.50},
-    {0.00, 0.00, 0.00, 36.20, -3.50},
-    {0.00, 0.00, 0.00, 36.60, -3.50},
-    {0.00, 0.00, 0.00, 37.00, -3.50},
-    {0.00, 0.00, 0.00, 37.40, -3.50},
-    {0.00, 0.00, 0.00, 37.80, -3.50},
-    {0.00, 0.00, 0.00, 38.20, -3.50},
-    {0.00, 0.00, 0.00, 38.60, -3.50},
-    {0.00, 0.00, 0.00, 39.00, -3.50},
-    {0.00, 0.00, 0.00, 39.40, -3.50},
-    {0.00, 0.00, 0.00, 39.80, -3.50},
-    {0.00, 0.00, 0.00, 40.20, -3.50},
-    {0.00, 0.00, 0.00, 40.60, -3.50},
-    {0.00, 0.00, 0.00, 41.00, -3.50},
-    {0.00, 0.00, 0.00, 41.40, -3.50},
-    {0.00, 0.00, 0.00, 41.80, -3.50},
-    {0.00, 0.00, 0.00, 42.20, -3.50},
-    {0.00, 0.00, 0.00, 42.60, -3.50},
-    {0.00, 0.00, 0.00, 43.00, -3.50},
-    {0.00, 0.00, 0.00, 43.40, -3.50},
-    {0.00, 0.00, 0.00, 43.80, -3.50},
-    {0.00, 0.00, 0.00, 44.20, -3.50},
-    {0.00, 0.00, 0.00, 44.60, -3.50},
-    {0.00, 0.00, 0.00, 45.00, -3.50},
-    {0.00, 0.00, 0.00, 45.40, -3.50},
-    {0.00, 0.00, 0.00, 45.80, -3.50},
-    {0.00, 0.00, 0.00, 46.20, -3.50},
-    {0.00, 0.00, 0.00, 46.60, -3.50},
-    {0.00, 0.00, 0.00, 47.00, -3.50},
-    {0.00, 0.00, 0.00, 47.40, -3.50},
-    {0.00, 0.00, 0.00, 47.80, -3.50},
-    {0.00, 0.00, 0.00, 48.20, -3.50},
-    {0.00, 0.00, 0.00, 48.60, -3.50},
-    {0.00, 0.00, 0.00, 49.00, -3.50},
-    {0.00, 0.00, 0.00, 49.40, -3.50},
-    {0.00, 0.00, 0.00, 49.80, -3.50},
-    {0.00, 0.00, 0.00, 50.20, -3.50},
-    {0.00, 0.00, 0.00, 50.60, -3.50},
-    {0.00, 0.00, 0.00, 51.00, -3.50},
-    {0.00, 0.00, 0.00, 51.40, -3.50},
-    {0.00, 0.00, 0.00, 51.80, -3.50},
-    {0.00, 0.00, 0.00, 52.20, -3.50},
-    {0.00, 0.00, 0.00, 52.60, -3.50},
-    {0.00, 0.00, 0.00, 53.00, -3.50},
-    {0.00, 0.00, 0.00, 53.40, -3.50},
-    {0.00, 0.00, 0.00, 53.80, -3.50},
-    {0.00, 0.00, 0.00, 54.20, -3.50},
-    {0.00, 0.00, 0.00, 54.60, -3.50},
-    {0.00, 0.00, 0.00, 55.00, -3.50},
-    {0.00, 0.00, 0.00, 55.40, -3.50},
-    {0.00, 0.00, 0.00, 55.80, -3.50},
-    {0.00, 0.00, 0.00, 56.20, -3.50},
-    {0.00, 0.00, 0.00, 56.60, -3.50},
-    {0.00, 0.00, 0.00, 57.00, -3.50},
-    {0.00, 0.00, 0.00, 57.40, -3.50},
-    {0.00, 0.00, 0.00, 57.80, -3.50},
-    {0.00, 0.00, 0.00, 58.20, -3.50},
-    {0.00, 0.00, 0.00, 58.60, -3.50},
-    {0.00, 0.00, 0.00, 59.00, -3.50},
-    {0.00, 0.00, 0.00, 59.40, -3.50},
-    {0.00, 0.00, 0.00, 59.80, -3.50},
-    {0.00, 0.00, 0.00, -59.80, -3.30},
-    {0.00, 0.00, 0.00, -59.40, -3.30},
-    {0.00, 0.00, 0.00, -59.00, -3.30},
-    {0.00, 0.00, 0.00, -58.60, -3.30},
-    {0.00, 0.00, 0.00, -58.20, -3.30},
-    {0.00, 0.00, 0.00, -57.80, -3.30},
-    {0.00, 0.00, 0.00, -57.40, -3.30},
-    {0.00, 0.00, 0.00, -57.00, -3.30},
-    {0.00, 0.00, 0.00, -56.60, -3.30},
-    {0.00, 0.00, 0.00, -56.20, -3.30},
-    {0.00, 0.00, 0.00, -55.80, -3.30},
-    {0.00, 0.00, 0.00, -55.40, -3.30},
-    {0.00, 0.00, 0.00, -55.00, -3.30},
-    {0.00, 0.00, 0.00, -54.60, -3.30},
-    {0.00, 0.00, 0.00, -54.20, -3.30},
-    {0.00, 0.00, 0.00, -53.80, -3.30},
-    {0.00, 0.00, 0.00, -53.40, -3.30},
-    {0.00, 0.00, 0.00, -53.00, -3.30},
-    {0.00, 0.00, 0.00, -52.60, -3.30},
-    {0.00, 0.00, 0.00, -52.20, -3.30},
-    {0.00, 0.00, 0.00, -51.80, -3.30},
-    {0.00, 0.00, 0.00, -51.40, -3.30},
-    {0.00, 0.00, 0.00, -51.00, -3.30},
-    {0.00, 0.00, 0.00, -50.60, -3.30},
-    {0.00, 0.00, 0.00, -50.20, -3.30},
-    {0.00, 0.00, 0.00, -49.80, -3.30},
-    {0.00, 0.00, 0.00, -49.40, -3.30},
-    {0.00, 0.00, 0.00, -49.00, -3.30},
-    {0.00, 0.00, 0.00, -48.60, -3.30},
-    {0.00, 0.00, 0.00, -48.20, -3.30},
-    {0.00, 0.00, 0.00, -47.80, -3.30},
-    {0.00, 0.00, 0.00, -47.40, -3.30},
-    {0.00, 0.00, 0.00, -47.00, -3.30},
-    {0.00, 0.00, 0.00, -46.60, -3.30},
-    {0.00, 0.00, 0.00, -46.20, -3.30},
-    {0.00, 0.00, 0.00, -45.80, -3.30},
-    {0.00, 0.00, 0.00, -45.40, -3.30},
-    {0.00, 0.00, 0.00, -45.00, -3.30},
-    {0.00, 0.00, 0.00, -44.60, -3.30},
-    {0.00, 0.00, 0.00, -44.20, -3.30},
-    {0.00, 0.00, 0.00, -43.80, -3.30},
-    {0.00, 0.00, 0.00, -43.40, -3.30},
-    {0.00, 0.00, 0.00, -43.00, -3.30},
-    {0.00, 0.00, 0.00, -42.60, -3.30},
-    {0.00, 0.00, 0.00, -42.20, -3.30},
-    {0.00, 0.00, 0.00, -41.80, -3.30},
-    {0.00, 0.00, 0.00, -41.40, -3.30},
-    {0.00, 0.00, 0.00, -41.00, -3.30},
-    {0.00, 0.00, 0.00, -40.60, -3.30},
-    {0.00, 0.00, 0.00, -40.20, -3.30},
-    {0.00, 0.00, 0.00, -39.80, -3.30},
-    {0.00, 0.00, 0.00, -39.40, -3.30},
-    {0.00, 0.00, 0.00, -39.00, -3.30},
-    {0.00, 0.00, 0.00, -38.60, -3.30},
-    {0.00, 0.00, 0.00, -38.20, -3.30},
-    {0.00, 0.00, 0.00, -37.80, -3.30},
-    {0.00, 0.00, 0.00, -37.40, -3.30},
-    {0.00, 0.00, 0.00, -37.00, -3.30},
-    {0.00, 0.00, 0.00, -36.60, -3.30},
-    {0.00, 0.00, 0.00, -36.20, -3.30},
-    {0.00, 0.00, 0.00, -35.80, -3.30},
-    {0.00, 0.00, 0.00, -35.40, -3.30},
-    {0.00, 0.00, 0.00, -35.00, -3.30},
-    {0.00, 0.00, 0.00, -34.60, -3.30},
-    {0.00, 0.00, 0.00, -34.20, -3.30},
-    {0.00, 0.00, 0.00, -33.80, -3.30},
-    {0.00, 0.00, 0.00, -33.40, -3.30},
-    {0.00, 0.00, 0.00, -33.00, -3.30},
-    {0.00, 0.00, 0.00, -32.60, -3.30},
-    {0.00, 0.00, 0.00, -32.20, -3.30},
-    {0.00, 0.00, 0.00, -31.80, -3.30},
-    {0.00, 0.00, 0.00, -31.40, -3.30},
-    {0.00, 0.00, 0.00, -31.00, -3.30},
-    {0.00, 0.00, 0.00, -30.60, -3.30},
-    {0.00, 0.00, 0.00, -30.20, -3.30},
-    {0.00, 0.00, 0.00, -29.80, -3.30},
-    {0.00, 0.00, 0.00, -29.40, -3.30},
-    {0.00, 0.00, 0.00, -29.00, -3.30},
-    {0.00, 0.00, 0.00, -28.60, -3.30},
-    {0.00, 0.00, 0.00, -28.20, -3.30},
-    {0.00, 0.00, 0.00, -27.80, -3.30},
-    {0.00, 0.00, 0.00, -27.40, -3.30},
-    {0.00, 0.00, 0.00, -27.00, -3.30},
-    {0.00, 0.00, 0.00, -26.60, -3.30},
-    {0.00, 0.00, 0.00, -26.20, -3.30},
-    {0.00, 0.00, 0.00, -25.80, -3.30},
-    {0.00, 0.00, 0.00, -25.40, -3.30},
-    {0.00, 0.00, 0.00, -25.00, -3.30},
-    {0.00, 0.00, 0.00, -24.60, -3.30},
-    {0.00, 0.00, 0.00, -24.20, -3.30},
-    {0.00, 0.00, 0.00, -23.80, -3.30},
-    {0.00, 0.00, 0.00, -23.40, -3.30},
-    {0.00, 0.00, 0.00, -23.00, -3.30},
-    {0.00, 0.00, 0.00, -22.60, -3.30},
-    {0.00, 0.00, 0.00, -22.20, -3.30},
-    {0.00, 0.00, 0.00, -21.80, -3.30},
-    {0.00, 0.00, 0.00, -21.40, -3.30},
-    {0.00, 0.00, 0.00, -21.00, -3.30},
-    {0.00, 0.00, 0.00, -20.60, -3.30},
-    {0.00, 0.00, 0.00, -20.20, -3.30},
-    {0.00, 0.00, 0.00, -19.80, -3.30},
-    {0.00, 0.00, 0.00, -19.40, -3.30},
-    {0.00, 0.00, 0.00, -19.00, -3.30},
-    {0.00, 0.00, 0.00, -18.60, -3.30},
-    {0.00, 0.00, 0.00, -18.20, -3.30},
-    {0.00, 0.00, 0.00, -17.80, -3.30},
-    {0.00, 0.00, 0.00, -17.40, -3.30},
-    {0.00, 0.00, 0.00, -17.00, -3.30},
-    {0.00, 0.00, 0.00, -16.60, -3.30},
-    {0.00, 0.00, 0.00, -16.20, -3.30},
-    {0.00, 0.00, 0.00, -15.80, -3.30},
-    {0.00, 0.00, 0.00, -15.40, -3.30},
-    {0.00, 0.00, 0.00, -15.00, -3.30},
-    {0.00, 0.00, 0.00, -14.60, -3.30},
-    {0.00, 0.00, 0.00, -14.20, -3.30},
-    {0.00, 0.00, 0.00, -13.80, -3.30},
-    {0.00, 0.00, 0.00, -13.40, -3.30},
-    {0.00, 0.00, 0.00, -13.00, -3.30},
-    {0.00, 0.00, 0.00, -12.60, -3.30},
-    {0.00, 0.00, 0.00, -12.20, -3.30},
-    {0.00, 0.00, 0.00, -11.80, -3.30},
-    {0.00, 0.00, 0.00, -11.40, -3.30},
-    {0.00, 0.00, 0.00, -11.00, -3.30},
-    {0.00, 0.00, 0.00, -10.60, -3.30},
-    {0.00, 0.00, 0.00, -10.20, -3.30},
-    {0.00, 0.00, 0.00, -9.80, -3.30},
-    {0.00, 0.00, 0.00, -9.40, -3.30},
-    {0.00, 0.00, 0.00, -9.00, -3.30},
-    {0.00, 0.00, 0.00, -8.60, -3.30},
-    {0.00, 0.00, 0.00, -8.20, -3.30},
-    {0.00, 0.00, 0.00, -7.80, -3.30},
-    {0.00, 0.00, 0.00, -7.40, -3.30},
-    {0.00, 0.00, 0.00, -7.00, -3.30},
-    {0.00, 0.00, 0.00, -6.60, -3.30},
-    {0.00, 0.00, 0.00, -6.20, -3.30},
-    {0.00, 0.00, 0.00, -5.80, -3.30},
-    {0.00, 0.00, 0.00, -5.40, -3.30},
-    {0.00, 0.00, 0.00, -5.00, -3.30},
-    {0.00, 0.00, 0.00, -4.60, -3.30},
-    {0.00, 0.00, 0.00, -4.20, -3.30},
-    {0.00, 0.00, 0.00, -3.80, -3.30},
-    {0.00, 0.00, 0.00, -3.40, -3.30},
-    {0.00, 0.00, 0.00, -3.00, -3.30},
-    {0.00, 0.00, 0.00, -2.60, -3.30},
-    {0.00, 0.00, 0.00, -2.20, -3.30},
-    {0.00, 0.00, 0.00, -1.80, -3.30},
-    {0.00, 0.00, 0.00, -1.40, -3.30},
-    {0.00, 0.00, 0.00, -1.00, -3.30},
-    {0.00, 0.00, 0.00, -0.60, -3.30},
-    {0.00, 0.00, 0.00, -0.20, -3.30},
-    {0.00, 0.00, 0.00, 0.20, -3.30},
-    {0.00, 0.00, 0.00, 0.60, -3.30},
-    {0.00, 0.00, 0.00, 1.00, -3.30},
-    {0.00, 0.00, 0.00, 1.40, -3.30},
-    {0.00, 0.00, 0.00, 1.80, -3.30},
-    {0.00, 0.00, 0.00, 2.20, -3.30},
-    {0.00, 0.00, 0.00, 2.60, -3.30},
-    {0.00, 0.00, 0.00, 3.00, -3.30},
-    {0.00, 0.00, 0.00, 3.40, -3.30},
-    {0.00, 0.00, 0.00, 3.80, -3.30},
-    {0.00, 0.00, 0.00, 4.20, -3.30},
-    {0.00, 0.00, 0.00, 4.60, -3.30},
-    {0.00, 0.00, 0.00, 5.00, -3.30},
-    {0.00, 0.00, 0.00, 5.40, -3.30},
-    {0.00, 0.00, 0.00, 5.80, -3.30},
-    {0.00, 0.00, 0.00, 6.20, -3.30},
-    {0.00, 0.00, 0.00, 6.60, -3.30},
-    {0.00, 0.00, 0.00, 7.00, -3.30},
-    {0.00, 0.00, 0.00, 7.40, -3.30},
-    {0.00, 0.00, 0.00, 7.80, -3.30},
-    {0.00, 0.00, 0.00, 8.20, -3.30},
-    {0.00, 0.00, 0.00, 8.60, -3.30},
-    {0.00, 0.00, 0.00, 9.00, -3.30},
-    {0.00, 0.00, 0.00, 9.40, -3.30},
-    {0.00, 0.00, 0.00, 9.80, -3.30},
-    {0.00, 0.00, 0.00, 10.20, -3.30},
-    {0.00, 0.00, 0.00, 10.60, -3.30},
-    {0.00, 0.00, 0.00, 11.00, -3.30},
-    {0.00, 0.00, 0.00, 11.40, -3.30},
-    {0.00, 0.00, 0.00, 11.80, -3.30},
-    {0.00, 0.00, 0.00, 12.20, -3.30},
-    {0.00, 0.00, 0.00, 12.60, -3.30},
-    {0.00, 0.00, 0.00, 13.00, -3.30},
-    {0.00, 0.00, 0.00, 13.40, -3.30},
-    {0.00, 0.00, 0.00, 13.80, -3.30},
-    {0.00, 0.00, 0.00, 14.20, -3.30},
-    {0.00, 0.00, 0.00, 14.60, -3.30},
-    {0.00, 0.00, 0.00, 15.00, -3.30},
-    {0.00, 0.00, 0.00, 15.40, -3.30},
-    {0.00, 0.00, 0.00, 15.80, -3.30},
-    {0.00, 0.00, 0.00, 16.20, -3.30},
-    {0.00, 0.00, 0.00, 16.60, -3.30},
-    {0.00, 0.00, 0.00, 17.00, -3.30},
-    {0.00, 0.00, 0.00, 17.40, -3.30},
-    {0.00, 0.00, 0.00, 17.80, -3.30},
-    {0.00, 0.00, 0.00, 18.20, -3.30},
-    {0.00, 0.00, 0.00, 18.60, -3.30},
-    {0.00, 0.00, 0.00, 19.00, -3.30},
-    {0.00, 0.00, 0.00, 19.40, -3.30},
-    {0.00, 0.00, 0.00, 19.80, -3.30},
-    {0.00, 0.00, 0.00, 20.20, -3.30},
-    {0.00, 0.00, 0.00, 20.60, -3.30},
-    {0.00, 0.00, 0.00, 21.00, -3.30},
-    {0.00, 0.00, 0.00, 21.40, -3.30},
-    {0.00, 0.00, 0.00, 21.80, -3.30},
-    {0.00, 0.00, 0.00, 22.20, -3.30},
-    {0.00, 0.00, 0.00, 22.60, -3.30},
-    {0.00, 0.00, 0.00, 23.00, -3.30},
-    {0.00, 0.00, 0.00, 23.40, -3.30},
-    {0.00, 0.00, 0.00, 23.80, -3.30},
-    {0.00, 0.00, 0.00, 24.20, -3.30},
-    {0.00, 0.00, 0.00, 24.60, -3.30},
-    {0.00, 0.00, 0.00, 25.00, -3.30},
-    {0.00, 0.00, 0.00, 25.40, -3.30},
-    {0.00, 0.00, 0.00, 25.80, -3.30},
-    {0.00, 0.00, 0.00, 26.20, -3.30},
-    {0.00, 0.00, 0.00, 26.60, -3.30},
-    {0.00, 0.00, 0.00, 27.00, -3.30},
-    {0.00, 0.00, 0.00, 27.40, -3.30},
-    {0.00, 0.00, 0.00, 27.80, -3.30},
-    {0.00, 0.00, 0.00, 28.20, -3.30},
-    {0.00, 0.00, 0.00, 28.60, -3.30},
-    {0.00, 0.00, 0.00, 29.00, -3.30},
-    {0.00, 0.00, 0.00, 29.40, -3.30},
-    {0.00, 0.00, 0.00, 29.80, -3.30},
-    {0.00, 0.00, 0.00, 30.20, -3.30},
-    {0.00, 0.00, 0.00, 30.60, -3.30},
-    {0.00, 0.00, 0.00, 31.00, -3.30},
-    {0.00, 0.00, 0.00, 31.40, -3.30},
-    {0.00, 0.00, 0.00, 31.80, -3.30},
-    {0.00, 0.00, 0.00, 32.20, -3.30},
-    {0.00, 0.00, 0.00, 32.60, -3.30},
-    {0.00, 0.00, 0.00, 33.00, -3.30},
-    {0.00, 0.00, 0.00, 33.40, -3.30},
-    {0.00, 0.00, 0.00, 33.80, -3.30},
-    {0.00, 0.00, 0.00, 34.20, -3.30},
-    {0.00, 0.00, 0.00, 34.60, -3.30},
-    {0.00, 0.00, 0.00, 35.00, -3.30},
-    {0.00, 0.00, 0.00, 35.40, -3.30},
-    {0.00, 0.00, 0.00, 35.80, -3.30},
-    {0.00, 0.00, 0.00, 36.20, -3.30},
-    {0.00, 0.00, 0.00, 36.60, -3.30},
-    {0.00, 0.00, 0.00, 37.00, -3.30},
-    {0.00, 0.00, 0.00, 37.40, -3.30},
-    {0.00, 0.00, 0.00, 37.80, -3.30},
-    {0.00, 0.00, 0.00, 38.20, -3.30},
-    {0.00, 0.00, 0.00, 38.60, -3.30},
-    {0.00, 0.00, 0.00, 39.00, -3.30},
-    {0.00, 0.00, 0.00, 39.40, -3.30},
-    {0.00, 0.00, 0.00, 39.80, -3.30},
-    {0.00, 0.00, 0.00, 40.20, -3.30},
-    {0.00, 0.00, 0.00, 40.60, -3.30},
-    {0.00, 0.00, 0.00, 41.00, -3.30},
-    {0.00, 0.00, 0.00, 41.40, -3.30},
-    {0.00, 0.00, 0.00, 41.80, -3.30},
-    {0.00, 0.00, 0.00, 42.20, -3.30},
-    {0.00, 0.00, 0.00, 42.60, -3.30},
-    {0.00, 0.00, 0.00, 43.00, -3.30},
-    {0.00, 0.00, 0.00, 43.40, -3.30},
-    {0.00, 0.00, 0.00, 43.80, -3.30},
-    {0.00, 0.00, 0.00, 44.20, -3.30},
-    {0.00, 0.00, 0.00, 44.60, -3.30},
-    {0.00, 0.00, 0.00, 45.00, -3.30},
-    {0.00, 0.00, 0.00, 45.40, -3.30},
-    {0.00, 0.00, 0.00, 45.80, -3.30},
-    {0.00, 0.00, 0.00, 46.20, -3.30},
-    {0.00, 0.00, 0.00, 46.60, -3.30},
-    {0.00, 0.00, 0.00, 47.00, -3.30},
-    {0.00, 0.00, 0.00, 47.40, -3.30},
-    {0.00, 0.00, 0.00, 47.80, -3.30},
-    {0.00, 0.00, 0.00, 48.20, -3.30},
-    {0.00, 0.00, 0.00, 48.60, -3.30},
-    {0.00, 0.00, 0.00, 49.00, -3.30},
-    {0.00, 0.00, 0.00, 49.40, -3.30},
-    {0.00, 0.00, 0.00, 49.80, -3.30},
-    {0.00, 0.00, 0.00, 50.20, -3.30},
-    {0.00, 0.00, 0.00, 50.60, -3.30},
-    {0.00, 0.00, 0.00, 51.00, -3.30},
-    {0.00, 0.00, 0.00, 51.40, -3.30},
-    {0.00, 0.00, 0.00, 51.80, -3.30},
-    {0.00, 0.00, 0.00, 52.20, -3.30},
-    {0.00, 0.00, 0.00, 52.60, -3.30},
-    {0.00, 0.00, 0.00, 53.00, -3.30},
-    {0.00, 0.00, 0.00, 53.40, -3.30},
-    {0.00, 0.00, 0.00, 53.80, -3.30},
-    {0.00, 0.00, 0.00, 54.20, -3.30},
-    {0.00, 0.00, 0.00, 54.60, -3.30},
-    {0.00, 0.00, 0.00, 55.00, -3.30},
-    {0.00, 0.00, 0.00, 55.40, -3.30},
-    {0.00, 0.00, 0.00, 55.80, -3.30},
-    {0.00, 0.00, 0.00, 56.20, -3.30},
-    {0.00, 0.00, 0.00, 56.60, -3.30},
-    {0.00, 0.00, 0.00, 57.00, -3.30},
-    {0.00, 0.00, 0.00, 57.40, -3.30},
-    {0.00, 0.00, 0.00, 57.80, -3.30},
-    {0.00, 0.00, 0.00, 58.20, -3.30},
-    {0.00, 0.00, 0.00, 58.60, -3.30},
-    {0.00, 0.00, 0.00, 59.00, -3.30},
-    {0.00, 0.00, 0.00, 59.40, -3.30},
-    {0.00, 0.00, 0.00, 59.80, -3.30},
-    {0.00, 0.00, 0.00, -59.80, -3.10},
-    {0.00, 0.00, 0.00, -59.40, -3.10},
-    {0.00, 0.00, 0.00, -59.00, -3.10},
-    {0.00, 0.00, 0.00, -58.60, -3.10},
-    {0.00, 0.00, 0.00, -58.20, -3.10},
-    {0.00, 0.00, 0.00, -57.80, -3.10},
-    {0.00, 0.00, 0.00, -57.40, -3.10},
-    {0.00, 0.00, 0.00, -57.00, -3.10},
-    {0.00, 0.00, 0.00, -56.60, -3.10},
-    {0.00, 0.00, 0.00, -56.20, -3.10},
-    {0.00, 0.00, 0.00, -55.80, -3.10},
-    {0.00, 0.00, 0.00, -55.40, -3.10},
-    {0.00, 0.00, 0.00, -55.00, -3.10},
-    {0.00, 0.00, 0.00, -54.60, -3.10},
-    {0.00, 0.00, 0.00, -54.20, -3.10},
-    {0.00, 0.00, 0.00, -53.80, -3.10},
-    {0.00, 0.00, 0.00, -53.40, -3.10},
-    {0.00, 0.00, 0.00, -53.00, -3.10},
-    {0.00, 0.00, 0.00, -52.60, -3.10},
-    {0.00, 0.00, 0.00, -52.20, -3.10},
-    {0.00, 0.00, 0.00, -51.80, -3.10},
-    {0.00, 0.00, 0.00, -51.40, -3.10},
-    {0.00, 0.00, 0.00, -51.00, -3.10},
-    {0.00, 0.00, 0.00, -50.60, -3.10},
-    {0.00, 0.00, 0.00, -50.20, -3.10},
-    {0.00, 0.00, 0.00, -49.80, -3.10},
-    {0.00, 0.00, 0.00, -49.40, -3.10},
-    {0.00, 0.00, 0.00, -49.00, -3.10},
-    {0.00, 0.00, 0.00, -48.60, -3.10},
-    {0.00, 0.00, 0.00, -48.20, -3.10},
-    {0.00, 0.00, 0.00, -47.80, -3.10},
-    {0.00, 0.00, 0.00, -47.40, -3.10},
-    {0.00, 0.00, 0.00, -47.00, -3.10},
-    {0.00, 0.00, 0.00, -46.60, -3.10},
-    {0.00, 0.00, 0.00, -46.20, -3.10},
-    {0.00, 0.00, 0.00, -45.80, -3.10},
-    {0.00, 0.00, 0.00, -45.40, -3.10},
-    {0.00, 0.00, 0.00, -45.00, -3.10},
-    {0.00, 0.00, 0.00, -44.60, -3.10},
-    {0.00, 0.00, 0.00, -44.20, -3.10},
-    {0.00, 0.00, 0.00, -43.80, -3.10},
-    {0.00, 0.00, 0.00, -43.40, -3.10},
-    {0.00, 0.00, 0.00, -43.00, -3.10},
-    {0.00, 0.00, 0.00, -42.60, -3.10},
-    {0.00, 0.00, 0.00, -42.20, -3.10},
-    {0.00, 0.00, 0.00, -41.80, -3.10},
-    {0.00, 0.00, 0.00, -41.40, -3.10},
-    {0.00, 0.00, 0.00, -41.00, -3.10},
-    {0.00, 0.00, 0.00, -40.60, -3.10},
-    {0.00, 0.00, 0.00, -40.20, -3.10},
-    {0.00, 0.00, 0.00, -39.80, -3.10},
-    {0.00, 0.00, 0.00, -39.40, -3.10},
-    {0.00, 0.00, 0.00, -39.00, -3.10},
-    {0.00, 0.00, 0.00, -38.60, -3.10},
-    {0.00, 0.00, 0.00, -38.20, -3.10},
-    {0.00, 0.00, 0.00, -37.80, -3.10},
-    {0.00, 0.00, 0.00, -37.40, -3.10},
-    {0.00, 0.00, 0.00, -37.00, -3.10},
-    {0.00, 0.00, 0.00, -36.60, -3.10},
-    {0.00, 0.00, 0.00, -36.20, -3.10},
-    {0.00, 0.00, 0.00, -35.80, -3.10},
-    {0.00, 0.00, 0.00, -35.40, -3.10},
-    {0.00, 0.00, 0.00, -35.00, -3.10},
-    {0.00, 0.00, 0.00, -34.60, -3.10},
-    {0.00, 0.00, 0.00, -34.20, -3.10},
-    {0.00, 0.00, 0.00, -33.80, -3.10},
-    {0.00, 0.00, 0.00, -33.40, -3.10},
-    {0.00, 0.00, 0.00, -33.00, -3.10},
-    {0.00, 0.00, 0.00, -32.60, -3.10},
-    {0.00, 0.00, 0.00, -32.20, -3.10},
-    {0.00, 0.00, 0.00, -31.80, -3.10},
-    {0.00, 0.00, 0.00, -31.40, -3.10},
-    {0.00, 0.00, 0.00, -31.00, -3.10},
-    {0.00, 0.00, 0.00, -30.60, -3.10},
-    {0.00, 0.00, 0.00, -30.20, -3.10},
-    {0.00, 0.00, 0.00, -29.80, -3.10},
-    {0.00, 0.00, 0.00, -29.40, -3.10},
-    {0.00, 0.00, 0.00, -29.00, -3.10},
-    {0.00, 0.00, 0.00, -28.60, -3.10},
-    {0.00, 0.00, 0.00, -28.20, -3.10},
-    {0.00, 0.00, 0.00, -27.80, -3.10},
-    {0.00, 0.00, 0.00, -27.40, -3.10},
-    {0.00, 0.00, 0.00, -27.00, -3.10},
-    {0.00, 0.00, 0.00, -26.60, -3.10},
-    {0.00, 0.00, 0.00, -26.20, -3.10},
-    {0.00, 0.00, 0.00, -25.80, -3.10},
-    {0.00, 0.00, 0.00, -25.40, -3.10},
-    {0.00, 0.00, 0.00, -25.00, -3.10},
-    {0.00, 0.00, 0.00, -24.60, -3.10},
-    {0.00, 0.00, 0.00, -24.20, -3.10},
-    {0.00, 0.00, 0.00, -23.80, -3.10},
-    {0.00, 0.00, 0.00, -23.40, -3.10},
-    {0.00, 0.00, 0.00, -23.00, -3.10},
-    {0.00, 0.00, 0.00, -22.60, -3.10},
-    {0.00, 0.00, 0.00, -22.20, -3.10},
-    {0.00, 0.00, 0.00, -21.80, -3.10},
-    {0.00, 0.00, 0.00, -21.40, -3.10},
-    {0.00, 0.00, 0.00, -21.00, -3.10},
-    {0.00, 0.00, 0.00, -20.60, -3.10},
-    {0.00, 0.00, 0.00, -20.20, -3.10},
-    {0.00, 0.00, 0.00, -19.80, -3.10},
-    {0.00, 0.00, 0.00, -19.40, -3.10},
-    {0.00, 0.00, 0.00, -19.00, -3.10},
-    {0.00, 0.00, 0.00, -18.60, -3.10},
-    {0.00, 0.00, 0.00, -18.20, -3.10},
-    {0.00, 0.00, 0.00, -17.80, -3.10},
-    {0.00, 0.00, 0.00, -17.40, -3.10},
-    {0.00, 0.00, 0.00, -17.00, -3.10},
-    {0.00, 0.00, 0.00, -16.60, -3.10},
-    {0.00, 0.00, 0.00, -16.20, -3.10},
-    {0.00, 0.00, 0.00, -15.80, -3.10},
-    {0.00, 0.00, 0.00, -15.40, -3.10},
-    {0.00, 0.00, 0.00, -15.00, -3.10},
-    {0.00, 0.00, 0.00, -14.60, -3.10},
-    {0.00, 0.00, 0.00, -14.20, -3.10},
-    {0.00, 0.00, 0.00, -13.80, -3.10},
-    {0.00, 0.00, 0.00, -13.40, -3.10},
-    {0.00, 0.00, 0.00, -13.00, -3.10},
-    {0.00, 0.00, 0.00, -12.60, -3.10},
-    {0.00, 0.00, 0.00, -12.20, -3.10},
-    {0.00, 0.00, 0.00, -11.80, -3.10},
-    {0.00, 0.00, 0.00, -11.40, -3.10},
-    {0.00, 0.00, 0.00, -11.00, -3.10},
-    {0.00, 0.00, 0.00, -10.60, -3.10},
-    {0.00, 0.00, 0.00, -10.20, -3.10},
-    {0.00, 0.00, 0.00, -9.80, -3.10},
-    {0.00, 0.00, 0.00, -9.40, -3.10},
-    {0.00, 0.00, 0.00, -9.00, -3.10},
-    {0.00, 0.00, 0.00, -8.60, -3.10},
-    {0.00, 0.00, 0.00, -8.20, -3.10},
-    {0.00, 0.00, 0.00, -7.80, -3.10},
-    {0.00, 0.00, 0.00, -7.40, -3.10},
-    {0.00, 0.00, 0.00, -7.00, -3.10},
-    {0.00, 0.00, 0.00, -6.60, -3.10},
-    {0.00, 0.00, 0.00, -6.20, -3.10},
-    {0.00, 0.00, 0.00, -5.80, -3.10},
-    {0.00, 0.00, 0.00, -5.40, -3.10},
-    {0.00, 0.00, 0.00, -5.00, -3.10},
-    {0.00, 0.00, 0.00, -4.60, -3.10},
-    {0.00, 0.00, 0.00, -4.20, -3.10},
-    {0.00, 0.00, 0.00, -3.80, -3.10},
-    {0.00, 0.00, 0.00, -3.40, -3.10},
-    {0.00, 0.00, 0.00, -3.00, -3.10},
-    {0.00, 0.00, 0.00, -2.60, -3.10},
-    {0.00, 0.00, 0.00, -2.20, -3.10},
-    {0.00, 0.00, 0.00, -1.80, -3.10},
-    {0.00, 0.00, 0.00, -1.40, -3.10},
-    {0.00, 0.00, 0.00, -1.00, -3.10},
-    {0.00, 0.00, 0.00, -0.60, -3.10},
-    {0.00, 0.00, 0.00, -0.20, -3.10},
-    {0.00, 0.00, 0.00, 0.20, -3.10},
-    {0.00, 0.00, 0.00, 0.60, -3.10},
-    {0.00, 0.00, 0.00, 1.00, -3.10},
-    {0.00, 0.00, 0.00, 1.40, -3.10},
-    {0.00, 0.00, 0.00, 1.80, -3.10},
-    {0.00, 0.00, 0.00, 2.20, -3.10},
-    {0.00, 0.00, 0.00, 2.60, -3.10},
-    {0.00, 0.00, 0.00, 3.00, -3.10},
-    {0.00, 0.00, 0.00, 3.40, -3.10},
-    {0.00, 0.00, 0.00, 3.80, -3.10},
-    {0.00, 0.00, 0.00, 4.20, -3.10},
-    {0.00, 0.00, 0.00, 4.60, -3.10},
-    {0.00, 0.00, 0.00, 5.00, -3.10},
-    {0.00, 0.00, 0.00, 5.40, -3.10},
-    {0.00, 0.00, 0.00, 5.80, -3.10},
-    {0.00, 0.00, 0.00, 6.20, -3.10},
-    {0.00, 0.00, 0.00, 6.60, -3.10},
-    {0.00, 0.00, 0.00, 7.00, -3.10},
-    {0.00, 0.00, 0.00, 7.40, -3.10},
-    {0.00, 0.00, 0.00, 7.80, -3.10},
-    {0.00, 0.00, 0.00, 8.20, -3.10},
-    {0.00, 0.00, 0.00, 8.60, -3.10},
-    {0.00, 0.00, 0.00, 9.00, -3.10},
-    {0.00, 0.00, 0.00, 9.40, -3.10},
-    {0.00, 0.00, 0.00, 9.80, -3.10},
-    {0.00, 0.00, 0.00, 10.20, -3.10},
-    {0.00, 0.00, 0.00, 10.60, -3.10},
-    {0.00, 0.00, 0.00, 11.00, -3.10},
-    {0.00, 0.00, 0.00, 11.40, -3.10},
-    {0.00, 0.00, 0.00, 11.80, -3.10},
-    {0.00, 0.00, 0.00, 12.20, -3.10},
-    {0.00, 0.00, 0.00, 12.60, -3.10},
-    {0.00, 0.00, 0.00, 13.00, -3.10},
-    {0.00, 0.00, 0.00, 13.40, -3.10},
-    {0.00, 0.00, 0.00, 13.80, -3.10},
-    {0.00, 0.00, 0.00, 14.20, -3.10},
-    {0.00, 0.00, 0.00, 14.60, -3.10},
-    {0.00, 0.00, 0.00, 15.00, -3.10},
-    {0.00, 0.00, 0.00, 15.40, -3.10},
-    {0.00, 0.00, 0.00, 15.80, -3.10},
-    {0.00, 0.00, 0.00, 16.20, -3.10},
-    {0.00, 0.00, 0.00, 16.60, -3.10},
-    {0.00, 0.00, 0.00, 17.00, -3.10},
-    {0.00, 0.00, 0.00, 17.40, -3.10},
-    {0.00, 0.00, 0.00, 17.80, -3.10},
-    {0.00, 0.00, 0.00, 18.20, -3.10},
-    {0.00, 0.00, 0.00, 18.60, -3.10},
-    {0.00, 0.00, 0.00, 19.00, -3.10},
-    {0.00, 0.00, 0.00, 19.40, -3.10},
-    {0.00, 0.00, 0.00, 19.80, -3.10},
-    {0.00, 0.00, 0.00, 20.20, -3.10},
-    {0.00, 0.00, 0.00, 20.60, -3.10},
-    {0.00, 0.00, 0.00, 21.00, -3.10},
-    {0.00, 0.00, 0.00, 21.40, -3.10},
-    {0.00, 0.00, 0.00, 21.80, -3.10},
-    {0.00, 0.00, 0.00, 22.20, -3.10},
-    {0.00, 0.00, 0.00, 22.60, -3.10},
-    {0.00, 0.00, 0.00, 23.00, -3.10},
-    {0.00, 0.00, 0.00, 23.40, -3.10},
-    {0.00, 0.00, 0.00, 23.80, -3.10},
-    {0.00, 0.00, 0.00, 24.20, -3.10},
-    {0.00, 0.00, 0.00, 24.60, -3.10},
-    {0.00, 0.00, 0.00, 25.00, -3.10},
-    {0.00, 0.00, 0.00, 25.40, -3.10},
-    {0.00, 0.00, 0.00, 25.80, -3.10},
-    {0.00, 0.00, 0.00, 26.20, -3.10},
-    {0.00, 0.00, 0.00, 26.60, -3.10},
-    {0.00, 0.00, 0.00, 27.00, -3.10},
-    {0.00, 0.00, 0.00, 27.40, -3.10},
-    {0.00, 0.00, 0.00, 27.80, -3.10},
-    {0.00, 0.00, 0.00, 28.20, -3.10},
-    {0.00, 0.00, 0.00, 28.60, -3.10},
-    {0.00, 0.00, 0.00, 29.00, -3.10},
-    {0.00, 0.00, 0.00, 29.40, -3.10},
-    {0.00, 0.00, 0.00, 29.80, -3.10},
-    {0.00, 0.00, 0.00, 30.20, -3.10},
-    {0.00, 0.00, 0.00, 30.60, -3.10},
-    {0.00, 0.00, 0.00, 31.00, -3.10},
-    {0.00, 0.00, 0.00, 31.40, -3.10},
-    {0.00, 0.00, 0.00, 31.80, -3.10},
-    {0.00, 0.00, 0.00, 32.20, -3.10},
-    {0.00, 0.00, 0.00, 32.60, -3.10},
-    {0.00, 0.00, 0.00, 33.00, -3.10},
-    {0.00, 0.00, 0.00, 33.40, -3.10},
-    {0.00, 0.00, 0.00, 33.80, -3.10},
-    {0.00, 0.00, 0.00, 34.20, -3.10},
-    {0.00, 0.00, 0.00, 34.60, -3.10},
-    {0.00, 0.00, 0.00, 35.00, -3.10},
-    {0.00, 0.00, 0.00, 35.40, -3.10},
-    {0.00, 0.00, 0.00, 35.80, -3.10},
-    {0.00, 0.00, 0.00, 36.20, -3.10},
-    {0.00, 0.00, 0.00, 36.60, -3.10},
-    {0.00, 0.00, 0.00, 37.00, -3.10},
-    {0.00, 0.00, 0.00, 37.40, -3.10},
-    {0.00, 0.00, 0.00, 37.80, -3.10},
-    {0.00, 0.00, 0.00, 38.20, -3.10},
-    {0.00, 0.00, 0.00, 38.60, -3.10},
-    {0.00, 0.00, 0.00, 39.00, -3.10},
-    {0.00, 0.00, 0.00, 39.40, -3.10},
-    {0.00, 0.00, 0.00, 39.80, -3.10},
-    {0.00, 0.00, 0.00, 40.20, -3.10},
-    {0.00, 0.00, 0.00, 40.60, -3.10},
-    {0.00, 0.00, 0.00, 41.00, -3.10},
-    {0.00, 0.00, 0.00, 41.40, -3.10},
-    {0.00, 0.00, 0.00, 41.80, -3.10},
-    {0.00, 0.00, 0.00, 42.20, -3.10},
-    {0.00, 0.00, 0.00, 42.60, -3.10},
-    {0.00, 0.00, 0.00, 43.00, -3.10},
-    {0.00, 0.00, 0.00, 43.40, -3.10},
-    {0.00, 0.00, 0.00, 43.80, -3.10},
-    {0.00, 0.00, 0.00, 44.20, -3.10},
-    {0.00, 0.00, 0.00, 44.60, -3.10},
-    {0.00, 0.00, 0.00, 45.00, -3.10},
-    {0.00, 0.00, 0.00, 45.40, -3.10},
-    {0.00, 0.00, 0.00, 45.80, -3.10},
-    {0.00, 0.00, 0.00, 46.20, -3.10},
-    {0.00, 0.00, 0.00, 46.60, -3.10},
-    {0.00, 0.00, 0.00, 47.00, -3.10},
-    {0.00, 0.00, 0.00, 47.40, -3.10},
-    {0.00, 0.00, 0.00, 47.80, -3.10},
-    {0.00, 0.00, 0.00, 48.20, -3.10},
-    {0.00, 0.00, 0.00, 48.60, -3.10},
-    {0.00, 0.00, 0.00, 49.00, -3.10},
-    {0.00, 0.00, 0.00, 49.40, -3.10},
-    {0.00, 0.00, 0.00, 49.80, -3.10},
-    {0.00, 0.00, 0.00, 50.20, -3.10},
-    {0.00, 0.00, 0.00, 50.60, -3.10},
-    {0.00, 0.00, 0.00, 51.00, -3.10},
-    {0.00, 0.00, 0.00, 51.40, -3.10},
-    {0.00, 0.00, 0.00, 51.80, -3.10},
-    {0.00, 0.00, 0.00, 52.20, -3.10},
-    {0.00, 0.00, 0.00, 52.60, -3.10},
-    {0.00, 0.00, 0.00, 53.00, -3.10},
-    {0.00, 0.00, 0.00, 53.40, -3.10},
-    {0.00, 0.00, 0.00, 53.80, -3.10},
-    {0.00, 0.00, 0.00, 54.20, -3.10},
-    {0.00, 0.00, 0.00, 54.60, -3.10},
-    {0.00, 0.00, 0.00, 55.00, -3.10},
-    {0.00, 0.00, 0.00, 55.40, -3.10},
-    {0.00, 0.00, 0.00, 55.80, -3.10},
-    {0.00, 0.00, 0.00, 56.20, -3.10},
-    {0.00, 0.00, 0.00, 56.60, -3.10},
-    {0.00, 0.00, 0.00, 57.00, -3.10},
-    {0.00, 0.00, 0.00, 57.40, -3.10},
-    {0.00, 0.00, 0.00, 57.80, -3.10},
-    {0.00, 0.00, 0.00, 58.20, -3.10},
-    {0.00, 0.00, 0.00, 58.60, -3.10},
-    {0.00, 0.00, 0.00, 59.00, -3.10},
-    {0.00, 0.00, 0.00, 59.40, -3.10},
-    {0.00, 0.00, 0.00, 59.80, -3.10},
-    {0.00, 0.00, 0.00, -59.80, -2.90},
-    {0.00, 0.00, 0.00, -59.40, -2.90},
-    {0.00, 0.00, 0.00, -59.00, -2.90},
-    {0.00, 0.00, 0.00, -58.60, -2.90},
-    {0.00, 0.00, 0.00, -58.20, -2.90},
-    {0.00, 0.00, 0.00, -57.80, -2.90},
-    {0.00, 0.00, 0.00, -57.40, -2.90},
-    {0.00, 0.00, 0.00, -57.00, -2.90},
-    {0.00, 0.00, 0.00, -56.60, -2.90},
-    {0.00, 0.00, 0.00, -56.20, -2.90},
-    {0.00, 0.00, 0.00, -55.80, -2.90},
-    {0.00, 0.00, 0.00, -55.40, -2.90},
-    {0.00, 0.00, 0.00, -55.00, -2.90},
-    {0.00, 0.00, 0.00, -54.60, -2.90},
-    {0.00, 0.00, 0.00, -54.20, -2.90},
-    {0.00, 0.00, 0.00, -53.80, -2.90},
-    {0.00, 0.00, 0.00, -53.40, -2.90},
-    {0.00, 0.00, 0.00, -53.00, -2.90},
-    {0.00, 0.00, 0.00, -52.60, -2.90},
-    {0.00, 0.00, 0.00, -52.20, -2.90},
-    {0.00, 0.00, 0.00, -51.80, -2.90},
-    {0.00, 0.00, 0.00, -51.40, -2.90},
-    {0.00, 0.00, 0.00, -51.00, -2.90},
-    {0.00, 0.00, 0.00, -50.60, -2.90},
-    {0.00, 0.00, 0.00, -50.20, -2.90},
-    {0.00, 0.00, 0.00, -49.80, -2.90},
-    {0.00, 0.00, 0.00, -49.40, -2.90},
-    {0.00, 0.00, 0.00, -49.00, -2.90},
-    {0.00, 0.00, 0.00, -48.60, -2.90},
-    {0.00, 0.00, 0.00, -48.20, -2.90},
-    {0.00, 0.00, 0.00, -47.80, -2.90},
-    {0.00, 0.00, 0.00, -47.40, -2.90},
-    {0.00, 0.00, 0.00, -47.00, -2.90},
-    {0.00, 0.00, 0.00, -46.60, -2.90},
-    {0.00, 0.00, 0.00, -46.20, -2.90},
-    {0.00, 0.00, 0.00, -45.80, -2.90},
-    {0.00, 0.00, 0.00, -45.40, -2.90},
-    {0.00, 0.00, 0.00, -45.00, -2.90},
-    {0.00, 0.00, 0.00, -44.60, -2.90},
-    {0.00, 0.00, 0.00, -44.20, -2.90},
-    {0.00, 0.00, 0.00, -43.80, -2.90},
-    {0.00, 0.00, 0.00, -43.40, -2.90},
-    {0.00, 0.00, 0.00, -43.00, -2.90},
-    {0.00, 0.00, 0.00, -42.60, -2.90},
-    {0.00, 0.00, 0.00, -42.20, -2.90},
-    {0.00, 0.00, 0.00, -41.80, -2.90},
-    {0.00, 0.00, 0.00, -41.40, -2.90},
-    {0.00, 0.00, 0.00, -41.00, -2.90},
-    {0.00, 0.00, 0.00, -40.60, -2.90},
-    {0.00, 0.00, 0.00, -40.20, -2.90},
-    {0.00, 0.00, 0.00, -39.80, -2.90},
-    {0.00, 0.00, 0.00, -39.40, -2.90},
-    {0.00, 0.00, 0.00, -39.00, -2.90},
-    {0.00, 0.00, 0.00, -38.60, -2.90},
-    {0.00, 0.00, 0.00, -38.20, -2.90},
-    {0.00, 0.00, 0.00, -37.80, -2.90},
-    {0.00, 0.00, 0.00, -37.40, -2.90},
-    {0.00, 0.00, 0.00, -37.00, -2.90},
-    {0.00, 0.00, 0.00, -36.60, -2.90},
-    {0.00, 0.00, 0.00, -36.20, -2.90},
-    {0.00, 0.00, 0.00, -35.80, -2.90},
-    {0.00, 0.00, 0.00, -35.40, -2.90},
-    {0.00, 0.00, 0.00, -35.00, -2.90},
-    {0.00, 0.00, 0.00, -34.60, -2.90},
-    {0.00, 0.00, 0.00, -34.20, -2.90},
-    {0.00, 0.00, 0.00, -33.80, -2.90},
-    {0.00, 0.00, 0.00, -33.40, -2.90},
-    {0.00, 0.00, 0.00, -33.00, -2.90},
-    {0.00, 0.00, 0.00, -32.60, -2.90},
-    {0.00, 0.00, 0.00, -32.20, -2.90},
-    {0.00, 0.00, 0.00, -31.80, -2.90},
-    {0.00, 0.00, 0.00, -31.40, -2.90},
-    {0.00, 0.00, 0.00, -31.00, -2.90},
-    {0.00, 0.00, 0.00, -30.60, -2.90},
-    {0.00, 0.00, 0.00, -30.20, -2.90},
-    {0.00, 0.00, 0.00, -29.80, -2.90},
-    {0.00, 0.00, 0.00, -29.40, -2.90},
-    {0.00, 0.00, 0.00, -29.00, -2.90},
-    {0.00, 0.00, 0.00, -28.60, -2.90},
-    {0.00, 0.00, 0.00, -28.20, -2.90},
-    {0.00, 0.00, 0.00, -27.80, -2.90},
-    {0.00, 0.00, 0.00, -27.40, -2.90},
-    {0.00, 0.00, 0.00, -27.00, -2.90},
-    {0.00, 0.00, 0.00, -26.60, -2.90},
-    {0.00, 0.00, 0.00, -26.20, -2.90},
-    {0.00, 0.00, 0.00, -25.80, -2.90},
-    {0.00, 0.00, 0.00, -25.40, -2.90},
-    {0.00, 0.00, 0.00, -25.00, -2.90},
-    {0.00, 0.00, 0.00, -24.60, -2.90},
-    {0.00, 0.00, 0.00, -24.20, -2.90},
-    {0.00, 0.00, 0.00, -23.80, -2.90},
-    {0.00, 0.00, 0.00, -23.40, -2.90},
-    {0.00, 0.00, 0.00, -23.00, -2.90},
-    {0.00, 0.00, 0.00, -22.60, -2.90},
-    {0.00, 0.00, 0.00, -22.20, -2.90},
-    {0.00, 0.00, 0.00, -21.80, -2.90},
-    {0.00, 0.00, 0.00, -21.40, -2.90},
-    {0.00, 0.00, 0.00, -21.00, -2.90},
-    {0.00, 0.00, 0.00, -20.60, -2.90},
-    {0.00, 0.00, 0.00, -20.20, -2.90},
-    {0.00, 0.00, 0.00, -19.80, -2.90},
-    {0.00, 0.00, 0.00, -19.40, -2.90},
-    {0.00, 0.00, 0.00, -19.00, -2.90},
-    {0.00, 0.00, 0.00, -18.60, -2.90},
-    {0.00, 0.00, 0.00, -18.20, -2.90},
-    {0.00, 0.00, 0.00, -17.80, -2.90},
-    {0.00, 0.00, 0.00, -17.40, -2.90},
-    {0.00, 0.00, 0.00, -17.00, -2.90},
-    {0.00, 0.00, 0.00, -16.60, -2.90},
-    {0.00, 0.00, 0.00, -16.20, -2.90},
-    {0.00, 0.00, 0.00, -15.80, -2.90},
-    {0.00, 0.00, 0.00, -15.40, -2.90},
-    {0.00, 0.00, 0.00, -15.00, -2.90},
-    {0.00, 0.00, 0.00, -14.60, -2.90},
-    {0.00, 0.00, 0.00, -14.20, -2.90},
-    {0.00, 0.00, 0.00, -13.80, -2.90},
-    {0.00, 0.00, 0.00, -13.40, -2.90},
-    {0.00, 0.00, 0.00, -13.00, -2.90},
-    {0.00, 0.00, 0.00, -12.60, -2.90},
-    {0.00, 0.00, 0.00, -12.20, -2.90},
-    {0.00, 0.00, 0.00, -11.80, -2.90},
-    {0.00, 0.00, 0.00, -11.40, -2.90},
-    {0.00, 0.00, 0.00, -11.00, -2.90},
-    {0.00, 0.00, 0.00, -10.60, -2.90},
-    {0.00, 0.00, 0.00, -10.20, -2.90},
-    {0.00, 0.00, 0.00, -9.80, -2.90},
-    {0.00, 0.00, 0.00, -9.40, -2.90},
-    {0.00, 0.00, 0.00, -9.00, -2.90},
-    {0.00, 0.00, 0.00, -8.60, -2.90},
-    {0.00, 0.00, 0.00, -8.20, -2.90},
-    {0.00, 0.00, 0.00, -7.80, -2.90},
-    {0.00, 0.00, 0.00, -7.40, -2.90},
-    {0.00, 0.00, 0.00, -7.00, -2.90},
-    {0.00, 0.00, 0.00, -6.60, -2.90},
-    {0.00, 0.00, 0.00, -6.20, -2.90},
-    {0.00, 0.00, 0.00, -5.80, -2.90},
-    {0.00, 0.00, 0.00, -5.40, -2.90},
-    {0.00, 0.00, 0.00, -5.00, -2.90},
-    {0.00, 0.00, 0.00, -4.60, -2.90},
-    {0.00, 0.00, 0.00, -4.20, -2.90},
-    {0.00, 0.00, 0.00, -3.80, -2.90},
-    {0.00, 0.00, 0.00, -3.40, -2.90},
-    {0.00, 0.00, 0.00, -3.00, -2.90},
-    {0.00, 0.00, 0.00, -2.60, -2.90},
-    {0.00, 0.00, 0.00, -2.20, -2.90},
-    {0.00, 0.00, 0.00, -1.80, -2.90},
-    {0.00, 0.00, 0.00, -1.40, -2.90},
-    {0.00, 0.00, 0.00, -1.00, -2.90},
-    {0.00, 0.00, 0.00, -0.60, -2.90},
-    {0.00, 0.00, 0.00, -0.20, -2.90},
-    {0.00, 0.00, 0.00, 0.20, -2.90},
-    {0.00, 0.00, 0.00, 0.60, -2.90},
-    {0.00, 0.00, 0.00, 1.00, -2.90},
-    {0.00, 0.00, 0.00, 1.40, -2.90},
-    {0.00, 0.00, 0.00, 1.80, -2.90},
-    {0.00, 0.00, 0.00, 2.20, -2.90},
-    {0.00, 0.00, 0.00, 2.60, -2.90},
-    {0.00, 0.00, 0.00, 3.00, -2.90},
-    {0.00, 0.00, 0.00, 3.40, -2.90},
-    {0.00, 0.00, 0.00, 3.80, -2.90},
-    {0.00, 0.00, 0.00, 4.20, -2.90},
-    {0.00, 0.00, 0.00, 4.60, -2.90},
-    {0.00, 0.00, 0.00, 5.00, -2.90},
-    {0.00, 0.00, 0.00, 5.40, -2.90},
-    {0.00, 0.00, 0.00, 5.80, -2.90},
-    {0.00, 0.00, 0.00, 6.20, -2.90},
-    {0.00, 0.00, 0.00, 6.60, -2.90},
-    {0.00, 0.00, 0.00, 7.00, -2.90},
-    {0.00, 0.00, 0.00, 7.40, -2.90},
-    {0.00, 0.00, 0.00, 7.80, -2.90},
-    {0.00, 0.00, 0.00, 8.20, -2.90},
-    {0.00, 0.00, 0.00, 8.60, -2.90},
-    {0.00, 0.00, 0.00, 9.00, -2.90},
-    {0.00, 0.00, 0.00, 9.40, -2.90},
-    {0.00, 0.00, 0.00, 9.80, -2.90},
-    {0.00, 0.00, 0.00, 10.20, -2.90},
-    {0.00, 0.00, 0.00, 10.60, -2.90},
-    {0.00, 0.00, 0.00, 11.00, -2.90},
-    {0.00, 0.00, 0.00, 11.40, -2.90},
-    {0.00, 0.00, 0.00, 11.80, -2.90},
-    {0.00, 0.00, 0.00, 12.20, -2.90},
-    {0.00, 0.00, 0.00, 12.60, -2.90},
-    {0.00, 0.00, 0.00, 13.00, -2.90},
-    {0.00, 0.00, 0.00, 13.40, -2.90},
-    {0.00, 0.00, 0.00, 13.80, -2.90},
-    {0.00, 0.00, 0.00, 14.20, -2.90},
-    {0.00, 0.00, 0.00, 14.60, -2.90},
-    {0.00, 0.00, 0.00, 15.00, -2.90},
-    {0.00, 0.00, 0.00, 15.40, -2.90},
-    {0.00, 0.00, 0.00, 15.80, -2.90},
-    {0.00, 0.00, 0.00, 16.20, -2.90},
-    {0.00, 0.00, 0.00, 16.60, -2.90},
-    {0.00, 0.00, 0.00, 17.00, -2.90},
-    {0.00, 0.00, 0.00, 17.40, -2.90},
-    {0.00, 0.00, 0.00, 17.80, -2.90},
-    {0.00, 0.00, 0.00, 18.20, -2.90},
-    {0.00, 0.00, 0.00, 18.60, -2.90},
-    {0.00, 0.00, 0.00, 19.00, -2.90},
-    {0.00, 0.00, 0.00, 19.40, -2.90},
-    {0.00, 0.00, 0.00, 19.80, -2.90},
-    {0.00, 0.00, 0.00, 20.20, -2.90},
-    {0.00, 0.00, 0.00, 20.60, -2.90},
-    {0.00, 0.00, 0.00, 21.00, -2.90},
-    {0.00, 0.00, 0.00, 21.40, -2.90},
-    {0.00, 0.00, 0.00, 21.80, -2.90},
-    {0.00, 0.00, 0.00, 22.20, -2.90},
-    {0.00, 0.00, 0.00, 22.60, -2.90},
-    {0.00, 0.00, 0.00, 23.00, -2.90},
-    {0.00, 0.00, 0.00, 23.40, -2.90},
-    {0.00, 0.00, 0.00, 23.80, -2.90},
-    {0.00, 0.00, 0.00, 24.20, -2.90},
-    {0.00, 0.00, 0.00, 24.60, -2.90},
-    {0.00, 0.00, 0.00, 25.00, -2.90},
-    {0.00, 0.00, 0.00, 25.40, -2.90},
-    {0.00, 0.00, 0.00, 25.80, -2.90},
-    {0.00, 0.00, 0.00, 26.20, -2.90},
-    {0.00, 0.00, 0.00, 26.60, -2.90},
-    {0.00, 0.00, 0.00, 27.00, -2.90},
-    {0.00, 0.00, 0.00, 27.40, -2.90},
-    {0.00, 0.00, 0.00, 27.80, -2.90},
-    {0.00, 0.00, 0.00, 28.20, -2.90},
-    {0.00, 0.00, 0.00, 28.60, -2.90},
-    {0.00, 0.00, 0.00, 29.00, -2.90},
-    {0.00, 0.00, 0.00, 29.40, -2.90},
-    {0.00, 0.00, 0.00, 29.80, -2.90},
-    {0.00, 0.00, 0.00, 30.20, -2.90},
-    {0.00, 0.00, 0.00, 30.60, -2.90},
-    {0.00, 0.00, 0.00, 31.00, -2.90},
-    {0.00, 0.00, 0.00, 31.40, -2.90},
-    {0.00, 0.00, 0.00, 31.80, -2.90},
-    {0.00, 0.00, 0.00, 32.20, -2.90},
-    {0.00, 0.00, 0.00, 32.60, -2.90},
-    {0.00, 0.00, 0.00, 33.00, -2.90},
-    {0.00, 0.00, 0.00, 33.40, -2.90},
-    {0.00, 0.00, 0.00, 33.80, -2.90},
-    {0.00, 0.00, 0.00, 34.20, -2.90},
-    {0.00, 0.00, 0.00, 34.60, -2.90},
-    {0.00, 0.00, 0.00, 35.00, -2.90},
-    {0.00, 0.00, 0.00, 35.40, -2.90},
-    {0.00, 0.00, 0.00, 35.80, -2.90},
-    {0.00, 0.00, 0.00, 36.20, -2.90},
-    {0.00, 0.00, 0.00, 36.60, -2.90},
-    {0.00, 0.00, 0.00, 37.00, -2.90},
-    {0.00, 0.00, 0.00, 37.40, -2.90},
-    {0.00, 0.00, 0.00, 37.80, -2.90},
-    {0.00, 0.00, 0.00, 38.20, -2.90},
-    {0.00, 0.00, 0.00, 38.60, -2.90},
-    {0.00, 0.00, 0.00, 39.00, -2.90},
-    {0.00, 0.00, 0.00, 39.40, -2.90},
-    {0.00, 0.00, 0.00, 39.80, -2.90},
-    {0.00, 0.00, 0.00, 40.20, -2.90},
-    {0.00, 0.00, 0.00, 40.60, -2.90},
-    {0.00, 0.00, 0.00, 41.00, -2.90},
-    {0.00, 0.00, 0.00, 41.40, -2.90},
-    {0.00, 0.00, 0.00, 41.80, -2.90},
-    {0.00, 0.00, 0.00, 42.20, -2.90},
-    {0.00, 0.00, 0.00, 42.60, -2.90},
-    {0.00, 0.00, 0.00, 43.00, -2.90},
-    {0.00, 0.00, 0.00, 43.40, -2.90},
-    {0.00, 0.00, 0.00, 43.80, -2.90},
-    {0.00, 0.00, 0.00, 44.20, -2.90},
-    {0.00, 0.00, 0.00, 44.60, -2.90},
-    {0.00, 0.00, 0.00, 45.00, -2.90},
-    {0.00, 0.00, 0.00, 45.40, -2.90},
-    {0.00, 0.00, 0.00, 45.80, -2.90},
-    {0.00, 0.00, 0.00, 46.20, -2.90},
-    {0.00, 0.00, 0.00, 46.60, -2.90},
-    {0.00, 0.00, 0.00, 47.00, -2.90},
-    {0.00, 0.00, 0.00, 47.40, -2.90},
-    {0.00, 0.00, 0.00, 47.80, -2.90},
-    {0.00, 0.00, 0.00, 48.20, -2.90},
-    {0.00, 0.00, 0.00, 48.60, -2.90},
-    {0.00, 0.00, 0.00, 49.00, -2.90},
-    {0.00, 0.00, 0.00, 49.40, -2.90},
-    {0.00, 0.00, 0.00, 49.80, -2.90},
-    {0.00, 0.00, 0.00, 50.20, -2.90},
-    {0.00, 0.00, 0.00, 50.60, -2.90},
-    {0.00, 0.00, 0.00, 51.00, -2.90},
-    {0.00, 0.00, 0.00, 51.40, -2.90},
-    {0.00, 0.00, 0.00, 51.80, -2.90},
-    {0.00, 0.00, 0.00, 52.20, -2.90},
-    {0.00, 0.00, 0.00, 52.60, -2.90},
-    {0.00, 0.00, 0.00, 53.00, -2.90},
-    {0.00, 0.00, 0.00, 53.40, -2.90},
-    {0.00, 0.00, 0.00, 53.80, -2.90},
-    {0.00, 0.00, 0.00, 54.20, -2.90},
-    {0.00, 0.00, 0.00, 54.60, -2.90},
-    {0.00, 0.00, 0.00, 55.00, -2.90},
-    {0.00, 0.00, 0.00, 55.40, -2.90},
-    {0.00, 0.00, 0.00, 55.80, -2.90},
-    {0.00, 0.00, 0.00, 56.20, -2.90},
-    {0.00, 0.00, 0.00, 56.60, -2.90},
-    {0.00, 0.00, 0.00, 57.00, -2.90},
-    {0.00, 0.00, 0.00, 57.40, -2.90},
-    {0.00, 0.00, 0.00, 57.80, -2.90},
-    {0.00, 0.00, 0.00, 58.20, -2.90},
-    {0.00, 0.00, 0.00, 58.60, -2.90},
-    {0.00, 0.00, 0.00, 59.00, -2.90},
-    {0.00, 0.00, 0.00, 59.40, -2.90},
-    {0.00, 0.00, 0.00, 59.80, -2.90},
-    {0.00, 0.00, 0.00, -59.80, -2.70},
-    {0.00, 0.00, 0.00, -59.40, -2.70},
-    {0.00, 0.00, 0.00, -59.00, -2.70},
-    {0.00, 0.00, 0.00, -58.60, -2.70},
-    {0.00, 0.00, 0.00, -58.20, -2.70},
-    {0.00, 0.00, 0.00, -57.80, -2.70},
-    {0.00, 0.00, 0.00, -57.40, -2.70},
-    {0.00, 0.00, 0.00, -57.00, -2.70},
-    {0.00, 0.00, 0.00, -56.60, -2.70},
-    {0.00, 0.00, 0.00, -56.20, -2.70},
-    {0.00, 0.00, 0.00, -55.80, -2.70},
-    {0.00, 0.00, 0.00, -55.40, -2.70},
-    {0.00, 0.00, 0.00, -55.00, -2.70},
-    {0.00, 0.00, 0.00, -54.60, -2.70},
-    {0.00, 0.00, 0.00, -54.20, -2.70},
-    {0.00, 0.00, 0.00, -53.80, -2.70},
-    {0.00, 0.00, 0.00, -53.40, -2.70},
-    {0.00, 0.00, 0.00, -53.00, -2.70},
-    {0.00, 0.00, 0.00, -52.60, -2.70},
-    {0.00, 0.00, 0.00, -52.20, -2.70},
-    {0.00, 0.00, 0.00, -51.80, -2.70},
-    {0.00, 0.00, 0.00, -51.40, -2.70},
-    {0.00, 0.00, 0.00, -51.00, -2.70},
-    {0.00, 0.00, 0.00, -50.60, -2.70},
-    {0.00, 0.00, 0.00, -50.20, -2.70},
-    {0.00, 0.00, 0.00, -49.80, -2.70},
-    {0.00, 0.00, 0.00, -49.40, -2.70},
-    {0.00, 0.00, 0.00, -49.00, -2.70},
-    {0.00, 0.00, 0.00, -48.60, -2.70},
-    {0.00, 0.00, 0.00, -48.20, -2.70},
-    {0.00, 0.00, 0.00, -47.80, -2.70},
-    {0.00, 0.00, 0.00, -47.40, -2.70},
-    {0.00, 0.00, 0.00, -47.00, -2.70},
-    {0.00, 0.00, 0.00, -46.60, -2.70},
-    {0.00, 0.00, 0.00, -46.20, -2.70},
-    {0.00, 0.00, 0.00, -45.80, -2.70},
-    {0.00, 0.00, 0.00, -45.40, -2.70},
-    {0.00, 0.00, 0.00, -45.00, -2.70},
-    {0.00, 0.00, 0.00, -44.60, -2.70},
-    {0.00, 0.00, 0.00, -44.20, -2.70},
-    {0.00, 0.00, 0.00, -43.80, -2.70},
-    {0.00, 0.00, 0.00, -43.40, -2.70},
-    {0.00, 0.00, 0.00, -43.00, -2.70},
-    {0.00, 0.00, 0.00, -42.60, -2.70},
-    {0.00, 0.00, 0.00, -42.20, -2.70},
-    {0.00, 0.00, 0.00, -41.80, -2.70},
-    {0.00, 0.00, 0.00, -41.40, -2.70},
-    {0.00, 0.00, 0.00, -41.00, -2.70},
-    {0.00, 0.00, 0.00, -40.60, -2.70},
-    {0.00, 0.00, 0.00, -40.20, -2.70},
-    {0.00, 0.00, 0.00, -39.80, -2.70},
-    {0.00, 0.00, 0.00, -39.40, -2.70},
-    {0.00, 0.00, 0.00, -39.00, -2.70},
-    {0.00, 0.00, 0.00, -38.60, -2.70},
-    {0.00, 0.00, 0.00, -38.20, -2.70},
-    {0.00, 0.00, 0.00, -37.80, -2.70},
-    {0.00, 0.00, 0.00, -37.40, -2.70},
-    {0.00, 0.00, 0.00, -37.00, -2.70},
-    {0.00, 0.00, 0.00, -36.60, -2.70},
-    {0.00, 0.00, 0.00, -36.20, -2.70},
-    {0.00, 0.00, 0.00, -35.80, -2.70},
-    {0.00, 0.00, 0.00, -35.40, -2.70},
-    {0.00, 0.00, 0.00, -35.00, -2.70},
-    {0.00, 0.00, 0.00, -34.60, -2.70},
-    {0.00, 0.00, 0.00, -34.20, -2.70},
-    {0.00, 0.00, 0.00, -33.80, -2.70},
-    {0.00, 0.00, 0.00, -33.40, -2.70},
-    {0.00, 0.00, 0.00, -33.00, -2.70},
-    {0.00, 0.00, 0.00, -32.60, -2.70},
-    {0.00, 0.00, 0.00, -32.20, -2.70},
-    {0.00, 0.00, 0.00, -31.80, -2.70},
-    {0.00, 0.00, 0.00, -31.40, -2.70},
-    {0.00, 0.00, 0.00, -31.00, -2.70},
-    {0.00, 0.00, 0.00, -30.60, -2.70},
-    {0.00, 0.00, 0.00, -30.20, -2.70},
-    {0.00, 0.00, 0.00, -29.80, -2.70},
-    {0.00, 0.00, 0.00, -29.40, -2.70},
-    {0.00, 0.00, 0.00, -29.00, -2.70},
-    {0.00, 0.00, 0.00, -28.60, -2.70},
-    {0.00, 0.00, 0.00, -28.20, -2.70},
-    {0.00, 0.00, 0.00, -27.80, -2.70},
-    {0.00, 0.00, 0.00, -27.40, -2.70},
-    {0.00, 0.00, 0.00, -27.00, -2.70},
-    {0.00, 0.00, 0.00, -26.60, -2.70},
-    {0.00, 0.00, 0.00, -26.20, -2.70},
-    {0.00, 0.00, 0.00, -25.80, -2.70},
-    {0.00, 0.00, 0.00, -25.40, -2.70},
-    {0.00, 0.00, 0.00, -25.00, -2.70},
-    {0.00, 0.00, 0.00, -24.60, -2.70},
-    {0.00, 0.00, 0.00, -24.20, -2.70},
-    {0.00, 0.00, 0.00, -23.80, -2.70},
-    {0.00, 0.00, 0.00, -23.40, -2.70},
-    {0.00, 0.00, 0.00, -23.00, -2.70},
-    {0.00, 0.00, 0.00, -22.60, -2.70},
-    {0.00, 0.00, 0.00, -22.20, -2.70},
-    {0.00, 0.00, 0.00, -21.80, -2.70},
-    {0.00, 0.00, 0.00, -21.40, -2.70},
-    {0.00, 0.00, 0.00, -21.00, -2.70},
-    {0.00, 0.00, 0.00, -20.60, -2.70},
-    {0.00, 0.00, 0.00, -20.20, -2.70},
-    {0.00, 0.00, 0.00, -19.80, -2.70},
-    {0.00, 0.00, 0.00, -19.40, -2.70},
-    {0.00, 0.00, 0.00, -19.00, -2.70},
-    {0.00, 0.00, 0.00, -18.60, -2.70},
-    {0.00, 0.00, 0.00, -18.20, -2.70},
-    {0.00, 0.00, 0.00, -17.80, -2.70},
-    {0.00, 0.00, 0.00, -17.40, -2.70},
-    {0.00, 0.00, 0.00, -17.00, -2.70},
-    {0.00, 0.00, 0.00, -16.60, -2.70},
-    {0.00, 0.00, 0.00, -16.20, -2.70},
-    {0.00, 0.00, 0.00, -15.80, -2.70},
-    {0.00, 0.00, 0.00, -15.40, -2.70},
-    {0.00, 0.00, 0.00, -15.00, -2.70},
-    {0.00, 0.00, 0.00, -14.60, -2.70},
-    {0.00, 0.00, 0.00, -14.20, -2.70},
-    {0.00, 0.00, 0.00, -13.80, -2.70},
-    {0.00, 0.00, 0.00, -13.40, -2.70},
-    {0.00, 0.00, 0.00, -13.00, -2.70},
-    {0.00, 0.00, 0.00, -12.60, -2.70},
-    {0.00, 0.00, 0.00, -12.20, -2.70},
-    {0.00, 0.00, 0.00, -11.80, -2.70},
-    {0.00, 0.00, 0.00, -11.40, -2.70},
-    {0.00, 0.00, 0.00, -11.00, -2.70},
-    {0.00, 0.00, 0.00, -10.60, -2.70},
-    {0.00, 0.00, 0.00, -10.20, -2.70},
-    {0.00, 0.00, 0.00, -9.80, -2.70},
-    {0.00, 0.00, 0.00, -9.40, -2.70},
-    {0.00, 0.00, 0.00, -9.00, -2.70},
-    {0.00, 0.00, 0.00, -8.60, -2.70},
-    {0.00, 0.00, 0.00, -8.20, -2.70},
-    {0.00, 0.00, 0.00, -7.80, -2.70},
-    {0.00, 0.00, 0.00, -7.40, -2.70},
-    {0.00, 0.00, 0.00, -7.00, -2.70},
-    {0.00, 0.00, 0.00, -6.60, -2.70},
-    {0.00, 0.00, 0.00, -6.20, -2.70},
-    {0.00, 0.00, 0.00, -5.80, -2.70},
-    {0.00, 0.00, 0.00, -5.40, -2.70},
-    {0.00, 0.00, 0.00, -5.00, -2.70},
-    {0.00, 0.00, 0.00, -4.60, -2.70},
-    {0.00, 0.00, 0.00, -4.20, -2.70},
-    {0.00, 0.00, 0.00, -3.80, -2.70},
-    {0.00, 0.00, 0.00, -3.40, -2.70},
-    {0.00, 0.00, 0.00, -3.00, -2.70},
-    {0.00, 0.00, 0.00, -2.60, -2.70},
-    {0.00, 0.00, 0.00, -2.20, -2.70},
-    {0.00, 0.00, 0.00, -1.80, -2.70},
-    {0.00, 0.00, 0.00, -1.40, -2.70},
-    {0.00, 0.00, 0.00, -1.00, -2.70},
-    {0.00, 0.00, 0.00, -0.60, -2.70},
-    {0.00, 0.00, 0.00, -0.20, -2.70},
-    {0.00, 0.00, 0.00, 0.20, -2.70},
-    {0.00, 0.00, 0.00, 0.60, -2.70},
-    {0.00, 0.00, 0.00, 1.00, -2.70},
-    {0.00, 0.00, 0.00, 1.40, -2.70},
-    {0.00, 0.00, 0.00, 1.80, -2.70},
-    {0.00, 0.00, 0.00, 2.20, -2.70},
-    {0.00, 0.00, 0.00, 2.60, -2.70},
-    {0.00, 0.00, 0.00, 3.00, -2.70},
-    {0.00, 0.00, 0.00, 3.40, -2.70},
-    {0.00, 0.00, 0.00, 3.80, -2.70},
-    {0.00, 0.00, 0.00, 4.20, -2.70},
-    {0.00, 0.00, 0.00, 4.60, -2.70},
-    {0.00, 0.00, 0.00, 5.00, -2.70},
-    {0.00, 0.00, 0.00, 5.40, -2.70},
-    {0.00, 0.00, 0.00, 5.80, -2.70},
-    {0.00, 0.00, 0.00, 6.20, -2.70},
-    {0.00, 0.00, 0.00, 6.60, -2.70},
-    {0.00, 0.00, 0.00, 7.00, -2.70},
-    {0.00, 0.00, 0.00, 7.40, -2.70},
-    {0.00, 0.00, 0.00, 7.80, -2.70},
-    {0.00, 0.00, 0.00, 8.20, -2.70},
-    {0.00, 0.00, 0.00, 8.60, -2.70},
-    {0.00, 0.00, 0.00, 9.00, -2.70},
-    {0.00, 0.00, 0.00, 9.40, -2.70},
-    {0.00, 0.00, 0.00, 9.80, -2.70},
-    {0.00, 0.00, 0.00, 10.20, -2.70},
-    {0.00, 0.00, 0.00, 10.60, -2.70},
-    {0.00, 0.00, 0.00, 11.00, -2.70},
-    {0.00, 0.00, 0.00, 11.40, -2.70},
-    {0.00, 0.00, 0.00, 11.80, -2.70},
-    {0.00, 0.00, 0.00, 12.20, -2.70},
-    {0.00, 0.00, 0.00, 12.60, -2.70},
-    {0.00, 0.00, 0.00, 13.00, -2.70},
-    {0.00, 0.00, 0.00, 13.40, -2.70},
-    {0.00, 0.00, 0.00, 13.80, -2.70},
-    {0.00, 0.00, 0.00, 14.20, -2.70},
-    {0.00, 0.00, 0.00, 14.60, -2.70},
-    {0.00, 0.00, 0.00, 15.00, -2.70},
-    {0.00, 0.00, 0.00, 15.40, -2.70},
-    {0.00, 0.00, 0.00, 15.80, -2.70},
-    {0.00, 0.00, 0.00, 16.20, -2.70},
-    {0.00, 0.00, 0.00, 16.60, -2.70},
-    {0.00, 0.00, 0.00, 17.00, -2.70},
-    {0.00, 0.00, 0.00, 17.40, -2.70},
-    {0.00, 0.00, 0.00, 17.80, -2.70},
-    {0.00, 0.00, 0.00, 18.20, -2.70},
-    {0.00, 0.00, 0.00, 18.60, -2.70},
-    {0.00, 0.00, 0.00, 19.00, -2.70},
-    {0.00, 0.00, 0.00, 19.40, -2.70},
-    {0.00, 0.00, 0.00, 19.80, -2.70},
-    {0.00, 0.00, 0.00, 20.20, -2.70},
-    {0.00, 0.00, 0.00, 20.60, -2.70},
-    {0.00, 0.00, 0.00, 21.00, -2.70},
-    {0.00, 0.00, 0.00, 21.40, -2.70},
-    {0.00, 0.00, 0.00, 21.80, -2.70},
-    {0.00, 0.00, 0.00, 22.20, -2.70},
-    {0.00, 0.00, 0.00, 22.60, -2.70},
-    {0.00, 0.00, 0.00, 23.00, -2.70},
-    {0.00, 0.00, 0.00, 23.40, -2.70},
-    {0.00, 0.00, 0.00, 23.80, -2.70},
-    {0.00, 0.00, 0.00, 24.20, -2.70},
-    {0.00, 0.00, 0.00, 24.60, -2.70},
-    {0.00, 0.00, 0.00, 25.00, -2.70},
-    {0.00, 0.00, 0.00, 25.40, -2.70},
-    {0.00, 0.00, 0.00, 25.80, -2.70},
-    {0.00, 0.00, 0.00, 26.20, -2.70},
-    {0.00, 0.00, 0.00, 26.60, -2.70},
-    {0.00, 0.00, 0.00, 27.00, -2.70},
-    {0.00, 0.00, 0.00, 27.40, -2.70},
-    {0.00, 0.00, 0.00, 27.80, -2.70},
-    {0.00, 0.00, 0.00, 28.20, -2.70},
-    {0.00, 0.00, 0.00, 28.60, -2.70},
-    {0.00, 0.00, 0.00, 29.00, -2.70},
-    {0.00, 0.00, 0.00, 29.40, -2.70},
-    {0.00, 0.00, 0.00, 29.80, -2.70},
-    {0.00, 0.00, 0.00, 30.20, -2.70},
-    {0.00, 0.00, 0.00, 30.60, -2.70},
-    {0.00, 0.00, 0.00, 31.00, -2.70},
-    {0.00, 0.00, 0.00, 31.40, -2.70},
-    {0.00, 0.00, 0.00, 31.80, -2.70},
-    {0.00, 0.00, 0.00, 32.20, -2.70},
-    {0.00, 0.00, 0.00, 32.60, -2.70},
-    {0.00, 0.00, 0.00, 33.00, -2.70},
-    {0.00, 0.00, 0.00, 33.40, -2.70},
-    {0.00, 0.00, 0.00, 33.80, -2.70},
-    {0.00, 0.00, 0.00, 34.20, -2.70},
-    {0.00, 0.00, 0.00, 34.60, -2.70},
-    {0.00, 0.00, 0.00, 35.00, -2.70},
-    {0.00, 0.00, 0.00, 35.40, -2.70},
-    {0.00, 0.00, 0.00, 35.80, -2.70},
-    {0.00, 0.00, 0.00, 36.20, -2.70},
-    {0.00, 0.00, 0.00, 36.60, -2.70},
-    {0.00, 0.00, 0.00, 37.00, -2.70},
-    {0.00, 0.00, 0.00, 37.40, -2.70},
-    {0.00, 0.00, 0.00, 37.80, -2.70},
-    {0.00, 0.00, 0.00, 38.20, -2.70},
-    {0.00, 0.00, 0.00, 38.60, -2.70},
-    {0.00, 0.00, 0.00, 39.00, -2.70},
-    {0.00, 0.00, 0.00, 39.40, -2.70},
-    {0.00, 0.00, 0.00, 39.80, -2.70},
-    {0.00, 0.00, 0.00, 40.20, -2.70},
-    {0.00, 0.00, 0.00, 40.60, -2.70},
-    {0.00, 0.00, 0.00, 41.00, -2.70},
-    {0.00, 0.00, 0.00, 41.40, -2.70},
-    {0.00, 0.00, 0.00, 41.80, -2.70},
-    {0.00, 0.00, 0.00, 42.20, -2.70},
-    {0.00, 0.00, 0.00, 42.60, -2.70},
-    {0.00, 0.00, 0.00, 43.00, -2.70},
-    {0.00, 0.00, 0.00, 43.40, -2.70},
-    {0.00, 0.00, 0.00, 43.80, -2.70},
-    {0.00, 0.00, 0.00, 44.20, -2.70},
-    {0.00, 0.00, 0.00, 44.60, -2.70},
-    {0.00, 0.00, 0.00, 45.00, -2.70},
-    {0.00, 0.00, 0.00, 45.40, -2.70},
-    {0.00, 0.00, 0.00, 45.80, -2.70},
-    {0.00, 0.00, 0.00, 46.20, -2.70},
-    {0.00, 0.00, 0.00, 46.60, -2.70},
-    {0.00, 0.00, 0.00, 47.00, -2.70},
-    {0.00, 0.00, 0.00, 47.40, -2.70},
-    {0.00, 0.00, 0.00, 47.80, -2.70},
-    {0.00, 0.00, 0.00, 48.20, -2.70},
-    {0.00, 0.00, 0.00, 48.60, -2.70},
-    {0.00, 0.00, 0.00, 49.00, -2.70},
-    {0.00, 0.00, 0.00, 49.40, -2.70},
-    {0.00, 0.00, 0.00, 49.80, -2.70},
-    {0.00, 0.00, 0.00, 50.20, -2.70},
-    {0.00, 0.00, 0.00, 50.60, -2.70},
-    {0.00, 0.00, 0.00, 51.00, -2.70},
-    {0.00, 0.00, 0.00, 51.40, -2.70},
-    {0.00, 0.00, 0.00, 51.80, -2.70},
-    {0.00, 0.00, 0.00, 52.20, -2.70},
-    {0.00, 0.00, 0.00, 52.60, -2.70},
-    {0.00, 0.00, 0.00, 53.00, -2.70},
-    {0.00, 0.00, 0.00, 53.40, -2.70},
-    {0.00, 0.00, 0.00, 53.80, -2.70},
-    {0.00, 0.00, 0.00, 54.20, -2.70},
-    {0.00, 0.00, 0.00, 54.60, -2.70},
-    {0.00, 0.00, 0.00, 55.00, -2.70},
-    {0.00, 0.00, 0.00, 55.40, -2.70},
-    {0.00, 0.00, 0.00, 55.80, -2.70},
-    {0.00, 0.00, 0.00, 56.20, -2.70},
-    {0.00, 0.00, 0.00, 56.60, -2.70},
-    {0.00, 0.00, 0.00, 57.00, -2.70},
-    {0.00, 0.00, 0.00, 57.40, -2.70},
-    {0.00, 0.00, 0.00, 57.80, -2.70},
-    {0.00, 0.00, 0.00, 58.20, -2.70},
-    {0.00, 0.00, 0.00, 58.60, -2.70},
-    {0.00, 0.00, 0.00, 59.00, -2.70},
-    {0.00, 0.00, 0.00, 59.40, -2.70},
-    {0.00, 0.00, 0.00, 59.80, -2.70},
-    {0.00, 0.00, 0.00, -59.80, -2.50},
-    {0.00, 0.00, 0.00, -59.40, -2.50},
-    {0.00, 0.00, 0.00, -59.00, -2.50},
-    {0.00, 0.00, 0.00, -58.60, -2.50},
-    {0.00, 0.00, 0.00, -58.20, -2.50},
-    {0.00, 0.00, 0.00, -57.80, -2.50},
-    {0.00, 0.00, 0.00, -57.40, -2.50},
-    {0.00, 0.00, 0.00, -57.00, -2.50},
-    {0.00, 0.00, 0.00, -56.60, -2.50},
-    {0.00, 0.00, 0.00, -56.20, -2.50},
-    {0.00, 0.00, 0.00, -55.80, -2.50},
-    {0.00, 0.00, 0.00, -55.40, -2.50},
-    {0.00, 0.00, 0.00, -55.00, -2.50},
-    {0.00, 0.00, 0.00, -54.60, -2.50},
-    {0.00, 0.00, 0.00, -54.20, -2.50},
-    {0.00, 0.00, 0.00, -53.80, -2.50},
-    {0.00, 0.00, 0.00, -53.40, -2.50},
-    {0.00, 0.00, 0.00, -53.00, -2.50},
-    {0.00, 0.00, 0.00, -52.60, -2.50},
-    {0.00, 0.00, 0.00, -52.20, -2.50},
-    {0.00, 0.00, 0.00, -51.80, -2.50},
-    {0.00, 0.00, 0.00, -51.40, -2.50},
-    {0.00, 0.00, 0.00, -51.00, -2.50},
-    {0.00, 0.00, 0.00, -50.60, -2.50},
-    {0.00, 0.00, 0.00, -50.20, -2.50},
-    {0.00, 0.00, 0.00, -49.80, -2.50},
-    {0.00, 0.00, 0.00, -49.40, -2.50},
-    {0.00, 0.00, 0.00, -49.00, -2.50},
-    {0.00, 0.00, 0.00, -48.60, -2.50},
-    {0.00, 0.00, 0.00, -48.20, -2.50},
-    {0.00, 0.00, 0.00, -47.80, -2.50},
-    {0.00, 0.00, 0.00, -47.40, -2.50},
-    {0.00, 0.00, 0.00, -47.00, -2.50},
-    {0.00, 0.00, 0.00, -46.60, -2.50},
-    {0.00, 0.00, 0.00, -46.20, -2.50},
-    {0.00, 0.00, 0.00, -45.80, -2.50},
-    {0.00, 0.00, 0.00, -45.40, -2.50},
-    {0.00, 0.00, 0.00, -45.00, -2.50},
-    {0.00, 0.00, 0.00, -44.60, -2.50},
-    {0.00, 0.00, 0.00, -44.20, -2.50},
-    {0.00, 0.00, 0.00, -43.80, -2.50},
-    {0.00, 0.00, 0.00, -43.40, -2.50},
-    {0.00, 0.00, 0.00, -43.00, -2.50},
-    {0.00, 0.00, 0.00, -42.60, -2.50},
-    {0.00, 0.00, 0.00, -42.20, -2.50},
-    {0.00, 0.00, 0.00, -41.80, -2.50},
-    {0.00, 0.00, 0.00, -41.40, -2.50},
-    {0.00, 0.00, 0.00, -41.00, -2.50},
-    {0.00, 0.00, 0.00, -40.60, -2.50},
-    {0.00, 0.00, 0.00, -40.20, -2.50},
-    {0.00, 0.00, 0.00, -39.80, -2.50},
-    {0.00, 0.00, 0.00, -39.40, -2.50},
-    {0.00, 0.00, 0.00, -39.00, -2.50},
-    {0.00, 0.00, 0.00, -38.60, -2.50},
-    {0.00, 0.00, 0.00, -38.20, -2.50},
-    {0.00, 0.00, 0.00, -37.80, -2.50},
-    {0.00, 0.00, 0.00, -37.40, -2.50},
-    {0.00, 0.00, 0.00, -37.00, -2.50},
-    {0.00, 0.00, 0.00, -36.60, -2.50},
-    {0.00, 0.00, 0.00, -36.20, -2.50},
-    {0.00, 0.00, 0.00, -35.80, -2.50},
-    {0.00, 0.00, 0.00, -35.40, -2.50},
-    {0.00, 0.00, 0.00, -35.00, -2.50},
-    {0.00, 0.00, 0.00, -34.60, -2.50},
-    {0.00, 0.00, 0.00, -34.20, -2.50},
-    {0.00, 0.00, 0.00, -33.80, -2.50},
-    {0.00, 0.00, 0.00, -33.40, -2.50},
-    {0.00, 0.00, 0.00, -33.00, -2.50},
-    {0.00, 0.00, 0.00, -32.60, -2.50},
-    {0.00, 0.00, 0.00, -32.20, -2.50},
-    {0.00, 0.00, 0.00, -31.80, -2.50},
-    {0.00, 0.00, 0.00, -31.40, -2.50},
-    {0.00, 0.00, 0.00, -31.00, -2.50},
-    {0.00, 0.00, 0.00, -30.60, -2.50},
-    {0.00, 0.00, 0.00, -30.20, -2.50},
-    {0.00, 0.00, 0.00, -29.80, -2.50},
-    {0.00, 0.00, 0.00, -29.40, -2.50},
-    {0.00, 0.00, 0.00, -29.00, -2.50},
-    {0.00, 0.00, 0.00, -28.60, -2.50},
-    {0.00, 0.00, 0.00, -28.20, -2.50},
-    {0.00, 0.00, 0.00, -27.80, -2.50},
-    {0.00, 0.00, 0.00, -27.40, -2.50},
-    {0.00, 0.00, 0.00, -27.00, -2.50},
-    {0.00, 0.00, 0.00, -26.60, -2.50},
-    {0.00, 0.00, 0.00, -26.20, -2.50},
-    {0.00, 0.00, 0.00, -25.80, -2.50},
-    {0.00, 0.00, 0.00, -25.40, -2.50},
-    {0.00, 0.00, 0.00, -25.00, -2.50},
-    {0.00, 0.00, 0.00, -24.60, -2.50},
-    {0.00, 0.00, 0.00, -24.20, -2.50},
-    {0.00, 0.00, 0.00, -23.80, -2.50},
-    {0.00, 0.00, 0.00, -23.40, -2.50},
-    {0.00, 0.00, 0.00, -23.00, -2.50},
-    {0.00, 0.00, 0.00, -22.60, -2.50},
-    {0.00, 0.00, 0.00, -22.20, -2.50},
-    {0.00, 0.00, 0.00, -21.80, -2.50},
-    {0.00, 0.00, 0.00, -21.40, -2.50},
-    {0.00, 0.00, 0.00, -21.00, -2.50},
-    {0.00, 0.00, 0.00, -20.60, -2.50},
-    {0.00, 0.00, 0.00, -20.20, -2.50},
-    {0.00, 0.00, 0.00, -19.80, -2.50},
-    {0.00, 0.00, 0.00, -19.40, -2.50},
-    {0.00, 0.00, 0.00, -19.00, -2.50},
-    {0.00, 0.00, 0.00, -18.60, -2.50},
-    {0.00, 0.00, 0.00, -18.20, -2.50},
-    {0.00, 0.00, 0.00, -17.80, -2.50},
-    {0.00, 0.00, 0.00, -17.40, -2.50},
-    {0.00, 0.00, 0.00, -17.00, -2.50},
-    {0.00, 0.00, 0.00, -16.60, -2.50},
-    {0.00, 0.00, 0.00, -16.20, -2.50},
-    {0.00, 0.00, 0.00, -15.80, -2.50},
-    {0.00, 0.00, 0.00, -15.40, -2.50},
-    {0.00, 0.00, 0.00, -15.00, -2.50},
-    {0.00, 0.00, 0.00, -14.60, -2.50},
-    {0.00, 0.00, 0.00, -14.20, -2.50},
-    {0.00, 0.00, 0.00, -13.80, -2.50},
-    {0.00, 0.00, 0.00, -13.40, -2.50},
-    {0.00, 0.00, 0.00, -13.00, -2.50},
-    {0.00, 0.00, 0.00, -12.60, -2.50},
-    {0.00, 0.00, 0.00, -12.20, -2.50},
-    {0.00, 0.00, 0.00, -11.80, -2.50},
-    {0.00, 0.00, 0.00, -11.40, -2.50},
-    {0.00, 0.00, 0.00, -11.00, -2.50},
-    {0.00, 0.00, 0.00, -10.60, -2.50},
-    {0.00, 0.00, 0.00, -10.20, -2.50},
-    {0.00, 0.00, 0.00, -9.80, -2.50},
-    {0.00, 0.00, 0.00, -9.40, -2.50},
-    {0.00, 0.00, 0.00, -9.00, -2.50},
-    {0.00, 0.00, 0.00, -8.60, -2.50},
-    {0.00, 0.00, 0.00, -8.20, -2.50},
-    {0.00, 0.00, 0.00, -7.80, -2.50},
-    {0.00, 0.00, 0.00, -7.40, -2.50},
-    {0.00, 0.00, 0.00, -7.00, -2.50},
-    {0.00, 0.00, 0.00, -6.60, -2.50},
-    {0.00, 0.00, 0.00, -6.20, -2.50},
-    {0.00, 0.00, 0.00, -5.80, -2.50},
-    {0.00, 0.00, 0.00, -5.40, -2.50},
-    {0.00, 0.00, 0.00, -5.00, -2.50},
-    {0.00, 0.00, 0.00, -4.60, -2.50},
-    {0.00, 0.00, 0.00, -4.20, -2.50},
-    {0.00, 0.00, 0.00, -3.80, -2.50},
-    {0.00, 0.00, 0.00, -3.40, -2.50},
-    {0.00, 0.00, 0.00, -3.00, -2.50},
-    {0.00, 0.00, 0.00, -2.60, -2.50},
-    {0.00, 0.00, 0.00, -2.20, -2.50},
-    {0.00, 0.00, 0.00, -1.80, -2.50},
-    {0.00, 0.00, 0.00, -1.40, -2.50},
-    {0.00, 0.00, 0.00, -1.00, -2.50},
-    {0.00, 0.00, 0.00, -0.60, -2.50},
-    {0.00, 0.00, 0.00, -0.20, -2.50},
-    {0.00, 0.00, 0.00, 0.20, -2.50},
-    {0.00, 0.00, 0.00, 0.60, -2.50},
-    {0.00, 0.00, 0.00, 1.00, -2.50},
-    {0.00, 0.00, 0.00, 1.40, -2.50},
-    {0.00, 0.00, 0.00, 1.80, -2.50},
-    {0.00, 0.00, 0.00, 2.20, -2.50},
-    {0.00, 0.00, 0.00, 2.60, -2.50},
-    {0.00, 0.00, 0.00, 3.00, -2.50},
-    {0.00, 0.00, 0.00, 3.40, -2.50},
-    {0.00, 0.00, 0.00, 3.80, -2.50},
-    {0.00, 0.00, 0.00, 4.20, -2.50},
-    {0.00, 0.00, 0.00, 4.60, -2.50},
-    {0.00, 0.00, 0.00, 5.00, -2.50},
-    {0.00, 0.00, 0.00, 5.40, -2.50},
-    {0.00, 0.00, 0.00, 5.80, -2.50},
-    {0.00, 0.00, 0.00, 6.20, -2.50},
-    {0.00, 0.00, 0.00, 6.60, -2.50},
-    {0.00, 0.00, 0.00, 7.00, -2.50},
-    {0.00, 0.00, 0.00, 7.40, -2.50},
-    {0.00, 0.00, 0.00, 7.80, -2.50},
-    {0.00, 0.00, 0.00, 8.20, -2.50},
-    {0.00, 0.00, 0.00, 8.60, -2.50},
-    {0.00, 0.00, 0.00, 9.00, -2.50},
-    {0.00, 0.00, 0.00, 9.40, -2.50},
-    {0.00, 0.00, 0.00, 9.80, -2.50},
-    {0.00, 0.00, 0.00, 10.20, -2.50},
-    {0.00, 0.00, 0.00, 10.60, -2.50},
-    {0.00, 0.00, 0.00, 11.00, -2.50},
-    {0.00, 0.00, 0.00, 11.40, -2.50},
-    {0.00, 0.00, 0.00, 11.80, -2.50},
-    {0.00, 0.00, 0.00, 12.20, -2.50},
-    {0.00, 0.00, 0.00, 12.60, -2.50},
-    {0.00, 0.00, 0.00, 13.00, -2.50},
-    {0.00, 0.00, 0.00, 13.40, -2.50},
-    {0.00, 0.00, 0.00, 13.80, -2.50},
-    {0.00, 0.00, 0.00, 14.20, -2.50},
-    {0.00, 0.00, 0.00, 14.60, -2.50},
-    {0.00, 0.00, 0.00, 15.00, -2.50},
-    {0.00, 0.00, 0.00, 15.40, -2.50},
-    {0.00, 0.00, 0.00, 15.80, -2.50},
-    {0.00, 0.00, 0.00, 16.20, -2.50},
-    {0.00, 0.00, 0.00, 16.60, -2.50},
-    {0.00, 0.00, 0.00, 17.00, -2.50},
-    {0.00, 0.00, 0.00, 17.40, -2.50},
-    {0.00, 0.00, 0.00, 17.80, -2.50},
-    {0.00, 0.00, 0.00, 18.20, -2.50},
-    {0.00, 0.00, 0.00, 18.60, -2.50},
-    {0.00, 0.00, 0.00, 19.00, -2.50},
-    {0.00, 0.00, 0.00, 19.40, -2.50},
-    {0.00, 0.00, 0.00, 19.80, -2.50},
-    {0.00, 0.00, 0.00, 20.20, -2.50},
-    {0.00, 0.00, 0.00, 20.60, -2.50},
-    {0.00, 0.00, 0.00, 21.00, -2.50},
-    {0.00, 0.00, 0.00, 21.40, -2.50},
-    {0.00, 0.00, 0.00, 21.80, -2.50},
-    {0.00, 0.00, 0.00, 22.20, -2.50},
-    {0.00, 0.00, 0.00, 22.60, -2.50},
-    {0.00, 0.00, 0.00, 23.00, -2.50},
-    {0.00, 0.00, 0.00, 23.40, -2.50},
-    {0.00, 0.00, 0.00, 23.80, -2.50},
-    {0.00, 0.00, 0.00, 24.20, -2.50},
-    {0.00, 0.00, 0.00, 24.60, -2.50},
-    {0.00, 0.00, 0.00, 25.00, -2.50},
-    {0.00, 0.00, 0.00, 25.40, -2.50},
-    {0.00, 0.00, 0.00, 25.80, -2.50},
-    {0.00, 0.00, 0.00, 26.20, -2.50},
-    {0.00, 0.00, 0.00, 26.60, -2.50},
-    {0.00, 0.00, 0.00, 27.00, -2.50},
-    {0.00, 0.00, 0.00, 27.40, -2.50},
-    {0.00, 0.00, 0.00, 27.80, -2.50},
-    {0.00, 0.00, 0.00, 28.20, -2.50},
-    {0.00, 0.00, 0.00, 28.60, -2.50},
-    {0.00, 0.00, 0.00, 29.00, -2.50},
-    {0.00, 0.00, 0.00, 29.40, -2.50},
-    {0.00, 0.00, 0.00, 29.80, -2.50},
-    {0.00, 0.00, 0.00, 30.20, -2.50},
-    {0.00, 0.00, 0.00, 30.60, -2.50},
-    {0.00, 0.00, 0.00, 31.00, -2.50},
-    {0.00, 0.00, 0.00, 31.40, -2.50},
-    {0.00, 0.00, 0.00, 31.80, -2.50},
-    {0.00, 0.00, 0.00, 32.20, -2.50},
-    {0.00, 0.00, 0.00, 32.60, -2.50},
-    {0.00, 0.00, 0.00, 33.00, -2.50},
-    {0.00, 0.00, 0.00, 33.40, -2.50},
-    {0.00, 0.00, 0.00, 33.80, -2.50},
-    {0.00, 0.00, 0.00, 34.20, -2.50},
-    {0.00, 0.00, 0.00, 34.60, -2.50},
-    {0.00, 0.00, 0.00, 35.00, -2.50},
-    {0.00, 0.00, 0.00, 35.40, -2.50},
-    {0.00, 0.00, 0.00, 35.80, -2.50},
-    {0.00, 0.00, 0.00, 36.20, -2.50},
-    {0.00, 0.00, 0.00, 36.60, -2.50},
-    {0.00, 0.00, 0.00, 37.00, -2.50},
-    {0.00, 0.00, 0.00, 37.40, -2.50},
-    {0.00, 0.00, 0.00, 37.80, -2.50},
-    {0.00, 0.00, 0.00, 38.20, -2.50},
-    {0.00, 0.00, 0.00, 38.60, -2.50},
-    {0.00, 0.00, 0.00, 39.00, -2.50},
-    {0.00, 0.00, 0.00, 39.40, -2.50},
-    {0.00, 0.00, 0.00, 39.80, -2.50},
-    {0.00, 0.00, 0.00, 40.20, -2.50},
-    {0.00, 0.00, 0.00, 40.60, -2.50},
-    {0.00, 0.00, 0.00, 41.00, -2.50},
-    {0.00, 0.00, 0.00, 41.40, -2.50},
-    {0.00, 0.00, 0.00, 41.80, -2.50},
-    {0.00, 0.00, 0.00, 42.20, -2.50},
-    {0.00, 0.00, 0.00, 42.60, -2.50},
-    {0.00, 0.00, 0.00, 43.00, -2.50},
-    {0.00, 0.00, 0.00, 43.40, -2.50},
-    {0.00, 0.00, 0.00, 43.80, -2.50},
-    {0.00, 0.00, 0.00, 44.20, -2.50},
-    {0.00, 0.00, 0.00, 44.60, -2.50},
-    {0.00, 0.00, 0.00, 45.00, -2.50},
-    {0.00, 0.00, 0.00, 45.40, -2.50},
-    {0.00, 0.00, 0.00, 45.80, -2.50},
-    {0.00, 0.00, 0.00, 46.20, -2.50},
-    {0.00, 0.00, 0.00, 46.60, -2.50},
-    {0.00, 0.00, 0.00, 47.00, -2.50},
-    {0.00, 0.00, 0.00, 47.40, -2.50},
-    {0.00, 0.00, 0.00, 47.80, -2.50},
-    {0.00, 0.00, 0.00, 48.20, -2.50},
-    {0.00, 0.00, 0.00, 48.60, -2.50},
-    {0.00, 0.00, 0.00, 49.00, -2.50},
-    {0.00, 0.00, 0.00, 49.40, -2.50},
-    {0.00, 0.00, 0.00, 49.80, -2.50},
-    {0.00, 0.00, 0.00, 50.20, -2.50},
-    {0.00, 0.00, 0.00, 50.60, -2.50},
-    {0.00, 0.00, 0.00, 51.00, -2.50},
-    {0.00, 0.00, 0.00, 51.40, -2.50},
-    {0.00, 0.00, 0.00, 51.80, -2.50},
-    {0.00, 0.00, 0.00, 52.20, -2.50},
-    {0.00, 0.00, 0.00, 52.60, -2.50},
-    {0.00, 0.00, 0.00, 53.00, -2.50},
-    {0.00, 0.00, 0.00, 53.40, -2.50},
-    {0.00, 0.00, 0.00, 53.80, -2.50},
-    {0.00, 0.00, 0.00, 54.20, -2.50},
-    {0.00, 0.00, 0.00, 54.60, -2.50},
-    {0.00, 0.00, 0.00, 55.00, -2.50},
-    {0.00, 0.00, 0.00, 55.40, -2.50},
-    {0.00, 0.00, 0.00, 55.80, -2.50},
-    {0.00, 0.00, 0.00, 56.20, -2.50},
-    {0.00, 0.00, 0.00, 56.60, -2.50},
-    {0.00, 0.00, 0.00, 57.00, -2.50},
-    {0.00, 0.00, 0.00, 57.40, -2.50},
-    {0.00, 0.00, 0.00, 57.80, -2.50},
-    {0.00, 0.00, 0.00, 58.20, -2.50},
-    {0.00, 0.00, 0.00, 58.60, -2.50},
-    {0.00, 0.00, 0.00, 59.00, -2.50},
-    {0.00, 0.00, 0.00, 59.40, -2.50},
-    {0.00, 0.00, 0.00, 59.80, -2.50},
-    {0.00, 0.00, 0.00, -59.80, -2.30},
-    {0.00, 0.00, 0.00, -59.40, -2.30},
-    {0.00, 0.00, 0.00, -59.00, -2.30},
-    {0.00, 0.00, 0.00, -58.60, -2.30},
-    {0.00, 0.00, 0.00, -58.20, -2.30},
-    {0.00, 0.00, 0.00, -57.80, -2.30},
-    {0.00, 0.00, 0.00, -57.40, -2.30},
-    {0.00, 0.00, 0.00, -57.00, -2.30},
-    {0.00, 0.00, 0.00, -56.60, -2.30},
-    {0.00, 0.00, 0.00, -56.20, -2.30},
-    {0.00, 0.00, 0.00, -55.80, -2.30},
-    {0.00, 0.00, 0.00, -55.40, -2.30},
-    {0.00, 0.00, 0.00, -55.00, -2.30},
-    {0.00, 0.00, 0.00, -54.60, -2.30},
-    {0.00, 0.00, 0.00, -54.20, -2.30},
-    {0.00, 0.00, 0.00, -53.80, -2.30},
-    {0.00, 0.00, 0.00, -53.40, -2.30},
-    {0.00, 0.00, 0.00, -53.00, -2.30},
-    {0.00, 0.00, 0.00, -52.60, -2.30},
-    {0.00, 0.00, 0.00, -52.20, -2.30},
-    {0.00, 0.00, 0.00, -51.80, -2.30},
-    {0.00, 0.00, 0.00, -51.40, -2.30},
-    {0.00, 0.00, 0.00, -51.00, -2.30},
-    {0.00, 0.00, 0.00, -50.60, -2.30},
-    {0.00, 0.00, 0.00, -50.20, -2.30},
-    {0.00, 0.00, 0.00, -49.80, -2.30},
-    {0.00, 0.00, 0.00, -49.40, -2.30},
-    {0.00, 0.00, 0.00, -49.00, -2.30},
-    {0.00, 0.00, 0.00, -48.60, -2.30},
-    {0.00, 0.00, 0.00, -48.20, -2.30},
-    {0.00, 0.00, 0.00, -47.80, -2.30},
-    {0.00, 0.00, 0.00, -47.40, -2.30},
-    {0.00, 0.00, 0.00, -47.00, -2.30},
-    {0.00, 0.00, 0.00, -46.60, -2.30},
-    {0.00, 0.00, 0.00, -46.20, -2.30},
-    {0.00, 0.00, 0.00, -45.80, -2.30},
-    {0.00, 0.00, 0.00, -45.40, -2.30},
-    {0.00, 0.00, 0.00, -45.00, -2.30},
-    {0.00, 0.00, 0.00, -44.60, -2.30},
-    {0.00, 0.00, 0.00, -44.20, -2.30},
-    {0.00, 0.00, 0.00, -43.80, -2.30},
-    {0.00, 0.00, 0.00, -43.40, -2.30},
-    {0.00, 0.00, 0.00, -43.00, -2.30},
-    {0.00, 0.00, 0.00, -42.60, -2.30},
-    {0.00, 0.00, 0.00, -42.20, -2.30},
-    {0.00, 0.00, 0.00, -41.80, -2.30},
-    {0.00, 0.00, 0.00, -41.40, -2.30},
-    {0.00, 0.00, 0.00, -41.00, -2.30},
-    {0.00, 0.00, 0.00, -40.60, -2.30},
-    {0.00, 0.00, 0.00, -40.20, -2.30},
-    {0.00, 0.00, 0.00, -39.80, -2.30},
-    {0.00, 0.00, 0.00, -39.40, -2.30},
-    {0.00, 0.00, 0.00, -39.00, -2.30},
-    {0.00, 0.00, 0.00, -38.60, -2.30},
-    {0.00, 0.00, 0.00, -38.20, -2.30},
-    {0.00, 0.00, 0.00, -37.80, -2.30},
-    {0.00, 0.00, 0.00, -37.40, -2.30},
-    {0.00, 0.00, 0.00, -37.00, -2.30},
-    {0.00, 0.00, 0.00, -36.60, -2.30},
-    {0.00, 0.00, 0.00, -36.20, -2.30},
-    {0.00, 0.00, 0.00, -35.80, -2.30},
-    {0.00, 0.00, 0.00, -35.40, -2.30},
-    {0.00, 0.00, 0.00, -35.00, -2.30},
-    {0.00, 0.00, 0.00, -34.60, -2.30},
-    {0.00, 0.00, 0.00, -34.20, -2.30},
-    {0.00, 0.00, 0.00, -33.80, -2.30},
-    {0.00, 0.00, 0.00, -33.40, -2.30},
-    {0.00, 0.00, 0.00, -33.00, -2.30},
-    {0.00, 0.00, 0.00, -32.60, -2.30},
-    {0.00, 0.00, 0.00, -32.20, -2.30},
-    {0.00, 0.00, 0.00, -31.80, -2.30},
-    {0.00, 0.00, 0.00, -31.40, -2.30},
-    {0.00, 0.00, 0.00, -31.00, -2.30},
-    {0.00, 0.00, 0.00, -30.60, -2.30},
-    {0.00, 0.00, 0.00, -30.20, -2.30},
-    {0.00, 0.00, 0.00, -29.80, -2.30},
-    {0.00, 0.00, 0.00, -29.40, -2.30},
-    {0.00, 0.00, 0.00, -29.00, -2.30},
-    {0.00, 0.00, 0.00, -28.60, -2.30},
-    {0.00, 0.00, 0.00, -28.20, -2.30},
-    {0.00, 0.00, 0.00, -27.80, -2.30},
-    {0.00, 0.00, 0.00, -27.40, -2.30},
-    {0.00, 0.00, 0.00, -27.00, -2.30},
-    {0.00, 0.00, 0.00, -26.60, -2.30},
-    {0.00, 0.00, 0.00, -26.20, -2.30},
-    {0.00, 0.00, 0.00, -25.80, -2.30},
-    {0.00, 0.00, 0.00, -25.40, -2.30},
-    {0.00, 0.00, 0.00, -25.00, -2.30},
-    {0.00, 0.00, 0.00, -24.60, -2.30},
-    {0.00, 0.00, 0.00, -24.20, -2.30},
-    {0.00, 0.00, 0.00, -23.80, -2.30},
-    {0.00, 0.00, 0.00, -23.40, -2.30},
-    {0.00, 0.00, 0.00, -23.00, -2.30},
-    {0.00, 0.00, 0.00, -22.60, -2.30},
-    {0.00, 0.00, 0.00, -22.20, -2.30},
-    {0.00, 0.00, 0.00, -21.80, -2.30},
-    {0.00, 0.00, 0.00, -21.40, -2.30},
-    {0.00, 0.00, 0.00, -21.00, -2.30},
-    {0.00, 0.00, 0.00, -20.60, -2.30},
-    {0.00, 0.00, 0.00, -20.20, -2.30},
-    {0.00, 0.00, 0.00, -19.80, -2.30},
-    {0.00, 0.00, 0.00, -19.40, -2.30},
-    {0.00, 0.00, 0.00, -19.00, -2.30},
-    {0.00, 0.00, 0.00, -18.60, -2.30},
-    {0.00, 0.00, 0.00, -18.20, -2.30},
-    {0.00, 0.00, 0.00, -17.80, -2.30},
-    {0.00, 0.00, 0.00, -17.40, -2.30},
-    {0.00, 0.00, 0.00, -17.00, -2.30},
-    {0.00, 0.00, 0.00, -16.60, -2.30},
-    {0.00, 0.00, 0.00, -16.20, -2.30},
-    {0.00, 0.00, 0.00, -15.80, -2.30},
-    {0.00, 0.00, 0.00, -15.40, -2.30},
-    {0.00, 0.00, 0.00, -15.00, -2.30},
-    {0.00, 0.00, 0.00, -14.60, -2.30},
-    {0.00, 0.00, 0.00, -14.20, -2.30},
-    {0.00, 0.00, 0.00, -13.80, -2.30},
-    {0.00, 0.00, 0.00, -13.40, -2.30},
-    {0.00, 0.00, 0.00, -13.00, -2.30},
-    {0.00, 0.00, 0.00, -12.60, -2.30},
-    {0.00, 0.00, 0.00, -12.20, -2.30},
-    {0.00, 0.00, 0.00, -11.80, -2.30},
-    {0.00, 0.00, 0.00, -11.40, -2.30},
-    {0.00, 0.00, 0.00, -11.00, -2.30},
-    {0.00, 0.00, 0.00, -10.60, -2.30},
-    {0.00, 0.00, 0.00, -10.20, -2.30},
-    {0.00, 0.00, 0.00, -9.80, -2.30},
-    {0.00, 0.00, 0.00, -9.40, -2.30},
-    {0.00, 0.00, 0.00, -9.00, -2.30},
-    {0.00, 0.00, 0.00, -8.60, -2.30},
-    {0.00, 0.00, 0.00, -8.20, -2.30},
-    {0.00, 0.00, 0.00, -7.80, -2.30},
-    {0.00, 0.00, 0.00, -7.40, -2.30},
-    {0.00, 0.00, 0.00, -7.00, -2.30},
-    {0.00, 0.00, 0.00, -6.60, -2.30},
-    {0.00, 0.00, 0.00, -6.20, -2.30},
-    {0.00, 0.00, 0.00, -5.80, -2.30},
-    {0.00, 0.00, 0.00, -5.40, -2.30},
-    {0.00, 0.00, 0.00, -5.00, -2.30},
-    {0.00, 0.00, 0.00, -4.60, -2.30},
-    {0.00, 0.00, 0.00, -4.20, -2.30},
-    {0.00, 0.00, 0.00, -3.80, -2.30},
-    {0.00, 0.00, 0.00, -3.40, -2.30},
-    {0.00, 0.00, 0.00, -3.00, -2.30},
-    {0.00, 0.00, 0.00, -2.60, -2.30},
-    {0.00, 0.00, 0.00, -2.20, -2.30},
-    {0.00, 0.00, 0.00, -1.80, -2.30},
-    {0.00, 0.00, 0.00, -1.40, -2.30},
-    {0.00, 0.00, 0.00, -1.00, -2.30},
-    {0.00, 0.00, 0.00, -0.60, -2.30},
-    {0.00, 0.00, 0.00, -0.20, -2.30},
-    {0.00, 0.00, 0.00, 0.20, -2.30},
-    {0.00, 0.00, 0.00, 0.60, -2.30},
-    {0.00, 0.00, 0.00, 1.00, -2.30},
-    {0.00, 0.00, 0.00, 1.40, -2.30},
-    {0.00, 0.00, 0.00, 1.80, -2.30},
-    {0.00, 0.00, 0.00, 2.20, -2.30},
-    {0.00, 0.00, 0.00, 2.60, -2.30},
-    {0.00, 0.00, 0.00, 3.00, -2.30},
-    {0.00, 0.00, 0.00, 3.40, -2.30},
-    {0.00, 0.00, 0.00, 3.80, -2.30},
-    {0.00, 0.00, 0.00, 4.20, -2.30},
-    {0.00, 0.00, 0.00, 4.60, -2.30},
-    {0.00, 0.00, 0.00, 5.00, -2.30},
-    {0.00, 0.00, 0.00, 5.40, -2.30},
-    {0.00, 0.00, 0.00, 5.80, -2.30},
-    {0.00, 0.00, 0.00, 6.20, -2.30},
-    {0.00, 0.00, 0.00, 6.60, -2.30},
-    {0.00, 0.00, 0.00, 7.00, -2.30},
-    {0.00, 0.00, 0.00, 7.40, -2.30},
-    {0.00, 0.00, 0.00, 7.80, -2.30},
-    {0.00, 0.00, 0.00, 8.20, -2.30},
-    {0.00, 0.00, 0.00, 8.60, -2.30},
-    {0.00, 0.00, 0.00, 9.00, -2.30},
-    {0.00, 0.00, 0.00, 9.40, -2.30},
-    {0.00, 0.00, 0.00, 9.80, -2.30},
-    {0.00, 0.00, 0.00, 10.20, -2.30},
-    {0.00, 0.00, 0.00, 10.60, -2.30},
-    {0.00, 0.00, 0.00, 11.00, -2.30},
-    {0.00, 0.00, 0.00, 11.40, -2.30},
-    {0.00, 0.00, 0.00, 11.80, -2.30},
-    {0.00, 0.00, 0.00, 12.20, -2.30},
-    {0.00, 0.00, 0.00, 12.60, -2.30},
-    {0.00, 0.00, 0.00, 13.00, -2.30},
-    {0.00, 0.00, 0.00, 13.40, -2.30},
-    {0.00, 0.00, 0.00, 13.80, -2.30},
-    {0.00, 0.00, 0.00, 14.20, -2.30},
-    {0.00, 0.00, 0.00, 14.60, -2.30},
-    {0.00, 0.00, 0.00, 15.00, -2.30},
-    {0.00, 0.00, 0.00, 15.40, -2.30},
-    {0.00, 0.00, 0.00, 15.80, -2.30},
-    {0.00, 0.00, 0.00, 16.20, -2.30},
-    {0.00, 0.00, 0.00, 16.60, -2.30},
-    {0.00, 0.00, 0.00, 17.00, -2.30},
-    {0.00, 0.00, 0.00, 17.40, -2.30},
-    {0.00, 0.00, 0.00, 17.80, -2.30},
-    {0.00, 0.00, 0.00, 18.20, -2.30},
-    {0.00, 0.00, 0.00, 18.60, -2.30},
-    {0.00, 0.00, 0.00, 19.00, -2.30},
-    {0.00, 0.00, 0.00, 19.40, -2.30},
-    {0.00, 0.00, 0.00, 19.80, -2.30},
-    {0.00, 0.00, 0.00, 20.20, -2.30},
-    {0.00, 0.00, 0.00, 20.60, -2.30},
-    {0.00, 0.00, 0.00, 21.00, -2.30},
-    {0.00, 0.00, 0.00, 21.40, -2.30},
-    {0.00, 0.00, 0.00, 21.80, -2.30},
-    {0.00, 0.00, 0.00, 22.20, -2.30},
-    {0.00, 0.00, 0.00, 22.60, -2.30},
-    {0.00, 0.00, 0.00, 23.00, -2.30},
-    {0.00, 0.00, 0.00, 23.40, -2.30},
-    {0.00, 0.00, 0.00, 23.80, -2.30},
-    {0.00, 0.00, 0.00, 24.20, -2.30},
-    {0.00, 0.00, 0.00, 24.60, -2.30},
-    {0.00, 0.00, 0.00, 25.00, -2.30},
-    {0.00, 0.00, 0.00, 25.40, -2.30},
-    {0.00, 0.00, 0.00, 25.80, -2.30},
-    {0.00, 0.00, 0.00, 26.20, -2.30},
-    {0.00, 0.00, 0.00, 26.60, -2.30},
-    {0.00, 0.00, 0.00, 27.00, -2.30},
-    {0.00, 0.00, 0.00, 27.40, -2.30},
-    {0.00, 0.00, 0.00, 27.80, -2.30},
-    {0.00, 0.00, 0.00, 28.20, -2.30},
-    {0.00, 0.00, 0.00, 28.60, -2.30},
-    {0.00, 0.00, 0.00, 29.00, -2.30},
-    {0.00, 0.00, 0.00, 29.40, -2.30},
-    {0.00, 0.00, 0.00, 29.80, -2.30},
-    {0.00, 0.00, 0.00, 30.20, -2.30},
-    {0.00, 0.00, 0.00, 30.60, -2.30},
-    {0.00, 0.00, 0.00, 31.00, -2.30},
-    {0.00, 0.00, 0.00, 31.40, -2.30},
-    {0.00, 0.00, 0.00, 31.80, -2.30},
-    {0.00, 0.00, 0.00, 32.20, -2.30},
-    {0.00, 0.00, 0.00, 32.60, -2.30},
-    {0.00, 0.00, 0.00, 33.00, -2.30},
-    {0.00, 0.00, 0.00, 33.40, -2.30},
-    {0.00, 0.00, 0.00, 33.80, -2.30},
-    {0.00, 0.00, 0.00, 34.20, -2.30},
-    {0.00, 0.00, 0.00, 34.60, -2.30},
-    {0.00, 0.00, 0.00, 35.00, -2.30},
-    {0.00, 0.00, 0.00, 35.40, -2.30},
-    {0.00, 0.00, 0.00, 35.80, -2.30},
-    {0.00, 0.00, 0.00, 36.20, -2.30},
-    {0.00, 0.00, 0.00, 36.60, -2.30},
-    {0.00, 0.00, 0.00, 37.00, -2.30},
-    {0.00, 0.00, 0.00, 37.40, -2.30},
-    {0.00, 0.00, 0.00, 37.80, -2.30},
-    {0.00, 0.00, 0.00, 38.20, -2.30},
-    {0.00, 0.00, 0.00, 38.60, -2.30},
-    {0.00, 0.00, 0.00, 39.00, -2.30},
-    {0.00, 0.00, 0.00, 39.40, -2.30},
-    {0.00, 0.00, 0.00, 39.80, -2.30},
-    {0.00, 0.00, 0.00, 40.20, -2.30},
-    {0.00, 0.00, 0.00, 40.60, -2.30},
-    {0.00, 0.00, 0.00, 41.00, -2.30},
-    {0.00, 0.00, 0.00, 41.40, -2.30},
-    {0.00, 0.00, 0.00, 41.80, -2.30},
-    {0.00, 0.00, 0.00, 42.20, -2.30},
-    {0.00, 0.00, 0.00, 42.60, -2.30},
-    {0.00, 0.00, 0.00, 43.00, -2.30},
-    {0.00, 0.00, 0.00, 43.40, -2.30},
-    {0.00, 0.00, 0.00, 43.80, -2.30},
-    {0.00, 0.00, 0.00, 44.20, -2.30},
-    {0.00, 0.00, 0.00, 44.60, -2.30},
-    {0.00, 0.00, 0.00, 45.00, -2.30},
-    {0.00, 0.00, 0.00, 45.40, -2.30},
-    {0.00, 0.00, 0.00, 45.80, -2.30},
-    {0.00, 0.00, 0.00, 46.20, -2.30},
-    {0.00, 0.00, 0.00, 46.60, -2.30},
-    {0.00, 0.00, 0.00, 47.00, -2.30},
-    {0.00, 0.00, 0.00, 47.40, -2.30},
-    {0.00, 0.00, 0.00, 47.80, -2.30},
-    {0.00, 0.00, 0.00, 48.20, -2.30},
-    {0.00, 0.00, 0.00, 48.60, -2.30},
-    {0.00, 0.00, 0.00, 49.00, -2.30},
-    {0.00, 0.00, 0.00, 49.40, -2.30},
-    {0.00, 0.00, 0.00, 49.80, -2.30},
-    {0.00, 0.00, 0.00, 50.20, -2.30},
-    {0.00, 0.00, 0.00, 50.60, -2.30},
-    {0.00, 0.00, 0.00, 51.00, -2.30},
-    {0.00, 0.00, 0.00, 51.40, -2.30},
-    {0.00, 0.00, 0.00, 51.80, -2.30},
-    {0.00, 0.00, 0.00, 52.20, -2.30},
-    {0.00, 0.00, 0.00, 52.60, -2.30},
-    {0.00, 0.00, 0.00, 53.00, -2.30},
-    {0.00, 0.00, 0.00, 53.40, -2.30},
-    {0.00, 0.00, 0.00, 53.80, -2.30},
-    {0.00, 0.00, 0.00, 54.20, -2.30},
-    {0.00, 0.00, 0.00, 54.60, -2.30},
-    {0.00, 0.00, 0.00, 55.00, -2.30},
-    {0.00, 0.00, 0.00, 55.40, -2.30},
-    {0.00, 0.00, 0.00, 55.80, -2.30},
-    {0.00, 0.00, 0.00, 56.20, -2.30},
-    {0.00, 0.00, 0.00, 56.60, -2.30},
-    {0.00, 0.00, 0.00, 57.00, -2.30},
-    {0.00, 0.00, 0.00, 57.40, -2.30},
-    {0.00, 0.00, 0.00, 57.80, -2.30},
-    {0.00, 0.00, 0.00, 58.20, -2.30},
-    {0.00, 0.00, 0.00, 58.60, -2.30},
-    {0.00, 0.00, 0.00, 59.00, -2.30},
-    {0.00, 0.00, 0.00, 59.40, -2.30},
-    {0.00, 0.00, 0.00, 59.80, -2.30},
-    {0.00, 0.00, 0.00, -59.80, -2.10},
-    {0.00, 0.00, 0.00, -59.40, -2.10},
-    {0.00, 0.00, 0.00, -59.00, -2.10},
-    {0.00, 0.00, 0.00, -58.60, -2.10},
-    {0.00, 0.00, 0.00, -58.20, -2.10},
-    {0.00, 0.00, 0.00, -57.80, -2.10},
-    {0.00, 0.00, 0.00, -57.40, -2.10},
-    {0.00, 0.00, 0.00, -57.00, -2.10},
-    {0.00, 0.00, 0.00, -56.60, -2.10},
-    {0.00, 0.00, 0.00, -56.20, -2.10},
-    {0.00, 0.00, 0.00, -55.80, -2.10},
-    {0.00, 0.00, 0.00, -55.40, -2.10},
-    {0.00, 0.00, 0.00, -55.00, -2.10},
-    {0.00, 0.00, 0.00, -54.60, -2.10},
-    {0.00, 0.00, 0.00, -54.20, -2.10},
-    {0.00, 0.00, 0.00, -53.80, -2.10},
-    {0.00, 0.00, 0.00, -53.40, -2.10},
-    {0.00, 0.00, 0.00, -53.00, -2.10},
-    {0.00, 0.00, 0.00, -52.60, -2.10},
-    {0.00, 0.00, 0.00, -52.20, -2.10},
-    {0.00, 0.00, 0.00, -51.80, -2.10},
-    {0.00, 0.00, 0.00, -51.40, -2.10},
-    {0.00, 0.00, 0.00, -51.00, -2.10},
-    {0.00, 0.00, 0.00, -50.60, -2.10},
-    {0.00, 0.00, 0.00, -50.20, -2.10},
-    {0.00, 0.00, 0.00, -49.80, -2.10},
-    {0.00, 0.00, 0.00, -49.40, -2.10},
-    {0.00, 0.00, 0.00, -49.00, -2.10},
-    {0.00, 0.00, 0.00, -48.60, -2.10},
-    {0.00, 0.00, 0.00, -48.20, -2.10},
-    {0.00, 0.00, 0.00, -47.80, -2.10},
-    {0.00, 0.00, 0.00, -47.40, -2.10},
-    {0.00, 0.00, 0.00, -47.00, -2.10},
-    {0.00, 0.00, 0.00, -46.60, -2.10},
-    {0.00, 0.00, 0.00, -46.20, -2.10},
-    {0.00, 0.00, 0.00, -45.80, -2.10},
-    {0.00, 0.00, 0.00, -45.40, -2.10},
-    {0.00, 0.00, 0.00, -45.00, -2.10},
-    {0.00, 0.00, 0.00, -44.60, -2.10},
-    {0.00, 0.00, 0.00, -44.20, -2.10},
-    {0.00, 0.00, 0.00, -43.80, -2.10},
-    {0.00, 0.00, 0.00, -43.40, -2.10},
-    {0.00, 0.00, 0.00, -43.00, -2.10},
-    {0.00, 0.00, 0.00, -42.60, -2.10},
-    {0.00, 0.00, 0.00, -42.20, -2.10},
-    {0.00, 0.00, 0.00, -41.80, -2.10},
-    {0.00, 0.00, 0.00, -41.40, -2.10},
-    {0.00, 0.00, 0.00, -41.00, -2.10},
-    {0.00, 0.00, 0.00, -40.60, -2.10},
-    {0.00, 0.00, 0.00, -40.20, -2.10},
-    {0.00, 0.00, 0.00, -39.80, -2.10},
-    {0.00, 0.00, 0.00, -39.40, -2.10},
-    {0.00, 0.00, 0.00, -39.00, -2.10},
-    {0.00, 0.00, 0.00, -38.60, -2.10},
-    {0.00, 0.00, 0.00, -38.20, -2.10},
-    {0.00, 0.00, 0.00, -37.80, -2.10},
-    {0.00, 0.00, 0.00, -37.40, -2.10},
-    {0.00, 0.00, 0.00, -37.00, -2.10},
-    {0.00, 0.00, 0.00, -36.60, -2.10},
-    {0.00, 0.00, 0.00, -36.20, -2.10},
-    {0.00, 0.00, 0.00, -35.80, -2.10},
-    {0.00, 0.00, 0.00, -35.40, -2.10},
-    {0.00, 0.00, 0.00, -35.00, -2.10},
-    {0.00, 0.00, 0.00, -34.60, -2.10},
-    {0.00, 0.00, 0.00, -34.20, -2.10},
-    {0.00, 0.00, 0.00, -33.80, -2.10},
-    {0.00, 0.00, 0.00, -33.40, -2.10},
-    {0.00, 0.00, 0.00, -33.00, -2.10},
-    {0.00, 0.00, 0.00, -32.60, -2.10},
-    {0.00, 0.00, 0.00, -32.20, -2.10},
-    {0.00, 0.00, 0.00, -31.80, -2.10},
-    {0.00, 0.00, 0.00, -31.40, -2.10},
-    {0.00, 0.00, 0.00, -31.00, -2.10},
-    {0.00, 0.00, 0.00, -30.60, -2.10},
-    {0.00, 0.00, 0.00, -30.20, -2.10},
-    {0.00, 0.00, 0.00, -29.80, -2.10},
-    {0.00, 0.00, 0.00, -29.40, -2.10},
-    {0.00, 0.00, 0.00, -29.00, -2.10},
-    {0.00, 0.00, 0.00, -28.60, -2.10},
-    {0.00, 0.00, 0.00, -28.20, -2.10},
-    {0.00, 0.00, 0.00, -27.80, -2.10},
-    {0.00, 0.00, 0.00, -27.40, -2.10},
-    {0.00, 0.00, 0.00, -27.00, -2.10},
-    {0.00, 0.00, 0.00, -26.60, -2.10},
-    {0.00, 0.00, 0.00, -26.20, -2.10},
-    {0.00, 0.00, 0.00, -25.80, -2.10},
-    {0.00, 0.00, 0.00, -25.40, -2.10},
-    {0.00, 0.00, 0.00, -25.00, -2.10},
-    {0.00, 0.00, 0.00, -24.60, -2.10},
-    {0.00, 0.00, 0.00, -24.20, -2.10},
-    {0.00, 0.00, 0.00, -23.80, -2.10},
-    {0.00, 0.00, 0.00, -23.40, -2.10},
-    {0.00, 0.00, 0.00, -23.00, -2.10},
-    {0.00, 0.00, 0.00, -22.60, -2.10},
-    {0.00, 0.00, 0.00, -22.20, -2.10},
-    {0.00, 0.00, 0.00, -21.80, -2.10},
-    {0.00, 0.00, 0.00, -21.40, -2.10},
-    {0.00, 0.00, 0.00, -21.00, -2.10},
-    {0.00, 0.00, 0.00, -20.60, -2.10},
-    {0.00, 0.00, 0.00, -20.20, -2.10},
-    {0.00, 0.00, 0.00, -19.80, -2.10},
-    {0.00, 0.00, 0.00, -19.40, -2.10},
-    {0.00, 0.00, 0.00, -19.00, -2.10},
-    {0.00, 0.00, 0.00, -18.60, -2.10},
-    {0.00, 0.00, 0.00, -18.20, -2.10},
-    {0.00, 0.00, 0.00, -17.80, -2.10},
-    {0.00, 0.00, 0.00, -17.40, -2.10},
-    {0.00, 0.00, 0.00, -17.00, -2.10},
-    {0.00, 0.00, 0.00, -16.60, -2.10},
-    {0.00, 0.00, 0.00, -16.20, -2.10},
-    {0.00, 0.00, 0.00, -15.80, -2.10},
-    {0.00, 0.00, 0.00, -15.40, -2.10},
-    {0.00, 0.00, 0.00, -15.00, -2.10},
-    {0.00, 0.00, 0.00, -14.60, -2.10},
-    {0.00, 0.00, 0.00, -14.20, -2.10},
-    {0.00, 0.00, 0.00, -13.80, -2.10},
-    {0.00, 0.00, 0.00, -13.40, -2.10},
-    {0.00, 0.00, 0.00, -13.00, -2.10},
-    {0.00, 0.00, 0.00, -12.60, -2.10},
-    {0.00, 0.00, 0.00, -12.20, -2.10},
-    {0.00, 0.00, 0.00, -11.80, -2.10},
-    {0.00, 0.00, 0.00, -11.40, -2.10},
-    {0.00, 0.00, 0.00, -11.00, -2.10},
-    {0.00, 0.00, 0.00, -10.60, -2.10},
-    {0.00, 0.00, 0.00, -10.20, -2.10},
-    {0.00, 0.00, 0.00, -9.80, -2.10},
-    {0.00, 0.00, 0.00, -9.40, -2.10},
-    {0.00, 0.00, 0.00, -9.00, -2.10},
-    {0.00, 0.00, 0.00, -8.60, -2.10},
-    {0.00, 0.00, 0.00, -8.20, -2.10},
-    {0.00, 0.00, 0.00, -7.80, -2.10},
-    {0.00, 0.00, 0.00, -7.40, -2.10},
-    {0.00, 0.00, 0.00, -7.00, -2.10},
-    {0.00, 0.00, 0.00, -6.60, -2.10},
-    {0.00, 0.00, 0.00, -6.20, -2.10},
-    {0.00, 0.00, 0.00, -5.80, -2.10},
-    {0.00, 0.00, 0.00, -5.40, -2.10},
-    {0.00, 0.00, 0.00, -5.00, -2.10},
-    {0.00, 0.00, 0.00, -4.60, -2.10},
-    {0.00, 0.00, 0.00, -4.20, -2.10},
-    {0.00, 0.00, 0.00, -3.80, -2.10},
-    {0.00, 0.00, 0.00, -3.40, -2.10},
-    {0.00, 0.00, 0.00, -3.00, -2.10},
-    {0.00, 0.00, 0.00, -2.60, -2.10},
-    {0.00, 0.00, 0.00, -2.20, -2.10},
-    {0.00, 0.00, 0.00, -1.80, -2.10},
-    {0.00, 0.00, 0.00, -1.40, -2.10},
-    {0.00, 0.00, 0.00, -1.00, -2.10},
-    {0.00, 0.00, 0.00, -0.60, -2.10},
-    {0.00, 0.00, 0.00, -0.20, -2.10},
-    {0.00, 0.00, 0.00, 0.20, -2.10},
-    {0.00, 0.00, 0.00, 0.60, -2.10},
-    {0.00, 0.00, 0.00, 1.00, -2.10},
-    {0.00, 0.00, 0.00, 1.40, -2.10},
-    {0.00, 0.00, 0.00, 1.80, -2.10},
-    {0.00, 0.00, 0.00, 2.20, -2.10},
-    {0.00, 0.00, 0.00, 2.60, -2.10},
-    {0.00, 0.00, 0.00, 3.00, -2.10},
-    {0.00, 0.00, 0.00, 3.40, -2.10},
-    {0.00, 0.00, 0.00, 3.80, -2.10},
-    {0.00, 0.00, 0.00, 4.20, -2.10},
-    {0.00, 0.00, 0.00, 4.60, -2.10},
-    {0.00, 0.00, 0.00, 5.00, -2.10},
-    {0.00, 0.00, 0.00, 5.40, -2.10},
-    {0.00, 0.00, 0.00, 5.80, -2.10},
-    {0.00, 0.00, 0.00, 6.20, -2.10},
-    {0.00, 0.00, 0.00, 6.60, -2.10},
-    {0.00, 0.00, 0.00, 7.00, -2.10},
-    {0.00, 0.00, 0.00, 7.40, -2.10},
-    {0.00, 0.00, 0.00, 7.80, -2.10},
-    {0.00, 0.00, 0.00, 8.20, -2.10},
-    {0.00, 0.00, 0.00, 8.60, -2.10},
-    {0.00, 0.00, 0.00, 9.00, -2.10},
-    {0.00, 0.00, 0.00, 9.40, -2.10},
-    {0.00, 0.00, 0.00, 9.80, -2.10},
-    {0.00, 0.00, 0.00, 10.20, -2.10},
-    {0.00, 0.00, 0.00, 10.60, -2.10},
-    {0.00, 0.00, 0.00, 11.00, -2.10},
-    {0.00, 0.00, 0.00, 11.40, -2.10},
-    {0.00, 0.00, 0.00, 11.80, -2.10},
-    {0.00, 0.00, 0.00, 12.20, -2.10},
-    {0.00, 0.00, 0.00, 12.60, -2.10},
-    {0.00, 0.00, 0.00, 13.00, -2.10},
-    {0.00, 0.00, 0.00, 13.40, -2.10},
-    {0.00, 0.00, 0.00, 13.80, -2.10},
-    {0.00, 0.00, 0.00, 14.20, -2.10},
-    {0.00, 0.00, 0.00, 14.60, -2.10},
-    {0.00, 0.00, 0.00, 15.00, -2.10},
-    {0.00, 0.00, 0.00, 15.40, -2.10},
-    {0.00, 0.00, 0.00, 15.80, -2.10},
-    {0.00, 0.00, 0.00, 16.20, -2.10},
-    {0.00, 0.00, 0.00, 16.60, -2.10},
-    {0.00, 0.00, 0.00, 17.00, -2.10},
-    {0.00, 0.00, 0.00, 17.40, -2.10},
-    {0.00, 0.00, 0.00, 17.80, -2.10},
-    {0.00, 0.00, 0.00, 18.20, -2.10},
-    {0.00, 0.00, 0.00, 18.60, -2.10},
-    {0.00, 0.00, 0.00, 19.00, -2.10},
-    {0.00, 0.00, 0.00, 19.40, -2.10},
-    {0.00, 0.00, 0.00, 19.80, -2.10},
-    {0.00, 0.00, 0.00, 20.20, -2.10},
-    {0.00, 0.00, 0.00, 20.60, -2.10},
-    {0.00, 0.00, 0.00, 21.00, -2.10},
-    {0.00, 0.00, 0.00, 21.40, -2.10},
-    {0.00, 0.00, 0.00, 21.80, -2.10},
-    {0.00, 0.00, 0.00, 22.20, -2.10},
-    {0.00, 0.00, 0.00, 22.60, -2.10},
-    {0.00, 0.00, 0.00, 23.00, -2.10},
-    {0.00, 0.00, 0.00, 23.40, -2.10},
-    {0.00, 0.00, 0.00, 23.80, -2.10},
-    {0.00, 0.00, 0.00, 24.20, -2.10},
-    {0.00, 0.00, 0.00, 24.60, -2.10},
-    {0.00, 0.00, 0.00, 25.00, -2.10},
-    {0.00, 0.00, 0.00, 25.40, -2.10},
-    {0.00, 0.00, 0.00, 25.80, -2.10},
-    {0.00, 0.00, 0.00, 26.20, -2.10},
-    {0.00, 0.00, 0.00, 26.60, -2.10},
-    {0.00, 0.00, 0.00, 27.00, -2.10},
-    {0.00, 0.00, 0.00, 27.40, -2.10},
-    {0.00, 0.00, 0.00, 27.80, -2.10},
-    {0.00, 0.00, 0.00, 28.20, -2.10},
-    {0.00, 0.00, 0.00, 28.60, -2.10},
-    {0.00, 0.00, 0.00, 29.00, -2.10},
-    {0.00, 0.00, 0.00, 29.40, -2.10},
-    {0.00, 0.00, 0.00, 29.80, -2.10},
-    {0.00, 0.00, 0.00, 30.20, -2.10},
-    {0.00, 0.00, 0.00, 30.60, -2.10},
-    {0.00, 0.00, 0.00, 31.00, -2.10},
-    {0.00, 0.00, 0.00, 31.40, -2.10},
-    {0.00, 0.00, 0.00, 31.80, -2.10},
-    {0.00, 0.00, 0.00, 32.20, -2.10},
-    {0.00, 0.00, 0.00, 32.60, -2.10},
-    {0.00, 0.00, 0.00, 33.00, -2.10},
-    {0.00, 0.00, 0.00, 33.40, -2.10},
-    {0.00, 0.00, 0.00, 33.80, -2.10},
-    {0.00, 0.00, 0.00, 34.20, -2.10},
-    {0.00, 0.00, 0.00, 34.60, -2.10},
-    {0.00, 0.00, 0.00, 35.00, -2.10},
-    {0.00, 0.00, 0.00, 35.40, -2.10},
-    {0.00, 0.00, 0.00, 35.80, -2.10},
-    {0.00, 0.00, 0.00, 36.20, -2.10},
-    {0.00, 0.00, 0.00, 36.60, -2.10},
-    {0.00, 0.00, 0.00, 37.00, -2.10},
-    {0.00, 0.00, 0.00, 37.40, -2.10},
-    {0.00, 0.00, 0.00, 37.80, -2.10},
-    {0.00, 0.00, 0.00, 38.20, -2.10},
-    {0.00, 0.00, 0.00, 38.60, -2.10},
-    {0.00, 0.00, 0.00, 39.00, -2.10},
-    {0.00, 0.00, 0.00, 39.40, -2.10},
-    {0.00, 0.00, 0.00, 39.80, -2.10},
-    {0.00, 0.00, 0.00, 40.20, -2.10},
-    {0.00, 0.00, 0.00, 40.60, -2.10},
-    {0.00, 0.00, 0.00, 41.00, -2.10},
-    {0.00, 0.00, 0.00, 41.40, -2.10},
-    {0.00, 0.00, 0.00, 41.80, -2.10},
-    {0.00, 0.00, 0.00, 42.20, -2.10},
-    {0.00, 0.00, 0.00, 42.60, -2.10},
-    {0.00, 0.00, 0.00, 43.00, -2.10},
-    {0.00, 0.00, 0.00, 43.40, -2.10},
-    {0.00, 0.00, 0.00, 43.80, -2.10},
-    {0.00, 0.00, 0.00, 44.20, -2.10},
-    {0.00, 0.00, 0.00, 44.60, -2.10},
-    {0.00, 0.00, 0.00, 45.00, -2.10},
-    {0.00, 0.00, 0.00, 45.40, -2.10},
-    {0.00, 0.00, 0.00, 45.80, -2.10},
-    {0.00, 0.00, 0.00, 46.20, -2.10},
-    {0.00, 0.00, 0.00, 46.60, -2.10},
-    {0.00, 0.00, 0.00, 47.00, -2.10},
-    {0.00, 0.00, 0.00, 47.40, -2.10},
-    {0.00, 0.00, 0.00, 47.80, -2.10},
-    {0.00, 0.00, 0.00, 48.20, -2.10},
-    {0.00, 0.00, 0.00, 48.60, -2.10},
-    {0.00, 0.00, 0.00, 49.00, -2.10},
-    {0.00, 0.00, 0.00, 49.40, -2.10},
-    {0.00, 0.00, 0.00, 49.80, -2.10},
-    {0.00, 0.00, 0.00, 50.20, -2.10},
-    {0.00, 0.00, 0.00, 50.60, -2.10},
-    {0.00, 0.00, 0.00, 51.00, -2.10},
-    {0.00, 0.00, 0.00, 51.40, -2.10},
-    {0.00, 0.00, 0.00, 51.80, -2.10},
-    {0.00, 0.00, 0.00, 52.20, -2.10},
-    {0.00, 0.00, 0.00, 52.60, -2.10},
-    {0.00, 0.00, 0.00, 53.00, -2.10},
-    {0.00, 0.00, 0.00, 53.40, -2.10},
-    {0.00, 0.00, 0.00, 53.80, -2.10},
-    {0.00, 0.00, 0.00, 54.20, -2.10},
-    {0.00, 0.00, 0.00, 54.60, -2.10},
-    {0.00, 0.00, 0.00, 55.00, -2.10},
-    {0.00, 0.00, 0.00, 55.40, -2.10},
-    {0.00, 0.00, 0.00, 55.80, -2.10},
-    {0.00, 0.00, 0.00, 56.20, -2.10},
-    {0.00, 0.00, 0.00, 56.60, -2.10},
-    {0.00, 0.00, 0.00, 57.00, -2.10},
-    {0.00, 0.00, 0.00, 57.40, -2.10},
-    {0.00, 0.00, 0.00, 57.80, -2.10},
-    {0.00, 0.00, 0.00, 58.20, -2.10},
-    {0.00, 0.00, 0.00, 58.60, -2.10},
-    {0.00, 0.00, 0.00, 59.00, -2.10},
-    {0.00, 0.00, 0.00, 59.40, -2.10},
-    {0.00, 0.00, 0.00, 59.80, -2.10},
-    {0.00, 0.00, 0.00, -59.80, -1.90},
-    {0.00, 0.00, 0.00, -59.40, -1.90},
-    {0.00, 0.00, 0.00, -59.00, -1.90},
-    {0.00, 0.00, 0.00, -58.60, -1.90},
-    {0.00, 0.00, 0.00, -58.20, -1.90},
-    {0.00, 0.00, 0.00, -57.80, -1.90},
-    {0.00, 0.00, 0.00, -57.40, -1.90},
-    {0.00, 0.00, 0.00, -57.00, -1.90},
-    {0.00, 0.00, 0.00, -56.60, -1.90},
-    {0.00, 0.00, 0.00, -56.20, -1.90},
-    {0.00, 0.00, 0.00, -55.80, -1.90},
-    {0.00, 0.00, 0.00, -55.40, -1.90},
-    {0.00, 0.00, 0.00, -55.00, -1.90},
-    {0.00, 0.00, 0.00, -54.60, -1.90},
-    {0.00, 0.00, 0.00, -54.20, -1.90},
-    {0.00, 0.00, 0.00, -53.80, -1.90},
-    {0.00, 0.00, 0.00, -53.40, -1.90},
-    {0.00, 0.00, 0.00, -53.00, -1.90},
-    {0.00, 0.00, 0.00, -52.60, -1.90},
-    {0.00, 0.00, 0.00, -52.20, -1.90},
-    {0.00, 0.00, 0.00, -51.80, -1.90},
-    {0.00, 0.00, 0.00, -51.40, -1.90},
-    {0.00, 0.00, 0.00, -51.00, -1.90},
-    {0.00, 0.00, 0.00, -50.60, -1.90},
-    {0.00, 0.00, 0.00, -50.20, -1.90},
-    {0.00, 0.00, 0.00, -49.80, -1.90},
-    {0.00, 0.00, 0.00, -49.40, -1.90},
-    {0.00, 0.00, 0.00, -49.00, -1.90},
-    {0.00, 0.00, 0.00, -48.60, -1.90},
-    {0.00, 0.00, 0.00, -48.20, -1.90},
-    {0.00, 0.00, 0.00, -47.80, -1.90},
-    {0.00, 0.00, 0.00, -47.40, -1.90},
-    {0.00, 0.00, 0.00, -47.00, -1.90},
-    {0.00, 0.00, 0.00, -46.60, -1.90},
-    {0.00, 0.00, 0.00, -46.20, -1.90},
-    {0.00, 0.00, 0.00, -45.80, -1.90},
-    {0.00, 0.00, 0.00, -45.40, -1.90},
-    {0.00, 0.00, 0.00, -45.00, -1.90},
-    {0.00, 0.00, 0.00, -44.60, -1.90},
-    {0.00, 0.00, 0.00, -44.20, -1.90},
-    {0.00, 0.00, 0.00, -43.80, -1.90},
-    {0.00, 0.00, 0.00, -43.40, -1.90},
-    {0.00, 0.00, 0.00, -43.00, -1.90},
-    {0.00, 0.00, 0.00, -42.60, -1.90},
-    {0.00, 0.00, 0.00, -42.20, -1.90},
-    {0.00, 0.00, 0.00, -41.80, -1.90},
-    {0.00, 0.00, 0.00, -41.40, -1.90},
-    {0.00, 0.00, 0.00, -41.00, -1.90},
-    {0.00, 0.00, 0.00, -40.60, -1.90},
-    {0.00, 0.00, 0.00, -40.20, -1.90},
-    {0.00, 0.00, 0.00, -39.80, -1.90},
-    {0.00, 0.00, 0.00, -39.40, -1.90},
-    {0.00, 0.00, 0.00, -39.00, -1.90},
-    {0.00, 0.00, 0.00, -38.60, -1.90},
-    {0.00, 0.00, 0.00, -38.20, -1.90},
-    {0.00, 0.00, 0.00, -37.80, -1.90},
-    {0.00, 0.00, 0.00, -37.40, -1.90},
-    {0.00, 0.00, 0.00, -37.00, -1.90},
-    {0.00, 0.00, 0.00, -36.60, -1.90},
-    {0.00, 0.00, 0.00, -36.20, -1.90},
-    {0.00, 0.00, 0.00, -35.80, -1.90},
-    {0.00, 0.00, 0.00, -35.40, -1.90},
-    {0.00, 0.00, 0.00, -35.00, -1.90},
-    {0.00, 0.00, 0.00, -34.60, -1.90},
-    {0.00, 0.00, 0.00, -34.20, -1.90},
-    {0.00, 0.00, 0.00, -33.80, -1.90},
-    {0.00, 0.00, 0.00, -33.40, -1.90},
-    {0.00, 0.00, 0.00, -33.00, -1.90},
-    {0.00, 0.00, 0.00, -32.60, -1.90},
-    {0.00, 0.00, 0.00, -32.20, -1.90},
-    {0.00, 0.00, 0.00, -31.80, -1.90},
-    {0.00, 0.00, 0.00, -31.40, -1.90},
-    {0.00, 0.00, 0.00, -31.00, -1.90},
-    {0.00, 0.00, 0.00, -30.60, -1.90},
-    {0.00, 0.00, 0.00, -30.20, -1.90},
-    {0.00, 0.00, 0.00, -29.80, -1.90},
-    {0.00, 0.00, 0.00, -29.40, -1.90},
-    {0.00, 0.00, 0.00, -29.00, -1.90},
-    {0.00, 0.00, 0.00, -28.60, -1.90},
-    {0.00, 0.00, 0.00, -28.20, -1.90},
-    {0.00, 0.00, 0.00, -27.80, -1.90},
-    {0.00, 0.00, 0.00, -27.40, -1.90},
-    {0.00, 0.00, 0.00, -27.00, -1.90},
-    {0.00, 0.00, 0.00, -26.60, -1.90},
-    {0.00, 0.00, 0.00, -26.20, -1.90},
-    {0.00, 0.00, 0.00, -25.80, -1.90},
-    {0.00, 0.00, 0.00, -25.40, -1.90},
-    {0.00, 0.00, 0.00, -25.00, -1.90},
-    {0.00, 0.00, 0.00, -24.60, -1.90},
-    {0.00, 0.00, 0.00, -24.20, -1.90},
-    {0.00, 0.00, 0.00, -23.80, -1.90},
-    {0.00, 0.00, 0.00, -23.40, -1.90},
-    {0.00, 0.00, 0.00, -23.00, -1.90},
-    {0.00, 0.00, 0.00, -22.60, -1.90},
-    {0.00, 0.00, 0.00, -22.20, -1.90},
-    {0.00, 0.00, 0.00, -21.80, -1.90},
-    {0.00, 0.00, 0.00, -21.40, -1.90},
-    {0.00, 0.00, 0.00, -21.00, -1.90},
-    {0.00, 0.00, 0.00, -20.60, -1.90},
-    {0.00, 0.00, 0.00, -20.20, -1.90},
-    {0.00, 0.00, 0.00, -19.80, -1.90},
-    {0.00, 0.00, 0.00, -19.40, -1.90},
-    {0.00, 0.00, 0.00, -19.00, -1.90},
-    {0.00, 0.00, 0.00, -18.60, -1.90},
-    {0.00, 0.00, 0.00, -18.20, -1.90},
-    {0.00, 0.00, 0.00, -17.80, -1.90},
-    {0.00, 0.00, 0.00, -17.40, -1.90},
-    {0.00, 0.00, 0.00, -17.00, -1.90},
-    {0.00, 0.00, 0.00, -16.60, -1.90},
-    {0.00, 0.00, 0.00, -16.20, -1.90},
-    {0.00, 0.00, 0.00, -15.80, -1.90},
-    {0.00, 0.00, 0.00, -15.40, -1.90},
-    {0.00, 0.00, 0.00, -15.00, -1.90},
-    {0.00, 0.00, 0.00, -14.60, -1.90},
-    {0.00, 0.00, 0.00, -14.20, -1.90},
-    {0.00, 0.00, 0.00, -13.80, -1.90},
-    {0.00, 0.00, 0.00, -13.40, -1.90},
-    {0.00, 0.00, 0.00, -13.00, -1.90},
-    {0.00, 0.00, 0.00, -12.60, -1.90},
-    {0.00, 0.00, 0.00, -12.20, -1.90},
-    {0.00, 0.00, 0.00, -11.80, -1.90},
-    {0.00, 0.00, 0.00, -11.40, -1.90},
-    {0.00, 0.00, 0.00, -11.00, -1.90},
-    {0.00, 0.00, 0.00, -10.60, -1.90},
-    {0.00, 0.00, 0.00, -10.20, -1.90},
-    {0.00, 0.00, 0.00, -9.80, -1.90},
-    {0.00, 0.00, 0.00, -9.40, -1.90},
-    {0.00, 0.00, 0.00, -9.00, -1.90},
-    {0.00, 0.00, 0.00, -8.60, -1.90},
-    {0.00, 0.00, 0.00, -8.20, -1.90},
-    {0.00, 0.00, 0.00, -7.80, -1.90},
-    {0.00, 0.00, 0.00, -7.40, -1.90},
-    {0.00, 0.00, 0.00, -7.00, -1.90},
-    {0.00, 0.00, 0.00, -6.60, -1.90},
-    {0.00, 0.00, 0.00, -6.20, -1.90},
-    {0.00, 0.00, 0.00, -5.80, -1.90},
-    {0.00, 0.00, 0.00, -5.40, -1.90},
-    {0.00, 0.00, 0.00, -5.00, -1.90},
-    {0.00, 0.00, 0.00, -4.60, -1.90},
-    {0.00, 0.00, 0.00, -4.20, -1.90},
-    {0.00, 0.00, 0.00, -3.80, -1.90},
-    {0.00, 0.00, 0.00, -3.40, -1.90},
-    {0.00, 0.00, 0.00, -3.00, -1.90},
-    {0.00, 0.00, 0.00, -2.60, -1.90},
-    {0.00, 0.00, 0.00, -2.20, -1.90},
-    {0.00, 0.00, 0.00, -1.80, -1.90},
-    {0.00, 0.00, 0.00, -1.40, -1.90},
-    {0.00, 0.00, 0.00, -1.00, -1.90},
-    {0.00, 0.00, 0.00, -0.60, -1.90},
-    {0.00, 0.00, 0.00, -0.20, -1.90},
-    {0.00, 0.00, 0.00, 0.20, -1.90},
-    {0.00, 0.00, 0.00, 0.60, -1.90},
-    {0.00, 0.00, 0.00, 1.00, -1.90},
-    {0.00, 0.00, 0.00, 1.40, -1.90},
-    {0.00, 0.00, 0.00, 1.80, -1.90},
-    {0.00, 0.00, 0.00, 2.20, -1.90},
-    {0.00, 0.00, 0.00, 2.60, -1.90},
-    {0.00, 0.00, 0.00, 3.00, -1.90},
-    {0.00, 0.00, 0.00, 3.40, -1.90},
-    {0.00, 0.00, 0.00, 3.80, -1.90},
-    {0.00, 0.00, 0.00, 4.20, -1.90},
-    {0.00, 0.00, 0.00, 4.60, -1.90},
-    {0.00, 0.00, 0.00, 5.00, -1.90},
-    {0.00, 0.00, 0.00, 5.40, -1.90},
-    {0.00, 0.00, 0.00, 5.80, -1.90},
-    {0.00, 0.00, 0.00, 6.20, -1.90},
-    {0.00, 0.00, 0.00, 6.60, -1.90},
-    {0.00, 0.00, 0.00, 7.00, -1.90},
-    {0.00, 0.00, 0.00, 7.40, -1.90},
-    {0.00, 0.00, 0.00, 7.80, -1.90},
-    {0.00, 0.00, 0.00, 8.20, -1.90},
-    {0.00, 0.00, 0.00, 8.60, -1.90},
-    {0.00, 0.00, 0.00, 9.00, -1.90},
-    {0.00, 0.00, 0.00, 9.40, -1.90},
-    {0.00, 0.00, 0.00, 9.80, -1.90},
-    {0.00, 0.00, 0.00, 10.20, -1.90},
-    {0.00, 0.00, 0.00, 10.60, -1.90},
-    {0.00, 0.00, 0.00, 11.00, -1.90},
-    {0.00, 0.00, 0.00, 11.40, -1.90},
-    {0.00, 0.00, 0.00, 11.80, -1.90},
-    {0.00, 0.00, 0.00, 12.20, -1.90},
-    {0.00, 0.00, 0.00, 12.60, -1.90},
-    {0.00, 0.00, 0.00, 13.00, -1.90},
-    {0.00, 0.00, 0.00, 13.40, -1.90},
-    {0.00, 0.00, 0.00, 13.80, -1.90},
-    {0.00, 0.00, 0.00, 14.20, -1.90},
-    {0.00, 0.00, 0.00, 14.60, -1.90},
-    {0.00, 0.00, 0.00, 15.00, -1.90},
-    {0.00, 0.00, 0.00, 15.40, -1.90},
-    {0.00, 0.00, 0.00, 15.80, -1.90},
-    {0.00, 0.00, 0.00, 16.20, -1.90},
-    {0.00, 0.00, 0.00, 16.60, -1.90},
-    {0.00, 0.00, 0.00, 17.00, -1.90},
-    {0.00, 0.00, 0.00, 17.40, -1.90},
-    {0.00, 0.00, 0.00, 17.80, -1.90},
-    {0.00, 0.00, 0.00, 18.20, -1.90},
-    {0.00, 0.00, 0.00, 18.60, -1.90},
-    {0.00, 0.00, 0.00, 19.00, -1.90},
-    {0.00, 0.00, 0.00, 19.40, -1.90},
-    {0.00, 0.00, 0.00, 19.80, -1.90},
-    {0.00, 0.00, 0.00, 20.20, -1.90},
-    {0.00, 0.00, 0.00, 20.60, -1.90},
-    {0.00, 0.00, 0.00, 21.00, -1.90},
-    {0.00, 0.00, 0.00, 21.40, -1.90},
-    {0.00, 0.00, 0.00, 21.80, -1.90},
-    {0.00, 0.00, 0.00, 22.20, -1.90},
-    {0.00, 0.00, 0.00, 22.60, -1.90},
-    {0.00, 0.00, 0.00, 23.00, -1.90},
-    {0.00, 0.00, 0.00, 23.40, -1.90},
-    {0.00, 0.00, 0.00, 23.80, -1.90},
-    {0.00, 0.00, 0.00, 24.20, -1.90},
-    {0.00, 0.00, 0.00, 24.60, -1.90},
-    {0.00, 0.00, 0.00, 25.00, -1.90},
-    {0.00, 0.00, 0.00, 25.40, -1.90},
-    {0.00, 0.00, 0.00, 25.80, -1.90},
-    {0.00, 0.00, 0.00, 26.20, -1.90},
-    {0.00, 0.00, 0.00, 26.60, -1.90},
-    {0.00, 0.00, 0.00, 27.00, -1.90},
-    {0.00, 0.00, 0.00, 27.40, -1.90},
-    {0.00, 0.00, 0.00, 27.80, -1.90},
-    {0.00, 0.00, 0.00, 28.20, -1.90},
-    {0.00, 0.00, 0.00, 28.60, -1.90},
-    {0.00, 0.00, 0.00, 29.00, -1.90},
-    {0.00, 0.00, 0.00, 29.40, -1.90},
-    {0.00, 0.00, 0.00, 29.80, -1.90},
-    {0.00, 0.00, 0.00, 30.20, -1.90},
-    {0.00, 0.00, 0.00, 30.60, -1.90},
-    {0.00, 0.00, 0.00, 31.00, -1.90},
-    {0.00, 0.00, 0.00, 31.40, -1.90},
-    {0.00, 0.00, 0.00, 31.80, -1.90},
-    {0.00, 0.00, 0.00, 32.20, -1.90},
-    {0.00, 0.00, 0.00, 32.60, -1.90},
-    {0.00, 0.00, 0.00, 33.00, -1.90},
-    {0.00, 0.00, 0.00, 33.40, -1.90},
-    {0.00, 0.00, 0.00, 33.80, -1.90},
-    {0.00, 0.00, 0.00, 34.20, -1.90},
-    {0.00, 0.00, 0.00, 34.60, -1.90},
-    {0.00, 0.00, 0.00, 35.00, -1.90},
-    {0.00, 0.00, 0.00, 35.40, -1.90},
-    {0.00, 0.00, 0.00, 35.80, -1.90},
-    {0.00, 0.00, 0.00, 36.20, -1.90},
-    {0.00, 0.00, 0.00, 36.60, -1.90},
-    {0.00, 0.00, 0.00, 37.00, -1.90},
-    {0.00, 0.00, 0.00, 37.40, -1.90},
-    {0.00, 0.00, 0.00, 37.80, -1.90},
-    {0.00, 0.00, 0.00, 38.20, -1.90},
-    {0.00, 0.00, 0.00, 38.60, -1.90},
-    {0.00, 0.00, 0.00, 39.00, -1.90},
-    {0.00, 0.00, 0.00, 39.40, -1.90},
-    {0.00, 0.00, 0.00, 39.80, -1.90},
-    {0.00, 0.00, 0.00, 40.20, -1.90},
-    {0.00, 0.00, 0.00, 40.60, -1.90},
-    {0.00, 0.00, 0.00, 41.00, -1.90},
-    {0.00, 0.00, 0.00, 41.40, -1.90},
-    {0.00, 0.00, 0.00, 41.80, -1.90},
-    {0.00, 0.00, 0.00, 42.20, -1.90},
-    {0.00, 0.00, 0.00, 42.60, -1.90},
-    {0.00, 0.00, 0.00, 43.00, -1.90},
-    {0.00, 0.00, 0.00, 43.40, -1.90},
-    {0.00, 0.00, 0.00, 43.80, -1.90},
-    {0.00, 0.00, 0.00, 44.20, -1.90},
-    {0.00, 0.00, 0.00, 44.60, -1.90},
-    {0.00, 0.00, 0.00, 45.00, -1.90},
-    {0.00, 0.00, 0.00, 45.40, -1.90},
-    {0.00, 0.00, 0.00, 45.80, -1.90},
-    {0.00, 0.00, 0.00, 46.20, -1.90},
-    {0.00, 0.00, 0.00, 46.60, -1.90},
-    {0.00, 0.00, 0.00, 47.00, -1.90},
-    {0.00, 0.00, 0.00, 47.40, -1.90},
-    {0.00, 0.00, 0.00, 47.80, -1.90},
-    {0.00, 0.00, 0.00, 48.20, -1.90},
-    {0.00, 0.00, 0.00, 48.60, -1.90},
-    {0.00, 0.00, 0.00, 49.00, -1.90},
-    {0.00, 0.00, 0.00, 49.40, -1.90},
-    {0.00, 0.00, 0.00, 49.80, -1.90},
-    {0.00, 0.00, 0.00, 50.20, -1.90},
-    {0.00, 0.00, 0.00, 50.60, -1.90},
-    {0.00, 0.00, 0.00, 51.00, -1.90},
-    {0.00, 0.00, 0.00, 51.40, -1.90},
-    {0.00, 0.00, 0.00, 51.80, -1.90},
-    {0.00, 0.00, 0.00, 52.20, -1.90},
-    {0.00, 0.00, 0.00, 52.60, -1.90},
-    {0.00, 0.00, 0.00, 53.00, -1.90},
-    {0.00, 0.00, 0.00, 53.40, -1.90},
-    {0.00, 0.00, 0.00, 53.80, -1.90},
-    {0.00, 0.00, 0.00, 54.20, -1.90},
-    {0.00, 0.00, 0.00, 54.60, -1.90},
-    {0.00, 0.00, 0.00, 55.00, -1.90},
-    {0.00, 0.00, 0.00, 55.40, -1.90},
-    {0.00, 0.00, 0.00, 55.80, -1.90},
-    {0.00, 0.00, 0.00, 56.20, -1.90},
-    {0.00, 0.00, 0.00, 56.60, -1.90},
-    {0.00, 0.00, 0.00, 57.00, -1.90},
-    {0.00, 0.00, 0.00, 57.40, -1.90},
-    {0.00, 0.00, 0.00, 57.80, -1.90},
-    {0.00, 0.00, 0.00, 58.20, -1.90},
-    {0.00, 0.00, 0.00, 58.60, -1.90},
-    {0.00, 0.00, 0.00, 59.00, -1.90},
-    {0.00, 0.00, 0.00, 59.40, -1.90},
-    {0.00, 0.00, 0.00, 59.80, -1.90},
-    {0.00, 0.00, 0.00, -59.80, -1.70},
-    {0.00, 0.00, 0.00, -59.40, -1.70},
-    {0.00, 0.00, 0.00, -59.00, -1.70},
-    {0.00, 0.00, 0.00, -58.60, -1.70},
-    {0.00, 0.00, 0.00, -58.20, -1.70},
-    {0.00, 0.00, 0.00, -57.80, -1.70},
-    {0.00, 0.00, 0.00, -57.40, -1.70},
-    {0.00, 0.00, 0.00, -57.00, -1.70},
-    {0.00, 0.00, 0.00, -56.60, -1.70},
-    {0.00, 0.00, 0.00, -56.20, -1.70},
-    {0.00, 0.00, 0.00, -55.80, -1.70},
-    {0.00, 0.00, 0.00, -55.40, -1.70},
-    {0.00, 0.00, 0.00, -55.00, -1.70},
-    {0.00, 0.00, 0.00, -54.60, -1.70},
-    {0.00, 0.00, 0.00, -54.20, -1.70},
-    {0.00, 0.00, 0.00, -53.80, -1.70},
-    {0.00, 0.00, 0.00, -53.40, -1.70},
-    {0.00, 0.00, 0.00, -53.00, -1.70},
-    {0.00, 0.00, 0.00, -52.60, -1.70},
-    {0.00, 0.00, 0.00, -52.20, -1.70},
-    {0.00, 0.00, 0.00, -51.80, -1.70},
-    {0.00, 0.00, 0.00, -51.40, -1.70},
-    {0.00, 0.00, 0.00, -51.00, -1.70},
-    {0.00, 0.00, 0.00, -50.60, -1.70},
-    {0.00, 0.00, 0.00, -50.20, -1.70},
-    {0.00, 0.00, 0.00, -49.80, -1.70},
-    {0.00, 0.00, 0.00, -49.40, -1.70},
-    {0.00, 0.00, 0.00, -49.00, -1.70},
-    {0.00, 0.00, 0.00, -48.60, -1.70},
-    {0.00, 0.00, 0.00, -48.20, -1.70},
-    {0.00, 0.00, 0.00, -47.80, -1.70},
-    {0.00, 0.00, 0.00, -47.40, -1.70},
-    {0.00, 0.00, 0.00, -47.00, -1.70},
-    {0.00, 0.00, 0.00, -46.60, -1.70},
-    {0.00, 0.00, 0.00, -46.20, -1.70},
-    {0.00, 0.00, 0.00, -45.80, -1.70},
-    {0.00, 0.00, 0.00, -45.40, -1.70},
-    {0.00, 0.00, 0.00, -45.00, -1.70},
-    {0.00, 0.00, 0.00, -44.60, -1.70},
-    {0.00, 0.00, 0.00, -44.20, -1.70},
-    {0.00, 0.00, 0.00, -43.80, -1.70},
-    {0.00, 0.00, 0.00, -43.40, -1.70},
-    {0.00, 0.00, 0.00, -43.00, -1.70},
-    {0.00, 0.00, 0.00, -42.60, -1.70},
-    {0.00, 0.00, 0.00, -42.20, -1.70},
-    {0.00, 0.00, 0.00, -41.80, -1.70},
-    {0.00, 0.00, 0.00, -41.40, -1.70},
-    {0.00, 0.00, 0.00, -41.00, -1.70},
-    {0.00, 0.00, 0.00, -40.60, -1.70},
-    {0.00, 0.00, 0.00, -40.20, -1.70},
-    {0.00, 0.00, 0.00, -39.80, -1.70},
-    {0.00, 0.00, 0.00, -39.40, -1.70},
-    {0.00, 0.00, 0.00, -39.00, -1.70},
-    {0.00, 0.00, 0.00, -38.60, -1.70},
-    {0.00, 0.00, 0.00, -38.20, -1.70},
-    {0.00, 0.00, 0.00, -37.80, -1.70},
-    {0.00, 0.00, 0.00, -37.40, -1.70},
-    {0.00, 0.00, 0.00, -37.00, -1.70},
-    {0.00, 0.00, 0.00, -36.60, -1.70},
-    {0.00, 0.00, 0.00, -36.20, -1.70},
-    {0.00, 0.00, 0.00, -35.80, -1.70},
-    {0.00, 0.00, 0.00, -35.40, -1.70},
-    {0.00, 0.00, 0.00, -35.00, -1.70},
-    {0.00, 0.00, 0.00, -34.60, -1.70},
-    {0.00, 0.00, 0.00, -34.20, -1.70},
-    {0.00, 0.00, 0.00, -33.80, -1.70},
-    {0.00, 0.00, 0.00, -33.40, -1.70},
-    {0.00, 0.00, 0.00, -33.00, -1.70},
-    {0.00, 0.00, 0.00, -32.60, -1.70},
-    {0.00, 0.00, 0.00, -32.20, -1.70},
-    {0.00, 0.00, 0.00, -31.80, -1.70},
-    {0.00, 0.00, 0.00, -31.40, -1.70},
-    {0.00, 0.00, 0.00, -31.00, -1.70},
-    {0.00, 0.00, 0.00, -30.60, -1.70},
-    {0.00, 0.00, 0.00, -30.20, -1.70},
-    {0.00, 0.00, 0.00, -29.80, -1.70},
-    {0.00, 0.00, 0.00, -29.40, -1.70},
-    {0.00, 0.00, 0.00, -29.00, -1.70},
-    {0.00, 0.00, 0.00, -28.60, -1.70},
-    {0.00, 0.00, 0.00, -28.20, -1.70},
-    {0.00, 0.00, 0.00, -27.80, -1.70},
-    {0.00, 0.00, 0.00, -27.40, -1.70},
-    {0.00, 0.00, 0.00, -27.00, -1.70},
-    {0.00, 0.00, 0.00, -26.60, -1.70},
-    {0.00, 0.00, 0.00, -26.20, -1.70},
-    {0.00, 0.00, 0.00, -25.80, -1.70},
-    {0.00, 0.00, 0.00, -25.40, -1.70},
-    {0.00, 0.00, 0.00, -25.00, -1.70},
-    {0.00, 0.00, 0.00, -24.60, -1.70},
-    {0.00, 0.00, 0.00, -24.20, -1.70},
-    {0.00, 0.00, 0.00, -23.80, -1.70},
-    {0.00, 0.00, 0.00, -23.40, -1.70},
-    {0.00, 0.00, 0.00, -23.00, -1.70},
-    {0.00, 0.00, 0.00, -22.60, -1.70},
-    {0.00, 0.00, 0.00, -22.20, -1.70},
-    {0.00, 0.00, 0.00, -21.80, -1.70},
-    {0.00, 0.00, 0.00, -21.40, -1.70},
-    {0.00, 0.00, 0.00, -21.00, -1.70},
-    {0.00, 0.00, 0.00, -20.60, -1.70},
-    {0.00, 0.00, 0.00, -20.20, -1.70},
-    {0.00, 0.00, 0.00, -19.80, -1.70},
-    {0.00, 0.00, 0.00, -19.40, -1.70},
-    {0.00, 0.00, 0.00, -19.00, -1.70},
-    {0.00, 0.00, 0.00, -18.60, -1.70},
-    {0.00, 0.00, 0.00, -18.20, -1.70},
-    {0.00, 0.00, 0.00, -17.80, -1.70},
-    {0.00, 0.00, 0.00, -17.40, -1.70},
-    {0.00, 0.00, 0.00, -17.00, -1.70},
-    {0.00, 0.00, 0.00, -16.60, -1.70},
-    {0.00, 0.00, 0.00, -16.20, -1.70},
-    {0.00, 0.00, 0.00, -15.80, -1.70},
-    {0.00, 0.00, 0.00, -15.40, -1.70},
-    {0.00, 0.00, 0.00, -15.00, -1.70},
-    {0.00, 0.00, 0.00, -14.60, -1.70},
-    {0.00, 0.00, 0.00, -14.20, -1.70},
-    {0.00, 0.00, 0.00, -13.80, -1.70},
-    {0.00, 0.00, 0.00, -13.40, -1.70},
-    {0.00, 0.00, 0.00, -13.00, -1.70},
-    {0.00, 0.00, 0.00, -12.60, -1.70},
-    {0.00, 0.00, 0.00, -12.20, -1.70},
-    {0.00, 0.00, 0.00, -11.80, -1.70},
-    {0.00, 0.00, 0.00, -11.40, -1.70},
-    {0.00, 0.00, 0.00, -11.00, -1.70},
-    {0.00, 0.00, 0.00, -10.60, -1.70},
-    {0.00, 0.00, 0.00, -10.20, -1.70},
-    {0.00, 0.00, 0.00, -9.80, -1.70},
-    {0.00, 0.00, 0.00, -9.40, -1.70},
-    {0.00, 0.00, 0.00, -9.00, -1.70},
-    {0.00, 0.00, 0.00, -8.60, -1.70},
-    {0.00, 0.00, 0.00, -8.20, -1.70},
-    {0.00, 0.00, 0.00, -7.80, -1.70},
-    {0.00, 0.00, 0.00, -7.40, -1.70},
-    {0.00, 0.00, 0.00, -7.00, -1.70},
-    {0.00, 0.00, 0.00, -6.60, -1.70},
-    {0.00, 0.00, 0.00, -6.20, -1.70},
-    {0.00, 0.00, 0.00, -5.80, -1.70},
-    {0.00, 0.00, 0.00, -5.40, -1.70},
-    {0.00, 0.00, 0.00, -5.00, -1.70},
-    {0.00, 0.00, 0.00, -4.60, -1.70},
-    {0.00, 0.00, 0.00, -4.20, -1.70},
-    {0.00, 0.00, 0.00, -3.80, -1.70},
-    {0.00, 0.00, 0.00, -3.40, -1.70},
-    {0.00, 0.00, 0.00, -3.00, -1.70},
-    {0.00, 0.00, 0.00, -2.60, -1.70},
-    {0.00, 0.00, 0.00, -2.20, -1.70},
-    {0.00, 0.00, 0.00, -1.80, -1.70},
-    {0.00, 0.00, 0.00, -1.40, -1.70},
-    {0.00, 0.00, 0.00, -1.00, -1.70},
-    {0.00, 0.00, 0.00, -0.60, -1.70},
-    {0.00, 0.00, 0.00, -0.20, -1.70},
-    {0.00, 0.00, 0.00, 0.20, -1.70},
-    {0.00, 0.00, 0.00, 0.60, -1.70},
-    {0.00, 0.00, 0.00, 1.00, -1.70},
-    {0.00, 0.00, 0.00, 1.40, -1.70},
-    {0.00, 0.00, 0.00, 1.80, -1.70},
-    {0.00, 0.00, 0.00, 2.20, -1.70},
-    {0.00, 0.00, 0.00, 2.60, -1.70},
-    {0.00, 0.00, 0.00, 3.00, -1.70},
-    {0.00, 0.00, 0.00, 3.40, -1.70},
-    {0.00, 0.00, 0.00, 3.80, -1.70},
-    {0.00, 0.00, 0.00, 4.20, -1.70},
-    {0.00, 0.00, 0.00, 4.60, -1.70},
-    {0.00, 0.00, 0.00, 5.00, -1.70},
-    {0.00, 0.00, 0.00, 5.40, -1.70},
-    {0.00, 0.00, 0.00, 5.80, -1.70},
-    {0.00, 0.00, 0.00, 6.20, -1.70},
-    {0.00, 0.00, 0.00, 6.60, -1.70},
-    {0.00, 0.00, 0.00, 7.00, -1.70},
-    {0.00, 0.00, 0.00, 7.40, -1.70},
-    {0.00, 0.00, 0.00, 7.80, -1.70},
-    {0.00, 0.00, 0.00, 8.20, -1.70},
-    {0.00, 0.00, 0.00, 8.60, -1.70},
-    {0.00, 0.00, 0.00, 9.00, -1.70},
-    {0.00, 0.00, 0.00, 9.40, -1.70},
-    {0.00, 0.00, 0.00, 9.80, -1.70},
-    {0.00, 0.00, 0.00, 10.20, -1.70},
-    {0.00, 0.00, 0.00, 10.60, -1.70},
-    {0.00, 0.00, 0.00, 11.00, -1.70},
-    {0.00, 0.00, 0.00, 11.40, -1.70},
-    {0.00, 0.00, 0.00, 11.80, -1.70},
-    {0.00, 0.00, 0.00, 12.20, -1.70},
-    {0.00, 0.00, 0.00, 12.60, -1.70},
-    {0.00, 0.00, 0.00, 13.00, -1.70},
-    {0.00, 0.00, 0.00, 13.40, -1.70},
-    {0.00, 0.00, 0.00, 13.80, -1.70},
-    {0.00, 0.00, 0.00, 14.20, -1.70},
-    {0.00, 0.00, 0.00, 14.60, -1.70},
-    {0.00, 0.00, 0.00, 15.00, -1.70},
-    {0.00, 0.00, 0.00, 15.40, -1.70},
-    {0.00, 0.00, 0.00, 15.80, -1.70},
-    {0.00, 0.00, 0.00, 16.20, -1.70},
-    {0.00, 0.00, 0.00, 16.60, -1.70},
-    {0.00, 0.00, 0.00, 17.00, -1.70},
-    {0.00, 0.00, 0.00, 17.40, -1.70},
-    {0.00, 0.00, 0.00, 17.80, -1.70},
-    {0.00, 0.00, 0.00, 18.20, -1.70},
-    {0.00, 0.00, 0.00, 18.60, -1.70},
-    {0.00, 0.00, 0.00, 19.00, -1.70},
-    {0.00, 0.00, 0.00, 19.40, -1.70},
-    {0.00, 0.00, 0.00, 19.80, -1.70},
-    {0.00, 0.00, 0.00, 20.20, -1.70},
-    {0.00, 0.00, 0.00, 20.60, -1.70},
-    {0.00, 0.00, 0.00, 21.00, -1.70},
-    {0.00, 0.00, 0.00, 21.40, -1.70},
-    {0.00, 0.00, 0.00, 21.80, -1.70},
-    {0.00, 0.00, 0.00, 22.20, -1.70},
-    {0.00, 0.00, 0.00, 22.60, -1.70},
-    {0.00, 0.00, 0.00, 23.00, -1.70},
-    {0.00, 0.00, 0.00, 23.40, -1.70},
-    {0.00, 0.00, 0.00, 23.80, -1.70},
-    {0.00, 0.00, 0.00, 24.20, -1.70},
-    {0.00, 0.00, 0.00, 24.60, -1.70},
-    {0.00, 0.00, 0.00, 25.00, -1.70},
-    {0.00, 0.00, 0.00, 25.40, -1.70},
-    {0.00, 0.00, 0.00, 25.80, -1.70},
-    {0.00, 0.00, 0.00, 26.20, -1.70},
-    {0.00, 0.00, 0.00, 26.60, -1.70},
-    {0.00, 0.00, 0.00, 27.00, -1.70},
-    {0.00, 0.00, 0.00, 27.40, -1.70},
-    {0.00, 0.00, 0.00, 27.80, -1.70},
-    {0.00, 0.00, 0.00, 28.20, -1.70},
-    {0.00, 0.00, 0.00, 28.60, -1.70},
-    {0.00, 0.00, 0.00, 29.00, -1.70},
-    {0.00, 0.00, 0.00, 29.40, -1.70},
-    {0.00, 0.00, 0.00, 29.80, -1.70},
-    {0.00, 0.00, 0.00, 30.20, -1.70},
-    {0.00, 0.00, 0.00, 30.60, -1.70},
-    {0.00, 0.00, 0.00, 31.00, -1.70},
-    {0.00, 0.00, 0.00, 31.40, -1.70},
-    {0.00, 0.00, 0.00, 31.80, -1.70},
-    {0.00, 0.00, 0.00, 32.20, -1.70},
-    {0.00, 0.00, 0.00, 32.60, -1.70},
-    {0.00, 0.00, 0.00, 33.00, -1.70},
-    {0.00, 0.00, 0.00, 33.40, -1.70},
-    {0.00, 0.00, 0.00, 33.80, -1.70},
-    {0.00, 0.00, 0.00, 34.20, -1.70},
-    {0.00, 0.00, 0.00, 34.60, -1.70},
-    {0.00, 0.00, 0.00, 35.00, -1.70},
-    {0.00, 0.00, 0.00, 35.40, -1.70},
-    {0.00, 0.00, 0.00, 35.80, -1.70},
-    {0.00, 0.00, 0.00, 36.20, -1.70},
-    {0.00, 0.00, 0.00, 36.60, -1.70},
-    {0.00, 0.00, 0.00, 37.00, -1.70},
-    {0.00, 0.00, 0.00, 37.40, -1.70},
-    {0.00, 0.00, 0.00, 37.80, -1.70},
-    {0.00, 0.00, 0.00, 38.20, -1.70},
-    {0.00, 0.00, 0.00, 38.60, -1.70},
-    {0.00, 0.00, 0.00, 39.00, -1.70},
-    {0.00, 0.00, 0.00, 39.40, -1.70},
-    {0.00, 0.00, 0.00, 39.80, -1.70},
-    {0.00, 0.00, 0.00, 40.20, -1.70},
-    {0.00, 0.00, 0.00, 40.60, -1.70},
-    {0.00, 0.00, 0.00, 41.00, -1.70},
-    {0.00, 0.00, 0.00, 41.40, -1.70},
-    {0.00, 0.00, 0.00, 41.80, -1.70},
-    {0.00, 0.00, 0.00, 42.20, -1.70},
-    {0.00, 0.00, 0.00, 42.60, -1.70},
-    {0.00, 0.00, 0.00, 43.00, -1.70},
-    {0.00, 0.00, 0.00, 43.40, -1.70},
-    {0.00, 0.00, 0.00, 43.80, -1.70},
-    {0.00, 0.00, 0.00, 44.20, -1.70},
-    {0.00, 0.00, 0.00, 44.60, -1.70},
-    {0.00, 0.00, 0.00, 45.00, -1.70},
-    {0.00, 0.00, 0.00, 45.40, -1.70},
-    {0.00, 0.00, 0.00, 45.80, -1.70},
-    {0.00, 0.00, 0.00, 46.20, -1.70},
-    {0.00, 0.00, 0.00, 46.60, -1.70},
-    {0.00, 0.00, 0.00, 47.00, -1.70},
-    {0.00, 0.00, 0.00, 47.40, -1.70},
-    {0.00, 0.00, 0.00, 47.80, -1.70},
-    {0.00, 0.00, 0.00, 48.20, -1.70},
-    {0.00, 0.00, 0.00, 48.60, -1.70},
-    {0.00, 0.00, 0.00, 49.00, -1.70},
-    {0.00, 0.00, 0.00, 49.40, -1.70},
-    {0.00, 0.00, 0.00, 49.80, -1.70},
-    {0.00, 0.00, 0.00, 50.20, -1.70},
-    {0.00, 0.00, 0.00, 50.60, -1.70},
-    {0.00, 0.00, 0.00, 51.00, -1.70},
-    {0.00, 0.00, 0.00, 51.40, -1.70},
-    {0.00, 0.00, 0.00, 51.80, -1.70},
-    {0.00, 0.00, 0.00, 52.20, -1.70},
-    {0.00, 0.00, 0.00, 52.60, -1.70},
-    {0.00, 0.00, 0.00, 53.00, -1.70},
-    {0.00, 0.00, 0.00, 53.40, -1.70},
-    {0.00, 0.00, 0.00, 53.80, -1.70},
-    {0.00, 0.00, 0.00, 54.20, -1.70},
-    {0.00, 0.00, 0.00, 54.60, -1.70},
-    {0.00, 0.00, 0.00, 55.00, -1.70},
-    {0.00, 0.00, 0.00, 55.40, -1.70},
-    {0.00, 0.00, 0.00, 55.80, -1.70},
-    {0.00, 0.00, 0.00, 56.20, -1.70},
-    {0.00, 0.00, 0.00, 56.60, -1.70},
-    {0.00, 0.00, 0.00, 57.00, -1.70},
-    {0.00, 0.00, 0.00, 57.40, -1.70},
-    {0.00, 0.00, 0.00, 57.80, -1.70},
-    {0.00, 0.00, 0.00, 58.20, -1.70},
-    {0.00, 0.00, 0.00, 58.60, -1.70},
-    {0.00, 0.00, 0.00, 59.00, -1.70},
-    {0.00, 0.00, 0.00, 59.40, -1.70},
-    {0.00, 0.00, 0.00, 59.80, -1.70},
-    {0.00, 0.00, 0.00, -59.80, -1.50},
-    {0.00, 0.00, 0.00, -59.40, -1.50},
-    {0.00, 0.00, 0.00, -59.00, -1.50},
-    {0.00, 0.00, 0.00, -58.60, -1.50},
-    {0.00, 0.00, 0.00, -58.20, -1.50},
-    {0.00, 0.00, 0.00, -57.80, -1.50},
-    {0.00, 0.00, 0.00, -57.40, -1.50},
-    {0.00, 0.00, 0.00, -57.00, -1.50},
-    {0.00, 0.00, 0.00, -56.60, -1.50},
-    {0.00, 0.00, 0.00, -56.20, -1.50},
-    {0.00, 0.00, 0.00, -55.80, -1.50},
-    {0.00, 0.00, 0.00, -55.40, -1.50},
-    {0.00, 0.00, 0.00, -55.00, -1.50},
-    {0.00, 0.00, 0.00, -54.60, -1.50},
-    {0.00, 0.00, 0.00, -54.20, -1.50},
-    {0.00, 0.00, 0.00, -53.80, -1.50},
-    {0.00, 0.00, 0.00, -53.40, -1.50},
-    {0.00, 0.00, 0.00, -53.00, -1.50},
-    {0.00, 0.00, 0.00, -52.60, -1.50},
-    {0.00, 0.00, 0.00, -52.20, -1.50},
-    {0.00, 0.00, 0.00, -51.80, -1.50},
-    {0.00, 0.00, 0.00, -51.40, -1.50},
-    {0.00, 0.00, 0.00, -51.00, -1.50},
-    {0.00, 0.00, 0.00, -50.60, -1.50},
-    {0.00, 0.00, 0.00, -50.20, -1.50},
-    {0.00, 0.00, 0.00, -49.80, -1.50},
-    {0.00, 0.00, 0.00, -49.40, -1.50},
-    {0.00, 0.00, 0.00, -49.00, -1.50},
-    {0.00, 0.00, 0.00, -48.60, -1.50},
-    {0.00, 0.00, 0.00, -48.20, -1.50},
-    {0.00, 0.00, 0.00, -47.80, -1.50},
-    {0.00, 0.00, 0.00, -47.40, -1.50},
-    {0.00, 0.00, 0.00, -47.00, -1.50},
-    {0.00, 0.00, 0.00, -46.60, -1.50},
-    {0.00, 0.00, 0.00, -46.20, -1.50},
-    {0.00, 0.00, 0.00, -45.80, -1.50},
-    {0.00, 0.00, 0.00, -45.40, -1.50},
-    {0.00, 0.00, 0.00, -45.00, -1.50},
-    {0.00, 0.00, 0.00, -44.60, -1.50},
-    {0.00, 0.00, 0.00, -44.20, -1.50},
-    {0.00, 0.00, 0.00, -43.80, -1.50},
-    {0.00, 0.00, 0.00, -43.40, -1.50},
-    {0.00, 0.00, 0.00, -43.00, -1.50},
-    {0.00, 0.00, 0.00, -42.60, -1.50},
-    {0.00, 0.00, 0.00, -42.20, -1.50},
-    {0.00, 0.00, 0.00, -41.80, -1.50},
-    {0.00, 0.00, 0.00, -41.40, -1.50},
-    {0.00, 0.00, 0.00, -41.00, -1.50},
-    {0.00, 0.00, 0.00, -40.60, -1.50},
-    {0.00, 0.00, 0.00, -40.20, -1.50},
-    {0.00, 0.00, 0.00, -39.80, -1.50},
-    {0.00, 0.00, 0.00, -39.40, -1.50},
-    {0.00, 0.00, 0.00, -39.00, -1.50},
-    {0.00, 0.00, 0.00, -38.60, -1.50},
-    {0.00, 0.00, 0.00, -38.20, -1.50},
-    {0.00, 0.00, 0.00, -37.80, -1.50},
-    {0.00, 0.00, 0.00, -37.40, -1.50},
-    {0.00, 0.00, 0.00, -37.00, -1.50},
-    {0.00, 0.00, 0.00, -36.60, -1.50},
-    {0.00, 0.00, 0.00, -36.20, -1.50},
-    {0.00, 0.00, 0.00, -35.80, -1.50},
-    {0.00, 0.00, 0.00, -35.40, -1.50},
-    {0.00, 0.00, 0.00, -35.00, -1.50},
-    {0.00, 0.00, 0.00, -34.60, -1.50},
-    {0.00, 0.00, 0.00, -34.20, -1.50},
-    {0.00, 0.00, 0.00, -33.80, -1.50},
-    {0.00, 0.00, 0.00, -33.40, -1.50},
-    {0.00, 0.00, 0.00, -33.00, -1.50},
-    {0.00, 0.00, 0.00, -32.60, -1.50},
-    {0.00, 0.00, 0.00, -32.20, -1.50},
-    {0.00, 0.00, 0.00, -31.80, -1.50},
-    {0.00, 0.00, 0.00, -31.40, -1.50},
-    {0.00, 0.00, 0.00, -31.00, -1.50},
-    {0.00, 0.00, 0.00, -30.60, -1.50},
-    {0.00, 0.00, 0.00, -30.20, -1.50},
-    {0.00, 0.00, 0.00, -29.80, -1.50},
-    {0.00, 0.00, 0.00, -29.40, -1.50},
-    {0.00, 0.00, 0.00, -29.00, -1.50},
-    {0.00, 0.00, 0.00, -28.60, -1.50},
-    {0.00, 0.00, 0.00, -28.20, -1.50},
-    {0.00, 0.00, 0.00, -27.80, -1.50},
-    {0.00, 0.00, 0.00, -27.40, -1.50},
-    {0.00, 0.00, 0.00, -27.00, -1.50},
-    {0.00, 0.00, 0.00, -26.60, -1.50},
-    {0.00, 0.00, 0.00, -26.20, -1.50},
-    {0.00, 0.00, 0.00, -25.80, -1.50},
-    {0.00, 0.00, 0.00, -25.40, -1.50},
-    {0.00, 0.00, 0.00, -25.00, -1.50},
-    {0.00, 0.00, 0.00, -24.60, -1.50},
-    {0.00, 0.00, 0.00, -24.20, -1.50},
-    {0.00, 0.00, 0.00, -23.80, -1.50},
-    {0.00, 0.00, 0.00, -23.40, -1.50},
-    {0.00, 0.00, 0.00, -23.00, -1.50},
-    {0.00, 0.00, 0.00, -22.60, -1.50},
-    {0.00, 0.00, 0.00, -22.20, -1.50},
-    {0.00, 0.00, 0.00, -21.80, -1.50},
-    {0.00, 0.00, 0.00, -21.40, -1.50},
-    {0.00, 0.00, 0.00, -21.00, -1.50},
-    {0.00, 0.00, 0.00, -20.60, -1.50},
-    {0.00, 0.00, 0.00, -20.20, -1.50},
-    {0.00, 0.00, 0.00, -19.80, -1.50},
-    {0.00, 0.00, 0.00, -19.40, -1.50},
-    {0.00, 0.00, 0.00, -19.00, -1.50},
-    {0.00, 0.00, 0.00, -18.60, -1.50},
-    {0.00, 0.00, 0.00, -18.20, -1.50},
-    {0.00, 0.00, 0.00, -17.80, -1.50},
-    {0.00, 0.00, 0.00, -17.40, -1.50},
-    {0.00, 0.00, 0.00, -17.00, -1.50},
-    {0.00, 0.00, 0.00, -16.60, -1.50},
-    {0.00, 0.00, 0.00, -16.20, -1.50},
-    {0.00, 0.00, 0.00, -15.80, -1.50},
-    {0.00, 0.00, 0.00, -15.40, -1.50},
-    {0.00, 0.00, 0.00, -15.00, -1.50},
-    {0.00, 0.00, 0.00, -14.60, -1.50},
-    {0.00, 0.00, 0.00, -14.20, -1.50},
-    {0.00, 0.00, 0.00, -13.80, -1.50},
-    {0.00, 0.00, 0.00, -13.40, -1.50},
-    {0.00, 0.00, 0.00, -13.00, -1.50},
-    {0.00, 0.00, 0.00, -12.60, -1.50},
-    {0.00, 0.00, 0.00, -12.20, -1.50},
-    {0.00, 0.00, 0.00, -11.80, -1.50},
-    {0.00, 0.00, 0.00, -11.40, -1.50},
-    {0.00, 0.00, 0.00, -11.00, -1.50},
-    {0.00, 0.00, 0.00, -10.60, -1.50},
-    {0.00, 0.00, 0.00, -10.20, -1.50},
-    {0.00, 0.00, 0.00, -9.80, -1.50},
-    {0.00, 0.00, 0.00, -9.40, -1.50},
-    {0.00, 0.00, 0.00, -9.00, -1.50},
-    {0.00, 0.00, 0.00, -8.60, -1.50},
-    {0.00, 0.00, 0.00, -8.20, -1.50},
-    {0.00, 0.00, 0.00, -7.80, -1.50},
-    {0.00, 0.00, 0.00, -7.40, -1.50},
-    {0.00, 0.00, 0.00, -7.00, -1.50},
-    {0.00, 0.00, 0.00, -6.60, -1.50},
-    {0.00, 0.00, 0.00, -6.20, -1.50},
-    {0.00, 0.00, 0.00, -5.80, -1.50},
-    {0.00, 0.00, 0.00, -5.40, -1.50},
-    {0.00, 0.00, 0.00, -5.00, -1.50},
-    {0.00, 0.00, 0.00, -4.60, -1.50},
-    {0.00, 0.00, 0.00, -4.20, -1.50},
-    {0.00, 0.00, 0.00, -3.80, -1.50},
-    {0.00, 0.00, 0.00, -3.40, -1.50},
-    {0.00, 0.00, 0.00, -3.00, -1.50},
-    {0.00, 0.00, 0.00, -2.60, -1.50},
-    {0.00, 0.00, 0.00, -2.20, -1.50},
-    {0.00, 0.00, 0.00, -1.80, -1.50},
-    {0.00, 0.00, 0.00, -1.40, -1.50},
-    {0.00, 0.00, 0.00, -1.00, -1.50},
-    {0.00, 0.00, 0.00, -0.60, -1.50},
-    {0.00, 0.00, 0.00, -0.20, -1.50},
-    {0.00, 0.00, 0.00, 0.20, -1.50},
-    {0.00, 0.00, 0.00, 0.60, -1.50},
-    {0.00, 0.00, 0.00, 1.00, -1.50},
-    {0.00, 0.00, 0.00, 1.40, -1.50},
-    {0.00, 0.00, 0.00, 1.80, -1.50},
-    {0.00, 0.00, 0.00, 2.20, -1.50},
-    {0.00, 0.00, 0.00, 2.60, -1.50},
-    {0.00, 0.00, 0.00, 3.00, -1.50},
-    {0.00, 0.00, 0.00, 3.40, -1.50},
-    {0.00, 0.00, 0.00, 3.80, -1.50},
-    {0.00, 0.00, 0.00, 4.20, -1.50},
-    {0.00, 0.00, 0.00, 4.60, -1.50},
-    {0.00, 0.00, 0.00, 5.00, -1.50},
-    {0.00, 0.00, 0.00, 5.40, -1.50},
-    {0.00, 0.00, 0.00, 5.80, -1.50},
-    {0.00, 0.00, 0.00, 6.20, -1.50},
-    {0.00, 0.00, 0.00, 6.60, -1.50},
-    {0.00, 0.00, 0.00, 7.00, -1.50},
-    {0.00, 0.00, 0.00, 7.40, -1.50},
-    {0.00, 0.00, 0.00, 7.80, -1.50},
-    {0.00, 0.00, 0.00, 8.20, -1.50},
-    {0.00, 0.00, 0.00, 8.60, -1.50},
-    {0.00, 0.00, 0.00, 9.00, -1.50},
-    {0.00, 0.00, 0.00, 9.40, -1.50},
-    {0.00, 0.00, 0.00, 9.80, -1.50},
-    {0.00, 0.00, 0.00, 10.20, -1.50},
-    {0.00, 0.00, 0.00, 10.60, -1.50},
-    {0.00, 0.00, 0.00, 11.00, -1.50},
-    {0.00, 0.00, 0.00, 11.40, -1.50},
-    {0.00, 0.00, 0.00, 11.80, -1.50},
-    {0.00, 0.00, 0.00, 12.20, -1.50},
-    {0.00, 0.00, 0.00, 12.60, -1.50},
-    {0.00, 0.00, 0.00, 13.00, -1.50},
-    {0.00, 0.00, 0.00, 13.40, -1.50},
-    {0.00, 0.00, 0.00, 13.80, -1.50},
-    {0.00, 0.00, 0.00, 14.20, -1.50},
-    {0.00, 0.00, 0.00, 14.60, -1.50},
-    {0.00, 0.00, 0.00, 15.00, -1.50},
-    {0.00, 0.00, 0.00, 15.40, -1.50},
-    {0.00, 0.00, 0.00, 15.80, -1.50},
-    {0.00, 0.00, 0.00, 16.20, -1.50},
-    {0.00, 0.00, 0.00, 16.60, -1.50},
-    {0.00, 0.00, 0.00, 17.00, -1.50},
-    {0.00, 0.00, 0.00, 17.40, -1.50},
-    {0.00, 0.00, 0.00, 17.80, -1.50},
-    {0.00, 0.00, 0.00, 18.20, -1.50},
-    {0.00, 0.00, 0.00, 18.60, -1.50},
-    {0.00, 0.00, 0.00, 19.00, -1.50},
-    {0.00, 0.00, 0.00, 19.40, -1.50},
-    {0.00, 0.00, 0.00, 19.80, -1.50},
-    {0.00, 0.00, 0.00, 20.20, -1.50},
-    {0.00, 0.00, 0.00, 20.60, -1.50},
-    {0.00, 0.00, 0.00, 21.00, -1.50},
-    {0.00, 0.00, 0.00, 21.40, -1.50},
-    {0.00, 0.00, 0.00, 21.80, -1.50},
-    {0.00, 0.00, 0.00, 22.20, -1.50},
-    {0.00, 0.00, 0.00, 22.60, -1.50},
-    {0.00, 0.00, 0.00, 23.00, -1.50},
-    {0.00, 0.00, 0.00, 23.40, -1.50},
-    {0.00, 0.00, 0.00, 23.80, -1.50},
-    {0.00, 0.00, 0.00, 24.20, -1.50},
-    {0.00, 0.00, 0.00, 24.60, -1.50},
-    {0.00, 0.00, 0.00, 25.00, -1.50},
-    {0.00, 0.00, 0.00, 25.40, -1.50},
-    {0.00, 0.00, 0.00, 25.80, -1.50},
-    {0.00, 0.00, 0.00, 26.20, -1.50},
-    {0.00, 0.00, 0.00, 26.60, -1.50},
-    {0.00, 0.00, 0.00, 27.00, -1.50},
-    {0.00, 0.00, 0.00, 27.40, -1.50},
-    {0.00, 0.00, 0.00, 27.80, -1.50},
-    {0.00, 0.00, 0.00, 28.20, -1.50},
-    {0.00, 0.00, 0.00, 28.60, -1.50},
-    {0.00, 0.00, 0.00, 29.00, -1.50},
-    {0.00, 0.00, 0.00, 29.40, -1.50},
-    {0.00, 0.00, 0.00, 29.80, -1.50},
-    {0.00, 0.00, 0.00, 30.20, -1.50},
-    {0.00, 0.00, 0.00, 30.60, -1.50},
-    {0.00, 0.00, 0.00, 31.00, -1.50},
-    {0.00, 0.00, 0.00, 31.40, -1.50},
-    {0.00, 0.00, 0.00, 31.80, -1.50},
-    {0.00, 0.00, 0.00, 32.20, -1.50},
-    {0.00, 0.00, 0.00, 32.60, -1.50},
-    {0.00, 0.00, 0.00, 33.00, -1.50},
-    {0.00, 0.00, 0.00, 33.40, -1.50},
-    {0.00, 0.00, 0.00, 33.80, -1.50},
-    {0.00, 0.00, 0.00, 34.20, -1.50},
-    {0.00, 0.00, 0.00, 34.60, -1.50},
-    {0.00, 0.00, 0.00, 35.00, -1.50},
-    {0.00, 0.00, 0.00, 35.40, -1.50},
-    {0.00, 0.00, 0.00, 35.80, -1.50},
-    {0.00, 0.00, 0.00, 36.20, -1.50},
-    {0.00, 0.00, 0.00, 36.60, -1.50},
-    {0.00, 0.00, 0.00, 37.00, -1.50},
-    {0.00, 0.00, 0.00, 37.40, -1.50},
-    {0.00, 0.00, 0.00, 37.80, -1.50},
-    {0.00, 0.00, 0.00, 38.20, -1.50},
-    {0.00, 0.00, 0.00, 38.60, -1.50},
-    {0.00, 0.00, 0.00, 39.00, -1.50},
-    {0.00, 0.00, 0.00, 39.40, -1.50},
-    {0.00, 0.00, 0.00, 39.80, -1.50},
-    {0.00, 0.00, 0.00, 40.20, -1.50},
-    {0.00, 0.00, 0.00, 40.60, -1.50},
-    {0.00, 0.00, 0.00, 41.00, -1.50},
-    {0.00, 0.00, 0.00, 41.40, -1.50},
-    {0.00, 0.00, 0.00, 41.80, -1.50},
-    {0.00, 0.00, 0.00, 42.20, -1.50},
-    {0.00, 0.00, 0.00, 42.60, -1.50},
-    {0.00, 0.00, 0.00, 43.00, -1.50},
-    {0.00, 0.00, 0.00, 43.40, -1.50},
-    {0.00, 0.00, 0.00, 43.80, -1.50},
-    {0.00, 0.00, 0.00, 44.20, -1.50},
-    {0.00, 0.00, 0.00, 44.60, -1.50},
-    {0.00, 0.00, 0.00, 45.00, -1.50},
-    {0.00, 0.00, 0.00, 45.40, -1.50},
-    {0.00, 0.00, 0.00, 45.80, -1.50},
-    {0.00, 0.00, 0.00, 46.20, -1.50},
-    {0.00, 0.00, 0.00, 46.60, -1.50},
-    {0.00, 0.00, 0.00, 47.00, -1.50},
-    {0.00, 0.00, 0.00, 47.40, -1.50},
-    {0.00, 0.00, 0.00, 47.80, -1.50},
-    {0.00, 0.00, 0.00, 48.20, -1.50},
-    {0.00, 0.00, 0.00, 48.60, -1.50},
-    {0.00, 0.00, 0.00, 49.00, -1.50},
-    {0.00, 0.00, 0.00, 49.40, -1.50},
-    {0.00, 0.00, 0.00, 49.80, -1.50},
-    {0.00, 0.00, 0.00, 50.20, -1.50},
-    {0.00, 0.00, 0.00, 50.60, -1.50},
-    {0.00, 0.00, 0.00, 51.00, -1.50},
-    {0.00, 0.00, 0.00, 51.40, -1.50},
-    {0.00, 0.00, 0.00, 51.80, -1.50},
-    {0.00, 0.00, 0.00, 52.20, -1.50},
-    {0.00, 0.00, 0.00, 52.60, -1.50},
-    {0.00, 0.00, 0.00, 53.00, -1.50},
-    {0.00, 0.00, 0.00, 53.40, -1.50},
-    {0.00, 0.00, 0.00, 53.80, -1.50},
-    {0.00, 0.00, 0.00, 54.20, -1.50},
-    {0.00, 0.00, 0.00, 54.60, -1.50},
-    {0.00, 0.00, 0.00, 55.00, -1.50},
-    {0.00, 0.00, 0.00, 55.40, -1.50},
-    {0.00, 0.00, 0.00, 55.80, -1.50},
-    {0.00, 0.00, 0.00, 56.20, -1.50},
-    {0.00, 0.00, 0.00, 56.60, -1.50},
-    {0.00, 0.00, 0.00, 57.00, -1.50},
-    {0.00, 0.00, 0.00, 57.40, -1.50},
-    {0.00, 0.00, 0.00, 57.80, -1.50},
-    {0.00, 0.00, 0.00, 58.20, -1.50},
-    {0.00, 0.00, 0.00, 58.60, -1.50},
-    {0.00, 0.00, 0.00, 59.00, -1.50},
-    {0.00, 0.00, 0.00, 59.40, -1.50},
-    {0.00, 0.00, 0.00, 59.80, -1.50},
-    {0.00, 0.00, 0.00, -59.80, -1.30},
-    {0.00, 0.00, 0.00, -59.40, -1.30},
-    {0.00, 0.00, 0.00, -59.00, -1.30},
-    {0.00, 0.00, 0.00, -58.60, -1.30},
-    {0.00, 0.00, 0.00, -58.20, -1.30},
-    {0.00, 0.00, 0.00, -57.80, -1.30},
-    {0.00, 0.00, 0.00, -57.40, -1.30},
-    {0.00, 0.00, 0.00, -57.00, -1.30},
-    {0.00, 0.00, 0.00, -56.60, -1.30},
-    {0.00, 0.00, 0.00, -56.20, -1.30},
-    {0.00, 0.00, 0.00, -55.80, -1.30},
-    {0.00, 0.00, 0.00, -55.40, -1.30},
-    {0.00, 0.00, 0.00, -55.00, -1.30},
-    {0.00, 0.00, 0.00, -54.60, -1.30},
-    {0.00, 0.00, 0.00, -54.20, -1.30},
-    {0.00, 0.00, 0.00, -53.80, -1.30},
-    {0.00, 0.00, 0.00, -53.40, -1.30},
-    {0.00, 0.00, 0.00, -53.00, -1.30},
-    {0.00, 0.00, 0.00, -52.60, -1.30},
-    {0.00, 0.00, 0.00, -52.20, -1.30},
-    {0.00, 0.00, 0.00, -51.80, -1.30},
-    {0.00, 0.00, 0.00, -51.40, -1.30},
-    {0.00, 0.00, 0.00, -51.00, -1.30},
-    {0.00, 0.00, 0.00, -50.60, -1.30},
-    {0.00, 0.00, 0.00, -50.20, -1.30},
-    {0.00, 0.00, 0.00, -49.80, -1.30},
-    {0.00, 0.00, 0.00, -49.40, -1.30},
-    {0.00, 0.00, 0.00, -49.00, -1.30},
-    {0.00, 0.00, 0.00, -48.60, -1.30},
-    {0.00, 0.00, 0.00, -48.20, -1.30},
-    {0.00, 0.00, 0.00, -47.80, -1.30},
-    {0.00, 0.00, 0.00, -47.40, -1.30},
-    {0.00, 0.00, 0.00, -47.00, -1.30},
-    {0.00, 0.00, 0.00, -46.60, -1.30},
-    {0.00, 0.00, 0.00, -46.20, -1.30},
-    {0.00, 0.00, 0.00, -45.80, -1.30},
-    {0.00, 0.00, 0.00, -45.40, -1.30},
-    {0.00, 0.00, 0.00, -45.00, -1.30},
-    {0.00, 0.00, 0.00, -44.60, -1.30},
-    {0.00, 0.00, 0.00, -44.20, -1.30},
-    {0.00, 0.00, 0.00, -43.80, -1.30},
-    {0.00, 0.00, 0.00, -43.40, -1.30},
-    {0.00, 0.00, 0.00, -43.00, -1.30},
-    {0.00, 0.00, 0.00, -42.60, -1.30},
-    {0.00, 0.00, 0.00, -42.20, -1.30},
-    {0.00, 0.00, 0.00, -41.80, -1.30},
-    {0.00, 0.00, 0.00, -41.40, -1.30},
-    {0.00, 0.00, 0.00, -41.00, -1.30},
-    {0.00, 0.00, 0.00, -40.60, -1.30},
-    {0.00, 0.00, 0.00, -40.20, -1.30},
-    {0.00, 0.00, 0.00, -39.80, -1.30},
-    {0.00, 0.00, 0.00, -39.40, -1.30},
-    {0.00, 0.00, 0.00, -39.00, -1.30},
-    {0.00, 0.00, 0.00, -38.60, -1.30},
-    {0.00, 0.00, 0.00, -38.20, -1.30},
-    {0.00, 0.00, 0.00, -37.80, -1.30},
-    {0.00, 0.00, 0.00, -37.40, -1.30},
-    {0.00, 0.00, 0.00, -37.00, -1.30},
-    {0.00, 0.00, 0.00, -36.60, -1.30},
-    {0.00, 0.00, 0.00, -36.20, -1.30},
-    {0.00, 0.00, 0.00, -35.80, -1.30},
-    {0.00, 0.00, 0.00, -35.40, -1.30},
-    {0.00, 0.00, 0.00, -35.00, -1.30},
-    {0.00, 0.00, 0.00, -34.60, -1.30},
-    {0.00, 0.00, 0.00, -34.20, -1.30},
-    {0.00, 0.00, 0.00, -33.80, -1.30},
-    {0.00, 0.00, 0.00, -33.40, -1.30},
-    {0.00, 0.00, 0.00, -33.00, -1.30},
-    {0.00, 0.00, 0.00, -32.60, -1.30},
-    {0.00, 0.00, 0.00, -32.20, -1.30},
-    {0.00, 0.00, 0.00, -31.80, -1.30},
-    {0.00, 0.00, 0.00, -31.40, -1.30},
-    {0.00, 0.00, 0.00, -31.00, -1.30},
-    {0.00, 0.00, 0.00, -30.60, -1.30},
-    {0.00, 0.00, 0.00, -30.20, -1.30},
-    {0.00, 0.00, 0.00, -29.80, -1.30},
-    {0.00, 0.00, 0.00, -29.40, -1.30},
-    {0.00, 0.00, 0.00, -29.00, -1.30},
-    {0.00, 0.00, 0.00, -28.60, -1.30},
-    {0.00, 0.00, 0.00, -28.20, -1.30},
-    {0.00, 0.00, 0.00, -27.80, -1.30},
-    {0.00, 0.00, 0.00, -27.40, -1.30},
-    {0.00, 0.00, 0.00, -27.00, -1.30},
-    {0.00, 0.00, 0.00, -26.60, -1.30},
-    {0.00, 0.00, 0.00, -26.20, -1.30},
-    {0.00, 0.00, 0.00, -25.80, -1.30},
-    {0.00, 0.00, 0.00, -25.40, -1.30},
-    {0.00, 0.00, 0.00, -25.00, -1.30},
-    {0.00, 0.00, 0.00, -24.60, -1.30},
-    {0.00, 0.00, 0.00, -24.20, -1.30},
-    {0.00, 0.00, 0.00, -23.80, -1.30},
-    {0.00, 0.00, 0.00, -23.40, -1.30},
-    {0.00, 0.00, 0.00, -23.00, -1.30},
-    {0.00, 0.00, 0.00, -22.60, -1.30},
-    {0.00, 0.00, 0.00, -22.20, -1.30},
-    {0.00, 0.00, 0.00, -21.80, -1.30},
-    {0.00, 0.00, 0.00, -21.40, -1.30},
-    {0.00, 0.00, 0.00, -21.00, -1.30},
-    {0.00, 0.00, 0.00, -20.60, -1.30},
-    {0.00, 0.00, 0.00, -20.20, -1.30},
-    {0.00, 0.00, 0.00, -19.80, -1.30},
-    {0.00, 0.00, 0.00, -19.40, -1.30},
-    {0.00, 0.00, 0.00, -19.00, -1.30},
-    {0.00, 0.00, 0.00, -18.60, -1.30},
-    {0.00, 0.00, 0.00, -18.20, -1.30},
-    {0.00, 0.00, 0.00, -17.80, -1.30},
-    {0.00, 0.00, 0.00, -17.40, -1.30},
-    {0.00, 0.00, 0.00, -17.00, -1.30},
-    {0.00, 0.00, 0.00, -16.60, -1.30},
-    {0.00, 0.00, 0.00, -16.20, -1.30},
-    {0.00, 0.00, 0.00, -15.80, -1.30},
-    {0.00, 0.00, 0.00, -15.40, -1.30},
-    {0.00, 0.00, 0.00, -15.00, -1.30},
-    {0.00, 0.00, 0.00, -14.60, -1.30},
-    {0.00, 0.00, 0.00, -14.20, -1.30},
-    {0.00, 0.00, 0.00, -13.80, -1.30},
-    {0.00, 0.00, 0.00, -13.40, -1.30},
-    {0.00, 0.00, 0.00, -13.00, -1.30},
-    {0.00, 0.00, 0.00, -12.60, -1.30},
-    {0.00, 0.00, 0.00, -12.20, -1.30},
-    {0.00, 0.00, 0.00, -11.80, -1.30},
-    {0.00, 0.00, 0.00, -11.40, -1.30},
-    {0.00, 0.00, 0.00, -11.00, -1.30},
-    {0.00, 0.00, 0.00, -10.60, -1.30},
-    {0.00, 0.00, 0.00, -10.20, -1.30},
-    {0.00, 0.00, 0.00, -9.80, -1.30},
-    {0.00, 0.00, 0.00, -9.40, -1.30},
-    {0.00, 0.00, 0.00, -9.00, -1.30},
-    {0.00, 0.00, 0.00, -8.60, -1.30},
-    {0.00, 0.00, 0.00, -8.20, -1.30},
-    {0.00, 0.00, 0.00, -7.80, -1.30},
-    {0.00, 0.00, 0.00, -7.40, -1.30},
-    {0.00, 0.00, 0.00, -7.00, -1.30},
-    {0.00, 0.00, 0.00, -6.60, -1.30},
-    {0.00, 0.00, 0.00, -6.20, -1.30},
-    {0.00, 0.00, 0.00, -5.80, -1.30},
-    {0.00, 0.00, 0.00, -5.40, -1.30},
-    {0.00, 0.00, 0.00, -5.00, -1.30},
-    {0.00, 0.00, 0.00, -4.60, -1.30},
-    {0.00, 0.00, 0.00, -4.20, -1.30},
-    {0.00, 0.00, 0.00, -3.80, -1.30},
-    {0.00, 0.00, 0.00, -3.40, -1.30},
-    {0.00, 0.00, 0.00, -3.00, -1.30},
-    {0.00, 0.00, 0.00, -2.60, -1.30},
-    {0.00, 0.00, 0.00, -2.20, -1.30},
-    {0.00, 0.00, 0.00, -1.80, -1.30},
-    {0.00, 0.00, 0.00, -1.40, -1.30},
-    {0.00, 0.00, 0.00, -1.00, -1.30},
-    {0.00, 0.00, 0.00, -0.60, -1.30},
-    {0.00, 0.00, 0.00, -0.20, -1.30},
-    {0.00, 0.00, 0.00, 0.20, -1.30},
-    {0.00, 0.00, 0.00, 0.60, -1.30},
-    {0.00, 0.00, 0.00, 1.00, -1.30},
-    {0.00, 0.00, 0.00, 1.40, -1.30},
-    {0.00, 0.00, 0.00, 1.80, -1.30},
-    {0.00, 0.00, 0.00, 2.20, -1.30},
-    {0.00, 0.00, 0.00, 2.60, -1.30},
-    {0.00, 0.00, 0.00, 3.00, -1.30},
-    {0.00, 0.00, 0.00, 3.40, -1.30},
-    {0.00, 0.00, 0.00, 3.80, -1.30},
-    {0.00, 0.00, 0.00, 4.20, -1.30},
-    {0.00, 0.00, 0.00, 4.60, -1.30},
-    {0.00, 0.00, 0.00, 5.00, -1.30},
-    {0.00, 0.00, 0.00, 5.40, -1.30},
-    {0.00, 0.00, 0.00, 5.80, -1.30},
-    {0.00, 0.00, 0.00, 6.20, -1.30},
-    {0.00, 0.00, 0.00, 6.60, -1.30},
-    {0.00, 0.00, 0.00, 7.00, -1.30},
-    {0.00, 0.00, 0.00, 7.40, -1.30},
-    {0.00, 0.00, 0.00, 7.80, -1.30},
-    {0.00, 0.00, 0.00, 8.20, -1.30},
-    {0.00, 0.00, 0.00, 8.60, -1.30},
-    {0.00, 0.00, 0.00, 9.00, -1.30},
-    {0.00, 0.00, 0.00, 9.40, -1.30},
-    {0.00, 0.00, 0.00, 9.80, -1.30},
-    {0.00, 0.00, 0.00, 10.20, -1.30},
-    {0.00, 0.00, 0.00, 10.60, -1.30},
-    {0.00, 0.00, 0.00, 11.00, -1.30},
-    {0.00, 0.00, 0.00, 11.40, -1.30},
-    {0.00, 0.00, 0.00, 11.80, -1.30},
-    {0.00, 0.00, 0.00, 12.20, -1.30},
-    {0.00, 0.00, 0.00, 12.60, -1.30},
-    {0.00, 0.00, 0.00, 13.00, -1.30},
-    {0.00, 0.00, 0.00, 13.40, -1.30},
-    {0.00, 0.00, 0.00, 13.80, -1.30},
-    {0.00, 0.00, 0.00, 14.20, -1.30},
-    {0.00, 0.00, 0.00, 14.60, -1.30},
-    {0.00, 0.00, 0.00, 15.00, -1.30},
-    {0.00, 0.00, 0.00, 15.40, -1.30},
-    {0.00, 0.00, 0.00, 15.80, -1.30},
-    {0.00, 0.00, 0.00, 16.20, -1.30},
-    {0.00, 0.00, 0.00, 16.60, -1.30},
-    {0.00, 0.00, 0.00, 17.00, -1.30},
-    {0.00, 0.00, 0.00, 17.40, -1.30},
-    {0.00, 0.00, 0.00, 17.80, -1.30},
-    {0.00, 0.00, 0.00, 18.20, -1.30},
-    {0.00, 0.00, 0.00, 18.60, -1.30},
-    {0.00, 0.00, 0.00, 19.00, -1.30},
-    {0.00, 0.00, 0.00, 19.40, -1.30},
-    {0.00, 0.00, 0.00, 19.80, -1.30},
-    {0.00, 0.00, 0.00, 20.20, -1.30},
-    {0.00, 0.00, 0.00, 20.60, -1.30},
-    {0.00, 0.00, 0.00, 21.00, -1.30},
-    {0.00, 0.00, 0.00, 21.40, -1.30},
-    {0.00, 0.00, 0.00, 21.80, -1.30},
-    {0.00, 0.00, 0.00, 22.20, -1.30},
-    {0.00, 0.00, 0.00, 22.60, -1.30},
-    {0.00, 0.00, 0.00, 23.00, -1.30},
-    {0.00, 0.00, 0.00, 23.40, -1.30},
-    {0.00, 0.00, 0.00, 23.80, -1.30},
-    {0.00, 0.00, 0.00, 24.20, -1.30},
-    {0.00, 0.00, 0.00, 24.60, -1.30},
-    {0.00, 0.00, 0.00, 25.00, -1.30},
-    {0.00, 0.00, 0.00, 25.40, -1.30},
-    {0.00, 0.00, 0.00, 25.80, -1.30},
-    {0.00, 0.00, 0.00, 26.20, -1.30},
-    {0.00, 0.00, 0.00, 26.60, -1.30},
-    {0.00, 0.00, 0.00, 27.00, -1.30},
-    {0.00, 0.00, 0.00, 27.40, -1.30},
-    {0.00, 0.00, 0.00, 27.80, -1.30},
-    {0.00, 0.00, 0.00, 28.20, -1.30},
-    {0.00, 0.00, 0.00, 28.60, -1.30},
-    {0.00, 0.00, 0.00, 29.00, -1.30},
-    {0.00, 0.00, 0.00, 29.40, -1.30},
-    {0.00, 0.00, 0.00, 29.80, -1.30},
-    {0.00, 0.00, 0.00, 30.20, -1.30},
-    {0.00, 0.00, 0.00, 30.60, -1.30},
-    {0.00, 0.00, 0.00, 31.00, -1.30},
-    {0.00, 0.00, 0.00, 31.40, -1.30},
-    {0.00, 0.00, 0.00, 31.80, -1.30},
-    {0.00, 0.00, 0.00, 32.20, -1.30},
-    {0.00, 0.00, 0.00, 32.60, -1.30},
-    {0.00, 0.00, 0.00, 33.00, -1.30},
-    {0.00, 0.00, 0.00, 33.40, -1.30},
-    {0.00, 0.00, 0.00, 33.80, -1.30},
-    {0.00, 0.00, 0.00, 34.20, -1.30},
-    {0.00, 0.00, 0.00, 34.60, -1.30},
-    {0.00, 0.00, 0.00, 35.00, -1.30},
-    {0.00, 0.00, 0.00, 35.40, -1.30},
-    {0.00, 0.00, 0.00, 35.80, -1.30},
-    {0.00, 0.00, 0.00, 36.20, -1.30},
-    {0.00, 0.00, 0.00, 36.60, -1.30},
-    {0.00, 0.00, 0.00, 37.00, -1.30},
-    {0.00, 0.00, 0.00, 37.40, -1.30},
-    {0.00, 0.00, 0.00, 37.80, -1.30},
-    {0.00, 0.00, 0.00, 38.20, -1.30},
-    {0.00, 0.00, 0.00, 38.60, -1.30},
-    {0.00, 0.00, 0.00, 39.00, -1.30},
-    {0.00, 0.00, 0.00, 39.40, -1.30},
-    {0.00, 0.00, 0.00, 39.80, -1.30},
-    {0.00, 0.00, 0.00, 40.20, -1.30},
-    {0.00, 0.00, 0.00, 40.60, -1.30},
-    {0.00, 0.00, 0.00, 41.00, -1.30},
-    {0.00, 0.00, 0.00, 41.40, -1.30},
-    {0.00, 0.00, 0.00, 41.80, -1.30},
-    {0.00, 0.00, 0.00, 42.20, -1.30},
-    {0.00, 0.00, 0.00, 42.60, -1.30},
-    {0.00, 0.00, 0.00, 43.00, -1.30},
-    {0.00, 0.00, 0.00, 43.40, -1.30},
-    {0.00, 0.00, 0.00, 43.80, -1.30},
-    {0.00, 0.00, 0.00, 44.20, -1.30},
-    {0.00, 0.00, 0.00, 44.60, -1.30},
-    {0.00, 0.00, 0.00, 45.00, -1.30},
-    {0.00, 0.00, 0.00, 45.40, -1.30},
-    {0.00, 0.00, 0.00, 45.80, -1.30},
-    {0.00, 0.00, 0.00, 46.20, -1.30},
-    {0.00, 0.00, 0.00, 46.60, -1.30},
-    {0.00, 0.00, 0.00, 47.00, -1.30},
-    {0.00, 0.00, 0.00, 47.40, -1.30},
-    {0.00, 0.00, 0.00, 47.80, -1.30},
-    {0.00, 0.00, 0.00, 48.20, -1.30},
-    {0.00, 0.00, 0.00, 48.60, -1.30},
-    {0.00, 0.00, 0.00, 49.00, -1.30},
-    {0.00, 0.00, 0.00, 49.40, -1.30},
-    {0.00, 0.00, 0.00, 49.80, -1.30},
-    {0.00, 0.00, 0.00, 50.20, -1.30},
-    {0.00, 0.00, 0.00, 50.60, -1.30},
-    {0.00, 0.00, 0.00, 51.00, -1.30},
-    {0.00, 0.00, 0.00, 51.40, -1.30},
-    {0.00, 0.00, 0.00, 51.80, -1.30},
-    {0.00, 0.00, 0.00, 52.20, -1.30},
-    {0.00, 0.00, 0.00, 52.60, -1.30},
-    {0.00, 0.00, 0.00, 53.00, -1.30},
-    {0.00, 0.00, 0.00, 53.40, -1.30},
-    {0.00, 0.00, 0.00, 53.80, -1.30},
-    {0.00, 0.00, 0.00, 54.20, -1.30},
-    {0.00, 0.00, 0.00, 54.60, -1.30},
-    {0.00, 0.00, 0.00, 55.00, -1.30},
-    {0.00, 0.00, 0.00, 55.40, -1.30},
-    {0.00, 0.00, 0.00, 55.80, -1.30},
-    {0.00, 0.00, 0.00, 56.20, -1.30},
-    {0.00, 0.00, 0.00, 56.60, -1.30},
-    {0.00, 0.00, 0.00, 57.00, -1.30},
-    {0.00, 0.00, 0.00, 57.40, -1.30},
-    {0.00, 0.00, 0.00, 57.80, -1.30},
-    {0.00, 0.00, 0.00, 58.20, -1.30},
-    {0.00, 0.00, 0.00, 58.60, -1.30},
-    {0.00, 0.00, 0.00, 59.00, -1.30},
-    {0.00, 0.00, 0.00, 59.40, -1.30},
-    {0.00, 0.00, 0.00, 59.80, -1.30},
-    {0.00, 0.00, 0.00, -59.80, -1.10},
-    {0.00, 0.00, 0.00, -59.40, -1.10},
-    {0.00, 0.00, 0.00, -59.00, -1.10},
-    {0.00, 0.00, 0.00, -58.60, -1.10},
-    {0.00, 0.00, 0.00, -58.20, -1.10},
-    {0.00, 0.00, 0.00, -57.80, -1.10},
-    {0.00, 0.00, 0.00, -57.40, -1.10},
-    {0.00, 0.00, 0.00, -57.00, -1.10},
-    {0.00, 0.00, 0.00, -56.60, -1.10},
-    {0.00, 0.00, 0.00, -56.20, -1.10},
-    {0.00, 0.00, 0.00, -55.80, -1.10},
-    {0.00, 0.00, 0.00, -55.40, -1.10},
-    {0.00, 0.00, 0.00, -55.00, -1.10},
-    {0.00, 0.00, 0.00, -54.60, -1.10},
-    {0.00, 0.00, 0.00, -54.20, -1.10},
-    {0.00, 0.00, 0.00, -53.80, -1.10},
-    {0.00, 0.00, 0.00, -53.40, -1.10},
-    {0.00, 0.00, 0.00, -53.00, -1.10},
-    {0.00, 0.00, 0.00, -52.60, -1.10},
-    {0.00, 0.00, 0.00, -52.20, -1.10},
-    {0.00, 0.00, 0.00, -51.80, -1.10},
-    {0.00, 0.00, 0.00, -51.40, -1.10},
-    {0.00, 0.00, 0.00, -51.00, -1.10},
-    {0.00, 0.00, 0.00, -50.60, -1.10},
-    {0.00, 0.00, 0.00, -50.20, -1.10},
-    {0.00, 0.00, 0.00, -49.80, -1.10},
-    {0.00, 0.00, 0.00, -49.40, -1.10},
-    {0.00, 0.00, 0.00, -49.00, -1.10},
-    {0.00, 0.00, 0.00, -48.60, -1.10},
-    {0.00, 0.00, 0.00, -48.20, -1.10},
-    {0.00, 0.00, 0.00, -47.80, -1.10},
-    {0.00, 0.00, 0.00, -47.40, -1.10},
-    {0.00, 0.00, 0.00, -47.00, -1.10},
-    {0.00, 0.00, 0.00, -46.60, -1.10},
-    {0.00, 0.00, 0.00, -46.20, -1.10},
-    {0.00, 0.00, 0.00, -45.80, -1.10},
-    {0.00, 0.00, 0.00, -45.40, -1.10},
-    {0.00, 0.00, 0.00, -45.00, -1.10},
-    {0.00, 0.00, 0.00, -44.60, -1.10},
-    {0.00, 0.00, 0.00, -44.20, -1.10},
-    {0.00, 0.00, 0.00, -43.80, -1.10},
-    {0.00, 0.00, 0.00, -43.40, -1.10},
-    {0.00, 0.00, 0.00, -43.00, -1.10},
-    {0.00, 0.00, 0.00, -42.60, -1.10},
-    {0.00, 0.00, 0.00, -42.20, -1.10},
-    {0.00, 0.00, 0.00, -41.80, -1.10},
-    {0.00, 0.00, 0.00, -41.40, -1.10},
-    {0.00, 0.00, 0.00, -41.00, -1.10},
-    {0.00, 0.00, 0.00, -40.60, -1.10},
-    {0.00, 0.00, 0.00, -40.20, -1.10},
-    {0.00, 0.00, 0.00, -39.80, -1.10},
-    {0.00, 0.00, 0.00, -39.40, -1.10},
-    {0.00, 0.00, 0.00, -39.00, -1.10},
-    {0.00, 0.00, 0.00, -38.60, -1.10},
-    {0.00, 0.00, 0.00, -38.20, -1.10},
-    {0.00, 0.00, 0.00, -37.80, -1.10},
-    {0.00, 0.00, 0.00, -37.40, -1.10},
-    {0.00, 0.00, 0.00, -37.00, -1.10},
-    {0.00, 0.00, 0.00, -36.60, -1.10},
-    {0.00, 0.00, 0.00, -36.20, -1.10},
-    {0.00, 0.00, 0.00, -35.80, -1.10},
-    {0.00, 0.00, 0.00, -35.40, -1.10},
-    {0.00, 0.00, 0.00, -35.00, -1.10},
-    {0.00, 0.00, 0.00, -34.60, -1.10},
-    {0.00, 0.00, 0.00, -34.20, -1.10},
-    {0.00, 0.00, 0.00, -33.80, -1.10},
-    {0.00, 0.00, 0.00, -33.40, -1.10},
-    {0.00, 0.00, 0.00, -33.00, -1.10},
-    {0.00, 0.00, 0.00, -32.60, -1.10},
-    {0.00, 0.00, 0.00, -32.20, -1.10},
-    {0.00, 0.00, 0.00, -31.80, -1.10},
-    {0.00, 0.00, 0.00, -31.40, -1.10},
-    {0.00, 0.00, 0.00, -31.00, -1.10},
-    {0.00, 0.00, 0.00, -30.60, -1.10},
-    {0.00, 0.00, 0.00, -30.20, -1.10},
-    {0.00, 0.00, 0.00, -29.80, -1.10},
-    {0.00, 0.00, 0.00, -29.40, -1.10},
-    {0.00, 0.00, 0.00, -29.00, -1.10},
-    {0.00, 0.00, 0.00, -28.60, -1.10},
-    {0.00, 0.00, 0.00, -28.20, -1.10},
-    {0.00, 0.00, 0.00, -27.80, -1.10},
-    {0.00, 0.00, 0.00, -27.40, -1.10},
-    {0.00, 0.00, 0.00, -27.00, -1.10},
-    {0.00, 0.00, 0.00, -26.60, -1.10},
-    {0.00, 0.00, 0.00, -26.20, -1.10},
-    {0.00, 0.00, 0.00, -25.80, -1.10},
-    {0.00, 0.00, 0.00, -25.40, -1.10},
-    {0.00, 0.00, 0.00, -25.00, -1.10},
-    {0.00, 0.00, 0.00, -24.60, -1.10},
-    {0.00, 0.00, 0.00, -24.20, -1.10},
-    {0.00, 0.00, 0.00, -23.80, -1.10},
-    {0.00, 0.00, 0.00, -23.40, -1.10},
-    {0.00, 0.00, 0.00, -23.00, -1.10},
-    {0.00, 0.00, 0.00, -22.60, -1.10},
-    {0.00, 0.00, 0.00, -22.20, -1.10},
-    {0.00, 0.00, 0.00, -21.80, -1.10},
-    {0.00, 0.00, 0.00, -21.40, -1.10},
-    {0.00, 0.00, 0.00, -21.00, -1.10},
-    {0.00, 0.00, 0.00, -20.60, -1.10},
-    {0.00, 0.00, 0.00, -20.20, -1.10},
-    {0.00, 0.00, 0.00, -19.80, -1.10},
-    {0.00, 0.00, 0.00, -19.40, -1.10},
-    {0.00, 0.00, 0.00, -19.00, -1.10},
-    {0.00, 0.00, 0.00, -18.60, -1.10},
-    {0.00, 0.00, 0.00, -18.20, -1.10},
-    {0.00, 0.00, 0.00, -17.80, -1.10},
-    {0.00, 0.00, 0.00, -17.40, -1.10},
-    {0.00, 0.00, 0.00, -17.00, -1.10},
-    {0.00, 0.00, 0.00, -16.60, -1.10},
-    {0.00, 0.00, 0.00, -16.20, -1.10},
-    {0.00, 0.00, 0.00, -15.80, -1.10},
-    {0.00, 0.00, 0.00, -15.40, -1.10},
-    {0.00, 0.00, 0.00, -15.00, -1.10},
-    {0.00, 0.00, 0.00, -14.60, -1.10},
-    {0.00, 0.00, 0.00, -14.20, -1.10},
-    {0.00, 0.00, 0.00, -13.80, -1.10},
-    {0.00, 0.00, 0.00, -13.40, -1.10},
-    {0.00, 0.00, 0.00, -13.00, -1.10},
-    {0.00, 0.00, 0.00, -12.60, -1.10},
-    {0.00, 0.00, 0.00, -12.20, -1.10},
-    {0.00, 0.00, 0.00, -11.80, -1.10},
-    {0.00, 0.00, 0.00, -11.40, -1.10},
-    {0.00, 0.00, 0.00, -11.00, -1.10},
-    {0.00, 0.00, 0.00, -10.60, -1.10},
-    {0.00, 0.00, 0.00, -10.20, -1.10},
-    {0.00, 0.00, 0.00, -9.80, -1.10},
-    {0.00, 0.00, 0.00, -9.40, -1.10},
-    {0.00, 0.00, 0.00, -9.00, -1.10},
-    {0.00, 0.00, 0.00, -8.60, -1.10},
-    {0.00, 0.00, 0.00, -8.20, -1.10},
-    {0.00, 0.00, 0.00, -7.80, -1.10},
-    {0.00, 0.00, 0.00, -7.40, -1.10},
-    {0.00, 0.00, 0.00, -7.00, -1.10},
-    {0.00, 0.00, 0.00, -6.60, -1.10},
-    {0.00, 0.00, 0.00, -6.20, -1.10},
-    {0.00, 0.00, 0.00, -5.80, -1.10},
-    {0.00, 0.00, 0.00, -5.40, -1.10},
-    {0.00, 0.00, 0.00, -5.00, -1.10},
-    {0.00, 0.00, 0.00, -4.60, -1.10},
-    {0.00, 0.00, 0.00, -4.20, -1.10},
-    {0.00, 0.00, 0.00, -3.80, -1.10},
-    {0.00, 0.00, 0.00, -3.40, -1.10},
-    {0.00, 0.00, 0.00, -3.00, -1.10},
-    {0.00, 0.00, 0.00, -2.60, -1.10},
-    {0.00, 0.00, 0.00, -2.20, -1.10},
-    {0.00, 0.00, 0.00, -1.80, -1.10},
-    {0.00, 0.00, 0.00, -1.40, -1.10},
-    {0.00, 0.00, 0.00, -1.00, -1.10},
-    {0.00, 0.00, 0.00, -0.60, -1.10},
-    {0.00, 0.00, 0.00, -0.20, -1.10},
-    {0.00, 0.00, 0.00, 0.20, -1.10},
-    {0.00, 0.00, 0.00, 0.60, -1.10},
-    {0.00, 0.00, 0.00, 1.00, -1.10},
-    {0.00, 0.00, 0.00, 1.40, -1.10},
-    {0.00, 0.00, 0.00, 1.80, -1.10},
-    {0.00, 0.00, 0.00, 2.20, -1.10},
-    {0.00, 0.00, 0.00, 2.60, -1.10},
-    {0.00, 0.00, 0.00, 3.00, -1.10},
-    {0.00, 0.00, 0.00, 3.40, -1.10},
-    {0.00, 0.00, 0.00, 3.80, -1.10},
-    {0.00, 0.00, 0.00, 4.20, -1.10},
-    {0.00, 0.00, 0.00, 4.60, -1.10},
-    {0.00, 0.00, 0.00, 5.00, -1.10},
-    {0.00, 0.00, 0.00, 5.40, -1.10},
-    {0.00, 0.00, 0.00, 5.80, -1.10},
-    {0.00, 0.00, 0.00, 6.20, -1.10},
-    {0.00, 0.00, 0.00, 6.60, -1.10},
-    {0.00, 0.00, 0.00, 7.00, -1.10},
-    {0.00, 0.00, 0.00, 7.40, -1.10},
-    {0.00, 0.00, 0.00, 7.80, -1.10},
-    {0.00, 0.00, 0.00, 8.20, -1.10},
-    {0.00, 0.00, 0.00, 8.60, -1.10},
-    {0.00, 0.00, 0.00, 9.00, -1.10},
-    {0.00, 0.00, 0.00, 9.40, -1.10},
-    {0.00, 0.00, 0.00, 9.80, -1.10},
-    {0.00, 0.00, 0.00, 10.20, -1.10},
-    {0.00, 0.00, 0.00, 10.60, -1.10},
-    {0.00, 0.00, 0.00, 11.00, -1.10},
-    {0.00, 0.00, 0.00, 11.40, -1.10},
-    {0.00, 0.00, 0.00, 11.80, -1.10},
-    {0.00, 0.00, 0.00, 12.20, -1.10},
-    {0.00, 0.00, 0.00, 12.60, -1.10},
-    {0.00, 0.00, 0.00, 13.00, -1.10},
-    {0.00, 0.00, 0.00, 13.40, -1.10},
-    {0.00, 0.00, 0.00, 13.80, -1.10},
-    {0.00, 0.00, 0.00, 14.20, -1.10},
-    {0.00, 0.00, 0.00, 14.60, -1.10},
-    {0.00, 0.00, 0.00, 15.00, -1.10},
-    {0.00, 0.00, 0.00, 15.40, -1.10},
-    {0.00, 0.00, 0.00, 15.80, -1.10},
-    {0.00, 0.00, 0.00, 16.20, -1.10},
-    {0.00, 0.00, 0.00, 16.60, -1.10},
-    {0.00, 0.00, 0.00, 17.00, -1.10},
-    {0.00, 0.00, 0.00, 17.40, -1.10},
-    {0.00, 0.00, 0.00, 17.80, -1.10},
-    {0.00, 0.00, 0.00, 18.20, -1.10},
-    {0.00, 0.00, 0.00, 18.60, -1.10},
-    {0.00, 0.00, 0.00, 19.00, -1.10},
-    {0.00, 0.00, 0.00, 19.40, -1.10},
-    {0.00, 0.00, 0.00, 19.80, -1.10},
-    {0.00, 0.00, 0.00, 20.20, -1.10},
-    {0.00, 0.00, 0.00, 20.60, -1.10},
-    {0.00, 0.00, 0.00, 21.00, -1.10},
-    {0.00, 0.00, 0.00, 21.40, -1.10},
-    {0.00, 0.00, 0.00, 21.80, -1.10},
-    {0.00, 0.00, 0.00, 22.20, -1.10},
-    {0.00, 0.00, 0.00, 22.60, -1.10},
-    {0.00, 0.00, 0.00, 23.00, -1.10},
-    {0.00, 0.00, 0.00, 23.40, -1.10},
-    {0.00, 0.00, 0.00, 23.80, -1.10},
-    {0.00, 0.00, 0.00, 24.20, -1.10},
-    {0.00, 0.00, 0.00, 24.60, -1.10},
-    {0.00, 0.00, 0.00, 25.00, -1.10},
-    {0.00, 0.00, 0.00, 25.40, -1.10},
-    {0.00, 0.00, 0.00, 25.80, -1.10},
-    {0.00, 0.00, 0.00, 26.20, -1.10},
-    {0.00, 0.00, 0.00, 26.60, -1.10},
-    {0.00, 0.00, 0.00, 27.00, -1.10},
-    {0.00, 0.00, 0.00, 27.40, -1.10},
-    {0.00, 0.00, 0.00, 27.80, -1.10},
-    {0.00, 0.00, 0.00, 28.20, -1.10},
-    {0.00, 0.00, 0.00, 28.60, -1.10},
-    {0.00, 0.00, 0.00, 29.00, -1.10},
-    {0.00, 0.00, 0.00, 29.40, -1.10},
-    {0.00, 0.00, 0.00, 29.80, -1.10},
-    {0.00, 0.00, 0.00, 30.20, -1.10},
-    {0.00, 0.00, 0.00, 30.60, -1.10},
-    {0.00, 0.00, 0.00, 31.00, -1.10},
-    {0.00, 0.00, 0.00, 31.40, -1.10},
-    {0.00, 0.00, 0.00, 31.80, -1.10},
-    {0.00, 0.00, 0.00, 32.20, -1.10},
-    {0.00, 0.00, 0.00, 32.60, -1.10},
-    {0.00, 0.00, 0.00, 33.00, -1.10},
-    {0.00, 0.00, 0.00, 33.40, -1.10},
-    {0.00, 0.00, 0.00, 33.80, -1.10},
-    {0.00, 0.00, 0.00, 34.20, -1.10},
-    {0.00, 0.00, 0.00, 34.60, -1.10},
-    {0.00, 0.00, 0.00, 35.00, -1.10},
-    {0.00, 0.00, 0.00, 35.40, -1.10},
-    {0.00, 0.00, 0.00, 35.80, -1.10},
-    {0.00, 0.00, 0.00, 36.20, -1.10},
-    {0.00, 0.00, 0.00, 36.60, -1.10},
-    {0.00, 0.00, 0.00, 37.00, -1.10},
-    {0.00, 0.00, 0.00, 37.40, -1.10},
-    {0.00, 0.00, 0.00, 37.80, -1.10},
-    {0.00, 0.00, 0.00, 38.20, -1.10},
-    {0.00, 0.00, 0.00, 38.60, -1.10},
-    {0.00, 0.00, 0.00, 39.00, -1.10},
-    {0.00, 0.00, 0.00, 39.40, -1.10},
-    {0.00, 0.00, 0.00, 39.80, -1.10},
-    {0.00, 0.00, 0.00, 40.20, -1.10},
-    {0.00, 0.00, 0.00, 40.60, -1.10},
-    {0.00, 0.00, 0.00, 41.00, -1.10},
-    {0.00, 0.00, 0.00, 41.40, -1.10},
-    {0.00, 0.00, 0.00, 41.80, -1.10},
-    {0.00, 0.00, 0.00, 42.20, -1.10},
-    {0.00, 0.00, 0.00, 42.60, -1.10},
-    {0.00, 0.00, 0.00, 43.00, -1.10},
-    {0.00, 0.00, 0.00, 43.40, -1.10},
-    {0.00, 0.00, 0.00, 43.80, -1.10},
-    {0.00, 0.00, 0.00, 44.20, -1.10},
-    {0.00, 0.00, 0.00, 44.60, -1.10},
-    {0.00, 0.00, 0.00, 45.00, -1.10},
-    {0.00, 0.00, 0.00, 45.40, -1.10},
-    {0.00, 0.00, 0.00, 45.80, -1.10},
-    {0.00, 0.00, 0.00, 46.20, -1.10},
-    {0.00, 0.00, 0.00, 46.60, -1.10},
-    {0.00, 0.00, 0.00, 47.00, -1.10},
-    {0.00, 0.00, 0.00, 47.40, -1.10},
-    {0.00, 0.00, 0.00, 47.80, -1.10},
-    {0.00, 0.00, 0.00, 48.20, -1.10},
-    {0.00, 0.00, 0.00, 48.60, -1.10},
-    {0.00, 0.00, 0.00, 49.00, -1.10},
-    {0.00, 0.00, 0.00, 49.40, -1.10},
-    {0.00, 0.00, 0.00, 49.80, -1.10},
-    {0.00, 0.00, 0.00, 50.20, -1.10},
-    {0.00, 0.00, 0.00, 50.60, -1.10},
-    {0.00, 0.00, 0.00, 51.00, -1.10},
-    {0.00, 0.00, 0.00, 51.40, -1.10},
-    {0.00, 0.00, 0.00, 51.80, -1.10},
-    {0.00, 0.00, 0.00, 52.20, -1.10},
-    {0.00, 0.00, 0.00, 52.60, -1.10},
-    {0.00, 0.00, 0.00, 53.00, -1.10},
-    {0.00, 0.00, 0.00, 53.40, -1.10},
-    {0.00, 0.00, 0.00, 53.80, -1.10},
-    {0.00, 0.00, 0.00, 54.20, -1.10},
-    {0.00, 0.00, 0.00, 54.60, -1.10},
-    {0.00, 0.00, 0.00, 55.00, -1.10},
-    {0.00, 0.00, 0.00, 55.40, -1.10},
-    {0.00, 0.00, 0.00, 55.80, -1.10},
-    {0.00, 0.00, 0.00, 56.20, -1.10},
-    {0.00, 0.00, 0.00, 56.60, -1.10},
-    {0.00, 0.00, 0.00, 57.00, -1.10},
-    {0.00, 0.00, 0.00, 57.40, -1.10},
-    {0.00, 0.00, 0.00, 57.80, -1.10},
-    {0.00, 0.00, 0.00, 58.20, -1.10},
-    {0.00, 0.00, 0.00, 58.60, -1.10},
-    {0.00, 0.00, 0.00, 59.00, -1.10},
-    {0.00, 0.00, 0.00, 59.40, -1.10},
-    {0.00, 0.00, 0.00, 59.80, -1.10},
-    {0.00, 0.00, 0.00, -59.80, -0.90},
-    {0.00, 0.00, 0.00, -59.40, -0.90},
-    {0.00, 0.00, 0.00, -59.00, -0.90},
-    {0.00, 0.00, 0.00, -58.60, -0.90},
-    {0.00, 0.00, 0.00, -58.20, -0.90},
-    {0.00, 0.00, 0.00, -57.80, -0.90},
-    {0.00, 0.00, 0.00, -57.40, -0.90},
-    {0.00, 0.00, 0.00, -57.00, -0.90},
-    {0.00, 0.00, 0.00, -56.60, -0.90},
-    {0.00, 0.00, 0.00, -56.20, -0.90},
-    {0.00, 0.00, 0.00, -55.80, -0.90},
-    {0.00, 0.00, 0.00, -55.40, -0.90},
-    {0.00, 0.00, 0.00, -55.00, -0.90},
-    {0.00, 0.00, 0.00, -54.60, -0.90},
-    {0.00, 0.00, 0.00, -54.20, -0.90},
-    {0.00, 0.00, 0.00, -53.80, -0.90},
-    {0.00, 0.00, 0.00, -53.40, -0.90},
-    {0.00, 0.00, 0.00, -53.00, -0.90},
-    {0.00, 0.00, 0.00, -52.60, -0.90},
-    {0.00, 0.00, 0.00, -52.20, -0.90},
-    {0.00, 0.00, 0.00, -51.80, -0.90},
-    {0.00, 0.00, 0.00, -51.40, -0.90},
-    {0.00, 0.00, 0.00, -51.00, -0.90},
-    {0.00, 0.00, 0.00, -50.60, -0.90},
-    {0.00, 0.00, 0.00, -50.20, -0.90},
-    {0.00, 0.00, 0.00, -49.80, -0.90},
-    {0.00, 0.00, 0.00, -49.40, -0.90},
-    {0.00, 0.00, 0.00, -49.00, -0.90},
-    {0.00, 0.00, 0.00, -48.60, -0.90},
-    {0.00, 0.00, 0.00, -48.20, -0.90},
-    {0.00, 0.00, 0.00, -47.80, -0.90},
-    {0.00, 0.00, 0.00, -47.40, -0.90},
-    {0.00, 0.00, 0.00, -47.00, -0.90},
-    {0.00, 0.00, 0.00, -46.60, -0.90},
-    {0.00, 0.00, 0.00, -46.20, -0.90},
-    {0.00, 0.00, 0.00, -45.80, -0.90},
-    {0.00, 0.00, 0.00, -45.40, -0.90},
-    {0.00, 0.00, 0.00, -45.00, -0.90},
-    {0.00, 0.00, 0.00, -44.60, -0.90},
-    {0.00, 0.00, 0.00, -44.20, -0.90},
-    {0.00, 0.00, 0.00, -43.80, -0.90},
-    {0.00, 0.00, 0.00, -43.40, -0.90},
-    {0.00, 0.00, 0.00, -43.00, -0.90},
-    {0.00, 0.00, 0.00, -42.60, -0.90},
-    {0.00, 0.00, 0.00, -42.20, -0.90},
-    {0.00, 0.00, 0.00, -41.80, -0.90},
-    {0.00, 0.00, 0.00, -41.40, -0.90},
-    {0.00, 0.00, 0.00, -41.00, -0.90},
-    {0.00, 0.00, 0.00, -40.60, -0.90},
-    {0.00, 0.00, 0.00, -40.20, -0.90},
-    {0.00, 0.00, 0.00, -39.80, -0.90},
-    {0.00, 0.00, 0.00, -39.40, -0.90},
-    {0.00, 0.00, 0.00, -39.00, -0.90},
-    {0.00, 0.00, 0.00, -38.60, -0.90},
-    {0.00, 0.00, 0.00, -38.20, -0.90},
-    {0.00, 0.00, 0.00, -37.80, -0.90},
-    {0.00, 0.00, 0.00, -37.40, -0.90},
-    {0.00, 0.00, 0.00, -37.00, -0.90},
-    {0.00, 0.00, 0.00, -36.60, -0.90},
-    {0.00, 0.00, 0.00, -36.20, -0.90},
-    {0.00, 0.00, 0.00, -35.80, -0.90},
-    {0.00, 0.00, 0.00, -35.40, -0.90},
-    {0.00, 0.00, 0.00, -35.00, -0.90},
-    {0.00, 0.00, 0.00, -34.60, -0.90},
-    {0.00, 0.00, 0.00, -34.20, -0.90},
-    {0.00, 0.00, 0.00, -33.80, -0.90},
-    {0.00, 0.00, 0.00, -33.40, -0.90},
-    {0.00, 0.00, 0.00, -33.00, -0.90},
-    {0.00, 0.00, 0.00, -32.60, -0.90},
-    {0.00, 0.00, 0.00, -32.20, -0.90},
-    {0.00, 0.00, 0.00, -31.80, -0.90},
-    {0.00, 0.00, 0.00, -31.40, -0.90},
-    {0.00, 0.00, 0.00, -31.00, -0.90},
-    {0.00, 0.00, 0.00, -30.60, -0.90},
-    {0.00, 0.00, 0.00, -30.20, -0.90},
-    {0.00, 0.00, 0.00, -29.80, -0.90},
-    {0.00, 0.00, 0.00, -29.40, -0.90},
-    {0.00, 0.00, 0.00, -29.00, -0.90},
-    {0.00, 0.00, 0.00, -28.60, -0.90},
-    {0.00, 0.00, 0.00, -28.20, -0.90},
-    {0.00, 0.00, 0.00, -27.80, -0.90},
-    {0.00, 0.00, 0.00, -27.40, -0.90},
-    {0.00, 0.00, 0.00, -27.00, -0.90},
-    {0.00, 0.00, 0.00, -26.60, -0.90},
-    {0.00, 0.00, 0.00, -26.20, -0.90},
-    {0.00, 0.00, 0.00, -25.80, -0.90},
-    {0.00, 0.00, 0.00, -25.40, -0.90},
-    {0.00, 0.00, 0.00, -25.00, -0.90},
-    {0.00, 0.00, 0.00, -24.60, -0.90},
-    {0.00, 0.00, 0.00, -24.20, -0.90},
-    {0.00, 0.00, 0.00, -23.80, -0.90},
-    {0.00, 0.00, 0.00, -23.40, -0.90},
-    {0.00, 0.00, 0.00, -23.00, -0.90},
-    {0.00, 0.00, 0.00, -22.60, -0.90},
-    {0.00, 0.00, 0.00, -22.20, -0.90},
-    {0.00, 0.00, 0.00, -21.80, -0.90},
-    {0.00, 0.00, 0.00, -21.40, -0.90},
-    {0.00, 0.00, 0.00, -21.00, -0.90},
-    {0.00, 0.00, 0.00, -20.60, -0.90},
-    {0.00, 0.00, 0.00, -20.20, -0.90},
-    {0.00, 0.00, 0.00, -19.80, -0.90},
-    {0.00, 0.00, 0.00, -19.40, -0.90},
-    {0.00, 0.00, 0.00, -19.00, -0.90},
-    {0.00, 0.00, 0.00, -18.60, -0.90},
-    {0.00, 0.00, 0.00, -18.20, -0.90},
-    {0.00, 0.00, 0.00, -17.80, -0.90},
-    {0.00, 0.00, 0.00, -17.40, -0.90},
-    {0.00, 0.00, 0.00, -17.00, -0.90},
-    {0.00, 0.00, 0.00, -16.60, -0.90},
-    {0.00, 0.00, 0.00, -16.20, -0.90},
-    {0.00, 0.00, 0.00, -15.80, -0.90},
-    {0.00, 0.00, 0.00, -15.40, -0.90},
-    {0.00, 0.00, 0.00, -15.00, -0.90},
-    {0.00, 0.00, 0.00, -14.60, -0.90},
-    {0.00, 0.00, 0.00, -14.20, -0.90},
-    {0.00, 0.00, 0.00, -13.80, -0.90},
-    {0.00, 0.00, 0.00, -13.40, -0.90},
-    {0.00, 0.00, 0.00, -13.00, -0.90},
-    {0.00, 0.00, 0.00, -12.60, -0.90},
-    {0.00, 0.00, 0.00, -12.20, -0.90},
-    {0.00, 0.00, 0.00, -11.80, -0.90},
-    {0.00, 0.00, 0.00, -11.40, -0.90},
-    {0.00, 0.00, 0.00, -11.00, -0.90},
-    {0.00, 0.00, 0.00, -10.60, -0.90},
-    {0.00, 0.00, 0.00, -10.20, -0.90},
-    {0.00, 0.00, 0.00, -9.80, -0.90},
-    {0.00, 0.00, 0.00, -9.40, -0.90},
-    {0.00, 0.00, 0.00, -9.00, -0.90},
-    {0.00, 0.00, 0.00, -8.60, -0.90},
-    {0.00, 0.00, 0.00, -8.20, -0.90},
-    {0.00, 0.00, 0.00, -7.80, -0.90},
-    {0.00, 0.00, 0.00, -7.40, -0.90},
-    {0.00, 0.00, 0.00, -7.00, -0.90},
-    {0.00, 0.00, 0.00, -6.60, -0.90},
-    {0.00, 0.00, 0.00, -6.20, -0.90},
-    {0.00, 0.00, 0.00, -5.80, -0.90},
-    {0.00, 0.00, 0.00, -5.40, -0.90},
-    {0.00, 0.00, 0.00, -5.00, -0.90},
-    {0.00, 0.00, 0.00, -4.60, -0.90},
-    {0.00, 0.00, 0.00, -4.20, -0.90},
-    {0.00, 0.00, 0.00, -3.80, -0.90},
-    {0.00, 0.00, 0.00, -3.40, -0.90},
-    {0.00, 0.00, 0.00, -3.00, -0.90},
-    {0.00, 0.00, 0.00, -2.60, -0.90},
-    {0.00, 0.00, 0.00, -2.20, -0.90},
-    {0.00, 0.00, 0.00, -1.80, -0.90},
-    {0.00, 0.00, 0.00, -1.40, -0.90},
-    {0.00, 0.00, 0.00, -1.00, -0.90},
-    {0.00, 0.00, 0.00, -0.60, -0.90},
-    {0.00, 0.00, 0.00, -0.20, -0.90},
-    {0.00, 0.00, 0.00, 0.20, -0.90},
-    {0.00, 0.00, 0.00, 0.60, -0.90},
-    {0.00, 0.00, 0.00, 1.00, -0.90},
-    {0.00, 0.00, 0.00, 1.40, -0.90},
-    {0.00, 0.00, 0.00, 1.80, -0.90},
-    {0.00, 0.00, 0.00, 2.20, -0.90},
-    {0.00, 0.00, 0.00, 2.60, -0.90},
-    {0.00, 0.00, 0.00, 3.00, -0.90},
-    {0.00, 0.00, 0.00, 3.40, -0.90},
-    {0.00, 0.00, 0.00, 3.80, -0.90},
-    {0.00, 0.00, 0.00, 4.20, -0.90},
-    {0.00, 0.00, 0.00, 4.60, -0.90},
-    {0.00, 0.00, 0.00, 5.00, -0.90},
-    {0.00, 0.00, 0.00, 5.40, -0.90},
-    {0.00, 0.00, 0.00, 5.80, -0.90},
-    {0.00, 0.00, 0.00, 6.20, -0.90},
-    {0.00, 0.00, 0.00, 6.60, -0.90},
-    {0.00, 0.00, 0.00, 7.00, -0.90},
-    {0.00, 0.00, 0.00, 7.40, -0.90},
-    {0.00, 0.00, 0.00, 7.80, -0.90},
-    {0.00, 0.00, 0.00, 8.20, -0.90},
-    {0.00, 0.00, 0.00, 8.60, -0.90},
-    {0.00, 0.00, 0.00, 9.00, -0.90},
-    {0.00, 0.00, 0.00, 9.40, -0.90},
-    {0.00, 0.00, 0.00, 9.80, -0.90},
-    {0.00, 0.00, 0.00, 10.20, -0.90},
-    {0.00, 0.00, 0.00, 10.60, -0.90},
-    {0.00, 0.00, 0.00, 11.00, -0.90},
-    {0.00, 0.00, 0.00, 11.40, -0.90},
-    {0.00, 0.00, 0.00, 11.80, -0.90},
-    {0.00, 0.00, 0.00, 12.20, -0.90},
-    {0.00, 0.00, 0.00, 12.60, -0.90},
-    {0.00, 0.00, 0.00, 13.00, -0.90},
-    {0.00, 0.00, 0.00, 13.40, -0.90},
-    {0.00, 0.00, 0.00, 13.80, -0.90},
-    {0.00, 0.00, 0.00, 14.20, -0.90},
-    {0.00, 0.00, 0.00, 14.60, -0.90},
-    {0.00, 0.00, 0.00, 15.00, -0.90},
-    {0.00, 0.00, 0.00, 15.40, -0.90},
-    {0.00, 0.00, 0.00, 15.80, -0.90},
-    {0.00, 0.00, 0.00, 16.20, -0.90},
-    {0.00, 0.00, 0.00, 16.60, -0.90},
-    {0.00, 0.00, 0.00, 17.00, -0.90},
-    {0.00, 0.00, 0.00, 17.40, -0.90},
-    {0.00, 0.00, 0.00, 17.80, -0.90},
-    {0.00, 0.00, 0.00, 18.20, -0.90},
-    {0.00, 0.00, 0.00, 18.60, -0.90},
-    {0.00, 0.00, 0.00, 19.00, -0.90},
-    {0.00, 0.00, 0.00, 19.40, -0.90},
-    {0.00, 0.00, 0.00, 19.80, -0.90},
-    {0.00, 0.00, 0.00, 20.20, -0.90},
-    {0.00, 0.00, 0.00, 20.60, -0.90},
-    {0.00, 0.00, 0.00, 21.00, -0.90},
-    {0.00, 0.00, 0.00, 21.40, -0.90},
-    {0.00, 0.00, 0.00, 21.80, -0.90},
-    {0.00, 0.00, 0.00, 22.20, -0.90},
-    {0.00, 0.00, 0.00, 22.60, -0.90},
-    {0.00, 0.00, 0.00, 23.00, -0.90},
-    {0.00, 0.00, 0.00, 23.40, -0.90},
-    {0.00, 0.00, 0.00, 23.80, -0.90},
-    {0.00, 0.00, 0.00, 24.20, -0.90},
-    {0.00, 0.00, 0.00, 24.60, -0.90},
-    {0.00, 0.00, 0.00, 25.00, -0.90},
-    {0.00, 0.00, 0.00, 25.40, -0.90},
-    {0.00, 0.00, 0.00, 25.80, -0.90},
-    {0.00, 0.00, 0.00, 26.20, -0.90},
-    {0.00, 0.00, 0.00, 26.60, -0.90},
-    {0.00, 0.00, 0.00, 27.00, -0.90},
-    {0.00, 0.00, 0.00, 27.40, -0.90},
-    {0.00, 0.00, 0.00, 27.80, -0.90},
-    {0.00, 0.00, 0.00, 28.20, -0.90},
-    {0.00, 0.00, 0.00, 28.60, -0.90},
-    {0.00, 0.00, 0.00, 29.00, -0.90},
-    {0.00, 0.00, 0.00, 29.40, -0.90},
-    {0.00, 0.00, 0.00, 29.80, -0.90},
-    {0.00, 0.00, 0.00, 30.20, -0.90},
-    {0.00, 0.00, 0.00, 30.60, -0.90},
-    {0.00, 0.00, 0.00, 31.00, -0.90},
-    {0.00, 0.00, 0.00, 31.40, -0.90},
-    {0.00, 0.00, 0.00, 31.80, -0.90},
-    {0.00, 0.00, 0.00, 32.20, -0.90},
-    {0.00, 0.00, 0.00, 32.60, -0.90},
-    {0.00, 0.00, 0.00, 33.00, -0.90},
-    {0.00, 0.00, 0.00, 33.40, -0.90},
-    {0.00, 0.00, 0.00, 33.80, -0.90},
-    {0.00, 0.00, 0.00, 34.20, -0.90},
-    {0.00, 0.00, 0.00, 34.60, -0.90},
-    {0.00, 0.00, 0.00, 35.00, -0.90},
-    {0.00, 0.00, 0.00, 35.40, -0.90},
-    {0.00, 0.00, 0.00, 35.80, -0.90},
-    {0.00, 0.00, 0.00, 36.20, -0.90},
-    {0.00, 0.00, 0.00, 36.60, -0.90},
-    {0.00, 0.00, 0.00, 37.00, -0.90},
-    {0.00, 0.00, 0.00, 37.40, -0.90},
-    {0.00, 0.00, 0.00, 37.80, -0.90},
-    {0.00, 0.00, 0.00, 38.20, -0.90},
-    {0.00, 0.00, 0.00, 38.60, -0.90},
-    {0.00, 0.00, 0.00, 39.00, -0.90},
-    {0.00, 0.00, 0.00, 39.40, -0.90},
-    {0.00, 0.00, 0.00, 39.80, -0.90},
-    {0.00, 0.00, 0.00, 40.20, -0.90},
-    {0.00, 0.00, 0.00, 40.60, -0.90},
-    {0.00, 0.00, 0.00, 41.00, -0.90},
-    {0.00, 0.00, 0.00, 41.40, -0.90},
-    {0.00, 0.00, 0.00, 41.80, -0.90},
-    {0.00, 0.00, 0.00, 42.20, -0.90},
-    {0.00, 0.00, 0.00, 42.60, -0.90},
-    {0.00, 0.00, 0.00, 43.00, -0.90},
-    {0.00, 0.00, 0.00, 43.40, -0.90},
-    {0.00, 0.00, 0.00, 43.80, -0.90},
-    {0.00, 0.00, 0.00, 44.20, -0.90},
-    {0.00, 0.00, 0.00, 44.60, -0.90},
-    {0.00, 0.00, 0.00, 45.00, -0.90},
-    {0.00, 0.00, 0.00, 45.40, -0.90},
-    {0.00, 0.00, 0.00, 45.80, -0.90},
-    {0.00, 0.00, 0.00, 46.20, -0.90},
-    {0.00, 0.00, 0.00, 46.60, -0.90},
-    {0.00, 0.00, 0.00, 47.00, -0.90},
-    {0.00, 0.00, 0.00, 47.40, -0.90},
-    {0.00, 0.00, 0.00, 47.80, -0.90},
-    {0.00, 0.00, 0.00, 48.20, -0.90},
-    {0.00, 0.00, 0.00, 48.60, -0.90},
-    {0.00, 0.00, 0.00, 49.00, -0.90},
-    {0.00, 0.00, 0.00, 49.40, -0.90},
-    {0.00, 0.00, 0.00, 49.80, -0.90},
-    {0.00, 0.00, 0.00, 50.20, -0.90},
-    {0.00, 0.00, 0.00, 50.60, -0.90},
-    {0.00, 0.00, 0.00, 51.00, -0.90},
-    {0.00, 0.00, 0.00, 51.40, -0.90},
-    {0.00, 0.00, 0.00, 51.80, -0.90},
-    {0.00, 0.00, 0.00, 52.20, -0.90},
-    {0.00, 0.00, 0.00, 52.60, -0.90},
-    {0.00, 0.00, 0.00, 53.00, -0.90},
-    {0.00, 0.00, 0.00, 53.40, -0.90},
-    {0.00, 0.00, 0.00, 53.80, -0.90},
-    {0.00, 0.00, 0.00, 54.20, -0.90},
-    {0.00, 0.00, 0.00, 54.60, -0.90},
-    {0.00, 0.00, 0.00, 55.00, -0.90},
-    {0.00, 0.00, 0.00, 55.40, -0.90},
-    {0.00, 0.00, 0.00, 55.80, -0.90},
-    {0.00, 0.00, 0.00, 56.20, -0.90},
-    {0.00, 0.00, 0.00, 56.60, -0.90},
-    {0.00, 0.00, 0.00, 57.00, -0.90},
-    {0.00, 0.00, 0.00, 57.40, -0.90},
-    {0.00, 0.00, 0.00, 57.80, -0.90},
-    {0.00, 0.00, 0.00, 58.20, -0.90},
-    {0.00, 0.00, 0.00, 58.60, -0.90},
-    {0.00, 0.00, 0.00, 59.00, -0.90},
-    {0.00, 0.00, 0.00, 59.40, -0.90},
-    {0.00, 0.00, 0.00, 59.80, -0.90},
-    {0.00, 0.00, 0.00, -59.80, -0.70},
-    {0.00, 0.00, 0.00, -59.40, -0.70},
-    {0.00, 0.00, 0.00, -59.00, -0.70},
-    {0.00, 0.00, 0.00, -58.60, -0.70},
-    {0.00, 0.00, 0.00, -58.20, -0.70},
-    {0.00, 0.00, 0.00, -57.80, -0.70},
-    {0.00, 0.00, 0.00, -57.40, -0.70},
-    {0.00, 0.00, 0.00, -57.00, -0.70},
-    {0.00, 0.00, 0.00, -56.60, -0.70},
-    {0.00, 0.00, 0.00, -56.20, -0.70},
-    {0.00, 0.00, 0.00, -55.80, -0.70},
-    {0.00, 0.00, 0.00, -55.40, -0.70},
-    {0.00, 0.00, 0.00, -55.00, -0.70},
-    {0.00, 0.00, 0.00, -54.60, -0.70},
-    {0.00, 0.00, 0.00, -54.20, -0.70},
-    {0.00, 0.00, 0.00, -53.80, -0.70},
-    {0.00, 0.00, 0.00, -53.40, -0.70},
-    {0.00, 0.00, 0.00, -53.00, -0.70},
-    {0.00, 0.00, 0.00, -52.60, -0.70},
-    {0.00, 0.00, 0.00, -52.20, -0.70},
-    {0.00, 0.00, 0.00, -51.80, -0.70},
-    {0.00, 0.00, 0.00, -51.40, -0.70},
-    {0.00, 0.00, 0.00, -51.00, -0.70},
-    {0.00, 0.00, 0.00, -50.60, -0.70},
-    {0.00, 0.00, 0.00, -50.20, -0.70},
-    {0.00, 0.00, 0.00, -49.80, -0.70},
-    {0.00, 0.00, 0.00, -49.40, -0.70},
-    {0.00, 0.00, 0.00, -49.00, -0.70},
-    {0.00, 0.00, 0.00, -48.60, -0.70},
-    {0.00, 0.00, 0.00, -48.20, -0.70},
-    {0.00, 0.00, 0.00, -47.80, -0.70},
-    {0.00, 0.00, 0.00, -47.40, -0.70},
-    {0.00, 0.00, 0.00, -47.00, -0.70},
-    {0.00, 0.00, 0.00, -46.60, -0.70},
-    {0.00, 0.00, 0.00, -46.20, -0.70},
-    {0.00, 0.00, 0.00, -45.80, -0.70},
-    {0.00, 0.00, 0.00, -45.40, -0.70},
-    {0.00, 0.00, 0.00, -45.00, -0.70},
-    {0.00, 0.00, 0.00, -44.60, -0.70},
-    {0.00, 0.00, 0.00, -44.20, -0.70},
-    {0.00, 0.00, 0.00, -43.80, -0.70},
-    {0.00, 0.00, 0.00, -43.40, -0.70},
-    {0.00, 0.00, 0.00, -43.00, -0.70},
-    {0.00, 0.00, 0.00, -42.60, -0.70},
-    {0.00, 0.00, 0.00, -42.20, -0.70},
-    {0.00, 0.00, 0.00, -41.80, -0.70},
-    {0.00, 0.00, 0.00, -41.40, -0.70},
-    {0.00, 0.00, 0.00, -41.00, -0.70},
-    {0.00, 0.00, 0.00, -40.60, -0.70},
-    {0.00, 0.00, 0.00, -40.20, -0.70},
-    {0.00, 0.00, 0.00, -39.80, -0.70},
-    {0.00, 0.00, 0.00, -39.40, -0.70},
-    {0.00, 0.00, 0.00, -39.00, -0.70},
-    {0.00, 0.00, 0.00, -38.60, -0.70},
-    {0.00, 0.00, 0.00, -38.20, -0.70},
-    {0.00, 0.00, 0.00, -37.80, -0.70},
-    {0.00, 0.00, 0.00, -37.40, -0.70},
-    {0.00, 0.00, 0.00, -37.00, -0.70},
-    {0.00, 0.00, 0.00, -36.60, -0.70},
-    {0.00, 0.00, 0.00, -36.20, -0.70},
-    {0.00, 0.00, 0.00, -35.80, -0.70},
-    {0.00, 0.00, 0.00, -35.40, -0.70},
-    {0.00, 0.00, 0.00, -35.00, -0.70},
-    {0.00, 0.00, 0.00, -34.60, -0.70},
-    {0.00, 0.00, 0.00, -34.20, -0.70},
-    {0.00, 0.00, 0.00, -33.80, -0.70},
-    {0.00, 0.00, 0.00, -33.40, -0.70},
-    {0.00, 0.00, 0.00, -33.00, -0.70},
-    {0.00, 0.00, 0.00, -32.60, -0.70},
-    {0.00, 0.00, 0.00, -32.20, -0.70},
-    {0.00, 0.00, 0.00, -31.80, -0.70},
-    {0.00, 0.00, 0.00, -31.40, -0.70},
-    {0.00, 0.00, 0.00, -31.00, -0.70},
-    {0.00, 0.00, 0.00, -30.60, -0.70},
-    {0.00, 0.00, 0.00, -30.20, -0.70},
-    {0.00, 0.00, 0.00, -29.80, -0.70},
-    {0.00, 0.00, 0.00, -29.40, -0.70},
-    {0.00, 0.00, 0.00, -29.00, -0.70},
-    {0.00, 0.00, 0.00, -28.60, -0.70},
-    {0.00, 0.00, 0.00, -28.20, -0.70},
-    {0.00, 0.00, 0.00, -27.80, -0.70},
-    {0.00, 0.00, 0.00, -27.40, -0.70},
-    {0.00, 0.00, 0.00, -27.00, -0.70},
-    {0.00, 0.00, 0.00, -26.60, -0.70},
-    {0.00, 0.00, 0.00, -26.20, -0.70},
-    {0.00, 0.00, 0.00, -25.80, -0.70},
-    {0.00, 0.00, 0.00, -25.40, -0.70},
-    {0.00, 0.00, 0.00, -25.00, -0.70},
-    {0.00, 0.00, 0.00, -24.60, -0.70},
-    {0.00, 0.00, 0.00, -24.20, -0.70},
-    {0.00, 0.00, 0.00, -23.80, -0.70},
-    {0.00, 0.00, 0.00, -23.40, -0.70},
-    {0.00, 0.00, 0.00, -23.00, -0.70},
-    {0.00, 0.00, 0.00, -22.60, -0.70},
-    {0.00, 0.00, 0.00, -22.20, -0.70},
-    {0.00, 0.00, 0.00, -21.80, -0.70},
-    {0.00, 0.00, 0.00, -21.40, -0.70},
-    {0.00, 0.00, 0.00, -21.00, -0.70},
-    {0.00, 0.00, 0.00, -20.60, -0.70},
-    {0.00, 0.00, 0.00, -20.20, -0.70},
-    {0.00, 0.00, 0.00, -19.80, -0.70},
-    {0.00, 0.00, 0.00, -19.40, -0.70},
-    {0.00, 0.00, 0.00, -19.00, -0.70},
-    {0.00, 0.00, 0.00, -18.60, -0.70},
-    {0.00, 0.00, 0.00, -18.20, -0.70},
-    {0.00, 0.00, 0.00, -17.80, -0.70},
-    {0.00, 0.00, 0.00, -17.40, -0.70},
-    {0.00, 0.00, 0.00, -17.00, -0.70},
-    {0.00, 0.00, 0.00, -16.60, -0.70},
-    {0.00, 0.00, 0.00, -16.20, -0.70},
-    {0.00, 0.00, 0.00, -15.80, -0.70},
-    {0.00, 0.00, 0.00, -15.40, -0.70},
-    {0.00, 0.00, 0.00, -15.00, -0.70},
-    {0.00, 0.00, 0.00, -14.60, -0.70},
-    {0.00, 0.00, 0.00, -14.20, -0.70},
-    {0.00, 0.00, 0.00, -13.80, -0.70},
-    {0.00, 0.00, 0.00, -13.40, -0.70},
-    {0.00, 0.00, 0.00, -13.00, -0.70},
-    {0.00, 0.00, 0.00, -12.60, -0.70},
-    {0.00, 0.00, 0.00, -12.20, -0.70},
-    {0.00, 0.00, 0.00, -11.80, -0.70},
-    {0.00, 0.00, 0.00, -11.40, -0.70},
-    {0.00, 0.00, 0.00, -11.00, -0.70},
-    {0.00, 0.00, 0.00, -10.60, -0.70},
-    {0.00, 0.00, 0.00, -10.20, -0.70},
-    {0.00, 0.00, 0.00, -9.80, -0.70},
-    {0.00, 0.00, 0.00, -9.40, -0.70},
-    {0.00, 0.00, 0.00, -9.00, -0.70},
-    {0.00, 0.00, 0.00, -8.60, -0.70},
-    {0.00, 0.00, 0.00, -8.20, -0.70},
-    {0.00, 0.00, 0.00, -7.80, -0.70},
-    {0.00, 0.00, 0.00, -7.40, -0.70},
-    {0.00, 0.00, 0.00, -7.00, -0.70},
-    {0.00, 0.00, 0.00, -6.60, -0.70},
-    {0.00, 0.00, 0.00, -6.20, -0.70},
-    {0.00, 0.00, 0.00, -5.80, -0.70},
-    {0.00, 0.00, 0.00, -5.40, -0.70},
-    {0.00, 0.00, 0.00, -5.00, -0.70},
-    {0.00, 0.00, 0.00, -4.60, -0.70},
-    {0.00, 0.00, 0.00, -4.20, -0.70},
-    {0.00, 0.00, 0.00, -3.80, -0.70},
-    {0.00, 0.00, 0.00, -3.40, -0.70},
-    {0.00, 0.00, 0.00, -3.00, -0.70},
-    {0.00, 0.00, 0.00, -2.60, -0.70},
-    {0.00, 0.00, 0.00, -2.20, -0.70},
-    {0.00, 0.00, 0.00, -1.80, -0.70},
-    {0.00, 0.00, 0.00, -1.40, -0.70},
-    {0.00, 0.00, 0.00, -1.00, -0.70},
-    {0.00, 0.00, 0.00, -0.60, -0.70},
-    {0.00, 0.00, 0.00, -0.20, -0.70},
-    {0.00, 0.00, 0.00, 0.20, -0.70},
-    {0.00, 0.00, 0.00, 0.60, -0.70},
-    {0.00, 0.00, 0.00, 1.00, -0.70},
-    {0.00, 0.00, 0.00, 1.40, -0.70},
-    {0.00, 0.00, 0.00, 1.80, -0.70},
-    {0.00, 0.00, 0.00, 2.20, -0.70},
-    {0.00, 0.00, 0.00, 2.60, -0.70},
-    {0.00, 0.00, 0.00, 3.00, -0.70},
-    {0.00, 0.00, 0.00, 3.40, -0.70},
-    {0.00, 0.00, 0.00, 3.80, -0.70},
-    {0.00, 0.00, 0.00, 4.20, -0.70},
-    {0.00, 0.00, 0.00, 4.60, -0.70},
-    {0.00, 0.00, 0.00, 5.00, -0.70},
-    {0.00, 0.00, 0.00, 5.40, -0.70},
-    {0.00, 0.00, 0.00, 5.80, -0.70},
-    {0.00, 0.00, 0.00, 6.20, -0.70},
-    {0.00, 0.00, 0.00, 6.60, -0.70},
-    {0.00, 0.00, 0.00, 7.00, -0.70},
-    {0.00, 0.00, 0.00, 7.40, -0.70},
-    {0.00, 0.00, 0.00, 7.80, -0.70},
-    {0.00, 0.00, 0.00, 8.20, -0.70},
-    {0.00, 0.00, 0.00, 8.60, -0.70},
-    {0.00, 0.00, 0.00, 9.00, -0.70},
-    {0.00, 0.00, 0.00, 9.40, -0.70},
-    {0.00, 0.00, 0.00, 9.80, -0.70},
-    {0.00, 0.00, 0.00, 10.20, -0.70},
-    {0.00, 0.00, 0.00, 10.60, -0.70},
-    {0.00, 0.00, 0.00, 11.00, -0.70},
-    {0.00, 0.00, 0.00, 11.40, -0.70},
-    {0.00, 0.00, 0.00, 11.80, -0.70},
-    {0.00, 0.00, 0.00, 12.20, -0.70},
-    {0.00, 0.00, 0.00, 12.60, -0.70},
-    {0.00, 0.00, 0.00, 13.00, -0.70},
-    {0.00, 0.00, 0.00, 13.40, -0.70},
-    {0.00, 0.00, 0.00, 13.80, -0.70},
-    {0.00, 0.00, 0.00, 14.20, -0.70},
-    {0.00, 0.00, 0.00, 14.60, -0.70},
-    {0.00, 0.00, 0.00, 15.00, -0.70},
-    {0.00, 0.00, 0.00, 15.40, -0.70},
-    {0.00, 0.00, 0.00, 15.80, -0.70},
-    {0.00, 0.00, 0.00, 16.20, -0.70},
-    {0.00, 0.00, 0.00, 16.60, -0.70},
-    {0.00, 0.00, 0.00, 17.00, -0.70},
-    {0.00, 0.00, 0.00, 17.40, -0.70},
-    {0.00, 0.00, 0.00, 17.80, -0.70},
-    {0.00, 0.00, 0.00, 18.20, -0.70},
-    {0.00, 0.00, 0.00, 18.60, -0.70},
-    {0.00, 0.00, 0.00, 19.00, -0.70},
-    {0.00, 0.00, 0.00, 19.40, -0.70},
-    {0.00, 0.00, 0.00, 19.80, -0.70},
-    {0.00, 0.00, 0.00, 20.20, -0.70},
-    {0.00, 0.00, 0.00, 20.60, -0.70},
-    {0.00, 0.00, 0.00, 21.00, -0.70},
-    {0.00, 0.00, 0.00, 21.40, -0.70},
-    {0.00, 0.00, 0.00, 21.80, -0.70},
-    {0.00, 0.00, 0.00, 22.20, -0.70},
-    {0.00, 0.00, 0.00, 22.60, -0.70},
-    {0.00, 0.00, 0.00, 23.00, -0.70},
-    {0.00, 0.00, 0.00, 23.40, -0.70},
-    {0.00, 0.00, 0.00, 23.80, -0.70},
-    {0.00, 0.00, 0.00, 24.20, -0.70},
-    {0.00, 0.00, 0.00, 24.60, -0.70},
-    {0.00, 0.00, 0.00, 25.00, -0.70},
-    {0.00, 0.00, 0.00, 25.40, -0.70},
-    {0.00, 0.00, 0.00, 25.80, -0.70},
-    {0.00, 0.00, 0.00, 26.20, -0.70},
-    {0.00, 0.00, 0.00, 26.60, -0.70},
-    {0.00, 0.00, 0.00, 27.00, -0.70},
-    {0.00, 0.00, 0.00, 27.40, -0.70},
-    {0.00, 0.00, 0.00, 27.80, -0.70},
-    {0.00, 0.00, 0.00, 28.20, -0.70},
-    {0.00, 0.00, 0.00, 28.60, -0.70},
-    {0.00, 0.00, 0.00, 29.00, -0.70},
-    {0.00, 0.00, 0.00, 29.40, -0.70},
-    {0.00, 0.00, 0.00, 29.80, -0.70},
-    {0.00, 0.00, 0.00, 30.20, -0.70},
-    {0.00, 0.00, 0.00, 30.60, -0.70},
-    {0.00, 0.00, 0.00, 31.00, -0.70},
-    {0.00, 0.00, 0.00, 31.40, -0.70},
-    {0.00, 0.00, 0.00, 31.80, -0.70},
-    {0.00, 0.00, 0.00, 32.20, -0.70},
-    {0.00, 0.00, 0.00, 32.60, -0.70},
-    {0.00, 0.00, 0.00, 33.00, -0.70},
-    {0.00, 0.00, 0.00, 33.40, -0.70},
-    {0.00, 0.00, 0.00, 33.80, -0.70},
-    {0.00, 0.00, 0.00, 34.20, -0.70},
-    {0.00, 0.00, 0.00, 34.60, -0.70},
-    {0.00, 0.00, 0.00, 35.00, -0.70},
-    {0.00, 0.00, 0.00, 35.40, -0.70},
-    {0.00, 0.00, 0.00, 35.80, -0.70},
-    {0.00, 0.00, 0.00, 36.20, -0.70},
-    {0.00, 0.00, 0.00, 36.60, -0.70},
-    {0.00, 0.00, 0.00, 37.00, -0.70},
-    {0.00, 0.00, 0.00, 37.40, -0.70},
-    {0.00, 0.00, 0.00, 37.80, -0.70},
-    {0.00, 0.00, 0.00, 38.20, -0.70},
-    {0.00, 0.00, 0.00, 38.60, -0.70},
-    {0.00, 0.00, 0.00, 39.00, -0.70},
-    {0.00, 0.00, 0.00, 39.40, -0.70},
-    {0.00, 0.00, 0.00, 39.80, -0.70},
-    {0.00, 0.00, 0.00, 40.20, -0.70},
-    {0.00, 0.00, 0.00, 40.60, -0.70},
-    {0.00, 0.00, 0.00, 41.00, -0.70},
-    {0.00, 0.00, 0.00, 41.40, -0.70},
-    {0.00, 0.00, 0.00, 41.80, -0.70},
-    {0.00, 0.00, 0.00, 42.20, -0.70},
-    {0.00, 0.00, 0.00, 42.60, -0.70},
-    {0.00, 0.00, 0.00, 43.00, -0.70},
-    {0.00, 0.00, 0.00, 43.40, -0.70},
-    {0.00, 0.00, 0.00, 43.80, -0.70},
-    {0.00, 0.00, 0.00, 44.20, -0.70},
-    {0.00, 0.00, 0.00, 44.60, -0.70},
-    {0.00, 0.00, 0.00, 45.00, -0.70},
-    {0.00, 0.00, 0.00, 45.40, -0.70},
-    {0.00, 0.00, 0.00, 45.80, -0.70},
-    {0.00, 0.00, 0.00, 46.20, -0.70},
-    {0.00, 0.00, 0.00, 46.60, -0.70},
-    {0.00, 0.00, 0.00, 47.00, -0.70},
-    {0.00, 0.00, 0.00, 47.40, -0.70},
-    {0.00, 0.00, 0.00, 47.80, -0.70},
-    {0.00, 0.00, 0.00, 48.20, -0.70},
-    {0.00, 0.00, 0.00, 48.60, -0.70},
-    {0.00, 0.00, 0.00, 49.00, -0.70},
-    {0.00, 0.00, 0.00, 49.40, -0.70},
-    {0.00, 0.00, 0.00, 49.80, -0.70},
-    {0.00, 0.00, 0.00, 50.20, -0.70},
-    {0.00, 0.00, 0.00, 50.60, -0.70},
-    {0.00, 0.00, 0.00, 51.00, -0.70},
-    {0.00, 0.00, 0.00, 51.40, -0.70},
-    {0.00, 0.00, 0.00, 51.80, -0.70},
-    {0.00, 0.00, 0.00, 52.20, -0.70},
-    {0.00, 0.00, 0.00, 52.60, -0.70},
-    {0.00, 0.00, 0.00, 53.00, -0.70},
-    {0.00, 0.00, 0.00, 53.40, -0.70},
-    {0.00, 0.00, 0.00, 53.80, -0.70},
-    {0.00, 0.00, 0.00, 54.20, -0.70},
-    {0.00, 0.00, 0.00, 54.60, -0.70},
-    {0.00, 0.00, 0.00, 55.00, -0.70},
-    {0.00, 0.00, 0.00, 55.40, -0.70},
-    {0.00, 0.00, 0.00, 55.80, -0.70},
-    {0.00, 0.00, 0.00, 56.20, -0.70},
-    {0.00, 0.00, 0.00, 56.60, -0.70},
-    {0.00, 0.00, 0.00, 57.00, -0.70},
-    {0.00, 0.00, 0.00, 57.40, -0.70},
-    {0.00, 0.00, 0.00, 57.80, -0.70},
-    {0.00, 0.00, 0.00, 58.20, -0.70},
-    {0.00, 0.00, 0.00, 58.60, -0.70},
-    {0.00, 0.00, 0.00, 59.00, -0.70},
-    {0.00, 0.00, 0.00, 59.40, -0.70},
-    {0.00, 0.00, 0.00, 59.80, -0.70},
-    {0.00, 0.00, 0.00, -59.80, -0.50},
-    {0.00, 0.00, 0.00, -59.40, -0.50},
-    {0.00, 0.00, 0.00, -59.00, -0.50},
-    {0.00, 0.00, 0.00, -58.60, -0.50},
-    {0.00, 0.00, 0.00, -58.20, -0.50},
-    {0.00, 0.00, 0.00, -57.80, -0.50},
-    {0.00, 0.00, 0.00, -57.40, -0.50},
-    {0.00, 0.00, 0.00, -57.00, -0.50},
-    {0.00, 0.00, 0.00, -56.60, -0.50},
-    {0.00, 0.00, 0.00, -56.20, -0.50},
-    {0.00, 0.00, 0.00, -55.80, -0.50},
-    {0.00, 0.00, 0.00, -55.40, -0.50},
-    {0.00, 0.00, 0.00, -55.00, -0.50},
-    {0.00, 0.00, 0.00, -54.60, -0.50},
-    {0.00, 0.00, 0.00, -54.20, -0.50},
-    {0.00, 0.00, 0.00, -53.80, -0.50},
-    {0.00, 0.00, 0.00, -53.40, -0.50},
-    {0.00, 0.00, 0.00, -53.00, -0.50},
-    {0.00, 0.00, 0.00, -52.60, -0.50},
-    {0.00, 0.00, 0.00, -52.20, -0.50},
-    {0.00, 0.00, 0.00, -51.80, -0.50},
-    {0.00, 0.00, 0.00, -51.40, -0.50},
-    {0.00, 0.00, 0.00, -51.00, -0.50},
-    {0.00, 0.00, 0.00, -50.60, -0.50},
-    {0.00, 0.00, 0.00, -50.20, -0.50},
-    {0.00, 0.00, 0.00, -49.80, -0.50},
-    {0.00, 0.00, 0.00, -49.40, -0.50},
-    {0.00, 0.00, 0.00, -49.00, -0.50},
-    {0.00, 0.00, 0.00, -48.60, -0.50},
-    {0.00, 0.00, 0.00, -48.20, -0.50},
-    {0.00, 0.00, 0.00, -47.80, -0.50},
-    {0.00, 0.00, 0.00, -47.40, -0.50},
-    {0.00, 0.00, 0.00, -47.00, -0.50},
-    {0.00, 0.00, 0.00, -46.60, -0.50},
-    {0.00, 0.00, 0.00, -46.20, -0.50},
-    {0.00, 0.00, 0.00, -45.80, -0.50},
-    {0.00, 0.00, 0.00, -45.40, -0.50},
-    {0.00, 0.00, 0.00, -45.00, -0.50},
-    {0.00, 0.00, 0.00, -44.60, -0.50},
-    {0.00, 0.00, 0.00, -44.20, -0.50},
-    {0.00, 0.00, 0.00, -43.80, -0.50},
-    {0.00, 0.00, 0.00, -43.40, -0.50},
-    {0.00, 0.00, 0.00, -43.00, -0.50},
-    {0.00, 0.00, 0.00, -42.60, -0.50},
-    {0.00, 0.00, 0.00, -42.20, -0.50},
-    {0.00, 0.00, 0.00, -41.80, -0.50},
-    {0.00, 0.00, 0.00, -41.40, -0.50},
-    {0.00, 0.00, 0.00, -41.00, -0.50},
-    {0.00, 0.00, 0.00, -40.60, -0.50},
-    {0.00, 0.00, 0.00, -40.20, -0.50},
-    {0.00, 0.00, 0.00, -39.80, -0.50},
-    {0.00, 0.00, 0.00, -39.40, -0.50},
-    {0.00, 0.00, 0.00, -39.00, -0.50},
-    {0.00, 0.00, 0.00, -38.60, -0.50},
-    {0.00, 0.00, 0.00, -38.20, -0.50},
-    {0.00, 0.00, 0.00, -37.80, -0.50},
-    {0.00, 0.00, 0.00, -37.40, -0.50},
-    {0.00, 0.00, 0.00, -37.00, -0.50},
-    {0.00, 0.00, 0.00, -36.60, -0.50},
-    {0.00, 0.00, 0.00, -36.20, -0.50},
-    {0.00, 0.00, 0.00, -35.80, -0.50},
-    {0.00, 0.00, 0.00, -35.40, -0.50},
-    {0.00, 0.00, 0.00, -35.00, -0.50},
-    {0.00, 0.00, 0.00, -34.60, -0.50},
-    {0.00, 0.00, 0.00, -34.20, -0.50},
-    {0.00, 0.00, 0.00, -33.80, -0.50},
-    {0.00, 0.00, 0.00, -33.40, -0.50},
-    {0.00, 0.00, 0.00, -33.00, -0.50},
-    {0.00, 0.00, 0.00, -32.60, -0.50},
-    {0.00, 0.00, 0.00, -32.20, -0.50},
-    {0.00, 0.00, 0.00, -31.80, -0.50},
-    {0.00, 0.00, 0.00, -31.40, -0.50},
-    {0.00, 0.00, 0.00, -31.00, -0.50},
-    {0.00, 0.00, 0.00, -30.60, -0.50},
-    {0.00, 0.00, 0.00, -30.20, -0.50},
-    {0.00, 0.00, 0.00, -29.80, -0.50},
-    {0.00, 0.00, 0.00, -29.40, -0.50},
-    {0.00, 0.00, 0.00, -29.00, -0.50},
-    {0.00, 0.00, 0.00, -28.60, -0.50},
-    {0.00, 0.00, 0.00, -28.20, -0.50},
-    {0.00, 0.00, 0.00, -27.80, -0.50},
-    {0.00, 0.00, 0.00, -27.40, -0.50},
-    {0.00, 0.00, 0.00, -27.00, -0.50},
-    {0.00, 0.00, 0.00, -26.60, -0.50},
-    {0.00, 0.00, 0.00, -26.20, -0.50},
-    {0.00, 0.00, 0.00, -25.80, -0.50},
-    {0.00, 0.00, 0.00, -25.40, -0.50},
-    {0.00, 0.00, 0.00, -25.00, -0.50},
-    {0.00, 0.00, 0.00, -24.60, -0.50},
-    {0.00, 0.00, 0.00, -24.20, -0.50},
-    {0.00, 0.00, 0.00, -23.80, -0.50},
-    {0.00, 0.00, 0.00, -23.40, -0.50},
-    {0.00, 0.00, 0.00, -23.00, -0.50},
-    {0.00, 0.00, 0.00, -22.60, -0.50},
-    {0.00, 0.00, 0.00, -22.20, -0.50},
-    {0.00, 0.00, 0.00, -21.80, -0.50},
-    {0.00, 0.00, 0.00, -21.40, -0.50},
-    {0.00, 0.00, 0.00, -21.00, -0.50},
-    {0.00, 0.00, 0.00, -20.60, -0.50},
-    {0.00, 0.00, 0.00, -20.20, -0.50},
-    {0.00, 0.00, 0.00, -19.80, -0.50},
-    {0.00, 0.00, 0.00, -19.40, -0.50},
-    {0.00, 0.00, 0.00, -19.00, -0.50},
-    {0.00, 0.00, 0.00, -18.60, -0.50},
-    {0.00, 0.00, 0.00, -18.20, -0.50},
-    {0.00, 0.00, 0.00, -17.80, -0.50},
-    {0.00, 0.00, 0.00, -17.40, -0.50},
-    {0.00, 0.00, 0.00, -17.00, -0.50},
-    {0.00, 0.00, 0.00, -16.60, -0.50},
-    {0.00, 0.00, 0.00, -16.20, -0.50},
-    {0.00, 0.00, 0.00, -15.80, -0.50},
-    {0.00, 0.00, 0.00, -15.40, -0.50},
-    {0.00, 0.00, 0.00, -15.00, -0.50},
-    {0.00, 0.00, 0.00, -14.60, -0.50},
-    {0.00, 0.00, 0.00, -14.20, -0.50},
-    {0.00, 0.00, 0.00, -13.80, -0.50},
-    {0.00, 0.00, 0.00, -13.40, -0.50},
-    {0.00, 0.00, 0.00, -13.00, -0.50},
-    {0.00, 0.00, 0.00, -12.60, -0.50},
-    {0.00, 0.00, 0.00, -12.20, -0.50},
-    {0.00, 0.00, 0.00, -11.80, -0.50},
-    {0.00, 0.00, 0.00, -11.40, -0.50},
-    {0.00, 0.00, 0.00, -11.00, -0.50},
-    {0.00, 0.00, 0.00, -10.60, -0.50},
-    {0.00, 0.00, 0.00, -10.20, -0.50},
-    {0.00, 0.00, 0.00, -9.80, -0.50},
-    {0.00, 0.00, 0.00, -9.40, -0.50},
-    {0.00, 0.00, 0.00, -9.00, -0.50},
-    {0.00, 0.00, 0.00, -8.60, -0.50},
-    {0.00, 0.00, 0.00, -8.20, -0.50},
-    {0.00, 0.00, 0.00, -7.80, -0.50},
-    {0.00, 0.00, 0.00, -7.40, -0.50},
-    {0.00, 0.00, 0.00, -7.00, -0.50},
-    {0.00, 0.00, 0.00, -6.60, -0.50},
-    {0.00, 0.00, 0.00, -6.20, -0.50},
-    {0.00, 0.00, 0.00, -5.80, -0.50},
-    {0.00, 0.00, 0.00, -5.40, -0.50},
-    {0.00, 0.00, 0.00, -5.00, -0.50},
-    {0.00, 0.00, 0.00, -4.60, -0.50},
-    {0.00, 0.00, 0.00, -4.20, -0.50},
-    {0.00, 0.00, 0.00, -3.80, -0.50},
-    {0.00, 0.00, 0.00, -3.40, -0.50},
-    {0.00, 0.00, 0.00, -3.00, -0.50},
-    {0.00, 0.00, 0.00, -2.60, -0.50},
-    {0.00, 0.00, 0.00, -2.20, -0.50},
-    {0.00, 0.00, 0.00, -1.80, -0.50},
-    {0.00, 0.00, 0.00, -1.40, -0.50},
-    {0.00, 0.00, 0.00, -1.00, -0.50},
-    {0.00, 0.00, 0.00, -0.60, -0.50},
-    {0.00, 0.00, 0.00, -0.20, -0.50},
-    {0.00, 0.00, 0.00, 0.20, -0.50},
-    {0.00, 0.00, 0.00, 0.60, -0.50},
-    {0.00, 0.00, 0.00, 1.00, -0.50},
-    {0.00, 0.00, 0.00, 1.40, -0.50},
-    {0.00, 0.00, 0.00, 1.80, -0.50},
-    {0.00, 0.00, 0.00, 2.20, -0.50},
-    {0.00, 0.00, 0.00, 2.60, -0.50},
-    {0.00, 0.00, 0.00, 3.00, -0.50},
-    {0.00, 0.00, 0.00, 3.40, -0.50},
-    {0.00, 0.00, 0.00, 3.80, -0.50},
-    {0.00, 0.00, 0.00, 4.20, -0.50},
-    {0.00, 0.00, 0.00, 4.60, -0.50},
-    {0.00, 0.00, 0.00, 5.00, -0.50},
-    {0.00, 0.00, 0.00, 5.40, -0.50},
-    {0.00, 0.00, 0.00, 5.80, -0.50},
-    {0.00, 0.00, 0.00, 6.20, -0.50},
-    {0.00, 0.00, 0.00, 6.60, -0.50},
-    {0.00, 0.00, 0.00, 7.00, -0.50},
-    {0.00, 0.00, 0.00, 7.40, -0.50},
-    {0.00, 0.00, 0.00, 7.80, -0.50},
-    {0.00, 0.00, 0.00, 8.20, -0.50},
-    {0.00, 0.00, 0.00, 8.60, -0.50},
-    {0.00, 0.00, 0.00, 9.00, -0.50},
-    {0.00, 0.00, 0.00, 9.40, -0.50},
-    {0.00, 0.00, 0.00, 9.80, -0.50},
-    {0.00, 0.00, 0.00, 10.20, -0.50},
-    {0.00, 0.00, 0.00, 10.60, -0.50},
-    {0.00, 0.00, 0.00, 11.00, -0.50},
-    {0.00, 0.00, 0.00, 11.40, -0.50},
-    {0.00, 0.00, 0.00, 11.80, -0.50},
-    {0.00, 0.00, 0.00, 12.20, -0.50},
-    {0.00, 0.00, 0.00, 12.60, -0.50},
-    {0.00, 0.00, 0.00, 13.00, -0.50},
-    {0.00, 0.00, 0.00, 13.40, -0.50},
-    {0.00, 0.00, 0.00, 13.80, -0.50},
-    {0.00, 0.00, 0.00, 14.20, -0.50},
-    {0.00, 0.00, 0.00, 14.60, -0.50},
-    {0.00, 0.00, 0.00, 15.00, -0.50},
-    {0.00, 0.00, 0.00, 15.40, -0.50},
-    {0.00, 0.00, 0.00, 15.80, -0.50},
-    {0.00, 0.00, 0.00, 16.20, -0.50},
-    {0.00, 0.00, 0.00, 16.60, -0.50},
-    {0.00, 0.00, 0.00, 17.00, -0.50},
-    {0.00, 0.00, 0.00, 17.40, -0.50},
-    {0.00, 0.00, 0.00, 17.80, -0.50},
-    {0.00, 0.00, 0.00, 18.20, -0.50},
-    {0.00, 0.00, 0.00, 18.60, -0.50},
-    {0.00, 0.00, 0.00, 19.00, -0.50},
-    {0.00, 0.00, 0.00, 19.40, -0.50},
-    {0.00, 0.00, 0.00, 19.80, -0.50},
-    {0.00, 0.00, 0.00, 20.20, -0.50},
-    {0.00, 0.00, 0.00, 20.60, -0.50},
-    {0.00, 0.00, 0.00, 21.00, -0.50},
-    {0.00, 0.00, 0.00, 21.40, -0.50},
-    {0.00, 0.00, 0.00, 21.80, -0.50},
-    {0.00, 0.00, 0.00, 22.20, -0.50},
-    {0.00, 0.00, 0.00, 22.60, -0.50},
-    {0.00, 0.00, 0.00, 23.00, -0.50},
-    {0.00, 0.00, 0.00, 23.40, -0.50},
-    {0.00, 0.00, 0.00, 23.80, -0.50},
-    {0.00, 0.00, 0.00, 24.20, -0.50},
-    {0.00, 0.00, 0.00, 24.60, -0.50},
-    {0.00, 0.00, 0.00, 25.00, -0.50},
-    {0.00, 0.00, 0.00, 25.40, -0.50},
-    {0.00, 0.00, 0.00, 25.80, -0.50},
-    {0.00, 0.00, 0.00, 26.20, -0.50},
-    {0.00, 0.00, 0.00, 26.60, -0.50},
-    {0.00, 0.00, 0.00, 27.00, -0.50},
-    {0.00, 0.00, 0.00, 27.40, -0.50},
-    {0.00, 0.00, 0.00, 27.80, -0.50},
-    {0.00, 0.00, 0.00, 28.20, -0.50},
-    {0.00, 0.00, 0.00, 28.60, -0.50},
-    {0.00, 0.00, 0.00, 29.00, -0.50},
-    {0.00, 0.00, 0.00, 29.40, -0.50},
-    {0.00, 0.00, 0.00, 29.80, -0.50},
-    {0.00, 0.00, 0.00, 30.20, -0.50},
-    {0.00, 0.00, 0.00, 30.60, -0.50},
-    {0.00, 0.00, 0.00, 31.00, -0.50},
-    {0.00, 0.00, 0.00, 31.40, -0.50},
-    {0.00, 0.00, 0.00, 31.80, -0.50},
-    {0.00, 0.00, 0.00, 32.20, -0.50},
-    {0.00, 0.00, 0.00, 32.60, -0.50},
-    {0.00, 0.00, 0.00, 33.00, -0.50},
-    {0.00, 0.00, 0.00, 33.40, -0.50},
-    {0.00, 0.00, 0.00, 33.80, -0.50},
-    {0.00, 0.00, 0.00, 34.20, -0.50},
-    {0.00, 0.00, 0.00, 34.60, -0.50},
-    {0.00, 0.00, 0.00, 35.00, -0.50},
-    {0.00, 0.00, 0.00, 35.40, -0.50},
-    {0.00, 0.00, 0.00, 35.80, -0.50},
-    {0.00, 0.00, 0.00, 36.20, -0.50},
-    {0.00, 0.00, 0.00, 36.60, -0.50},
-    {0.00, 0.00, 0.00, 37.00, -0.50},
-    {0.00, 0.00, 0.00, 37.40, -0.50},
-    {0.00, 0.00, 0.00, 37.80, -0.50},
-    {0.00, 0.00, 0.00, 38.20, -0.50},
-    {0.00, 0.00, 0.00, 38.60, -0.50},
-    {0.00, 0.00, 0.00, 39.00, -0.50},
-    {0.00, 0.00, 0.00, 39.40, -0.50},
-    {0.00, 0.00, 0.00, 39.80, -0.50},
-    {0.00, 0.00, 0.00, 40.20, -0.50},
-    {0.00, 0.00, 0.00, 40.60, -0.50},
-    {0.00, 0.00, 0.00, 41.00, -0.50},
-    {0.00, 0.00, 0.00, 41.40, -0.50},
-    {0.00, 0.00, 0.00, 41.80, -0.50},
-    {0.00, 0.00, 0.00, 42.20, -0.50},
-    {0.00, 0.00, 0.00, 42.60, -0.50},
-    {0.00, 0.00, 0.00, 43.00, -0.50},
-    {0.00, 0.00, 0.00, 43.40, -0.50},
-    {0.00, 0.00, 0.00, 43.80, -0.50},
-    {0.00, 0.00, 0.00, 44.20, -0.50},
-    {0.00, 0.00, 0.00, 44.60, -0.50},
-    {0.00, 0.00, 0.00, 45.00, -0.50},
-    {0.00, 0.00, 0.00, 45.40, -0.50},
-    {0.00, 0.00, 0.00, 45.80, -0.50},
-    {0.00, 0.00, 0.00, 46.20, -0.50},
-    {0.00, 0.00, 0.00, 46.60, -0.50},
-    {0.00, 0.00, 0.00, 47.00, -0.50},
-    {0.00, 0.00, 0.00, 47.40, -0.50},
-    {0.00, 0.00, 0.00, 47.80, -0.50},
-    {0.00, 0.00, 0.00, 48.20, -0.50},
-    {0.00, 0.00, 0.00, 48.60, -0.50},
-    {0.00, 0.00, 0.00, 49.00, -0.50},
-    {0.00, 0.00, 0.00, 49.40, -0.50},
-    {0.00, 0.00, 0.00, 49.80, -0.50},
-    {0.00, 0.00, 0.00, 50.20, -0.50},
-    {0.00, 0.00, 0.00, 50.60, -0.50},
-    {0.00, 0.00, 0.00, 51.00, -0.50},
-    {0.00, 0.00, 0.00, 51.40, -0.50},
-    {0.00, 0.00, 0.00, 51.80, -0.50},
-    {0.00, 0.00, 0.00, 52.20, -0.50},
-    {0.00, 0.00, 0.00, 52.60, -0.50},
-    {0.00, 0.00, 0.00, 53.00, -0.50},
-    {0.00, 0.00, 0.00, 53.40, -0.50},
-    {0.00, 0.00, 0.00, 53.80, -0.50},
-    {0.00, 0.00, 0.00, 54.20, -0.50},
-    {0.00, 0.00, 0.00, 54.60, -0.50},
-    {0.00, 0.00, 0.00, 55.00, -0.50},
-    {0.00, 0.00, 0.00, 55.40, -0.50},
-    {0.00, 0.00, 0.00, 55.80, -0.50},
-    {0.00, 0.00, 0.00, 56.20, -0.50},
-    {0.00, 0.00, 0.00, 56.60, -0.50},
-    {0.00, 0.00, 0.00, 57.00, -0.50},
-    {0.00, 0.00, 0.00, 57.40, -0.50},
-    {0.00, 0.00, 0.00, 57.80, -0.50},
-    {0.00, 0.00, 0.00, 58.20, -0.50},
-    {0.00, 0.00, 0.00, 58.60, -0.50},
-    {0.00, 0.00, 0.00, 59.00, -0.50},
-    {0.00, 0.00, 0.00, 59.40, -0.50},
-    {0.00, 0.00, 0.00, 59.80, -0.50},
-    {0.00, 0.00, 0.00, -59.80, -0.30},
-    {0.00, 0.00, 0.00, -59.40, -0.30},
-    {0.00, 0.00, 0.00, -59.00, -0.30},
-    {0.00, 0.00, 0.00, -58.60, -0.30},
-    {0.00, 0.00, 0.00, -58.20, -0.30},
-    {0.00, 0.00, 0.00, -57.80, -0.30},
-    {0.00, 0.00, 0.00, -57.40, -0.30},
-    {0.00, 0.00, 0.00, -57.00, -0.30},
-    {0.00, 0.00, 0.00, -56.60, -0.30},
-    {0.00, 0.00, 0.00, -56.20, -0.30},
-    {0.00, 0.00, 0.00, -55.80, -0.30},
-    {0.00, 0.00, 0.00, -55.40, -0.30},
-    {0.00, 0.00, 0.00, -55.00, -0.30},
-    {0.00, 0.00, 0.00, -54.60, -0.30},
-    {0.00, 0.00, 0.00, -54.20, -0.30},
-    {0.00, 0.00, 0.00, -53.80, -0.30},
-    {0.00, 0.00, 0.00, -53.40, -0.30},
-    {0.00, 0.00, 0.00, -53.00, -0.30},
-    {0.00, 0.00, 0.00, -52.60, -0.30},
-    {0.00, 0.00, 0.00, -52.20, -0.30},
-    {0.00, 0.00, 0.00, -51.80, -0.30},
-    {0.00, 0.00, 0.00, -51.40, -0.30},
-    {0.00, 0.00, 0.00, -51.00, -0.30},
-    {0.00, 0.00, 0.00, -50.60, -0.30},
-    {0.00, 0.00, 0.00, -50.20, -0.30},
-    {0.00, 0.00, 0.00, -49.80, -0.30},
-    {0.00, 0.00, 0.00, -49.40, -0.30},
-    {0.00, 0.00, 0.00, -49.00, -0.30},
-    {0.00, 0.00, 0.00, -48.60, -0.30},
-    {0.00, 0.00, 0.00, -48.20, -0.30},
-    {0.00, 0.00, 0.00, -47.80, -0.30},
-    {0.00, 0.00, 0.00, -47.40, -0.30},
-    {0.00, 0.00, 0.00, -47.00, -0.30},
-    {0.00, 0.00, 0.00, -46.60, -0.30},
-    {0.00, 0.00, 0.00, -46.20, -0.30},
-    {0.00, 0.00, 0.00, -45.80, -0.30},
-    {0.00, 0.00, 0.00, -45.40, -0.30},
-    {0.00, 0.00, 0.00, -45.00, -0.30},
-    {0.00, 0.00, 0.00, -44.60, -0.30},
-    {0.00, 0.00, 0.00, -44.20, -0.30},
-    {0.00, 0.00, 0.00, -43.80, -0.30},
-    {0.00, 0.00, 0.00, -43.40, -0.30},
-    {0.00, 0.00, 0.00, -43.00, -0.30},
-    {0.00, 0.00, 0.00, -42.60, -0.30},
-    {0.00, 0.00, 0.00, -42.20, -0.30},
-    {0.00, 0.00, 0.00, -41.80, -0.30},
-    {0.00, 0.00, 0.00, -41.40, -0.30},
-    {0.00, 0.00, 0.00, -41.00, -0.30},
-    {0.00, 0.00, 0.00, -40.60, -0.30},
-    {0.00, 0.00, 0.00, -40.20, -0.30},
-    {0.00, 0.00, 0.00, -39.80, -0.30},
-    {0.00, 0.00, 0.00, -39.40, -0.30},
-    {0.00, 0.00, 0.00, -39.00, -0.30},
-    {0.00, 0.00, 0.00, -38.60, -0.30},
-    {0.00, 0.00, 0.00, -38.20, -0.30},
-    {0.00, 0.00, 0.00, -37.80, -0.30},
-    {0.00, 0.00, 0.00, -37.40, -0.30},
-    {0.00, 0.00, 0.00, -37.00, -0.30},
-    {0.00, 0.00, 0.00, -36.60, -0.30},
-    {0.00, 0.00, 0.00, -36.20, -0.30},
-    {0.00, 0.00, 0.00, -35.80, -0.30},
-    {0.00, 0.00, 0.00, -35.40, -0.30},
-    {0.00, 0.00, 0.00, -35.00, -0.30},
-    {0.00, 0.00, 0.00, -34.60, -0.30},
-    {0.00, 0.00, 0.00, -34.20, -0.30},
-    {0.00, 0.00, 0.00, -33.80, -0.30},
-    {0.00, 0.00, 0.00, -33.40, -0.30},
-    {0.00, 0.00, 0.00, -33.00, -0.30},
-    {0.00, 0.00, 0.00, -32.60, -0.30},
-    {0.00, 0.00, 0.00, -32.20, -0.30},
-    {0.00, 0.00, 0.00, -31.80, -0.30},
-    {0.00, 0.00, 0.00, -31.40, -0.30},
-    {0.00, 0.00, 0.00, -31.00, -0.30},
-    {0.00, 0.00, 0.00, -30.60, -0.30},
-    {0.00, 0.00, 0.00, -30.20, -0.30},
-    {0.00, 0.00, 0.00, -29.80, -0.30},
-    {0.00, 0.00, 0.00, -29.40, -0.30},
-    {0.00, 0.00, 0.00, -29.00, -0.30},
-    {0.00, 0.00, 0.00, -28.60, -0.30},
-    {0.00, 0.00, 0.00, -28.20, -0.30},
-    {0.00, 0.00, 0.00, -27.80, -0.30},
-    {0.00, 0.00, 0.00, -27.40, -0.30},
-    {0.00, 0.00, 0.00, -27.00, -0.30},
-    {0.00, 0.00, 0.00, -26.60, -0.30},
-    {0.00, 0.00, 0.00, -26.20, -0.30},
-    {0.00, 0.00, 0.00, -25.80, -0.30},
-    {0.00, 0.00, 0.00, -25.40, -0.30},
-    {0.00, 0.00, 0.00, -25.00, -0.30},
-    {0.00, 0.00, 0.00, -24.60, -0.30},
-    {0.00, 0.00, 0.00, -24.20, -0.30},
-    {0.00, 0.00, 0.00, -23.80, -0.30},
-    {0.00, 0.00, 0.00, -23.40, -0.30},
-    {0.00, 0.00, 0.00, -23.00, -0.30},
-    {0.00, 0.00, 0.00, -22.60, -0.30},
-    {0.00, 0.00, 0.00, -22.20, -0.30},
-    {0.00, 0.00, 0.00, -21.80, -0.30},
-    {0.00, 0.00, 0.00, -21.40, -0.30},
-    {0.00, 0.00, 0.00, -21.00, -0.30},
-    {0.00, 0.00, 0.00, -20.60, -0.30},
-    {0.00, 0.00, 0.00, -20.20, -0.30},
-    {0.00, 0.00, 0.00, -19.80, -0.30},
-    {0.00, 0.00, 0.00, -19.40, -0.30},
-    {0.00, 0.00, 0.00, -19.00, -0.30},
-    {0.00, 0.00, 0.00, -18.60, -0.30},
-    {0.00, 0.00, 0.00, -18.20, -0.30},
-    {0.00, 0.00, 0.00, -17.80, -0.30},
-    {0.00, 0.00, 0.00, -17.40, -0.30},
-    {0.00, 0.00, 0.00, -17.00, -0.30},
-    {0.00, 0.00, 0.00, -16.60, -0.30},
-    {0.00, 0.00, 0.00, -16.20, -0.30},
-    {0.00, 0.00, 0.00, -15.80, -0.30},
-    {0.00, 0.00, 0.00, -15.40, -0.30},
-    {0.00, 0.00, 0.00, -15.00, -0.30},
-    {0.00, 0.00, 0.00, -14.60, -0.30},
-    {0.00, 0.00, 0.00, -14.20, -0.30},
-    {0.00, 0.00, 0.00, -13.80, -0.30},
-    {0.00, 0.00, 0.00, -13.40, -0.30},
-    {0.00, 0.00, 0.00, -13.00, -0.30},
-    {0.00, 0.00, 0.00, -12.60, -0.30},
-    {0.00, 0.00, 0.00, -12.20, -0.30},
-    {0.00, 0.00, 0.00, -11.80, -0.30},
-    {0.00, 0.00, 0.00, -11.40, -0.30},
-    {0.00, 0.00, 0.00, -11.00, -0.30},
-    {0.00, 0.00, 0.00, -10.60, -0.30},
-    {0.00, 0.00, 0.00, -10.20, -0.30},
-    {0.00, 0.00, 0.00, -9.80, -0.30},
-    {0.00, 0.00, 0.00, -9.40, -0.30},
-    {0.00, 0.00, 0.00, -9.00, -0.30},
-    {0.00, 0.00, 0.00, -8.60, -0.30},
-    {0.00, 0.00, 0.00, -8.20, -0.30},
-    {0.00, 0.00, 0.00, -7.80, -0.30},
-    {0.00, 0.00, 0.00, -7.40, -0.30},
-    {0.00, 0.00, 0.00, -7.00, -0.30},
-    {0.00, 0.00, 0.00, -6.60, -0.30},
-    {0.00, 0.00, 0.00, -6.20, -0.30},
-    {0.00, 0.00, 0.00, -5.80, -0.30},
-    {0.00, 0.00, 0.00, -5.40, -0.30},
-    {0.00, 0.00, 0.00, -5.00, -0.30},
-    {0.00, 0.00, 0.00, -4.60, -0.30},
-    {0.00, 0.00, 0.00, -4.20, -0.30},
-    {0.00, 0.00, 0.00, -3.80, -0.30},
-    {0.00, 0.00, 0.00, -3.40, -0.30},
-    {0.00, 0.00, 0.00, -3.00, -0.30},
-    {0.00, 0.00, 0.00, -2.60, -0.30},
-    {0.00, 0.00, 0.00, -2.20, -0.30},
-    {0.00, 0.00, 0.00, -1.80, -0.30},
-    {0.00, 0.00, 0.00, -1.40, -0.30},
-    {0.00, 0.00, 0.00, -1.00, -0.30},
-    {0.00, 0.00, 0.00, -0.60, -0.30},
-    {0.00, 0.00, 0.00, -0.20, -0.30},
-    {0.00, 0.00, 0.00, 0.20, -0.30},
-    {0.00, 0.00, 0.00, 0.60, -0.30},
-    {0.00, 0.00, 0.00, 1.00, -0.30},
-    {0.00, 0.00, 0.00, 1.40, -0.30},
-    {0.00, 0.00, 0.00, 1.80, -0.30},
-    {0.00, 0.00, 0.00, 2.20, -0.30},
-    {0.00, 0.00, 0.00, 2.60, -0.30},
-    {0.00, 0.00, 0.00, 3.00, -0.30},
-    {0.00, 0.00, 0.00, 3.40, -0.30},
-    {0.00, 0.00, 0.00, 3.80, -0.30},
-    {0.00, 0.00, 0.00, 4.20, -0.30},
-    {0.00, 0.00, 0.00, 4.60, -0.30},
-    {0.00, 0.00, 0.00, 5.00, -0.30},
-    {0.00, 0.00, 0.00, 5.40, -0.30},
-    {0.00, 0.00, 0.00, 5.80, -0.30},
-    {0.00, 0.00, 0.00, 6.20, -0.30},
-    {0.00, 0.00, 0.00, 6.60, -0.30},
-    {0.00, 0.00, 0.00, 7.00, -0.30},
-    {0.00, 0.00, 0.00, 7.40, -0.30},
-    {0.00, 0.00, 0.00, 7.80, -0.30},
-    {0.00, 0.00, 0.00, 8.20, -0.30},
-    {0.00, 0.00, 0.00, 8.60, -0.30},
-    {0.00, 0.00, 0.00, 9.00, -0.30},
-    {0.00, 0.00, 0.00, 9.40, -0.30},
-    {0.00, 0.00, 0.00, 9.80, -0.30},
-    {0.00, 0.00, 0.00, 10.20, -0.30},
-    {0.00, 0.00, 0.00, 10.60, -0.30},
-    {0.00, 0.00, 0.00, 11.00, -0.30},
-    {0.00, 0.00, 0.00, 11.40, -0.30},
-    {0.00, 0.00, 0.00, 11.80, -0.30},
-    {0.00, 0.00, 0.00, 12.20, -0.30},
-    {0.00, 0.00, 0.00, 12.60, -0.30},
-    {0.00, 0.00, 0.00, 13.00, -0.30},
-    {0.00, 0.00, 0.00, 13.40, -0.30},
-    {0.00, 0.00, 0.00, 13.80, -0.30},
-    {0.00, 0.00, 0.00, 14.20, -0.30},
-    {0.00, 0.00, 0.00, 14.60, -0.30},
-    {0.00, 0.00, 0.00, 15.00, -0.30},
-    {0.00, 0.00, 0.00, 15.40, -0.30},
-    {0.00, 0.00, 0.00, 15.80, -0.30},
-    {0.00, 0.00, 0.00, 16.20, -0.30},
-    {0.00, 0.00, 0.00, 16.60, -0.30},
-    {0.00, 0.00, 0.00, 17.00, -0.30},
-    {0.00, 0.00, 0.00, 17.40, -0.30},
-    {0.00, 0.00, 0.00, 17.80, -0.30},
-    {0.00, 0.00, 0.00, 18.20, -0.30},
-    {0.00, 0.00, 0.00, 18.60, -0.30},
-    {0.00, 0.00, 0.00, 19.00, -0.30},
-    {0.00, 0.00, 0.00, 19.40, -0.30},
-    {0.00, 0.00, 0.00, 19.80, -0.30},
-    {0.00, 0.00, 0.00, 20.20, -0.30},
-    {0.00, 0.00, 0.00, 20.60, -0.30},
-    {0.00, 0.00, 0.00, 21.00, -0.30},
-    {0.00, 0.00, 0.00, 21.40, -0.30},
-    {0.00, 0.00, 0.00, 21.80, -0.30},
-    {0.00, 0.00, 0.00, 22.20, -0.30},
-    {0.00, 0.00, 0.00, 22.60, -0.30},
-    {0.00, 0.00, 0.00, 23.00, -0.30},
-    {0.00, 0.00, 0.00, 23.40, -0.30},
-    {0.00, 0.00, 0.00, 23.80, -0.30},
-    {0.00, 0.00, 0.00, 24.20, -0.30},
-    {0.00, 0.00, 0.00, 24.60, -0.30},
-    {0.00, 0.00, 0.00, 25.00, -0.30},
-    {0.00, 0.00, 0.00, 25.40, -0.30},
-    {0.00, 0.00, 0.00, 25.80, -0.30},
-    {0.00, 0.00, 0.00, 26.20, -0.30},
-    {0.00, 0.00, 0.00, 26.60, -0.30},
-    {0.00, 0.00, 0.00, 27.00, -0.30},
-    {0.00, 0.00, 0.00, 27.40, -0.30},
-    {0.00, 0.00, 0.00, 27.80, -0.30},
-    {0.00, 0.00, 0.00, 28.20, -0.30},
-    {0.00, 0.00, 0.00, 28.60, -0.30},
-    {0.00, 0.00, 0.00, 29.00, -0.30},
-    {0.00, 0.00, 0.00, 29.40, -0.30},
-    {0.00, 0.00, 0.00, 29.80, -0.30},
-    {0.00, 0.00, 0.00, 30.20, -0.30},
-    {0.00, 0.00, 0.00, 30.60, -0.30},
-    {0.00, 0.00, 0.00, 31.00, -0.30},
-    {0.00, 0.00, 0.00, 31.40, -0.30},
-    {0.00, 0.00, 0.00, 31.80, -0.30},
-    {0.00, 0.00, 0.00, 32.20, -0.30},
-    {0.00, 0.00, 0.00, 32.60, -0.30},
-    {0.00, 0.00, 0.00, 33.00, -0.30},
-    {0.00, 0.00, 0.00, 33.40, -0.30},
-    {0.00, 0.00, 0.00, 33.80, -0.30},
-    {0.00, 0.00, 0.00, 34.20, -0.30},
-    {0.00, 0.00, 0.00, 34.60, -0.30},
-    {0.00, 0.00, 0.00, 35.00, -0.30},
-    {0.00, 0.00, 0.00, 35.40, -0.30},
-    {0.00, 0.00, 0.00, 35.80, -0.30},
-    {0.00, 0.00, 0.00, 36.20, -0.30},
-    {0.00, 0.00, 0.00, 36.60, -0.30},
-    {0.00, 0.00, 0.00, 37.00, -0.30},
-    {0.00, 0.00, 0.00, 37.40, -0.30},
-    {0.00, 0.00, 0.00, 37.80, -0.30},
-    {0.00, 0.00, 0.00, 38.20, -0.30},
-    {0.00, 0.00, 0.00, 38.60, -0.30},
-    {0.00, 0.00, 0.00, 39.00, -0.30},
-    {0.00, 0.00, 0.00, 39.40, -0.30},
-    {0.00, 0.00, 0.00, 39.80, -0.30},
-    {0.00, 0.00, 0.00, 40.20, -0.30},
-    {0.00, 0.00, 0.00, 40.60, -0.30},
-    {0.00, 0.00, 0.00, 41.00, -0.30},
-    {0.00, 0.00, 0.00, 41.40, -0.30},
-    {0.00, 0.00, 0.00, 41.80, -0.30},
-    {0.00, 0.00, 0.00, 42.20, -0.30},
-    {0.00, 0.00, 0.00, 42.60, -0.30},
-    {0.00, 0.00, 0.00, 43.00, -0.30},
-    {0.00, 0.00, 0.00, 43.40, -0.30},
-    {0.00, 0.00, 0.00, 43.80, -0.30},
-    {0.00, 0.00, 0.00, 44.20, -0.30},
-    {0.00, 0.00, 0.00, 44.60, -0.30},
-    {0.00, 0.00, 0.00, 45.00, -0.30},
-    {0.00, 0.00, 0.00, 45.40, -0.30},
-    {0.00, 0.00, 0.00, 45.80, -0.30},
-    {0.00, 0.00, 0.00, 46.20, -0.30},
-    {0.00, 0.00, 0.00, 46.60, -0.30},
-    {0.00, 0.00, 0.00, 47.00, -0.30},
-    {0.00, 0.00, 0.00, 47.40, -0.30},
-    {0.00, 0.00, 0.00, 47.80, -0.30},
-    {0.00, 0.00, 0.00, 48.20, -0.30},
-    {0.00, 0.00, 0.00, 48.60, -0.30},
-    {0.00, 0.00, 0.00, 49.00, -0.30},
-    {0.00, 0.00, 0.00, 49.40, -0.30},
-    {0.00, 0.00, 0.00, 49.80, -0.30},
-    {0.00, 0.00, 0.00, 50.20, -0.30},
-    {0.00, 0.00, 0.00, 50.60, -0.30},
-    {0.00, 0.00, 0.00, 51.00, -0.30},
-    {0.00, 0.00, 0.00, 51.40, -0.30},
-    {0.00, 0.00, 0.00, 51.80, -0.30},
-    {0.00, 0.00, 0.00, 52.20, -0.30},
-    {0.00, 0.00, 0.00, 52.60, -0.30},
-    {0.00, 0.00, 0.00, 53.00, -0.30},
-    {0.00, 0.00, 0.00, 53.40, -0.30},
-    {0.00, 0.00, 0.00, 53.80, -0.30},
-    {0.00, 0.00, 0.00, 54.20, -0.30},
-    {0.00, 0.00, 0.00, 54.60, -0.30},
-    {0.00, 0.00, 0.00, 55.00, -0.30},
-    {0.00, 0.00, 0.00, 55.40, -0.30},
-    {0.00, 0.00, 0.00, 55.80, -0.30},
-    {0.00, 0.00, 0.00, 56.20, -0.30},
-    {0.00, 0.00, 0.00, 56.60, -0.30},
-    {0.00, 0.00, 0.00, 57.00, -0.30},
-    {0.00, 0.00, 0.00, 57.40, -0.30},
-    {0.00, 0.00, 0.00, 57.80, -0.30},
-    {0.00, 0.00, 0.00, 58.20, -0.30},
-    {0.00, 0.00, 0.00, 58.60, -0.30},
-    {0.00, 0.00, 0.00, 59.00, -0.30},
-    {0.00, 0.00, 0.00, 59.40, -0.30},
-    {0.00, 0.00, 0.00, 59.80, -0.30},
-    {0.00, 0.00, 0.00, -59.80, -0.10},
-    {0.00, 0.00, 0.00, -59.40, -0.10},
-    {0.00, 0.00, 0.00, -59.00, -0.10},
-    {0.00, 0.00, 0.00, -58.60, -0.10},
-    {0.00, 0.00, 0.00, -58.20, -0.10},
-    {0.00, 0.00, 0.00, -57.80, -0.10},
-    {0.00, 0.00, 0.00, -57.40, -0.10},
-    {0.00, 0.00, 0.00, -57.00, -0.10},
-    {0.00, 0.00, 0.00, -56.60, -0.10},
-    {0.00, 0.00, 0.00, -56.20, -0.10},
-    {0.00, 0.00, 0.00, -55.80, -0.10},
-    {0.00, 0.00, 0.00, -55.40, -0.10},
-    {0.00, 0.00, 0.00, -55.00, -0.10},
-    {0.00, 0.00, 0.00, -54.60, -0.10},
-    {0.00, 0.00, 0.00, -54.20, -0.10},
-    {0.00, 0.00, 0.00, -53.80, -0.10},
-    {0.00, 0.00, 0.00, -53.40, -0.10},
-    {0.00, 0.00, 0.00, -53.00, -0.10},
-    {0.00, 0.00, 0.00, -52.60, -0.10},
-    {0.00, 0.00, 0.00, -52.20, -0.10},
-    {0.00, 0.00, 0.00, -51.80, -0.10},
-    {0.00, 0.00, 0.00, -51.40, -0.10},
-    {0.00, 0.00, 0.00, -51.00, -0.10},
-    {0.00, 0.00, 0.00, -50.60, -0.10},
-    {0.00, 0.00, 0.00, -50.20, -0.10},
-    {0.00, 0.00, 0.00, -49.80, -0.10},
-    {0.00, 0.00, 0.00, -49.40, -0.10},
-    {0.00, 0.00, 0.00, -49.00, -0.10},
-    {0.00, 0.00, 0.00, -48.60, -0.10},
-    {0.00, 0.00, 0.00, -48.20, -0.10},
-    {0.00, 0.00, 0.00, -47.80, -0.10},
-    {0.00, 0.00, 0.00, -47.40, -0.10},
-    {0.00, 0.00, 0.00, -47.00, -0.10},
-    {0.00, 0.00, 0.00, -46.60, -0.10},
-    {0.00, 0.00, 0.00, -46.20, -0.10},
-    {0.00, 0.00, 0.00, -45.80, -0.10},
-    {0.00, 0.00, 0.00, -45.40, -0.10},
-    {0.00, 0.00, 0.00, -45.00, -0.10},
-    {0.00, 0.00, 0.00, -44.60, -0.10},
-    {0.00, 0.00, 0.00, -44.20, -0.10},
-    {0.00, 0.00, 0.00, -43.80, -0.10},
-    {0.00, 0.00, 0.00, -43.40, -0.10},
-    {0.00, 0.00, 0.00, -43.00, -0.10},
-    {0.00, 0.00, 0.00, -42.60, -0.10},
-    {0.00, 0.00, 0.00, -42.20, -0.10},
-    {0.00, 0.00, 0.00, -41.80, -0.10},
-    {0.00, 0.00, 0.00, -41.40, -0.10},
-    {0.00, 0.00, 0.00, -41.00, -0.10},
-    {0.00, 0.00, 0.00, -40.60, -0.10},
-    {0.00, 0.00, 0.00, -40.20, -0.10},
-    {0.00, 0.00, 0.00, -39.80, -0.10},
-    {0.00, 0.00, 0.00, -39.40, -0.10},
-    {0.00, 0.00, 0.00, -39.00, -0.10},
-    {0.00, 0.00, 0.00, -38.60, -0.10},
-    {0.00, 0.00, 0.00, -38.20, -0.10},
-    {0.00, 0.00, 0.00, -37.80, -0.10},
-    {0.00, 0.00, 0.00, -37.40, -0.10},
-    {0.00, 0.00, 0.00, -37.00, -0.10},
-    {0.00, 0.00, 0.00, -36.60, -0.10},
-    {0.00, 0.00, 0.00, -36.20, -0.10},
-    {0.00, 0.00, 0.00, -35.80, -0.10},
-    {0.00, 0.00, 0.00, -35.40, -0.10},
-    {0.00, 0.00, 0.00, -35.00, -0.10},
-    {0.00, 0.00, 0.00, -34.60, -0.10},
-    {0.00, 0.00, 0.00, -34.20, -0.10},
-    {0.00, 0.00, 0.00, -33.80, -0.10},
-    {0.00, 0.00, 0.00, -33.40, -0.10},
-    {0.00, 0.00, 0.00, -33.00, -0.10},
-    {0.00, 0.00, 0.00, -32.60, -0.10},
-    {0.00, 0.00, 0.00, -32.20, -0.10},
-    {0.00, 0.00, 0.00, -31.80, -0.10},
-    {0.00, 0.00, 0.00, -31.40, -0.10},
-    {0.00, 0.00, 0.00, -31.00, -0.10},
-    {0.00, 0.00, 0.00, -30.60, -0.10},
-    {0.00, 0.00, 0.00, -30.20, -0.10},
-    {0.00, 0.00, 0.00, -29.80, -0.10},
-    {0.00, 0.00, 0.00, -29.40, -0.10},
-    {0.00, 0.00, 0.00, -29.00, -0.10},
-    {0.00, 0.00, 0.00, -28.60, -0.10},
-    {0.00, 0.00, 0.00, -28.20, -0.10},
-    {0.00, 0.00, 0.00, -27.80, -0.10},
-    {0.00, 0.00, 0.00, -27.40, -0.10},
-    {0.00, 0.00, 0.00, -27.00, -0.10},
-    {0.00, 0.00, 0.00, -26.60, -0.10},
-    {0.00, 0.00, 0.00, -26.20, -0.10},
-    {0.00, 0.00, 0.00, -25.80, -0.10},
-    {0.00, 0.00, 0.00, -25.40, -0.10},
-    {0.00, 0.00, 0.00, -25.00, -0.10},
-    {0.00, 0.00, 0.00, -24.60, -0.10},
-    {0.00, 0.00, 0.00, -24.20, -0.10},
-    {0.00, 0.00, 0.00, -23.80, -0.10},
-    {0.00, 0.00, 0.00, -23.40, -0.10},
-    {0.00, 0.00, 0.00, -23.00, -0.10},
-    {0.00, 0.00, 0.00, -22.60, -0.10},
-    {0.00, 0.00, 0.00, -22.20, -0.10},
-    {0.00, 0.00, 0.00, -21.80, -0.10},
-    {0.00, 0.00, 0.00, -21.40, -0.10},
-    {0.00, 0.00, 0.00, -21.00, -0.10},
-    {0.00, 0.00, 0.00, -20.60, -0.10},
-    {0.00, 0.00, 0.00, -20.20, -0.10},
-    {0.00, 0.00, 0.00, -19.80, -0.10},
-    {0.00, 0.00, 0.00, -19.40, -0.10},
-    {0.00, 0.00, 0.00, -19.00, -0.10},
-    {0.00, 0.00, 0.00, -18.60, -0.10},
-    {0.00, 0.00, 0.00, -18.20, -0.10},
-    {0.00, 0.00, 0.00, -17.80, -0.10},
-    {0.00, 0.00, 0.00, -17.40, -0.10},
-    {0.00, 0.00, 0.00, -17.00, -0.10},
-    {0.00, 0.00, 0.00, -16.60, -0.10},
-    {0.00, 0.00, 0.00, -16.20, -0.10},
-    {0.00, 0.00, 0.00, -15.80, -0.10},
-    {0.00, 0.00, 0.00, -15.40, -0.10},
-    {0.00, 0.00, 0.00, -15.00, -0.10},
-    {0.00, 0.00, 0.00, -14.60, -0.10},
-    {0.00, 0.00, 0.00, -14.20, -0.10},
-    {0.00, 0.00, 0.00, -13.80, -0.10},
-    {0.00, 0.00, 0.00, -13.40, -0.10},
-    {0.00, 0.00, 0.00, -13.00, -0.10},
-    {0.00, 0.00, 0.00, -12.60, -0.10},
-    {0.00, 0.00, 0.00, -12.20, -0.10},
-    {0.00, 0.00, 0.00, -11.80, -0.10},
-    {0.00, 0.00, 0.00, -11.40, -0.10},
-    {0.00, 0.00, 0.00, -11.00, -0.10},
-    {0.00, 0.00, 0.00, -10.60, -0.10},
-    {0.00, 0.00, 0.00, -10.20, -0.10},
-    {0.00, 0.00, 0.00, -9.80, -0.10},
-    {0.00, 0.00, 0.00, -9.40, -0.10},
-    {0.00, 0.00, 0.00, -9.00, -0.10},
-    {0.00, 0.00, 0.00, -8.60, -0.10},
-    {0.00, 0.00, 0.00, -8.20, -0.10},
-    {0.00, 0.00, 0.00, -7.80, -0.10},
-    {0.00, 0.00, 0.00, -7.40, -0.10},
-    {0.00, 0.00, 0.00, -7.00, -0.10},
-    {0.00, 0.00, 0.00, -6.60, -0.10},
-    {0.00, 0.00, 0.00, -6.20, -0.10},
-    {0.00, 0.00, 0.00, -5.80, -0.10},
-    {0.00, 0.00, 0.00, -5.40, -0.10},
-    {0.00, 0.00, 0.00, -5.00, -0.10},
-    {0.00, 0.00, 0.00, -4.60, -0.10},
-    {0.00, 0.00, 0.00, -4.20, -0.10},
-    {0.00, 0.00, 0.00, -3.80, -0.10},
-    {0.00, 0.00, 0.00, -3.40, -0.10},
-    {0.00, 0.00, 0.00, -3.00, -0.10},
-    {0.00, 0.00, 0.00, -2.60, -0.10},
-    {0.00, 0.00, 0.00, -2.20, -0.10},
-    {0.00, 0.00, 0.00, -1.80, -0.10},
-    {0.00, 0.00, 0.00, -1.40, -0.10},
-    {0.00, 0.00, 0.00, -1.00, -0.10},
-    {0.00, 0.00, 0.00, -0.60, -0.10},
-    {0.00, 0.00, 0.00, -0.20, -0.10},
-    {0.00, 0.00, 0.00, 0.20, -0.10},
-    {0.00, 0.00, 0.00, 0.60, -0.10},
-    {0.00, 0.00, 0.00, 1.00, -0.10},
-    {0.00, 0.00, 0.00, 1.40, -0.10},
-    {0.00, 0.00, 0.00, 1.80, -0.10},
-    {0.00, 0.00, 0.00, 2.20, -0.10},
-    {0.00, 0.00, 0.00, 2.60, -0.10},
-    {0.00, 0.00, 0.00, 3.00, -0.10},
-    {0.00, 0.00, 0.00, 3.40, -0.10},
-    {0.00, 0.00, 0.00, 3.80, -0.10},
-    {0.00, 0.00, 0.00, 4.20, -0.10},
-    {0.00, 0.00, 0.00, 4.60, -0.10},
-    {0.00, 0.00, 0.00, 5.00, -0.10},
-    {0.00, 0.00, 0.00, 5.40, -0.10},
-    {0.00, 0.00, 0.00, 5.80, -0.10},
-    {0.00, 0.00, 0.00, 6.20, -0.10},
-    {0.00, 0.00, 0.00, 6.60, -0.10},
-    {0.00, 0.00, 0.00, 7.00, -0.10},
-    {0.00, 0.00, 0.00, 7.40, -0.10},
-    {0.00, 0.00, 0.00, 7.80, -0.10},
-    {0.00, 0.00, 0.00, 8.20, -0.10},
-    {0.00, 0.00, 0.00, 8.60, -0.10},
-    {0.00, 0.00, 0.00, 9.00, -0.10},
-    {0.00, 0.00, 0.00, 9.40, -0.10},
-    {0.00, 0.00, 0.00, 9.80, -0.10},
-    {0.00, 0.00, 0.00, 10.20, -0.10},
-    {0.00, 0.00, 0.00, 10.60, -0.10},
-    {0.00, 0.00, 0.00, 11.00, -0.10},
-    {0.00, 0.00, 0.00, 11.40, -0.10},
-    {0.00, 0.00, 0.00, 11.80, -0.10},
-    {0.00, 0.00, 0.00, 12.20, -0.10},
-    {0.00, 0.00, 0.00, 12.60, -0.10},
-    {0.00, 0.00, 0.00, 13.00, -0.10},
-    {0.00, 0.00, 0.00, 13.40, -0.10},
-    {0.00, 0.00, 0.00, 13.80, -0.10},
-    {0.00, 0.00, 0.00, 14.20, -0.10},
-    {0.00, 0.00, 0.00, 14.60, -0.10},
-    {0.00, 0.00, 0.00, 15.00, -0.10},
-    {0.00, 0.00, 0.00, 15.40, -0.10},
-    {0.00, 0.00, 0.00, 15.80, -0.10},
-    {0.00, 0.00, 0.00, 16.20, -0.10},
-    {0.00, 0.00, 0.00, 16.60, -0.10},
-    {0.00, 0.00, 0.00, 17.00, -0.10},
-    {0.00, 0.00, 0.00, 17.40, -0.10},
-    {0.00, 0.00, 0.00, 17.80, -0.10},
-    {0.00, 0.00, 0.00, 18.20, -0.10},
-    {0.00, 0.00, 0.00, 18.60, -0.10},
-    {0.00, 0.00, 0.00, 19.00, -0.10},
-    {0.00, 0.00, 0.00, 19.40, -0.10},
-    {0.00, 0.00, 0.00, 19.80, -0.10},
-    {0.00, 0.00, 0.00, 20.20, -0.10},
-    {0.00, 0.00, 0.00, 20.60, -0.10},
-    {0.00, 0.00, 0.00, 21.00, -0.10},
-    {0.00, 0.00, 0.00, 21.40, -0.10},
-    {0.00, 0.00, 0.00, 21.80, -0.10},
-    {0.00, 0.00, 0.00, 22.20, -0.10},
-    {0.00, 0.00, 0.00, 22.60, -0.10},
-    {0.00, 0.00, 0.00, 23.00, -0.10},
-    {0.00, 0.00, 0.00, 23.40, -0.10},
-    {0.00, 0.00, 0.00, 23.80, -0.10},
-    {0.00, 0.00, 0.00, 24.20, -0.10},
-    {0.00, 0.00, 0.00, 24.60, -0.10},
-    {0.00, 0.00, 0.00, 25.00, -0.10},
-    {0.00, 0.00, 0.00, 25.40, -0.10},
-    {0.00, 0.00, 0.00, 25.80, -0.10},
-    {0.00, 0.00, 0.00, 26.20, -0.10},
-    {0.00, 0.00, 0.00, 26.60, -0.10},
-    {0.00, 0.00, 0.00, 27.00, -0.10},
-    {0.00, 0.00, 0.00, 27.40, -0.10},
-    {0.00, 0.00, 0.00, 27.80, -0.10},
-    {0.00, 0.00, 0.00, 28.20, -0.10},
-    {0.00, 0.00, 0.00, 28.60, -0.10},
-    {0.00, 0.00, 0.00, 29.00, -0.10},
-    {0.00, 0.00, 0.00, 29.40, -0.10},
-    {0.00, 0.00, 0.00, 29.80, -0.10},
-    {0.00, 0.00, 0.00, 30.20, -0.10},
-    {0.00, 0.00, 0.00, 30.60, -0.10},
-    {0.00, 0.00, 0.00, 31.00, -0.10},
-    {0.00, 0.00, 0.00, 31.40, -0.10},
-    {0.00, 0.00, 0.00, 31.80, -0.10},
-    {0.00, 0.00, 0.00, 32.20, -0.10},
-    {0.00, 0.00, 0.00, 32.60, -0.10},
-    {0.00, 0.00, 0.00, 33.00, -0.10},
-    {0.00, 0.00, 0.00, 33.40, -0.10},
-    {0.00, 0.00, 0.00, 33.80, -0.10},
-    {0.00, 0.00, 0.00, 34.20, -0.10},
-    {0.00, 0.00, 0.00, 34.60, -0.10},
-    {0.00, 0.00, 0.00, 35.00, -0.10},
-    {0.00, 0.00, 0.00, 35.40, -0.10},
-    {0.00, 0.00, 0.00, 35.80, -0.10},
-    {0.00, 0.00, 0.00, 36.20, -0.10},
-    {0.00, 0.00, 0.00, 36.60, -0.10},
-    {0.00, 0.00, 0.00, 37.00, -0.10},
-    {0.00, 0.00, 0.00, 37.40, -0.10},
-    {0.00, 0.00, 0.00, 37.80, -0.10},
-    {0.00, 0.00, 0.00, 38.20, -0.10},
-    {0.00, 0.00, 0.00, 38.60, -0.10},
-    {0.00, 0.00, 0.00, 39.00, -0.10},
-    {0.00, 0.00, 0.00, 39.40, -0.10},
-    {0.00, 0.00, 0.00, 39.80, -0.10},
-    {0.00, 0.00, 0.00, 40.20, -0.10},
-    {0.00, 0.00, 0.00, 40.60, -0.10},
-    {0.00, 0.00, 0.00, 41.00, -0.10},
-    {0.00, 0.00, 0.00, 41.40, -0.10},
-    {0.00, 0.00, 0.00, 41.80, -0.10},
-    {0.00, 0.00, 0.00, 42.20, -0.10},
-    {0.00, 0.00, 0.00, 42.60, -0.10},
-    {0.00, 0.00, 0.00, 43.00, -0.10},
-    {0.00, 0.00, 0.00, 43.40, -0.10},
-    {0.00, 0.00, 0.00, 43.80, -0.10},
-    {0.00, 0.00, 0.00, 44.20, -0.10},
-    {0.00, 0.00, 0.00, 44.60, -0.10},
-    {0.00, 0.00, 0.00, 45.00, -0.10},
-    {0.00, 0.00, 0.00, 45.40, -0.10},
-    {0.00, 0.00, 0.00, 45.80, -0.10},
-    {0.00, 0.00, 0.00, 46.20, -0.10},
-    {0.00, 0.00, 0.00, 46.60, -0.10},
-    {0.00, 0.00, 0.00, 47.00, -0.10},
-    {0.00, 0.00, 0.00, 47.40, -0.10},
-    {0.00, 0.00, 0.00, 47.80, -0.10},
-    {0.00, 0.00, 0.00, 48.20, -0.10},
-    {0.00, 0.00, 0.00, 48.60, -0.10},
-    {0.00, 0.00, 0.00, 49.00, -0.10},
-    {0.00, 0.00, 0.00, 49.40, -0.10},
-    {0.00, 0.00, 0.00, 49.80, -0.10},
-    {0.00, 0.00, 0.00, 50.20, -0.10},
-    {0.00, 0.00, 0.00, 50.60, -0.10},
-    {0.00, 0.00, 0.00, 51.00, -0.10},
-    {0.00, 0.00, 0.00, 51.40, -0.10},
-    {0.00, 0.00, 0.00, 51.80, -0.10},
-    {0.00, 0.00, 0.00, 52.20, -0.10},
-    {0.00, 0.00, 0.00, 52.60, -0.10},
-    {0.00, 0.00, 0.00, 53.00, -0.10},
-    {0.00, 0.00, 0.00, 53.40, -0.10},
-    {0.00, 0.00, 0.00, 53.80, -0.10},
-    {0.00, 0.00, 0.00, 54.20, -0.10},
-    {0.00, 0.00, 0.00, 54.60, -0.10},
-    {0.00, 0.00, 0.00, 55.00, -0.10},
-    {0.00, 0.00, 0.00, 55.40, -0.10},
-    {0.00, 0.00, 0.00, 55.80, -0.10},
-    {0.00, 0.00, 0.00, 56.20, -0.10},
-    {0.00, 0.00, 0.00, 56.60, -0.10},
-    {0.00, 0.00, 0.00, 57.00, -0.10},
-    {0.00, 0.00, 0.00, 57.40, -0.10},
-    {0.00, 0.00, 0.00, 57.80, -0.10},
-    {0.00, 0.00, 0.00, 58.20, -0.10},
-    {0.00, 0.00, 0.00, 58.60, -0.10},
-    {0.00, 0.00, 0.00, 59.00, -0.10},
-    {0.00, 0.00, 0.00, 59.40, -0.10},
-    {0.00, 0.00, 0.00, 59.80, -0.10},
-    {0.00, 0.00, 0.00, -59.80, 0.10},
-    {0.00, 0.00, 0.00, -59.40, 0.10},
-    {0.00, 0.00, 0.00, -59.00, 0.10},
-    {0.00, 0.00, 0.00, -58.60, 0.10},
-    {0.00, 0.00, 0.00, -58.20, 0.10},
-    {0.00, 0.00, 0.00, -57.80, 0.10},
-    {0.00, 0.00, 0.00, -57.40, 0.10},
-    {0.00, 0.00, 0.00, -57.00, 0.10},
-    {0.00, 0.00, 0.00, -56.60, 0.10},
-    {0.00, 0.00, 0.00, -56.20, 0.10},
-    {0.00, 0.00, 0.00, -55.80, 0.10},
-    {0.00, 0.00, 0.00, -55.40, 0.10},
-    {0.00, 0.00, 0.00, -55.00, 0.10},
-    {0.00, 0.00, 0.00, -54.60, 0.10},
-    {0.00, 0.00, 0.00, -54.20, 0.10},
-    {0.00, 0.00, 0.00, -53.80, 0.10},
-    {0.00, 0.00, 0.00, -53.40, 0.10},
-    {0.00, 0.00, 0.00, -53.00, 0.10},
-    {0.00, 0.00, 0.00, -52.60, 0.10},
-    {0.00, 0.00, 0.00, -52.20, 0.10},
-    {0.00, 0.00, 0.00, -51.80, 0.10},
-    {0.00, 0.00, 0.00, -51.40, 0.10},
-    {0.00, 0.00, 0.00, -51.00, 0.10},
-    {0.00, 0.00, 0.00, -50.60, 0.10},
-    {0.00, 0.00, 0.00, -50.20, 0.10},
-    {0.00, 0.00, 0.00, -49.80, 0.10},
-    {0.00, 0.00, 0.00, -49.40, 0.10},
-    {0.00, 0.00, 0.00, -49.00, 0.10},
-    {0.00, 0.00, 0.00, -48.60, 0.10},
-    {0.00, 0.00, 0.00, -48.20, 0.10},
-    {0.00, 0.00, 0.00, -47.80, 0.10},
-    {0.00, 0.00, 0.00, -47.40, 0.10},
-    {0.00, 0.00, 0.00, -47.00, 0.10},
-    {0.00, 0.00, 0.00, -46.60, 0.10},
-    {0.00, 0.00, 0.00, -46.20, 0.10},
-    {0.00, 0.00, 0.00, -45.80, 0.10},
-    {0.00, 0.00, 0.00, -45.40, 0.10},
-    {0.00, 0.00, 0.00, -45.00, 0.10},
-    {0.00, 0.00, 0.00, -44.60, 0.10},
-    {0.00, 0.00, 0.00, -44.20, 0.10},
-    {0.00, 0.00, 0.00, -43.80, 0.10},
-    {0.00, 0.00, 0.00, -43.40, 0.10},
-    {0.00, 0.00, 0.00, -43.00, 0.10},
-    {0.00, 0.00, 0.00, -42.60, 0.10},
-    {0.00, 0.00, 0.00, -42.20, 0.10},
-    {0.00, 0.00, 0.00, -41.80, 0.10},
-    {0.00, 0.00, 0.00, -41.40, 0.10},
-    {0.00, 0.00, 0.00, -41.00, 0.10},
-    {0.00, 0.00, 0.00, -40.60, 0.10},
-    {0.00, 0.00, 0.00, -40.20, 0.10},
-    {0.00, 0.00, 0.00, -39.80, 0.10},
-    {0.00, 0.00, 0.00, -39.40, 0.10},
-    {0.00, 0.00, 0.00, -39.00, 0.10},
-    {0.00, 0.00, 0.00, -38.60, 0.10},
-    {0.00, 0.00, 0.00, -38.20, 0.10},
-    {0.00, 0.00, 0.00, -37.80, 0.10},
-    {0.00, 0.00, 0.00, -37.40, 0.10},
-    {0.00, 0.00, 0.00, -37.00, 0.10},
-    {0.00, 0.00, 0.00, -36.60, 0.10},
-    {0.00, 0.00, 0.00, -36.20, 0.10},
-    {0.00, 0.00, 0.00, -35.80, 0.10},
-    {0.00, 0.00, 0.00, -35.40, 0.10},
-    {0.00, 0.00, 0.00, -35.00, 0.10},
-    {0.00, 0.00, 0.00, -34.60, 0.10},
-    {0.00, 0.00, 0.00, -34.20, 0.10},
-    {0.00, 0.00, 0.00, -33.80, 0.10},
-    {0.00, 0.00, 0.00, -33.40, 0.10},
-    {0.00, 0.00, 0.00, -33.00, 0.10},
-    {0.00, 0.00, 0.00, -32.60, 0.10},
-    {0.00, 0.00, 0.00, -32.20, 0.10},
-    {0.00, 0.00, 0.00, -31.80, 0.10},
-    {0.00, 0.00, 0.00, -31.40, 0.10},
-    {0.00, 0.00, 0.00, -31.00, 0.10},
-    {0.00, 0.00, 0.00, -30.60, 0.10},
-    {0.00, 0.00, 0.00, -30.20, 0.10},
-    {0.00, 0.00, 0.00, -29.80, 0.10},
-    {0.00, 0.00, 0.00, -29.40, 0.10},
-    {0.00, 0.00, 0.00, -29.00, 0.10},
-    {0.00, 0.00, 0.00, -28.60, 0.10},
-    {0.00, 0.00, 0.00, -28.20, 0.10},
-    {0.00, 0.00, 0.00, -27.80, 0.10},
-    {0.00, 0.00, 0.00, -27.40, 0.10},
-    {0.00, 0.00, 0.00, -27.00, 0.10},
-    {0.00, 0.00, 0.00, -26.60, 0.10},
-    {0.00, 0.00, 0.00, -26.20, 0.10},
-    {0.00, 0.00, 0.00, -25.80, 0.10},
-    {0.00, 0.00, 0.00, -25.40, 0.10},
-    {0.00, 0.00, 0.00, -25.00, 0.10},
-    {0.00, 0.00, 0.00, -24.60, 0.10},
-    {0.00, 0.00, 0.00, -24.20, 0.10},
-    {0.00, 0.00, 0.00, -23.80, 0.10},
-    {0.00, 0.00, 0.00, -23.40, 0.10},
-    {0.00, 0.00, 0.00, -23.00, 0.10},
-    {0.00, 0.00, 0.00, -22.60, 0.10},
-    {0.00, 0.00, 0.00, -22.20, 0.10},
-    {0.00, 0.00, 0.00, -21.80, 0.10},
-    {0.00, 0.00, 0.00, -21.40, 0.10},
-    {0.00, 0.00, 0.00, -21.00, 0.10},
-    {0.00, 0.00, 0.00, -20.60, 0.10},
-    {0.00, 0.00, 0.00, -20.20, 0.10},
-    {0.00, 0.00, 0.00, -19.80, 0.10},
-    {0.00, 0.00, 0.00, -19.40, 0.10},
-    {0.00, 0.00, 0.00, -19.00, 0.10},
-    {0.00, 0.00, 0.00, -18.60, 0.10},
-    {0.00, 0.00, 0.00, -18.20, 0.10},
-    {0.00, 0.00, 0.00, -17.80, 0.10},
-    {0.00, 0.00, 0.00, -17.40, 0.10},
-    {0.00, 0.00, 0.00, -17.00, 0.10},
-    {0.00, 0.00, 0.00, -16.60, 0.10},
-    {0.00, 0.00, 0.00, -16.20, 0.10},
-    {0.00, 0.00, 0.00, -15.80, 0.10},
-    {0.00, 0.00, 0.00, -15.40, 0.10},
-    {0.00, 0.00, 0.00, -15.00, 0.10},
-    {0.00, 0.00, 0.00, -14.60, 0.10},
-    {0.00, 0.00, 0.00, -14.20, 0.10},
-    {0.00, 0.00, 0.00, -13.80, 0.10},
-    {0.00, 0.00, 0.00, -13.40, 0.10},
-    {0.00, 0.00, 0.00, -13.00, 0.10},
-    {0.00, 0.00, 0.00, -12.60, 0.10},
-    {0.00, 0.00, 0.00, -12.20, 0.10},
-    {0.00, 0.00, 0.00, -11.80, 0.10},
-    {0.00, 0.00, 0.00, -11.40, 0.10},
-    {0.00, 0.00, 0.00, -11.00, 0.10},
-    {0.00, 0.00, 0.00, -10.60, 0.10},
-    {0.00, 0.00, 0.00, -10.20, 0.10},
-    {0.00, 0.00, 0.00, -9.80, 0.10},
-    {0.00, 0.00, 0.00, -9.40, 0.10},
-    {0.00, 0.00, 0.00, -9.00, 0.10},
-    {0.00, 0.00, 0.00, -8.60, 0.10},
-    {0.00, 0.00, 0.00, -8.20, 0.10},
-    {0.00, 0.00, 0.00, -7.80, 0.10},
-    {0.00, 0.00, 0.00, -7.40, 0.10},
-    {0.00, 0.00, 0.00, -7.00, 0.10},
-    {0.00, 0.00, 0.00, -6.60, 0.10},
-    {0.00, 0.00, 0.00, -6.20, 0.10},
-    {0.00, 0.00, 0.00, -5.80, 0.10},
-    {0.00, 0.00, 0.00, -5.40, 0.10},
-    {0.00, 0.00, 0.00, -5.00, 0.10},
-    {0.00, 0.00, 0.00, -4.60, 0.10},
-    {0.00, 0.00, 0.00, -4.20, 0.10},
-    {0.00, 0.00, 0.00, -3.80, 0.10},
-    {0.00, 0.00, 0.00, -3.40, 0.10},
-    {0.00, 0.00, 0.00, -3.00, 0.10},
-    {0.00, 0.00, 0.00, -2.60, 0.10},
-    {0.00, 0.00, 0.00, -2.20, 0.10},
-    {0.00, 0.00, 0.00, -1.80, 0.10},
-    {0.00, 0.00, 0.00, -1.40, 0.10},
-    {0.00, 0.00, 0.00, -1.00, 0.10},
-    {0.00, 0.00, 0.00, -0.60, 0.10},
-    {0.00, 0.00, 0.00, -0.20, 0.10},
-    {0.00, 0.00, 0.00, 0.20, 0.10},
-    {0.00, 0.00, 0.00, 0.60, 0.10},
-    {0.00, 0.00, 0.00, 1.00, 0.10},
-    {0.00, 0.00, 0.00, 1.40, 0.10},
-    {0.00, 0.00, 0.00, 1.80, 0.10},
-    {0.00, 0.00, 0.00, 2.20, 0.10},
-    {0.00, 0.00, 0.00, 2.60, 0.10},
-    {0.00, 0.00, 0.00, 3.00, 0.10},
-    {0.00, 0.00, 0.00, 3.40, 0.10},
-    {0.00, 0.00, 0.00, 3.80, 0.10},
-    {0.00, 0.00, 0.00, 4.20, 0.10},
-    {0.00, 0.00, 0.00, 4.60, 0.10},
-    {0.00, 0.00, 0.00, 5.00, 0.10},
-    {0.00, 0.00, 0.00, 5.40, 0.10},
-    {0.00, 0.00, 0.00, 5.80, 0.10},
-    {0.00, 0.00, 0.00, 6.20, 0.10},
-    {0.00, 0.00, 0.00, 6.60, 0.10},
-    {0.00, 0.00, 0.00, 7.00, 0.10},
-    {0.00, 0.00, 0.00, 7.40, 0.10},
-    {0.00, 0.00, 0.00, 7.80, 0.10},
-    {0.00, 0.00, 0.00, 8.20, 0.10},
-    {0.00, 0.00, 0.00, 8.60, 0.10},
-    {0.00, 0.00, 0.00, 9.00, 0.10},
-    {0.00, 0.00, 0.00, 9.40, 0.10},
-    {0.00, 0.00, 0.00, 9.80, 0.10},
-    {0.00, 0.00, 0.00, 10.20, 0.10},
-    {0.00, 0.00, 0.00, 10.60, 0.10},
-    {0.00, 0.00, 0.00, 11.00, 0.10},
-    {0.00, 0.00, 0.00, 11.40, 0.10},
-    {0.00, 0.00, 0.00, 11.80, 0.10},
-    {0.00, 0.00, 0.00, 12.20, 0.10},
-    {0.00, 0.00, 0.00, 12.60, 0.10},
-    {0.00, 0.00, 0.00, 13.00, 0.10},
-    {0.00, 0.00, 0.00, 13.40, 0.10},
-    {0.00, 0.00, 0.00, 13.80, 0.10},
-    {0.00, 0.00, 0.00, 14.20, 0.10},
-    {0.00, 0.00, 0.00, 14.60, 0.10},
-    {0.00, 0.00, 0.00, 15.00, 0.10},
-    {0.00, 0.00, 0.00, 15.40, 0.10},
-    {0.00, 0.00, 0.00, 15.80, 0.10},
-    {0.00, 0.00, 0.00, 16.20, 0.10},
-    {0.00, 0.00, 0.00, 16.60, 0.10},
-    {0.00, 0.00, 0.00, 17.00, 0.10},
-    {0.00, 0.00, 0.00, 17.40, 0.10},
-    {0.00, 0.00, 0.00, 17.80, 0.10},
-    {0.00, 0.00, 0.00, 18.20, 0.10},
-    {0.00, 0.00, 0.00, 18.60, 0.10},
-    {0.00, 0.00, 0.00, 19.00, 0.10},
-    {0.00, 0.00, 0.00, 19.40, 0.10},
-    {0.00, 0.00, 0.00, 19.80, 0.10},
-    {0.00, 0.00, 0.00, 20.20, 0.10},
-    {0.00, 0.00, 0.00, 20.60, 0.10},
-    {0.00, 0.00, 0.00, 21.00, 0.10},
-    {0.00, 0.00, 0.00, 21.40, 0.10},
-    {0.00, 0.00, 0.00, 21.80, 0.10},
-    {0.00, 0.00, 0.00, 22.20, 0.10},
-    {0.00, 0.00, 0.00, 22.60, 0.10},
-    {0.00, 0.00, 0.00, 23.00, 0.10},
-    {0.00, 0.00, 0.00, 23.40, 0.10},
-    {0.00, 0.00, 0.00, 23.80, 0.10},
-    {0.00, 0.00, 0.00, 24.20, 0.10},
-    {0.00, 0.00, 0.00, 24.60, 0.10},
-    {0.00, 0.00, 0.00, 25.00, 0.10},
-    {0.00, 0.00, 0.00, 25.40, 0.10},
-    {0.00, 0.00, 0.00, 25.80, 0.10},
-    {0.00, 0.00, 0.00, 26.20, 0.10},
-    {0.00, 0.00, 0.00, 26.60, 0.10},
-    {0.00, 0.00, 0.00, 27.00, 0.10},
-    {0.00, 0.00, 0.00, 27.40, 0.10},
-    {0.00, 0.00, 0.00, 27.80, 0.10},
-    {0.00, 0.00, 0.00, 28.20, 0.10},
-    {0.00, 0.00, 0.00, 28.60, 0.10},
-    {0.00, 0.00, 0.00, 29.00, 0.10},
-    {0.00, 0.00, 0.00, 29.40, 0.10},
-    {0.00, 0.00, 0.00, 29.80, 0.10},
-    {0.00, 0.00, 0.00, 30.20, 0.10},
-    {0.00, 0.00, 0.00, 30.60, 0.10},
-    {0.00, 0.00, 0.00, 31.00, 0.10},
-    {0.00, 0.00, 0.00, 31.40, 0.10},
-    {0.00, 0.00, 0.00, 31.80, 0.10},
-    {0.00, 0.00, 0.00, 32.20, 0.10},
-    {0.00, 0.00, 0.00, 32.60, 0.10},
-    {0.00, 0.00, 0.00, 33.00, 0.10},
-    {0.00, 0.00, 0.00, 33.40, 0.10},
-    {0.00, 0.00, 0.00, 33.80, 0.10},
-    {0.00, 0.00, 0.00, 34.20, 0.10},
-    {0.00, 0.00, 0.00, 34.60, 0.10},
-    {0.00, 0.00, 0.00, 35.00, 0.10},
-    {0.00, 0.00, 0.00, 35.40, 0.10},
-    {0.00, 0.00, 0.00, 35.80, 0.10},
-    {0.00, 0.00, 0.00, 36.20, 0.10},
-    {0.00, 0.00, 0.00, 36.60, 0.10},
-    {0.00, 0.00, 0.00, 37.00, 0.10},
-    {0.00, 0.00, 0.00, 37.40, 0.10},
-    {0.00, 0.00, 0.00, 37.80, 0.10},
-    {0.00, 0.00, 0.00, 38.20, 0.10},
-    {0.00, 0.00, 0.00, 38.60, 0.10},
-    {0.00, 0.00, 0.00, 39.00, 0.10},
-    {0.00, 0.00, 0.00, 39.40, 0.10},
-    {0.00, 0.00, 0.00, 39.80, 0.10},
-    {0.00, 0.00, 0.00, 40.20, 0.10},
-    {0.00, 0.00, 0.00, 40.60, 0.10},
-    {0.00, 0.00, 0.00, 41.00, 0.10},
-    {0.00, 0.00, 0.00, 41.40, 0.10},
-    {0.00, 0.00, 0.00, 41.80, 0.10},
-    {0.00, 0.00, 0.00, 42.20, 0.10},
-    {0.00, 0.00, 0.00, 42.60, 0.10},
-    {0.00, 0.00, 0.00, 43.00, 0.10},
-    {0.00, 0.00, 0.00, 43.40, 0.10},
-    {0.00, 0.00, 0.00, 43.80, 0.10},
-    {0.00, 0.00, 0.00, 44.20, 0.10},
-    {0.00, 0.00, 0.00, 44.60, 0.10},
-    {0.00, 0.00, 0.00, 45.00, 0.10},
-    {0.00, 0.00, 0.00, 45.40, 0.10},
-    {0.00, 0.00, 0.00, 45.80, 0.10},
-    {0.00, 0.00, 0.00, 46.20, 0.10},
-    {0.00, 0.00, 0.00, 46.60, 0.10},
-    {0.00, 0.00, 0.00, 47.00, 0.10},
-    {0.00, 0.00, 0.00, 47.40, 0.10},
-    {0.00, 0.00, 0.00, 47.80, 0.10},
-    {0.00, 0.00, 0.00, 48.20, 0.10},
-    {0.00, 0.00, 0.00, 48.60, 0.10},
-    {0.00, 0.00, 0.00, 49.00, 0.10},
-    {0.00, 0.00, 0.00, 49.40, 0.10},
-    {0.00, 0.00, 0.00, 49.80, 0.10},
-    {0.00, 0.00, 0.00, 50.20, 0.10},
-    {0.00, 0.00, 0.00, 50.60, 0.10},
-    {0.00, 0.00, 0.00, 51.00, 0.10},
-    {0.00, 0.00, 0.00, 51.40, 0.10},
-    {0.00, 0.00, 0.00, 51.80, 0.10},
-    {0.00, 0.00, 0.00, 52.20, 0.10},
-    {0.00, 0.00, 0.00, 52.60, 0.10},
-    {0.00, 0.00, 0.00, 53.00, 0.10},
-    {0.00, 0.00, 0.00, 53.40, 0.10},
-    {0.00, 0.00, 0.00, 53.80, 0.10},
-    {0.00, 0.00, 0.00, 54.20, 0.10},
-    {0.00, 0.00, 0.00, 54.60, 0.10},
-    {0.00, 0.00, 0.00, 55.00, 0.10},
-    {0.00, 0.00, 0.00, 55.40, 0.10},
-    {0.00, 0.00, 0.00, 55.80, 0.10},
-    {0.00, 0.00, 0.00, 56.20, 0.10},
-    {0.00, 0.00, 0.00, 56.60, 0.10},
-    {0.00, 0.00, 0.00, 57.00, 0.10},
-    {0.00, 0.00, 0.00, 57.40, 0.10},
-    {0.00, 0.00, 0.00, 57.80, 0.10},
-    {0.00, 0.00, 0.00, 58.20, 0.10},
-    {0.00, 0.00, 0.00, 58.60, 0.10},
-    {0.00, 0.00, 0.00, 59.00, 0.10},
-    {0.00, 0.00, 0.00, 59.40, 0.10},
-    {0.00, 0.00, 0.00, 59.80, 0.10},
-    {0.00, 0.00, 0.00, -59.80, 0.30},
-    {0.00, 0.00, 0.00, -59.40, 0.30},
-    {0.00, 0.00, 0.00, -59.00, 0.30},
-    {0.00, 0.00, 0.00, -58.60, 0.30},
-    {0.00, 0.00, 0.00, -58.20, 0.30},
-    {0.00, 0.00, 0.00, -57.80, 0.30},
-    {0.00, 0.00, 0.00, -57.40, 0.30},
-    {0.00, 0.00, 0.00, -57.00, 0.30},
-    {0.00, 0.00, 0.00, -56.60, 0.30},
-    {0.00, 0.00, 0.00, -56.20, 0.30},
-    {0.00, 0.00, 0.00, -55.80, 0.30},
-    {0.00, 0.00, 0.00, -55.40, 0.30},
-    {0.00, 0.00, 0.00, -55.00, 0.30},
-    {0.00, 0.00, 0.00, -54.60, 0.30},
-    {0.00, 0.00, 0.00, -54.20, 0.30},
-    {0.00, 0.00, 0.00, -53.80, 0.30},
-    {0.00, 0.00, 0.00, -53.40, 0.30},
-    {0.00, 0.00, 0.00, -53.00, 0.30},
-    {0.00, 0.00, 0.00, -52.60, 0.30},
-    {0.00, 0.00, 0.00, -52.20, 0.30},
-    {0.00, 0.00, 0.00, -51.80, 0.30},
-    {0.00, 0.00, 0.00, -51.40, 0.30},
-    {0.00, 0.00, 0.00, -51.00, 0.30},
-    {0.00, 0.00, 0.00, -50.60, 0.30},
-    {0.00, 0.00, 0.00, -50.20, 0.30},
-    {0.00, 0.00, 0.00, -49.80, 0.30},
-    {0.00, 0.00, 0.00, -49.40, 0.30},
-    {0.00, 0.00, 0.00, -49.00, 0.30},
-    {0.00, 0.00, 0.00, -48.60, 0.30},
-    {0.00, 0.00, 0.00, -48.20, 0.30},
-    {0.00, 0.00, 0.00, -47.80, 0.30},
-    {0.00, 0.00, 0.00, -47.40, 0.30},
-    {0.00, 0.00, 0.00, -47.00, 0.30},
-    {0.00, 0.00, 0.00, -46.60, 0.30},
-    {0.00, 0.00, 0.00, -46.20, 0.30},
-    {0.00, 0.00, 0.00, -45.80, 0.30},
-    {0.00, 0.00, 0.00, -45.40, 0.30},
-    {0.00, 0.00, 0.00, -45.00, 0.30},
-    {0.00, 0.00, 0.00, -44.60, 0.30},
-    {0.00, 0.00, 0.00, -44.20, 0.30},
-    {0.00, 0.00, 0.00, -43.80, 0.30},
-    {0.00, 0.00, 0.00, -43.40, 0.30},
-    {0.00, 0.00, 0.00, -43.00, 0.30},
-    {0.00, 0.00, 0.00, -42.60, 0.30},
-    {0.00, 0.00, 0.00, -42.20, 0.30},
-    {0.00, 0.00, 0.00, -41.80, 0.30},
-    {0.00, 0.00, 0.00, -41.40, 0.30},
-    {0.00, 0.00, 0.00, -41.00, 0.30},
-    {0.00, 0.00, 0.00, -40.60, 0.30},
-    {0.00, 0.00, 0.00, -40.20, 0.30},
-    {0.00, 0.00, 0.00, -39.80, 0.30},
-    {0.00, 0.00, 0.00, -39.40, 0.30},
-    {0.00, 0.00, 0.00, -39.00, 0.30},
-    {0.00, 0.00, 0.00, -38.60, 0.30},
-    {0.00, 0.00, 0.00, -38.20, 0.30},
-    {0.00, 0.00, 0.00, -37.80, 0.30},
-    {0.00, 0.00, 0.00, -37.40, 0.30},
-    {0.00, 0.00, 0.00, -37.00, 0.30},
-    {0.00, 0.00, 0.00, -36.60, 0.30},
-    {0.00, 0.00, 0.00, -36.20, 0.30},
-    {0.00, 0.00, 0.00, -35.80, 0.30},
-    {0.00, 0.00, 0.00, -35.40, 0.30},
-    {0.00, 0.00, 0.00, -35.00, 0.30},
-    {0.00, 0.00, 0.00, -34.60, 0.30},
-    {0.00, 0.00, 0.00, -34.20, 0.30},
-    {0.00, 0.00, 0.00, -33.80, 0.30},
-    {0.00, 0.00, 0.00, -33.40, 0.30},
-    {0.00, 0.00, 0.00, -33.00, 0.30},
-    {0.00, 0.00, 0.00, -32.60, 0.30},
-    {0.00, 0.00, 0.00, -32.20, 0.30},
-    {0.00, 0.00, 0.00, -31.80, 0.30},
-    {0.00, 0.00, 0.00, -31.40, 0.30},
-    {0.00, 0.00, 0.00, -31.00, 0.30},
-    {0.00, 0.00, 0.00, -30.60, 0.30},
-    {0.00, 0.00, 0.00, -30.20, 0.30},
-    {0.00, 0.00, 0.00, -29.80, 0.30},
-    {0.00, 0.00, 0.00, -29.40, 0.30},
-    {0.00, 0.00, 0.00, -29.00, 0.30},
-    {0.00, 0.00, 0.00, -28.60, 0.30},
-    {0.00, 0.00, 0.00, -28.20, 0.30},
-    {0.00, 0.00, 0.00, -27.80, 0.30},
-    {0.00, 0.00, 0.00, -27.40, 0.30},
-    {0.00, 0.00, 0.00, -27.00, 0.30},
-    {0.00, 0.00, 0.00, -26.60, 0.30},
-    {0.00, 0.00, 0.00, -26.20, 0.30},
-    {0.00, 0.00, 0.00, -25.80, 0.30},
-    {0.00, 0.00, 0.00, -25.40, 0.30},
-    {0.00, 0.00, 0.00, -25.00, 0.30},
-    {0.00, 0.00, 0.00, -24.60, 0.30},
-    {0.00, 0.00, 0.00, -24.20, 0.30},
-    {0.00, 0.00, 0.00, -23.80, 0.30},
-    {0.00, 0.00, 0.00, -23.40, 0.30},
-    {0.00, 0.00, 0.00, -23.00, 0.30},
-    {0.00, 0.00, 0.00, -22.60, 0.30},
-    {0.00, 0.00, 0.00, -22.20, 0.30},
-    {0.00, 0.00, 0.00, -21.80, 0.30},
-    {0.00, 0.00, 0.00, -21.40, 0.30},
-    {0.00, 0.00, 0.00, -21.00, 0.30},
-    {0.00, 0.00, 0.00, -20.60, 0.30},
-    {0.00, 0.00, 0.00, -20.20, 0.30},
-    {0.00, 0.00, 0.00, -19.80, 0.30},
-    {0.00, 0.00, 0.00, -19.40, 0.30},
-    {0.00, 0.00, 0.00, -19.00, 0.30},
-    {0.00, 0.00, 0.00, -18.60, 0.30},
-    {0.00, 0.00, 0.00, -18.20, 0.30},
-    {0.00, 0.00, 0.00, -17.80, 0.30},
-    {0.00, 0.00, 0.00, -17.40, 0.30},
-    {0.00, 0.00, 0.00, -17.00, 0.30},
-    {0.00, 0.00, 0.00, -16.60, 0.30},
-    {0.00, 0.00, 0.00, -16.20, 0.30},
-    {0.00, 0.00, 0.00, -15.80, 0.30},
-    {0.00, 0.00, 0.00, -15.40, 0.30},
-    {0.00, 0.00, 0.00, -15.00, 0.30},
-    {0.00, 0.00, 0.00, -14.60, 0.30},
-    {0.00, 0.00, 0.00, -14.20, 0.30},
-    {0.00, 0.00, 0.00, -13.80, 0.30},
-    {0.00, 0.00, 0.00, -13.40, 0.30},
-    {0.00, 0.00, 0.00, -13.00, 0.30},
-    {0.00, 0.00, 0.00, -12.60, 0.30},
-    {0.00, 0.00, 0.00, -12.20, 0.30},
-    {0.00, 0.00, 0.00, -11.80, 0.30},
-    {0.00, 0.00, 0.00, -11.40, 0.30},
-    {0.00, 0.00, 0.00, -11.00, 0.30},
-    {0.00, 0.00, 0.00, -10.60, 0.30},
-    {0.00, 0.00, 0.00, -10.20, 0.30},
-    {0.00, 0.00, 0.00, -9.80, 0.30},
-    {0.00, 0.00, 0.00, -9.40, 0.30},
-    {0.00, 0.00, 0.00, -9.00, 0.30},
-    {0.00, 0.00, 0.00, -8.60, 0.30},
-    {0.00, 0.00, 0.00, -8.20, 0.30},
-    {0.00, 0.00, 0.00, -7.80, 0.30},
-    {0.00, 0.00, 0.00, -7.40, 0.30},
-    {0.00, 0.00, 0.00, -7.00, 0.30},
-    {0.00, 0.00, 0.00, -6.60, 0.30},
-    {0.00, 0.00, 0.00, -6.20, 0.30},
-    {0.00, 0.00, 0.00, -5.80, 0.30},
-    {0.00, 0.00, 0.00, -5.40, 0.30},
-    {0.00, 0.00, 0.00, -5.00, 0.30},
-    {0.00, 0.00, 0.00, -4.60, 0.30},
-    {0.00, 0.00, 0.00, -4.20, 0.30},
-    {0.00, 0.00, 0.00, -3.80, 0.30},
-    {0.00, 0.00, 0.00, -3.40, 0.30},
-    {0.00, 0.00, 0.00, -3.00, 0.30},
-    {0.00, 0.00, 0.00, -2.60, 0.30},
-    {0.00, 0.00, 0.00, -2.20, 0.30},
-    {0.00, 0.00, 0.00, -1.80, 0.30},
-    {0.00, 0.00, 0.00, -1.40, 0.30},
-    {0.00, 0.00, 0.00, -1.00, 0.30},
-    {0.00, 0.00, 0.00, -0.60, 0.30},
-    {0.00, 0.00, 0.00, -0.20, 0.30},
-    {0.00, 0.00, 0.00, 0.20, 0.30},
-    {0.00, 0.00, 0.00, 0.60, 0.30},
-    {0.00, 0.00, 0.00, 1.00, 0.30},
-    {0.00, 0.00, 0.00, 1.40, 0.30},
-    {0.00, 0.00, 0.00, 1.80, 0.30},
-    {0.00, 0.00, 0.00, 2.20, 0.30},
-    {0.00, 0.00, 0.00, 2.60, 0.30},
-    {0.00, 0.00, 0.00, 3.00, 0.30},
-    {0.00, 0.00, 0.00, 3.40, 0.30},
-    {0.00, 0.00, 0.00, 3.80, 0.30},
-    {0.00, 0.00, 0.00, 4.20, 0.30},
-    {0.00, 0.00, 0.00, 4.60, 0.30},
-    {0.00, 0.00, 0.00, 5.00, 0.30},
-    {0.00, 0.00, 0.00, 5.40, 0.30},
-    {0.00, 0.00, 0.00, 5.80, 0.30},
-    {0.00, 0.00, 0.00, 6.20, 0.30},
-    {0.00, 0.00, 0.00, 6.60, 0.30},
-    {0.00, 0.00, 0.00, 7.00, 0.30},
-    {0.00, 0.00, 0.00, 7.40, 0.30},
-    {0.00, 0.00, 0.00, 7.80, 0.30},
-    {0.00, 0.00, 0.00, 8.20, 0.30},
-    {0.00, 0.00, 0.00, 8.60, 0.30},
-    {0.00, 0.00, 0.00, 9.00, 0.30},
-    {0.00, 0.00, 0.00, 9.40, 0.30},
-    {0.00, 0.00, 0.00, 9.80, 0.30},
-    {0.00, 0.00, 0.00, 10.20, 0.30},
-    {0.00, 0.00, 0.00, 10.60, 0.30},
-    {0.00, 0.00, 0.00, 11.00, 0.30},
-    {0.00, 0.00, 0.00, 11.40, 0.30},
-    {0.00, 0.00, 0.00, 11.80, 0.30},
-    {0.00, 0.00, 0.00, 12.20, 0.30},
-    {0.00, 0.00, 0.00, 12.60, 0.30},
-    {0.00, 0.00, 0.00, 13.00, 0.30},
-    {0.00, 0.00, 0.00, 13.40, 0.30},
-    {0.00, 0.00, 0.00, 13.80, 0.30},
-    {0.00, 0.00, 0.00, 14.20, 0.30},
-    {0.00, 0.00, 0.00, 14.60, 0.30},
-    {0.00, 0.00, 0.00, 15.00, 0.30},
-    {0.00, 0.00, 0.00, 15.40, 0.30},
-    {0.00, 0.00, 0.00, 15.80, 0.30},
-    {0.00, 0.00, 0.00, 16.20, 0.30},
-    {0.00, 0.00, 0.00, 16.60, 0.30},
-    {0.00, 0.00, 0.00, 17.00, 0.30},
-    {0.00, 0.00, 0.00, 17.40, 0.30},
-    {0.00, 0.00, 0.00, 17.80, 0.30},
-    {0.00, 0.00, 0.00, 18.20, 0.30},
-    {0.00, 0.00, 0.00, 18.60, 0.30},
-    {0.00, 0.00, 0.00, 19.00, 0.30},
-    {0.00, 0.00, 0.00, 19.40, 0.30},
-    {0.00, 0.00, 0.00, 19.80, 0.30},
-    {0.00, 0.00, 0.00, 20.20, 0.30},
-    {0.00, 0.00, 0.00, 20.60, 0.30},
-    {0.00, 0.00, 0.00, 21.00, 0.30},
-    {0.00, 0.00, 0.00, 21.40, 0.30},
-    {0.00, 0.00, 0.00, 21.80, 0.30},
-    {0.00, 0.00, 0.00, 22.20, 0.30},
-    {0.00, 0.00, 0.00, 22.60, 0.30},
-    {0.00, 0.00, 0.00, 23.00, 0.30},
-    {0.00, 0.00, 0.00, 23.40, 0.30},
-    {0.00, 0.00, 0.00, 23.80, 0.30},
-    {0.00, 0.00, 0.00, 24.20, 0.30},
-    {0.00, 0.00, 0.00, 24.60, 0.30},
-    {0.00, 0.00, 0.00, 25.00, 0.30},
-    {0.00, 0.00, 0.00, 25.40, 0.30},
-    {0.00, 0.00, 0.00, 25.80, 0.30},
-    {0.00, 0.00, 0.00, 26.20, 0.30},
-    {0.00, 0.00, 0.00, 26.60, 0.30},
-    {0.00, 0.00, 0.00, 27.00, 0.30},
-    {0.00, 0.00, 0.00, 27.40, 0.30},
-    {0.00, 0.00, 0.00, 27.80, 0.30},
-    {0.00, 0.00, 0.00, 28.20, 0.30},
-    {0.00, 0.00, 0.00, 28.60, 0.30},
-    {0.00, 0.00, 0.00, 29.00, 0.30},
-    {0.00, 0.00, 0.00, 29.40, 0.30},
-    {0.00, 0.00, 0.00, 29.80, 0.30},
-    {0.00, 0.00, 0.00, 30.20, 0.30},
-    {0.00, 0.00, 0.00, 30.60, 0.30},
-    {0.00, 0.00, 0.00, 31.00, 0.30},
-    {0.00, 0.00, 0.00, 31.40, 0.30},
-    {0.00, 0.00, 0.00, 31.80, 0.30},
-    {0.00, 0.00, 0.00, 32.20, 0.30},
-    {0.00, 0.00, 0.00, 32.60, 0.30},
-    {0.00, 0.00, 0.00, 33.00, 0.30},
-    {0.00, 0.00, 0.00, 33.40, 0.30},
-    {0.00, 0.00, 0.00, 33.80, 0.30},
-    {0.00, 0.00, 0.00, 34.20, 0.30},
-    {0.00, 0.00, 0.00, 34.60, 0.30},
-    {0.00, 0.00, 0.00, 35.00, 0.30},
-    {0.00, 0.00, 0.00, 35.40, 0.30},
-    {0.00, 0.00, 0.00, 35.80, 0.30},
-    {0.00, 0.00, 0.00, 36.20, 0.30},
-    {0.00, 0.00, 0.00, 36.60, 0.30},
-    {0.00, 0.00, 0.00, 37.00, 0.30},
-    {0.00, 0.00, 0.00, 37.40, 0.30},
-    {0.00, 0.00, 0.00, 37.80, 0.30},
-    {0.00, 0.00, 0.00, 38.20, 0.30},
-    {0.00, 0.00, 0.00, 38.60, 0.30},
-    {0.00, 0.00, 0.00, 39.00, 0.30},
-    {0.00, 0.00, 0.00, 39.40, 0.30},
-    {0.00, 0.00, 0.00, 39.80, 0.30},
-    {0.00, 0.00, 0.00, 40.20, 0.30},
-    {0.00, 0.00, 0.00, 40.60, 0.30},
-    {0.00, 0.00, 0.00, 41.00, 0.30},
-    {0.00, 0.00, 0.00, 41.40, 0.30},
-    {0.00, 0.00, 0.00, 41.80, 0.30},
-    {0.00, 0.00, 0.00, 42.20, 0.30},
-    {0.00, 0.00, 0.00, 42.60, 0.30},
-    {0.00, 0.00, 0.00, 43.00, 0.30},
-    {0.00, 0.00, 0.00, 43.40, 0.30},
-    {0.00, 0.00, 0.00, 43.80, 0.30},
-    {0.00, 0.00, 0.00, 44.20, 0.30},
-    {0.00, 0.00, 0.00, 44.60, 0.30},
-    {0.00, 0.00, 0.00, 45.00, 0.30},
-    {0.00, 0.00, 0.00, 45.40, 0.30},
-    {0.00, 0.00, 0.00, 45.80, 0.30},
-    {0.00, 0.00, 0.00, 46.20, 0.30},
-    {0.00, 0.00, 0.00, 46.60, 0.30},
-    {0.00, 0.00, 0.00, 47.00, 0.30},
-    {0.00, 0.00, 0.00, 47.40, 0.30},
-    {0.00, 0.00, 0.00, 47.80, 0.30},
-    {0.00, 0.00, 0.00, 48.20, 0.30},
-    {0.00, 0.00, 0.00, 48.60, 0.30},
-    {0.00, 0.00, 0.00, 49.00, 0.30},
-    {0.00, 0.00, 0.00, 49.40, 0.30},
-    {0.00, 0.00, 0.00, 49.80, 0.30},
-    {0.00, 0.00, 0.00, 50.20, 0.30},
-    {0.00, 0.00, 0.00, 50.60, 0.30},
-    {0.00, 0.00, 0.00, 51.00, 0.30},
-    {0.00, 0.00, 0.00, 51.40, 0.30},
-    {0.00, 0.00, 0.00, 51.80, 0.30},
-    {0.00, 0.00, 0.00, 52.20, 0.30},
-    {0.00, 0.00, 0.00, 52.60, 0.30},
-    {0.00, 0.00, 0.00, 53.00, 0.30},
-    {0.00, 0.00, 0.00, 53.40, 0.30},
-    {0.00, 0.00, 0.00, 53.80, 0.30},
-    {0.00, 0.00, 0.00, 54.20, 0.30},
-    {0.00, 0.00, 0.00, 54.60, 0.30},
-    {0.00, 0.00, 0.00, 55.00, 0.30},
-    {0.00, 0.00, 0.00, 55.40, 0.30},
-    {0.00, 0.00, 0.00, 55.80, 0.30},
-    {0.00, 0.00, 0.00, 56.20, 0.30},
-    {0.00, 0.00, 0.00, 56.60, 0.30},
-    {0.00, 0.00, 0.00, 57.00, 0.30},
-    {0.00, 0.00, 0.00, 57.40, 0.30},
-    {0.00, 0.00, 0.00, 57.80, 0.30},
-    {0.00, 0.00, 0.00, 58.20, 0.30},
-    {0.00, 0.00, 0.00, 58.60, 0.30},
-    {0.00, 0.00, 0.00, 59.00, 0.30},
-    {0.00, 0.00, 0.00, 59.40, 0.30},
-    {0.00, 0.00, 0.00, 59.80, 0.30},
-    {0.00, 0.00, 0.00, -59.80, 0.50},
-    {0.00, 0.00, 0.00, -59.40, 0.50},
-    {0.00, 0.00, 0.00, -59.00, 0.50},
-    {0.00, 0.00, 0.00, -58.60, 0.50},
-    {0.00, 0.00, 0.00, -58.20, 0.50},
-    {0.00, 0.00, 0.00, -57.80, 0.50},
-    {0.00, 0.00, 0.00, -57.40, 0.50},
-    {0.00, 0.00, 0.00, -57.00, 0.50},
-    {0.00, 0.00, 0.00, -56.60, 0.50},
-    {0.00, 0.00, 0.00, -56.20, 0.50},
-    {0.00, 0.00, 0.00, -55.80, 0.50},
-    {0.00, 0.00, 0.00, -55.40, 0.50},
-    {0.00, 0.00, 0.00, -55.00, 0.50},
-    {0.00, 0.00, 0.00, -54.60, 0.50},
-    {0.00, 0.00, 0.00, -54.20, 0.50},
-    {0.00, 0.00, 0.00, -53.80, 0.50},
-    {0.00, 0.00, 0.00, -53.40, 0.50},
-    {0.00, 0.00, 0.00, -53.00, 0.50},
-    {0.00, 0.00, 0.00, -52.60, 0.50},
-    {0.00, 0.00, 0.00, -52.20, 0.50},
-    {0.00, 0.00, 0.00, -51.80, 0.50},
-    {0.00, 0.00, 0.00, -51.40, 0.50},
-    {0.00, 0.00, 0.00, -51.00, 0.50},
-    {0.00, 0.00, 0.00, -50.60, 0.50},
-    {0.00, 0.00, 0.00, -50.20, 0.50},
-    {0.00, 0.00, 0.00, -49.80, 0.50},
-    {0.00, 0.00, 0.00, -49.40, 0.50},
-    {0.00, 0.00, 0.00, -49.00, 0.50},
-    {0.00, 0.00, 0.00, -48.60, 0.50},
-    {0.00, 0.00, 0.00, -48.20, 0.50},
-    {0.00, 0.00, 0.00, -47.80, 0.50},
-    {0.00, 0.00, 0.00, -47.40, 0.50},
-    {0.00, 0.00, 0.00, -47.00, 0.50},
-    {0.00, 0.00, 0.00, -46.60, 0.50},
-    {0.00, 0.00, 0.00, -46.20, 0.50},
-    {0.00, 0.00, 0.00, -45.80, 0.50},
-    {0.00, 0.00, 0.00, -45.40, 0.50},
-    {0.00, 0.00, 0.00, -45.00, 0.50},
-    {0.00, 0.00, 0.00, -44.60, 0.50},
-    {0.00, 0.00, 0.00, -44.20, 0.50},
-    {0.00, 0.00, 0.00, -43.80, 0.50},
-    {0.00, 0.00, 0.00, -43.40, 0.50},
-    {0.00, 0.00, 0.00, -43.00, 0.50},
-    {0.00, 0.00, 0.00, -42.60, 0.50},
-    {0.00, 0.00, 0.00, -42.20, 0.50},
-    {0.00, 0.00, 0.00, -41.80, 0.50},
-    {0.00, 0.00, 0.00, -41.40, 0.50},
-    {0.00, 0.00, 0.00, -41.00, 0.50},
-    {0.00, 0.00, 0.00, -40.60, 0.50},
-    {0.00, 0.00, 0.00, -40.20, 0.50},
-    {0.00, 0.00, 0.00, -39.80, 0.50},
-    {0.00, 0.00, 0.00, -39.40, 0.50},
-    {0.00, 0.00, 0.00, -39.00, 0.50},
-    {0.00, 0.00, 0.00, -38.60, 0.50},
-    {0.00, 0.00, 0.00, -38.20, 0.50},
-    {0.00, 0.00, 0.00, -37.80, 0.50},
-    {0.00, 0.00, 0.00, -37.40, 0.50},
-    {0.00, 0.00, 0.00, -37.00, 0.50},
-    {0.00, 0.00, 0.00, -36.60, 0.50},
-    {0.00, 0.00, 0.00, -36.20, 0.50},
-    {0.00, 0.00, 0.00, -35.80, 0.50},
-    {0.00, 0.00, 0.00, -35.40, 0.50},
-    {0.00, 0.00, 0.00, -35.00, 0.50},
-    {0.00, 0.00, 0.00, -34.60, 0.50},
-    {0.00, 0.00, 0.00, -34.20, 0.50},
-    {0.00, 0.00, 0.00, -33.80, 0.50},
-    {0.00, 0.00, 0.00, -33.40, 0.50},
-    {0.00, 0.00, 0.00, -33.00, 0.50},
-    {0.00, 0.00, 0.00, -32.60, 0.50},
-    {0.00, 0.00, 0.00, -32.20, 0.50},
-    {0.00, 0.00, 0.00, -31.80, 0.50},
-    {0.00, 0.00, 0.00, -31.40, 0.50},
-    {0.00, 0.00, 0.00, -31.00, 0.50},
-    {0.00, 0.00, 0.00, -30.60, 0.50},
-    {0.00, 0.00, 0.00, -30.20, 0.50},
-    {0.00, 0.00, 0.00, -29.80, 0.50},
-    {0.00, 0.00, 0.00, -29.40, 0.50},
-    {0.00, 0.00, 0.00, -29.00, 0.50},
-    {0.00, 0.00, 0.00, -28.60, 0.50},
-    {0.00, 0.00, 0.00, -28.20, 0.50},
-    {0.00, 0.00, 0.00, -27.80, 0.50},
-    {0.00, 0.00, 0.00, -27.40, 0.50},
-    {0.00, 0.00, 0.00, -27.00, 0.50},
-    {0.00, 0.00, 0.00, -26.60, 0.50},
-    {0.00, 0.00, 0.00, -26.20, 0.50},
-    {0.00, 0.00, 0.00, -25.80, 0.50},
-    {0.00, 0.00, 0.00, -25.40, 0.50},
-    {0.00, 0.00, 0.00, -25.00, 0.50},
-    {0.00, 0.00, 0.00, -24.60, 0.50},
-    {0.00, 0.00, 0.00, -24.20, 0.50},
-    {0.00, 0.00, 0.00, -23.80, 0.50},
-    {0.00, 0.00, 0.00, -23.40, 0.50},
-    {0.00, 0.00, 0.00, -23.00, 0.50},
-    {0.00, 0.00, 0.00, -22.60, 0.50},
-    {0.00, 0.00, 0.00, -22.20, 0.50},
-    {0.00, 0.00, 0.00, -21.80, 0.50},
-    {0.00, 0.00, 0.00, -21.40, 0.50},
-    {0.00, 0.00, 0.00, -21.00, 0.50},
-    {0.00, 0.00, 0.00, -20.60, 0.50},
-    {0.00, 0.00, 0.00, -20.20, 0.50},
-    {0.00, 0.00, 0.00, -19.80, 0.50},
-    {0.00, 0.00, 0.00, -19.40, 0.50},
-    {0.00, 0.00, 0.00, -19.00, 0.50},
-    {0.00, 0.00, 0.00, -18.60, 0.50},
-    {0.00, 0.00, 0.00, -18.20, 0.50},
-    {0.00, 0.00, 0.00, -17.80, 0.50},
-    {0.00, 0.00, 0.00, -17.40, 0.50},
-    {0.00, 0.00, 0.00, -17.00, 0.50},
-    {0.00, 0.00, 0.00, -16.60, 0.50},
-    {0.00, 0.00, 0.00, -16.20, 0.50},
-    {0.00, 0.00, 0.00, -15.80, 0.50},
-    {0.00, 0.00, 0.00, -15.40, 0.50},
-    {0.00, 0.00, 0.00, -15.00, 0.50},
-    {0.00, 0.00, 0.00, -14.60, 0.50},
-    {0.00, 0.00, 0.00, -14.20, 0.50},
-    {0.00, 0.00, 0.00, -13.80, 0.50},
-    {0.00, 0.00, 0.00, -13.40, 0.50},
-    {0.00, 0.00, 0.00, -13.00, 0.50},
-    {0.00, 0.00, 0.00, -12.60, 0.50},
-    {0.00, 0.00, 0.00, -12.20, 0.50},
-    {0.00, 0.00, 0.00, -11.80, 0.50},
-    {0.00, 0.00, 0.00, -11.40, 0.50},
-    {0.00, 0.00, 0.00, -11.00, 0.50},
-    {0.00, 0.00, 0.00, -10.60, 0.50},
-    {0.00, 0.00, 0.00, -10.20, 0.50},
-    {0.00, 0.00, 0.00, -9.80, 0.50},
-    {0.00, 0.00, 0.00, -9.40, 0.50},
-    {0.00, 0.00, 0.00, -9.00, 0.50},
-    {0.00, 0.00, 0.00, -8.60, 0.50},
-    {0.00, 0.00, 0.00, -8.20, 0.50},
-    {0.00, 0.00, 0.00, -7.80, 0.50},
-    {0.00, 0.00, 0.00, -7.40, 0.50},
-    {0.00, 0.00, 0.00, -7.00, 0.50},
-    {0.00, 0.00, 0.00, -6.60, 0.50},
-    {0.00, 0.00, 0.00, -6.20, 0.50},
-    {0.00, 0.00, 0.00, -5.80, 0.50},
-    {0.00, 0.00, 0.00, -5.40, 0.50},
-    {0.00, 0.00, 0.00, -5.00, 0.50},
-    {0.00, 0.00, 0.00, -4.60, 0.50},
-    {0.00, 0.00, 0.00, -4.20, 0.50},
-    {0.00, 0.00, 0.00, -3.80, 0.50},
-    {0.00, 0.00, 0.00, -3.40, 0.50},
-    {0.00, 0.00, 0.00, -3.00, 0.50},
-    {0.00, 0.00, 0.00, -2.60, 0.50},
-    {0.00, 0.00, 0.00, -2.20, 0.50},
-    {0.00, 0.00, 0.00, -1.80, 0.50},
-    {0.00, 0.00, 0.00, -1.40, 0.50},
-    {0.00, 0.00, 0.00, -1.00, 0.50},
-    {0.00, 0.00, 0.00, -0.60, 0.50},
-    {0.00, 0.00, 0.00, -0.20, 0.50},
-    {0.00, 0.00, 0.00, 0.20, 0.50},
-    {0.00, 0.00, 0.00, 0.60, 0.50},
-    {0.00, 0.00, 0.00, 1.00, 0.50},
-    {0.00, 0.00, 0.00, 1.40, 0.50},
-    {0.00, 0.00, 0.00, 1.80, 0.50},
-    {0.00, 0.00, 0.00, 2.20, 0.50},
-    {0.00, 0.00, 0.00, 2.60, 0.50},
-    {0.00, 0.00, 0.00, 3.00, 0.50},
-    {0.00, 0.00, 0.00, 3.40, 0.50},
-    {0.00, 0.00, 0.00, 3.80, 0.50},
-    {0.00, 0.00, 0.00, 4.20, 0.50},
-    {0.00, 0.00, 0.00, 4.60, 0.50},
-    {0.00, 0.00, 0.00, 5.00, 0.50},
-    {0.00, 0.00, 0.00, 5.40, 0.50},
-    {0.00, 0.00, 0.00, 5.80, 0.50},
-    {0.00, 0.00, 0.00, 6.20, 0.50},
-    {0.00, 0.00, 0.00, 6.60, 0.50},
-    {0.00, 0.00, 0.00, 7.00, 0.50},
-    {0.00, 0.00, 0.00, 7.40, 0.50},
-    {0.00, 0.00, 0.00, 7.80, 0.50},
-    {0.00, 0.00, 0.00, 8.20, 0.50},
-    {0.00, 0.00, 0.00, 8.60, 0.50},
-    {0.00, 0.00, 0.00, 9.00, 0.50},
-    {0.00, 0.00, 0.00, 9.40, 0.50},
-    {0.00, 0.00, 0.00, 9.80, 0.50},
-    {0.00, 0.00, 0.00, 10.20, 0.50},
-    {0.00, 0.00, 0.00, 10.60, 0.50},
-    {0.00, 0.00, 0.00, 11.00, 0.50},
-    {0.00, 0.00, 0.00, 11.40, 0.50},
-    {0.00, 0.00, 0.00, 11.80, 0.50},
-    {0.00, 0.00, 0.00, 12.20, 0.50},
-    {0.00, 0.00, 0.00, 12.60, 0.50},
-    {0.00, 0.00, 0.00, 13.00, 0.50},
-    {0.00, 0.00, 0.00, 13.40, 0.50},
-    {0.00, 0.00, 0.00, 13.80, 0.50},
-    {0.00, 0.00, 0.00, 14.20, 0.50},
-    {0.00, 0.00, 0.00, 14.60, 0.50},
-    {0.00, 0.00, 0.00, 15.00, 0.50},
-    {0.00, 0.00, 0.00, 15.40, 0.50},
-    {0.00, 0.00, 0.00, 15.80, 0.50},
-    {0.00, 0.00, 0.00, 16.20, 0.50},
-    {0.00, 0.00, 0.00, 16.60, 0.50},
-    {0.00, 0.00, 0.00, 17.00, 0.50},
-    {0.00, 0.00, 0.00, 17.40, 0.50},
-    {0.00, 0.00, 0.00, 17.80, 0.50},
-    {0.00, 0.00, 0.00, 18.20, 0.50},
-    {0.00, 0.00, 0.00, 18.60, 0.50},
-    {0.00, 0.00, 0.00, 19.00, 0.50},
-    {0.00, 0.00, 0.00, 19.40, 0.50},
-    {0.00, 0.00, 0.00, 19.80, 0.50},
-    {0.00, 0.00, 0.00, 20.20, 0.50},
-    {0.00, 0.00, 0.00, 20.60, 0.50},
-    {0.00, 0.00, 0.00, 21.00, 0.50},
-    {0.00, 0.00, 0.00, 21.40, 0.50},
-    {0.00, 0.00, 0.00, 21.80, 0.50},
-    {0.00, 0.00, 0.00, 22.20, 0.50},
-    {0.00, 0.00, 0.00, 22.60, 0.50},
-    {0.00, 0.00, 0.00, 23.00, 0.50},
-    {0.00, 0.00, 0.00, 23.40, 0.50},
-    {0.00, 0.00, 0.00, 23.80, 0.50},
-    {0.00, 0.00, 0.00, 24.20, 0.50},
-    {0.00, 0.00, 0.00, 24.60, 0.50},
-    {0.00, 0.00, 0.00, 25.00, 0.50},
-    {0.00, 0.00, 0.00, 25.40, 0.50},
-    {0.00, 0.00, 0.00, 25.80, 0.50},
-    {0.00, 0.00, 0.00, 26.20, 0.50},
-    {0.00, 0.00, 0.00, 26.60, 0.50},
-    {0.00, 0.00, 0.00, 27.00, 0.50},
-    {0.00, 0.00, 0.00, 27.40, 0.50},
-    {0.00, 0.00, 0.00, 27.80, 0.50},
-    {0.00, 0.00, 0.00, 28.20, 0.50},
-    {0.00, 0.00, 0.00, 28.60, 0.50},
-    {0.00, 0.00, 0.00, 29.00, 0.50},
-    {0.00, 0.00, 0.00, 29.40, 0.50},
-    {0.00, 0.00, 0.00, 29.80, 0.50},
-    {0.00, 0.00, 0.00, 30.20, 0.50},
-    {0.00, 0.00, 0.00, 30.60, 0.50},
-    {0.00, 0.00, 0.00, 31.00, 0.50},
-    {0.00, 0.00, 0.00, 31.40, 0.50},
-    {0.00, 0.00, 0.00, 31.80, 0.50},
-    {0.00, 0.00, 0.00, 32.20, 0.50},
-    {0.00, 0.00, 0.00, 32.60, 0.50},
-    {0.00, 0.00, 0.00, 33.00, 0.50},
-    {0.00, 0.00, 0.00, 33.40, 0.50},
-    {0.00, 0.00, 0.00, 33.80, 0.50},
-    {0.00, 0.00, 0.00, 34.20, 0.50},
-    {0.00, 0.00, 0.00, 34.60, 0.50},
-    {0.00, 0.00, 0.00, 35.00, 0.50},
-    {0.00, 0.00, 0.00, 35.40, 0.50},
-    {0.00, 0.00, 0.00, 35.80, 0.50},
-    {0.00, 0.00, 0.00, 36.20, 0.50},
-    {0.00, 0.00, 0.00, 36.60, 0.50},
-    {0.00, 0.00, 0.00, 37.00, 0.50},
-    {0.00, 0.00, 0.00, 37.40, 0.50},
-    {0.00, 0.00, 0.00, 37.80, 0.50},
-    {0.00, 0.00, 0.00, 38.20, 0.50},
-    {0.00, 0.00, 0.00, 38.60, 0.50},
-    {0.00, 0.00, 0.00, 39.00, 0.50},
-    {0.00, 0.00, 0.00, 39.40, 0.50},
-    {0.00, 0.00, 0.00, 39.80, 0.50},
-    {0.00, 0.00, 0.00, 40.20, 0.50},
-    {0.00, 0.00, 0.00, 40.60, 0.50},
-    {0.00, 0.00, 0.00, 41.00, 0.50},
-    {0.00, 0.00, 0.00, 41.40, 0.50},
-    {0.00, 0.00, 0.00, 41.80, 0.50},
-    {0.00, 0.00, 0.00, 42.20, 0.50},
-    {0.00, 0.00, 0.00, 42.60, 0.50},
-    {0.00, 0.00, 0.00, 43.00, 0.50},
-    {0.00, 0.00, 0.00, 43.40, 0.50},
-    {0.00, 0.00, 0.00, 43.80, 0.50},
-    {0.00, 0.00, 0.00, 44.20, 0.50},
-    {0.00, 0.00, 0.00, 44.60, 0.50},
-    {0.00, 0.00, 0.00, 45.00, 0.50},
-    {0.00, 0.00, 0.00, 45.40, 0.50},
-    {0.00, 0.00, 0.00, 45.80, 0.50},
-    {0.00, 0.00, 0.00, 46.20, 0.50},
-    {0.00, 0.00, 0.00, 46.60, 0.50},
-    {0.00, 0.00, 0.00, 47.00, 0.50},
-    {0.00, 0.00, 0.00, 47.40, 0.50},
-    {0.00, 0.00, 0.00, 47.80, 0.50},
-    {0.00, 0.00, 0.00, 48.20, 0.50},
-    {0.00, 0.00, 0.00, 48.60, 0.50},
-    {0.00, 0.00, 0.00, 49.00, 0.50},
-    {0.00, 0.00, 0.00, 49.40, 0.50},
-    {0.00, 0.00, 0.00, 49.80, 0.50},
-    {0.00, 0.00, 0.00, 50.20, 0.50},
-    {0.00, 0.00, 0.00, 50.60, 0.50},
-    {0.00, 0.00, 0.00, 51.00, 0.50},
-    {0.00, 0.00, 0.00, 51.40, 0.50},
-    {0.00, 0.00, 0.00, 51.80, 0.50},
-    {0.00, 0.00, 0.00, 52.20, 0.50},
-    {0.00, 0.00, 0.00, 52.60, 0.50},
-    {0.00, 0.00, 0.00, 53.00, 0.50},
-    {0.00, 0.00, 0.00, 53.40, 0.50},
-    {0.00, 0.00, 0.00, 53.80, 0.50},
-    {0.00, 0.00, 0.00, 54.20, 0.50},
-    {0.00, 0.00, 0.00, 54.60, 0.50},
-    {0.00, 0.00, 0.00, 55.00, 0.50},
-    {0.00, 0.00, 0.00, 55.40, 0.50},
-    {0.00, 0.00, 0.00, 55.80, 0.50},
-    {0.00, 0.00, 0.00, 56.20, 0.50},
-    {0.00, 0.00, 0.00, 56.60, 0.50},
-    {0.00, 0.00, 0.00, 57.00, 0.50},
-    {0.00, 0.00, 0.00, 57.40, 0.50},
-    {0.00, 0.00, 0.00, 57.80, 0.50},
-    {0.00, 0.00, 0.00, 58.20, 0.50},
-    {0.00, 0.00, 0.00, 58.60, 0.50},
-    {0.00, 0.00, 0.00, 59.00, 0.50},
-    {0.00, 0.00, 0.00, 59.40, 0.50},
-    {0.00, 0.00, 0.00, 59.80, 0.50},
-    {0.00, 0.00, 0.00, -59.80, 0.70},
-    {0.00, 0.00, 0.00, -59.40, 0.70},
-    {0.00, 0.00, 0.00, -59.00, 0.70},
-    {0.00, 0.00, 0.00, -58.60, 0.70},
-    {0.00, 0.00, 0.00, -58.20, 0.70},
-    {0.00, 0.00, 0.00, -57.80, 0.70},
-    {0.00, 0.00, 0.00, -57.40, 0.70},
-    {0.00, 0.00, 0.00, -57.00, 0.70},
-    {0.00, 0.00, 0.00, -56.60, 0.70},
-    {0.00, 0.00, 0.00, -56.20, 0.70},
-    {0.00, 0.00, 0.00, -55.80, 0.70},
-    {0.00, 0.00, 0.00, -55.40, 0.70},
-    {0.00, 0.00, 0.00, -55.00, 0.70},
-    {0.00, 0.00, 0.00, -54.60, 0.70},
-    {0.00, 0.00, 0.00, -54.20, 0.70},
-    {0.00, 0.00, 0.00, -53.80, 0.70},
-    {0.00, 0.00, 0.00, -53.40, 0.70},
-    {0.00, 0.00, 0.00, -53.00, 0.70},
-    {0.00, 0.00, 0.00, -52.60, 0.70},
-    {0.00, 0.00, 0.00, -52.20, 0.70},
-    {0.00, 0.00, 0.00, -51.80, 0.70},
-    {0.00, 0.00, 0.00, -51.40, 0.70},
-    {0.00, 0.00, 0.00, -51.00, 0.70},
-    {0.00, 0.00, 0.00, -50.60, 0.70},
-    {0.00, 0.00, 0.00, -50.20, 0.70},
-    {0.00, 0.00, 0.00, -49.80, 0.70},
-    {0.00, 0.00, 0.00, -49.40, 0.70},
-    {0.00, 0.00, 0.00, -49.00, 0.70},
-    {0.00, 0.00, 0.00, -48.60, 0.70},
-    {0.00, 0.00, 0.00, -48.20, 0.70},
-    {0.00, 0.00, 0.00, -47.80, 0.70},
-    {0.00, 0.00, 0.00, -47.40, 0.70},
-    {0.00, 0.00, 0.00, -47.00, 0.70},
-    {0.00, 0.00, 0.00, -46.60, 0.70},
-    {0.00, 0.00, 0.00, -46.20, 0.70},
-    {0.00, 0.00, 0.00, -45.80, 0.70},
-    {0.00, 0.00, 0.00, -45.40, 0.70},
-    {0.00, 0.00, 0.00, -45.00, 0.70},
-    {0.00, 0.00, 0.00, -44.60, 0.70},
-    {0.00, 0.00, 0.00, -44.20, 0.70},
-    {0.00, 0.00, 0.00, -43.80, 0.70},
-    {0.00, 0.00, 0.00, -43.40, 0.70},
-    {0.00, 0.00, 0.00, -43.00, 0.70},
-    {0.00, 0.00, 0.00, -42.60, 0.70},
-    {0.00, 0.00, 0.00, -42.20, 0.70},
-    {0.00, 0.00, 0.00, -41.80, 0.70},
-    {0.00, 0.00, 0.00, -41.40, 0.70},
-    {0.00, 0.00, 0.00, -41.00, 0.70},
-    {0.00, 0.00, 0.00, -40.60, 0.70},
-    {0.00, 0.00, 0.00, -40.20, 0.70},
-    {0.00, 0.00, 0.00, -39.80, 0.70},
-    {0.00, 0.00, 0.00, -39.40, 0.70},
-    {0.00, 0.00, 0.00, -39.00, 0.70},
-    {0.00, 0.00, 0.00, -38.60, 0.70},
-    {0.00, 0.00, 0.00, -38.20, 0.70},
-    {0.00, 0.00, 0.00, -37.80, 0.70},
-    {0.00, 0.00, 0.00, -37.40, 0.70},
-    {0.00, 0.00, 0.00, -37.00, 0.70},
-    {0.00, 0.00, 0.00, -36.60, 0.70},
-    {0.00, 0.00, 0.00, -36.20, 0.70},
-    {0.00, 0.00, 0.00, -35.80, 0.70},
-    {0.00, 0.00, 0.00, -35.40, 0.70},
-    {0.00, 0.00, 0.00, -35.00, 0.70},
-    {0.00, 0.00, 0.00, -34.60, 0.70},
-    {0.00, 0.00, 0.00, -34.20, 0.70},
-    {0.00, 0.00, 0.00, -33.80, 0.70},
-    {0.00, 0.00, 0.00, -33.40, 0.70},
-    {0.00, 0.00, 0.00, -33.00, 0.70},
-    {0.00, 0.00, 0.00, -32.60, 0.70},
-    {0.00, 0.00, 0.00, -32.20, 0.70},
-    {0.00, 0.00, 0.00, -31.80, 0.70},
-    {0.00, 0.00, 0.00, -31.40, 0.70},
-    {0.00, 0.00, 0.00, -31.00, 0.70},
-    {0.00, 0.00, 0.00, -30.60, 0.70},
-    {0.00, 0.00, 0.00, -30.20, 0.70},
-    {0.00, 0.00, 0.00, -29.80, 0.70},
-    {0.00, 0.00, 0.00, -29.40, 0.70},
-    {0.00, 0.00, 0.00, -29.00, 0.70},
-    {0.00, 0.00, 0.00, -28.60, 0.70},
-    {0.00, 0.00, 0.00, -28.20, 0.70},
-    {0.00, 0.00, 0.00, -27.80, 0.70},
-    {0.00, 0.00, 0.00, -27.40, 0.70},
-    {0.00, 0.00, 0.00, -27.00, 0.70},
-    {0.00, 0.00, 0.00, -26.60, 0.70},
-    {0.00, 0.00, 0.00, -26.20, 0.70},
-    {0.00, 0.00, 0.00, -25.80, 0.70},
-    {0.00, 0.00, 0.00, -25.40, 0.70},
-    {0.00, 0.00, 0.00, -25.00, 0.70},
-    {0.00, 0.00, 0.00, -24.60, 0.70},
-    {0.00, 0.00, 0.00, -24.20, 0.70},
-    {0.00, 0.00, 0.00, -23.80, 0.70},
-    {0.00, 0.00, 0.00, -23.40, 0.70},
-    {0.00, 0.00, 0.00, -23.00, 0.70},
-    {0.00, 0.00, 0.00, -22.60, 0.70},
-    {0.00, 0.00, 0.00, -22.20, 0.70},
-    {0.00, 0.00, 0.00, -21.80, 0.70},
-    {0.00, 0.00, 0.00, -21.40, 0.70},
-    {0.00, 0.00, 0.00, -21.00, 0.70},
-    {0.00, 0.00, 0.00, -20.60, 0.70},
-    {0.00, 0.00, 0.00, -20.20, 0.70},
-    {0.00, 0.00, 0.00, -19.80, 0.70},
-    {0.00, 0.00, 0.00, -19.40, 0.70},
-    {0.00, 0.00, 0.00, -19.00, 0.70},
-    {0.00, 0.00, 0.00, -18.60, 0.70},
-    {0.00, 0.00, 0.00, -18.20, 0.70},
-    {0.00, 0.00, 0.00, -17.80, 0.70},
-    {0.00, 0.00, 0.00, -17.40, 0.70},
-    {0.00, 0.00, 0.00, -17.00, 0.70},
-    {0.00, 0.00, 0.00, -16.60, 0.70},
-    {0.00, 0.00, 0.00, -16.20, 0.70},
-    {0.00, 0.00, 0.00, -15.80, 0.70},
-    {0.00, 0.00, 0.00, -15.40, 0.70},
-    {0.00, 0.00, 0.00, -15.00, 0.70},
-    {0.00, 0.00, 0.00, -14.60, 0.70},
-    {0.00, 0.00, 0.00, -14.20, 0.70},
-    {0.00, 0.00, 0.00, -13.80, 0.70},
-    {0.00, 0.00, 0.00, -13.40, 0.70},
-    {0.00, 0.00, 0.00, -13.00, 0.70},
-    {0.00, 0.00, 0.00, -12.60, 0.70},
-    {0.00, 0.00, 0.00, -12.20, 0.70},
-    {0.00, 0.00, 0.00, -11.80, 0.70},
-    {0.00, 0.00, 0.00, -11.40, 0.70},
-    {0.00, 0.00, 0.00, -11.00, 0.70},
-    {0.00, 0.00, 0.00, -10.60, 0.70},
-    {0.00, 0.00, 0.00, -10.20, 0.70},
-    {0.00, 0.00, 0.00, -9.80, 0.70},
-    {0.00, 0.00, 0.00, -9.40, 0.70},
-    {0.00, 0.00, 0.00, -9.00, 0.70},
-    {0.00, 0.00, 0.00, -8.60, 0.70},
-    {0.00, 0.00, 0.00, -8.20, 0.70},
-    {0.00, 0.00, 0.00, -7.80, 0.70},
-    {0.00, 0.00, 0.00, -7.40, 0.70},
-    {0.00, 0.00, 0.00, -7.00, 0.70},
-    {0.00, 0.00, 0.00, -6.60, 0.70},
-    {0.00, 0.00, 0.00, -6.20, 0.70},
-    {0.00, 0.00, 0.00, -5.80, 0.70},
-    {0.00, 0.00, 0.00, -5.40, 0.70},
-    {0.00, 0.00, 0.00, -5.00, 0.70},
-    {0.00, 0.00, 0.00, -4.60, 0.70},
-    {0.00, 0.00, 0.00, -4.20, 0.70},
-    {0.00, 0.00, 0.00, -3.80, 0.70},
-    {0.00, 0.00, 0.00, -3.40, 0.70},
-    {0.00, 0.00, 0.00, -3.00, 0.70},
-    {0.00, 0.00, 0.00, -2.60, 0.70},
-    {0.00, 0.00, 0.00, -2.20, 0.70},
-    {0.00, 0.00, 0.00, -1.80, 0.70},
-    {0.00, 0.00, 0.00, -1.40, 0.70},
-    {0.00, 0.00, 0.00, -1.00, 0.70},
-    {0.00, 0.00, 0.00, -0.60, 0.70},
-    {0.00, 0.00, 0.00, -0.20, 0.70},
-    {0.00, 0.00, 0.00, 0.20, 0.70},
-    {0.00, 0.00, 0.00, 0.60, 0.70},
-    {0.00, 0.00, 0.00, 1.00, 0.70},
-    {0.00, 0.00, 0.00, 1.40, 0.70},
-    {0.00, 0.00, 0.00, 1.80, 0.70},
-    {0.00, 0.00, 0.00, 2.20, 0.70},
-    {0.00, 0.00, 0.00, 2.60, 0.70},
-    {0.00, 0.00, 0.00, 3.00, 0.70},
-    {0.00, 0.00, 0.00, 3.40, 0.70},
-    {0.00, 0.00, 0.00, 3.80, 0.70},
-    {0.00, 0.00, 0.00, 4.20, 0.70},
-    {0.00, 0.00, 0.00, 4.60, 0.70},
-    {0.00, 0.00, 0.00, 5.00, 0.70},
-    {0.00, 0.00, 0.00, 5.40, 0.70},
-    {0.00, 0.00, 0.00, 5.80, 0.70},
-    {0.00, 0.00, 0.00, 6.20, 0.70},
-    {0.00, 0.00, 0.00, 6.60, 0.70},
-    {0.00, 0.00, 0.00, 7.00, 0.70},
-    {0.00, 0.00, 0.00, 7.40, 0.70},
-    {0.00, 0.00, 0.00, 7.80, 0.70},
-    {0.00, 0.00, 0.00, 8.20, 0.70},
-    {0.00, 0.00, 0.00, 8.60, 0.70},
-    {0.00, 0.00, 0.00, 9.00, 0.70},
-    {0.00, 0.00, 0.00, 9.40, 0.70},
-    {0.00, 0.00, 0.00, 9.80, 0.70},
-    {0.00, 0.00, 0.00, 10.20, 0.70},
-    {0.00, 0.00, 0.00, 10.60, 0.70},
-    {0.00, 0.00, 0.00, 11.00, 0.70},
-    {0.00, 0.00, 0.00, 11.40, 0.70},
-    {0.00, 0.00, 0.00, 11.80, 0.70},
-    {0.00, 0.00, 0.00, 12.20, 0.70},
-    {0.00, 0.00, 0.00, 12.60, 0.70},
-    {0.00, 0.00, 0.00, 13.00, 0.70},
-    {0.00, 0.00, 0.00, 13.40, 0.70},
-    {0.00, 0.00, 0.00, 13.80, 0.70},
-    {0.00, 0.00, 0.00, 14.20, 0.70},
-    {0.00, 0.00, 0.00, 14.60, 0.70},
-    {0.00, 0.00, 0.00, 15.00, 0.70},
-    {0.00, 0.00, 0.00, 15.40, 0.70},
-    {0.00, 0.00, 0.00, 15.80, 0.70},
-    {0.00, 0.00, 0.00, 16.20, 0.70},
-    {0.00, 0.00, 0.00, 16.60, 0.70},
-    {0.00, 0.00, 0.00, 17.00, 0.70},
-    {0.00, 0.00, 0.00, 17.40, 0.70},
-    {0.00, 0.00, 0.00, 17.80, 0.70},
-    {0.00, 0.00, 0.00, 18.20, 0.70},
-    {0.00, 0.00, 0.00, 18.60, 0.70},
-    {0.00, 0.00, 0.00, 19.00, 0.70},
-    {0.00, 0.00, 0.00, 19.40, 0.70},
-    {0.00, 0.00, 0.00, 19.80, 0.70},
-    {0.00, 0.00, 0.00, 20.20, 0.70},
-    {0.00, 0.00, 0.00, 20.60, 0.70},
-    {0.00, 0.00, 0.00, 21.00, 0.70},
-    {0.00, 0.00, 0.00, 21.40, 0.70},
-    {0.00, 0.00, 0.00, 21.80, 0.70},
-    {0.00, 0.00, 0.00, 22.20, 0.70},
-    {0.00, 0.00, 0.00, 22.60, 0.70},
-    {0.00, 0.00, 0.00, 23.00, 0.70},
-    {0.00, 0.00, 0.00, 23.40, 0.70},
-    {0.00, 0.00, 0.00, 23.80, 0.70},
-    {0.00, 0.00, 0.00, 24.20, 0.70},
-    {0.00, 0.00, 0.00, 24.60, 0.70},
-    {0.00, 0.00, 0.00, 25.00, 0.70},
-    {0.00, 0.00, 0.00, 25.40, 0.70},
-    {0.00, 0.00, 0.00, 25.80, 0.70},
-    {0.00, 0.00, 0.00, 26.20, 0.70},
-    {0.00, 0.00, 0.00, 26.60, 0.70},
-    {0.00, 0.00, 0.00, 27.00, 0.70},
-    {0.00, 0.00, 0.00, 27.40, 0.70},
-    {0.00, 0.00, 0.00, 27.80, 0.70},
-    {0.00, 0.00, 0.00, 28.20, 0.70},
-    {0.00, 0.00, 0.00, 28.60, 0.70},
-    {0.00, 0.00, 0.00, 29.00, 0.70},
-    {0.00, 0.00, 0.00, 29.40, 0.70},
-    {0.00, 0.00, 0.00, 29.80, 0.70},
-    {0.00, 0.00, 0.00, 30.20, 0.70},
-    {0.00, 0.00, 0.00, 30.60, 0.70},
-    {0.00, 0.00, 0.00, 31.00, 0.70},
-    {0.00, 0.00, 0.00, 31.40, 0.70},
-    {0.00, 0.00, 0.00, 31.80, 0.70},
-    {0.00, 0.00, 0.00, 32.20, 0.70},
-    {0.00, 0.00, 0.00, 32.60, 0.70},
-    {0.00, 0.00, 0.00, 33.00, 0.70},
-    {0.00, 0.00, 0.00, 33.40, 0.70},
-    {0.00, 0.00, 0.00, 33.80, 0.70},
-    {0.00, 0.00, 0.00, 34.20, 0.70},
-    {0.00, 0.00, 0.00, 34.60, 0.70},
-    {0.00, 0.00, 0.00, 35.00, 0.70},
-    {0.00, 0.00, 0.00, 35.40, 0.70},
-    {0.00, 0.00, 0.00, 35.80, 0.70},
-    {0.00, 0.00, 0.00, 36.20, 0.70},
-    {0.00, 0.00, 0.00, 36.60, 0.70},
-    {0.00, 0.00, 0.00, 37.00, 0.70},
-    {0.00, 0.00, 0.00, 37.40, 0.70},
-    {0.00, 0.00, 0.00, 37.80, 0.70},
-    {0.00, 0.00, 0.00, 38.20, 0.70},
-    {0.00, 0.00, 0.00, 38.60, 0.70},
-    {0.00, 0.00, 0.00, 39.00, 0.70},
-    {0.00, 0.00, 0.00, 39.40, 0.70},
-    {0.00, 0.00, 0.00, 39.80, 0.70},
-    {0.00, 0.00, 0.00, 40.20, 0.70},
-    {0.00, 0.00, 0.00, 40.60, 0.70},
-    {0.00, 0.00, 0.00, 41.00, 0.70},
-    {0.00, 0.00, 0.00, 41.40, 0.70},
-    {0.00, 0.00, 0.00, 41.80, 0.70},
-    {0.00, 0.00, 0.00, 42.20, 0.70},
-    {0.00, 0.00, 0.00, 42.60, 0.70},
-    {0.00, 0.00, 0.00, 43.00, 0.70},
-    {0.00, 0.00, 0.00, 43.40, 0.70},
-    {0.00, 0.00, 0.00, 43.80, 0.70},
-    {0.00, 0.00, 0.00, 44.20, 0.70},
-    {0.00, 0.00, 0.00, 44.60, 0.70},
-    {0.00, 0.00, 0.00, 45.00, 0.70},
-    {0.00, 0.00, 0.00, 45.40, 0.70},
-    {0.00, 0.00, 0.00, 45.80, 0.70},
-    {0.00, 0.00, 0.00, 46.20, 0.70},
-    {0.00, 0.00, 0.00, 46.60, 0.70},
-    {0.00, 0.00, 0.00, 47.00, 0.70},
-    {0.00, 0.00, 0.00, 47.40, 0.70},
-    {0.00, 0.00, 0.00, 47.80, 0.70},
-    {0.00, 0.00, 0.00, 48.20, 0.70},
-    {0.00, 0.00, 0.00, 48.60, 0.70},
-    {0.00, 0.00, 0.00, 49.00, 0.70},
-    {0.00, 0.00, 0.00, 49.40, 0.70},
-    {0.00, 0.00, 0.00, 49.80, 0.70},
-    {0.00, 0.00, 0.00, 50.20, 0.70},
-    {0.00, 0.00, 0.00, 50.60, 0.70},
-    {0.00, 0.00, 0.00, 51.00, 0.70},
-    {0.00, 0.00, 0.00, 51.40, 0.70},
-    {0.00, 0.00, 0.00, 51.80, 0.70},
-    {0.00, 0.00, 0.00, 52.20, 0.70},
-    {0.00, 0.00, 0.00, 52.60, 0.70},
-    {0.00, 0.00, 0.00, 53.00, 0.70},
-    {0.00, 0.00, 0.00, 53.40, 0.70},
-    {0.00, 0.00, 0.00, 53.80, 0.70},
-    {0.00, 0.00, 0.00, 54.20, 0.70},
-    {0.00, 0.00, 0.00, 54.60, 0.70},
-    {0.00, 0.00, 0.00, 55.00, 0.70},
-    {0.00, 0.00, 0.00, 55.40, 0.70},
-    {0.00, 0.00, 0.00, 55.80, 0.70},
-    {0.00, 0.00, 0.00, 56.20, 0.70},
-    {0.00, 0.00, 0.00, 56.60, 0.70},
-    {0.00, 0.00, 0.00, 57.00, 0.70},
-    {0.00, 0.00, 0.00, 57.40, 0.70},
-    {0.00, 0.00, 0.00, 57.80, 0.70},
-    {0.00, 0.00, 0.00, 58.20, 0.70},
-    {0.00, 0.00, 0.00, 58.60, 0.70},
-    {0.00, 0.00, 0.00, 59.00, 0.70},
-    {0.00, 0.00, 0.00, 59.40, 0.70},
-    {0.00, 0.00, 0.00, 59.80, 0.70},
-    {0.00, 0.00, 0.00, -59.80, 0.90},
-    {0.00, 0.00, 0.00, -59.40, 0.90},
-    {0.00, 0.00, 0.00, -59.00, 0.90},
-    {0.00, 0.00, 0.00, -58.60, 0.90},
-    {0.00, 0.00, 0.00, -58.20, 0.90},
-    {0.00, 0.00, 0.00, -57.80, 0.90},
-    {0.00, 0.00, 0.00, -57.40, 0.90},
-    {0.00, 0.00, 0.00, -57.00, 0.90},
-    {0.00, 0.00, 0.00, -56.60, 0.90},
-    {0.00, 0.00, 0.00, -56.20, 0.90},
-    {0.00, 0.00, 0.00, -55.80, 0.90},
-    {0.00, 0.00, 0.00, -55.40, 0.90},
-    {0.00, 0.00, 0.00, -55.00, 0.90},
-    {0.00, 0.00, 0.00, -54.60, 0.90},
-    {0.00, 0.00, 0.00, -54.20, 0.90},
-    {0.00, 0.00, 0.00, -53.80, 0.90},
-    {0.00, 0.00, 0.00, -53.40, 0.90},
-    {0.00, 0.00, 0.00, -53.00, 0.90},
-    {0.00, 0.00, 0.00, -52.60, 0.90},
-    {0.00, 0.00, 0.00, -52.20, 0.90},
-    {0.00, 0.00, 0.00, -51.80, 0.90},
-    {0.00, 0.00, 0.00, -51.40, 0.90},
-    {0.00, 0.00, 0.00, -51.00, 0.90},
-    {0.00, 0.00, 0.00, -50.60, 0.90},
-    {0.00, 0.00, 0.00, -50.20, 0.90},
-    {0.00, 0.00, 0.00, -49.80, 0.90},
-    {0.00, 0.00, 0.00, -49.40, 0.90},
-    {0.00, 0.00, 0.00, -49.00, 0.90},
-    {0.00, 0.00, 0.00, -48.60, 0.90},
-    {0.00, 0.00, 0.00, -48.20, 0.90},
-    {0.00, 0.00, 0.00, -47.80, 0.90},
-    {0.00, 0.00, 0.00, -47.40, 0.90},
-    {0.00, 0.00, 0.00, -47.00, 0.90},
-    {0.00, 0.00, 0.00, -46.60, 0.90},
-    {0.00, 0.00, 0.00, -46.20, 0.90},
-    {0.00, 0.00, 0.00, -45.80, 0.90},
-    {0.00, 0.00, 0.00, -45.40, 0.90},
-    {0.00, 0.00, 0.00, -45.00, 0.90},
-    {0.00, 0.00, 0.00, -44.60, 0.90},
-    {0.00, 0.00, 0.00, -44.20, 0.90},
-    {0.00, 0.00, 0.00, -43.80, 0.90},
-    {0.00, 0.00, 0.00, -43.40, 0.90},
-    {0.00, 0.00, 0.00, -43.00, 0.90},
-    {0.00, 0.00, 0.00, -42.60, 0.90},
-    {0.00, 0.00, 0.00, -42.20, 0.90},
-    {0.00, 0.00, 0.00, -41.80, 0.90},
-    {0.00, 0.00, 0.00, -41.40, 0.90},
-    {0.00, 0.00, 0.00, -41.00, 0.90},
-    {0.00, 0.00, 0.00, -40.60, 0.90},
-    {0.00, 0.00, 0.00, -40.20, 0.90},
-    {0.00, 0.00, 0.00, -39.80, 0.90},
-    {0.00, 0.00, 0.00, -39.40, 0.90},
-    {0.00, 0.00, 0.00, -39.00, 0.90},
-    {0.00, 0.00, 0.00, -38.60, 0.90},
-    {0.00, 0.00, 0.00, -38.20, 0.90},
-    {0.00, 0.00, 0.00, -37.80, 0.90},
-    {0.00, 0.00, 0.00, -37.40, 0.90},
-    {0.00, 0.00, 0.00, -37.00, 0.90},
-    {0.00, 0.00, 0.00, -36.60, 0.90},
-    {0.00, 0.00, 0.00, -36.20, 0.90},
-    {0.00, 0.00, 0.00, -35.80, 0.90},
-    {0.00, 0.00, 0.00, -35.40, 0.90},
-    {0.00, 0.00, 0.00, -35.00, 0.90},
-    {0.00, 0.00, 0.00, -34.60, 0.90},
-    {0.00, 0.00, 0.00, -34.20, 0.90},
-    {0.00, 0.00, 0.00, -33.80, 0.90},
-    {0.00, 0.00, 0.00, -33.40, 0.90},
-    {0.00, 0.00, 0.00, -33.00, 0.90},
-    {0.00, 0.00, 0.00, -32.60, 0.90},
-    {0.00, 0.00, 0.00, -32.20, 0.90},
-    {0.00, 0.00, 0.00, -31.80, 0.90},
-    {0.00, 0.00, 0.00, -31.40, 0.90},
-    {0.00, 0.00, 0.00, -31.00, 0.90},
-    {0.00, 0.00, 0.00, -30.60, 0.90},
-    {0.00, 0.00, 0.00, -30.20, 0.90},
-    {0.00, 0.00, 0.00, -29.80, 0.90},
-    {0.00, 0.00, 0.00, -29.40, 0.90},
-    {0.00, 0.00, 0.00, -29.00, 0.90},
-    {0.00, 0.00, 0.00, -28.60, 0.90},
-    {0.00, 0.00, 0.00, -28.20, 0.90},
-    {0.00, 0.00, 0.00, -27.80, 0.90},
-    {0.00, 0.00, 0.00, -27.40, 0.90},
-    {0.00, 0.00, 0.00, -27.00, 0.90},
-    {0.00, 0.00, 0.00, -26.60, 0.90},
-    {0.00, 0.00, 0.00, -26.20, 0.90},
-    {0.00, 0.00, 0.00, -25.80, 0.90},
-    {0.00, 0.00, 0.00, -25.40, 0.90},
-    {0.00, 0.00, 0.00, -25.00, 0.90},
-    {0.00, 0.00, 0.00, -24.60, 0.90},
-    {0.00, 0.00, 0.00, -24.20, 0.90},
-    {0.00, 0.00, 0.00, -23.80, 0.90},
-    {0.00, 0.00, 0.00, -23.40, 0.90},
-    {0.00, 0.00, 0.00, -23.00, 0.90},
-    {0.00, 0.00, 0.00, -22.60, 0.90},
-    {0.00, 0.00, 0.00, -22.20, 0.90},
-    {0.00, 0.00, 0.00, -21.80, 0.90},
-    {0.00, 0.00, 0.00, -21.40, 0.90},
-    {0.00, 0.00, 0.00, -21.00, 0.90},
-    {0.00, 0.00, 0.00, -20.60, 0.90},
-    {0.00, 0.00, 0.00, -20.20, 0.90},
-    {0.00, 0.00, 0.00, -19.80, 0.90},
-    {0.00, 0.00, 0.00, -19.40, 0.90},
-    {0.00, 0.00, 0.00, -19.00, 0.90},
-    {0.00, 0.00, 0.00, -18.60, 0.90},
-    {0.00, 0.00, 0.00, -18.20, 0.90},
-    {0.00, 0.00, 0.00, -17.80, 0.90},
-    {0.00, 0.00, 0.00, -17.40, 0.90},
-    {0.00, 0.00, 0.00, -17.00, 0.90},
-    {0.00, 0.00, 0.00, -16.60, 0.90},
-    {0.00, 0.00, 0.00, -16.20, 0.90},
-    {0.00, 0.00, 0.00, -15.80, 0.90},
-    {0.00, 0.00, 0.00, -15.40, 0.90},
-    {0.00, 0.00, 0.00, -15.00, 0.90},
-    {0.00, 0.00, 0.00, -14.60, 0.90},
-    {0.00, 0.00, 0.00, -14.20, 0.90},
-    {0.00, 0.00, 0.00, -13.80, 0.90},
-    {0.00, 0.00, 0.00, -13.40, 0.90},
-    {0.00, 0.00, 0.00, -13.00, 0.90},
-    {0.00, 0.00, 0.00, -12.60, 0.90},
-    {0.00, 0.00, 0.00, -12.20, 0.90},
-    {0.00, 0.00, 0.00, -11.80, 0.90},
-    {0.00, 0.00, 0.00, -11.40, 0.90},
-    {0.00, 0.00, 0.00, -11.00, 0.90},
-    {0.00, 0.00, 0.00, -10.60, 0.90},
-    {0.00, 0.00, 0.00, -10.20, 0.90},
-    {0.00, 0.00, 0.00, -9.80, 0.90},
-    {0.00, 0.00, 0.00, -9.40, 0.90},
-    {0.00, 0.00, 0.00, -9.00, 0.90},
-    {0.00, 0.00, 0.00, -8.60, 0.90},
-    {0.00, 0.00, 0.00, -8.20, 0.90},
-    {0.00, 0.00, 0.00, -7.80, 0.90},
-    {0.00, 0.00, 0.00, -7.40, 0.90},
-    {0.00, 0.00, 0.00, -7.00, 0.90},
-    {0.00, 0.00, 0.00, -6.60, 0.90},
-    {0.00, 0.00, 0.00, -6.20, 0.90},
-    {0.00, 0.00, 0.00, -5.80, 0.90},
-    {0.00, 0.00, 0.00, -5.40, 0.90},
-    {0.00, 0.00, 0.00, -5.00, 0.90},
-    {0.00, 0.00, 0.00, -4.60, 0.90},
-    {0.00, 0.00, 0.00, -4.20, 0.90},
-    {0.00, 0.00, 0.00, -3.80, 0.90},
-    {0.00, 0.00, 0.00, -3.40, 0.90},
-    {0.00, 0.00, 0.00, -3.00, 0.90},
-    {0.00, 0.00, 0.00, -2.60, 0.90},
-    {0.00, 0.00, 0.00, -2.20, 0.90},
-    {0.00, 0.00, 0.00, -1.80, 0.90},
-    {0.00, 0.00, 0.00, -1.40, 0.90},
-    {0.00, 0.00, 0.00, -1.00, 0.90},
-    {0.00, 0.00, 0.00, -0.60, 0.90},
-    {0.00, 0.00, 0.00, -0.20, 0.90},
-    {0.00, 0.00, 0.00, 0.20, 0.90},
-    {0.00, 0.00, 0.00, 0.60, 0.90},
-    {0.00, 0.00, 0.00, 1.00, 0.90},
-    {0.00, 0.00, 0.00, 1.40, 0.90},
-    {0.00, 0.00, 0.00, 1.80, 0.90},
-    {0.00, 0.00, 0.00, 2.20, 0.90},
-    {0.00, 0.00, 0.00, 2.60, 0.90},
-    {0.00, 0.00, 0.00, 3.00, 0.90},
-    {0.00, 0.00, 0.00, 3.40, 0.90},
-    {0.00, 0.00, 0.00, 3.80, 0.90},
-    {0.00, 0.00, 0.00, 4.20, 0.90},
-    {0.00, 0.00, 0.00, 4.60, 0.90},
-    {0.00, 0.00, 0.00, 5.00, 0.90},
-    {0.00, 0.00, 0.00, 5.40, 0.90},
-    {0.00, 0.00, 0.00, 5.80, 0.90},
-    {0.00, 0.00, 0.00, 6.20, 0.90},
-    {0.00, 0.00, 0.00, 6.60, 0.90},
-    {0.00, 0.00, 0.00, 7.00, 0.90},
-    {0.00, 0.00, 0.00, 7.40, 0.90},
-    {0.00, 0.00, 0.00, 7.80, 0.90},
-    {0.00, 0.00, 0.00, 8.20, 0.90},
-    {0.00, 0.00, 0.00, 8.60, 0.90},
-    {0.00, 0.00, 0.00, 9.00, 0.90},
-    {0.00, 0.00, 0.00, 9.40, 0.90},
-    {0.00, 0.00, 0.00, 9.80, 0.90},
-    {0.00, 0.00, 0.00, 10.20, 0.90},
-    {0.00, 0.00, 0.00, 10.60, 0.90},
-    {0.00, 0.00, 0.00, 11.00, 0.90},
-    {0.00, 0.00, 0.00, 11.40, 0.90},
-    {0.00, 0.00, 0.00, 11.80, 0.90},
-    {0.00, 0.00, 0.00, 12.20, 0.90},
-    {0.00, 0.00, 0.00, 12.60, 0.90},
-    {0.00, 0.00, 0.00, 13.00, 0.90},
-    {0.00, 0.00, 0.00, 13.40, 0.90},
-    {0.00, 0.00, 0.00, 13.80, 0.90},
-    {0.00, 0.00, 0.00, 14.20, 0.90},
-    {0.00, 0.00, 0.00, 14.60, 0.90},
-    {0.00, 0.00, 0.00, 15.00, 0.90},
-    {0.00, 0.00, 0.00, 15.40, 0.90},
-    {0.00, 0.00, 0.00, 15.80, 0.90},
-    {0.00, 0.00, 0.00, 16.20, 0.90},
-    {0.00, 0.00, 0.00, 16.60, 0.90},
-    {0.00, 0.00, 0.00, 17.00, 0.90},
-    {0.00, 0.00, 0.00, 17.40, 0.90},
-    {0.00, 0.00, 0.00, 17.80, 0.90},
-    {0.00, 0.00, 0.00, 18.20, 0.90},
-    {0.00, 0.00, 0.00, 18.60, 0.90},
-    {0.00, 0.00, 0.00, 19.00, 0.90},
-    {0.00, 0.00, 0.00, 19.40, 0.90},
-    {0.00, 0.00, 0.00, 19.80, 0.90},
-    {0.00, 0.00, 0.00, 20.20, 0.90},
-    {0.00, 0.00, 0.00, 20.60, 0.90},
-    {0.00, 0.00, 0.00, 21.00, 0.90},
-    {0.00, 0.00, 0.00, 21.40, 0.90},
-    {0.00, 0.00, 0.00, 21.80, 0.90},
-    {0.00, 0.00, 0.00, 22.20, 0.90},
-    {0.00, 0.00, 0.00, 22.60, 0.90},
-    {0.00, 0.00, 0.00, 23.00, 0.90},
-    {0.00, 0.00, 0.00, 23.40, 0.90},
-    {0.00, 0.00, 0.00, 23.80, 0.90},
-    {0.00, 0.00, 0.00, 24.20, 0.90},
-    {0.00, 0.00, 0.00, 24.60, 0.90},
-    {0.00, 0.00, 0.00, 25.00, 0.90},
-    {0.00, 0.00, 0.00, 25.40, 0.90},
-    {0.00, 0.00, 0.00, 25.80, 0.90},
-    {0.00, 0.00, 0.00, 26.20, 0.90},
-    {0.00, 0.00, 0.00, 26.60, 0.90},
-    {0.00, 0.00, 0.00, 27.00, 0.90},
-    {0.00, 0.00, 0.00, 27.40, 0.90},
-    {0.00, 0.00, 0.00, 27.80, 0.90},
-    {0.00, 0.00, 0.00, 28.20, 0.90},
-    {0.00, 0.00, 0.00, 28.60, 0.90},
-    {0.00, 0.00, 0.00, 29.00, 0.90},
-    {0.00, 0.00, 0.00, 29.40, 0.90},
-    {0.00, 0.00, 0.00, 29.80, 0.90},
-    {0.00, 0.00, 0.00, 30.20, 0.90},
-    {0.00, 0.00, 0.00, 30.60, 0.90},
-    {0.00, 0.00, 0.00, 31.00, 0.90},
-    {0.00, 0.00, 0.00, 31.40, 0.90},
-    {0.00, 0.00, 0.00, 31.80, 0.90},
-    {0.00, 0.00, 0.00, 32.20, 0.90},
-    {0.00, 0.00, 0.00, 32.60, 0.90},
-    {0.00, 0.00, 0.00, 33.00, 0.90},
-    {0.00, 0.00, 0.00, 33.40, 0.90},
-    {0.00, 0.00, 0.00, 33.80, 0.90},
-    {0.00, 0.00, 0.00, 34.20, 0.90},
-    {0.00, 0.00, 0.00, 34.60, 0.90},
-    {0.00, 0.00, 0.00, 35.00, 0.90},
-    {0.00, 0.00, 0.00, 35.40, 0.90},
-    {0.00, 0.00, 0.00, 35.80, 0.90},
-    {0.00, 0.00, 0.00, 36.20, 0.90},
-    {0.00, 0.00, 0.00, 36.60, 0.90},
-    {0.00, 0.00, 0.00, 37.00, 0.90},
-    {0.00, 0.00, 0.00, 37.40, 0.90},
-    {0.00, 0.00, 0.00, 37.80, 0.90},
-    {0.00, 0.00, 0.00, 38.20, 0.90},
-    {0.00, 0.00, 0.00, 38.60, 0.90},
-    {0.00, 0.00, 0.00, 39.00, 0.90},
-    {0.00, 0.00, 0.00, 39.40, 0.90},
-    {0.00, 0.00, 0.00, 39.80, 0.90},
-    {0.00, 0.00, 0.00, 40.20, 0.90},
-    {0.00, 0.00, 0.00, 40.60, 0.90},
-    {0.00, 0.00, 0.00, 41.00, 0.90},
-    {0.00, 0.00, 0.00, 41.40, 0.90},
-    {0.00, 0.00, 0.00, 41.80, 0.90},
-    {0.00, 0.00, 0.00, 42.20, 0.90},
-    {0.00, 0.00, 0.00, 42.60, 0.90},
-    {0.00, 0.00, 0.00, 43.00, 0.90},
-    {0.00, 0.00, 0.00, 43.40, 0.90},
-    {0.00, 0.00, 0.00, 43.80, 0.90},
-    {0.00, 0.00, 0.00, 44.20, 0.90},
-    {0.00, 0.00, 0.00, 44.60, 0.90},
-    {0.00, 0.00, 0.00, 45.00, 0.90},
-    {0.00, 0.00, 0.00, 45.40, 0.90},
-    {0.00, 0.00, 0.00, 45.80, 0.90},
-    {0.00, 0.00, 0.00, 46.20, 0.90},
-    {0.00, 0.00, 0.00, 46.60, 0.90},
-    {0.00, 0.00, 0.00, 47.00, 0.90},
-    {0.00, 0.00, 0.00, 47.40, 0.90},
-    {0.00, 0.00, 0.00, 47.80, 0.90},
-    {0.00, 0.00, 0.00, 48.20, 0.90},
-    {0.00, 0.00, 0.00, 48.60, 0.90},
-    {0.00, 0.00, 0.00, 49.00, 0.90},
-    {0.00, 0.00, 0.00, 49.40, 0.90},
-    {0.00, 0.00, 0.00, 49.80, 0.90},
-    {0.00, 0.00, 0.00, 50.20, 0.90},
-    {0.00, 0.00, 0.00, 50.60, 0.90},
-    {0.00, 0.00, 0.00, 51.00, 0.90},
-    {0.00, 0.00, 0.00, 51.40, 0.90},
-    {0.00, 0.00, 0.00, 51.80, 0.90},
-    {0.00, 0.00, 0.00, 52.20, 0.90},
-    {0.00, 0.00, 0.00, 52.60, 0.90},
-    {0.00, 0.00, 0.00, 53.00, 0.90},
-    {0.00, 0.00, 0.00, 53.40, 0.90},
-    {0.00, 0.00, 0.00, 53.80, 0.90},
-    {0.00, 0.00, 0.00, 54.20, 0.90},
-    {0.00, 0.00, 0.00, 54.60, 0.90},
-    {0.00, 0.00, 0.00, 55.00, 0.90},
-    {0.00, 0.00, 0.00, 55.40, 0.90},
-    {0.00, 0.00, 0.00, 55.80, 0.90},
-    {0.00, 0.00, 0.00, 56.20, 0.90},
-    {0.00, 0.00, 0.00, 56.60, 0.90},
-    {0.00, 0.00, 0.00, 57.00, 0.90},
-    {0.00, 0.00, 0.00, 57.40, 0.90},
-    {0.00, 0.00, 0.00, 57.80, 0.90},
-    {0.00, 0.00, 0.00, 58.20, 0.90},
-    {0.00, 0.00, 0.00, 58.60, 0.90},
-    {0.00, 0.00, 0.00, 59.00, 0.90},
-    {0.00, 0.00, 0.00, 59.40, 0.90},
-    {0.00, 0.00, 0.00, 59.80, 0.90},
-    {0.00, 0.00, 0.00, -59.80, 1.10},
-    {0.00, 0.00, 0.00, -59.40, 1.10},
-    {0.00, 0.00, 0.00, -59.00, 1.10},
-    {0.00, 0.00, 0.00, -58.60, 1.10},
-    {0.00, 0.00, 0.00, -58.20, 1.10},
-    {0.00, 0.00, 0.00, -57.80, 1.10},
-    {0.00, 0.00, 0.00, -57.40, 1.10},
-    {0.00, 0.00, 0.00, -57.00, 1.10},
-    {0.00, 0.00, 0.00, -56.60, 1.10},
-    {0.00, 0.00, 0.00, -56.20, 1.10},
-    {0.00, 0.00, 0.00, -55.80, 1.10},
-    {0.00, 0.00, 0.00, -55.40, 1.10},
-    {0.00, 0.00, 0.00, -55.00, 1.10},
-    {0.00, 0.00, 0.00, -54.60, 1.10},
-    {0.00, 0.00, 0.00, -54.20, 1.10},
-    {0.00, 0.00, 0.00, -53.80, 1.10},
-    {0.00, 0.00, 0.00, -53.40, 1.10},
-    {0.00, 0.00, 0.00, -53.00, 1.10},
-    {0.00, 0.00, 0.00, -52.60, 1.10},
-    {0.00, 0.00, 0.00, -52.20, 1.10},
-    {0.00, 0.00, 0.00, -51.80, 1.10},
-    {0.00, 0.00, 0.00, -51.40, 1.10},
-    {0.00, 0.00, 0.00, -51.00, 1.10},
-    {0.00, 0.00, 0.00, -50.60, 1.10},
-    {0.00, 0.00, 0.00, -50.20, 1.10},
-    {0.00, 0.00, 0.00, -49.80, 1.10},
-    {0.00, 0.00, 0.00, -49.40, 1.10},
-    {0.00, 0.00, 0.00, -49.00, 1.10},
-    {0.00, 0.00, 0.00, -48.60, 1.10},
-    {0.00, 0.00, 0.00, -48.20, 1.10},
-    {0.00, 0.00, 0.00, -47.80, 1.10},
-    {0.00, 0.00, 0.00, -47.40, 1.10},
-    {0.00, 0.00, 0.00, -47.00, 1.10},
-    {0.00, 0.00, 0.00, -46.60, 1.10},
-    {0.00, 0.00, 0.00, -46.20, 1.10},
-    {0.00, 0.00, 0.00, -45.80, 1.10},
-    {0.00, 0.00, 0.00, -45.40, 1.10},
-    {0.00, 0.00, 0.00, -45.00, 1.10},
-    {0.00, 0.00, 0.00, -44.60, 1.10},
-    {0.00, 0.00, 0.00, -44.20, 1.10},
-    {0.00, 0.00, 0.00, -43.80, 1.10},
-    {0.00, 0.00, 0.00, -43.40, 1.10},
-    {0.00, 0.00, 0.00, -43.00, 1.10},
-    {0.00, 0.00, 0.00, -42.60, 1.10},
-    {0.00, 0.00, 0.00, -42.20, 1.10},
-    {0.00, 0.00, 0.00, -41.80, 1.10},
-    {0.00, 0.00, 0.00, -41.40, 1.10},
-    {0.00, 0.00, 0.00, -41.00, 1.10},
-    {0.00, 0.00, 0.00, -40.60, 1.10},
-    {0.00, 0.00, 0.00, -40.20, 1.10},
-    {0.00, 0.00, 0.00, -39.80, 1.10},
-    {0.00, 0.00, 0.00, -39.40, 1.10},
-    {0.00, 0.00, 0.00, -39.00, 1.10},
-    {0.00, 0.00, 0.00, -38.60, 1.10},
-    {0.00, 0.00, 0.00, -38.20, 1.10},
-    {0.00, 0.00, 0.00, -37.80, 1.10},
-    {0.00, 0.00, 0.00, -37.40, 1.10},
-    {0.00, 0.00, 0.00, -37.00, 1.10},
-    {0.00, 0.00, 0.00, -36.60, 1.10},
-    {0.00, 0.00, 0.00, -36.20, 1.10},
-    {0.00, 0.00, 0.00, -35.80, 1.10},
-    {0.00, 0.00, 0.00, -35.40, 1.10},
-    {0.00, 0.00, 0.00, -35.00, 1.10},
-    {0.00, 0.00, 0.00, -34.60, 1.10},
-    {0.00, 0.00, 0.00, -34.20, 1.10},
-    {0.00, 0.00, 0.00, -33.80, 1.10},
-    {0.00, 0.00, 0.00, -33.40, 1.10},
-    {0.00, 0.00, 0.00, -33.00, 1.10},
-    {0.00, 0.00, 0.00, -32.60, 1.10},
-    {0.00, 0.00, 0.00, -32.20, 1.10},
-    {0.00, 0.00, 0.00, -31.80, 1.10},
-    {0.00, 0.00, 0.00, -31.40, 1.10},
-    {0.00, 0.00, 0.00, -31.00, 1.10},
-    {0.00, 0.00, 0.00, -30.60, 1.10},
-    {0.00, 0.00, 0.00, -30.20, 1.10},
-    {0.00, 0.00, 0.00, -29.80, 1.10},
-    {0.00, 0.00, 0.00, -29.40, 1.10},
-    {0.00, 0.00, 0.00, -29.00, 1.10},
-    {0.00, 0.00, 0.00, -28.60, 1.10},
-    {0.00, 0.00, 0.00, -28.20, 1.10},
-    {0.00, 0.00, 0.00, -27.80, 1.10},
-    {0.00, 0.00, 0.00, -27.40, 1.10},
-    {0.00, 0.00, 0.00, -27.00, 1.10},
-    {0.00, 0.00, 0.00, -26.60, 1.10},
-    {0.00, 0.00, 0.00, -26.20, 1.10},
-    {0.00, 0.00, 0.00, -25.80, 1.10},
-    {0.00, 0.00, 0.00, -25.40, 1.10},
-    {0.00, 0.00, 0.00, -25.00, 1.10},
-    {0.00, 0.00, 0.00, -24.60, 1.10},
-    {0.00, 0.00, 0.00, -24.20, 1.10},
-    {0.00, 0.00, 0.00, -23.80, 1.10},
-    {0.00, 0.00, 0.00, -23.40, 1.10},
-    {0.00, 0.00, 0.00, -23.00, 1.10},
-    {0.00, 0.00, 0.00, -22.60, 1.10},
-    {0.00, 0.00, 0.00, -22.20, 1.10},
-    {0.00, 0.00, 0.00, -21.80, 1.10},
-    {0.00, 0.00, 0.00, -21.40, 1.10},
-    {0.00, 0.00, 0.00, -21.00, 1.10},
-    {0.00, 0.00, 0.00, -20.60, 1.10},
-    {0.00, 0.00, 0.00, -20.20, 1.10},
-    {0.00, 0.00, 0.00, -19.80, 1.10},
-    {0.00, 0.00, 0.00, -19.40, 1.10},
-    {0.00, 0.00, 0.00, -19.00, 1.10},
-    {0.00, 0.00, 0.00, -18.60, 1.10},
-    {0.00, 0.00, 0.00, -18.20, 1.10},
-    {0.00, 0.00, 0.00, -17.80, 1.10},
-    {0.00, 0.00, 0.00, -17.40, 1.10},
-    {0.00, 0.00, 0.00, -17.00, 1.10},
-    {0.00, 0.00, 0.00, -16.60, 1.10},
-    {0.00, 0.00, 0.00, -16.20, 1.10},
-    {0.00, 0.00, 0.00, -15.80, 1.10},
-    {0.00, 0.00, 0.00, -15.40, 1.10},
-    {0.00, 0.00, 0.00, -15.00, 1.10},
-    {0.00, 0.00, 0.00, -14.60, 1.10},
-    {0.00, 0.00, 0.00, -14.20, 1.10},
-    {0.00, 0.00, 0.00, -13.80, 1.10},
-    {0.00, 0.00, 0.00, -13.40, 1.10},
-    {0.00, 0.00, 0.00, -13.00, 1.10},
-    {0.00, 0.00, 0.00, -12.60, 1.10},
-    {0.00, 0.00, 0.00, -12.20, 1.10},
-    {0.00, 0.00, 0.00, -11.80, 1.10},
-    {0.00, 0.00, 0.00, -11.40, 1.10},
-    {0.00, 0.00, 0.00, -11.00, 1.10},
-    {0.00, 0.00, 0.00, -10.60, 1.10},
-    {0.00, 0.00, 0.00, -10.20, 1.10},
-    {0.00, 0.00, 0.00, -9.80, 1.10},
-    {0.00, 0.00, 0.00, -9.40, 1.10},
-    {0.00, 0.00, 0.00, -9.00, 1.10},
-    {0.00, 0.00, 0.00, -8.60, 1.10},
-    {0.00, 0.00, 0.00, -8.20, 1.10},
-    {0.00, 0.00, 0.00, -7.80, 1.10},
-    {0.00, 0.00, 0.00, -7.40, 1.10},
-    {0.00, 0.00, 0.00, -7.00, 1.10},
-    {0.00, 0.00, 0.00, -6.60, 1.10},
-    {0.00, 0.00, 0.00, -6.20, 1.10},
-    {0.00, 0.00, 0.00, -5.80, 1.10},
-    {0.00, 0.00, 0.00, -5.40, 1.10},
-    {0.00, 0.00, 0.00, -5.00, 1.10},
-    {0.00, 0.00, 0.00, -4.60, 1.10},
-    {0.00, 0.00, 0.00, -4.20, 1.10},
-    {0.00, 0.00, 0.00, -3.80, 1.10},
-    {0.00, 0.00, 0.00, -3.40, 1.10},
-    {0.00, 0.00, 0.00, -3.00, 1.10},
-    {0.00, 0.00, 0.00, -2.60, 1.10},
-    {0.00, 0.00, 0.00, -2.20, 1.10},
-    {0.00, 0.00, 0.00, -1.80, 1.10},
-    {0.00, 0.00, 0.00, -1.40, 1.10},
-    {0.00, 0.00, 0.00, -1.00, 1.10},
-    {0.00, 0.00, 0.00, -0.60, 1.10},
-    {0.00, 0.00, 0.00, -0.20, 1.10},
-    {0.00, 0.00, 0.00, 0.20, 1.10},
-    {0.00, 0.00, 0.00, 0.60, 1.10},
-    {0.00, 0.00, 0.00, 1.00, 1.10},
-    {0.00, 0.00, 0.00, 1.40, 1.10},
-    {0.00, 0.00, 0.00, 1.80, 1.10},
-    {0.00, 0.00, 0.00, 2.20, 1.10},
-    {0.00, 0.00, 0.00, 2.60, 1.10},
-    {0.00, 0.00, 0.00, 3.00, 1.10},
-    {0.00, 0.00, 0.00, 3.40, 1.10},
-    {0.00, 0.00, 0.00, 3.80, 1.10},
-    {0.00, 0.00, 0.00, 4.20, 1.10},
-    {0.00, 0.00, 0.00, 4.60, 1.10},
-    {0.00, 0.00, 0.00, 5.00, 1.10},
-    {0.00, 0.00, 0.00, 5.40, 1.10},
-    {0.00, 0.00, 0.00, 5.80, 1.10},
-    {0.00, 0.00, 0.00, 6.20, 1.10},
-    {0.00, 0.00, 0.00, 6.60, 1.10},
-    {0.00, 0.00, 0.00, 7.00, 1.10},
-    {0.00, 0.00, 0.00, 7.40, 1.10},
-    {0.00, 0.00, 0.00, 7.80, 1.10},
-    {0.00, 0.00, 0.00, 8.20, 1.10},
-    {0.00, 0.00, 0.00, 8.60, 1.10},
-    {0.00, 0.00, 0.00, 9.00, 1.10},
-    {0.00, 0.00, 0.00, 9.40, 1.10},
-    {0.00, 0.00, 0.00, 9.80, 1.10},
-    {0.00, 0.00, 0.00, 10.20, 1.10},
-    {0.00, 0.00, 0.00, 10.60, 1.10},
-    {0.00, 0.00, 0.00, 11.00, 1.10},
-    {0.00, 0.00, 0.00, 11.40, 1.10},
-    {0.00, 0.00, 0.00, 11.80, 1.10},
-    {0.00, 0.00, 0.00, 12.20, 1.10},
-    {0.00, 0.00, 0.00, 12.60, 1.10},
-    {0.00, 0.00, 0.00, 13.00, 1.10},
-    {0.00, 0.00, 0.00, 13.40, 1.10},
-    {0.00, 0.00, 0.00, 13.80, 1.10},
-    {0.00, 0.00, 0.00, 14.20, 1.10},
-    {0.00, 0.00, 0.00, 14.60, 1.10},
-    {0.00, 0.00, 0.00, 15.00, 1.10},
-    {0.00, 0.00, 0.00, 15.40, 1.10},
-    {0.00, 0.00, 0.00, 15.80, 1.10},
-    {0.00, 0.00, 0.00, 16.20, 1.10},
-    {0.00, 0.00, 0.00, 16.60, 1.10},
-    {0.00, 0.00, 0.00, 17.00, 1.10},
-    {0.00, 0.00, 0.00, 17.40, 1.10},
-    {0.00, 0.00, 0.00, 17.80, 1.10},
-    {0.00, 0.00, 0.00, 18.20, 1.10},
-    {0.00, 0.00, 0.00, 18.60, 1.10},
-    {0.00, 0.00, 0.00, 19.00, 1.10},
-    {0.00, 0.00, 0.00, 19.40, 1.10},
-    {0.00, 0.00, 0.00, 19.80, 1.10},
-    {0.00, 0.00, 0.00, 20.20, 1.10},
-    {0.00, 0.00, 0.00, 20.60, 1.10},
-    {0.00, 0.00, 0.00, 21.00, 1.10},
-    {0.00, 0.00, 0.00, 21.40, 1.10},
-    {0.00, 0.00, 0.00, 21.80, 1.10},
-    {0.00, 0.00, 0.00, 22.20, 1.10},
-    {0.00, 0.00, 0.00, 22.60, 1.10},
-    {0.00, 0.00, 0.00, 23.00, 1.10},
-    {0.00, 0.00, 0.00, 23.40, 1.10},
-    {0.00, 0.00, 0.00, 23.80, 1.10},
-    {0.00, 0.00, 0.00, 24.20, 1.10},
-    {0.00, 0.00, 0.00, 24.60, 1.10},
-    {0.00, 0.00, 0.00, 25.00, 1.10},
-    {0.00, 0.00, 0.00, 25.40, 1.10},
-    {0.00, 0.00, 0.00, 25.80, 1.10},
-    {0.00, 0.00, 0.00, 26.20, 1.10},
-    {0.00, 0.00, 0.00, 26.60, 1.10},
-    {0.00, 0.00, 0.00, 27.00, 1.10},
-    {0.00, 0.00, 0.00, 27.40, 1.10},
-    {0.00, 0.00, 0.00, 27.80, 1.10},
-    {0.00, 0.00, 0.00, 28.20, 1.10},
-    {0.00, 0.00, 0.00, 28.60, 1.10},
-    {0.00, 0.00, 0.00, 29.00, 1.10},
-    {0.00, 0.00, 0.00, 29.40, 1.10},
-    {0.00, 0.00, 0.00, 29.80, 1.10},
-    {0.00, 0.00, 0.00, 30.20, 1.10},
-    {0.00, 0.00, 0.00, 30.60, 1.10},
-    {0.00, 0.00, 0.00, 31.00, 1.10},
-    {0.00, 0.00, 0.00, 31.40, 1.10},
-    {0.00, 0.00, 0.00, 31.80, 1.10},
-    {0.00, 0.00, 0.00, 32.20, 1.10},
-    {0.00, 0.00, 0.00, 32.60, 1.10},
-    {0.00, 0.00, 0.00, 33.00, 1.10},
-    {0.00, 0.00, 0.00, 33.40, 1.10},
-    {0.00, 0.00, 0.00, 33.80, 1.10},
-    {0.00, 0.00, 0.00, 34.20, 1.10},
-    {0.00, 0.00, 0.00, 34.60, 1.10},
-    {0.00, 0.00, 0.00, 35.00, 1.10},
-    {0.00, 0.00, 0.00, 35.40, 1.10},
-    {0.00, 0.00, 0.00, 35.80, 1.10},
-    {0.00, 0.00, 0.00, 36.20, 1.10},
-    {0.00, 0.00, 0.00, 36.60, 1.10},
-    {0.00, 0.00, 0.00, 37.00, 1.10},
-    {0.00, 0.00, 0.00, 37.40, 1.10},
-    {0.00, 0.00, 0.00, 37.80, 1.10},
-    {0.00, 0.00, 0.00, 38.20, 1.10},
-    {0.00, 0.00, 0.00, 38.60, 1.10},
-    {0.00, 0.00, 0.00, 39.00, 1.10},
-    {0.00, 0.00, 0.00, 39.40, 1.10},
-    {0.00, 0.00, 0.00, 39.80, 1.10},
-    {0.00, 0.00, 0.00, 40.20, 1.10},
-    {0.00, 0.00, 0.00, 40.60, 1.10},
-    {0.00, 0.00, 0.00, 41.00, 1.10},
-    {0.00, 0.00, 0.00, 41.40, 1.10},
-    {0.00, 0.00, 0.00, 41.80, 1.10},
-    {0.00, 0.00, 0.00, 42.20, 1.10},
-    {0.00, 0.00, 0.00, 42.60, 1.10},
-    {0.00, 0.00, 0.00, 43.00, 1.10},
-    {0.00, 0.00, 0.00, 43.40, 1.10},
-    {0.00, 0.00, 0.00, 43.80, 1.10},
-    {0.00, 0.00, 0.00, 44.20, 1.10},
-    {0.00, 0.00, 0.00, 44.60, 1.10},
-    {0.00, 0.00, 0.00, 45.00, 1.10},
-    {0.00, 0.00, 0.00, 45.40, 1.10},
-    {0.00, 0.00, 0.00, 45.80, 1.10},
-    {0.00, 0.00, 0.00, 46.20, 1.10},
-    {0.00, 0.00, 0.00, 46.60, 1.10},
-    {0.00, 0.00, 0.00, 47.00, 1.10},
-    {0.00, 0.00, 0.00, 47.40, 1.10},
-    {0.00, 0.00, 0.00, 47.80, 1.10},
-    {0.00, 0.00, 0.00, 48.20, 1.10},
-    {0.00, 0.00, 0.00, 48.60, 1.10},
-    {0.00, 0.00, 0.00, 49.00, 1.10},
-    {0.00, 0.00, 0.00, 49.40, 1.10},
-    {0.00, 0.00, 0.00, 49.80, 1.10},
-    {0.00, 0.00, 0.00, 50.20, 1.10},
-    {0.00, 0.00, 0.00, 50.60, 1.10},
-    {0.00, 0.00, 0.00, 51.00, 1.10},
-    {0.00, 0.00, 0.00, 51.40, 1.10},
-    {0.00, 0.00, 0.00, 51.80, 1.10},
-    {0.00, 0.00, 0.00, 52.20, 1.10},
-    {0.00, 0.00, 0.00, 52.60, 1.10},
-    {0.00, 0.00, 0.00, 53.00, 1.10},
-    {0.00, 0.00, 0.00, 53.40, 1.10},
-    {0.00, 0.00, 0.00, 53.80, 1.10},
-    {0.00, 0.00, 0.00, 54.20, 1.10},
-    {0.00, 0.00, 0.00, 54.60, 1.10},
-    {0.00, 0.00, 0.00, 55.00, 1.10},
-    {0.00, 0.00, 0.00, 55.40, 1.10},
-    {0.00, 0.00, 0.00, 55.80, 1.10},
-    {0.00, 0.00, 0.00, 56.20, 1.10},
-    {0.00, 0.00, 0.00, 56.60, 1.10},
-    {0.00, 0.00, 0.00, 57.00, 1.10},
-    {0.00, 0.00, 0.00, 57.40, 1.10},
-    {0.00, 0.00, 0.00, 57.80, 1.10},
-    {0.00, 0.00, 0.00, 58.20, 1.10},
-    {0.00, 0.00, 0.00, 58.60, 1.10},
-    {0.00, 0.00, 0.00, 59.00, 1.10},
-    {0.00, 0.00, 0.00, 59.40, 1.10},
-    {0.00, 0.00, 0.00, 59.80, 1.10},
-    {0.00, 0.00, 0.00, -59.80, 1.30},
-    {0.00, 0.00, 0.00, -59.40, 1.30},
-    {0.00, 0.00, 0.00, -59.00, 1.30},
-    {0.00, 0.00, 0.00, -58.60, 1.30},
-    {0.00, 0.00, 0.00, -58.20, 1.30},
-    {0.00, 0.00, 0.00, -57.80, 1.30},
-    {0.00, 0.00, 0.00, -57.40, 1.30},
-    {0.00, 0.00, 0.00, -57.00, 1.30},
-    {0.00, 0.00, 0.00, -56.60, 1.30},
-    {0.00, 0.00, 0.00, -56.20, 1.30},
-    {0.00, 0.00, 0.00, -55.80, 1.30},
-    {0.00, 0.00, 0.00, -55.40, 1.30},
-    {0.00, 0.00, 0.00, -55.00, 1.30},
-    {0.00, 0.00, 0.00, -54.60, 1.30},
-    {0.00, 0.00, 0.00, -54.20, 1.30},
-    {0.00, 0.00, 0.00, -53.80, 1.30},
-    {0.00, 0.00, 0.00, -53.40, 1.30},
-    {0.00, 0.00, 0.00, -53.00, 1.30},
-    {0.00, 0.00, 0.00, -52.60, 1.30},
-    {0.00, 0.00, 0.00, -52.20, 1.30},
-    {0.00, 0.00, 0.00, -51.80, 1.30},
-    {0.00, 0.00, 0.00, -51.40, 1.30},
-    {0.00, 0.00, 0.00, -51.00, 1.30},
-    {0.00, 0.00, 0.00, -50.60, 1.30},
-    {0.00, 0.00, 0.00, -50.20, 1.30},
-    {0.00, 0.00, 0.00, -49.80, 1.30},
-    {0.00, 0.00, 0.00, -49.40, 1.30},
-    {0.00, 0.00, 0.00, -49.00, 1.30},
-    {0.00, 0.00, 0.00, -48.60, 1.30},
-    {0.00, 0.00, 0.00, -48.20, 1.30},
-    {0.00, 0.00, 0.00, -47.80, 1.30},
-    {0.00, 0.00, 0.00, -47.40, 1.30},
-    {0.00, 0.00, 0.00, -47.00, 1.30},
-    {0.00, 0.00, 0.00, -46.60, 1.30},
-    {0.00, 0.00, 0.00, -46.20, 1.30},
-    {0.00, 0.00, 0.00, -45.80, 1.30},
-    {0.00, 0.00, 0.00, -45.40, 1.30},
-    {0.00, 0.00, 0.00, -45.00, 1.30},
-    {0.00, 0.00, 0.00, -44.60, 1.30},
-    {0.00, 0.00, 0.00, -44.20, 1.30},
-    {0.00, 0.00, 0.00, -43.80, 1.30},
-    {0.00, 0.00, 0.00, -43.40, 1.30},
-    {0.00, 0.00, 0.00, -43.00, 1.30},
-    {0.00, 0.00, 0.00, -42.60, 1.30},
-    {0.00, 0.00, 0.00, -42.20, 1.30},
-    {0.00, 0.00, 0.00, -41.80, 1.30},
-    {0.00, 0.00, 0.00, -41.40, 1.30},
-    {0.00, 0.00, 0.00, -41.00, 1.30},
-    {0.00, 0.00, 0.00, -40.60, 1.30},
-    {0.00, 0.00, 0.00, -40.20, 1.30},
-    {0.00, 0.00, 0.00, -39.80, 1.30},
-    {0.00, 0.00, 0.00, -39.40, 1.30},
-    {0.00, 0.00, 0.00, -39.00, 1.30},
-    {0.00, 0.00, 0.00, -38.60, 1.30},
-    {0.00, 0.00, 0.00, -38.20, 1.30},
-    {0.00, 0.00, 0.00, -37.80, 1.30},
-    {0.00, 0.00, 0.00, -37.40, 1.30},
-    {0.00, 0.00, 0.00, -37.00, 1.30},
-    {0.00, 0.00, 0.00, -36.60, 1.30},
-    {0.00, 0.00, 0.00, -36.20, 1.30},
-    {0.00, 0.00, 0.00, -35.80, 1.30},
-    {0.00, 0.00, 0.00, -35.40, 1.30},
-    {0.00, 0.00, 0.00, -35.00, 1.30},
-    {0.00, 0.00, 0.00, -34.60, 1.30},
-    {0.00, 0.00, 0.00, -34.20, 1.30},
-    {0.00, 0.00, 0.00, -33.80, 1.30},
-    {0.00, 0.00, 0.00, -33.40, 1.30},
-    {0.00, 0.00, 0.00, -33.00, 1.30},
-    {0.00, 0.00, 0.00, -32.60, 1.30},
-    {0.00, 0.00, 0.00, -32.20, 1.30},
-    {0.00, 0.00, 0.00, -31.80, 1.30},
-    {0.00, 0.00, 0.00, -31.40, 1.30},
-    {0.00, 0.00, 0.00, -31.00, 1.30},
-    {0.00, 0.00, 0.00, -30.60, 1.30},
-    {0.00, 0.00, 0.00, -30.20, 1.30},
-    {0.00, 0.00, 0.00, -29.80, 1.30},
-    {0.00, 0.00, 0.00, -29.40, 1.30},
-    {0.00, 0.00, 0.00, -29.00, 1.30},
-    {0.00, 0.00, 0.00, -28.60, 1.30},
-    {0.00, 0.00, 0.00, -28.20, 1.30},
-    {0.00, 0.00, 0.00, -27.80, 1.30},
-    {0.00, 0.00, 0.00, -27.40, 1.30},
-    {0.00, 0.00, 0.00, -27.00, 1.30},
-    {0.00, 0.00, 0.00, -26.60, 1.30},
-    {0.00, 0.00, 0.00, -26.20, 1.30},
-    {0.00, 0.00, 0.00, -25.80, 1.30},
-    {0.00, 0.00, 0.00, -25.40, 1.30},
-    {0.00, 0.00, 0.00, -25.00, 1.30},
-    {0.00, 0.00, 0.00, -24.60, 1.30},
-    {0.00, 0.00, 0.00, -24.20, 1.30},
-    {0.00, 0.00, 0.00, -23.80, 1.30},
-    {0.00, 0.00, 0.00, -23.40, 1.30},
-    {0.00, 0.00, 0.00, -23.00, 1.30},
-    {0.00, 0.00, 0.00, -22.60, 1.30},
-    {0.00, 0.00, 0.00, -22.20, 1.30},
-    {0.00, 0.00, 0.00, -21.80, 1.30},
-    {0.00, 0.00, 0.00, -21.40, 1.30},
-    {0.00, 0.00, 0.00, -21.00, 1.30},
-    {0.00, 0.00, 0.00, -20.60, 1.30},
-    {0.00, 0.00, 0.00, -20.20, 1.30},
-    {0.00, 0.00, 0.00, -19.80, 1.30},
-    {0.00, 0.00, 0.00, -19.40, 1.30},
-    {0.00, 0.00, 0.00, -19.00, 1.30},
-    {0.00, 0.00, 0.00, -18.60, 1.30},
-    {0.00, 0.00, 0.00, -18.20, 1.30},
-    {0.00, 0.00, 0.00, -17.80, 1.30},
-    {0.00, 0.00, 0.00, -17.40, 1.30},
-    {0.00, 0.00, 0.00, -17.00, 1.30},
-    {0.00, 0.00, 0.00, -16.60, 1.30},
-    {0.00, 0.00, 0.00, -16.20, 1.30},
-    {0.00, 0.00, 0.00, -15.80, 1.30},
-    {0.00, 0.00, 0.00, -15.40, 1.30},
-    {0.00, 0.00, 0.00, -15.00, 1.30},
-    {0.00, 0.00, 0.00, -14.60, 1.30},
-    {0.00, 0.00, 0.00, -14.20, 1.30},
-    {0.00, 0.00, 0.00, -13.80, 1.30},
-    {0.00, 0.00, 0.00, -13.40, 1.30},
-    {0.00, 0.00, 0.00, -13.00, 1.30},
-    {0.00, 0.00, 0.00, -12.60, 1.30},
-    {0.00, 0.00, 0.00, -12.20, 1.30},
-    {0.00, 0.00, 0.00, -11.80, 1.30},
-    {0.00, 0.00, 0.00, -11.40, 1.30},
-    {0.00, 0.00, 0.00, -11.00, 1.30},
-    {0.00, 0.00, 0.00, -10.60, 1.30},
-    {0.00, 0.00, 0.00, -10.20, 1.30},
-    {0.00, 0.00, 0.00, -9.80, 1.30},
-    {0.00, 0.00, 0.00, -9.40, 1.30},
-    {0.00, 0.00, 0.00, -9.00, 1.30},
-    {0.00, 0.00, 0.00, -8.60, 1.30},
-    {0.00, 0.00, 0.00, -8.20, 1.30},
-    {0.00, 0.00, 0.00, -7.80, 1.30},
-    {0.00, 0.00, 0.00, -7.40, 1.30},
-    {0.00, 0.00, 0.00, -7.00, 1.30},
-    {0.00, 0.00, 0.00, -6.60, 1.30},
-    {0.00, 0.00, 0.00, -6.20, 1.30},
-    {0.00, 0.00, 0.00, -5.80, 1.30},
-    {0.00, 0.00, 0.00, -5.40, 1.30},
-    {0.00, 0.00, 0.00, -5.00, 1.30},
-    {0.00, 0.00, 0.00, -4.60, 1.30},
-    {0.00, 0.00, 0.00, -4.20, 1.30},
-    {0.00, 0.00, 0.00, -3.80, 1.30},
-    {0.00, 0.00, 0.00, -3.40, 1.30},
-    {0.00, 0.00, 0.00, -3.00, 1.30},
-    {0.00, 0.00, 0.00, -2.60, 1.30},
-    {0.00, 0.00, 0.00, -2.20, 1.30},
-    {0.00, 0.00, 0.00, -1.80, 1.30},
-    {0.00, 0.00, 0.00, -1.40, 1.30},
-    {0.00, 0.00, 0.00, -1.00, 1.30},
-    {0.00, 0.00, 0.00, -0.60, 1.30},
-    {0.00, 0.00, 0.00, -0.20, 1.30},
-    {0.00, 0.00, 0.00, 0.20, 1.30},
-    {0.00, 0.00, 0.00, 0.60, 1.30},
-    {0.00, 0.00, 0.00, 1.00, 1.30},
-    {0.00, 0.00, 0.00, 1.40, 1.30},
-    {0.00, 0.00, 0.00, 1.80, 1.30},
-    {0.00, 0.00, 0.00, 2.20, 1.30},
-    {0.00, 0.00, 0.00, 2.60, 1.30},
-    {0.00, 0.00, 0.00, 3.00, 1.30},
-    {0.00, 0.00, 0.00, 3.40, 1.30},
-    {0.00, 0.00, 0.00, 3.80, 1.30},
-    {0.00, 0.00, 0.00, 4.20, 1.30},
-    {0.00, 0.00, 0.00, 4.60, 1.30},
-    {0.00, 0.00, 0.00, 5.00, 1.30},
-    {0.00, 0.00, 0.00, 5.40, 1.30},
-    {0.00, 0.00, 0.00, 5.80, 1.30},
-    {0.00, 0.00, 0.00, 6.20, 1.30},
-    {0.00, 0.00, 0.00, 6.60, 1.30},
-    {0.00, 0.00, 0.00, 7.00, 1.30},
-    {0.00, 0.00, 0.00, 7.40, 1.30},
-    {0.00, 0.00, 0.00, 7.80, 1.30},
-    {0.00, 0.00, 0.00, 8.20, 1.30},
-    {0.00, 0.00, 0.00, 8.60, 1.30},
-    {0.00, 0.00, 0.00, 9.00, 1.30},
-    {0.00, 0.00, 0.00, 9.40, 1.30},
-    {0.00, 0.00, 0.00, 9.80, 1.30},
-    {0.00, 0.00, 0.00, 10.20, 1.30},
-    {0.00, 0.00, 0.00, 10.60, 1.30},
-    {0.00, 0.00, 0.00, 11.00, 1.30},
-    {0.00, 0.00, 0.00, 11.40, 1.30},
-    {0.00, 0.00, 0.00, 11.80, 1.30},
-    {0.00, 0.00, 0.00, 12.20, 1.30},
-    {0.00, 0.00, 0.00, 12.60, 1.30},
-    {0.00, 0.00, 0.00, 13.00, 1.30},
-    {0.00, 0.00, 0.00, 13.40, 1.30},
-    {0.00, 0.00, 0.00, 13.80, 1.30},
-    {0.00, 0.00, 0.00, 14.20, 1.30},
-    {0.00, 0.00, 0.00, 14.60, 1.30},
-    {0.00, 0.00, 0.00, 15.00, 1.30},
-    {0.00, 0.00, 0.00, 15.40, 1.30},
-    {0.00, 0.00, 0.00, 15.80, 1.30},
-    {0.00, 0.00, 0.00, 16.20, 1.30},
-    {0.00, 0.00, 0.00, 16.60, 1.30},
-    {0.00, 0.00, 0.00, 17.00, 1.30},
-    {0.00, 0.00, 0.00, 17.40, 1.30},
-    {0.00, 0.00, 0.00, 17.80, 1.30},
-    {0.00, 0.00, 0.00, 18.20, 1.30},
-    {0.00, 0.00, 0.00, 18.60, 1.30},
-    {0.00, 0.00, 0.00, 19.00, 1.30},
-    {0.00, 0.00, 0.00, 19.40, 1.30},
-    {0.00, 0.00, 0.00, 19.80, 1.30},
-    {0.00, 0.00, 0.00, 20.20, 1.30},
-    {0.00, 0.00, 0.00, 20.60, 1.30},
-    {0.00, 0.00, 0.00, 21.00, 1.30},
-    {0.00, 0.00, 0.00, 21.40, 1.30},
-    {0.00, 0.00, 0.00, 21.80, 1.30},
-    {0.00, 0.00, 0.00, 22.20, 1.30},
-    {0.00, 0.00, 0.00, 22.60, 1.30},
-    {0.00, 0.00, 0.00, 23.00, 1.30},
-    {0.00, 0.00, 0.00, 23.40, 1.30},
-    {0.00, 0.00, 0.00, 23.80, 1.30},
-    {0.00, 0.00, 0.00, 24.20, 1.30},
-    {0.00, 0.00, 0.00, 24.60, 1.30},
-    {0.00, 0.00, 0.00, 25.00, 1.30},
-    {0.00, 0.00, 0.00, 25.40, 1.30},
-    {0.00, 0.00, 0.00, 25.80, 1.30},
-    {0.00, 0.00, 0.00, 26.20, 1.30},
-    {0.00, 0.00, 0.00, 26.60, 1.30},
-    {0.00, 0.00, 0.00, 27.00, 1.30},
-    {0.00, 0.00, 0.00, 27.40, 1.30},
-    {0.00, 0.00, 0.00, 27.80, 1.30},
-    {0.00, 0.00, 0.00, 28.20, 1.30},
-    {0.00, 0.00, 0.00, 28.60, 1.30},
-    {0.00, 0.00, 0.00, 29.00, 1.30},
-    {0.00, 0.00, 0.00, 29.40, 1.30},
-    {0.00, 0.00, 0.00, 29.80, 1.30},
-    {0.00, 0.00, 0.00, 30.20, 1.30},
-    {0.00, 0.00, 0.00, 30.60, 1.30},
-    {0.00, 0.00, 0.00, 31.00, 1.30},
-    {0.00, 0.00, 0.00, 31.40, 1.30},
-    {0.00, 0.00, 0.00, 31.80, 1.30},
-    {0.00, 0.00, 0.00, 32.20, 1.30},
-    {0.00, 0.00, 0.00, 32.60, 1.30},
-    {0.00, 0.00, 0.00, 33.00, 1.30},
-    {0.00, 0.00, 0.00, 33.40, 1.30},
-    {0.00, 0.00, 0.00, 33.80, 1.30},
-    {0.00, 0.00, 0.00, 34.20, 1.30},
-    {0.00, 0.00, 0.00, 34.60, 1.30},
-    {0.00, 0.00, 0.00, 35.00, 1.30},
-    {0.00, 0.00, 0.00, 35.40, 1.30},
-    {0.00, 0.00, 0.00, 35.80, 1.30},
-    {0.00, 0.00, 0.00, 36.20, 1.30},
-    {0.00, 0.00, 0.00, 36.60, 1.30},
-    {0.00, 0.00, 0.00, 37.00, 1.30},
-    {0.00, 0.00, 0.00, 37.40, 1.30},
-    {0.00, 0.00, 0.00, 37.80, 1.30},
-    {0.00, 0.00, 0.00, 38.20, 1.30},
-    {0.00, 0.00, 0.00, 38.60, 1.30},
-    {0.00, 0.00, 0.00, 39.00, 1.30},
-    {0.00, 0.00, 0.00, 39.40, 1.30},
-    {0.00, 0.00, 0.00, 39.80, 1.30},
-    {0.00, 0.00, 0.00, 40.20, 1.30},
-    {0.00, 0.00, 0.00, 40.60, 1.30},
-    {0.00, 0.00, 0.00, 41.00, 1.30},
-    {0.00, 0.00, 0.00, 41.40, 1.30},
-    {0.00, 0.00, 0.00, 41.80, 1.30},
-    {0.00, 0.00, 0.00, 42.20, 1.30},
-    {0.00, 0.00, 0.00, 42.60, 1.30},
-    {0.00, 0.00, 0.00, 43.00, 1.30},
-    {0.00, 0.00, 0.00, 43.40, 1.30},
-    {0.00, 0.00, 0.00, 43.80, 1.30},
-    {0.00, 0.00, 0.00, 44.20, 1.30},
-    {0.00, 0.00, 0.00, 44.60, 1.30},
-    {0.00, 0.00, 0.00, 45.00, 1.30},
-    {0.00, 0.00, 0.00, 45.40, 1.30},
-    {0.00, 0.00, 0.00, 45.80, 1.30},
-    {0.00, 0.00, 0.00, 46.20, 1.30},
-    {0.00, 0.00, 0.00, 46.60, 1.30},
-    {0.00, 0.00, 0.00, 47.00, 1.30},
-    {0.00, 0.00, 0.00, 47.40, 1.30},
-    {0.00, 0.00, 0.00, 47.80, 1.30},
-    {0.00, 0.00, 0.00, 48.20, 1.30},
-    {0.00, 0.00, 0.00, 48.60, 1.30},
-    {0.00, 0.00, 0.00, 49.00, 1.30},
-    {0.00, 0.00, 0.00, 49.40, 1.30},
-    {0.00, 0.00, 0.00, 49.80, 1.30},
-    {0.00, 0.00, 0.00, 50.20, 1.30},
-    {0.00, 0.00, 0.00, 50.60, 1.30},
-    {0.00, 0.00, 0.00, 51.00, 1.30},
-    {0.00, 0.00, 0.00, 51.40, 1.30},
-    {0.00, 0.00, 0.00, 51.80, 1.30},
-    {0.00, 0.00, 0.00, 52.20, 1.30},
-    {0.00, 0.00, 0.00, 52.60, 1.30},
-    {0.00, 0.00, 0.00, 53.00, 1.30},
-    {0.00, 0.00, 0.00, 53.40, 1.30},
-    {0.00, 0.00, 0.00, 53.80, 1.30},
-    {0.00, 0.00, 0.00, 54.20, 1.30},
-    {0.00, 0.00, 0.00, 54.60, 1.30},
-    {0.00, 0.00, 0.00, 55.00, 1.30},
-    {0.00, 0.00, 0.00, 55.40, 1.30},
-    {0.00, 0.00, 0.00, 55.80, 1.30},
-    {0.00, 0.00, 0.00, 56.20, 1.30},
-    {0.00, 0.00, 0.00, 56.60, 1.30},
-    {0.00, 0.00, 0.00, 57.00, 1.30},
-    {0.00, 0.00, 0.00, 57.40, 1.30},
-    {0.00, 0.00, 0.00, 57.80, 1.30},
-    {0.00, 0.00, 0.00, 58.20, 1.30},
-    {0.00, 0.00, 0.00, 58.60, 1.30},
-    {0.00, 0.00, 0.00, 59.00, 1.30},
-    {0.00, 0.00, 0.00, 59.40, 1.30},
-    {0.00, 0.00, 0.00, 59.80, 1.30},
-    {0.00, 0.00, 0.00, -59.80, 1.50},
-    {0.00, 0.00, 0.00, -59.40, 1.50},
-    {0.00, 0.00, 0.00, -59.00, 1.50},
-    {0.00, 0.00, 0.00, -58.60, 1.50},
-    {0.00, 0.00, 0.00, -58.20, 1.50},
-    {0.00, 0.00, 0.00, -57.80, 1.50},
-    {0.00, 0.00, 0.00, -57.40, 1.50},
-    {0.00, 0.00, 0.00, -57.00, 1.50},
-    {0.00, 0.00, 0.00, -56.60, 1.50},
-    {0.00, 0.00, 0.00, -56.20, 1.50},
-    {0.00, 0.00, 0.00, -55.80, 1.50},
-    {0.00, 0.00, 0.00, -55.40, 1.50},
-    {0.00, 0.00, 0.00, -55.00, 1.50},
-    {0.00, 0.00, 0.00, -54.60, 1.50},
-    {0.00, 0.00, 0.00, -54.20, 1.50},
-    {0.00, 0.00, 0.00, -53.80, 1.50},
-    {0.00, 0.00, 0.00, -53.40, 1.50},
-    {0.00, 0.00, 0.00, -53.00, 1.50},
-    {0.00, 0.00, 0.00, -52.60, 1.50},
-    {0.00, 0.00, 0.00, -52.20, 1.50},
-    {0.00, 0.00, 0.00, -51.80, 1.50},
-    {0.00, 0.00, 0.00, -51.40, 1.50},
-    {0.00, 0.00, 0.00, -51.00, 1.50},
-    {0.00, 0.00, 0.00, -50.60, 1.50},
-    {0.00, 0.00, 0.00, -50.20, 1.50},
-    {0.00, 0.00, 0.00, -49.80, 1.50},
-    {0.00, 0.00, 0.00, -49.40, 1.50},
-    {0.00, 0.00, 0.00, -49.00, 1.50},
-    {0.00, 0.00, 0.00, -48.60, 1.50},
-    {0.00, 0.00, 0.00, -48.20, 1.50},
-    {0.00, 0.00, 0.00, -47.80, 1.50},
-    {0.00, 0.00, 0.00, -47.40, 1.50},
-    {0.00, 0.00, 0.00, -47.00, 1.50},
-    {0.00, 0.00, 0.00, -46.60, 1.50},
-    {0.00, 0.00, 0.00, -46.20, 1.50},
-    {0.00, 0.00, 0.00, -45.80, 1.50},
-    {0.00, 0.00, 0.00, -45.40, 1.50},
-    {0.00, 0.00, 0.00, -45.00, 1.50},
-    {0.00, 0.00, 0.00, -44.60, 1.50},
-    {0.00, 0.00, 0.00, -44.20, 1.50},
-    {0.00, 0.00, 0.00, -43.80, 1.50},
-    {0.00, 0.00, 0.00, -43.40, 1.50},
-    {0.00, 0.00, 0.00, -43.00, 1.50},
-    {0.00, 0.00, 0.00, -42.60, 1.50},
-    {0.00, 0.00, 0.00, -42.20, 1.50},
-    {0.00, 0.00, 0.00, -41.80, 1.50},
-    {0.00, 0.00, 0.00, -41.40, 1.50},
-    {0.00, 0.00, 0.00, -41.00, 1.50},
-    {0.00, 0.00, 0.00, -40.60, 1.50},
-    {0.00, 0.00, 0.00, -40.20, 1.50},
-    {0.00, 0.00, 0.00, -39.80, 1.50},
-    {0.00, 0.00, 0.00, -39.40, 1.50},
-    {0.00, 0.00, 0.00, -39.00, 1.50},
-    {0.00, 0.00, 0.00, -38.60, 1.50},
-    {0.00, 0.00, 0.00, -38.20, 1.50},
-    {0.00, 0.00, 0.00, -37.80, 1.50},
-    {0.00, 0.00, 0.00, -37.40, 1.50},
-    {0.00, 0.00, 0.00, -37.00, 1.50},
-    {0.00, 0.00, 0.00, -36.60, 1.50},
-    {0.00, 0.00, 0.00, -36.20, 1.50},
-    {0.00, 0.00, 0.00, -35.80, 1.50},
-    {0.00, 0.00, 0.00, -35.40, 1.50},
-    {0.00, 0.00, 0.00, -35.00, 1.50},
-    {0.00, 0.00, 0.00, -34.60, 1.50},
-    {0.00, 0.00, 0.00, -34.20, 1.50},
-    {0.00, 0.00, 0.00, -33.80, 1.50},
-    {0.00, 0.00, 0.00, -33.40, 1.50},
-    {0.00, 0.00, 0.00, -33.00, 1.50},
-    {0.00, 0.00, 0.00, -32.60, 1.50},
-    {0.00, 0.00, 0.00, -32.20, 1.50},
-    {0.00, 0.00, 0.00, -31.80, 1.50},
-    {0.00, 0.00, 0.00, -31.40, 1.50},
-    {0.00, 0.00, 0.00, -31.00, 1.50},
-    {0.00, 0.00, 0.00, -30.60, 1.50},
-    {0.00, 0.00, 0.00, -30.20, 1.50},
-    {0.00, 0.00, 0.00, -29.80, 1.50},
-    {0.00, 0.00, 0.00, -29.40, 1.50},
-    {0.00, 0.00, 0.00, -29.00, 1.50},
-    {0.00, 0.00, 0.00, -28.60, 1.50},
-    {0.00, 0.00, 0.00, -28.20, 1.50},
-    {0.00, 0.00, 0.00, -27.80, 1.50},
-    {0.00, 0.00, 0.00, -27.40, 1.50},
-    {0.00, 0.00, 0.00, -27.00, 1.50},
-    {0.00, 0.00, 0.00, -26.60, 1.50},
-    {0.00, 0.00, 0.00, -26.20, 1.50},
-    {0.00, 0.00, 0.00, -25.80, 1.50},
-    {0.00, 0.00, 0.00, -25.40, 1.50},
-    {0.00, 0.00, 0.00, -25.00, 1.50},
-    {0.00, 0.00, 0.00, -24.60, 1.50},
-    {0.00, 0.00, 0.00, -24.20, 1.50},
-    {0.00, 0.00, 0.00, -23.80, 1.50},
-    {0.00, 0.00, 0.00, -23.40, 1.50},
-    {0.00, 0.00, 0.00, -23.00, 1.50},
-    {0.00, 0.00, 0.00, -22.60, 1.50},
-    {0.00, 0.00, 0.00, -22.20, 1.50},
-    {0.00, 0.00, 0.00, -21.80, 1.50},
-    {0.00, 0.00, 0.00, -21.40, 1.50},
-    {0.00, 0.00, 0.00, -21.00, 1.50},
-    {0.00, 0.00, 0.00, -20.60, 1.50},
-    {0.00, 0.00, 0.00, -20.20, 1.50},
-    {0.00, 0.00, 0.00, -19.80, 1.50},
-    {0.00, 0.00, 0.00, -19.40, 1.50},
-    {0.00, 0.00, 0.00, -19.00, 1.50},
-    {0.00, 0.00, 0.00, -18.60, 1.50},
-    {0.00, 0.00, 0.00, -18.20, 1.50},
-    {0.00, 0.00, 0.00, -17.80, 1.50},
-    {0.00, 0.00, 0.00, -17.40, 1.50},
-    {0.00, 0.00, 0.00, -17.00, 1.50},
-    {0.00, 0.00, 0.00, -16.60, 1.50},
-    {0.00, 0.00, 0.00, -16.20, 1.50},
-    {0.00, 0.00, 0.00, -15.80, 1.50},
-    {0.00, 0.00, 0.00, -15.40, 1.50},
-    {0.00, 0.00, 0.00, -15.00, 1.50},
-    {0.00, 0.00, 0.00, -14.60, 1.50},
-    {0.00, 0.00, 0.00, -14.20, 1.50},
-    {0.00, 0.00, 0.00, -13.80, 1.50},
-    {0.00, 0.00, 0.00, -13.40, 1.50},
-    {0.00, 0.00, 0.00, -13.00, 1.50},
-    {0.00, 0.00, 0.00, -12.60, 1.50},
-    {0.00, 0.00, 0.00, -12.20, 1.50},
-    {0.00, 0.00, 0.00, -11.80, 1.50},
-    {0.00, 0.00, 0.00, -11.40, 1.50},
-    {0.00, 0.00, 0.00, -11.00, 1.50},
-    {0.00, 0.00, 0.00, -10.60, 1.50},
-    {0.00, 0.00, 0.00, -10.20, 1.50},
-    {0.00, 0.00, 0.00, -9.80, 1.50},
-    {0.00, 0.00, 0.00, -9.40, 1.50},
-    {0.00, 0.00, 0.00, -9.00, 1.50},
-    {0.00, 0.00, 0.00, -8.60, 1.50},
-    {0.00, 0.00, 0.00, -8.20, 1.50},
-    {0.00, 0.00, 0.00, -7.80, 1.50},
-    {0.00, 0.00, 0.00, -7.40, 1.50},
-    {0.00, 0.00, 0.00, -7.00, 1.50},
-    {0.00, 0.00, 0.00, -6.60, 1.50},
-    {0.00, 0.00, 0.00, -6.20, 1.50},
-    {0.00, 0.00, 0.00, -5.80, 1.50},
-    {0.00, 0.00, 0.00, -5.40, 1.50},
-    {0.00, 0.00, 0.00, -5.00, 1.50},
-    {0.00, 0.00, 0.00, -4.60, 1.50},
-    {0.00, 0.00, 0.00, -4.20, 1.50},
-    {0.00, 0.00, 0.00, -3.80, 1.50},
-    {0.00, 0.00, 0.00, -3.40, 1.50},
-    {0.00, 0.00, 0.00, -3.00, 1.50},
-    {0.00, 0.00, 0.00, -2.60, 1.50},
-    {0.00, 0.00, 0.00, -2.20, 1.50},
-    {0.00, 0.00, 0.00, -1.80, 1.50},
-    {0.00, 0.00, 0.00, -1.40, 1.50},
-    {0.00, 0.00, 0.00, -1.00, 1.50},
-    {0.00, 0.00, 0.00, -0.60, 1.50},
-    {0.00, 0.00, 0.00, -0.20, 1.50},
-    {0.00, 0.00, 0.00, 0.20, 1.50},
-    {0.00, 0.00, 0.00, 0.60, 1.50},
-    {0.00, 0.00, 0.00, 1.00, 1.50},
-    {0.00, 0.00, 0.00, 1.40, 1.50},
-    {0.00, 0.00, 0.00, 1.80, 1.50},
-    {0.00, 0.00, 0.00, 2.20, 1.50},
-    {0.00, 0.00, 0.00, 2.60, 1.50},
-    {0.00, 0.00, 0.00, 3.00, 1.50},
-    {0.00, 0.00, 0.00, 3.40, 1.50},
-    {0.00, 0.00, 0.00, 3.80, 1.50},
-    {0.00, 0.00, 0.00, 4.20, 1.50},
-    {0.00, 0.00, 0.00, 4.60, 1.50},
-    {0.00, 0.00, 0.00, 5.00, 1.50},
-    {0.00, 0.00, 0.00, 5.40, 1.50},
-    {0.00, 0.00, 0.00, 5.80, 1.50},
-    {0.00, 0.00, 0.00, 6.20, 1.50},
-    {0.00, 0.00, 0.00, 6.60, 1.50},
-    {0.00, 0.00, 0.00, 7.00, 1.50},
-    {0.00, 0.00, 0.00, 7.40, 1.50},
-    {0.00, 0.00, 0.00, 7.80, 1.50},
-    {0.00, 0.00, 0.00, 8.20, 1.50},
-    {0.00, 0.00, 0.00, 8.60, 1.50},
-    {0.00, 0.00, 0.00, 9.00, 1.50},
-    {0.00, 0.00, 0.00, 9.40, 1.50},
-    {0.00, 0.00, 0.00, 9.80, 1.50},
-    {0.00, 0.00, 0.00, 10.20, 1.50},
-    {0.00, 0.00, 0.00, 10.60, 1.50},
-    {0.00, 0.00, 0.00, 11.00, 1.50},
-    {0.00, 0.00, 0.00, 11.40, 1.50},
-    {0.00, 0.00, 0.00, 11.80, 1.50},
-    {0.00, 0.00, 0.00, 12.20, 1.50},
-    {0.00, 0.00, 0.00, 12.60, 1.50},
-    {0.00, 0.00, 0.00, 13.00, 1.50},
-    {0.00, 0.00, 0.00, 13.40, 1.50},
-    {0.00, 0.00, 0.00, 13.80, 1.50},
-    {0.00, 0.00, 0.00, 14.20, 1.50},
-    {0.00, 0.00, 0.00, 14.60, 1.50},
-    {0.00, 0.00, 0.00, 15.00, 1.50},
-    {0.00, 0.00, 0.00, 15.40, 1.50},
-    {0.00, 0.00, 0.00, 15.80, 1.50},
-    {0.00, 0.00, 0.00, 16.20, 1.50},
-    {0.00, 0.00, 0.00, 16.60, 1.50},
-    {0.00, 0.00, 0.00, 17.00, 1.50},
-    {0.00, 0.00, 0.00, 17.40, 1.50},
-    {0.00, 0.00, 0.00, 17.80, 1.50},
-    {0.00, 0.00, 0.00, 18.20, 1.50},
-    {0.00, 0.00, 0.00, 18.60, 1.50},
-    {0.00, 0.00, 0.00, 19.00, 1.50},
-    {0.00, 0.00, 0.00, 19.40, 1.50},
-    {0.00, 0.00, 0.00, 19.80, 1.50},
-    {0.00, 0.00, 0.00, 20.20, 1.50},
-    {0.00, 0.00, 0.00, 20.60, 1.50},
-    {0.00, 0.00, 0.00, 21.00, 1.50},
-    {0.00, 0.00, 0.00, 21.40, 1.50},
-    {0.00, 0.00, 0.00, 21.80, 1.50},
-    {0.00, 0.00, 0.00, 22.20, 1.50},
-    {0.00, 0.00, 0.00, 22.60, 1.50},
-    {0.00, 0.00, 0.00, 23.00, 1.50},
-    {0.00, 0.00, 0.00, 23.40, 1.50},
-    {0.00, 0.00, 0.00, 23.80, 1.50},
-    {0.00, 0.00, 0.00, 24.20, 1.50},
-    {0.00, 0.00, 0.00, 24.60, 1.50},
-    {0.00, 0.00, 0.00, 25.00, 1.50},
-    {0.00, 0.00, 0.00, 25.40, 1.50},
-    {0.00, 0.00, 0.00, 25.80, 1.50},
-    {0.00, 0.00, 0.00, 26.20, 1.50},
-    {0.00, 0.00, 0.00, 26.60, 1.50},
-    {0.00, 0.00, 0.00, 27.00, 1.50},
-    {0.00, 0.00, 0.00, 27.40, 1.50},
-    {0.00, 0.00, 0.00, 27.80, 1.50},
-    {0.00, 0.00, 0.00, 28.20, 1.50},
-    {0.00, 0.00, 0.00, 28.60, 1.50},
-    {0.00, 0.00, 0.00, 29.00, 1.50},
-    {0.00, 0.00, 0.00, 29.40, 1.50},
-    {0.00, 0.00, 0.00, 29.80, 1.50},
-    {0.00, 0.00, 0.00, 30.20, 1.50},
-    {0.00, 0.00, 0.00, 30.60, 1.50},
-    {0.00, 0.00, 0.00, 31.00, 1.50},
-    {0.00, 0.00, 0.00, 31.40, 1.50},
-    {0.00, 0.00, 0.00, 31.80, 1.50},
-    {0.00, 0.00, 0.00, 32.20, 1.50},
-    {0.00, 0.00, 0.00, 32.60, 1.50},
-    {0.00, 0.00, 0.00, 33.00, 1.50},
-    {0.00, 0.00, 0.00, 33.40, 1.50},
-    {0.00, 0.00, 0.00, 33.80, 1.50},
-    {0.00, 0.00, 0.00, 34.20, 1.50},
-    {0.00, 0.00, 0.00, 34.60, 1.50},
-    {0.00, 0.00, 0.00, 35.00, 1.50},
-    {0.00, 0.00, 0.00, 35.40, 1.50},
-    {0.00, 0.00, 0.00, 35.80, 1.50},
-    {0.00, 0.00, 0.00, 36.20, 1.50},
-    {0.00, 0.00, 0.00, 36.60, 1.50},
-    {0.00, 0.00, 0.00, 37.00, 1.50},
-    {0.00, 0.00, 0.00, 37.40, 1.50},
-    {0.00, 0.00, 0.00, 37.80, 1.50},
-    {0.00, 0.00, 0.00, 38.20, 1.50},
-    {0.00, 0.00, 0.00, 38.60, 1.50},
-    {0.00, 0.00, 0.00, 39.00, 1.50},
-    {0.00, 0.00, 0.00, 39.40, 1.50},
-    {0.00, 0.00, 0.00, 39.80, 1.50},
-    {0.00, 0.00, 0.00, 40.20, 1.50},
-    {0.00, 0.00, 0.00, 40.60, 1.50},
-    {0.00, 0.00, 0.00, 41.00, 1.50},
-    {0.00, 0.00, 0.00, 41.40, 1.50},
-    {0.00, 0.00, 0.00, 41.80, 1.50},
-    {0.00, 0.00, 0.00, 42.20, 1.50},
-    {0.00, 0.00, 0.00, 42.60, 1.50},
-    {0.00, 0.00, 0.00, 43.00, 1.50},
-    {0.00, 0.00, 0.00, 43.40, 1.50},
-    {0.00, 0.00, 0.00, 43.80, 1.50},
-    {0.00, 0.00, 0.00, 44.20, 1.50},
-    {0.00, 0.00, 0.00, 44.60, 1.50},
-    {0.00, 0.00, 0.00, 45.00, 1.50},
-    {0.00, 0.00, 0.00, 45.40, 1.50},
-    {0.00, 0.00, 0.00, 45.80, 1.50},
-    {0.00, 0.00, 0.00, 46.20, 1.50},
-    {0.00, 0.00, 0.00, 46.60, 1.50},
-    {0.00, 0.00, 0.00, 47.00, 1.50},
-    {0.00, 0.00, 0.00, 47.40, 1.50},
-    {0.00, 0.00, 0.00, 47.80, 1.50},
-    {0.00, 0.00, 0.00, 48.20, 1.50},
-    {0.00, 0.00, 0.00, 48.60, 1.50},
-    {0.00, 0.00, 0.00, 49.00, 1.50},
-    {0.00, 0.00, 0.00, 49.40, 1.50},
-    {0.00, 0.00, 0.00, 49.80, 1.50},
-    {0.00, 0.00, 0.00, 50.20, 1.50},
-    {0.00, 0.00, 0.00, 50.60, 1.50},
-    {0.00, 0.00, 0.00, 51.00, 1.50},
-    {0.00, 0.00, 0.00, 51.40, 1.50},
-    {0.00, 0.00, 0.00, 51.80, 1.50},
-    {0.00, 0.00, 0.00, 52.20, 1.50},
-    {0.00, 0.00, 0.00, 52.60, 1.50},
-    {0.00, 0.00, 0.00, 53.00, 1.50},
-    {0.00, 0.00, 0.00, 53.40, 1.50},
-    {0.00, 0.00, 0.00, 53.80, 1.50},
-    {0.00, 0.00, 0.00, 54.20, 1.50},
-    {0.00, 0.00, 0.00, 54.60, 1.50},
-    {0.00, 0.00, 0.00, 55.00, 1.50},
-    {0.00, 0.00, 0.00, 55.40, 1.50},
-    {0.00, 0.00, 0.00, 55.80, 1.50},
-    {0.00, 0.00, 0.00, 56.20, 1.50},
-    {0.00, 0.00, 0.00, 56.60, 1.50},
-    {0.00, 0.00, 0.00, 57.00, 1.50},
-    {0.00, 0.00, 0.00, 57.40, 1.50},
-    {0.00, 0.00, 0.00, 57.80, 1.50},
-    {0.00, 0.00, 0.00, 58.20, 1.50},
-    {0.00, 0.00, 0.00, 58.60, 1.50},
-    {0.00, 0.00, 0.00, 59.00, 1.50},
-    {0.00, 0.00, 0.00, 59.40, 1.50},
-    {0.00, 0.00, 0.00, 59.80, 1.50},
-    {0.00, 0.00, 0.00, -59.80, 1.70},
-    {0.00, 0.00, 0.00, -59.40, 1.70},
-    {0.00, 0.00, 0.00, -59.00, 1.70},
-    {0.00, 0.00, 0.00, -58.60, 1.70},
-    {0.00, 0.00, 0.00, -58.20, 1.70},
-    {0.00, 0.00, 0.00, -57.80, 1.70},
-    {0.00, 0.00, 0.00, -57.40, 1.70},
-    {0.00, 0.00, 0.00, -57.00, 1.70},
-    {0.00, 0.00, 0.00, -56.60, 1.70},
-    {0.00, 0.00, 0.00, -56.20, 1.70},
-    {0.00, 0.00, 0.00, -55.80, 1.70},
-    {0.00, 0.00, 0.00, -55.40, 1.70},
-    {0.00, 0.00, 0.00, -55.00, 1.70},
-    {0.00, 0.00, 0.00, -54.60, 1.70},
-    {0.00, 0.00, 0.00, -54.20, 1.70},
-    {0.00, 0.00, 0.00, -53.80, 1.70},
-    {0.00, 0.00, 0.00, -53.40, 1.70},
-    {0.00, 0.00, 0.00, -53.00, 1.70},
-    {0.00, 0.00, 0.00, -52.60, 1.70},
-    {0.00, 0.00, 0.00, -52.20, 1.70},
-    {0.00, 0.00, 0.00, -51.80, 1.70},
-    {0.00, 0.00, 0.00, -51.40, 1.70},
-    {0.00, 0.00, 0.00, -51.00, 1.70},
-    {0.00, 0.00, 0.00, -50.60, 1.70},
-    {0.00, 0.00, 0.00, -50.20, 1.70},
-    {0.00, 0.00, 0.00, -49.80, 1.70},
-    {0.00, 0.00, 0.00, -49.40, 1.70},
-    {0.00, 0.00, 0.00, -49.00, 1.70},
-    {0.00, 0.00, 0.00, -48.60, 1.70},
-    {0.00, 0.00, 0.00, -48.20, 1.70},
-    {0.00, 0.00, 0.00, -47.80, 1.70},
-    {0.00, 0.00, 0.00, -47.40, 1.70},
-    {0.00, 0.00, 0.00, -47.00, 1.70},
-    {0.00, 0.00, 0.00, -46.60, 1.70},
-    {0.00, 0.00, 0.00, -46.20, 1.70},
-    {0.00, 0.00, 0.00, -45.80, 1.70},
-    {0.00, 0.00, 0.00, -45.40, 1.70},
-    {0.00, 0.00, 0.00, -45.00, 1.70},
-    {0.00, 0.00, 0.00, -44.60, 1.70},
-    {0.00, 0.00, 0.00, -44.20, 1.70},
-    {0.00, 0.00, 0.00, -43.80, 1.70},
-    {0.00, 0.00, 0.00, -43.40, 1.70},
-    {0.00, 0.00, 0.00, -43.00, 1.70},
-    {0.00, 0.00, 0.00, -42.60, 1.70},
-    {0.00, 0.00, 0.00, -42.20, 1.70},
-    {0.00, 0.00, 0.00, -41.80, 1.70},
-    {0.00, 0.00, 0.00, -41.40, 1.70},
-    {0.00, 0.00, 0.00, -41.00, 1.70},
-    {0.00, 0.00, 0.00, -40.60, 1.70},
-    {0.00, 0.00, 0.00, -40.20, 1.70},
-    {0.00, 0.00, 0.00, -39.80, 1.70},
-    {0.00, 0.00, 0.00, -39.40, 1.70},
-    {0.00, 0.00, 0.00, -39.00, 1.70},
-    {0.00, 0.00, 0.00, -38.60, 1.70},
-    {0.00, 0.00, 0.00, -38.20, 1.70},
-    {0.00, 0.00, 0.00, -37.80, 1.70},
-    {0.00, 0.00, 0.00, -37.40, 1.70},
-    {0.00, 0.00, 0.00, -37.00, 1.70},
-    {0.00, 0.00, 0.00, -36.60, 1.70},
-    {0.00, 0.00, 0.00, -36.20, 1.70},
-    {0.00, 0.00, 0.00, -35.80, 1.70},
-    {0.00, 0.00, 0.00, -35.40, 1.70},
-    {0.00, 0.00, 0.00, -35.00, 1.70},
-    {0.00, 0.00, 0.00, -34.60, 1.70},
-    {0.00, 0.00, 0.00, -34.20, 1.70},
-    {0.00, 0.00, 0.00, -33.80, 1.70},
-    {0.00, 0.00, 0.00, -33.40, 1.70},
-    {0.00, 0.00, 0.00, -33.00, 1.70},
-    {0.00, 0.00, 0.00, -32.60, 1.70},
-    {0.00, 0.00, 0.00, -32.20, 1.70},
-    {0.00, 0.00, 0.00, -31.80, 1.70},
-    {0.00, 0.00, 0.00, -31.40, 1.70},
-    {0.00, 0.00, 0.00, -31.00, 1.70},
-    {0.00, 0.00, 0.00, -30.60, 1.70},
-    {0.00, 0.00, 0.00, -30.20, 1.70},
-    {0.00, 0.00, 0.00, -29.80, 1.70},
-    {0.00, 0.00, 0.00, -29.40, 1.70},
-    {0.00, 0.00, 0.00, -29.00, 1.70},
-    {0.00, 0.00, 0.00, -28.60, 1.70},
-    {0.00, 0.00, 0.00, -28.20, 1.70},
-    {0.00, 0.00, 0.00, -27.80, 1.70},
-    {0.00, 0.00, 0.00, -27.40, 1.70},
-    {0.00, 0.00, 0.00, -27.00, 1.70},
-    {0.00, 0.00, 0.00, -26.60, 1.70},
-    {0.00, 0.00, 0.00, -26.20, 1.70},
-    {0.00, 0.00, 0.00, -25.80, 1.70},
-    {0.00, 0.00, 0.00, -25.40, 1.70},
-    {0.00, 0.00, 0.00, -25.00, 1.70},
-    {0.00, 0.00, 0.00, -24.60, 1.70},
-    {0.00, 0.00, 0.00, -24.20, 1.70},
-    {0.00, 0.00, 0.00, -23.80, 1.70},
-    {0.00, 0.00, 0.00, -23.40, 1.70},
-    {0.00, 0.00, 0.00, -23.00, 1.70},
-    {0.00, 0.00, 0.00, -22.60, 1.70},
-    {0.00, 0.00, 0.00, -22.20, 1.70},
-    {0.00, 0.00, 0.00, -21.80, 1.70},
-    {0.00, 0.00, 0.00, -21.40, 1.70},
-    {0.00, 0.00, 0.00, -21.00, 1.70},
-    {0.00, 0.00, 0.00, -20.60, 1.70},
-    {0.00, 0.00, 0.00, -20.20, 1.70},
-    {0.00, 0.00, 0.00, -19.80, 1.70},
-    {0.00, 0.00, 0.00, -19.40, 1.70},
-    {0.00, 0.00, 0.00, -19.00, 1.70},
-    {0.00, 0.00, 0.00, -18.60, 1.70},
-    {0.00, 0.00, 0.00, -18.20, 1.70},
-    {0.00, 0.00, 0.00, -17.80, 1.70},
-    {0.00, 0.00, 0.00, -17.40, 1.70},
-    {0.00, 0.00, 0.00, -17.00, 1.70},
-    {0.00, 0.00, 0.00, -16.60, 1.70},
-    {0.00, 0.00, 0.00, -16.20, 1.70},
-    {0.00, 0.00, 0.00, -15.80, 1.70},
-    {0.00, 0.00, 0.00, -15.40, 1.70},
-    {0.00, 0.00, 0.00, -15.00, 1.70},
-    {0.00, 0.00, 0.00, -14.60, 1.70},
-    {0.00, 0.00, 0.00, -14.20, 1.70},
-    {0.00, 0.00, 0.00, -13.80, 1.70},
-    {0.00, 0.00, 0.00, -13.40, 1.70},
-    {0.00, 0.00, 0.00, -13.00, 1.70},
-    {0.00, 0.00, 0.00, -12.60, 1.70},
-    {0.00, 0.00, 0.00, -12.20, 1.70},
-    {0.00, 0.00, 0.00, -11.80, 1.70},
-    {0.00, 0.00, 0.00, -11.40, 1.70},
-    {0.00, 0.00, 0.00, -11.00, 1.70},
-    {0.00, 0.00, 0.00, -10.60, 1.70},
-    {0.00, 0.00, 0.00, -10.20, 1.70},
-    {0.00, 0.00, 0.00, -9.80, 1.70},
-    {0.00, 0.00, 0.00, -9.40, 1.70},
-    {0.00, 0.00, 0.00, -9.00, 1.70},
-    {0.00, 0.00, 0.00, -8.60, 1.70},
-    {0.00, 0.00, 0.00, -8.20, 1.70},
-    {0.00, 0.00, 0.00, -7.80, 1.70},
-    {0.00, 0.00, 0.00, -7.40, 1.70},
-    {0.00, 0.00, 0.00, -7.00, 1.70},
-    {0.00, 0.00, 0.00, -6.60, 1.70},
-    {0.00, 0.00, 0.00, -6.20, 1.70},
-    {0.00, 0.00, 0.00, -5.80, 1.70},
-    {0.00, 0.00, 0.00, -5.40, 1.70},
-    {0.00, 0.00, 0.00, -5.00, 1.70},
-    {0.00, 0.00, 0.00, -4.60, 1.70},
-    {0.00, 0.00, 0.00, -4.20, 1.70},
-    {0.00, 0.00, 0.00, -3.80, 1.70},
-    {0.00, 0.00, 0.00, -3.40, 1.70},
-    {0.00, 0.00, 0.00, -3.00, 1.70},
-    {0.00, 0.00, 0.00, -2.60, 1.70},
-    {0.00, 0.00, 0.00, -2.20, 1.70},
-    {0.00, 0.00, 0.00, -1.80, 1.70},
-    {0.00, 0.00, 0.00, -1.40, 1.70},
-    {0.00, 0.00, 0.00, -1.00, 1.70},
-    {0.00, 0.00, 0.00, -0.60, 1.70},
-    {0.00, 0.00, 0.00, -0.20, 1.70},
-    {0.00, 0.00, 0.00, 0.20, 1.70},
-    {0.00, 0.00, 0.00, 0.60, 1.70},
-    {0.00, 0.00, 0.00, 1.00, 1.70},
-    {0.00, 0.00, 0.00, 1.40, 1.70},
-    {0.00, 0.00, 0.00, 1.80, 1.70},
-    {0.00, 0.00, 0.00, 2.20, 1.70},
-    {0.00, 0.00, 0.00, 2.60, 1.70},
-    {0.00, 0.00, 0.00, 3.00, 1.70},
-    {0.00, 0.00, 0.00, 3.40, 1.70},
-    {0.00, 0.00, 0.00, 3.80, 1.70},
-    {0.00, 0.00, 0.00, 4.20, 1.70},
-    {0.00, 0.00, 0.00, 4.60, 1.70},
-    {0.00, 0.00, 0.00, 5.00, 1.70},
-    {0.00, 0.00, 0.00, 5.40, 1.70},
-    {0.00, 0.00, 0.00, 5.80, 1.70},
-    {0.00, 0.00, 0.00, 6.20, 1.70},
-    {0.00, 0.00, 0.00, 6.60, 1.70},
-    {0.00, 0.00, 0.00, 7.00, 1.70},
-    {0.00, 0.00, 0.00, 7.40, 1.70},
-    {0.00, 0.00, 0.00, 7.80, 1.70},
-    {0.00, 0.00, 0.00, 8.20, 1.70},
-    {0.00, 0.00, 0.00, 8.60, 1.70},
-    {0.00, 0.00, 0.00, 9.00, 1.70},
-    {0.00, 0.00, 0.00, 9.40, 1.70},
-    {0.00, 0.00, 0.00, 9.80, 1.70},
-    {0.00, 0.00, 0.00, 10.20, 1.70},
-    {0.00, 0.00, 0.00, 10.60, 1.70},
-    {0.00, 0.00, 0.00, 11.00, 1.70},
-    {0.00, 0.00, 0.00, 11.40, 1.70},
-    {0.00, 0.00, 0.00, 11.80, 1.70},
-    {0.00, 0.00, 0.00, 12.20, 1.70},
-    {0.00, 0.00, 0.00, 12.60, 1.70},
-    {0.00, 0.00, 0.00, 13.00, 1.70},
-    {0.00, 0.00, 0.00, 13.40, 1.70},
-    {0.00, 0.00, 0.00, 13.80, 1.70},
-    {0.00, 0.00, 0.00, 14.20, 1.70},
-    {0.00, 0.00, 0.00, 14.60, 1.70},
-    {0.00, 0.00, 0.00, 15.00, 1.70},
-    {0.00, 0.00, 0.00, 15.40, 1.70},
-    {0.00, 0.00, 0.00, 15.80, 1.70},
-    {0.00, 0.00, 0.00, 16.20, 1.70},
-    {0.00, 0.00, 0.00, 16.60, 1.70},
-    {0.00, 0.00, 0.00, 17.00, 1.70},
-    {0.00, 0.00, 0.00, 17.40, 1.70},
-    {0.00, 0.00, 0.00, 17.80, 1.70},
-    {0.00, 0.00, 0.00, 18.20, 1.70},
-    {0.00, 0.00, 0.00, 18.60, 1.70},
-    {0.00, 0.00, 0.00, 19.00, 1.70},
-    {0.00, 0.00, 0.00, 19.40, 1.70},
-    {0.00, 0.00, 0.00, 19.80, 1.70},
-    {0.00, 0.00, 0.00, 20.20, 1.70},
-    {0.00, 0.00, 0.00, 20.60, 1.70},
-    {0.00, 0.00, 0.00, 21.00, 1.70},
-    {0.00, 0.00, 0.00, 21.40, 1.70},
-    {0.00, 0.00, 0.00, 21.80, 1.70},
-    {0.00, 0.00, 0.00, 22.20, 1.70},
-    {0.00, 0.00, 0.00, 22.60, 1.70},
-    {0.00, 0.00, 0.00, 23.00, 1.70},
-    {0.00, 0.00, 0.00, 23.40, 1.70},
-    {0.00, 0.00, 0.00, 23.80, 1.70},
-    {0.00, 0.00, 0.00, 24.20, 1.70},
-    {0.00, 0.00, 0.00, 24.60, 1.70},
-    {0.00, 0.00, 0.00, 25.00, 1.70},
-    {0.00, 0.00, 0.00, 25.40, 1.70},
-    {0.00, 0.00, 0.00, 25.80, 1.70},
-    {0.00, 0.00, 0.00, 26.20, 1.70},
-    {0.00, 0.00, 0.00, 26.60, 1.70},
-    {0.00, 0.00, 0.00, 27.00, 1.70},
-    {0.00, 0.00, 0.00, 27.40, 1.70},
-    {0.00, 0.00, 0.00, 27.80, 1.70},
-    {0.00, 0.00, 0.00, 28.20, 1.70},
-    {0.00, 0.00, 0.00, 28.60, 1.70},
-    {0.00, 0.00, 0.00, 29.00, 1.70},
-    {0.00, 0.00, 0.00, 29.40, 1.70},
-    {0.00, 0.00, 0.00, 29.80, 1.70},
-    {0.00, 0.00, 0.00, 30.20, 1.70},
-    {0.00, 0.00, 0.00, 30.60, 1.70},
-    {0.00, 0.00, 0.00, 31.00, 1.70},
-    {0.00, 0.00, 0.00, 31.40, 1.70},
-    {0.00, 0.00, 0.00, 31.80, 1.70},
-    {0.00, 0.00, 0.00, 32.20, 1.70},
-    {0.00, 0.00, 0.00, 32.60, 1.70},
-    {0.00, 0.00, 0.00, 33.00, 1.70},
-    {0.00, 0.00, 0.00, 33.40, 1.70},
-    {0.00, 0.00, 0.00, 33.80, 1.70},
-    {0.00, 0.00, 0.00, 34.20, 1.70},
-    {0.00, 0.00, 0.00, 34.60, 1.70},
-    {0.00, 0.00, 0.00, 35.00, 1.70},
-    {0.00, 0.00, 0.00, 35.40, 1.70},
-    {0.00, 0.00, 0.00, 35.80, 1.70},
-    {0.00, 0.00, 0.00, 36.20, 1.70},
-    {0.00, 0.00, 0.00, 36.60, 1.70},
-    {0.00, 0.00, 0.00, 37.00, 1.70},
-    {0.00, 0.00, 0.00, 37.40, 1.70},
-    {0.00, 0.00, 0.00, 37.80, 1.70},
-    {0.00, 0.00, 0.00, 38.20, 1.70},
-    {0.00, 0.00, 0.00, 38.60, 1.70},
-    {0.00, 0.00, 0.00, 39.00, 1.70},
-    {0.00, 0.00, 0.00, 39.40, 1.70},
-    {0.00, 0.00, 0.00, 39.80, 1.70},
-    {0.00, 0.00, 0.00, 40.20, 1.70},
-    {0.00, 0.00, 0.00, 40.60, 1.70},
-    {0.00, 0.00, 0.00, 41.00, 1.70},
-    {0.00, 0.00, 0.00, 41.40, 1.70},
-    {0.00, 0.00, 0.00, 41.80, 1.70},
-    {0.00, 0.00, 0.00, 42.20, 1.70},
-    {0.00, 0.00, 0.00, 42.60, 1.70},
-    {0.00, 0.00, 0.00, 43.00, 1.70},
-    {0.00, 0.00, 0.00, 43.40, 1.70},
-    {0.00, 0.00, 0.00, 43.80, 1.70},
-    {0.00, 0.00, 0.00, 44.20, 1.70},
-    {0.00, 0.00, 0.00, 44.60, 1.70},
-    {0.00, 0.00, 0.00, 45.00, 1.70},
-    {0.00, 0.00, 0.00, 45.40, 1.70},
-    {0.00, 0.00, 0.00, 45.80, 1.70},
-    {0.00, 0.00, 0.00, 46.20, 1.70},
-    {0.00, 0.00, 0.00, 46.60, 1.70},
-    {0.00, 0.00, 0.00, 47.00, 1.70},
-    {0.00, 0.00, 0.00, 47.40, 1.70},
-    {0.00, 0.00, 0.00, 47.80, 1.70},
-    {0.00, 0.00, 0.00, 48.20, 1.70},
-    {0.00, 0.00, 0.00, 48.60, 1.70},
-    {0.00, 0.00, 0.00, 49.00, 1.70},
-    {0.00, 0.00, 0.00, 49.40, 1.70},
-    {0.00, 0.00, 0.00, 49.80, 1.70},
-    {0.00, 0.00, 0.00, 50.20, 1.70},
-    {0.00, 0.00, 0.00, 50.60, 1.70},
-    {0.00, 0.00, 0.00, 51.00, 1.70},
-    {0.00, 0.00, 0.00, 51.40, 1.70},
-    {0.00, 0.00, 0.00, 51.80, 1.70},
-    {0.00, 0.00, 0.00, 52.20, 1.70},
-    {0.00, 0.00, 0.00, 52.60, 1.70},
-    {0.00, 0.00, 0.00, 53.00, 1.70},
-    {0.00, 0.00, 0.00, 53.40, 1.70},
-    {0.00, 0.00, 0.00, 53.80, 1.70},
-    {0.00, 0.00, 0.00, 54.20, 1.70},
-    {0.00, 0.00, 0.00, 54.60, 1.70},
-    {0.00, 0.00, 0.00, 55.00, 1.70},
-    {0.00, 0.00, 0.00, 55.40, 1.70},
-    {0.00, 0.00, 0.00, 55.80, 1.70},
-    {0.00, 0.00, 0.00, 56.20, 1.70},
-    {0.00, 0.00, 0.00, 56.60, 1.70},
-    {0.00, 0.00, 0.00, 57.00, 1.70},
-    {0.00, 0.00, 0.00, 57.40, 1.70},
-    {0.00, 0.00, 0.00, 57.80, 1.70},
-    {0.00, 0.00, 0.00, 58.20, 1.70},
-    {0.00, 0.00, 0.00, 58.60, 1.70},
-    {0.00, 0.00, 0.00, 59.00, 1.70},
-    {0.00, 0.00, 0.00, 59.40, 1.70},
-    {0.00, 0.00, 0.00, 59.80, 1.70},
-    {0.00, 0.00, 0.00, -59.80, 1.90},
-    {0.00, 0.00, 0.00, -59.40, 1.90},
-    {0.00, 0.00, 0.00, -59.00, 1.90},
-    {0.00, 0.00, 0.00, -58.60, 1.90},
-    {0.00, 0.00, 0.00, -58.20, 1.90},
-    {0.00, 0.00, 0.00, -57.80, 1.90},
-    {0.00, 0.00, 0.00, -57.40, 1.90},
-    {0.00, 0.00, 0.00, -57.00, 1.90},
-    {0.00, 0.00, 0.00, -56.60, 1.90},
-    {0.00, 0.00, 0.00, -56.20, 1.90},
-    {0.00, 0.00, 0.00, -55.80, 1.90},
-    {0.00, 0.00, 0.00, -55.40, 1.90},
-    {0.00, 0.00, 0.00, -55.00, 1.90},
-    {0.00, 0.00, 0.00, -54.60, 1.90},
-    {0.00, 0.00, 0.00, -54.20, 1.90},
-    {0.00, 0.00, 0.00, -53.80, 1.90},
-    {0.00, 0.00, 0.00, -53.40, 1.90},
-    {0.00, 0.00, 0.00, -53.00, 1.90},
-    {0.00, 0.00, 0.00, -52.60, 1.90},
-    {0.00, 0.00, 0.00, -52.20, 1.90},
-    {0.00, 0.00, 0.00, -51.80, 1.90},
-    {0.00, 0.00, 0.00, -51.40, 1.90},
-    {0.00, 0.00, 0.00, -51.00, 1.90},
-    {0.00, 0.00, 0.00, -50.60, 1.90},
-    {0.00, 0.00, 0.00, -50.20, 1.90},
-    {0.00, 0.00, 0.00, -49.80, 1.90},
-    {0.00, 0.00, 0.00, -49.40, 1.90},
-    {0.00, 0.00, 0.00, -49.00, 1.90},
-    {0.00, 0.00, 0.00, -48.60, 1.90},
-    {0.00, 0.00, 0.00, -48.20, 1.90},
-    {0.00, 0.00, 0.00, -47.80, 1.90},
-    {0.00, 0.00, 0.00, -47.40, 1.90},
-    {0.00, 0.00, 0.00, -47.00, 1.90},
-    {0.00, 0.00, 0.00, -46.60, 1.90},
-    {0.00, 0.00, 0.00, -46.20, 1.90},
-    {0.00, 0.00, 0.00, -45.80, 1.90},
-    {0.00, 0.00, 0.00, -45.40, 1.90},
-    {0.00, 0.00, 0.00, -45.00, 1.90},
-    {0.00, 0.00, 0.00, -44.60, 1.90},
-    {0.00, 0.00, 0.00, -44.20, 1.90},
-    {0.00, 0.00, 0.00, -43.80, 1.90},
-    {0.00, 0.00, 0.00, -43.40, 1.90},
-    {0.00, 0.00, 0.00, -43.00, 1.90},
-    {0.00, 0.00, 0.00, -42.60, 1.90},
-    {0.00, 0.00, 0.00, -42.20, 1.90},
-    {0.00, 0.00, 0.00, -41.80, 1.90},
-    {0.00, 0.00, 0.00, -41.40, 1.90},
-    {0.00, 0.00, 0.00, -41.00, 1.90},
-    {0.00, 0.00, 0.00, -40.60, 1.90},
-    {0.00, 0.00, 0.00, -40.20, 1.90},
-    {0.00, 0.00, 0.00, -39.80, 1.90},
-    {0.00, 0.00, 0.00, -39.40, 1.90},
-    {0.00, 0.00, 0.00, -39.00, 1.90},
-    {0.00, 0.00, 0.00, -38.60, 1.90},
-    {0.00, 0.00, 0.00, -38.20, 1.90},
-    {0.00, 0.00, 0.00, -37.80, 1.90},
-    {0.00, 0.00, 0.00, -37.40, 1.90},
-    {0.00, 0.00, 0.00, -37.00, 1.90},
-    {0.00, 0.00, 0.00, -36.60, 1.90},
-    {0.00, 0.00, 0.00, -36.20, 1.90},
-    {0.00, 0.00, 0.00, -35.80, 1.90},
-    {0.00, 0.00, 0.00, -35.40, 1.90},
-    {0.00, 0.00, 0.00, -35.00, 1.90},
-    {0.00, 0.00, 0.00, -34.60, 1.90},
-    {0.00, 0.00, 0.00, -34.20, 1.90},
-    {0.00, 0.00, 0.00, -33.80, 1.90},
-    {0.00, 0.00, 0.00, -33.40, 1.90},
-    {0.00, 0.00, 0.00, -33.00, 1.90},
-    {0.00, 0.00, 0.00, -32.60, 1.90},
-    {0.00, 0.00, 0.00, -32.20, 1.90},
-    {0.00, 0.00, 0.00, -31.80, 1.90},
-    {0.00, 0.00, 0.00, -31.40, 1.90},
-    {0.00, 0.00, 0.00, -31.00, 1.90},
-    {0.00, 0.00, 0.00, -30.60, 1.90},
-    {0.00, 0.00, 0.00, -30.20, 1.90},
-    {0.00, 0.00, 0.00, -29.80, 1.90},
-    {0.00, 0.00, 0.00, -29.40, 1.90},
-    {0.00, 0.00, 0.00, -29.00, 1.90},
-    {0.00, 0.00, 0.00, -28.60, 1.90},
-    {0.00, 0.00, 0.00, -28.20, 1.90},
-    {0.00, 0.00, 0.00, -27.80, 1.90},
-    {0.00, 0.00, 0.00, -27.40, 1.90},
-    {0.00, 0.00, 0.00, -27.00, 1.90},
-    {0.00, 0.00, 0.00, -26.60, 1.90},
-    {0.00, 0.00, 0.00, -26.20, 1.90},
-    {0.00, 0.00, 0.00, -25.80, 1.90},
-    {0.00, 0.00, 0.00, -25.40, 1.90},
-    {0.00, 0.00, 0.00, -25.00, 1.90},
-    {0.00, 0.00, 0.00, -24.60, 1.90},
-    {0.00, 0.00, 0.00, -24.20, 1.90},
-    {0.00, 0.00, 0.00, -23.80, 1.90},
-    {0.00, 0.00, 0.00, -23.40, 1.90},
-    {0.00, 0.00, 0.00, -23.00, 1.90},
-    {0.00, 0.00, 0.00, -22.60, 1.90},
-    {0.00, 0.00, 0.00, -22.20, 1.90},
-    {0.00, 0.00, 0.00, -21.80, 1.90},
-    {0.00, 0.00, 0.00, -21.40, 1.90},
-    {0.00, 0.00, 0.00, -21.00, 1.90},
-    {0.00, 0.00, 0.00, -20.60, 1.90},
-    {0.00, 0.00, 0.00, -20.20, 1.90},
-    {0.00, 0.00, 0.00, -19.80, 1.90},
-    {0.00, 0.00, 0.00, -19.40, 1.90},
-    {0.00, 0.00, 0.00, -19.00, 1.90},
-    {0.00, 0.00, 0.00, -18.60, 1.90},
-    {0.00, 0.00, 0.00, -18.20, 1.90},
-    {0.00, 0.00, 0.00, -17.80, 1.90},
-    {0.00, 0.00, 0.00, -17.40, 1.90},
-    {0.00, 0.00, 0.00, -17.00, 1.90},
-    {0.00, 0.00, 0.00, -16.60, 1.90},
-    {0.00, 0.00, 0.00, -16.20, 1.90},
-    {0.00, 0.00, 0.00, -15.80, 1.90},
-    {0.00, 0.00, 0.00, -15.40, 1.90},
-    {0.00, 0.00, 0.00, -15.00, 1.90},
-    {0.00, 0.00, 0.00, -14.60, 1.90},
-    {0.00, 0.00, 0.00, -14.20, 1.90},
-    {0.00, 0.00, 0.00, -13.80, 1.90},
-    {0.00, 0.00, 0.00, -13.40, 1.90},
-    {0.00, 0.00, 0.00, -13.00, 1.90},
-    {0.00, 0.00, 0.00, -12.60, 1.90},
-    {0.00, 0.00, 0.00, -12.20, 1.90},
-    {0.00, 0.00, 0.00, -11.80, 1.90},
-    {0.00, 0.00, 0.00, -11.40, 1.90},
-    {0.00, 0.00, 0.00, -11.00, 1.90},
-    {0.00, 0.00, 0.00, -10.60, 1.90},
-    {0.00, 0.00, 0.00, -10.20, 1.90},
-    {0.00, 0.00, 0.00, -9.80, 1.90},
-    {0.00, 0.00, 0.00, -9.40, 1.90},
-    {0.00, 0.00, 0.00, -9.00, 1.90},
-    {0.00, 0.00, 0.00, -8.60, 1.90},
-    {0.00, 0.00, 0.00, -8.20, 1.90},
-    {0.00, 0.00, 0.00, -7.80, 1.90},
-    {0.00, 0.00, 0.00, -7.40, 1.90},
-    {0.00, 0.00, 0.00, -7.00, 1.90},
-    {0.00, 0.00, 0.00, -6.60, 1.90},
-    {0.00, 0.00, 0.00, -6.20, 1.90},
-    {0.00, 0.00, 0.00, -5.80, 1.90},
-    {0.00, 0.00, 0.00, -5.40, 1.90},
-    {0.00, 0.00, 0.00, -5.00, 1.90},
-    {0.00, 0.00, 0.00, -4.60, 1.90},
-    {0.00, 0.00, 0.00, -4.20, 1.90},
-    {0.00, 0.00, 0.00, -3.80, 1.90},
-    {0.00, 0.00, 0.00, -3.40, 1.90},
-    {0.00, 0.00, 0.00, -3.00, 1.90},
-    {0.00, 0.00, 0.00, -2.60, 1.90},
-    {0.00, 0.00, 0.00, -2.20, 1.90},
-    {0.00, 0.00, 0.00, -1.80, 1.90},
-    {0.00, 0.00, 0.00, -1.40, 1.90},
-    {0.00, 0.00, 0.00, -1.00, 1.90},
-    {0.00, 0.00, 0.00, -0.60, 1.90},
-    {0.00, 0.00, 0.00, -0.20, 1.90},
-    {0.00, 0.00, 0.00, 0.20, 1.90},
-    {0.00, 0.00, 0.00, 0.60, 1.90},
-    {0.00, 0.00, 0.00, 1.00, 1.90},
-    {0.00, 0.00, 0.00, 1.40, 1.90},
-    {0.00, 0.00, 0.00, 1.80, 1.90},
-    {0.00, 0.00, 0.00, 2.20, 1.90},
-    {0.00, 0.00, 0.00, 2.60, 1.90},
-    {0.00, 0.00, 0.00, 3.00, 1.90},
-    {0.00, 0.00, 0.00, 3.40, 1.90},
-    {0.00, 0.00, 0.00, 3.80, 1.90},
-    {0.00, 0.00, 0.00, 4.20, 1.90},
-    {0.00, 0.00, 0.00, 4.60, 1.90},
-    {0.00, 0.00, 0.00, 5.00, 1.90},
-    {0.00, 0.00, 0.00, 5.40, 1.90},
-    {0.00, 0.00, 0.00, 5.80, 1.90},
-    {0.00, 0.00, 0.00, 6.20, 1.90},
-    {0.00, 0.00, 0.00, 6.60, 1.90},
-    {0.00, 0.00, 0.00, 7.00, 1.90},
-    {0.00, 0.00, 0.00, 7.40, 1.90},
-    {0.00, 0.00, 0.00, 7.80, 1.90},
-    {0.00, 0.00, 0.00, 8.20, 1.90},
-    {0.00, 0.00, 0.00, 8.60, 1.90},
-    {0.00, 0.00, 0.00, 9.00, 1.90},
-    {0.00, 0.00, 0.00, 9.40, 1.90},
-    {0.00, 0.00, 0.00, 9.80, 1.90},
-    {0.00, 0.00, 0.00, 10.20, 1.90},
-    {0.00, 0.00, 0.00, 10.60, 1.90},
-    {0.00, 0.00, 0.00, 11.00, 1.90},
-    {0.00, 0.00, 0.00, 11.40, 1.90},
-    {0.00, 0.00, 0.00, 11.80, 1.90},
-    {0.00, 0.00, 0.00, 12.20, 1.90},
-    {0.00, 0.00, 0.00, 12.60, 1.90},
-    {0.00, 0.00, 0.00, 13.00, 1.90},
-    {0.00, 0.00, 0.00, 13.40, 1.90},
-    {0.00, 0.00, 0.00, 13.80, 1.90},
-    {0.00, 0.00, 0.00, 14.20, 1.90},
-    {0.00, 0.00, 0.00, 14.60, 1.90},
-    {0.00, 0.00, 0.00, 15.00, 1.90},
-    {0.00, 0.00, 0.00, 15.40, 1.90},
-    {0.00, 0.00, 0.00, 15.80, 1.90},
-    {0.00, 0.00, 0.00, 16.20, 1.90},
-    {0.00, 0.00, 0.00, 16.60, 1.90},
-    {0.00, 0.00, 0.00, 17.00, 1.90},
-    {0.00, 0.00, 0.00, 17.40, 1.90},
-    {0.00, 0.00, 0.00, 17.80, 1.90},
-    {0.00, 0.00, 0.00, 18.20, 1.90},
-    {0.00, 0.00, 0.00, 18.60, 1.90},
-    {0.00, 0.00, 0.00, 19.00, 1.90},
-    {0.00, 0.00, 0.00, 19.40, 1.90},
-    {0.00, 0.00, 0.00, 19.80, 1.90},
-    {0.00, 0.00, 0.00, 20.20, 1.90},
-    {0.00, 0.00, 0.00, 20.60, 1.90},
-    {0.00, 0.00, 0.00, 21.00, 1.90},
-    {0.00, 0.00, 0.00, 21.40, 1.90},
-    {0.00, 0.00, 0.00, 21.80, 1.90},
-    {0.00, 0.00, 0.00, 22.20, 1.90},
-    {0.00, 0.00, 0.00, 22.60, 1.90},
-    {0.00, 0.00, 0.00, 23.00, 1.90},
-    {0.00, 0.00, 0.00, 23.40, 1.90},
-    {0.00, 0.00, 0.00, 23.80, 1.90},
-    {0.00, 0.00, 0.00, 24.20, 1.90},
-    {0.00, 0.00, 0.00, 24.60, 1.90},
-    {0.00, 0.00, 0.00, 25.00, 1.90},
-    {0.00, 0.00, 0.00, 25.40, 1.90},
-    {0.00, 0.00, 0.00, 25.80, 1.90},
-    {0.00, 0.00, 0.00, 26.20, 1.90},
-    {0.00, 0.00, 0.00, 26.60, 1.90},
-    {0.00, 0.00, 0.00, 27.00, 1.90},
-    {0.00, 0.00, 0.00, 27.40, 1.90},
-    {0.00, 0.00, 0.00, 27.80, 1.90},
-    {0.00, 0.00, 0.00, 28.20, 1.90},
-    {0.00, 0.00, 0.00, 28.60, 1.90},
-    {0.00, 0.00, 0.00, 29.00, 1.90},
-    {0.00, 0.00, 0.00, 29.40, 1.90},
-    {0.00, 0.00, 0.00, 29.80, 1.90},
-    {0.00, 0.00, 0.00, 30.20, 1.90},
-    {0.00, 0.00, 0.00, 30.60, 1.90},
-    {0.00, 0.00, 0.00, 31.00, 1.90},
-    {0.00, 0.00, 0.00, 31.40, 1.90},
-    {0.00, 0.00, 0.00, 31.80, 1.90},
-    {0.00, 0.00, 0.00, 32.20, 1.90},
-    {0.00, 0.00, 0.00, 32.60, 1.90},
-    {0.00, 0.00, 0.00, 33.00, 1.90},
-    {0.00, 0.00, 0.00, 33.40, 1.90},
-    {0.00, 0.00, 0.00, 33.80, 1.90},
-    {0.00, 0.00, 0.00, 34.20, 1.90},
-    {0.00, 0.00, 0.00, 34.60, 1.90},
-    {0.00, 0.00, 0.00, 35.00, 1.90},
-    {0.00, 0.00, 0.00, 35.40, 1.90},
-    {0.00, 0.00, 0.00, 35.80, 1.90},
-    {0.00, 0.00, 0.00, 36.20, 1.90},
-    {0.00, 0.00, 0.00, 36.60, 1.90},
-    {0.00, 0.00, 0.00, 37.00, 1.90},
-    {0.00, 0.00, 0.00, 37.40, 1.90},
-    {0.00, 0.00, 0.00, 37.80, 1.90},
-    {0.00, 0.00, 0.00, 38.20, 1.90},
-    {0.00, 0.00, 0.00, 38.60, 1.90},
-    {0.00, 0.00, 0.00, 39.00, 1.90},
-    {0.00, 0.00, 0.00, 39.40, 1.90},
-    {0.00, 0.00, 0.00, 39.80, 1.90},
-    {0.00, 0.00, 0.00, 40.20, 1.90},
-    {0.00, 0.00, 0.00, 40.60, 1.90},
-    {0.00, 0.00, 0.00, 41.00, 1.90},
-    {0.00, 0.00, 0.00, 41.40, 1.90},
-    {0.00, 0.00, 0.00, 41.80, 1.90},
-    {0.00, 0.00, 0.00, 42.20, 1.90},
-    {0.00, 0.00, 0.00, 42.60, 1.90},
-    {0.00, 0.00, 0.00, 43.00, 1.90},
-    {0.00, 0.00, 0.00, 43.40, 1.90},
-    {0.00, 0.00, 0.00, 43.80, 1.90},
-    {0.00, 0.00, 0.00, 44.20, 1.90},
-    {0.00, 0.00, 0.00, 44.60, 1.90},
-    {0.00, 0.00, 0.00, 45.00, 1.90},
-    {0.00, 0.00, 0.00, 45.40, 1.90},
-    {0.00, 0.00, 0.00, 45.80, 1.90},
-    {0.00, 0.00, 0.00, 46.20, 1.90},
-    {0.00, 0.00, 0.00, 46.60, 1.90},
-    {0.00, 0.00, 0.00, 47.00, 1.90},
-    {0.00, 0.00, 0.00, 47.40, 1.90},
-    {0.00, 0.00, 0.00, 47.80, 1.90},
-    {0.00, 0.00, 0.00, 48.20, 1.90},
-    {0.00, 0.00, 0.00, 48.60, 1.90},
-    {0.00, 0.00, 0.00, 49.00, 1.90},
-    {0.00, 0.00, 0.00, 49.40, 1.90},
-    {0.00, 0.00, 0.00, 49.80, 1.90},
-    {0.00, 0.00, 0.00, 50.20, 1.90},
-    {0.00, 0.00, 0.00, 50.60, 1.90},
-    {0.00, 0.00, 0.00, 51.00, 1.90},
-    {0.00, 0.00, 0.00, 51.40, 1.90},
-    {0.00, 0.00, 0.00, 51.80, 1.90},
-    {0.00, 0.00, 0.00, 52.20, 1.90},
-    {0.00, 0.00, 0.00, 52.60, 1.90},
-    {0.00, 0.00, 0.00, 53.00, 1.90},
-    {0.00, 0.00, 0.00, 53.40, 1.90},
-    {0.00, 0.00, 0.00, 53.80, 1.90},
-    {0.00, 0.00, 0.00, 54.20, 1.90},
-    {0.00, 0.00, 0.00, 54.60, 1.90},
-    {0.00, 0.00, 0.00, 55.00, 1.90},
-    {0.00, 0.00, 0.00, 55.40, 1.90},
-    {0.00, 0.00, 0.00, 55.80, 1.90},
-    {0.00, 0.00, 0.00, 56.20, 1.90},
-    {0.00, 0.00, 0.00, 56.60, 1.90},
-    {0.00, 0.00, 0.00, 57.00, 1.90},
-    {0.00, 0.00, 0.00, 57.40, 1.90},
-    {0.00, 0.00, 0.00, 57.80, 1.90},
-    {0.00, 0.00, 0.00, 58.20, 1.90},
-    {0.00, 0.00, 0.00, 58.60, 1.90},
-    {0.00, 0.00, 0.00, 59.00, 1.90},
-    {0.00, 0.00, 0.00, 59.40, 1.90},
-    {0.00, 0.00, 0.00, 59.80, 1.90},
-    {0.00, 0.00, 0.00, -59.80, 2.10},
-    {0.00, 0.00, 0.00, -59.40, 2.10},
-    {0.00, 0.00, 0.00, -59.00, 2.10},
-    {0.00, 0.00, 0.00, -58.60, 2.10},
-    {0.00, 0.00, 0.00, -58.20, 2.10},
-    {0.00, 0.00, 0.00, -57.80, 2.10},
-    {0.00, 0.00, 0.00, -57.40, 2.10},
-    {0.00, 0.00, 0.00, -57.00, 2.10},
-    {0.00, 0.00, 0.00, -56.60, 2.10},
-    {0.00, 0.00, 0.00, -56.20, 2.10},
-    {0.00, 0.00, 0.00, -55.80, 2.10},
-    {0.00, 0.00, 0.00, -55.40, 2.10},
-    {0.00, 0.00, 0.00, -55.00, 2.10},
-    {0.00, 0.00, 0.00, -54.60, 2.10},
-    {0.00, 0.00, 0.00, -54.20, 2.10},
-    {0.00, 0.00, 0.00, -53.80, 2.10},
-    {0.00, 0.00, 0.00, -53.40, 2.10},
-    {0.00, 0.00, 0.00, -53.00, 2.10},
-    {0.00, 0.00, 0.00, -52.60, 2.10},
-    {0.00, 0.00, 0.00, -52.20, 2.10},
-    {0.00, 0.00, 0.00, -51.80, 2.10},
-    {0.00, 0.00, 0.00, -51.40, 2.10},
-    {0.00, 0.00, 0.00, -51.00, 2.10},
-    {0.00, 0.00, 0.00, -50.60, 2.10},
-    {0.00, 0.00, 0.00, -50.20, 2.10},
-    {0.00, 0.00, 0.00, -49.80, 2.10},
-    {0.00, 0.00, 0.00, -49.40, 2.10},
-    {0.00, 0.00, 0.00, -49.00, 2.10},
-    {0.00, 0.00, 0.00, -48.60, 2.10},
-    {0.00, 0.00, 0.00, -48.20, 2.10},
-    {0.00, 0.00, 0.00, -47.80, 2.10},
-    {0.00, 0.00, 0.00, -47.40, 2.10},
-    {0.00, 0.00, 0.00, -47.00, 2.10},
-    {0.00, 0.00, 0.00, -46.60, 2.10},
-    {0.00, 0.00, 0.00, -46.20, 2.10},
-    {0.00, 0.00, 0.00, -45.80, 2.10},
-    {0.00, 0.00, 0.00, -45.40, 2.10},
-    {0.00, 0.00, 0.00, -45.00, 2.10},
-    {0.00, 0.00, 0.00, -44.60, 2.10},
-    {0.00, 0.00, 0.00, -44.20, 2.10},
-    {0.00, 0.00, 0.00, -43.80, 2.10},
-    {0.00, 0.00, 0.00, -43.40, 2.10},
-    {0.00, 0.00, 0.00, -43.00, 2.10},
-    {0.00, 0.00, 0.00, -42.60, 2.10},
-    {0.00, 0.00, 0.00, -42.20, 2.10},
-    {0.00, 0.00, 0.00, -41.80, 2.10},
-    {0.00, 0.00, 0.00, -41.40, 2.10},
-    {0.00, 0.00, 0.00, -41.00, 2.10},
-    {0.00, 0.00, 0.00, -40.60, 2.10},
-    {0.00, 0.00, 0.00, -40.20, 2.10},
-    {0.00, 0.00, 0.00, -39.80, 2.10},
-    {0.00, 0.00, 0.00, -39.40, 2.10},
-    {0.00, 0.00, 0.00, -39.00, 2.10},
-    {0.00, 0.00, 0.00, -38.60, 2.10},
-    {0.00, 0.00, 0.00, -38.20, 2.10},
-    {0.00, 0.00, 0.00, -37.80, 2.10},
-    {0.00, 0.00, 0.00, -37.40, 2.10},
-    {0.00, 0.00, 0.00, -37.00, 2.10},
-    {0.00, 0.00, 0.00, -36.60, 2.10},
-    {0.00, 0.00, 0.00, -36.20, 2.10},
-    {0.00, 0.00, 0.00, -35.80, 2.10},
-    {0.00, 0.00, 0.00, -35.40, 2.10},
-    {0.00, 0.00, 0.00, -35.00, 2.10},
-    {0.00, 0.00, 0.00, -34.60, 2.10},
-    {0.00, 0.00, 0.00, -34.20, 2.10},
-    {0.00, 0.00, 0.00, -33.80, 2.10},
-    {0.00, 0.00, 0.00, -33.40, 2.10},
-    {0.00, 0.00, 0.00, -33.00, 2.10},
-    {0.00, 0.00, 0.00, -32.60, 2.10},
-    {0.00, 0.00, 0.00, -32.20, 2.10},
-    {0.00, 0.00, 0.00, -31.80, 2.10},
-    {0.00, 0.00, 0.00, -31.40, 2.10},
-    {0.00, 0.00, 0.00, -31.00, 2.10},
-    {0.00, 0.00, 0.00, -30.60, 2.10},
-    {0.00, 0.00, 0.00, -30.20, 2.10},
-    {0.00, 0.00, 0.00, -29.80, 2.10},
-    {0.00, 0.00, 0.00, -29.40, 2.10},
-    {0.00, 0.00, 0.00, -29.00, 2.10},
-    {0.00, 0.00, 0.00, -28.60, 2.10},
-    {0.00, 0.00, 0.00, -28.20, 2.10},
-    {0.00, 0.00, 0.00, -27.80, 2.10},
-    {0.00, 0.00, 0.00, -27.40, 2.10},
-    {0.00, 0.00, 0.00, -27.00, 2.10},
-    {0.00, 0.00, 0.00, -26.60, 2.10},
-    {0.00, 0.00, 0.00, -26.20, 2.10},
-    {0.00, 0.00, 0.00, -25.80, 2.10},
-    {0.00, 0.00, 0.00, -25.40, 2.10},
-    {0.00, 0.00, 0.00, -25.00, 2.10},
-    {0.00, 0.00, 0.00, -24.60, 2.10},
-    {0.00, 0.00, 0.00, -24.20, 2.10},
-    {0.00, 0.00, 0.00, -23.80, 2.10},
-    {0.00, 0.00, 0.00, -23.40, 2.10},
-    {0.00, 0.00, 0.00, -23.00, 2.10},
-    {0.00, 0.00, 0.00, -22.60, 2.10},
-    {0.00, 0.00, 0.00, -22.20, 2.10},
-    {0.00, 0.00, 0.00, -21.80, 2.10},
-    {0.00, 0.00, 0.00, -21.40, 2.10},
-    {0.00, 0.00, 0.00, -21.00, 2.10},
-    {0.00, 0.00, 0.00, -20.60, 2.10},
-    {0.00, 0.00, 0.00, -20.20, 2.10},
-    {0.00, 0.00, 0.00, -19.80, 2.10},
-    {0.00, 0.00, 0.00, -19.40, 2.10},
-    {0.00, 0.00, 0.00, -19.00, 2.10},
-    {0.00, 0.00, 0.00, -18.60, 2.10},
-    {0.00, 0.00, 0.00, -18.20, 2.10},
-    {0.00, 0.00, 0.00, -17.80, 2.10},
-    {0.00, 0.00, 0.00, -17.40, 2.10},
-    {0.00, 0.00, 0.00, -17.00, 2.10},
-    {0.00, 0.00, 0.00, -16.60, 2.10},
-    {0.00, 0.00, 0.00, -16.20, 2.10},
-    {0.00, 0.00, 0.00, -15.80, 2.10},
-    {0.00, 0.00, 0.00, -15.40, 2.10},
-    {0.00, 0.00, 0.00, -15.00, 2.10},
-    {0.00, 0.00, 0.00, -14.60, 2.10},
-    {0.00, 0.00, 0.00, -14.20, 2.10},
-    {0.00, 0.00, 0.00, -13.80, 2.10},
-    {0.00, 0.00, 0.00, -13.40, 2.10},
-    {0.00, 0.00, 0.00, -13.00, 2.10},
-    {0.00, 0.00, 0.00, -12.60, 2.10},
-    {0.00, 0.00, 0.00, -12.20, 2.10},
-    {0.00, 0.00, 0.00, -11.80, 2.10},
-    {0.00, 0.00, 0.00, -11.40, 2.10},
-    {0.00, 0.00, 0.00, -11.00, 2.10},
-    {0.00, 0.00, 0.00, -10.60, 2.10},
-    {0.00, 0.00, 0.00, -10.20, 2.10},
-    {0.00, 0.00, 0.00, -9.80, 2.10},
-    {0.00, 0.00, 0.00, -9.40, 2.10},
-    {0.00, 0.00, 0.00, -9.00, 2.10},
-    {0.00, 0.00, 0.00, -8.60, 2.10},
-    {0.00, 0.00, 0.00, -8.20, 2.10},
-    {0.00, 0.00, 0.00, -7.80, 2.10},
-    {0.00, 0.00, 0.00, -7.40, 2.10},
-    {0.00, 0.00, 0.00, -7.00, 2.10},
-    {0.00, 0.00, 0.00, -6.60, 2.10},
-    {0.00, 0.00, 0.00, -6.20, 2.10},
-    {0.00, 0.00, 0.00, -5.80, 2.10},
-    {0.00, 0.00, 0.00, -5.40, 2.10},
-    {0.00, 0.00, 0.00, -5.00, 2.10},
-    {0.00, 0.00, 0.00, -4.60, 2.10},
-    {0.00, 0.00, 0.00, -4.20, 2.10},
-    {0.00, 0.00, 0.00, -3.80, 2.10},
-    {0.00, 0.00, 0.00, -3.40, 2.10},
-    {0.00, 0.00, 0.00, -3.00, 2.10},
-    {0.00, 0.00, 0.00, -2.60, 2.10},
-    {0.00, 0.00, 0.00, -2.20, 2.10},
-    {0.00, 0.00, 0.00, -1.80, 2.10},
-    {0.00, 0.00, 0.00, -1.40, 2.10},
-    {0.00, 0.00, 0.00, -1.00, 2.10},
-    {0.00, 0.00, 0.00, -0.60, 2.10},
-    {0.00, 0.00, 0.00, -0.20, 2.10},
-    {0.00, 0.00, 0.00, 0.20, 2.10},
-    {0.00, 0.00, 0.00, 0.60, 2.10},
-    {0.00, 0.00, 0.00, 1.00, 2.10},
-    {0.00, 0.00, 0.00, 1.40, 2.10},
-    {0.00, 0.00, 0.00, 1.80, 2.10},
-    {0.00, 0.00, 0.00, 2.20, 2.10},
-    {0.00, 0.00, 0.00, 2.60, 2.10},
-    {0.00, 0.00, 0.00, 3.00, 2.10},
-    {0.00, 0.00, 0.00, 3.40, 2.10},
-    {0.00, 0.00, 0.00, 3.80, 2.10},
-    {0.00, 0.00, 0.00, 4.20, 2.10},
-    {0.00, 0.00, 0.00, 4.60, 2.10},
-    {0.00, 0.00, 0.00, 5.00, 2.10},
-    {0.00, 0.00, 0.00, 5.40, 2.10},
-    {0.00, 0.00, 0.00, 5.80, 2.10},
-    {0.00, 0.00, 0.00, 6.20, 2.10},
-    {0.00, 0.00, 0.00, 6.60, 2.10},
-    {0.00, 0.00, 0.00, 7.00, 2.10},
-    {0.00, 0.00, 0.00, 7.40, 2.10},
-    {0.00, 0.00, 0.00, 7.80, 2.10},
-    {0.00, 0.00, 0.00, 8.20, 2.10},
-    {0.00, 0.00, 0.00, 8.60, 2.10},
-    {0.00, 0.00, 0.00, 9.00, 2.10},
-    {0.00, 0.00, 0.00, 9.40, 2.10},
-    {0.00, 0.00, 0.00, 9.80, 2.10},
-    {0.00, 0.00, 0.00, 10.20, 2.10},
-    {0.00, 0.00, 0.00, 10.60, 2.10},
-    {0.00, 0.00, 0.00, 11.00, 2.10},
-    {0.00, 0.00, 0.00, 11.40, 2.10},
-    {0.00, 0.00, 0.00, 11.80, 2.10},
-    {0.00, 0.00, 0.00, 12.20, 2.10},
-    {0.00, 0.00, 0.00, 12.60, 2.10},
-    {0.00, 0.00, 0.00, 13.00, 2.10},
-    {0.00, 0.00, 0.00, 13.40, 2.10},
-    {0.00, 0.00, 0.00, 13.80, 2.10},
-    {0.00, 0.00, 0.00, 14.20, 2.10},
-    {0.00, 0.00, 0.00, 14.60, 2.10},
-    {0.00, 0.00, 0.00, 15.00, 2.10},
-    {0.00, 0.00, 0.00, 15.40, 2.10},
-    {0.00, 0.00, 0.00, 15.80, 2.10},
-    {0.00, 0.00, 0.00, 16.20, 2.10},
-    {0.00, 0.00, 0.00, 16.60, 2.10},
-    {0.00, 0.00, 0.00, 17.00, 2.10},
-    {0.00, 0.00, 0.00, 17.40, 2.10},
-    {0.00, 0.00, 0.00, 17.80, 2.10},
-    {0.00, 0.00, 0.00, 18.20, 2.10},
-    {0.00, 0.00, 0.00, 18.60, 2.10},
-    {0.00, 0.00, 0.00, 19.00, 2.10},
-    {0.00, 0.00, 0.00, 19.40, 2.10},
-    {0.00, 0.00, 0.00, 19.80, 2.10},
-    {0.00, 0.00, 0.00, 20.20, 2.10},
-    {0.00, 0.00, 0.00, 20.60, 2.10},
-    {0.00, 0.00, 0.00, 21.00, 2.10},
-    {0.00, 0.00, 0.00, 21.40, 2.10},
-    {0.00, 0.00, 0.00, 21.80, 2.10},
-    {0.00, 0.00, 0.00, 22.20, 2.10},
-    {0.00, 0.00, 0.00, 22.60, 2.10},
-    {0.00, 0.00, 0.00, 23.00, 2.10},
-    {0.00, 0.00, 0.00, 23.40, 2.10},
-    {0.00, 0.00, 0.00, 23.80, 2.10},
-    {0.00, 0.00, 0.00, 24.20, 2.10},
-    {0.00, 0.00, 0.00, 24.60, 2.10},
-    {0.00, 0.00, 0.00, 25.00, 2.10},
-    {0.00, 0.00, 0.00, 25.40, 2.10},
-    {0.00, 0.00, 0.00, 25.80, 2.10},
-    {0.00, 0.00, 0.00, 26.20, 2.10},
-    {0.00, 0.00, 0.00, 26.60, 2.10},
-    {0.00, 0.00, 0.00, 27.00, 2.10},
-    {0.00, 0.00, 0.00, 27.40, 2.10},
-    {0.00, 0.00, 0.00, 27.80, 2.10},
-    {0.00, 0.00, 0.00, 28.20, 2.10},
-    {0.00, 0.00, 0.00, 28.60, 2.10},
-    {0.00, 0.00, 0.00, 29.00, 2.10},
-    {0.00, 0.00, 0.00, 29.40, 2.10},
-    {0.00, 0.00, 0.00, 29.80, 2.10},
-    {0.00, 0.00, 0.00, 30.20, 2.10},
-    {0.00, 0.00, 0.00, 30.60, 2.10},
-    {0.00, 0.00, 0.00, 31.00, 2.10},
-    {0.00, 0.00, 0.00, 31.40, 2.10},
-    {0.00, 0.00, 0.00, 31.80, 2.10},
-    {0.00, 0.00, 0.00, 32.20, 2.10},
-    {0.00, 0.00, 0.00, 32.60, 2.10},
-    {0.00, 0.00, 0.00, 33.00, 2.10},
-    {0.00, 0.00, 0.00, 33.40, 2.10},
-    {0.00, 0.00, 0.00, 33.80, 2.10},
-    {0.00, 0.00, 0.00, 34.20, 2.10},
-    {0.00, 0.00, 0.00, 34.60, 2.10},
-    {0.00, 0.00, 0.00, 35.00, 2.10},
-    {0.00, 0.00, 0.00, 35.40, 2.10},
-    {0.00, 0.00, 0.00, 35.80, 2.10},
-    {0.00, 0.00, 0.00, 36.20, 2.10},
-    {0.00, 0.00, 0.00, 36.60, 2.10},
-    {0.00, 0.00, 0.00, 37.00, 2.10},
-    {0.00, 0.00, 0.00, 37.40, 2.10},
-    {0.00, 0.00, 0.00, 37.80, 2.10},
-    {0.00, 0.00, 0.00, 38.20, 2.10},
-    {0.00, 0.00, 0.00, 38.60, 2.10},
-    {0.00, 0.00, 0.00, 39.00, 2.10},
-    {0.00, 0.00, 0.00, 39.40, 2.10},
-    {0.00, 0.00, 0.00, 39.80, 2.10},
-    {0.00, 0.00, 0.00, 40.20, 2.10},
-    {0.00, 0.00, 0.00, 40.60, 2.10},
-    {0.00, 0.00, 0.00, 41.00, 2.10},
-    {0.00, 0.00, 0.00, 41.40, 2.10},
-    {0.00, 0.00, 0.00, 41.80, 2.10},
-    {0.00, 0.00, 0.00, 42.20, 2.10},
-    {0.00, 0.00, 0.00, 42.60, 2.10},
-    {0.00, 0.00, 0.00, 43.00, 2.10},
-    {0.00, 0.00, 0.00, 43.40, 2.10},
-    {0.00, 0.00, 0.00, 43.80, 2.10},
-    {0.00, 0.00, 0.00, 44.20, 2.10},
-    {0.00, 0.00, 0.00, 44.60, 2.10},
-    {0.00, 0.00, 0.00, 45.00, 2.10},
-    {0.00, 0.00, 0.00, 45.40, 2.10},
-    {0.00, 0.00, 0.00, 45.80, 2.10},
-    {0.00, 0.00, 0.00, 46.20, 2.10},
-    {0.00, 0.00, 0.00, 46.60, 2.10},
-    {0.00, 0.00, 0.00, 47.00, 2.10},
-    {0.00, 0.00, 0.00, 47.40, 2.10},
-    {0.00, 0.00, 0.00, 47.80, 2.10},
-    {0.00, 0.00, 0.00, 48.20, 2.10},
-    {0.00, 0.00, 0.00, 48.60, 2.10},
-    {0.00, 0.00, 0.00, 49.00, 2.10},
-    {0.00, 0.00, 0.00, 49.40, 2.10},
-    {0.00, 0.00, 0.00, 49.80, 2.10},
-    {0.00, 0.00, 0.00, 50.20, 2.10},
-    {0.00, 0.00, 0.00, 50.60, 2.10},
-    {0.00, 0.00, 0.00, 51.00, 2.10},
-    {0.00, 0.00, 0.00, 51.40, 2.10},
-    {0.00, 0.00, 0.00, 51.80, 2.10},
-    {0.00, 0.00, 0.00, 52.20, 2.10},
-    {0.00, 0.00, 0.00, 52.60, 2.10},
-    {0.00, 0.00, 0.00, 53.00, 2.10},
-    {0.00, 0.00, 0.00, 53.40, 2.10},
-    {0.00, 0.00, 0.00, 53.80, 2.10},
-    {0.00, 0.00, 0.00, 54.20, 2.10},
-    {0.00, 0.00, 0.00, 54.60, 2.10},
-    {0.00, 0.00, 0.00, 55.00, 2.10},
-    {0.00, 0.00, 0.00, 55.40, 2.10},
-    {0.00, 0.00, 0.00, 55.80, 2.10},
-    {0.00, 0.00, 0.00, 56.20, 2.10},
-    {0.00, 0.00, 0.00, 56.60, 2.10},
-    {0.00, 0.00, 0.00, 57.00, 2.10},
-    {0.00, 0.00, 0.00, 57.40, 2.10},
-    {0.00, 0.00, 0.00, 57.80, 2.10},
-    {0.00, 0.00, 0.00, 58.20, 2.10},
-    {0.00, 0.00, 0.00, 58.60, 2.10},
-    {0.00, 0.00, 0.00, 59.00, 2.10},
-    {0.00, 0.00, 0.00, 59.40, 2.10},
-    {0.00, 0.00, 0.00, 59.80, 2.10},
-    {0.00, 0.00, 0.00, -59.80, 2.30},
-    {0.00, 0.00, 0.00, -59.40, 2.30},
-    {0.00, 0.00, 0.00, -59.00, 2.30},
-    {0.00, 0.00, 0.00, -58.60, 2.30},
-    {0.00, 0.00, 0.00, -58.20, 2.30},
-    {0.00, 0.00, 0.00, -57.80, 2.30},
-    {0.00, 0.00, 0.00, -57.40, 2.30},
-    {0.00, 0.00, 0.00, -57.00, 2.30},
-    {0.00, 0.00, 0.00, -56.60, 2.30},
-    {0.00, 0.00, 0.00, -56.20, 2.30},
-    {0.00, 0.00, 0.00, -55.80, 2.30},
-    {0.00, 0.00, 0.00, -55.40, 2.30},
-    {0.00, 0.00, 0.00, -55.00, 2.30},
-    {0.00, 0.00, 0.00, -54.60, 2.30},
-    {0.00, 0.00, 0.00, -54.20, 2.30},
-    {0.00, 0.00, 0.00, -53.80, 2.30},
-    {0.00, 0.00, 0.00, -53.40, 2.30},
-    {0.00, 0.00, 0.00, -53.00, 2.30},
-    {0.00, 0.00, 0.00, -52.60, 2.30},
-    {0.00, 0.00, 0.00, -52.20, 2.30},
-    {0.00, 0.00, 0.00, -51.80, 2.30},
-    {0.00, 0.00, 0.00, -51.40, 2.30},
-    {0.00, 0.00, 0.00, -51.00, 2.30},
-    {0.00, 0.00, 0.00, -50.60, 2.30},
-    {0.00, 0.00, 0.00, -50.20, 2.30},
-    {0.00, 0.00, 0.00, -49.80, 2.30},
-    {0.00, 0.00, 0.00, -49.40, 2.30},
-    {0.00, 0.00, 0.00, -49.00, 2.30},
-    {0.00, 0.00, 0.00, -48.60, 2.30},
-    {0.00, 0.00, 0.00, -48.20, 2.30},
-    {0.00, 0.00, 0.00, -47.80, 2.30},
-    {0.00, 0.00, 0.00, -47.40, 2.30},
-    {0.00, 0.00, 0.00, -47.00, 2.30},
-    {0.00, 0.00, 0.00, -46.60, 2.30},
-    {0.00, 0.00, 0.00, -46.20, 2.30},
-    {0.00, 0.00, 0.00, -45.80, 2.30},
-    {0.00, 0.00, 0.00, -45.40, 2.30},
-    {0.00, 0.00, 0.00, -45.00, 2.30},
-    {0.00, 0.00, 0.00, -44.60, 2.30},
-    {0.00, 0.00, 0.00, -44.20, 2.30},
-    {0.00, 0.00, 0.00, -43.80, 2.30},
-    {0.00, 0.00, 0.00, -43.40, 2.30},
-    {0.00, 0.00, 0.00, -43.00, 2.30},
-    {0.00, 0.00, 0.00, -42.60, 2.30},
-    {0.00, 0.00, 0.00, -42.20, 2.30},
-    {0.00, 0.00, 0.00, -41.80, 2.30},
-    {0.00, 0.00, 0.00, -41.40, 2.30},
-    {0.00, 0.00, 0.00, -41.00, 2.30},
-    {0.00, 0.00, 0.00, -40.60, 2.30},
-    {0.00, 0.00, 0.00, -40.20, 2.30},
-    {0.00, 0.00, 0.00, -39.80, 2.30},
-    {0.00, 0.00, 0.00, -39.40, 2.30},
-    {0.00, 0.00, 0.00, -39.00, 2.30},
-    {0.00, 0.00, 0.00, -38.60, 2.30},
-    {0.00, 0.00, 0.00, -38.20, 2.30},
-    {0.00, 0.00, 0.00, -37.80, 2.30},
-    {0.00, 0.00, 0.00, -37.40, 2.30},
-    {0.00, 0.00, 0.00, -37.00, 2.30},
-    {0.00, 0.00, 0.00, -36.60, 2.30},
-    {0.00, 0.00, 0.00, -36.20, 2.30},
-    {0.00, 0.00, 0.00, -35.80, 2.30},
-    {0.00, 0.00, 0.00, -35.40, 2.30},
-    {0.00, 0.00, 0.00, -35.00, 2.30},
-    {0.00, 0.00, 0.00, -34.60, 2.30},
-    {0.00, 0.00, 0.00, -34.20, 2.30},
-    {0.00, 0.00, 0.00, -33.80, 2.30},
-    {0.00, 0.00, 0.00, -33.40, 2.30},
-    {0.00, 0.00, 0.00, -33.00, 2.30},
-    {0.00, 0.00, 0.00, -32.60, 2.30},
-    {0.00, 0.00, 0.00, -32.20, 2.30},
-    {0.00, 0.00, 0.00, -31.80, 2.30},
-    {0.00, 0.00, 0.00, -31.40, 2.30},
-    {0.00, 0.00, 0.00, -31.00, 2.30},
-    {0.00, 0.00, 0.00, -30.60, 2.30},
-    {0.00, 0.00, 0.00, -30.20, 2.30},
-    {0.00, 0.00, 0.00, -29.80, 2.30},
-    {0.00, 0.00, 0.00, -29.40, 2.30},
-    {0.00, 0.00, 0.00, -29.00, 2.30},
-    {0.00, 0.00, 0.00, -28.60, 2.30},
-    {0.00, 0.00, 0.00, -28.20, 2.30},
-    {0.00, 0.00, 0.00, -27.80, 2.30},
-    {0.00, 0.00, 0.00, -27.40, 2.30},
-    {0.00, 0.00, 0.00, -27.00, 2.30},
-    {0.00, 0.00, 0.00, -26.60, 2.30},
-    {0.00, 0.00, 0.00, -26.20, 2.30},
-    {0.00, 0.00, 0.00, -25.80, 2.30},
-    {0.00, 0.00, 0.00, -25.40, 2.30},
-    {0.00, 0.00, 0.00, -25.00, 2.30},
-    {0.00, 0.00, 0.00, -24.60, 2.30},
-    {0.00, 0.00, 0.00, -24.20, 2.30},
-    {0.00, 0.00, 0.00, -23.80, 2.30},
-    {0.00, 0.00, 0.00, -23.40, 2.30},
-    {0.00, 0.00, 0.00, -23.00, 2.30},
-    {0.00, 0.00, 0.00, -22.60, 2.30},
-    {0.00, 0.00, 0.00, -22.20, 2.30},
-    {0.00, 0.00, 0.00, -21.80, 2.30},
-    {0.00, 0.00, 0.00, -21.40, 2.30},
-    {0.00, 0.00, 0.00, -21.00, 2.30},
-    {0.00, 0.00, 0.00, -20.60, 2.30},
-    {0.00, 0.00, 0.00, -20.20, 2.30},
-    {0.00, 0.00, 0.00, -19.80, 2.30},
-    {0.00, 0.00, 0.00, -19.40, 2.30},
-    {0.00, 0.00, 0.00, -19.00, 2.30},
-    {0.00, 0.00, 0.00, -18.60, 2.30},
-    {0.00, 0.00, 0.00, -18.20, 2.30},
-    {0.00, 0.00, 0.00, -17.80, 2.30},
-    {0.00, 0.00, 0.00, -17.40, 2.30},
-    {0.00, 0.00, 0.00, -17.00, 2.30},
-    {0.00, 0.00, 0.00, -16.60, 2.30},
-    {0.00, 0.00, 0.00, -16.20, 2.30},
-    {0.00, 0.00, 0.00, -15.80, 2.30},
-    {0.00, 0.00, 0.00, -15.40, 2.30},
-    {0.00, 0.00, 0.00, -15.00, 2.30},
-    {0.00, 0.00, 0.00, -14.60, 2.30},
-    {0.00, 0.00, 0.00, -14.20, 2.30},
-    {0.00, 0.00, 0.00, -13.80, 2.30},
-    {0.00, 0.00, 0.00, -13.40, 2.30},
-    {0.00, 0.00, 0.00, -13.00, 2.30},
-    {0.00, 0.00, 0.00, -12.60, 2.30},
-    {0.00, 0.00, 0.00, -12.20, 2.30},
-    {0.00, 0.00, 0.00, -11.80, 2.30},
-    {0.00, 0.00, 0.00, -11.40, 2.30},
-    {0.00, 0.00, 0.00, -11.00, 2.30},
-    {0.00, 0.00, 0.00, -10.60, 2.30},
-    {0.00, 0.00, 0.00, -10.20, 2.30},
-    {0.00, 0.00, 0.00, -9.80, 2.30},
-    {0.00, 0.00, 0.00, -9.40, 2.30},
-    {0.00, 0.00, 0.00, -9.00, 2.30},
-    {0.00, 0.00, 0.00, -8.60, 2.30},
-    {0.00, 0.00, 0.00, -8.20, 2.30},
-    {0.00, 0.00, 0.00, -7.80, 2.30},
-    {0.00, 0.00, 0.00, -7.40, 2.30},
-    {0.00, 0.00, 0.00, -7.00, 2.30},
-    {0.00, 0.00, 0.00, -6.60, 2.30},
-    {0.00, 0.00, 0.00, -6.20, 2.30},
-    {0.00, 0.00, 0.00, -5.80, 2.30},
-    {0.00, 0.00, 0.00, -5.40, 2.30},
-    {0.00, 0.00, 0.00, -5.00, 2.30},
-    {0.00, 0.00, 0.00, -4.60, 2.30},
-    {0.00, 0.00, 0.00, -4.20, 2.30},
-    {0.00, 0.00, 0.00, -3.80, 2.30},
-    {0.00, 0.00, 0.00, -3.40, 2.30},
-    {0.00, 0.00, 0.00, -3.00, 2.30},
-    {0.00, 0.00, 0.00, -2.60, 2.30},
-    {0.00, 0.00, 0.00, -2.20, 2.30},
-    {0.00, 0.00, 0.00, -1.80, 2.30},
-    {0.00, 0.00, 0.00, -1.40, 2.30},
-    {0.00, 0.00, 0.00, -1.00, 2.30},
-    {0.00, 0.00, 0.00, -0.60, 2.30},
-    {0.00, 0.00, 0.00, -0.20, 2.30},
-    {0.00, 0.00, 0.00, 0.20, 2.30},
-    {0.00, 0.00, 0.00, 0.60, 2.30},
-    {0.00, 0.00, 0.00, 1.00, 2.30},
-    {0.00, 0.00, 0.00, 1.40, 2.30},
-    {0.00, 0.00, 0.00, 1.80, 2.30},
-    {0.00, 0.00, 0.00, 2.20, 2.30},
-    {0.00, 0.00, 0.00, 2.60, 2.30},
-    {0.00, 0.00, 0.00, 3.00, 2.30},
-    {0.00, 0.00, 0.00, 3.40, 2.30},
-    {0.00, 0.00, 0.00, 3.80, 2.30},
-    {0.00, 0.00, 0.00, 4.20, 2.30},
-    {0.00, 0.00, 0.00, 4.60, 2.30},
-    {0.00, 0.00, 0.00, 5.00, 2.30},
-    {0.00, 0.00, 0.00, 5.40, 2.30},
-    {0.00, 0.00, 0.00, 5.80, 2.30},
-    {0.00, 0.00, 0.00, 6.20, 2.30},
-    {0.00, 0.00, 0.00, 6.60, 2.30},
-    {0.00, 0.00, 0.00, 7.00, 2.30},
-    {0.00, 0.00, 0.00, 7.40, 2.30},
-    {0.00, 0.00, 0.00, 7.80, 2.30},
-    {0.00, 0.00, 0.00, 8.20, 2.30},
-    {0.00, 0.00, 0.00, 8.60, 2.30},
-    {0.00, 0.00, 0.00, 9.00, 2.30},
-    {0.00, 0.00, 0.00, 9.40, 2.30},
-    {0.00, 0.00, 0.00, 9.80, 2.30},
-    {0.00, 0.00, 0.00, 10.20, 2.30},
-    {0.00, 0.00, 0.00, 10.60, 2.30},
-    {0.00, 0.00, 0.00, 11.00, 2.30},
-    {0.00, 0.00, 0.00, 11.40, 2.30},
-    {0.00, 0.00, 0.00, 11.80, 2.30},
-    {0.00, 0.00, 0.00, 12.20, 2.30},
-    {0.00, 0.00, 0.00, 12.60, 2.30},
-    {0.00, 0.00, 0.00, 13.00, 2.30},
-    {0.00, 0.00, 0.00, 13.40, 2.30},
-    {0.00, 0.00, 0.00, 13.80, 2.30},
-    {0.00, 0.00, 0.00, 14.20, 2.30},
-    {0.00, 0.00, 0.00, 14.60, 2.30},
-    {0.00, 0.00, 0.00, 15.00, 2.30},
-    {0.00, 0.00, 0.00, 15.40, 2.30},
-    {0.00, 0.00, 0.00, 15.80, 2.30},
-    {0.00, 0.00, 0.00, 16.20, 2.30},
-    {0.00, 0.00, 0.00, 16.60, 2.30},
-    {0.00, 0.00, 0.00, 17.00, 2.30},
-    {0.00, 0.00, 0.00, 17.40, 2.30},
-    {0.00, 0.00, 0.00, 17.80, 2.30},
-    {0.00, 0.00, 0.00, 18.20, 2.30},
-    {0.00, 0.00, 0.00, 18.60, 2.30},
-    {0.00, 0.00, 0.00, 19.00, 2.30},
-    {0.00, 0.00, 0.00, 19.40, 2.30},
-    {0.00, 0.00, 0.00, 19.80, 2.30},
-    {0.00, 0.00, 0.00, 20.20, 2.30},
-    {0.00, 0.00, 0.00, 20.60, 2.30},
-    {0.00, 0.00, 0.00, 21.00, 2.30},
-    {0.00, 0.00, 0.00, 21.40, 2.30},
-    {0.00, 0.00, 0.00, 21.80, 2.30},
-    {0.00, 0.00, 0.00, 22.20, 2.30},
-    {0.00, 0.00, 0.00, 22.60, 2.30},
-    {0.00, 0.00, 0.00, 23.00, 2.30},
-    {0.00, 0.00, 0.00, 23.40, 2.30},
-    {0.00, 0.00, 0.00, 23.80, 2.30},
-    {0.00, 0.00, 0.00, 24.20, 2.30},
-    {0.00, 0.00, 0.00, 24.60, 2.30},
-    {0.00, 0.00, 0.00, 25.00, 2.30},
-    {0.00, 0.00, 0.00, 25.40, 2.30},
-    {0.00, 0.00, 0.00, 25.80, 2.30},
-    {0.00, 0.00, 0.00, 26.20, 2.30},
-    {0.00, 0.00, 0.00, 26.60, 2.30},
-    {0.00, 0.00, 0.00, 27.00, 2.30},
-    {0.00, 0.00, 0.00, 27.40, 2.30},
-    {0.00, 0.00, 0.00, 27.80, 2.30},
-    {0.00, 0.00, 0.00, 28.20, 2.30},
-    {0.00, 0.00, 0.00, 28.60, 2.30},
-    {0.00, 0.00, 0.00, 29.00, 2.30},
-    {0.00, 0.00, 0.00, 29.40, 2.30},
-    {0.00, 0.00, 0.00, 29.80, 2.30},
-    {0.00, 0.00, 0.00, 30.20, 2.30},
-    {0.00, 0.00, 0.00, 30.60, 2.30},
-    {0.00, 0.00, 0.00, 31.00, 2.30},
-    {0.00, 0.00, 0.00, 31.40, 2.30},
-    {0.00, 0.00, 0.00, 31.80, 2.30},
-    {0.00, 0.00, 0.00, 32.20, 2.30},
-    {0.00, 0.00, 0.00, 32.60, 2.30},
-    {0.00, 0.00, 0.00, 33.00, 2.30},
-    {0.00, 0.00, 0.00, 33.40, 2.30},
-    {0.00, 0.00, 0.00, 33.80, 2.30},
-    {0.00, 0.00, 0.00, 34.20, 2.30},
-    {0.00, 0.00, 0.00, 34.60, 2.30},
-    {0.00, 0.00, 0.00, 35.00, 2.30},
-    {0.00, 0.00, 0.00, 35.40, 2.30},
-    {0.00, 0.00, 0.00, 35.80, 2.30},
-    {0.00, 0.00, 0.00, 36.20, 2.30},
-    {0.00, 0.00, 0.00, 36.60, 2.30},
-    {0.00, 0.00, 0.00, 37.00, 2.30},
-    {0.00, 0.00, 0.00, 37.40, 2.30},
-    {0.00, 0.00, 0.00, 37.80, 2.30},
-    {0.00, 0.00, 0.00, 38.20, 2.30},
-    {0.00, 0.00, 0.00, 38.60, 2.30},
-    {0.00, 0.00, 0.00, 39.00, 2.30},
-    {0.00, 0.00, 0.00, 39.40, 2.30},
-    {0.00, 0.00, 0.00, 39.80, 2.30},
-    {0.00, 0.00, 0.00, 40.20, 2.30},
-    {0.00, 0.00, 0.00, 40.60, 2.30},
-    {0.00, 0.00, 0.00, 41.00, 2.30},
-    {0.00, 0.00, 0.00, 41.40, 2.30},
-    {0.00, 0.00, 0.00, 41.80, 2.30},
-    {0.00, 0.00, 0.00, 42.20, 2.30},
-    {0.00, 0.00, 0.00, 42.60, 2.30},
-    {0.00, 0.00, 0.00, 43.00, 2.30},
-    {0.00, 0.00, 0.00, 43.40, 2.30},
-    {0.00, 0.00, 0.00, 43.80, 2.30},
-    {0.00, 0.00, 0.00, 44.20, 2.30},
-    {0.00, 0.00, 0.00, 44.60, 2.30},
-    {0.00, 0.00, 0.00, 45.00, 2.30},
-    {0.00, 0.00, 0.00, 45.40, 2.30},
-    {0.00, 0.00, 0.00, 45.80, 2.30},
-    {0.00, 0.00, 0.00, 46.20, 2.30},
-    {0.00, 0.00, 0.00, 46.60, 2.30},
-    {0.00, 0.00, 0.00, 47.00, 2.30},
-    {0.00, 0.00, 0.00, 47.40, 2.30},
-    {0.00, 0.00, 0.00, 47.80, 2.30},
-    {0.00, 0.00, 0.00, 48.20, 2.30},
-    {0.00, 0.00, 0.00, 48.60, 2.30},
-    {0.00, 0.00, 0.00, 49.00, 2.30},
-    {0.00, 0.00, 0.00, 49.40, 2.30},
-    {0.00, 0.00, 0.00, 49.80, 2.30},
-    {0.00, 0.00, 0.00, 50.20, 2.30},
-    {0.00, 0.00, 0.00, 50.60, 2.30},
-    {0.00, 0.00, 0.00, 51.00, 2.30},
-    {0.00, 0.00, 0.00, 51.40, 2.30},
-    {0.00, 0.00, 0.00, 51.80, 2.30},
-    {0.00, 0.00, 0.00, 52.20, 2.30},
-    {0.00, 0.00, 0.00, 52.60, 2.30},
-    {0.00, 0.00, 0.00, 53.00, 2.30},
-    {0.00, 0.00, 0.00, 53.40, 2.30},
-    {0.00, 0.00, 0.00, 53.80, 2.30},
-    {0.00, 0.00, 0.00, 54.20, 2.30},
-    {0.00, 0.00, 0.00, 54.60, 2.30},
-    {0.00, 0.00, 0.00, 55.00, 2.30},
-    {0.00, 0.00, 0.00, 55.40, 2.30},
-    {0.00, 0.00, 0.00, 55.80, 2.30},
-    {0.00, 0.00, 0.00, 56.20, 2.30},
-    {0.00, 0.00, 0.00, 56.60, 2.30},
-    {0.00, 0.00, 0.00, 57.00, 2.30},
-    {0.00, 0.00, 0.00, 57.40, 2.30},
-    {0.00, 0.00, 0.00, 57.80, 2.30},
-    {0.00, 0.00, 0.00, 58.20, 2.30},
-    {0.00, 0.00, 0.00, 58.60, 2.30},
-    {0.00, 0.00, 0.00, 59.00, 2.30},
-    {0.00, 0.00, 0.00, 59.40, 2.30},
-    {0.00, 0.00, 0.00, 59.80, 2.30},
-    {0.00, 0.00, 0.00, -59.80, 2.50},
-    {0.00, 0.00, 0.00, -59.40, 2.50},
-    {0.00, 0.00, 0.00, -59.00, 2.50},
-    {0.00, 0.00, 0.00, -58.60, 2.50},
-    {0.00, 0.00, 0.00, -58.20, 2.50},
-    {0.00, 0.00, 0.00, -57.80, 2.50},
-    {0.00, 0.00, 0.00, -57.40, 2.50},
-    {0.00, 0.00, 0.00, -57.00, 2.50},
-    {0.00, 0.00, 0.00, -56.60, 2.50},
-    {0.00, 0.00, 0.00, -56.20, 2.50},
-    {0.00, 0.00, 0.00, -55.80, 2.50},
-    {0.00, 0.00, 0.00, -55.40, 2.50},
-    {0.00, 0.00, 0.00, -55.00, 2.50},
-    {0.00, 0.00, 0.00, -54.60, 2.50},
-    {0.00, 0.00, 0.00, -54.20, 2.50},
-    {0.00, 0.00, 0.00, -53.80, 2.50},
-    {0.00, 0.00, 0.00, -53.40, 2.50},
-    {0.00, 0.00, 0.00, -53.00, 2.50},
-    {0.00, 0.00, 0.00, -52.60, 2.50},
-    {0.00, 0.00, 0.00, -52.20, 2.50},
-    {0.00, 0.00, 0.00, -51.80, 2.50},
-    {0.00, 0.00, 0.00, -51.40, 2.50},
-    {0.00, 0.00, 0.00, -51.00, 2.50},
-    {0.00, 0.00, 0.00, -50.60, 2.50},
-    {0.00, 0.00, 0.00, -50.20, 2.50},
-    {0.00, 0.00, 0.00, -49.80, 2.50},
-    {0.00, 0.00, 0.00, -49.40, 2.50},
-    {0.00, 0.00, 0.00, -49.00, 2.50},
-    {0.00, 0.00, 0.00, -48.60, 2.50},
-    {0.00, 0.00, 0.00, -48.20, 2.50},
-    {0.00, 0.00, 0.00, -47.80, 2.50},
-    {0.00, 0.00, 0.00, -47.40, 2.50},
-    {0.00, 0.00, 0.00, -47.00, 2.50},
-    {0.00, 0.00, 0.00, -46.60, 2.50},
-    {0.00, 0.00, 0.00, -46.20, 2.50},
-    {0.00, 0.00, 0.00, -45.80, 2.50},
-    {0.00, 0.00, 0.00, -45.40, 2.50},
-    {0.00, 0.00, 0.00, -45.00, 2.50},
-    {0.00, 0.00, 0.00, -44.60, 2.50},
-    {0.00, 0.00, 0.00, -44.20, 2.50},
-    {0.00, 0.00, 0.00, -43.80, 2.50},
-    {0.00, 0.00, 0.00, -43.40, 2.50},
-    {0.00, 0.00, 0.00, -43.00, 2.50},
-    {0.00, 0.00, 0.00, -42.60, 2.50},
-    {0.00, 0.00, 0.00, -42.20, 2.50},
-    {0.00, 0.00, 0.00, -41.80, 2.50},
-    {0.00, 0.00, 0.00, -41.40, 2.50},
-    {0.00, 0.00, 0.00, -41.00, 2.50},
-    {0.00, 0.00, 0.00, -40.60, 2.50},
-    {0.00, 0.00, 0.00, -40.20, 2.50},
-    {0.00, 0.00, 0.00, -39.80, 2.50},
-    {0.00, 0.00, 0.00, -39.40, 2.50},
-    {0.00, 0.00, 0.00, -39.00, 2.50},
-    {0.00, 0.00, 0.00, -38.60, 2.50},
-    {0.00, 0.00, 0.00, -38.20, 2.50},
-    {0.00, 0.00, 0.00, -37.80, 2.50},
-    {0.00, 0.00, 0.00, -37.40, 2.50},
-    {0.00, 0.00, 0.00, -37.00, 2.50},
-    {0.00, 0.00, 0.00, -36.60, 2.50},
-    {0.00, 0.00, 0.00, -36.20, 2.50},
-    {0.00, 0.00, 0.00, -35.80, 2.50},
-    {0.00, 0.00, 0.00, -35.40, 2.50},
-    {0.00, 0.00, 0.00, -35.00, 2.50},
-    {0.00, 0.00, 0.00, -34.60, 2.50},
-    {0.00, 0.00, 0.00, -34.20, 2.50},
-    {0.00, 0.00, 0.00, -33.80, 2.50},
-    {0.00, 0.00, 0.00, -33.40, 2.50},
-    {0.00, 0.00, 0.00, -33.00, 2.50},
-    {0.00, 0.00, 0.00, -32.60, 2.50},
-    {0.00, 0.00, 0.00, -32.20, 2.50},
-    {0.00, 0.00, 0.00, -31.80, 2.50},
-    {0.00, 0.00, 0.00, -31.40, 2.50},
-    {0.00, 0.00, 0.00, -31.00, 2.50},
-    {0.00, 0.00, 0.00, -30.60, 2.50},
-    {0.00, 0.00, 0.00, -30.20, 2.50},
-    {0.00, 0.00, 0.00, -29.80, 2.50},
-    {0.00, 0.00, 0.00, -29.40, 2.50},
-    {0.00, 0.00, 0.00, -29.00, 2.50},
-    {0.00, 0.00, 0.00, -28.60, 2.50},
-    {0.00, 0.00, 0.00, -28.20, 2.50},
-    {0.00, 0.00, 0.00, -27.80, 2.50},
-    {0.00, 0.00, 0.00, -27.40, 2.50},
-    {0.00, 0.00, 0.00, -27.00, 2.50},
-    {0.00, 0.00, 0.00, -26.60, 2.50},
-    {0.00, 0.00, 0.00, -26.20, 2.50},
-    {0.00, 0.00, 0.00, -25.80, 2.50},
-    {0.00, 0.00, 0.00, -25.40, 2.50},
-    {0.00, 0.00, 0.00, -25.00, 2.50},
-    {0.00, 0.00, 0.00, -24.60, 2.50},
-    {0.00, 0.00, 0.00, -24.20, 2.50},
-    {0.00, 0.00, 0.00, -23.80, 2.50},
-    {0.00, 0.00, 0.00, -23.40, 2.50},
-    {0.00, 0.00, 0.00, -23.00, 2.50},
-    {0.00, 0.00, 0.00, -22.60, 2.50},
-    {0.00, 0.00, 0.00, -22.20, 2.50},
-    {0.00, 0.00, 0.00, -21.80, 2.50},
-    {0.00, 0.00, 0.00, -21.40, 2.50},
-    {0.00, 0.00, 0.00, -21.00, 2.50},
-    {0.00, 0.00, 0.00, -20.60, 2.50},
-    {0.00, 0.00, 0.00, -20.20, 2.50},
-    {0.00, 0.00, 0.00, -19.80, 2.50},
-    {0.00, 0.00, 0.00, -19.40, 2.50},
-    {0.00, 0.00, 0.00, -19.00, 2.50},
-    {0.00, 0.00, 0.00, -18.60, 2.50},
-    {0.00, 0.00, 0.00, -18.20, 2.50},
-    {0.00, 0.00, 0.00, -17.80, 2.50},
-    {0.00, 0.00, 0.00, -17.40, 2.50},
-    {0.00, 0.00, 0.00, -17.00, 2.50},
-    {0.00, 0.00, 0.00, -16.60, 2.50},
-    {0.00, 0.00, 0.00, -16.20, 2.50},
-    {0.00, 0.00, 0.00, -15.80, 2.50},
-    {0.00, 0.00, 0.00, -15.40, 2.50},
-    {0.00, 0.00, 0.00, -15.00, 2.50},
-    {0.00, 0.00, 0.00, -14.60, 2.50},
-    {0.00, 0.00, 0.00, -14.20, 2.50},
-    {0.00, 0.00, 0.00, -13.80, 2.50},
-    {0.00, 0.00, 0.00, -13.40, 2.50},
-    {0.00, 0.00, 0.00, -13.00, 2.50},
-    {0.00, 0.00, 0.00, -12.60, 2.50},
-    {0.00, 0.00, 0.00, -12.20, 2.50},
-    {0.00, 0.00, 0.00, -11.80, 2.50},
-    {0.00, 0.00, 0.00, -11.40, 2.50},
-    {0.00, 0.00, 0.00, -11.00, 2.50},
-    {0.00, 0.00, 0.00, -10.60, 2.50},
-    {0.00, 0.00, 0.00, -10.20, 2.50},
-    {0.00, 0.00, 0.00, -9.80, 2.50},
-    {0.00, 0.00, 0.00, -9.40, 2.50},
-    {0.00, 0.00, 0.00, -9.00, 2.50},
-    {0.00, 0.00, 0.00, -8.60, 2.50},
-    {0.00, 0.00, 0.00, -8.20, 2.50},
-    {0.00, 0.00, 0.00, -7.80, 2.50},
-    {0.00, 0.00, 0.00, -7.40, 2.50},
-    {0.00, 0.00, 0.00, -7.00, 2.50},
-    {0.00, 0.00, 0.00, -6.60, 2.50},
-    {0.00, 0.00, 0.00, -6.20, 2.50},
-    {0.00, 0.00, 0.00, -5.80, 2.50},
-    {0.00, 0.00, 0.00, -5.40, 2.50},
-    {0.00, 0.00, 0.00, -5.00, 2.50},
-    {0.00, 0.00, 0.00, -4.60, 2.50},
-    {0.00, 0.00, 0.00, -4.20, 2.50},
-    {0.00, 0.00, 0.00, -3.80, 2.50},
-    {0.00, 0.00, 0.00, -3.40, 2.50},
-    {0.00, 0.00, 0.00, -3.00, 2.50},
-    {0.00, 0.00, 0.00, -2.60, 2.50},
-    {0.00, 0.00, 0.00, -2.20, 2.50},
-    {0.00, 0.00, 0.00, -1.80, 2.50},
-    {0.00, 0.00, 0.00, -1.40, 2.50},
-    {0.00, 0.00, 0.00, -1.00, 2.50},
-    {0.00, 0.00, 0.00, -0.60, 2.50},
-    {0.00, 0.00, 0.00, -0.20, 2.50},
-    {0.00, 0.00, 0.00, 0.20, 2.50},
-    {0.00, 0.00, 0.00, 0.60, 2.50},
-    {0.00, 0.00, 0.00, 1.00, 2.50},
-    {0.00, 0.00, 0.00, 1.40, 2.50},
-    {0.00, 0.00, 0.00, 1.80, 2.50},
-    {0.00, 0.00, 0.00, 2.20, 2.50},
-    {0.00, 0.00, 0.00, 2.60, 2.50},
-    {0.00, 0.00, 0.00, 3.00, 2.50},
-    {0.00, 0.00, 0.00, 3.40, 2.50},
-    {0.00, 0.00, 0.00, 3.80, 2.50},
-    {0.00, 0.00, 0.00, 4.20, 2.50},
-    {0.00, 0.00, 0.00, 4.60, 2.50},
-    {0.00, 0.00, 0.00, 5.00, 2.50},
-    {0.00, 0.00, 0.00, 5.40, 2.50},
-    {0.00, 0.00, 0.00, 5.80, 2.50},
-    {0.00, 0.00, 0.00, 6.20, 2.50},
-    {0.00, 0.00, 0.00, 6.60, 2.50},
-    {0.00, 0.00, 0.00, 7.00, 2.50},
-    {0.00, 0.00, 0.00, 7.40, 2.50},
-    {0.00, 0.00, 0.00, 7.80, 2.50},
-    {0.00, 0.00, 0.00, 8.20, 2.50},
-    {0.00, 0.00, 0.00, 8.60, 2.50},
-    {0.00, 0.00, 0.00, 9.00, 2.50},
-    {0.00, 0.00, 0.00, 9.40, 2.50},
-    {0.00, 0.00, 0.00, 9.80, 2.50},
-    {0.00, 0.00, 0.00, 10.20, 2.50},
-    {0.00, 0.00, 0.00, 10.60, 2.50},
-    {0.00, 0.00, 0.00, 11.00, 2.50},
-    {0.00, 0.00, 0.00, 11.40, 2.50},
-    {0.00, 0.00, 0.00, 11.80, 2.50},
-    {0.00, 0.00, 0.00, 12.20, 2.50},
-    {0.00, 0.00, 0.00, 12.60, 2.50},
-    {0.00, 0.00, 0.00, 13.00, 2.50},
-    {0.00, 0.00, 0.00, 13.40, 2.50},
-    {0.00, 0.00, 0.00, 13.80, 2.50},
-    {0.00, 0.00, 0.00, 14.20, 2.50},
-    {0.00, 0.00, 0.00, 14.60, 2.50},
-    {0.00, 0.00, 0.00, 15.00, 2.50},
-    {0.00, 0.00, 0.00, 15.40, 2.50},
-    {0.00, 0.00, 0.00, 15.80, 2.50},
-    {0.00, 0.00, 0.00, 16.20, 2.50},
-    {0.00, 0.00, 0.00, 16.60, 2.50},
-    {0.00, 0.00, 0.00, 17.00, 2.50},
-    {0.00, 0.00, 0.00, 17.40, 2.50},
-    {0.00, 0.00, 0.00, 17.80, 2.50},
-    {0.00, 0.00, 0.00, 18.20, 2.50},
-    {0.00, 0.00, 0.00, 18.60, 2.50},
-    {0.00, 0.00, 0.00, 19.00, 2.50},
-    {0.00, 0.00, 0.00, 19.40, 2.50},
-    {0.00, 0.00, 0.00, 19.80, 2.50},
-    {0.00, 0.00, 0.00, 20.20, 2.50},
-    {0.00, 0.00, 0.00, 20.60, 2.50},
-    {0.00, 0.00, 0.00, 21.00, 2.50},
-    {0.00, 0.00, 0.00, 21.40, 2.50},
-    {0.00, 0.00, 0.00, 21.80, 2.50},
-    {0.00, 0.00, 0.00, 22.20, 2.50},
-    {0.00, 0.00, 0.00, 22.60, 2.50},
-    {0.00, 0.00, 0.00, 23.00, 2.50},
-    {0.00, 0.00, 0.00, 23.40, 2.50},
-    {0.00, 0.00, 0.00, 23.80, 2.50},
-    {0.00, 0.00, 0.00, 24.20, 2.50},
-    {0.00, 0.00, 0.00, 24.60, 2.50},
-    {0.00, 0.00, 0.00, 25.00, 2.50},
-    {0.00, 0.00, 0.00, 25.40, 2.50},
-    {0.00, 0.00, 0.00, 25.80, 2.50},
-    {0.00, 0.00, 0.00, 26.20, 2.50},
-    {0.00, 0.00, 0.00, 26.60, 2.50},
-    {0.00, 0.00, 0.00, 27.00, 2.50},
-    {0.00, 0.00, 0.00, 27.40, 2.50},
-    {0.00, 0.00, 0.00, 27.80, 2.50},
-    {0.00, 0.00, 0.00, 28.20, 2.50},
-    {0.00, 0.00, 0.00, 28.60, 2.50},
-    {0.00, 0.00, 0.00, 29.00, 2.50},
-    {0.00, 0.00, 0.00, 29.40, 2.50},
-    {0.00, 0.00, 0.00, 29.80, 2.50},
-    {0.00, 0.00, 0.00, 30.20, 2.50},
-    {0.00, 0.00, 0.00, 30.60, 2.50},
-    {0.00, 0.00, 0.00, 31.00, 2.50},
-    {0.00, 0.00, 0.00, 31.40, 2.50},
-    {0.00, 0.00, 0.00, 31.80, 2.50},
-    {0.00, 0.00, 0.00, 32.20, 2.50},
-    {0.00, 0.00, 0.00, 32.60, 2.50},
-    {0.00, 0.00, 0.00, 33.00, 2.50},
-    {0.00, 0.00, 0.00, 33.40, 2.50},
-    {0.00, 0.00, 0.00, 33.80, 2.50},
-    {0.00, 0.00, 0.00, 34.20, 2.50},
-    {0.00, 0.00, 0.00, 34.60, 2.50},
-    {0.00, 0.00, 0.00, 35.00, 2.50},
-    {0.00, 0.00, 0.00, 35.40, 2.50},
-    {0.00, 0.00, 0.00, 35.80, 2.50},
-    {0.00, 0.00, 0.00, 36.20, 2.50},
-    {0.00, 0.00, 0.00, 36.60, 2.50},
-    {0.00, 0.00, 0.00, 37.00, 2.50},
-    {0.00, 0.00, 0.00, 37.40, 2.50},
-    {0.00, 0.00, 0.00, 37.80, 2.50},
-    {0.00, 0.00, 0.00, 38.20, 2.50},
-    {0.00, 0.00, 0.00, 38.60, 2.50},
-    {0.00, 0.00, 0.00, 39.00, 2.50},
-    {0.00, 0.00, 0.00, 39.40, 2.50},
-    {0.00, 0.00, 0.00, 39.80, 2.50},
-    {0.00, 0.00, 0.00, 40.20, 2.50},
-    {0.00, 0.00, 0.00, 40.60, 2.50},
-    {0.00, 0.00, 0.00, 41.00, 2.50},
-    {0.00, 0.00, 0.00, 41.40, 2.50},
-    {0.00, 0.00, 0.00, 41.80, 2.50},
-    {0.00, 0.00, 0.00, 42.20, 2.50},
-    {0.00, 0.00, 0.00, 42.60, 2.50},
-    {0.00, 0.00, 0.00, 43.00, 2.50},
-    {0.00, 0.00, 0.00, 43.40, 2.50},
-    {0.00, 0.00, 0.00, 43.80, 2.50},
-    {0.00, 0.00, 0.00, 44.20, 2.50},
-    {0.00, 0.00, 0.00, 44.60, 2.50},
-    {0.00, 0.00, 0.00, 45.00, 2.50},
-    {0.00, 0.00, 0.00, 45.40, 2.50},
-    {0.00, 0.00, 0.00, 45.80, 2.50},
-    {0.00, 0.00, 0.00, 46.20, 2.50},
-    {0.00, 0.00, 0.00, 46.60, 2.50},
-    {0.00, 0.00, 0.00, 47.00, 2.50},
-    {0.00, 0.00, 0.00, 47.40, 2.50},
-    {0.00, 0.00, 0.00, 47.80, 2.50},
-    {0.00, 0.00, 0.00, 48.20, 2.50},
-    {0.00, 0.00, 0.00, 48.60, 2.50},
-    {0.00, 0.00, 0.00, 49.00, 2.50},
-    {0.00, 0.00, 0.00, 49.40, 2.50},
-    {0.00, 0.00, 0.00, 49.80, 2.50},
-    {0.00, 0.00, 0.00, 50.20, 2.50},
-    {0.00, 0.00, 0.00, 50.60, 2.50},
-    {0.00, 0.00, 0.00, 51.00, 2.50},
-    {0.00, 0.00, 0.00, 51.40, 2.50},
-    {0.00, 0.00, 0.00, 51.80, 2.50},
-    {0.00, 0.00, 0.00, 52.20, 2.50},
-    {0.00, 0.00, 0.00, 52.60, 2.50},
-    {0.00, 0.00, 0.00, 53.00, 2.50},
-    {0.00, 0.00, 0.00, 53.40, 2.50},
-    {0.00, 0.00, 0.00, 53.80, 2.50},
-    {0.00, 0.00, 0.00, 54.20, 2.50},
-    {0.00, 0.00, 0.00, 54.60, 2.50},
-    {0.00, 0.00, 0.00, 55.00, 2.50},
-    {0.00, 0.00, 0.00, 55.40, 2.50},
-    {0.00, 0.00, 0.00, 55.80, 2.50},
-    {0.00, 0.00, 0.00, 56.20, 2.50},
-    {0.00, 0.00, 0.00, 56.60, 2.50},
-    {0.00, 0.00, 0.00, 57.00, 2.50},
-    {0.00, 0.00, 0.00, 57.40, 2.50},
-    {0.00, 0.00, 0.00, 57.80, 2.50},
-    {0.00, 0.00, 0.00, 58.20, 2.50},
-    {0.00, 0.00, 0.00, 58.60, 2.50},
-    {0.00, 0.00, 0.00, 59.00, 2.50},
-    {0.00, 0.00, 0.00, 59.40, 2.50},
-    {0.00, 0.00, 0.00, 59.80, 2.50},
-    {0.00, 0.00, 0.00, -59.80, 2.70},
-    {0.00, 0.00, 0.00, -59.40, 2.70},
-    {0.00, 0.00, 0.00, -59.00, 2.70},
-    {0.00, 0.00, 0.00, -58.60, 2.70},
-    {0.00, 0.00, 0.00, -58.20, 2.70},
-    {0.00, 0.00, 0.00, -57.80, 2.70},
-    {0.00, 0.00, 0.00, -57.40, 2.70},
-    {0.00, 0.00, 0.00, -57.00, 2.70},
-    {0.00, 0.00, 0.00, -56.60, 2.70},
-    {0.00, 0.00, 0.00, -56.20, 2.70},
-    {0.00, 0.00, 0.00, -55.80, 2.70},
-    {0.00, 0.00, 0.00, -55.40, 2.70},
-    {0.00, 0.00, 0.00, -55.00, 2.70},
-    {0.00, 0.00, 0.00, -54.60, 2.70},
-    {0.00, 0.00, 0.00, -54.20, 2.70},
-    {0.00, 0.00, 0.00, -53.80, 2.70},
-    {0.00, 0.00, 0.00, -53.40, 2.70},
-    {0.00, 0.00, 0.00, -53.00, 2.70},
-    {0.00, 0.00, 0.00, -52.60, 2.70},
-    {0.00, 0.00, 0.00, -52.20, 2.70},
-    {0.00, 0.00, 0.00, -51.80, 2.70},
-    {0.00, 0.00, 0.00, -51.40, 2.70},
-    {0.00, 0.00, 0.00, -51.00, 2.70},
-    {0.00, 0.00, 0.00, -50.60, 2.70},
-    {0.00, 0.00, 0.00, -50.20, 2.70},
-    {0.00, 0.00, 0.00, -49.80, 2.70},
-    {0.00, 0.00, 0.00, -49.40, 2.70},
-    {0.00, 0.00, 0.00, -49.00, 2.70},
-    {0.00, 0.00, 0.00, -48.60, 2.70},
-    {0.00, 0.00, 0.00, -48.20, 2.70},
-    {0.00, 0.00, 0.00, -47.80, 2.70},
-    {0.00, 0.00, 0.00, -47.40, 2.70},
-    {0.00, 0.00, 0.00, -47.00, 2.70},
-    {0.00, 0.00, 0.00, -46.60, 2.70},
-    {0.00, 0.00, 0.00, -46.20, 2.70},
-    {0.00, 0.00, 0.00, -45.80, 2.70},
-    {0.00, 0.00, 0.00, -45.40, 2.70},
-    {0.00, 0.00, 0.00, -45.00, 2.70},
-    {0.00, 0.00, 0.00, -44.60, 2.70},
-    {0.00, 0.00, 0.00, -44.20, 2.70},
-    {0.00, 0.00, 0.00, -43.80, 2.70},
-    {0.00, 0.00, 0.00, -43.40, 2.70},
-    {0.00, 0.00, 0.00, -43.00, 2.70},
-    {0.00, 0.00, 0.00, -42.60, 2.70},
-    {0.00, 0.00, 0.00, -42.20, 2.70},
-    {0.00, 0.00, 0.00, -41.80, 2.70},
-    {0.00, 0.00, 0.00, -41.40, 2.70},
-    {0.00, 0.00, 0.00, -41.00, 2.70},
-    {0.00, 0.00, 0.00, -40.60, 2.70},
-    {0.00, 0.00, 0.00, -40.20, 2.70},
-    {0.00, 0.00, 0.00, -39.80, 2.70},
-    {0.00, 0.00, 0.00, -39.40, 2.70},
-    {0.00, 0.00, 0.00, -39.00, 2.70},
-    {0.00, 0.00, 0.00, -38.60, 2.70},
-    {0.00, 0.00, 0.00, -38.20, 2.70},
-    {0.00, 0.00, 0.00, -37.80, 2.70},
-    {0.00, 0.00, 0.00, -37.40, 2.70},
-    {0.00, 0.00, 0.00, -37.00, 2.70},
-    {0.00, 0.00, 0.00, -36.60, 2.70},
-    {0.00, 0.00, 0.00, -36.20, 2.70},
-    {0.00, 0.00, 0.00, -35.80, 2.70},
-    {0.00, 0.00, 0.00, -35.40, 2.70},
-    {0.00, 0.00, 0.00, -35.00, 2.70},
-    {0.00, 0.00, 0.00, -34.60, 2.70},
-    {0.00, 0.00, 0.00, -34.20, 2.70},
-    {0.00, 0.00, 0.00, -33.80, 2.70},
-    {0.00, 0.00, 0.00, -33.40, 2.70},
-    {0.00, 0.00, 0.00, -33.00, 2.70},
-    {0.00, 0.00, 0.00, -32.60, 2.70},
-    {0.00, 0.00, 0.00, -32.20, 2.70},
-    {0.00, 0.00, 0.00, -31.80, 2.70},
-    {0.00, 0.00, 0.00, -31.40, 2.70},
-    {0.00, 0.00, 0.00, -31.00, 2.70},
-    {0.00, 0.00, 0.00, -30.60, 2.70},
-    {0.00, 0.00, 0.00, -30.20, 2.70},
-    {0.00, 0.00, 0.00, -29.80, 2.70},
-    {0.00, 0.00, 0.00, -29.40, 2.70},
-    {0.00, 0.00, 0.00, -29.00, 2.70},
-    {0.00, 0.00, 0.00, -28.60, 2.70},
-    {0.00, 0.00, 0.00, -28.20, 2.70},
-    {0.00, 0.00, 0.00, -27.80, 2.70},
-    {0.00, 0.00, 0.00, -27.40, 2.70},
-    {0.00, 0.00, 0.00, -27.00, 2.70},
-    {0.00, 0.00, 0.00, -26.60, 2.70},
-    {0.00, 0.00, 0.00, -26.20, 2.70},
-    {0.00, 0.00, 0.00, -25.80, 2.70},
-    {0.00, 0.00, 0.00, -25.40, 2.70},
-    {0.00, 0.00, 0.00, -25.00, 2.70},
-    {0.00, 0.00, 0.00, -24.60, 2.70},
-    {0.00, 0.00, 0.00, -24.20, 2.70},
-    {0.00, 0.00, 0.00, -23.80, 2.70},
-    {0.00, 0.00, 0.00, -23.40, 2.70},
-    {0.00, 0.00, 0.00, -23.00, 2.70},
-    {0.00, 0.00, 0.00, -22.60, 2.70},
-    {0.00, 0.00, 0.00, -22.20, 2.70},
-    {0.00, 0.00, 0.00, -21.80, 2.70},
-    {0.00, 0.00, 0.00, -21.40, 2.70},
-    {0.00, 0.00, 0.00, -21.00, 2.70},
-    {0.00, 0.00, 0.00, -20.60, 2.70},
-    {0.00, 0.00, 0.00, -20.20, 2.70},
-    {0.00, 0.00, 0.00, -19.80, 2.70},
-    {0.00, 0.00, 0.00, -19.40, 2.70},
-    {0.00, 0.00, 0.00, -19.00, 2.70},
-    {0.00, 0.00, 0.00, -18.60, 2.70},
-    {0.00, 0.00, 0.00, -18.20, 2.70},
-    {0.00, 0.00, 0.00, -17.80, 2.70},
-    {0.00, 0.00, 0.00, -17.40, 2.70},
-    {0.00, 0.00, 0.00, -17.00, 2.70},
-    {0.00, 0.00, 0.00, -16.60, 2.70},
-    {0.00, 0.00, 0.00, -16.20, 2.70},
-    {0.00, 0.00, 0.00, -15.80, 2.70},
-    {0.00, 0.00, 0.00, -15.40, 2.70},
-    {0.00, 0.00, 0.00, -15.00, 2.70},
-    {0.00, 0.00, 0.00, -14.60, 2.70},
-    {0.00, 0.00, 0.00, -14.20, 2.70},
-    {0.00, 0.00, 0.00, -13.80, 2.70},
-    {0.00, 0.00, 0.00, -13.40, 2.70},
-    {0.00, 0.00, 0.00, -13.00, 2.70},
-    {0.00, 0.00, 0.00, -12.60, 2.70},
-    {0.00, 0.00, 0.00, -12.20, 2.70},
-    {0.00, 0.00, 0.00, -11.80, 2.70},
-    {0.00, 0.00, 0.00, -11.40, 2.70},
-    {0.00, 0.00, 0.00, -11.00, 2.70},
-    {0.00, 0.00, 0.00, -10.60, 2.70},
-    {0.00, 0.00, 0.00, -10.20, 2.70},
-    {0.00, 0.00, 0.00, -9.80, 2.70},
-    {0.00, 0.00, 0.00, -9.40, 2.70},
-    {0.00, 0.00, 0.00, -9.00, 2.70},
-    {0.00, 0.00, 0.00, -8.60, 2.70},
-    {0.00, 0.00, 0.00, -8.20, 2.70},
-    {0.00, 0.00, 0.00, -7.80, 2.70},
-    {0.00, 0.00, 0.00, -7.40, 2.70},
-    {0.00, 0.00, 0.00, -7.00, 2.70},
-    {0.00, 0.00, 0.00, -6.60, 2.70},
-    {0.00, 0.00, 0.00, -6.20, 2.70},
-    {0.00, 0.00, 0.00, -5.80, 2.70},
-    {0.00, 0.00, 0.00, -5.40, 2.70},
-    {0.00, 0.00, 0.00, -5.00, 2.70},
-    {0.00, 0.00, 0.00, -4.60, 2.70},
-    {0.00, 0.00, 0.00, -4.20, 2.70},
-    {0.00, 0.00, 0.00, -3.80, 2.70},
-    {0.00, 0.00, 0.00, -3.40, 2.70},
-    {0.00, 0.00, 0.00, -3.00, 2.70},
-    {0.00, 0.00, 0.00, -2.60, 2.70},
-    {0.00, 0.00, 0.00, -2.20, 2.70},
-    {0.00, 0.00, 0.00, -1.80, 2.70},
-    {0.00, 0.00, 0.00, -1.40, 2.70},
-    {0.00, 0.00, 0.00, -1.00, 2.70},
-    {0.00, 0.00, 0.00, -0.60, 2.70},
-    {0.00, 0.00, 0.00, -0.20, 2.70},
-    {0.00, 0.00, 0.00, 0.20, 2.70},
-    {0.00, 0.00, 0.00, 0.60, 2.70},
-    {0.00, 0.00, 0.00, 1.00, 2.70},
-    {0.00, 0.00, 0.00, 1.40, 2.70},
-    {0.00, 0.00, 0.00, 1.80, 2.70},
-    {0.00, 0.00, 0.00, 2.20, 2.70},
-    {0.00, 0.00, 0.00, 2.60, 2.70},
-    {0.00, 0.00, 0.00, 3.00, 2.70},
-    {0.00, 0.00, 0.00, 3.40, 2.70},
-    {0.00, 0.00, 0.00, 3.80, 2.70},
-    {0.00, 0.00, 0.00, 4.20, 2.70},
-    {0.00, 0.00, 0.00, 4.60, 2.70},
-    {0.00, 0.00, 0.00, 5.00, 2.70},
-    {0.00, 0.00, 0.00, 5.40, 2.70},
-    {0.00, 0.00, 0.00, 5.80, 2.70},
-    {0.00, 0.00, 0.00, 6.20, 2.70},
-    {0.00, 0.00, 0.00, 6.60, 2.70},
-    {0.00, 0.00, 0.00, 7.00, 2.70},
-    {0.00, 0.00, 0.00, 7.40, 2.70},
-    {0.00, 0.00, 0.00, 7.80, 2.70},
-    {0.00, 0.00, 0.00, 8.20, 2.70},
-    {0.00, 0.00, 0.00, 8.60, 2.70},
-    {0.00, 0.00, 0.00, 9.00, 2.70},
-    {0.00, 0.00, 0.00, 9.40, 2.70},
-    {0.00, 0.00, 0.00, 9.80, 2.70},
-    {0.00, 0.00, 0.00, 10.20, 2.70},
-    {0.00, 0.00, 0.00, 10.60, 2.70},
-    {0.00, 0.00, 0.00, 11.00, 2.70},
-    {0.00, 0.00, 0.00, 11.40, 2.70},
-    {0.00, 0.00, 0.00, 11.80, 2.70},
-    {0.00, 0.00, 0.00, 12.20, 2.70},
-    {0.00, 0.00, 0.00, 12.60, 2.70},
-    {0.00, 0.00, 0.00, 13.00, 2.70},
-    {0.00, 0.00, 0.00, 13.40, 2.70},
-    {0.00, 0.00, 0.00, 13.80, 2.70},
-    {0.00, 0.00, 0.00, 14.20, 2.70},
-    {0.00, 0.00, 0.00, 14.60, 2.70},
-    {0.00, 0.00, 0.00, 15.00, 2.70},
-    {0.00, 0.00, 0.00, 15.40, 2.70},
-    {0.00, 0.00, 0.00, 15.80, 2.70},
-    {0.00, 0.00, 0.00, 16.20, 2.70},
-    {0.00, 0.00, 0.00, 16.60, 2.70},
-    {0.00, 0.00, 0.00, 17.00, 2.70},
-    {0.00, 0.00, 0.00, 17.40, 2.70},
-    {0.00, 0.00, 0.00, 17.80, 2.70},
-    {0.00, 0.00, 0.00, 18.20, 2.70},
-    {0.00, 0.00, 0.00, 18.60, 2.70},
-    {0.00, 0.00, 0.00, 19.00, 2.70},
-    {0.00, 0.00, 0.00, 19.40, 2.70},
-    {0.00, 0.00, 0.00, 19.80, 2.70},
-    {0.00, 0.00, 0.00, 20.20, 2.70},
-    {0.00, 0.00, 0.00, 20.60, 2.70},
-    {0.00, 0.00, 0.00, 21.00, 2.70},
-    {0.00, 0.00, 0.00, 21.40, 2.70},
-    {0.00, 0.00, 0.00, 21.80, 2.70},
-    {0.00, 0.00, 0.00, 22.20, 2.70},
-    {0.00, 0.00, 0.00, 22.60, 2.70},
-    {0.00, 0.00, 0.00, 23.00, 2.70},
-    {0.00, 0.00, 0.00, 23.40, 2.70},
-    {0.00, 0.00, 0.00, 23.80, 2.70},
-    {0.00, 0.00, 0.00, 24.20, 2.70},
-    {0.00, 0.00, 0.00, 24.60, 2.70},
-    {0.00, 0.00, 0.00, 25.00, 2.70},
-    {0.00, 0.00, 0.00, 25.40, 2.70},
-    {0.00, 0.00, 0.00, 25.80, 2.70},
-    {0.00, 0.00, 0.00, 26.20, 2.70},
-    {0.00, 0.00, 0.00, 26.60, 2.70},
-    {0.00, 0.00, 0.00, 27.00, 2.70},
-    {0.00, 0.00, 0.00, 27.40, 2.70},
-    {0.00, 0.00, 0.00, 27.80, 2.70},
-    {0.00, 0.00, 0.00, 28.20, 2.70},
-    {0.00, 0.00, 0.00, 28.60, 2.70},
-    {0.00, 0.00, 0.00, 29.00, 2.70},
-    {0.00, 0.00, 0.00, 29.40, 2.70},
-    {0.00, 0.00, 0.00, 29.80, 2.70},
-    {0.00, 0.00, 0.00, 30.20, 2.70},
-    {0.00, 0.00, 0.00, 30.60, 2.70},
-    {0.00, 0.00, 0.00, 31.00, 2.70},
-    {0.00, 0.00, 0.00, 31.40, 2.70},
-    {0.00, 0.00, 0.00, 31.80, 2.70},
-    {0.00, 0.00, 0.00, 32.20, 2.70},
-    {0.00, 0.00, 0.00, 32.60, 2.70},
-    {0.00, 0.00, 0.00, 33.00, 2.70},
-    {0.00, 0.00, 0.00, 33.40, 2.70},
-    {0.00, 0.00, 0.00, 33.80, 2.70},
-    {0.00, 0.00, 0.00, 34.20, 2.70},
-    {0.00, 0.00, 0.00, 34.60, 2.70},
-    {0.00, 0.00, 0.00, 35.00, 2.70},
-    {0.00, 0.00, 0.00, 35.40, 2.70},
-    {0.00, 0.00, 0.00, 35.80, 2.70},
-    {0.00, 0.00, 0.00, 36.20, 2.70},
-    {0.00, 0.00, 0.00, 36.60, 2.70},
-    {0.00, 0.00, 0.00, 37.00, 2.70},
-    {0.00, 0.00, 0.00, 37.40, 2.70},
-    {0.00, 0.00, 0.00, 37.80, 2.70},
-    {0.00, 0.00, 0.00, 38.20, 2.70},
-    {0.00, 0.00, 0.00, 38.60, 2.70},
-    {0.00, 0.00, 0.00, 39.00, 2.70},
-    {0.00, 0.00, 0.00, 39.40, 2.70},
-    {0.00, 0.00, 0.00, 39.80, 2.70},
-    {0.00, 0.00, 0.00, 40.20, 2.70},
-    {0.00, 0.00, 0.00, 40.60, 2.70},
-    {0.00, 0.00, 0.00, 41.00, 2.70},
-    {0.00, 0.00, 0.00, 41.40, 2.70},
-    {0.00, 0.00, 0.00, 41.80, 2.70},
-    {0.00, 0.00, 0.00, 42.20, 2.70},
-    {0.00, 0.00, 0.00, 42.60, 2.70},
-    {0.00, 0.00, 0.00, 43.00, 2.70},
-    {0.00, 0.00, 0.00, 43.40, 2.70},
-    {0.00, 0.00, 0.00, 43.80, 2.70},
-    {0.00, 0.00, 0.00, 44.20, 2.70},
-    {0.00, 0.00, 0.00, 44.60, 2.70},
-    {0.00, 0.00, 0.00, 45.00, 2.70},
-    {0.00, 0.00, 0.00, 45.40, 2.70},
-    {0.00, 0.00, 0.00, 45.80, 2.70},
-    {0.00, 0.00, 0.00, 46.20, 2.70},
-    {0.00, 0.00, 0.00, 46.60, 2.70},
-    {0.00, 0.00, 0.00, 47.00, 2.70},
-    {0.00, 0.00, 0.00, 47.40, 2.70},
-    {0.00, 0.00, 0.00, 47.80, 2.70},
-    {0.00, 0.00, 0.00, 48.20, 2.70},
-    {0.00, 0.00, 0.00, 48.60, 2.70},
-    {0.00, 0.00, 0.00, 49.00, 2.70},
-    {0.00, 0.00, 0.00, 49.40, 2.70},
-    {0.00, 0.00, 0.00, 49.80, 2.70},
-    {0.00, 0.00, 0.00, 50.20, 2.70},
-    {0.00, 0.00, 0.00, 50.60, 2.70},
-    {0.00, 0.00, 0.00, 51.00, 2.70},
-    {0.00, 0.00, 0.00, 51.40, 2.70},
-    {0.00, 0.00, 0.00, 51.80, 2.70},
-    {0.00, 0.00, 0.00, 52.20, 2.70},
-    {0.00, 0.00, 0.00, 52.60, 2.70},
-    {0.00, 0.00, 0.00, 53.00, 2.70},
-    {0.00, 0.00, 0.00, 53.40, 2.70},
-    {0.00, 0.00, 0.00, 53.80, 2.70},
-    {0.00, 0.00, 0.00, 54.20, 2.70},
-    {0.00, 0.00, 0.00, 54.60, 2.70},
-    {0.00, 0.00, 0.00, 55.00, 2.70},
-    {0.00, 0.00, 0.00, 55.40, 2.70},
-    {0.00, 0.00, 0.00, 55.80, 2.70},
-    {0.00, 0.00, 0.00, 56.20, 2.70},
-    {0.00, 0.00, 0.00, 56.60, 2.70},
-    {0.00, 0.00, 0.00, 57.00, 2.70},
-    {0.00, 0.00, 0.00, 57.40, 2.70},
-    {0.00, 0.00, 0.00, 57.80, 2.70},
-    {0.00, 0.00, 0.00, 58.20, 2.70},
-    {0.00, 0.00, 0.00, 58.60, 2.70},
-    {0.00, 0.00, 0.00, 59.00, 2.70},
-    {0.00, 0.00, 0.00, 59.40, 2.70},
-    {0.00, 0.00, 0.00, 59.80, 2.70},
-    {0.00, 0.00, 0.00, -59.80, 2.90},
-    {0.00, 0.00, 0.00, -59.40, 2.90},
-    {0.00, 0.00, 0.00, -59.00, 2.90},
-    {0.00, 0.00, 0.00, -58.60, 2.90},
-    {0.00, 0.00, 0.00, -58.20, 2.90},
-    {0.00, 0.00, 0.00, -57.80, 2.90},
-    {0.00, 0.00, 0.00, -57.40, 2.90},
-    {0.00, 0.00, 0.00, -57.00, 2.90},
-    {0.00, 0.00, 0.00, -56.60, 2.90},
-    {0.00, 0.00, 0.00, -56.20, 2.90},
-    {0.00, 0.00, 0.00, -55.80, 2.90},
-    {0.00, 0.00, 0.00, -55.40, 2.90},
-    {0.00, 0.00, 0.00, -55.00, 2.90},
-    {0.00, 0.00, 0.00, -54.60, 2.90},
-    {0.00, 0.00, 0.00, -54.20, 2.90},
-    {0.00, 0.00, 0.00, -53.80, 2.90},
-    {0.00, 0.00, 0.00, -53.40, 2.90},
-    {0.00, 0.00, 0.00, -53.00, 2.90},
-    {0.00, 0.00, 0.00, -52.60, 2.90},
-    {0.00, 0.00, 0.00, -52.20, 2.90},
-    {0.00, 0.00, 0.00, -51.80, 2.90},
-    {0.00, 0.00, 0.00, -51.40, 2.90},
-    {0.00, 0.00, 0.00, -51.00, 2.90},
-    {0.00, 0.00, 0.00, -50.60, 2.90},
-    {0.00, 0.00, 0.00, -50.20, 2.90},
-    {0.00, 0.00, 0.00, -49.80, 2.90},
-    {0.00, 0.00, 0.00, -49.40, 2.90},
-    {0.00, 0.00, 0.00, -49.00, 2.90},
-    {0.00, 0.00, 0.00, -48.60, 2.90},
-    {0.00, 0.00, 0.00, -48.20, 2.90},
-    {0.00, 0.00, 0.00, -47.80, 2.90},
-    {0.00, 0.00, 0.00, -47.40, 2.90},
-    {0.00, 0.00, 0.00, -47.00, 2.90},
-    {0.00, 0.00, 0.00, -46.60, 2.90},
-    {0.00, 0.00, 0.00, -46.20, 2.90},
-    {0.00, 0.00, 0.00, -45.80, 2.90},
-    {0.00, 0.00, 0.00, -45.40, 2.90},
-    {0.00, 0.00, 0.00, -45.00, 2.90},
-    {0.00, 0.00, 0.00, -44.60, 2.90},
-    {0.00, 0.00, 0.00, -44.20, 2.90},
-    {0.00, 0.00, 0.00, -43.80, 2.90},
-    {0.00, 0.00, 0.00, -43.40, 2.90},
-    {0.00, 0.00, 0.00, -43.00, 2.90},
-    {0.00, 0.00, 0.00, -42.60, 2.90},
-    {0.00, 0.00, 0.00, -42.20, 2.90},
-    {0.00, 0.00, 0.00, -41.80, 2.90},
-    {0.00, 0.00, 0.00, -41.40, 2.90},
-    {0.00, 0.00, 0.00, -41.00, 2.90},
-    {0.00, 0.00, 0.00, -40.60, 2.90},
-    {0.00, 0.00, 0.00, -40.20, 2.90},
-    {0.00, 0.00, 0.00, -39.80, 2.90},
-    {0.00, 0.00, 0.00, -39.40, 2.90},
-    {0.00, 0.00, 0.00, -39.00, 2.90},
-    {0.00, 0.00, 0.00, -38.60, 2.90},
-    {0.00, 0.00, 0.00, -38.20, 2.90},
-    {0.00, 0.00, 0.00, -37.80, 2.90},
-    {0.00, 0.00, 0.00, -37.40, 2.90},
-    {0.00, 0.00, 0.00, -37.00, 2.90},
-    {0.00, 0.00, 0.00, -36.60, 2.90},
-    {0.00, 0.00, 0.00, -36.20, 2.90},
-    {0.00, 0.00, 0.00, -35.80, 2.90},
-    {0.00, 0.00, 0.00, -35.40, 2.90},
-    {0.00, 0.00, 0.00, -35.00, 2.90},
-    {0.00, 0.00, 0.00, -34.60, 2.90},
-    {0.00, 0.00, 0.00, -34.20, 2.90},
-    {0.00, 0.00, 0.00, -33.80, 2.90},
-    {0.00, 0.00, 0.00, -33.40, 2.90},
-    {0.00, 0.00, 0.00, -33.00, 2.90},
-    {0.00, 0.00, 0.00, -32.60, 2.90},
-    {0.00, 0.00, 0.00, -32.20, 2.90},
-    {0.00, 0.00, 0.00, -31.80, 2.90},
-    {0.00, 0.00, 0.00, -31.40, 2.90},
-    {0.00, 0.00, 0.00, -31.00, 2.90},
-    {0.00, 0.00, 0.00, -30.60, 2.90},
-    {0.00, 0.00, 0.00, -30.20, 2.90},
-    {0.00, 0.00, 0.00, -29.80, 2.90},
-    {0.00, 0.00, 0.00, -29.40, 2.90},
-    {0.00, 0.00, 0.00, -29.00, 2.90},
-    {0.00, 0.00, 0.00, -28.60, 2.90},
-    {0.00, 0.00, 0.00, -28.20, 2.90},
-    {0.00, 0.00, 0.00, -27.80, 2.90},
-    {0.00, 0.00, 0.00, -27.40, 2.90},
-    {0.00, 0.00, 0.00, -27.00, 2.90},
-    {0.00, 0.00, 0.00, -26.60, 2.90},
-    {0.00, 0.00, 0.00, -26.20, 2.90},
-    {0.00, 0.00, 0.00, -25.80, 2.90},
-    {0.00, 0.00, 0.00, -25.40, 2.90},
-    {0.00, 0.00, 0.00, -25.00, 2.90},
-    {0.00, 0.00, 0.00, -24.60, 2.90},
-    {0.00, 0.00, 0.00, -24.20, 2.90},
-    {0.00, 0.00, 0.00, -23.80, 2.90},
-    {0.00, 0.00, 0.00, -23.40, 2.90},
-    {0.00, 0.00, 0.00, -23.00, 2.90},
-    {0.00, 0.00, 0.00, -22.60, 2.90},
-    {0.00, 0.00, 0.00, -22.20, 2.90},
-    {0.00, 0.00, 0.00, -21.80, 2.90},
-    {0.00, 0.00, 0.00, -21.40, 2.90},
-    {0.00, 0.00, 0.00, -21.00, 2.90},
-    {0.00, 0.00, 0.00, -20.60, 2.90},
-    {0.00, 0.00, 0.00, -20.20, 2.90},
-    {0.00, 0.00, 0.00, -19.80, 2.90},
-    {0.00, 0.00, 0.00, -19.40, 2.90},
-    {0.00, 0.00, 0.00, -19.00, 2.90},
-    {0.00, 0.00, 0.00, -18.60, 2.90},
-    {0.00, 0.00, 0.00, -18.20, 2.90},
-    {0.00, 0.00, 0.00, -17.80, 2.90},
-    {0.00, 0.00, 0.00, -17.40, 2.90},
-    {0.00, 0.00, 0.00, -17.00, 2.90},
-    {0.00, 0.00, 0.00, -16.60, 2.90},
-    {0.00, 0.00, 0.00, -16.20, 2.90},
-    {0.00, 0.00, 0.00, -15.80, 2.90},
-    {0.00, 0.00, 0.00, -15.40, 2.90},
-    {0.00, 0.00, 0.00, -15.00, 2.90},
-    {0.00, 0.00, 0.00, -14.60, 2.90},
-    {0.00, 0.00, 0.00, -14.20, 2.90},
-    {0.00, 0.00, 0.00, -13.80, 2.90},
-    {0.00, 0.00, 0.00, -13.40, 2.90},
-    {0.00, 0.00, 0.00, -13.00, 2.90},
-    {0.00, 0.00, 0.00, -12.60, 2.90},
-    {0.00, 0.00, 0.00, -12.20, 2.90},
-    {0.00, 0.00, 0.00, -11.80, 2.90},
-    {0.00, 0.00, 0.00, -11.40, 2.90},
-    {0.00, 0.00, 0.00, -11.00, 2.90},
-    {0.00, 0.00, 0.00, -10.60, 2.90},
-    {0.00, 0.00, 0.00, -10.20, 2.90},
-    {0.00, 0.00, 0.00, -9.80, 2.90},
-    {0.00, 0.00, 0.00, -9.40, 2.90},
-    {0.00, 0.00, 0.00, -9.00, 2.90},
-    {0.00, 0.00, 0.00, -8.60, 2.90},
-    {0.00, 0.00, 0.00, -8.20, 2.90},
-    {0.00, 0.00, 0.00, -7.80, 2.90},
-    {0.00, 0.00, 0.00, -7.40, 2.90},
-    {0.00, 0.00, 0.00, -7.00, 2.90},
-    {0.00, 0.00, 0.00, -6.60, 2.90},
-    {0.00, 0.00, 0.00, -6.20, 2.90},
-    {0.00, 0.00, 0.00, -5.80, 2.90},
-    {0.00, 0.00, 0.00, -5.40, 2.90},
-    {0.00, 0.00, 0.00, -5.00, 2.90},
-    {0.00, 0.00, 0.00, -4.60, 2.90},
-    {0.00, 0.00, 0.00, -4.20, 2.90},
-    {0.00, 0.00, 0.00, -3.80, 2.90},
-    {0.00, 0.00, 0.00, -3.40, 2.90},
-    {0.00, 0.00, 0.00, -3.00, 2.90},
-    {0.00, 0.00, 0.00, -2.60, 2.90},
-    {0.00, 0.00, 0.00, -2.20, 2.90},
-    {0.00, 0.00, 0.00, -1.80, 2.90},
-    {0.00, 0.00, 0.00, -1.40, 2.90},
-    {0.00, 0.00, 0.00, -1.00, 2.90},
-    {0.00, 0.00, 0.00, -0.60, 2.90},
-    {0.00, 0.00, 0.00, -0.20, 2.90},
-    {0.00, 0.00, 0.00, 0.20, 2.90},
-    {0.00, 0.00, 0.00, 0.60, 2.90},
-    {0.00, 0.00, 0.00, 1.00, 2.90},
-    {0.00, 0.00, 0.00, 1.40, 2.90},
-    {0.00, 0.00, 0.00, 1.80, 2.90},
-    {0.00, 0.00, 0.00, 2.20, 2.90},
-    {0.00, 0.00, 0.00, 2.60, 2.90},
-    {0.00, 0.00, 0.00, 3.00, 2.90},
-    {0.00, 0.00, 0.00, 3.40, 2.90},
-    {0.00, 0.00, 0.00, 3.80, 2.90},
-    {0.00, 0.00, 0.00, 4.20, 2.90},
-    {0.00, 0.00, 0.00, 4.60, 2.90},
-    {0.00, 0.00, 0.00, 5.00, 2.90},
-    {0.00, 0.00, 0.00, 5.40, 2.90},
-    {0.00, 0.00, 0.00, 5.80, 2.90},
-    {0.00, 0.00, 0.00, 6.20, 2.90},
-    {0.00, 0.00, 0.00, 6.60, 2.90},
-    {0.00, 0.00, 0.00, 7.00, 2.90},
-    {0.00, 0.00, 0.00, 7.40, 2.90},
-    {0.00, 0.00, 0.00, 7.80, 2.90},
-    {0.00, 0.00, 0.00, 8.20, 2.90},
-    {0.00, 0.00, 0.00, 8.60, 2.90},
-    {0.00, 0.00, 0.00, 9.00, 2.90},
-    {0.00, 0.00, 0.00, 9.40, 2.90},
-    {0.00, 0.00, 0.00, 9.80, 2.90},
-    {0.00, 0.00, 0.00, 10.20, 2.90},
-    {0.00, 0.00, 0.00, 10.60, 2.90},
-    {0.00, 0.00, 0.00, 11.00, 2.90},
-    {0.00, 0.00, 0.00, 11.40, 2.90},
-    {0.00, 0.00, 0.00, 11.80, 2.90},
-    {0.00, 0.00, 0.00, 12.20, 2.90},
-    {0.00, 0.00, 0.00, 12.60, 2.90},
-    {0.00, 0.00, 0.00, 13.00, 2.90},
-    {0.00, 0.00, 0.00, 13.40, 2.90},
-    {0.00, 0.00, 0.00, 13.80, 2.90},
-    {0.00, 0.00, 0.00, 14.20, 2.90},
-    {0.00, 0.00, 0.00, 14.60, 2.90},
-    {0.00, 0.00, 0.00, 15.00, 2.90},
-    {0.00, 0.00, 0.00, 15.40, 2.90},
-    {0.00, 0.00, 0.00, 15.80, 2.90},
-    {0.00, 0.00, 0.00, 16.20, 2.90},
-    {0.00, 0.00, 0.00, 16.60, 2.90},
-    {0.00, 0.00, 0.00, 17.00, 2.90},
-    {0.00, 0.00, 0.00, 17.40, 2.90},
-    {0.00, 0.00, 0.00, 17.80, 2.90},
-    {0.00, 0.00, 0.00, 18.20, 2.90},
-    {0.00, 0.00, 0.00, 18.60, 2.90},
-    {0.00, 0.00, 0.00, 19.00, 2.90},
-    {0.00, 0.00, 0.00, 19.40, 2.90},
-    {0.00, 0.00, 0.00, 19.80, 2.90},
-    {0.00, 0.00, 0.00, 20.20, 2.90},
-    {0.00, 0.00, 0.00, 20.60, 2.90},
-    {0.00, 0.00, 0.00, 21.00, 2.90},
-    {0.00, 0.00, 0.00, 21.40, 2.90},
-    {0.00, 0.00, 0.00, 21.80, 2.90},
-    {0.00, 0.00, 0.00, 22.20, 2.90},
-    {0.00, 0.00, 0.00, 22.60, 2.90},
-    {0.00, 0.00, 0.00, 23.00, 2.90},
-    {0.00, 0.00, 0.00, 23.40, 2.90},
-    {0.00, 0.00, 0.00, 23.80, 2.90},
-    {0.00, 0.00, 0.00, 24.20, 2.90},
-    {0.00, 0.00, 0.00, 24.60, 2.90},
-    {0.00, 0.00, 0.00, 25.00, 2.90},
-    {0.00, 0.00, 0.00, 25.40, 2.90},
-    {0.00, 0.00, 0.00, 25.80, 2.90},
-    {0.00, 0.00, 0.00, 26.20, 2.90},
-    {0.00, 0.00, 0.00, 26.60, 2.90},
-    {0.00, 0.00, 0.00, 27.00, 2.90},
-    {0.00, 0.00, 0.00, 27.40, 2.90},
-    {0.00, 0.00, 0.00, 27.80, 2.90},
-    {0.00, 0.00, 0.00, 28.20, 2.90},
-    {0.00, 0.00, 0.00, 28.60, 2.90},
-    {0.00, 0.00, 0.00, 29.00, 2.90},
-    {0.00, 0.00, 0.00, 29.40, 2.90},
-    {0.00, 0.00, 0.00, 29.80, 2.90},
-    {0.00, 0.00, 0.00, 30.20, 2.90},
-    {0.00, 0.00, 0.00, 30.60, 2.90},
-    {0.00, 0.00, 0.00, 31.00, 2.90},
-    {0.00, 0.00, 0.00, 31.40, 2.90},
-    {0.00, 0.00, 0.00, 31.80, 2.90},
-    {0.00, 0.00, 0.00, 32.20, 2.90},
-    {0.00, 0.00, 0.00, 32.60, 2.90},
-    {0.00, 0.00, 0.00, 33.00, 2.90},
-    {0.00, 0.00, 0.00, 33.40, 2.90},
-    {0.00, 0.00, 0.00, 33.80, 2.90},
-    {0.00, 0.00, 0.00, 34.20, 2.90},
-    {0.00, 0.00, 0.00, 34.60, 2.90},
-    {0.00, 0.00, 0.00, 35.00, 2.90},
-    {0.00, 0.00, 0.00, 35.40, 2.90},
-    {0.00, 0.00, 0.00, 35.80, 2.90},
-    {0.00, 0.00, 0.00, 36.20, 2.90},
-    {0.00, 0.00, 0.00, 36.60, 2.90},
-    {0.00, 0.00, 0.00, 37.00, 2.90},
-    {0.00, 0.00, 0.00, 37.40, 2.90},
-    {0.00, 0.00, 0.00, 37.80, 2.90},
-    {0.00, 0.00, 0.00, 38.20, 2.90},
-    {0.00, 0.00, 0.00, 38.60, 2.90},
-    {0.00, 0.00, 0.00, 39.00, 2.90},
-    {0.00, 0.00, 0.00, 39.40, 2.90},
-    {0.00, 0.00, 0.00, 39.80, 2.90},
-    {0.00, 0.00, 0.00, 40.20, 2.90},
-    {0.00, 0.00, 0.00, 40.60, 2.90},
-    {0.00, 0.00, 0.00, 41.00, 2.90},
-    {0.00, 0.00, 0.00, 41.40, 2.90},
-    {0.00, 0.00, 0.00, 41.80, 2.90},
-    {0.00, 0.00, 0.00, 42.20, 2.90},
-    {0.00, 0.00, 0.00, 42.60, 2.90},
-    {0.00, 0.00, 0.00, 43.00, 2.90},
-    {0.00, 0.00, 0.00, 43.40, 2.90},
-    {0.00, 0.00, 0.00, 43.80, 2.90},
-    {0.00, 0.00, 0.00, 44.20, 2.90},
-    {0.00, 0.00, 0.00, 44.60, 2.90},
-    {0.00, 0.00, 0.00, 45.00, 2.90},
-    {0.00, 0.00, 0.00, 45.40, 2.90},
-    {0.00, 0.00, 0.00, 45.80, 2.90},
-    {0.00, 0.00, 0.00, 46.20, 2.90},
-    {0.00, 0.00, 0.00, 46.60, 2.90},
-    {0.00, 0.00, 0.00, 47.00, 2.90},
-    {0.00, 0.00, 0.00, 47.40, 2.90},
-    {0.00, 0.00, 0.00, 47.80, 2.90},
-    {0.00, 0.00, 0.00, 48.20, 2.90},
-    {0.00, 0.00, 0.00, 48.60, 2.90},
-    {0.00, 0.00, 0.00, 49.00, 2.90},
-    {0.00, 0.00, 0.00, 49.40, 2.90},
-    {0.00, 0.00, 0.00, 49.80, 2.90},
-    {0.00, 0.00, 0.00, 50.20, 2.90},
-    {0.00, 0.00, 0.00, 50.60, 2.90},
-    {0.00, 0.00, 0.00, 51.00, 2.90},
-    {0.00, 0.00, 0.00, 51.40, 2.90},
-    {0.00, 0.00, 0.00, 51.80, 2.90},
-    {0.00, 0.00, 0.00, 52.20, 2.90},
-    {0.00, 0.00, 0.00, 52.60, 2.90},
-    {0.00, 0.00, 0.00, 53.00, 2.90},
-    {0.00, 0.00, 0.00, 53.40, 2.90},
-    {0.00, 0.00, 0.00, 53.80, 2.90},
-    {0.00, 0.00, 0.00, 54.20, 2.90},
-    {0.00, 0.00, 0.00, 54.60, 2.90},
-    {0.00, 0.00, 0.00, 55.00, 2.90},
-    {0.00, 0.00, 0.00, 55.40, 2.90},
-    {0.00, 0.00, 0.00, 55.80, 2.90},
-    {0.00, 0.00, 0.00, 56.20, 2.90},
-    {0.00, 0.00, 0.00, 56.60, 2.90},
-    {0.00, 0.00, 0.00, 57.00, 2.90},
-    {0.00, 0.00, 0.00, 57.40, 2.90},
-    {0.00, 0.00, 0.00, 57.80, 2.90},
-    {0.00, 0.00, 0.00, 58.20, 2.90},
-    {0.00, 0.00, 0.00, 58.60, 2.90},
-    {0.00, 0.00, 0.00, 59.00, 2.90},
-    {0.00, 0.00, 0.00, 59.40, 2.90},
-    {0.00, 0.00, 0.00, 59.80, 2.90},
-    {0.00, 0.00, 0.00, -59.80, 3.10},
-    {0.00, 0.00, 0.00, -59.40, 3.10},
-    {0.00, 0.00, 0.00, -59.00, 3.10},
-    {0.00, 0.00, 0.00, -58.60, 3.10},
-    {0.00, 0.00, 0.00, -58.20, 3.10},
-    {0.00, 0.00, 0.00, -57.80, 3.10},
-    {0.00, 0.00, 0.00, -57.40, 3.10},
-    {0.00, 0.00, 0.00, -57.00, 3.10},
-    {0.00, 0.00, 0.00, -56.60, 3.10},
-    {0.00, 0.00, 0.00, -56.20, 3.10},
-    {0.00, 0.00, 0.00, -55.80, 3.10},
-    {0.00, 0.00, 0.00, -55.40, 3.10},
-    {0.00, 0.00, 0.00, -55.00, 3.10},
-    {0.00, 0.00, 0.00, -54.60, 3.10},
-    {0.00, 0.00, 0.00, -54.20, 3.10},
-    {0.00, 0.00, 0.00, -53.80, 3.10},
-    {0.00, 0.00, 0.00, -53.40, 3.10},
-    {0.00, 0.00, 0.00, -53.00, 3.10},
-    {0.00, 0.00, 0.00, -52.60, 3.10},
-    {0.00, 0.00, 0.00, -52.20, 3.10},
-    {0.00, 0.00, 0.00, -51.80, 3.10},
-    {0.00, 0.00, 0.00, -51.40, 3.10},
-    {0.00, 0.00, 0.00, -51.00, 3.10},
-    {0.00, 0.00, 0.00, -50.60, 3.10},
-    {0.00, 0.00, 0.00, -50.20, 3.10},
-    {0.00, 0.00, 0.00, -49.80, 3.10},
-    {0.00, 0.00, 0.00, -49.40, 3.10},
-    {0.00, 0.00, 0.00, -49.00, 3.10},
-    {0.00, 0.00, 0.00, -48.60, 3.10},
-    {0.00, 0.00, 0.00, -48.20, 3.10},
-    {0.00, 0.00, 0.00, -47.80, 3.10},
-    {0.00, 0.00, 0.00, -47.40, 3.10},
-    {0.00, 0.00, 0.00, -47.00, 3.10},
-    {0.00, 0.00, 0.00, -46.60, 3.10},
-    {0.00, 0.00, 0.00, -46.20, 3.10},
-    {0.00, 0.00, 0.00, -45.80, 3.10},
-    {0.00, 0.00, 0.00, -45.40, 3.10},
-    {0.00, 0.00, 0.00, -45.00, 3.10},
-    {0.00, 0.00, 0.00, -44.60, 3.10},
-    {0.00, 0.00, 0.00, -44.20, 3.10},
-    {0.00, 0.00, 0.00, -43.80, 3.10},
-    {0.00, 0.00, 0.00, -43.40, 3.10},
-    {0.00, 0.00, 0.00, -43.00, 3.10},
-    {0.00, 0.00, 0.00, -42.60, 3.10},
-    {0.00, 0.00, 0.00, -42.20, 3.10},
-    {0.00, 0.00, 0.00, -41.80, 3.10},
-    {0.00, 0.00, 0.00, -41.40, 3.10},
-    {0.00, 0.00, 0.00, -41.00, 3.10},
-    {0.00, 0.00, 0.00, -40.60, 3.10},
-    {0.00, 0.00, 0.00, -40.20, 3.10},
-    {0.00, 0.00, 0.00, -39.80, 3.10},
-    {0.00, 0.00, 0.00, -39.40, 3.10},
-    {0.00, 0.00, 0.00, -39.00, 3.10},
-    {0.00, 0.00, 0.00, -38.60, 3.10},
-    {0.00, 0.00, 0.00, -38.20, 3.10},
-    {0.00, 0.00, 0.00, -37.80, 3.10},
-    {0.00, 0.00, 0.00, -37.40, 3.10},
-    {0.00, 0.00, 0.00, -37.00, 3.10},
-    {0.00, 0.00, 0.00, -36.60, 3.10},
-    {0.00, 0.00, 0.00, -36.20, 3.10},
-    {0.00, 0.00, 0.00, -35.80, 3.10},
-    {0.00, 0.00, 0.00, -35.40, 3.10},
-    {0.00, 0.00, 0.00, -35.00, 3.10},
-    {0.00, 0.00, 0.00, -34.60, 3.10},
-    {0.00, 0.00, 0.00, -34.20, 3.10},
-    {0.00, 0.00, 0.00, -33.80, 3.10},
-    {0.00, 0.00, 0.00, -33.40, 3.10},
-    {0.00, 0.00, 0.00, -33.00, 3.10},
-    {0.00, 0.00, 0.00, -32.60, 3.10},
-    {0.00, 0.00, 0.00, -32.20, 3.10},
-    {0.00, 0.00, 0.00, -31.80, 3.10},
-    {0.00, 0.00, 0.00, -31.40, 3.10},
-    {0.00, 0.00, 0.00, -31.00, 3.10},
-    {0.00, 0.00, 0.00, -30.60, 3.10},
-    {0.00, 0.00, 0.00, -30.20, 3.10},
-    {0.00, 0.00, 0.00, -29.80, 3.10},
-    {0.00, 0.00, 0.00, -29.40, 3.10},
-    {0.00, 0.00, 0.00, -29.00, 3.10},
-    {0.00, 0.00, 0.00, -28.60, 3.10},
-    {0.00, 0.00, 0.00, -28.20, 3.10},
-    {0.00, 0.00, 0.00, -27.80, 3.10},
-    {0.00, 0.00, 0.00, -27.40, 3.10},
-    {0.00, 0.00, 0.00, -27.00, 3.10},
-    {0.00, 0.00, 0.00, -26.60, 3.10},
-    {0.00, 0.00, 0.00, -26.20, 3.10},
-    {0.00, 0.00, 0.00, -25.80, 3.10},
-    {0.00, 0.00, 0.00, -25.40, 3.10},
-    {0.00, 0.00, 0.00, -25.00, 3.10},
-    {0.00, 0.00, 0.00, -24.60, 3.10},
-    {0.00, 0.00, 0.00, -24.20, 3.10},
-    {0.00, 0.00, 0.00, -23.80, 3.10},
-    {0.00, 0.00, 0.00, -23.40, 3.10},
-    {0.00, 0.00, 0.00, -23.00, 3.10},
-    {0.00, 0.00, 0.00, -22.60, 3.10},
-    {0.00, 0.00, 0.00, -22.20, 3.10},
-    {0.00, 0.00, 0.00, -21.80, 3.10},
-    {0.00, 0.00, 0.00, -21.40, 3.10},
-    {0.00, 0.00, 0.00, -21.00, 3.10},
-    {0.00, 0.00, 0.00, -20.60, 3.10},
-    {0.00, 0.00, 0.00, -20.20, 3.10},
-    {0.00, 0.00, 0.00, -19.80, 3.10},
-    {0.00, 0.00, 0.00, -19.40, 3.10},
-    {0.00, 0.00, 0.00, -19.00, 3.10},
-    {0.00, 0.00, 0.00, -18.60, 3.10},
-    {0.00, 0.00, 0.00, -18.20, 3.10},
-    {0.00, 0.00, 0.00, -17.80, 3.10},
-    {0.00, 0.00, 0.00, -17.40, 3.10},
-    {0.00, 0.00, 0.00, -17.00, 3.10},
-    {0.00, 0.00, 0.00, -16.60, 3.10},
-    {0.00, 0.00, 0.00, -16.20, 3.10},
-    {0.00, 0.00, 0.00, -15.80, 3.10},
-    {0.00, 0.00, 0.00, -15.40, 3.10},
-    {0.00, 0.00, 0.00, -15.00, 3.10},
-    {0.00, 0.00, 0.00, -14.60, 3.10},
-    {0.00, 0.00, 0.00, -14.20, 3.10},
-    {0.00, 0.00, 0.00, -13.80, 3.10},
-    {0.00, 0.00, 0.00, -13.40, 3.10},
-    {0.00, 0.00, 0.00, -13.00, 3.10},
-    {0.00, 0.00, 0.00, -12.60, 3.10},
-    {0.00, 0.00, 0.00, -12.20, 3.10},
-    {0.00, 0.00, 0.00, -11.80, 3.10},
-    {0.00, 0.00, 0.00, -11.40, 3.10},
-    {0.00, 0.00, 0.00, -11.00, 3.10},
-    {0.00, 0.00, 0.00, -10.60, 3.10},
-    {0.00, 0.00, 0.00, -10.20, 3.10},
-    {0.00, 0.00, 0.00, -9.80, 3.10},
-    {0.00, 0.00, 0.00, -9.40, 3.10},
-    {0.00, 0.00, 0.00, -9.00, 3.10},
-    {0.00, 0.00, 0.00, -8.60, 3.10},
-    {0.00, 0.00, 0.00, -8.20, 3.10},
-    {0.00, 0.00, 0.00, -7.80, 3.10},
-    {0.00, 0.00, 0.00, -7.40, 3.10},
-    {0.00, 0.00, 0.00, -7.00, 3.10},
-    {0.00, 0.00, 0.00, -6.60, 3.10},
-    {0.00, 0.00, 0.00, -6.20, 3.10},
-    {0.00, 0.00, 0.00, -5.80, 3.10},
-    {0.00, 0.00, 0.00, -5.40, 3.10},
-    {0.00, 0.00, 0.00, -5.00, 3.10},
-    {0.00, 0.00, 0.00, -4.60, 3.10},
-    {0.00, 0.00, 0.00, -4.20, 3.10},
-    {0.00, 0.00, 0.00, -3.80, 3.10},
-    {0.00, 0.00, 0.00, -3.40, 3.10},
-    {0.00, 0.00, 0.00, -3.00, 3.10},
-    {0.00, 0.00, 0.00, -2.60, 3.10},
-    {0.00, 0.00, 0.00, -2.20, 3.10},
-    {0.00, 0.00, 0.00, -1.80, 3.10},
-    {0.00, 0.00, 0.00, -1.40, 3.10},
-    {0.00, 0.00, 0.00, -1.00, 3.10},
-    {0.00, 0.00, 0.00, -0.60, 3.10},
-    {0.00, 0.00, 0.00, -0.20, 3.10},
-    {0.00, 0.00, 0.00, 0.20, 3.10},
-    {0.00, 0.00, 0.00, 0.60, 3.10},
-    {0.00, 0.00, 0.00, 1.00, 3.10},
-    {0.00, 0.00, 0.00, 1.40, 3.10},
-    {0.00, 0.00, 0.00, 1.80, 3.10},
-    {0.00, 0.00, 0.00, 2.20, 3.10},
-    {0.00, 0.00, 0.00, 2.60, 3.10},
-    {0.00, 0.00, 0.00, 3.00, 3.10},
-    {0.00, 0.00, 0.00, 3.40, 3.10},
-    {0.00, 0.00, 0.00, 3.80, 3.10},
-    {0.00, 0.00, 0.00, 4.20, 3.10},
-    {0.00, 0.00, 0.00, 4.60, 3.10},
-    {0.00, 0.00, 0.00, 5.00, 3.10},
-    {0.00, 0.00, 0.00, 5.40, 3.10},
-    {0.00, 0.00, 0.00, 5.80, 3.10},
-    {0.00, 0.00, 0.00, 6.20, 3.10},
-    {0.00, 0.00, 0.00, 6.60, 3.10},
-    {0.00, 0.00, 0.00, 7.00, 3.10},
-    {0.00, 0.00, 0.00, 7.40, 3.10},
-    {0.00, 0.00, 0.00, 7.80, 3.10},
-    {0.00, 0.00, 0.00, 8.20, 3.10},
-    {0.00, 0.00, 0.00, 8.60, 3.10},
-    {0.00, 0.00, 0.00, 9.00, 3.10},
-    {0.00, 0.00, 0.00, 9.40, 3.10},
-    {0.00, 0.00, 0.00, 9.80, 3.10},
-    {0.00, 0.00, 0.00, 10.20, 3.10},
-    {0.00, 0.00, 0.00, 10.60, 3.10},
-    {0.00, 0.00, 0.00, 11.00, 3.10},
-    {0.00, 0.00, 0.00, 11.40, 3.10},
-    {0.00, 0.00, 0.00, 11.80, 3.10},
-    {0.00, 0.00, 0.00, 12.20, 3.10},
-    {0.00, 0.00, 0.00, 12.60, 3.10},
-    {0.00, 0.00, 0.00, 13.00, 3.10},
-    {0.00, 0.00, 0.00, 13.40, 3.10},
-    {0.00, 0.00, 0.00, 13.80, 3.10},
-    {0.00, 0.00, 0.00, 14.20, 3.10},
-    {0.00, 0.00, 0.00, 14.60, 3.10},
-    {0.00, 0.00, 0.00, 15.00, 3.10},
-    {0.00, 0.00, 0.00, 15.40, 3.10},
-    {0.00, 0.00, 0.00, 15.80, 3.10},
-    {0.00, 0.00, 0.00, 16.20, 3.10},
-    {0.00, 0.00, 0.00, 16.60, 3.10},
-    {0.00, 0.00, 0.00, 17.00, 3.10},
-    {0.00, 0.00, 0.00, 17.40, 3.10},
-    {0.00, 0.00, 0.00, 17.80, 3.10},
-    {0.00, 0.00, 0.00, 18.20, 3.10},
-    {0.00, 0.00, 0.00, 18.60, 3.10},
-    {0.00, 0.00, 0.00, 19.00, 3.10},
-    {0.00, 0.00, 0.00, 19.40, 3.10},
-    {0.00, 0.00, 0.00, 19.80, 3.10},
-    {0.00, 0.00, 0.00, 20.20, 3.10},
-    {0.00, 0.00, 0.00, 20.60, 3.10},
-    {0.00, 0.00, 0.00, 21.00, 3.10},
-    {0.00, 0.00, 0.00, 21.40, 3.10},
-    {0.00, 0.00, 0.00, 21.80, 3.10},
-    {0.00, 0.00, 0.00, 22.20, 3.10},
-    {0.00, 0.00, 0.00, 22.60, 3.10},
-    {0.00, 0.00, 0.00, 23.00, 3.10},
-    {0.00, 0.00, 0.00, 23.40, 3.10},
-    {0.00, 0.00, 0.00, 23.80, 3.10},
-    {0.00, 0.00, 0.00, 24.20, 3.10},
-    {0.00, 0.00, 0.00, 24.60, 3.10},
-    {0.00, 0.00, 0.00, 25.00, 3.10},
-    {0.00, 0.00, 0.00, 25.40, 3.10},
-    {0.00, 0.00, 0.00, 25.80, 3.10},
-    {0.00, 0.00, 0.00, 26.20, 3.10},
-    {0.00, 0.00, 0.00, 26.60, 3.10},
-    {0.00, 0.00, 0.00, 27.00, 3.10},
-    {0.00, 0.00, 0.00, 27.40, 3.10},
-    {0.00, 0.00, 0.00, 27.80, 3.10},
-    {0.00, 0.00, 0.00, 28.20, 3.10},
-    {0.00, 0.00, 0.00, 28.60, 3.10},
-    {0.00, 0.00, 0.00, 29.00, 3.10},
-    {0.00, 0.00, 0.00, 29.40, 3.10},
-    {0.00, 0.00, 0.00, 29.80, 3.10},
-    {0.00, 0.00, 0.00, 30.20, 3.10},
-    {0.00, 0.00, 0.00, 30.60, 3.10},
-    {0.00, 0.00, 0.00, 31.00, 3.10},
-    {0.00, 0.00, 0.00, 31.40, 3.10},
-    {0.00, 0.00, 0.00, 31.80, 3.10},
-    {0.00, 0.00, 0.00, 32.20, 3.10},
-    {0.00, 0.00, 0.00, 32.60, 3.10},
-    {0.00, 0.00, 0.00, 33.00, 3.10},
-    {0.00, 0.00, 0.00, 33.40, 3.10},
-    {0.00, 0.00, 0.00, 33.80, 3.10},
-    {0.00, 0.00, 0.00, 34.20, 3.10},
-    {0.00, 0.00, 0.00, 34.60, 3.10},
-    {0.00, 0.00, 0.00, 35.00, 3.10},
-    {0.00, 0.00, 0.00, 35.40, 3.10},
-    {0.00, 0.00, 0.00, 35.80, 3.10},
-    {0.00, 0.00, 0.00, 36.20, 3.10},
-    {0.00, 0.00, 0.00, 36.60, 3.10},
-    {0.00, 0.00, 0.00, 37.00, 3.10},
-    {0.00, 0.00, 0.00, 37.40, 3.10},
-    {0.00, 0.00, 0.00, 37.80, 3.10},
-    {0.00, 0.00, 0.00, 38.20, 3.10},
-    {0.00, 0.00, 0.00, 38.60, 3.10},
-    {0.00, 0.00, 0.00, 39.00, 3.10},
-    {0.00, 0.00, 0.00, 39.40, 3.10},
-    {0.00, 0.00, 0.00, 39.80, 3.10},
-    {0.00, 0.00, 0.00, 40.20, 3.10},
-    {0.00, 0.00, 0.00, 40.60, 3.10},
-    {0.00, 0.00, 0.00, 41.00, 3.10},
-    {0.00, 0.00, 0.00, 41.40, 3.10},
-    {0.00, 0.00, 0.00, 41.80, 3.10},
-    {0.00, 0.00, 0.00, 42.20, 3.10},
-    {0.00, 0.00, 0.00, 42.60, 3.10},
-    {0.00, 0.00, 0.00, 43.00, 3.10},
-    {0.00, 0.00, 0.00, 43.40, 3.10},
-    {0.00, 0.00, 0.00, 43.80, 3.10},
-    {0.00, 0.00, 0.00, 44.20, 3.10},
-    {0.00, 0.00, 0.00, 44.60, 3.10},
-    {0.00, 0.00, 0.00, 45.00, 3.10},
-    {0.00, 0.00, 0.00, 45.40, 3.10},
-    {0.00, 0.00, 0.00, 45.80, 3.10},
-    {0.00, 0.00, 0.00, 46.20, 3.10},
-    {0.00, 0.00, 0.00, 46.60, 3.10},
-    {0.00, 0.00, 0.00, 47.00, 3.10},
-    {0.00, 0.00, 0.00, 47.40, 3.10},
-    {0.00, 0.00, 0.00, 47.80, 3.10},
-    {0.00, 0.00, 0.00, 48.20, 3.10},
-    {0.00, 0.00, 0.00, 48.60, 3.10},
-    {0.00, 0.00, 0.00, 49.00, 3.10},
-    {0.00, 0.00, 0.00, 49.40, 3.10},
-    {0.00, 0.00, 0.00, 49.80, 3.10},
-    {0.00, 0.00, 0.00, 50.20, 3.10},
-    {0.00, 0.00, 0.00, 50.60, 3.10},
-    {0.00, 0.00, 0.00, 51.00, 3.10},
-    {0.00, 0.00, 0.00, 51.40, 3.10},
-    {0.00, 0.00, 0.00, 51.80, 3.10},
-    {0.00, 0.00, 0.00, 52.20, 3.10},
-    {0.00, 0.00, 0.00, 52.60, 3.10},
-    {0.00, 0.00, 0.00, 53.00, 3.10},
-    {0.00, 0.00, 0.00, 53.40, 3.10},
-    {0.00, 0.00, 0.00, 53.80, 3.10},
-    {0.00, 0.00, 0.00, 54.20, 3.10},
-    {0.00, 0.00, 0.00, 54.60, 3.10},
-    {0.00, 0.00, 0.00, 55.00, 3.10},
-    {0.00, 0.00, 0.00, 55.40, 3.10},
-    {0.00, 0.00, 0.00, 55.80, 3.10},
-    {0.00, 0.00, 0.00, 56.20, 3.10},
-    {0.00, 0.00, 0.00, 56.60, 3.10},
-    {0.00, 0.00, 0.00, 57.00, 3.10},
-    {0.00, 0.00, 0.00, 57.40, 3.10},
-    {0.00, 0.00, 0.00, 57.80, 3.10},
-    {0.00, 0.00, 0.00, 58.20, 3.10},
-    {0.00, 0.00, 0.00, 58.60, 3.10},
-    {0.00, 0.00, 0.00, 59.00, 3.10},
-    {0.00, 0.00, 0.00, 59.40, 3.10},
-    {0.00, 0.00, 0.00, 59.80, 3.10},
-    {0.00, 0.00, 0.00, -59.80, 3.30},
-    {0.00, 0.00, 0.00, -59.40, 3.30},
-    {0.00, 0.00, 0.00, -59.00, 3.30},
-    {0.00, 0.00, 0.00, -58.60, 3.30},
-    {0.00, 0.00, 0.00, -58.20, 3.30},
-    {0.00, 0.00, 0.00, -57.80, 3.30},
-    {0.00, 0.00, 0.00, -57.40, 3.30},
-    {0.00, 0.00, 0.00, -57.00, 3.30},
-    {0.00, 0.00, 0.00, -56.60, 3.30},
-    {0.00, 0.00, 0.00, -56.20, 3.30},
-    {0.00, 0.00, 0.00, -55.80, 3.30},
-    {0.00, 0.00, 0.00, -55.40, 3.30},
-    {0.00, 0.00, 0.00, -55.00, 3.30},
-    {0.00, 0.00, 0.00, -54.60, 3.30},
-    {0.00, 0.00, 0.00, -54.20, 3.30},
-    {0.00, 0.00, 0.00, -53.80, 3.30},
-    {0.00, 0.00, 0.00, -53.40, 3.30},
-    {0.00, 0.00, 0.00, -53.00, 3.30},
-    {0.00, 0.00, 0.00, -52.60, 3.30},
-    {0.00, 0.00, 0.00, -52.20, 3.30},
-    {0.00, 0.00, 0.00, -51.80, 3.30},
-    {0.00, 0.00, 0.00, -51.40, 3.30},
-    {0.00, 0.00, 0.00, -51.00, 3.30},
-    {0.00, 0.00, 0.00, -50.60, 3.30},
-    {0.00, 0.00, 0.00, -50.20, 3.30},
-    {0.00, 0.00, 0.00, -49.80, 3.30},
-    {0.00, 0.00, 0.00, -49.40, 3.30},
-    {0.00, 0.00, 0.00, -49.00, 3.30},
-    {0.00, 0.00, 0.00, -48.60, 3.30},
-    {0.00, 0.00, 0.00, -48.20, 3.30},
-    {0.00, 0.00, 0.00, -47.80, 3.30},
-    {0.00, 0.00, 0.00, -47.40, 3.30},
-    {0.00, 0.00, 0.00, -47.00, 3.30},
-    {0.00, 0.00, 0.00, -46.60, 3.30},
-    {0.00, 0.00, 0.00, -46.20, 3.30},
-    {0.00, 0.00, 0.00, -45.80, 3.30},
-    {0.00, 0.00, 0.00, -45.40, 3.30},
-    {0.00, 0.00, 0.00, -45.00, 3.30},
-    {0.00, 0.00, 0.00, -44.60, 3.30},
-    {0.00, 0.00, 0.00, -44.20, 3.30},
-    {0.00, 0.00, 0.00, -43.80, 3.30},
-    {0.00, 0.00, 0.00, -43.40, 3.30},
-    {0.00, 0.00, 0.00, -43.00, 3.30},
-    {0.00, 0.00, 0.00, -42.60, 3.30},
-    {0.00, 0.00, 0.00, -42.20, 3.30},
-    {0.00, 0.00, 0.00, -41.80, 3.30},
-    {0.00, 0.00, 0.00, -41.40, 3.30},
-    {0.00, 0.00, 0.00, -41.00, 3.30},
-    {0.00, 0.00, 0.00, -40.60, 3.30},
-    {0.00, 0.00, 0.00, -40.20, 3.30},
-    {0.00, 0.00, 0.00, -39.80, 3.30},
-    {0.00, 0.00, 0.00, -39.40, 3.30},
-    {0.00, 0.00, 0.00, -39.00, 3.30},
-    {0.00, 0.00, 0.00, -38.60, 3.30},
-    {0.00, 0.00, 0.00, -38.20, 3.30},
-    {0.00, 0.00, 0.00, -37.80, 3.30},
-    {0.00, 0.00, 0.00, -37.40, 3.30},
-    {0.00, 0.00, 0.00, -37.00, 3.30},
-    {0.00, 0.00, 0.00, -36.60, 3.30},
-    {0.00, 0.00, 0.00, -36.20, 3.30},
-    {0.00, 0.00, 0.00, -35.80, 3.30},
-    {0.00, 0.00, 0.00, -35.40, 3.30},
-    {0.00, 0.00, 0.00, -35.00, 3.30},
-    {0.00, 0.00, 0.00, -34.60, 3.30},
-    {0.00, 0.00, 0.00, -34.20, 3.30},
-    {0.00, 0.00, 0.00, -33.80, 3.30},
-    {0.00, 0.00, 0.00, -33.40, 3.30},
-    {0.00, 0.00, 0.00, -33.00, 3.30},
-    {0.00, 0.00, 0.00, -32.60, 3.30},
-    {0.00, 0.00, 0.00, -32.20, 3.30},
-    {0.00, 0.00, 0.00, -31.80, 3.30},
-    {0.00, 0.00, 0.00, -31.40, 3.30},
-    {0.00, 0.00, 0.00, -31.00, 3.30},
-    {0.00, 0.00, 0.00, -30.60, 3.30},
-    {0.00, 0.00, 0.00, -30.20, 3.30},
-    {0.00, 0.00, 0.00, -29.80, 3.30},
-    {0.00, 0.00, 0.00, -29.40, 3.30},
-    {0.00, 0.00, 0.00, -29.00, 3.30},
-    {0.00, 0.00, 0.00, -28.60, 3.30},
-    {0.00, 0.00, 0.00, -28.20, 3.30},
-    {0.00, 0.00, 0.00, -27.80, 3.30},
-    {0.00, 0.00, 0.00, -27.40, 3.30},
-    {0.00, 0.00, 0.00, -27.00, 3.30},
-    {0.00, 0.00, 0.00, -26.60, 3.30},
-    {0.00, 0.00, 0.00, -26.20, 3.30},
-    {0.00, 0.00, 0.00, -25.80, 3.30},
-    {0.00, 0.00, 0.00, -25.40, 3.30},
-    {0.00, 0.00, 0.00, -25.00, 3.30},
-    {0.00, 0.00, 0.00, -24.60, 3.30},
-    {0.00, 0.00, 0.00, -24.20, 3.30},
-    {0.00, 0.00, 0.00, -23.80, 3.30},
-    {0.00, 0.00, 0.00, -23.40, 3.30},
-    {0.00, 0.00, 0.00, -23.00, 3.30},
-    {0.00, 0.00, 0.00, -22.60, 3.30},
-    {0.00, 0.00, 0.00, -22.20, 3.30},
-    {0.00, 0.00, 0.00, -21.80, 3.30},
-    {0.00, 0.00, 0.00, -21.40, 3.30},
-    {0.00, 0.00, 0.00, -21.00, 3.30},
-    {0.00, 0.00, 0.00, -20.60, 3.30},
-    {0.00, 0.00, 0.00, -20.20, 3.30},
-    {0.00, 0.00, 0.00, -19.80, 3.30},
-    {0.00, 0.00, 0.00, -19.40, 3.30},
-    {0.00, 0.00, 0.00, -19.00, 3.30},
-    {0.00, 0.00, 0.00, -18.60, 3.30},
-    {0.00, 0.00, 0.00, -18.20, 3.30},
-    {0.00, 0.00, 0.00, -17.80, 3.30},
-    {0.00, 0.00, 0.00, -17.40, 3.30},
-    {0.00, 0.00, 0.00, -17.00, 3.30},
-    {0.00, 0.00, 0.00, -16.60, 3.30},
-    {0.00, 0.00, 0.00, -16.20, 3.30},
-    {0.00, 0.00, 0.00, -15.80, 3.30},
-    {0.00, 0.00, 0.00, -15.40, 3.30},
-    {0.00, 0.00, 0.00, -15.00, 3.30},
-    {0.00, 0.00, 0.00, -14.60, 3.30},
-    {0.00, 0.00, 0.00, -14.20, 3.30},
-    {0.00, 0.00, 0.00, -13.80, 3.30},
-    {0.00, 0.00, 0.00, -13.40, 3.30},
-    {0.00, 0.00, 0.00, -13.00, 3.30},
-    {0.00, 0.00, 0.00, -12.60, 3.30},
-    {0.00, 0.00, 0.00, -12.20, 3.30},
-    {0.00, 0.00, 0.00, -11.80, 3.30},
-    {0.00, 0.00, 0.00, -11.40, 3.30},
-    {0.00, 0.00, 0.00, -11.00, 3.30},
-    {0.00, 0.00, 0.00, -10.60, 3.30},
-    {0.00, 0.00, 0.00, -10.20, 3.30},
-    {0.00, 0.00, 0.00, -9.80, 3.30},
-    {0.00, 0.00, 0.00, -9.40, 3.30},
-    {0.00, 0.00, 0.00, -9.00, 3.30},
-    {0.00, 0.00, 0.00, -8.60, 3.30},
-    {0.00, 0.00, 0.00, -8.20, 3.30},
-    {0.00, 0.00, 0.00, -7.80, 3.30},
-    {0.00, 0.00, 0.00, -7.40, 3.30},
-    {0.00, 0.00, 0.00, -7.00, 3.30},
-    {0.00, 0.00, 0.00, -6.60, 3.30},
-    {0.00, 0.00, 0.00, -6.20, 3.30},
-    {0.00, 0.00, 0.00, -5.80, 3.30},
-    {0.00, 0.00, 0.00, -5.40, 3.30},
-    {0.00, 0.00, 0.00, -5.00, 3.30},
-    {0.00, 0.00, 0.00, -4.60, 3.30},
-    {0.00, 0.00, 0.00, -4.20, 3.30},
-    {0.00, 0.00, 0.00, -3.80, 3.30},
-    {0.00, 0.00, 0.00, -3.40, 3.30},
-    {0.00, 0.00, 0.00, -3.00, 3.30},
-    {0.00, 0.00, 0.00, -2.60, 3.30},
-    {0.00, 0.00, 0.00, -2.20, 3.30},
-    {0.00, 0.00, 0.00, -1.80, 3.30},
-    {0.00, 0.00, 0.00, -1.40, 3.30},
-    {0.00, 0.00, 0.00, -1.00, 3.30},
-    {0.00, 0.00, 0.00, -0.60, 3.30},
-    {0.00, 0.00, 0.00, -0.20, 3.30},
-    {0.00, 0.00, 0.00, 0.20, 3.30},
-    {0.00, 0.00, 0.00, 0.60, 3.30},
-    {0.00, 0.00, 0.00, 1.00, 3.30},
-    {0.00, 0.00, 0.00, 1.40, 3.30},
-    {0.00, 0.00, 0.00, 1.80, 3.30},
-    {0.00, 0.00, 0.00, 2.20, 3.30},
-    {0.00, 0.00, 0.00, 2.60, 3.30},
-    {0.00, 0.00, 0.00, 3.00, 3.30},
-    {0.00, 0.00, 0.00, 3.40, 3.30},
-    {0.00, 0.00, 0.00, 3.80, 3.30},
-    {0.00, 0.00, 0.00, 4.20, 3.30},
-    {0.00, 0.00, 0.00, 4.60, 3.30},
-    {0.00, 0.00, 0.00, 5.00, 3.30},
-    {0.00, 0.00, 0.00, 5.40, 3.30},
-    {0.00, 0.00, 0.00, 5.80, 3.30},
-    {0.00, 0.00, 0.00, 6.20, 3.30},
-    {0.00, 0.00, 0.00, 6.60, 3.30},
-    {0.00, 0.00, 0.00, 7.00, 3.30},
-    {0.00, 0.00, 0.00, 7.40, 3.30},
-    {0.00, 0.00, 0.00, 7.80, 3.30},
-    {0.00, 0.00, 0.00, 8.20, 3.30},
-    {0.00, 0.00, 0.00, 8.60, 3.30},
-    {0.00, 0.00, 0.00, 9.00, 3.30},
-    {0.00, 0.00, 0.00, 9.40, 3.30},
-    {0.00, 0.00, 0.00, 9.80, 3.30},
-    {0.00, 0.00, 0.00, 10.20, 3.30},
-    {0.00, 0.00, 0.00, 10.60, 3.30},
-    {0.00, 0.00, 0.00, 11.00, 3.30},
-    {0.00, 0.00, 0.00, 11.40, 3.30},
-    {0.00, 0.00, 0.00, 11.80, 3.30},
-    {0.00, 0.00, 0.00, 12.20, 3.30},
-    {0.00, 0.00, 0.00, 12.60, 3.30},
-    {0.00, 0.00, 0.00, 13.00, 3.30},
-    {0.00, 0.00, 0.00, 13.40, 3.30},
-    {0.00, 0.00, 0.00, 13.80, 3.30},
-    {0.00, 0.00, 0.00, 14.20, 3.30},
-    {0.00, 0.00, 0.00, 14.60, 3.30},
-    {0.00, 0.00, 0.00, 15.00, 3.30},
-    {0.00, 0.00, 0.00, 15.40, 3.30},
-    {0.00, 0.00, 0.00, 15.80, 3.30},
-    {0.00, 0.00, 0.00, 16.20, 3.30},
-    {0.00, 0.00, 0.00, 16.60, 3.30},
-    {0.00, 0.00, 0.00, 17.00, 3.30},
-    {0.00, 0.00, 0.00, 17.40, 3.30},
-    {0.00, 0.00, 0.00, 17.80, 3.30},
-    {0.00, 0.00, 0.00, 18.20, 3.30},
-    {0.00, 0.00, 0.00, 18.60, 3.30},
-    {0.00, 0.00, 0.00, 19.00, 3.30},
-    {0.00, 0.00, 0.00, 19.40, 3.30},
-    {0.00, 0.00, 0.00, 19.80, 3.30},
-    {0.00, 0.00, 0.00, 20.20, 3.30},
-    {0.00, 0.00, 0.00, 20.60, 3.30},
-    {0.00, 0.00, 0.00, 21.00, 3.30},
-    {0.00, 0.00, 0.00, 21.40, 3.30},
-    {0.00, 0.00, 0.00, 21.80, 3.30},
-    {0.00, 0.00, 0.00, 22.20, 3.30},
-    {0.00, 0.00, 0.00, 22.60, 3.30},
-    {0.00, 0.00, 0.00, 23.00, 3.30},
-    {0.00, 0.00, 0.00, 23.40, 3.30},
-    {0.00, 0.00, 0.00, 23.80, 3.30},
-    {0.00, 0.00, 0.00, 24.20, 3.30},
-    {0.00, 0.00, 0.00, 24.60, 3.30},
-    {0.00, 0.00, 0.00, 25.00, 3.30},
-    {0.00, 0.00, 0.00, 25.40, 3.30},
-    {0.00, 0.00, 0.00, 25.80, 3.30},
-    {0.00, 0.00, 0.00, 26.20, 3.30},
-    {0.00, 0.00, 0.00, 26.60, 3.30},
-    {0.00, 0.00, 0.00, 27.00, 3.30},
-    {0.00, 0.00, 0.00, 27.40, 3.30},
-    {0.00, 0.00, 0.00, 27.80, 3.30},
-    {0.00, 0.00, 0.00, 28.20, 3.30},
-    {0.00, 0.00, 0.00, 28.60, 3.30},
-    {0.00, 0.00, 0.00, 29.00, 3.30},
-    {0.00, 0.00, 0.00, 29.40, 3.30},
-    {0.00, 0.00, 0.00, 29.80, 3.30},
-    {0.00, 0.00, 0.00, 30.20, 3.30},
-    {0.00, 0.00, 0.00, 30.60, 3.30},
-    {0.00, 0.00, 0.00, 31.00, 3.30},
-    {0.00, 0.00, 0.00, 31.40, 3.30},
-    {0.00, 0.00, 0.00, 31.80, 3.30},
-    {0.00, 0.00, 0.00, 32.20, 3.30},
-    {0.00, 0.00, 0.00, 32.60, 3.30},
-    {0.00, 0.00, 0.00, 33.00, 3.30},
-    {0.00, 0.00, 0.00, 33.40, 3.30},
-    {0.00, 0.00, 0.00, 33.80, 3.30},
-    {0.00, 0.00, 0.00, 34.20, 3.30},
-    {0.00, 0.00, 0.00, 34.60, 3.30},
-    {0.00, 0.00, 0.00, 35.00, 3.30},
-    {0.00, 0.00, 0.00, 35.40, 3.30},
-    {0.00, 0.00, 0.00, 35.80, 3.30},
-    {0.00, 0.00, 0.00, 36.20, 3.30},
-    {0.00, 0.00, 0.00, 36.60, 3.30},
-    {0.00, 0.00, 0.00, 37.00, 3.30},
-    {0.00, 0.00, 0.00, 37.40, 3.30},
-    {0.00, 0.00, 0.00, 37.80, 3.30},
-    {0.00, 0.00, 0.00, 38.20, 3.30},
-    {0.00, 0.00, 0.00, 38.60, 3.30},
-    {0.00, 0.00, 0.00, 39.00, 3.30},
-    {0.00, 0.00, 0.00, 39.40, 3.30},
-    {0.00, 0.00, 0.00, 39.80, 3.30},
-    {0.00, 0.00, 0.00, 40.20, 3.30},
-    {0.00, 0.00, 0.00, 40.60, 3.30},
-    {0.00, 0.00, 0.00, 41.00, 3.30},
-    {0.00, 0.00, 0.00, 41.40, 3.30},
-    {0.00, 0.00, 0.00, 41.80, 3.30},
-    {0.00, 0.00, 0.00, 42.20, 3.30},
-    {0.00, 0.00, 0.00, 42.60, 3.30},
-    {0.00, 0.00, 0.00, 43.00, 3.30},
-    {0.00, 0.00, 0.00, 43.40, 3.30},
-    {0.00, 0.00, 0.00, 43.80, 3.30},
-    {0.00, 0.00, 0.00, 44.20, 3.30},
-    {0.00, 0.00, 0.00, 44.60, 3.30},
-    {0.00, 0.00, 0.00, 45.00, 3.30},
-    {0.00, 0.00, 0.00, 45.40, 3.30},
-    {0.00, 0.00, 0.00, 45.80, 3.30},
-    {0.00, 0.00, 0.00, 46.20, 3.30},
-    {0.00, 0.00, 0.00, 46.60, 3.30},
-    {0.00, 0.00, 0.00, 47.00, 3.30},
-    {0.00, 0.00, 0.00, 47.40, 3.30},
-    {0.00, 0.00, 0.00, 47.80, 3.30},
-    {0.00, 0.00, 0.00, 48.20, 3.30},
-    {0.00, 0.00, 0.00, 48.60, 3.30},
-    {0.00, 0.00, 0.00, 49.00, 3.30},
-    {0.00, 0.00, 0.00, 49.40, 3.30},
-    {0.00, 0.00, 0.00, 49.80, 3.30},
-    {0.00, 0.00, 0.00, 50.20, 3.30},
-    {0.00, 0.00, 0.00, 50.60, 3.30},
-    {0.00, 0.00, 0.00, 51.00, 3.30},
-    {0.00, 0.00, 0.00, 51.40, 3.30},
-    {0.00, 0.00, 0.00, 51.80, 3.30},
-    {0.00, 0.00, 0.00, 52.20, 3.30},
-    {0.00, 0.00, 0.00, 52.60, 3.30},
-    {0.00, 0.00, 0.00, 53.00, 3.30},
-    {0.00, 0.00, 0.00, 53.40, 3.30},
-    {0.00, 0.00, 0.00, 53.80, 3.30},
-    {0.00, 0.00, 0.00, 54.20, 3.30},
-    {0.00, 0.00, 0.00, 54.60, 3.30},
-    {0.00, 0.00, 0.00, 55.00, 3.30},
-    {0.00, 0.00, 0.00, 55.40, 3.30},
-    {0.00, 0.00, 0.00, 55.80, 3.30},
-    {0.00, 0.00, 0.00, 56.20, 3.30},
-    {0.00, 0.00, 0.00, 56.60, 3.30},
-    {0.00, 0.00, 0.00, 57.00, 3.30},
-    {0.00, 0.00, 0.00, 57.40, 3.30},
-    {0.00, 0.00, 0.00, 57.80, 3.30},
-    {0.00, 0.00, 0.00, 58.20, 3.30},
-    {0.00, 0.00, 0.00, 58.60, 3.30},
-    {0.00, 0.00, 0.00, 59.00, 3.30},
-    {0.00, 0.00, 0.00, 59.40, 3.30},
-    {0.00, 0.00, 0.00, 59.80, 3.30},
-    {0.00, 0.00, 0.00, -59.80, 3.50},
-    {0.00, 0.00, 0.00, -59.40, 3.50},
-    {0.00, 0.00, 0.00, -59.00, 3.50},
-    {0.00, 0.00, 0.00, -58.60, 3.50},
-    {0.00, 0.00, 0.00, -58.20, 3.50},
-    {0.00, 0.00, 0.00, -57.80, 3.50},
-    {0.00, 0.00, 0.00, -57.40, 3.50},
-    {0.00, 0.00, 0.00, -57.00, 3.50},
-    {0.00, 0.00, 0.00, -56.60, 3.50},
-    {0.00, 0.00, 0.00, -56.20, 3.50},
-    {0.00, 0.00, 0.00, -55.80, 3.50},
-    {0.00, 0.00, 0.00, -55.40, 3.50},
-    {0.00, 0.00, 0.00, -55.00, 3.50},
-    {0.00, 0.00, 0.00, -54.60, 3.50},
-    {0.00, 0.00, 0.00, -54.20, 3.50},
-    {0.00, 0.00, 0.00, -53.80, 3.50},
-    {0.00, 0.00, 0.00, -53.40, 3.50},
-    {0.00, 0.00, 0.00, -53.00, 3.50},
-    {0.00, 0.00, 0.00, -52.60, 3.50},
-    {0.00, 0.00, 0.00, -52.20, 3.50},
-    {0.00, 0.00, 0.00, -51.80, 3.50},
-    {0.00, 0.00, 0.00, -51.40, 3.50},
-    {0.00, 0.00, 0.00, -51.00, 3.50},
-    {0.00, 0.00, 0.00, -50.60, 3.50},
-    {0.00, 0.00, 0.00, -50.20, 3.50},
-    {0.00, 0.00, 0.00, -49.80, 3.50},
-    {0.00, 0.00, 0.00, -49.40, 3.50},
-    {0.00, 0.00, 0.00, -49.00, 3.50},
-    {0.00, 0.00, 0.00, -48.60, 3.50},
-    {0.00, 0.00, 0.00, -48.20, 3.50},
-    {0.00, 0.00, 0.00, -47.80, 3.50},
-    {0.00, 0.00, 0.00, -47.40, 3.50},
-    {0.00, 0.00, 0.00, -47.00, 3.50},
-    {0.00, 0.00, 0.00, -46.60, 3.50},
-    {0.00, 0.00, 0.00, -46.20, 3.50},
-    {0.00, 0.00, 0.00, -45.80, 3.50},
-    {0.00, 0.00, 0.00, -45.40, 3.50},
-    {0.00, 0.00, 0.00, -45.00, 3.50},
-    {0.00, 0.00, 0.00, -44.60, 3.50},
-    {0.00, 0.00, 0.00, -44.20, 3.50},
-    {0.00, 0.00, 0.00, -43.80, 3.50},
-    {0.00, 0.00, 0.00, -43.40, 3.50},
-    {0.00, 0.00, 0.00, -43.00, 3.50},
-    {0.00, 0.00, 0.00, -42.60, 3.50},
-    {0.00, 0.00, 0.00, -42.20, 3.50},
-    {0.00, 0.00, 0.00, -41.80, 3.50},
-    {0.00, 0.00, 0.00, -41.40, 3.50},
-    {0.00, 0.00, 0.00, -41.00, 3.50},
-    {0.00, 0.00, 0.00, -40.60, 3.50},
-    {0.00, 0.00, 0.00, -40.20, 3.50},
-    {0.00, 0.00, 0.00, -39.80, 3.50},
-    {0.00, 0.00, 0.00, -39.40, 3.50},
-    {0.00, 0.00, 0.00, -39.00, 3.50},
-    {0.00, 0.00, 0.00, -38.60, 3.50},
-    {0.00, 0.00, 0.00, -38.20, 3.50},
-    {0.00, 0.00, 0.00, -37.80, 3.50},
-    {0.00, 0.00, 0.00, -37.40, 3.50},
-    {0.00, 0.00, 0.00, -37.00, 3.50},
-    {0.00, 0.00, 0.00, -36.60, 3.50},
-    {0.00, 0.00, 0.00, -36.20, 3.50},
-    {0.00, 0.00, 0.00, -35.80, 3.50},
-    {0.00, 0.00, 0.00, -35.40, 3.50},
-    {0.00, 0.00, 0.00, -35.00, 3.50},
-    {0.00, 0.00, 0.00, -34.60, 3.50},
-    {0.00, 0.00, 0.00, -34.20, 3.50},
-    {0.00, 0.00, 0.00, -33.80, 3.50},
-    {0.00, 0.00, 0.00, -33.40, 3.50},
-    {0.00, 0.00, 0.00, -33.00, 3.50},
-    {0.00, 0.00, 0.00, -32.60, 3.50},
-    {0.00, 0.00, 0.00, -32.20, 3.50},
-    {0.00, 0.00, 0.00, -31.80, 3.50},
-    {0.00, 0.00, 0.00, -31.40, 3.50},
-    {0.00, 0.00, 0.00, -31.00, 3.50},
-    {0.00, 0.00, 0.00, -30.60, 3.50},
-    {0.00, 0.00, 0.00, -30.20, 3.50},
-    {0.00, 0.00, 0.00, -29.80, 3.50},
-    {0.00, 0.00, 0.00, -29.40, 3.50},
-    {0.00, 0.00, 0.00, -29.00, 3.50},
-    {0.00, 0.00, 0.00, -28.60, 3.50},
-    {0.00, 0.00, 0.00, -28.20, 3.50},
-    {0.00, 0.00, 0.00, -27.80, 3.50},
-    {0.00, 0.00, 0.00, -27.40, 3.50},
-    {0.00, 0.00, 0.00, -27.00, 3.50},
-    {0.00, 0.00, 0.00, -26.60, 3.50},
-    {0.00, 0.00, 0.00, -26.20, 3.50},
-    {0.00, 0.00, 0.00, -25.80, 3.50},
-    {0.00, 0.00, 0.00, -25.40, 3.50},
-    {0.00, 0.00, 0.00, -25.00, 3.50},
-    {0.00, 0.00, 0.00, -24.60, 3.50},
-    {0.00, 0.00, 0.00, -24.20, 3.50},
-    {0.00, 0.00, 0.00, -23.80, 3.50},
-    {0.00, 0.00, 0.00, -23.40, 3.50},
-    {0.00, 0.00, 0.00, -23.00, 3.50},
-    {0.00, 0.00, 0.00, -22.60, 3.50},
-    {0.00, 0.00, 0.00, -22.20, 3.50},
-    {0.00, 0.00, 0.00, -21.80, 3.50},
-    {0.00, 0.00, 0.00, -21.40, 3.50},
-    {0.00, 0.00, 0.00, -21.00, 3.50},
-    {0.00, 0.00, 0.00, -20.60, 3.50},
-    {0.00, 0.00, 0.00, -20.20, 3.50},
-    {0.00, 0.00, 0.00, -19.80, 3.50},
-    {0.00, 0.00, 0.00, -19.40, 3.50},
-    {0.00, 0.00, 0.00, -19.00, 3.50},
-    {0.00, 0.00, 0.00, -18.60, 3.50},
-    {0.00, 0.00, 0.00, -18.20, 3.50},
-    {0.00, 0.00, 0.00, -17.80, 3.50},
-    {0.00, 0.00, 0.00, -17.40, 3.50},
-    {0.00, 0.00, 0.00, -17.00, 3.50},
-    {0.00, 0.00, 0.00, -16.60, 3.50},
-    {0.00, 0.00, 0.00, -16.20, 3.50},
-    {0.00, 0.00, 0.00, -15.80, 3.50},
-    {0.00, 0.00, 0.00, -15.40, 3.50},
-    {0.00, 0.00, 0.00, -15.00, 3.50},
-    {0.00, 0.00, 0.00, -14.60, 3.50},
-    {0.00, 0.00, 0.00, -14.20, 3.50},
-    {0.00, 0.00, 0.00, -13.80, 3.50},
-    {0.00, 0.00, 0.00, -13.40, 3.50},
-    {0.00, 0.00, 0.00, -13.00, 3.50},
-    {0.00, 0.00, 0.00, -12.60, 3.50},
-    {0.00, 0.00, 0.00, -12.20, 3.50},
-    {0.00, 0.00, 0.00, -11.80, 3.50},
-    {0.00, 0.00, 0.00, -11.40, 3.50},
-    {0.00, 0.00, 0.00, -11.00, 3.50},
-    {0.00, 0.00, 0.00, -10.60, 3.50},
-    {0.00, 0.00, 0.00, -10.20, 3.50},
-    {0.00, 0.00, 0.00, -9.80, 3.50},
-    {0.00, 0.00, 0.00, -9.40, 3.50},
-    {0.00, 0.00, 0.00, -9.00, 3.50},
-    {0.00, 0.00, 0.00, -8.60, 3.50},
-    {0.00, 0.00, 0.00, -8.20, 3.50},
-    {0.00, 0.00, 0.00, -7.80, 3.50},
-    {0.00, 0.00, 0.00, -7.40, 3.50},
-    {0.00, 0.00, 0.00, -7.00, 3.50},
-    {0.00, 0.00, 0.00, -6.60, 3.50},
-    {0.00, 0.00, 0.00, -6.20, 3.50},
-    {0.00, 0.00, 0.00, -5.80, 3.50},
-    {0.00, 0.00, 0.00, -5.40, 3.50},
-    {0.00, 0.00, 0.00, -5.00, 3.50},
-    {0.00, 0.00, 0.00, -4.60, 3.50},
-    {0.00, 0.00, 0.00, -4.20, 3.50},
-    {0.00, 0.00, 0.00, -3.80, 3.50},
-    {0.00, 0.00, 0.00, -3.40, 3.50},
-    {0.00, 0.00, 0.00, -3.00, 3.50},
-    {0.00, 0.00, 0.00, -2.60, 3.50},
-    {0.00, 0.00, 0.00, -2.20, 3.50},
-    {0.00, 0.00, 0.00, -1.80, 3.50},
-    {0.00, 0.00, 0.00, -1.40, 3.50},
-    {0.00, 0.00, 0.00, -1.00, 3.50},
-    {0.00, 0.00, 0.00, -0.60, 3.50},
-    {0.00, 0.00, 0.00, -0.20, 3.50},
-    {0.00, 0.00, 0.00, 0.20, 3.50},
-    {0.00, 0.00, 0.00, 0.60, 3.50},
-    {0.00, 0.00, 0.00, 1.00, 3.50},
-    {0.00, 0.00, 0.00, 1.40, 3.50},
-    {0.00, 0.00, 0.00, 1.80, 3.50},
-    {0.00, 0.00, 0.00, 2.20, 3.50},
-    {0.00, 0.00, 0.00, 2.60, 3.50},
-    {0.00, 0.00, 0.00, 3.00, 3.50},
-    {0.00, 0.00, 0.00, 3.40, 3.50},
-    {0.00, 0.00, 0.00, 3.80, 3.50},
-    {0.00, 0.00, 0.00, 4.20, 3.50},
-    {0.00, 0.00, 0.00, 4.60, 3.50},
-    {0.00, 0.00, 0.00, 5.00, 3.50},
-    {0.00, 0.00, 0.00, 5.40, 3.50},
-    {0.00, 0.00, 0.00, 5.80, 3.50},
-    {0.00, 0.00, 0.00, 6.20, 3.50},
-    {0.00, 0.00, 0.00, 6.60, 3.50},
-    {0.00, 0.00, 0.00, 7.00, 3.50},
-    {0.00, 0.00, 0.00, 7.40, 3.50},
-    {0.00, 0.00, 0.00, 7.80, 3.50},
-    {0.00, 0.00, 0.00, 8.20, 3.50},
-    {0.00, 0.00, 0.00, 8.60, 3.50},
-    {0.00, 0.00, 0.00, 9.00, 3.50},
-    {0.00, 0.00, 0.00, 9.40, 3.50},
-    {0.00, 0.00, 0.00, 9.80, 3.50},
-    {0.00, 0.00, 0.00, 10.20, 3.50},
-    {0.00, 0.00, 0.00, 10.60, 3.50},
-    {0.00, 0.00, 0.00, 11.00, 3.50},
-    {0.00, 0.00, 0.00, 11.40, 3.50},
-    {0.00, 0.00, 0.00, 11.80, 3.50},
-    {0.00, 0.00, 0.00, 12.20, 3.50},
-    {0.00, 0.00, 0.00, 12.60, 3.50},
-    {0.00, 0.00, 0.00, 13.00, 3.50},
-    {0.00, 0.00, 0.00, 13.40, 3.50},
-    {0.00, 0.00, 0.00, 13.80, 3.50},
-    {0.00, 0.00, 0.00, 14.20, 3.50},
-    {0.00, 0.00, 0.00, 14.60, 3.50},
-    {0.00, 0.00, 0.00, 15.00, 3.50},
-    {0.00, 0.00, 0.00, 15.40, 3.50},
-    {0.00, 0.00, 0.00, 15.80, 3.50},
-    {0.00, 0.00, 0.00, 16.20, 3.50},
-    {0.00, 0.00, 0.00, 16.60, 3.50},
-    {0.00, 0.00, 0.00, 17.00, 3.50},
-    {0.00, 0.00, 0.00, 17.40, 3.50},
-    {0.00, 0.00, 0.00, 17.80, 3.50},
-    {0.00, 0.00, 0.00, 18.20, 3.50},
-    {0.00, 0.00, 0.00, 18.60, 3.50},
-    {0.00, 0.00, 0.00, 19.00, 3.50},
-    {0.00, 0.00, 0.00, 19.40, 3.50},
-    {0.00, 0.00, 0.00, 19.80, 3.50},
-    {0.00, 0.00, 0.00, 20.20, 3.50},
-    {0.00, 0.00, 0.00, 20.60, 3.50},
-    {0.00, 0.00, 0.00, 21.00, 3.50},
-    {0.00, 0.00, 0.00, 21.40, 3.50},
-    {0.00, 0.00, 0.00, 21.80, 3.50},
-    {0.00, 0.00, 0.00, 22.20, 3.50},
-    {0.00, 0.00, 0.00, 22.60, 3.50},
-    {0.00, 0.00, 0.00, 23.00, 3.50},
-    {0.00, 0.00, 0.00, 23.40, 3.50},
-    {0.00, 0.00, 0.00, 23.80, 3.50},
-    {0.00, 0.00, 0.00, 24.20, 3.50},
-    {0.00, 0.00, 0.00, 24.60, 3.50},
-    {0.00, 0.00, 0.00, 25.00, 3.50},
-    {0.00, 0.00, 0.00, 25.40, 3.50},
-    {0.00, 0.00, 0.00, 25.80, 3.50},
-    {0.00, 0.00, 0.00, 26.20, 3.50},
-    {0.00, 0.00, 0.00, 26.60, 3.50},
-    {0.00, 0.00, 0.00, 27.00, 3.50},
-    {0.00, 0.00, 0.00, 27.40, 3.50},
-    {0.00, 0.00, 0.00, 27.80, 3.50},
-    {0.00, 0.00, 0.00, 28.20, 3.50},
-    {0.00, 0.00, 0.00, 28.60, 3.50},
-    {0.00, 0.00, 0.00, 29.00, 3.50},
-    {0.00, 0.00, 0.00, 29.40, 3.50},
-    {0.00, 0.00, 0.00, 29.80, 3.50},
-    {0.00, 0.00, 0.00, 30.20, 3.50},
-    {0.00, 0.00, 0.00, 30.60, 3.50},
-    {0.00, 0.00, 0.00, 31.00, 3.50},
-    {0.00, 0.00, 0.00, 31.40, 3.50},
-    {0.00, 0.00, 0.00, 31.80, 3.50},
-    {0.00, 0.00, 0.00, 32.20, 3.50},
-    {0.00, 0.00, 0.00, 32.60, 3.50},
-    {0.00, 0.00, 0.00, 33.00, 3.50},
-    {0.00, 0.00, 0.00, 33.40, 3.50},
-    {0.00, 0.00, 0.00, 33.80, 3.50},
-    {0.00, 0.00, 0.00, 34.20, 3.50},
-    {0.00, 0.00, 0.00, 34.60, 3.50},
-    {0.00, 0.00, 0.00, 35.00, 3.50},
-    {0.00, 0.00, 0.00, 35.40, 3.50},
-    {0.00, 0.00, 0.00, 35.80, 3.50},
-    {0.00, 0.00, 0.00, 36.20, 3.50},
-    {0.00, 0.00, 0.00, 36.60, 3.50},
-    {0.00, 0.00, 0.00, 37.00, 3.50},
-    {0.00, 0.00, 0.00, 37.40, 3.50},
-    {0.00, 0.00, 0.00, 37.80, 3.50},
-    {0.00, 0.00, 0.00, 38.20, 3.50},
-    {0.00, 0.00, 0.00, 38.60, 3.50},
-    {0.00, 0.00, 0.00, 39.00, 3.50},
-    {0.00, 0.00, 0.00, 39.40, 3.50},
-    {0.00, 0.00, 0.00, 39.80, 3.50},
-    {0.00, 0.00, 0.00, 40.20, 3.50},
-    {0.00, 0.00, 0.00, 40.60, 3.50},
-    {0.00, 0.00, 0.00, 41.00, 3.50},
-    {0.00, 0.00, 0.00, 41.40, 3.50},
-    {0.00, 0.00, 0.00, 41.80, 3.50},
-    {0.00, 0.00, 0.00, 42.20, 3.50},
-    {0.00, 0.00, 0.00, 42.60, 3.50},
-    {0.00, 0.00, 0.00, 43.00, 3.50},
-    {0.00, 0.00, 0.00, 43.40, 3.50},
-    {0.00, 0.00, 0.00, 43.80, 3.50},
-    {0.00, 0.00, 0.00, 44.20, 3.50},
-    {0.00, 0.00, 0.00, 44.60, 3.50},
-    {0.00, 0.00, 0.00, 45.00, 3.50},
-    {0.00, 0.00, 0.00, 45.40, 3.50},
-    {0.00, 0.00, 0.00, 45.80, 3.50},
-    {0.00, 0.00, 0.00, 46.20, 3.50},
-    {0.00, 0.00, 0.00, 46.60, 3.50},
-    {0.00, 0.00, 0.00, 47.00, 3.50},
-    {0.00, 0.00, 0.00, 47.40, 3.50},
-    {0.00, 0.00, 0.00, 47.80, 3.50},
-    {0.00, 0.00, 0.00, 48.20, 3.50},
-    {0.00, 0.00, 0.00, 48.60, 3.50},
-    {0.00, 0.00, 0.00, 49.00, 3.50},
-    {0.00, 0.00, 0.00, 49.40, 3.50},
-    {0.00, 0.00, 0.00, 49.80, 3.50},
-    {0.00, 0.00, 0.00, 50.20, 3.50},
-    {0.00, 0.00, 0.00, 50.60, 3.50},
-    {0.00, 0.00, 0.00, 51.00, 3.50},
-    {0.00, 0.00, 0.00, 51.40, 3.50},
-    {0.00, 0.00, 0.00, 51.80, 3.50},
-    {0.00, 0.00, 0.00, 52.20, 3.50},
-    {0.00, 0.00, 0.00, 52.60, 3.50},
-    {0.00, 0.00, 0.00, 53.00, 3.50},
-    {0.00, 0.00, 0.00, 53.40, 3.50},
-    {0.00, 0.00, 0.00, 53.80, 3.50},
-    {0.00, 0.00, 0.00, 54.20, 3.50},
-    {0.00, 0.00, 0.00, 54.60, 3.50},
-    {0.00, 0.00, 0.00, 55.00, 3.50},
-    {0.00, 0.00, 0.00, 55.40, 3.50},
-    {0.00, 0.00, 0.00, 55.80, 3.50},
-    {0.00, 0.00, 0.00, 56.20, 3.50},
-    {0.00, 0.00, 0.00, 56.60, 3.50},
-    {0.00, 0.00, 0.00, 57.00, 3.50},
-    {0.00, 0.00, 0.00, 57.40, 3.50},
-    {0.00, 0.00, 0.00, 57.80, 3.50},
-    {0.00, 0.00, 0.00, 58.20, 3.50},
-    {0.00, 0.00, 0.00, 58.60, 3.50},
-    {0.00, 0.00, 0.00, 59.00, 3.50},
-    {0.00, 0.00, 0.00, 59.40, 3.50},
-    {0.00, 0.00, 0.00, 59.80, 3.50},
-    {0.00, 0.00, 0.00, -59.80, 3.70},
-    {0.00, 0.00, 0.00, -59.40, 3.70},
-    {0.00, 0.00, 0.00, -59.00, 3.70},
-    {0.00, 0.00, 0.00, -58.60, 3.70},
-    {0.00, 0.00, 0.00, -58.20, 3.70},
-    {0.00, 0.00, 0.00, -57.80, 3.70},
-    {0.00, 0.00, 0.00, -57.40, 3.70},
-    {0.00, 0.00, 0.00, -57.00, 3.70},
-    {0.00, 0.00, 0.00, -56.60, 3.70},
-    {0.00, 0.00, 0.00, -56.20, 3.70},
-    {0.00, 0.00, 0.00, -55.80, 3.70},
-    {0.00, 0.00, 0.00, -55.40, 3.70},
-    {0.00, 0.00, 0.00, -55.00, 3.70},
-    {0.00, 0.00, 0.00, -54.60, 3.70},
-    {0.00, 0.00, 0.00, -54.20, 3.70},
-    {0.00, 0.00, 0.00, -53.80, 3.70},
-    {0.00, 0.00, 0.00, -53.40, 3.70},
-    {0.00, 0.00, 0.00, -53.00, 3.70},
-    {0.00, 0.00, 0.00, -52.60, 3.70},
-    {0.00, 0.00, 0.00, -52.20, 3.70},
-    {0.00, 0.00, 0.00, -51.80, 3.70},
-    {0.00, 0.00, 0.00, -51.40, 3.70},
-    {0.00, 0.00, 0.00, -51.00, 3.70},
-    {0.00, 0.00, 0.00, -50.60, 3.70},
-    {0.00, 0.00, 0.00, -50.20, 3.70},
-    {0.00, 0.00, 0.00, -49.80, 3.70},
-    {0.00, 0.00, 0.00, -49.40, 3.70},
-    {0.00, 0.00, 0.00, -49.00, 3.70},
-    {0.00, 0.00, 0.00, -48.60, 3.70},
-    {0.00, 0.00, 0.00, -48.20, 3.70},
-    {0.00, 0.00, 0.00, -47.80, 3.70},
-    {0.00, 0.00, 0.00, -47.40, 3.70},
-    {0.00, 0.00, 0.00, -47.00, 3.70},
-    {0.00, 0.00, 0.00, -46.60, 3.70},
-    {0.00, 0.00, 0.00, -46.20, 3.70},
-    {0.00, 0.00, 0.00, -45.80, 3.70},
-    {0.00, 0.00, 0.00, -45.40, 3.70},
-    {0.00, 0.00, 0.00, -45.00, 3.70},
-    {0.00, 0.00, 0.00, -44.60, 3.70},
-    {0.00, 0.00, 0.00, -44.20, 3.70},
-    {0.00, 0.00, 0.00, -43.80, 3.70},
-    {0.00, 0.00, 0.00, -43.40, 3.70},
-    {0.00, 0.00, 0.00, -43.00, 3.70},
-    {0.00, 0.00, 0.00, -42.60, 3.70},
-    {0.00, 0.00, 0.00, -42.20, 3.70},
-    {0.00, 0.00, 0.00, -41.80, 3.70},
-    {0.00, 0.00, 0.00, -41.40, 3.70},
-    {0.00, 0.00, 0.00, -41.00, 3.70},
-    {0.00, 0.00, 0.00, -40.60, 3.70},
-    {0.00, 0.00, 0.00, -40.20, 3.70},
-    {0.00, 0.00, 0.00, -39.80, 3.70},
-    {0.00, 0.00, 0.00, -39.40, 3.70},
-    {0.00, 0.00, 0.00, -39.00, 3.70},
-    {0.00, 0.00, 0.00, -38.60, 3.70},
-    {0.00, 0.00, 0.00, -38.20, 3.70},
-    {0.00, 0.00, 0.00, -37.80, 3.70},
-    {0.00, 0.00, 0.00, -37.40, 3.70},
-    {0.00, 0.00, 0.00, -37.00, 3.70},
-    {0.00, 0.00, 0.00, -36.60, 3.70},
-    {0.00, 0.00, 0.00, -36.20, 3.70},
-    {0.00, 0.00, 0.00, -35.80, 3.70},
-    {0.00, 0.00, 0.00, -35.40, 3.70},
-    {0.00, 0.00, 0.00, -35.00, 3.70},
-    {0.00, 0.00, 0.00, -34.60, 3.70},
-    {0.00, 0.00, 0.00, -34.20, 3.70},
-    {0.00, 0.00, 0.00, -33.80, 3.70},
-    {0.00, 0.00, 0.00, -33.40, 3.70},
-    {0.00, 0.00, 0.00, -33.00, 3.70},
-    {0.00, 0.00, 0.00, -32.60, 3.70},
-    {0.00, 0.00, 0.00, -32.20, 3.70},
-    {0.00, 0.00, 0.00, -31.80, 3.70},
-    {0.00, 0.00, 0.00, -31.40, 3.70},
-    {0.00, 0.00, 0.00, -31.00, 3.70},
-    {0.00, 0.00, 0.00, -30.60, 3.70},
-    {0.00, 0.00, 0.00, -30.20, 3.70},
-    {0.00, 0.00, 0.00, -29.80, 3.70},
-    {0.00, 0.00, 0.00, -29.40, 3.70},
-    {0.00, 0.00, 0.00, -29.00, 3.70},
-    {0.00, 0.00, 0.00, -28.60, 3.70},
-    {0.00, 0.00, 0.00, -28.20, 3.70},
-    {0.00, 0.00, 0.00, -27.80, 3.70},
-    {0.00, 0.00, 0.00, -27.40, 3.70},
-    {0.00, 0.00, 0.00, -27.00, 3.70},
-    {0.00, 0.00, 0.00, -26.60, 3.70},
-    {0.00, 0.00, 0.00, -26.20, 3.70},
-    {0.00, 0.00, 0.00, -25.80, 3.70},
-    {0.00, 0.00, 0.00, -25.40, 3.70},
-    {0.00, 0.00, 0.00, -25.00, 3.70},
-    {0.00, 0.00, 0.00, -24.60, 3.70},
-    {0.00, 0.00, 0.00, -24.20, 3.70},
-    {0.00, 0.00, 0.00, -23.80, 3.70},
-    {0.00, 0.00, 0.00, -23.40, 3.70},
-    {0.00, 0.00, 0.00, -23.00, 3.70},
-    {0.00, 0.00, 0.00, -22.60, 3.70},
-    {0.00, 0.00, 0.00, -22.20, 3.70},
-    {0.00, 0.00, 0.00, -21.80, 3.70},
-    {0.00, 0.00, 0.00, -21.40, 3.70},
-    {0.00, 0.00, 0.00, -21.00, 3.70},
-    {0.00, 0.00, 0.00, -20.60, 3.70},
-    {0.00, 0.00, 0.00, -20.20, 3.70},
-    {0.00, 0.00, 0.00, -19.80, 3.70},
-    {0.00, 0.00, 0.00, -19.40, 3.70},
-    {0.00, 0.00, 0.00, -19.00, 3.70},
-    {0.00, 0.00, 0.00, -18.60, 3.70},
-    {0.00, 0.00, 0.00, -18.20, 3.70},
-    {0.00, 0.00, 0.00, -17.80, 3.70},
-    {0.00, 0.00, 0.00, -17.40, 3.70},
-    {0.00, 0.00, 0.00, -17.00, 3.70},
-    {0.00, 0.00, 0.00, -16.60, 3.70},
-    {0.00, 0.00, 0.00, -16.20, 3.70},
-    {0.00, 0.00, 0.00, -15.80, 3.70},
-    {0.00, 0.00, 0.00, -15.40, 3.70},
-    {0.00, 0.00, 0.00, -15.00, 3.70},
-    {0.00, 0.00, 0.00, -14.60, 3.70},
-    {0.00, 0.00, 0.00, -14.20, 3.70},
-    {0.00, 0.00, 0.00, -13.80, 3.70},
-    {0.00, 0.00, 0.00, -13.40, 3.70},
-    {0.00, 0.00, 0.00, -13.00, 3.70},
-    {0.00, 0.00, 0.00, -12.60, 3.70},
-    {0.00, 0.00, 0.00, -12.20, 3.70},
-    {0.00, 0.00, 0.00, -11.80, 3.70},
-    {0.00, 0.00, 0.00, -11.40, 3.70},
-    {0.00, 0.00, 0.00, -11.00, 3.70},
-    {0.00, 0.00, 0.00, -10.60, 3.70},
-    {0.00, 0.00, 0.00, -10.20, 3.70},
-    {0.00, 0.00, 0.00, -9.80, 3.70},
-    {0.00, 0.00, 0.00, -9.40, 3.70},
-    {0.00, 0.00, 0.00, -9.00, 3.70},
-    {0.00, 0.00, 0.00, -8.60, 3.70},
-    {0.00, 0.00, 0.00, -8.20, 3.70},
-    {0.00, 0.00, 0.00, -7.80, 3.70},
-    {0.00, 0.00, 0.00, -7.40, 3.70},
-    {0.00, 0.00, 0.00, -7.00, 3.70},
-    {0.00, 0.00, 0.00, -6.60, 3.70},
-    {0.00, 0.00, 0.00, -6.20, 3.70},
-    {0.00, 0.00, 0.00, -5.80, 3.70},
-    {0.00, 0.00, 0.00, -5.40, 3.70},
-    {0.00, 0.00, 0.00, -5.00, 3.70},
-    {0.00, 0.00, 0.00, -4.60, 3.70},
-    {0.00, 0.00, 0.00, -4.20, 3.70},
-    {0.00, 0.00, 0.00, -3.80, 3.70},
-    {0.00, 0.00, 0.00, -3.40, 3.70},
-    {0.00, 0.00, 0.00, -3.00, 3.70},
-    {0.00, 0.00, 0.00, -2.60, 3.70},
-    {0.00, 0.00, 0.00, -2.20, 3.70},
-    {0.00, 0.00, 0.00, -1.80, 3.70},
-    {0.00, 0.00, 0.00, -1.40, 3.70},
-    {0.00, 0.00, 0.00, -1.00, 3.70},
-    {0.00, 0.00, 0.00, -0.60, 3.70},
-    {0.00, 0.00, 0.00, -0.20, 3.70},
-    {0.00, 0.00, 0.00, 0.20, 3.70},
-    {0.00, 0.00, 0.00, 0.60, 3.70},
-    {0.00, 0.00, 0.00, 1.00, 3.70},
-    {0.00, 0.00, 0.00, 1.40, 3.70},
-    {0.00, 0.00, 0.00, 1.80, 3.70},
-    {0.00, 0.00, 0.00, 2.20, 3.70},
-    {0.00, 0.00, 0.00, 2.60, 3.70},
-    {0.00, 0.00, 0.00, 3.00, 3.70},
-    {0.00, 0.00, 0.00, 3.40, 3.70},
-    {0.00, 0.00, 0.00, 3.80, 3.70},
-    {0.00, 0.00, 0.00, 4.20, 3.70},
-    {0.00, 0.00, 0.00, 4.60, 3.70},
-    {0.00, 0.00, 0.00, 5.00, 3.70},
-    {0.00, 0.00, 0.00, 5.40, 3.70},
-    {0.00, 0.00, 0.00, 5.80, 3.70},
-    {0.00, 0.00, 0.00, 6.20, 3.70},
-    {0.00, 0.00, 0.00, 6.60, 3.70},
-    {0.00, 0.00, 0.00, 7.00, 3.70},
-    {0.00, 0.00, 0.00, 7.40, 3.70},
-    {0.00, 0.00, 0.00, 7.80, 3.70},
-    {0.00, 0.00, 0.00, 8.20, 3.70},
-    {0.00, 0.00, 0.00, 8.60, 3.70},
-    {0.00, 0.00, 0.00, 9.00, 3.70},
-    {0.00, 0.00, 0.00, 9.40, 3.70},
-    {0.00, 0.00, 0.00, 9.80, 3.70},
-    {0.00, 0.00, 0.00, 10.20, 3.70},
-    {0.00, 0.00, 0.00, 10.60, 3.70},
-    {0.00, 0.00, 0.00, 11.00, 3.70},
-    {0.00, 0.00, 0.00, 11.40, 3.70},
-    {0.00, 0.00, 0.00, 11.80, 3.70},
-    {0.00, 0.00, 0.00, 12.20, 3.70},
-    {0.00, 0.00, 0.00, 12.60, 3.70},
-    {0.00, 0.00, 0.00, 13.00, 3.70},
-    {0.00, 0.00, 0.00, 13.40, 3.70},
-    {0.00, 0.00, 0.00, 13.80, 3.70},
-    {0.00, 0.00, 0.00, 14.20, 3.70},
-    {0.00, 0.00, 0.00, 14.60, 3.70},
-    {0.00, 0.00, 0.00, 15.00, 3.70},
-    {0.00, 0.00, 0.00, 15.40, 3.70},
-    {0.00, 0.00, 0.00, 15.80, 3.70},
-    {0.00, 0.00, 0.00, 16.20, 3.70},
-    {0.00, 0.00, 0.00, 16.60, 3.70},
-    {0.00, 0.00, 0.00, 17.00, 3.70},
-    {0.00, 0.00, 0.00, 17.40, 3.70},
-    {0.00, 0.00, 0.00, 17.80, 3.70},
-    {0.00, 0.00, 0.00, 18.20, 3.70},
-    {0.00, 0.00, 0.00, 18.60, 3.70},
-    {0.00, 0.00, 0.00, 19.00, 3.70},
-    {0.00, 0.00, 0.00, 19.40, 3.70},
-    {0.00, 0.00, 0.00, 19.80, 3.70},
-    {0.00, 0.00, 0.00, 20.20, 3.70},
-    {0.00, 0.00, 0.00, 20.60, 3.70},
-    {0.00, 0.00, 0.00, 21.00, 3.70},
-    {0.00, 0.00, 0.00, 21.40, 3.70},
-    {0.00, 0.00, 0.00, 21.80, 3.70},
-    {0.00, 0.00, 0.00, 22.20, 3.70},
-    {0.00, 0.00, 0.00, 22.60, 3.70},
-    {0.00, 0.00, 0.00, 23.00, 3.70},
-    {0.00, 0.00, 0.00, 23.40, 3.70},
-    {0.00, 0.00, 0.00, 23.80, 3.70},
-    {0.00, 0.00, 0.00, 24.20, 3.70},
-    {0.00, 0.00, 0.00, 24.60, 3.70},
-    {0.00, 0.00, 0.00, 25.00, 3.70},
-    {0.00, 0.00, 0.00, 25.40, 3.70},
-    {0.00, 0.00, 0.00, 25.80, 3.70},
-    {0.00, 0.00, 0.00, 26.20, 3.70},
-    {0.00, 0.00, 0.00, 26.60, 3.70},
-    {0.00, 0.00, 0.00, 27.00, 3.70},
-    {0.00, 0.00, 0.00, 27.40, 3.70},
-    {0.00, 0.00, 0.00, 27.80, 3.70},
-    {0.00, 0.00, 0.00, 28.20, 3.70},
-    {0.00, 0.00, 0.00, 28.60, 3.70},
-    {0.00, 0.00, 0.00, 29.00, 3.70},
-    {0.00, 0.00, 0.00, 29.40, 3.70},
-    {0.00, 0.00, 0.00, 29.80, 3.70},
-    {0.00, 0.00, 0.00, 30.20, 3.70},
-    {0.00, 0.00, 0.00, 30.60, 3.70},
-    {0.00, 0.00, 0.00, 31.00, 3.70},
-    {0.00, 0.00, 0.00, 31.40, 3.70},
-    {0.00, 0.00, 0.00, 31.80, 3.70},
-    {0.00, 0.00, 0.00, 32.20, 3.70},
-    {0.00, 0.00, 0.00, 32.60, 3.70},
-    {0.00, 0.00, 0.00, 33.00, 3.70},
-    {0.00, 0.00, 0.00, 33.40, 3.70},
-    {0.00, 0.00, 0.00, 33.80, 3.70},
-    {0.00, 0.00, 0.00, 34.20, 3.70},
-    {0.00, 0.00, 0.00, 34.60, 3.70},
-    {0.00, 0.00, 0.00, 35.00, 3.70},
-    {0.00, 0.00, 0.00, 35.40, 3.70},
-    {0.00, 0.00, 0.00, 35.80, 3.70},
-    {0.00, 0.00, 0.00, 36.20, 3.70},
-    {0.00, 0.00, 0.00, 36.60, 3.70},
-    {0.00, 0.00, 0.00, 37.00, 3.70},
-    {0.00, 0.00, 0.00, 37.40, 3.70},
-    {0.00, 0.00, 0.00, 37.80, 3.70},
-    {0.00, 0.00, 0.00, 38.20, 3.70},
-    {0.00, 0.00, 0.00, 38.60, 3.70},
-    {0.00, 0.00, 0.00, 39.00, 3.70},
-    {0.00, 0.00, 0.00, 39.40, 3.70},
-    {0.00, 0.00, 0.00, 39.80, 3.70},
-    {0.00, 0.00, 0.00, 40.20, 3.70},
-    {0.00, 0.00, 0.00, 40.60, 3.70},
-    {0.00, 0.00, 0.00, 41.00, 3.70},
-    {0.00, 0.00, 0.00, 41.40, 3.70},
-    {0.00, 0.00, 0.00, 41.80, 3.70},
-    {0.00, 0.00, 0.00, 42.20, 3.70},
-    {0.00, 0.00, 0.00, 42.60, 3.70},
-    {0.00, 0.00, 0.00, 43.00, 3.70},
-    {0.00, 0.00, 0.00, 43.40, 3.70},
-    {0.00, 0.00, 0.00, 43.80, 3.70},
-    {0.00, 0.00, 0.00, 44.20, 3.70},
-    {0.00, 0.00, 0.00, 44.60, 3.70},
-    {0.00, 0.00, 0.00, 45.00, 3.70},
-    {0.00, 0.00, 0.00, 45.40, 3.70},
-    {0.00, 0.00, 0.00, 45.80, 3.70},
-    {0.00, 0.00, 0.00, 46.20, 3.70},
-    {0.00, 0.00, 0.00, 46.60, 3.70},
-    {0.00, 0.00, 0.00, 47.00, 3.70},
-    {0.00, 0.00, 0.00, 47.40, 3.70},
-    {0.00, 0.00, 0.00, 47.80, 3.70},
-    {0.00, 0.00, 0.00, 48.20, 3.70},
-    {0.00, 0.00, 0.00, 48.60, 3.70},
-    {0.00, 0.00, 0.00, 49.00, 3.70},
-    {0.00, 0.00, 0.00, 49.40, 3.70},
-    {0.00, 0.00, 0.00, 49.80, 3.70},
-    {0.00, 0.00, 0.00, 50.20, 3.70},
-    {0.00, 0.00, 0.00, 50.60, 3.70},
-    {0.00, 0.00, 0.00, 51.00, 3.70},
-    {0.00, 0.00, 0.00, 51.40, 3.70},
-    {0.00, 0.00, 0.00, 51.80, 3.70},
-    {0.00, 0.00, 0.00, 52.20, 3.70},
-    {0.00, 0.00, 0.00, 52.60, 3.70},
-    {0.00, 0.00, 0.00, 53.00, 3.70},
-    {0.00, 0.00, 0.00, 53.40, 3.70},
-    {0.00, 0.00, 0.00, 53.80, 3.70},
-    {0.00, 0.00, 0.00, 54.20, 3.70},
-    {0.00, 0.00, 0.00, 54.60, 3.70},
-    {0.00, 0.00, 0.00, 55.00, 3.70},
-    {0.00, 0.00, 0.00, 55.40, 3.70},
-    {0.00, 0.00, 0.00, 55.80, 3.70},
-    {0.00, 0.00, 0.00, 56.20, 3.70},
-    {0.00, 0.00, 0.00, 56.60, 3.70},
-    {0.00, 0.00, 0.00, 57.00, 3.70},
-    {0.00, 0.00, 0.00, 57.40, 3.70},
-    {0.00, 0.00, 0.00, 57.80, 3.70},
-    {0.00, 0.00, 0.00, 58.20, 3.70},
-    {0.00, 0.00, 0.00, 58.60, 3.70},
-    {0.00, 0.00, 0.00, 59.00, 3.70},
-    {0.00, 0.00, 0.00, 59.40, 3.70},
-    {0.00, 0.00, 0.00, 59.80, 3.70},
-    {0.00, 0.00, 0.00, -59.80, 3.90},
-    {0.00, 0.00, 0.00, -59.40, 3.90},
-    {0.00, 0.00, 0.00, -59.00, 3.90},
-    {0.00, 0.00, 0.00, -58.60, 3.90},
-    {0.00, 0.00, 0.00, -58.20, 3.90},
-    {0.00, 0.00, 0.00, -57.80, 3.90},
-    {0.00, 0.00, 0.00, -57.40, 3.90},
-    {0.00, 0.00, 0.00, -57.00, 3.90},
-    {0.00, 0.00, 0.00, -56.60, 3.90},
-    {0.00, 0.00, 0.00, -56.20, 3.90},
-    {0.00, 0.00, 0.00, -55.80, 3.90},
-    {0.00, 0.00, 0.00, -55.40, 3.90},
-    {0.00, 0.00, 0.00, -55.00, 3.90},
-    {0.00, 0.00, 0.00, -54.60, 3.90},
-    {0.00, 0.00, 0.00, -54.20, 3.90},
-    {0.00, 0.00, 0.00, -53.80, 3.90},
-    {0.00, 0.00, 0.00, -53.40, 3.90},
-    {0.00, 0.00, 0.00, -53.00, 3.90},
-    {0.00, 0.00, 0.00, -52.60, 3.90},
-    {0.00, 0.00, 0.00, -52.20, 3.90},
-    {0.00, 0.00, 0.00, -51.80, 3.90},
-    {0.00, 0.00, 0.00, -51.40, 3.90},
-    {0.00, 0.00, 0.00, -51.00, 3.90},
-    {0.00, 0.00, 0.00, -50.60, 3.90},
-    {0.00, 0.00, 0.00, -50.20, 3.90},
-    {0.00, 0.00, 0.00, -49.80, 3.90},
-    {0.00, 0.00, 0.00, -49.40, 3.90},
-    {0.00, 0.00, 0.00, -49.00, 3.90},
-    {0.00, 0.00, 0.00, -48.60, 3.90},
-    {0.00, 0.00, 0.00, -48.20, 3.90},
-    {0.00, 0.00, 0.00, -47.80, 3.90},
-    {0.00, 0.00, 0.00, -47.40, 3.90},
-    {0.00, 0.00, 0.00, -47.00, 3.90},
-    {0.00, 0.00, 0.00, -46.60, 3.90},
-    {0.00, 0.00, 0.00, -46.20, 3.90},
-    {0.00, 0.00, 0.00, -45.80, 3.90},
-    {0.00, 0.00, 0.00, -45.40, 3.90},
-    {0.00, 0.00, 0.00, -45.00, 3.90},
-    {0.00, 0.00, 0.00, -44.60, 3.90},
-    {0.00, 0.00, 0.00, -44.20, 3.90},
-    {0.00, 0.00, 0.00, -43.80, 3.90},
-    {0.00, 0.00, 0.00, -43.40, 3.90},
-    {0.00, 0.00, 0.00, -43.00, 3.90},
-    {0.00, 0.00, 0.00, -42.60, 3.90},
-    {0.00, 0.00, 0.00, -42.20, 3.90},
-    {0.00, 0.00, 0.00, -41.80, 3.90},
-    {0.00, 0.00, 0.00, -41.40, 3.90},
-    {0.00, 0.00, 0.00, -41.00, 3.90},
-    {0.00, 0.00, 0.00, -40.60, 3.90},
-    {0.00, 0.00, 0.00, -40.20, 3.90},
-    {0.00, 0.00, 0.00, -39.80, 3.90},
-    {0.00, 0.00, 0.00, -39.40, 3.90},
-    {0.00, 0.00, 0.00, -39.00, 3.90},
-    {0.00, 0.00, 0.00, -38.60, 3.90},
-    {0.00, 0.00, 0.00, -38.20, 3.90},
-    {0.00, 0.00, 0.00, -37.80, 3.90},
-    {0.00, 0.00, 0.00, -37.40, 3.90},
-    {0.00, 0.00, 0.00, -37.00, 3.90},
-    {0.00, 0.00, 0.00, -36.60, 3.90},
-    {0.00, 0.00, 0.00, -36.20, 3.90},
-    {0.00, 0.00, 0.00, -35.80, 3.90},
-    {0.00, 0.00, 0.00, -35.40, 3.90},
-    {0.00, 0.00, 0.00, -35.00, 3.90},
-    {0.00, 0.00, 0.00, -34.60, 3.90},
-    {0.00, 0.00, 0.00, -34.20, 3.90},
-    {0.00, 0.00, 0.00, -33.80, 3.90},
-    {0.00, 0.00, 0.00, -33.40, 3.90},
-    {0.00, 0.00, 0.00, -33.00, 3.90},
-    {0.00, 0.00, 0.00, -32.60, 3.90},
-    {0.00, 0.00, 0.00, -32.20, 3.90},
-    {0.00, 0.00, 0.00, -31.80, 3.90},
-    {0.00, 0.00, 0.00, -31.40, 3.90},
-    {0.00, 0.00, 0.00, -31.00, 3.90},
-    {0.00, 0.00, 0.00, -30.60, 3.90},
-    {0.00, 0.00, 0.00, -30.20, 3.90},
-    {0.00, 0.00, 0.00, -29.80, 3.90},
-    {0.00, 0.00, 0.00, -29.40, 3.90},
-    {0.00, 0.00, 0.00, -29.00, 3.90},
-    {0.00, 0.00, 0.00, -28.60, 3.90},
-    {0.00, 0.00, 0.00, -28.20, 3.90},
-    {0.00, 0.00, 0.00, -27.80, 3.90},
-    {0.00, 0.00, 0.00, -27.40, 3.90},
-    {0.00, 0.00, 0.00, -27.00, 3.90},
-    {0.00, 0.00, 0.00, -26.60, 3.90},
-    {0.00, 0.00, 0.00, -26.20, 3.90},
-    {0.00, 0.00, 0.00, -25.80, 3.90},
-    {0.00, 0.00, 0.00, -25.40, 3.90},
-    {0.00, 0.00, 0.00, -25.00, 3.90},
-    {0.00, 0.00, 0.00, -24.60, 3.90},
-    {0.00, 0.00, 0.00, -24.20, 3.90},
-    {0.00, 0.00, 0.00, -23.80, 3.90},
-    {0.00, 0.00, 0.00, -23.40, 3.90},
-    {0.00, 0.00, 0.00, -23.00, 3.90},
-    {0.00, 0.00, 0.00, -22.60, 3.90},
-    {0.00, 0.00, 0.00, -22.20, 3.90},
-    {0.00, 0.00, 0.00, -21.80, 3.90},
-    {0.00, 0.00, 0.00, -21.40, 3.90},
-    {0.00, 0.00, 0.00, -21.00, 3.90},
-    {0.00, 0.00, 0.00, -20.60, 3.90},
-    {0.00, 0.00, 0.00, -20.20, 3.90},
-    {0.00, 0.00, 0.00, -19.80, 3.90},
-    {0.00, 0.00, 0.00, -19.40, 3.90},
-    {0.00, 0.00, 0.00, -19.00, 3.90},
-    {0.00, 0.00, 0.00, -18.60, 3.90},
-    {0.00, 0.00, 0.00, -18.20, 3.90},
-    {0.00, 0.00, 0.00, -17.80, 3.90},
-    {0.00, 0.00, 0.00, -17.40, 3.90},
-    {0.00, 0.00, 0.00, -17.00, 3.90},
-    {0.00, 0.00, 0.00, -16.60, 3.90},
-    {0.00, 0.00, 0.00, -16.20, 3.90},
-    {0.00, 0.00, 0.00, -15.80, 3.90},
-    {0.00, 0.00, 0.00, -15.40, 3.90},
-    {0.00, 0.00, 0.00, -15.00, 3.90},
-    {0.00, 0.00, 0.00, -14.60, 3.90},
-    {0.00, 0.00, 0.00, -14.20, 3.90},
-    {0.00, 0.00, 0.00, -13.80, 3.90},
-    {0.00, 0.00, 0.00, -13.40, 3.90},
-    {0.00, 0.00, 0.00, -13.00, 3.90},
-    {0.00, 0.00, 0.00, -12.60, 3.90},
-    {0.00, 0.00, 0.00, -12.20, 3.90},
-    {0.00, 0.00, 0.00, -11.80, 3.90},
-    {0.00, 0.00, 0.00, -11.40, 3.90},
-    {0.00, 0.00, 0.00, -11.00, 3.90},
-    {0.00, 0.00, 0.00, -10.60, 3.90},
-    {0.00, 0.00, 0.00, -10.20, 3.90},
-    {0.00, 0.00, 0.00, -9.80, 3.90},
-    {0.00, 0.00, 0.00, -9.40, 3.90},
-    {0.00, 0.00, 0.00, -9.00, 3.90},
-    {0.00, 0.00, 0.00, -8.60, 3.90},
-    {0.00, 0.00, 0.00, -8.20, 3.90},
-    {0.00, 0.00, 0.00, -7.80, 3.90},
-    {0.00, 0.00, 0.00, -7.40, 3.90},
-    {0.00, 0.00, 0.00, -7.00, 3.90},
-    {0.00, 0.00, 0.00, -6.60, 3.90},
-    {0.00, 0.00, 0.00, -6.20, 3.90},
-    {0.00, 0.00, 0.00, -5.80, 3.90},
-    {0.00, 0.00, 0.00, -5.40, 3.90},
-    {0.00, 0.00, 0.00, -5.00, 3.90},
-    {0.00, 0.00, 0.00, -4.60, 3.90},
-    {0.00, 0.00, 0.00, -4.20, 3.90},
-    {0.00, 0.00, 0.00, -3.80, 3.90},
-    {0.00, 0.00, 0.00, -3.40, 3.90},
-    {0.00, 0.00, 0.00, -3.00, 3.90},
-    {0.00, 0.00, 0.00, -2.60, 3.90},
-    {0.00, 0.00, 0.00, -2.20, 3.90},
-    {0.00, 0.00, 0.00, -1.80, 3.90},
-    {0.00, 0.00, 0.00, -1.40, 3.90},
-    {0.00, 0.00, 0.00, -1.00, 3.90},
-    {0.00, 0.00, 0.00, -0.60, 3.90},
-    {0.00, 0.00, 0.00, -0.20, 3.90},
-    {0.00, 0.00, 0.00, 0.20, 3.90},
-    {0.00, 0.00, 0.00, 0.60, 3.90},
-    {0.00, 0.00, 0.00, 1.00, 3.90},
-    {0.00, 0.00, 0.00, 1.40, 3.90},
-    {0.00, 0.00, 0.00, 1.80, 3.90},
-    {0.00, 0.00, 0.00, 2.20, 3.90},
-    {0.00, 0.00, 0.00, 2.60, 3.90},
-    {0.00, 0.00, 0.00, 3.00, 3.90},
-    {0.00, 0.00, 0.00, 3.40, 3.90},
-    {0.00, 0.00, 0.00, 3.80, 3.90},
-    {0.00, 0.00, 0.00, 4.20, 3.90},
-    {0.00, 0.00, 0.00, 4.60, 3.90},
-    {0.00, 0.00, 0.00, 5.00, 3.90},
-    {0.00, 0.00, 0.00, 5.40, 3.90},
-    {0.00, 0.00, 0.00, 5.80, 3.90},
-    {0.00, 0.00, 0.00, 6.20, 3.90},
-    {0.00, 0.00, 0.00, 6.60, 3.90},
-    {0.00, 0.00, 0.00, 7.00, 3.90},
-    {0.00, 0.00, 0.00, 7.40, 3.90},
-    {0.00, 0.00, 0.00, 7.80, 3.90},
-    {0.00, 0.00, 0.00, 8.20, 3.90},
-    {0.00, 0.00, 0.00, 8.60, 3.90},
-    {0.00, 0.00, 0.00, 9.00, 3.90},
-    {0.00, 0.00, 0.00, 9.40, 3.90},
-    {0.00, 0.00, 0.00, 9.80, 3.90},
-    {0.00, 0.00, 0.00, 10.20, 3.90},
-    {0.00, 0.00, 0.00, 10.60, 3.90},
-    {0.00, 0.00, 0.00, 11.00, 3.90},
-    {0.00, 0.00, 0.00, 11.40, 3.90},
-    {0.00, 0.00, 0.00, 11.80, 3.90},
-    {0.00, 0.00, 0.00, 12.20, 3.90},
-    {0.00, 0.00, 0.00, 12.60, 3.90},
-    {0.00, 0.00, 0.00, 13.00, 3.90},
-    {0.00, 0.00, 0.00, 13.40, 3.90},
-    {0.00, 0.00, 0.00, 13.80, 3.90},
-    {0.00, 0.00, 0.00, 14.20, 3.90},
-    {0.00, 0.00, 0.00, 14.60, 3.90},
-    {0.00, 0.00, 0.00, 15.00, 3.90},
-    {0.00, 0.00, 0.00, 15.40, 3.90},
-    {0.00, 0.00, 0.00, 15.80, 3.90},
-    {0.00, 0.00, 0.00, 16.20, 3.90},
-    {0.00, 0.00, 0.00, 16.60, 3.90},
-    {0.00, 0.00, 0.00, 17.00, 3.90},
-    {0.00, 0.00, 0.00, 17.40, 3.90},
-    {0.00, 0.00, 0.00, 17.80, 3.90},
-    {0.00, 0.00, 0.00, 18.20, 3.90},
-    {0.00, 0.00, 0.00, 18.60, 3.90},
-    {0.00, 0.00, 0.00, 19.00, 3.90},
-    {0.00, 0.00, 0.00, 19.40, 3.90},
-    {0.00, 0.00, 0.00, 19.80, 3.90},
-    {0.00, 0.00, 0.00, 20.20, 3.90},
-    {0.00, 0.00, 0.00, 20.60, 3.90},
-    {0.00, 0.00, 0.00, 21.00, 3.90},
-    {0.00, 0.00, 0.00, 21.40, 3.90},
-    {0.00, 0.00, 0.00, 21.80, 3.90},
-    {0.00, 0.00, 0.00, 22.20, 3.90},
-    {0.00, 0.00, 0.00, 22.60, 3.90},
-    {0.00, 0.00, 0.00, 23.00, 3.90},
-    {0.00, 0.00, 0.00, 23.40, 3.90},
-    {0.00, 0.00, 0.00, 23.80, 3.90},
-    {0.00, 0.00, 0.00, 24.20, 3.90},
-    {0.00, 0.00, 0.00, 24.60, 3.90},
-    {0.00, 0.00, 0.00, 25.00, 3.90},
-    {0.00, 0.00, 0.00, 25.40, 3.90},
-    {0.00, 0.00, 0.00, 25.80, 3.90},
-    {0.00, 0.00, 0.00, 26.20, 3.90},
-    {0.00, 0.00, 0.00, 26.60, 3.90},
-    {0.00, 0.00, 0.00, 27.00, 3.90},
-    {0.00, 0.00, 0.00, 27.40, 3.90},
-    {0.00, 0.00, 0.00, 27.80, 3.90},
-    {0.00, 0.00, 0.00, 28.20, 3.90},
-    {0.00, 0.00, 0.00, 28.60, 3.90},
-    {0.00, 0.00, 0.00, 29.00, 3.90},
-    {0.00, 0.00, 0.00, 29.40, 3.90},
-    {0.00, 0.00, 0.00, 29.80, 3.90},
-    {0.00, 0.00, 0.00, 30.20, 3.90},
-    {0.00, 0.00, 0.00, 30.60, 3.90},
-    {0.00, 0.00, 0.00, 31.00, 3.90},
-    {0.00, 0.00, 0.00, 31.40, 3.90},
-    {0.00, 0.00, 0.00, 31.80, 3.90},
-    {0.00, 0.00, 0.00, 32.20, 3.90},
-    {0.00, 0.00, 0.00, 32.60, 3.90},
-    {0.00, 0.00, 0.00, 33.00, 3.90},
-    {0.00, 0.00, 0.00, 33.40, 3.90},
-    {0.00, 0.00, 0.00, 33.80, 3.90},
-    {0.00, 0.00, 0.00, 34.20, 3.90},
-    {0.00, 0.00, 0.00, 34.60, 3.90},
-    {0.00, 0.00, 0.00, 35.00, 3.90},
-    {0.00, 0.00, 0.00, 35.40, 3.90},
-    {0.00, 0.00, 0.00, 35.80, 3.90},
-    {0.00, 0.00, 0.00, 36.20, 3.90},
-    {0.00, 0.00, 0.00, 36.60, 3.90},
-    {0.00, 0.00, 0.00, 37.00, 3.90},
-    {0.00, 0.00, 0.00, 37.40, 3.90},
-    {0.00, 0.00, 0.00, 37.80, 3.90},
-    {0.00, 0.00, 0.00, 38.20, 3.90},
-    {0.00, 0.00, 0.00, 38.60, 3.90},
-    {0.00, 0.00, 0.00, 39.00, 3.90},
-    {0.00, 0.00, 0.00, 39.40, 3.90},
-    {0.00, 0.00, 0.00, 39.80, 3.90},
-    {0.00, 0.00, 0.00, 40.20, 3.90},
-    {0.00, 0.00, 0.00, 40.60, 3.90},
-    {0.00, 0.00, 0.00, 41.00, 3.90},
-    {0.00, 0.00, 0.00, 41.40, 3.90},
-    {0.00, 0.00, 0.00, 41.80, 3.90},
-    {0.00, 0.00, 0.00, 42.20, 3.90},
-    {0.00, 0.00, 0.00, 42.60, 3.90},
-    {0.00, 0.00, 0.00, 43.00, 3.90},
-    {0.00, 0.00, 0.00, 43.40, 3.90},
-    {0.00, 0.00, 0.00, 43.80, 3.90},
-    {0.00, 0.00, 0.00, 44.20, 3.90},
-    {0.00, 0.00, 0.00, 44.60, 3.90},
-    {0.00, 0.00, 0.00, 45.00, 3.90},
-    {0.00, 0.00, 0.00, 45.40, 3.90},
-    {0.00, 0.00, 0.00, 45.80, 3.90},
-    {0.00, 0.00, 0.00, 46.20, 3.90},
-    {0.00, 0.00, 0.00, 46.60, 3.90},
-    {0.00, 0.00, 0.00, 47.00, 3.90},
-    {0.00, 0.00, 0.00, 47.40, 3.90},
-    {0.00, 0.00, 0.00, 47.80, 3.90},
-    {0.00, 0.00, 0.00, 48.20, 3.90},
-    {0.00, 0.00, 0.00, 48.60, 3.90},
-    {0.00, 0.00, 0.00, 49.00, 3.90},
-    {0.00, 0.00, 0.00, 49.40, 3.90},
-    {0.00, 0.00, 0.00, 49.80, 3.90},
-    {0.00, 0.00, 0.00, 50.20, 3.90},
-    {0.00, 0.00, 0.00, 50.60, 3.90},
-    {0.00, 0.00, 0.00, 51.00, 3.90},
-    {0.00, 0.00, 0.00, 51.40, 3.90},
-    {0.00, 0.00, 0.00, 51.80, 3.90},
-    {0.00, 0.00, 0.00, 52.20, 3.90},
-    {0.00, 0.00, 0.00, 52.60, 3.90},
-    {0.00, 0.00, 0.00, 53.00, 3.90},
-    {0.00, 0.00, 0.00, 53.40, 3.90},
-    {0.00, 0.00, 0.00, 53.80, 3.90},
-    {0.00, 0.00, 0.00, 54.20, 3.90},
-    {0.00, 0.00, 0.00, 54.60, 3.90},
-    {0.00, 0.00, 0.00, 55.00, 3.90},
-    {0.00, 0.00, 0.00, 55.40, 3.90},
-    {0.00, 0.00, 0.00, 55.80, 3.90},
-    {0.00, 0.00, 0.00, 56.20, 3.90},
-    {0.00, 0.00, 0.00, 56.60, 3.90},
-    {0.00, 0.00, 0.00, 57.00, 3.90},
-    {0.00, 0.00, 0.00, 57.40, 3.90},
-    {0.00, 0.00, 0.00, 57.80, 3.90},
-    {0.00, 0.00, 0.00, 58.20, 3.90},
-    {0.00, 0.00, 0.00, 58.60, 3.90},
-    {0.00, 0.00, 0.00, 59.00, 3.90},
-    {0.00, 0.00, 0.00, 59.40, 3.90},
-    {0.00, 0.00, 0.00, 59.80, 3.90},
-    {0.00, 0.00, 0.00, -59.80, 4.10},
-    {0.00, 0.00, 0.00, -59.40, 4.10},
-    {0.00, 0.00, 0.00, -59.00, 4.10},
-    {0.00, 0.00, 0.00, -58.60, 4.10},
-    {0.00, 0.00, 0.00, -58.20, 4.10},
-    {0.00, 0.00, 0.00, -57.80, 4.10},
-    {0.00, 0.00, 0.00, -57.40, 4.10},
-    {0.00, 0.00, 0.00, -57.00, 4.10},
-    {0.00, 0.00, 0.00, -56.60, 4.10},
-    {0.00, 0.00, 0.00, -56.20, 4.10},
-    {0.00, 0.00, 0.00, -55.80, 4.10},
-    {0.00, 0.00, 0.00, -55.40, 4.10},
-    {0.00, 0.00, 0.00, -55.00, 4.10},
-    {0.00, 0.00, 0.00, -54.60, 4.10},
-    {0.00, 0.00, 0.00, -54.20, 4.10},
-    {0.00, 0.00, 0.00, -53.80, 4.10},
-    {0.00, 0.00, 0.00, -53.40, 4.10},
-    {0.00, 0.00, 0.00, -53.00, 4.10},
-    {0.00, 0.00, 0.00, -52.60, 4.10},
-    {0.00, 0.00, 0.00, -52.20, 4.10},
-    {0.00, 0.00, 0.00, -51.80, 4.10},
-    {0.00, 0.00, 0.00, -51.40, 4.10},
-    {0.00, 0.00, 0.00, -51.00, 4.10},
-    {0.00, 0.00, 0.00, -50.60, 4.10},
-    {0.00, 0.00, 0.00, -50.20, 4.10},
-    {0.00, 0.00, 0.00, -49.80, 4.10},
-    {0.00, 0.00, 0.00, -49.40, 4.10},
-    {0.00, 0.00, 0.00, -49.00, 4.10},
-    {0.00, 0.00, 0.00, -48.60, 4.10},
-    {0.00, 0.00, 0.00, -48.20, 4.10},
-    {0.00, 0.00, 0.00, -47.80, 4.10},
-    {0.00, 0.00, 0.00, -47.40, 4.10},
-    {0.00, 0.00, 0.00, -47.00, 4.10},
-    {0.00, 0.00, 0.00, -46.60, 4.10},
-    {0.00, 0.00, 0.00, -46.20, 4.10},
-    {0.00, 0.00, 0.00, -45.80, 4.10},
-    {0.00, 0.00, 0.00, -45.40, 4.10},
-    {0.00, 0.00, 0.00, -45.00, 4.10},
-    {0.00, 0.00, 0.00, -44.60, 4.10},
-    {0.00, 0.00, 0.00, -44.20, 4.10},
-    {0.00, 0.00, 0.00, -43.80, 4.10},
-    {0.00, 0.00, 0.00, -43.40, 4.10},
-    {0.00, 0.00, 0.00, -43.00, 4.10},
-    {0.00, 0.00, 0.00, -42.60, 4.10},
-    {0.00, 0.00, 0.00, -42.20, 4.10},
-    {0.00, 0.00, 0.00, -41.80, 4.10},
-    {0.00, 0.00, 0.00, -41.40, 4.10},
-    {0.00, 0.00, 0.00, -41.00, 4.10},
-    {0.00, 0.00, 0.00, -40.60, 4.10},
-    {0.00, 0.00, 0.00, -40.20, 4.10},
-    {0.00, 0.00, 0.00, -39.80, 4.10},
-    {0.00, 0.00, 0.00, -39.40, 4.10},
-    {0.00, 0.00, 0.00, -39.00, 4.10},
-    {0.00, 0.00, 0.00, -38.60, 4.10},
-    {0.00, 0.00, 0.00, -38.20, 4.10},
-    {0.00, 0.00, 0.00, -37.80, 4.10},
-    {0.00, 0.00, 0.00, -37.40, 4.10},
-    {0.00, 0.00, 0.00, -37.00, 4.10},
-    {0.00, 0.00, 0.00, -36.60, 4.10},
-    {0.00, 0.00, 0.00, -36.20, 4.10},
-    {0.00, 0.00, 0.00, -35.80, 4.10},
-    {0.00, 0.00, 0.00, -35.40, 4.10},
-    {0.00, 0.00, 0.00, -35.00, 4.10},
-    {0.00, 0.00, 0.00, -34.60, 4.10},
-    {0.00, 0.00, 0.00, -34.20, 4.10},
-    {0.00, 0.00, 0.00, -33.80, 4.10},
-    {0.00, 0.00, 0.00, -33.40, 4.10},
-    {0.00, 0.00, 0.00, -33.00, 4.10},
-    {0.00, 0.00, 0.00, -32.60, 4.10},
-    {0.00, 0.00, 0.00, -32.20, 4.10},
-    {0.00, 0.00, 0.00, -31.80, 4.10},
-    {0.00, 0.00, 0.00, -31.40, 4.10},
-    {0.00, 0.00, 0.00, -31.00, 4.10},
-    {0.00, 0.00, 0.00, -30.60, 4.10},
-    {0.00, 0.00, 0.00, -30.20, 4.10},
-    {0.00, 0.00, 0.00, -29.80, 4.10},
-    {0.00, 0.00, 0.00, -29.40, 4.10},
-    {0.00, 0.00, 0.00, -29.00, 4.10},
-    {0.00, 0.00, 0.00, -28.60, 4.10},
-    {0.00, 0.00, 0.00, -28.20, 4.10},
-    {0.00, 0.00, 0.00, -27.80, 4.10},
-    {0.00, 0.00, 0.00, -27.40, 4.10},
-    {0.00, 0.00, 0.00, -27.00, 4.10},
-    {0.00, 0.00, 0.00, -26.60, 4.10},
-    {0.00, 0.00, 0.00, -26.20, 4.10},
-    {0.00, 0.00, 0.00, -25.80, 4.10},
-    {0.00, 0.00, 0.00, -25.40, 4.10},
-    {0.00, 0.00, 0.00, -25.00, 4.10},
-    {0.00, 0.00, 0.00, -24.60, 4.10},
-    {0.00, 0.00, 0.00, -24.20, 4.10},
-    {0.00, 0.00, 0.00, -23.80, 4.10},
-    {0.00, 0.00, 0.00, -23.40, 4.10},
-    {0.00, 0.00, 0.00, -23.00, 4.10},
-    {0.00, 0.00, 0.00, -22.60, 4.10},
-    {0.00, 0.00, 0.00, -22.20, 4.10},
-    {0.00, 0.00, 0.00, -21.80, 4.10},
-    {0.00, 0.00, 0.00, -21.40, 4.10},
-    {0.00, 0.00, 0.00, -21.00, 4.10},
-    {0.00, 0.00, 0.00, -20.60, 4.10},
-    {0.00, 0.00, 0.00, -20.20, 4.10},
-    {0.00, 0.00, 0.00, -19.80, 4.10},
-    {0.00, 0.00, 0.00, -19.40, 4.10},
-    {0.00, 0.00, 0.00, -19.00, 4.10},
-    {0.00, 0.00, 0.00, -18.60, 4.10},
-    {0.00, 0.00, 0.00, -18.20, 4.10},
-    {0.00, 0.00, 0.00, -17.80, 4.10},
-    {0.00, 0.00, 0.00, -17.40, 4.10},
-    {0.00, 0.00, 0.00, -17.00, 4.10},
-    {0.00, 0.00, 0.00, -16.60, 4.10},
-    {0.00, 0.00, 0.00, -16.20, 4.10},
-    {0.00, 0.00, 0.00, -15.80, 4.10},
-    {0.00, 0.00, 0.00, -15.40, 4.10},
-    {0.00, 0.00, 0.00, -15.00, 4.10},
-    {0.00, 0.00, 0.00, -14.60, 4.10},
-    {0.00, 0.00, 0.00, -14.20, 4.10},
-    {0.00, 0.00, 0.00, -13.80, 4.10},
-    {0.00, 0.00, 0.00, -13.40, 4.10},
-    {0.00, 0.00, 0.00, -13.00, 4.10},
-    {0.00, 0.00, 0.00, -12.60, 4.10},
-    {0.00, 0.00, 0.00, -12.20, 4.10},
-    {0.00, 0.00, 0.00, -11.80, 4.10},
-    {0.00, 0.00, 0.00, -11.40, 4.10},
-    {0.00, 0.00, 0.00, -11.00, 4.10},
-    {0.00, 0.00, 0.00, -10.60, 4.10},
-    {0.00, 0.00, 0.00, -10.20, 4.10},
-    {0.00, 0.00, 0.00, -9.80, 4.10},
-    {0.00, 0.00, 0.00, -9.40, 4.10},
-    {0.00, 0.00, 0.00, -9.00, 4.10},
-    {0.00, 0.00, 0.00, -8.60, 4.10},
-    {0.00, 0.00, 0.00, -8.20, 4.10},
-    {0.00, 0.00, 0.00, -7.80, 4.10},
-    {0.00, 0.00, 0.00, -7.40, 4.10},
-    {0.00, 0.00, 0.00, -7.00, 4.10},
-    {0.00, 0.00, 0.00, -6.60, 4.10},
-    {0.00, 0.00, 0.00, -6.20, 4.10},
-    {0.00, 0.00, 0.00, -5.80, 4.10},
-    {0.00, 0.00, 0.00, -5.40, 4.10},
-    {0.00, 0.00, 0.00, -5.00, 4.10},
-    {0.00, 0.00, 0.00, -4.60, 4.10},
-    {0.00, 0.00, 0.00, -4.20, 4.10},
-    {0.00, 0.00, 0.00, -3.80, 4.10},
-    {0.00, 0.00, 0.00, -3.40, 4.10},
-    {0.00, 0.00, 0.00, -3.00, 4.10},
-    {0.00, 0.00, 0.00, -2.60, 4.10},
-    {0.00, 0.00, 0.00, -2.20, 4.10},
-    {0.00, 0.00, 0.00, -1.80, 4.10},
-    {0.00, 0.00, 0.00, -1.40, 4.10},
-    {0.00, 0.00, 0.00, -1.00, 4.10},
-    {0.00, 0.00, 0.00, -0.60, 4.10},
-    {0.00, 0.00, 0.00, -0.20, 4.10},
-    {0.00, 0.00, 0.00, 0.20, 4.10},
-    {0.00, 0.00, 0.00, 0.60, 4.10},
-    {0.00, 0.00, 0.00, 1.00, 4.10},
-    {0.00, 0.00, 0.00, 1.40, 4.10},
-    {0.00, 0.00, 0.00, 1.80, 4.10},
-    {0.00, 0.00, 0.00, 2.20, 4.10},
-    {0.00, 0.00, 0.00, 2.60, 4.10},
-    {0.00, 0.00, 0.00, 3.00, 4.10},
-    {0.00, 0.00, 0.00, 3.40, 4.10},
-    {0.00, 0.00, 0.00, 3.80, 4.10},
-    {0.00, 0.00, 0.00, 4.20, 4.10},
-    {0.00, 0.00, 0.00, 4.60, 4.10},
-    {0.00, 0.00, 0.00, 5.00, 4.10},
-    {0.00, 0.00, 0.00, 5.40, 4.10},
-    {0.00, 0.00, 0.00, 5.80, 4.10},
-    {0.00, 0.00, 0.00, 6.20, 4.10},
-    {0.00, 0.00, 0.00, 6.60, 4.10},
-    {0.00, 0.00, 0.00, 7.00, 4.10},
-    {0.00, 0.00, 0.00, 7.40, 4.10},
-    {0.00, 0.00, 0.00, 7.80, 4.10},
-    {0.00, 0.00, 0.00, 8.20, 4.10},
-    {0.00, 0.00, 0.00, 8.60, 4.10},
-    {0.00, 0.00, 0.00, 9.00, 4.10},
-    {0.00, 0.00, 0.00, 9.40, 4.10},
-    {0.00, 0.00, 0.00, 9.80, 4.10},
-    {0.00, 0.00, 0.00, 10.20, 4.10},
-    {0.00, 0.00, 0.00, 10.60, 4.10},
-    {0.00, 0.00, 0.00, 11.00, 4.10},
-    {0.00, 0.00, 0.00, 11.40, 4.10},
-    {0.00, 0.00, 0.00, 11.80, 4.10},
-    {0.00, 0.00, 0.00, 12.20, 4.10},
-    {0.00, 0.00, 0.00, 12.60, 4.10},
-    {0.00, 0.00, 0.00, 13.00, 4.10},
-    {0.00, 0.00, 0.00, 13.40, 4.10},
-    {0.00, 0.00, 0.00, 13.80, 4.10},
-    {0.00, 0.00, 0.00, 14.20, 4.10},
-    {0.00, 0.00, 0.00, 14.60, 4.10},
-    {0.00, 0.00, 0.00, 15.00, 4.10},
-    {0.00, 0.00, 0.00, 15.40, 4.10},
-    {0.00, 0.00, 0.00, 15.80, 4.10},
-    {0.00, 0.00, 0.00, 16.20, 4.10},
-    {0.00, 0.00, 0.00, 16.60, 4.10},
-    {0.00, 0.00, 0.00, 17.00, 4.10},
-    {0.00, 0.00, 0.00, 17.40, 4.10},
-    {0.00, 0.00, 0.00, 17.80, 4.10},
-    {0.00, 0.00, 0.00, 18.20, 4.10},
-    {0.00, 0.00, 0.00, 18.60, 4.10},
-    {0.00, 0.00, 0.00, 19.00, 4.10},
-    {0.00, 0.00, 0.00, 19.40, 4.10},
-    {0.00, 0.00, 0.00, 19.80, 4.10},
-    {0.00, 0.00, 0.00, 20.20, 4.10},
-    {0.00, 0.00, 0.00, 20.60, 4.10},
-    {0.00, 0.00, 0.00, 21.00, 4.10},
-    {0.00, 0.00, 0.00, 21.40, 4.10},
-    {0.00, 0.00, 0.00, 21.80, 4.10},
-    {0.00, 0.00, 0.00, 22.20, 4.10},
-    {0.00, 0.00, 0.00, 22.60, 4.10},
-    {0.00, 0.00, 0.00, 23.00, 4.10},
-    {0.00, 0.00, 0.00, 23.40, 4.10},
-    {0.00, 0.00, 0.00, 23.80, 4.10},
-    {0.00, 0.00, 0.00, 24.20, 4.10},
-    {0.00, 0.00, 0.00, 24.60, 4.10},
-    {0.00, 0.00, 0.00, 25.00, 4.10},
-    {0.00, 0.00, 0.00, 25.40, 4.10},
-    {0.00, 0.00, 0.00, 25.80, 4.10},
-    {0.00, 0.00, 0.00, 26.20, 4.10},
-    {0.00, 0.00, 0.00, 26.60, 4.10},
-    {0.00, 0.00, 0.00, 27.00, 4.10},
-    {0.00, 0.00, 0.00, 27.40, 4.10},
-    {0.00, 0.00, 0.00, 27.80, 4.10},
-    {0.00, 0.00, 0.00, 28.20, 4.10},
-    {0.00, 0.00, 0.00, 28.60, 4.10},
-    {0.00, 0.00, 0.00, 29.00, 4.10},
-    {0.00, 0.00, 0.00, 29.40, 4.10},
-    {0.00, 0.00, 0.00, 29.80, 4.10},
-    {0.00, 0.00, 0.00, 30.20, 4.10},
-    {0.00, 0.00, 0.00, 30.60, 4.10},
-    {0.00, 0.00, 0.00, 31.00, 4.10},
-    {0.00, 0.00, 0.00, 31.40, 4.10},
-    {0.00, 0.00, 0.00, 31.80, 4.10},
-    {0.00, 0.00, 0.00, 32.20, 4.10},
-    {0.00, 0.00, 0.00, 32.60, 4.10},
-    {0.00, 0.00, 0.00, 33.00, 4.10},
-    {0.00, 0.00, 0.00, 33.40, 4.10},
-    {0.00, 0.00, 0.00, 33.80, 4.10},
-    {0.00, 0.00, 0.00, 34.20, 4.10},
-    {0.00, 0.00, 0.00, 34.60, 4.10},
-    {0.00, 0.00, 0.00, 35.00, 4.10},
-    {0.00, 0.00, 0.00, 35.40, 4.10},
-    {0.00, 0.00, 0.00, 35.80, 4.10},
-    {0.00, 0.00, 0.00, 36.20, 4.10},
-    {0.00, 0.00, 0.00, 36.60, 4.10},
-    {0.00, 0.00, 0.00, 37.00, 4.10},
-    {0.00, 0.00, 0.00, 37.40, 4.10},
-    {0.00, 0.00, 0.00, 37.80, 4.10},
-    {0.00, 0.00, 0.00, 38.20, 4.10},
-    {0.00, 0.00, 0.00, 38.60, 4.10},
-    {0.00, 0.00, 0.00, 39.00, 4.10},
-    {0.00, 0.00, 0.00, 39.40, 4.10},
-    {0.00, 0.00, 0.00, 39.80, 4.10},
-    {0.00, 0.00, 0.00, 40.20, 4.10},
-    {0.00, 0.00, 0.00, 40.60, 4.10},
-    {0.00, 0.00, 0.00, 41.00, 4.10},
-    {0.00, 0.00, 0.00, 41.40, 4.10},
-    {0.00, 0.00, 0.00, 41.80, 4.10},
-    {0.00, 0.00, 0.00, 42.20, 4.10},
-    {0.00, 0.00, 0.00, 42.60, 4.10},
-    {0.00, 0.00, 0.00, 43.00, 4.10},
-    {0.00, 0.00, 0.00, 43.40, 4.10},
-    {0.00, 0.00, 0.00, 43.80, 4.10},
-    {0.00, 0.00, 0.00, 44.20, 4.10},
-    {0.00, 0.00, 0.00, 44.60, 4.10},
-    {0.00, 0.00, 0.00, 45.00, 4.10},
-    {0.00, 0.00, 0.00, 45.40, 4.10},
-    {0.00, 0.00, 0.00, 45.80, 4.10},
-    {0.00, 0.00, 0.00, 46.20, 4.10},
-    {0.00, 0.00, 0.00, 46.60, 4.10},
-    {0.00, 0.00, 0.00, 47.00, 4.10},
-    {0.00, 0.00, 0.00, 47.40, 4.10},
-    {0.00, 0.00, 0.00, 47.80, 4.10},
-    {0.00, 0.00, 0.00, 48.20, 4.10},
-    {0.00, 0.00, 0.00, 48.60, 4.10},
-    {0.00, 0.00, 0.00, 49.00, 4.10},
-    {0.00, 0.00, 0.00, 49.40, 4.10},
-    {0.00, 0.00, 0.00, 49.80, 4.10},
-    {0.00, 0.00, 0.00, 50.20, 4.10},
-    {0.00, 0.00, 0.00, 50.60, 4.10},
-    {0.00, 0.00, 0.00, 51.00, 4.10},
-    {0.00, 0.00, 0.00, 51.40, 4.10},
-    {0.00, 0.00, 0.00, 51.80, 4.10},
-    {0.00, 0.00, 0.00, 52.20, 4.10},
-    {0.00, 0.00, 0.00, 52.60, 4.10},
-    {0.00, 0.00, 0.00, 53.00, 4.10},
-    {0.00, 0.00, 0.00, 53.40, 4.10},
-    {0.00, 0.00, 0.00, 53.80, 4.10},
-    {0.00, 0.00, 0.00, 54.20, 4.10},
-    {0.00, 0.00, 0.00, 54.60, 4.10},
-    {0.00, 0.00, 0.00, 55.00, 4.10},
-    {0.00, 0.00, 0.00, 55.40, 4.10},
-    {0.00, 0.00, 0.00, 55.80, 4.10},
-    {0.00, 0.00, 0.00, 56.20, 4.10},
-    {0.00, 0.00, 0.00, 56.60, 4.10},
-    {0.00, 0.00, 0.00, 57.00, 4.10},
-    {0.00, 0.00, 0.00, 57.40, 4.10},
-    {0.00, 0.00, 0.00, 57.80, 4.10},
-    {0.00, 0.00, 0.00, 58.20, 4.10},
-    {0.00, 0.00, 0.00, 58.60, 4.10},
-    {0.00, 0.00, 0.00, 59.00, 4.10},
-    {0.00, 0.00, 0.00, 59.40, 4.10},
-    {0.00, 0.00, 0.00, 59.80, 4.10},
-    {0.00, 0.00, 0.00, -59.80, 4.30},
-    {0.00, 0.00, 0.00, -59.40, 4.30},
-    {0.00, 0.00, 0.00, -59.00, 4.30},
-    {0.00, 0.00, 0.00, -58.60, 4.30},
-    {0.00, 0.00, 0.00, -58.20, 4.30},
-    {0.00, 0.00, 0.00, -57.80, 4.30},
-    {0.00, 0.00, 0.00, -57.40, 4.30},
-    {0.00, 0.00, 0.00, -57.00, 4.30},
-    {0.00, 0.00, 0.00, -56.60, 4.30},
-    {0.00, 0.00, 0.00, -56.20, 4.30},
-    {0.00, 0.00, 0.00, -55.80, 4.30},
-    {0.00, 0.00, 0.00, -55.40, 4.30},
-    {0.00, 0.00, 0.00, -55.00, 4.30},
-    {0.00, 0.00, 0.00, -54.60, 4.30},
-    {0.00, 0.00, 0.00, -54.20, 4.30},
-    {0.00, 0.00, 0.00, -53.80, 4.30},
-    {0.00, 0.00, 0.00, -53.40, 4.30},
-    {0.00, 0.00, 0.00, -53.00, 4.30},
-    {0.00, 0.00, 0.00, -52.60, 4.30},
-    {0.00, 0.00, 0.00, -52.20, 4.30},
-    {0.00, 0.00, 0.00, -51.80, 4.30},
-    {0.00, 0.00, 0.00, -51.40, 4.30},
-    {0.00, 0.00, 0.00, -51.00, 4.30},
-    {0.00, 0.00, 0.00, -50.60, 4.30},
-    {0.00, 0.00, 0.00, -50.20, 4.30},
-    {0.00, 0.00, 0.00, -49.80, 4.30},
-    {0.00, 0.00, 0.00, -49.40, 4.30},
-    {0.00, 0.00, 0.00, -49.00, 4.30},
-    {0.00, 0.00, 0.00, -48.60, 4.30},
-    {0.00, 0.00, 0.00, -48.20, 4.30},
-    {0.00, 0.00, 0.00, -47.80, 4.30},
-    {0.00, 0.00, 0.00, -47.40, 4.30},
-    {0.00, 0.00, 0.00, -47.00, 4.30},
-    {0.00, 0.00, 0.00, -46.60, 4.30},
-    {0.00, 0.00, 0.00, -46.20, 4.30},
-    {0.00, 0.00, 0.00, -45.80, 4.30},
-    {0.00, 0.00, 0.00, -45.40, 4.30},
-    {0.00, 0.00, 0.00, -45.00, 4.30},
-    {0.00, 0.00, 0.00, -44.60, 4.30},
-    {0.00, 0.00, 0.00, -44.20, 4.30},
-    {0.00, 0.00, 0.00, -43.80, 4.30},
-    {0.00, 0.00, 0.00, -43.40, 4.30},
-    {0.00, 0.00, 0.00, -43.00, 4.30},
-    {0.00, 0.00, 0.00, -42.60, 4.30},
-    {0.00, 0.00, 0.00, -42.20, 4.30},
-    {0.00, 0.00, 0.00, -41.80, 4.30},
-    {0.00, 0.00, 0.00, -41.40, 4.30},
-    {0.00, 0.00, 0.00, -41.00, 4.30},
-    {0.00, 0.00, 0.00, -40.60, 4.30},
-    {0.00, 0.00, 0.00, -40.20, 4.30},
-    {0.00, 0.00, 0.00, -39.80, 4.30},
-    {0.00, 0.00, 0.00, -39.40, 4.30},
-    {0.00, 0.00, 0.00, -39.00, 4.30},
-    {0.00, 0.00, 0.00, -38.60, 4.30},
-    {0.00, 0.00, 0.00, -38.20, 4.30},
-    {0.00, 0.00, 0.00, -37.80, 4.30},
-    {0.00, 0.00, 0.00, -37.40, 4.30},
-    {0.00, 0.00, 0.00, -37.00, 4.30},
-    {0.00, 0.00, 0.00, -36.60, 4.30},
-    {0.00, 0.00, 0.00, -36.20, 4.30},
-    {0.00, 0.00, 0.00, -35.80, 4.30},
-    {0.00, 0.00, 0.00, -35.40, 4.30},
-    {0.00, 0.00, 0.00, -35.00, 4.30},
-    {0.00, 0.00, 0.00, -34.60, 4.30},
-    {0.00, 0.00, 0.00, -34.20, 4.30},
-    {0.00, 0.00, 0.00, -33.80, 4.30},
-    {0.00, 0.00, 0.00, -33.40, 4.30},
-    {0.00, 0.00, 0.00, -33.00, 4.30},
-    {0.00, 0.00, 0.00, -32.60, 4.30},
-    {0.00, 0.00, 0.00, -32.20, 4.30},
-    {0.00, 0.00, 0.00, -31.80, 4.30},
-    {0.00, 0.00, 0.00, -31.40, 4.30},
-    {0.00, 0.00, 0.00, -31.00, 4.30},
-    {0.00, 0.00, 0.00, -30.60, 4.30},
-    {0.00, 0.00, 0.00, -30.20, 4.30},
-    {0.00, 0.00, 0.00, -29.80, 4.30},
-    {0.00, 0.00, 0.00, -29.40, 4.30},
-    {0.00, 0.00, 0.00, -29.00, 4.30},
-    {0.00, 0.00, 0.00, -28.60, 4.30},
-    {0.00, 0.00, 0.00, -28.20, 4.30},
-    {0.00, 0.00, 0.00, -27.80, 4.30},
-    {0.00, 0.00, 0.00, -27.40, 4.30},
-    {0.00, 0.00, 0.00, -27.00, 4.30},
-    {0.00, 0.00, 0.00, -26.60, 4.30},
-    {0.00, 0.00, 0.00, -26.20, 4.30},
-    {0.00, 0.00, 0.00, -25.80, 4.30},
-    {0.00, 0.00, 0.00, -25.40, 4.30},
-    {0.00, 0.00, 0.00, -25.00, 4.30},
-    {0.00, 0.00, 0.00, -24.60, 4.30},
-    {0.00, 0.00, 0.00, -24.20, 4.30},
-    {0.00, 0.00, 0.00, -23.80, 4.30},
-    {0.00, 0.00, 0.00, -23.40, 4.30},
-    {0.00, 0.00, 0.00, -23.00, 4.30},
-    {0.00, 0.00, 0.00, -22.60, 4.30},
-    {0.00, 0.00, 0.00, -22.20, 4.30},
-    {0.00, 0.00, 0.00, -21.80, 4.30},
-    {0.00, 0.00, 0.00, -21.40, 4.30},
-    {0.00, 0.00, 0.00, -21.00, 4.30},
-    {0.00, 0.00, 0.00, -20.60, 4.30},
-    {0.00, 0.00, 0.00, -20.20, 4.30},
-    {0.00, 0.00, 0.00, -19.80, 4.30},
-    {0.00, 0.00, 0.00, -19.40, 4.30},
-    {0.00, 0.00, 0.00, -19.00, 4.30},
-    {0.00, 0.00, 0.00, -18.60, 4.30},
-    {0.00, 0.00, 0.00, -18.20, 4.30},
-    {0.00, 0.00, 0.00, -17.80, 4.30},
-    {0.00, 0.00, 0.00, -17.40, 4.30},
-    {0.00, 0.00, 0.00, -17.00, 4.30},
-    {0.00, 0.00, 0.00, -16.60, 4.30},
-    {0.00, 0.00, 0.00, -16.20, 4.30},
-    {0.00, 0.00, 0.00, -15.80, 4.30},
-    {0.00, 0.00, 0.00, -15.40, 4.30},
-    {0.00, 0.00, 0.00, -15.00, 4.30},
-    {0.00, 0.00, 0.00, -14.60, 4.30},
-    {0.00, 0.00, 0.00, -14.20, 4.30},
-    {0.00, 0.00, 0.00, -13.80, 4.30},
-    {0.00, 0.00, 0.00, -13.40, 4.30},
-    {0.00, 0.00, 0.00, -13.00, 4.30},
-    {0.00, 0.00, 0.00, -12.60, 4.30},
-    {0.00, 0.00, 0.00, -12.20, 4.30},
-    {0.00, 0.00, 0.00, -11.80, 4.30},
-    {0.00, 0.00, 0.00, -11.40, 4.30},
-    {0.00, 0.00, 0.00, -11.00, 4.30},
-    {0.00, 0.00, 0.00, -10.60, 4.30},
-    {0.00, 0.00, 0.00, -10.20, 4.30},
-    {0.00, 0.00, 0.00, -9.80, 4.30},
-    {0.00, 0.00, 0.00, -9.40, 4.30},
-    {0.00, 0.00, 0.00, -9.00, 4.30},
-    {0.00, 0.00, 0.00, -8.60, 4.30},
-    {0.00, 0.00, 0.00, -8.20, 4.30},
-    {0.00, 0.00, 0.00, -7.80, 4.30},
-    {0.00, 0.00, 0.00, -7.40, 4.30},
-    {0.00, 0.00, 0.00, -7.00, 4.30},
-    {0.00, 0.00, 0.00, -6.60, 4.30},
-    {0.00, 0.00, 0.00, -6.20, 4.30},
-    {0.00, 0.00, 0.00, -5.80, 4.30},
-    {0.00, 0.00, 0.00, -5.40, 4.30},
-    {0.00, 0.00, 0.00, -5.00, 4.30},
-    {0.00, 0.00, 0.00, -4.60, 4.30},
-    {0.00, 0.00, 0.00, -4.20, 4.30},
-    {0.00, 0.00, 0.00, -3.80, 4.30},
-    {0.00, 0.00, 0.00, -3.40, 4.30},
-    {0.00, 0.00, 0.00, -3.00, 4.30},
-    {0.00, 0.00, 0.00, -2.60, 4.30},
-    {0.00, 0.00, 0.00, -2.20, 4.30},
-    {0.00, 0.00, 0.00, -1.80, 4.30},
-    {0.00, 0.00, 0.00, -1.40, 4.30},
-    {0.00, 0.00, 0.00, -1.00, 4.30},
-    {0.00, 0.00, 0.00, -0.60, 4.30},
-    {0.00, 0.00, 0.00, -0.20, 4.30},
-    {0.00, 0.00, 0.00, 0.20, 4.30},
-    {0.00, 0.00, 0.00, 0.60, 4.30},
-    {0.00, 0.00, 0.00, 1.00, 4.30},
-    {0.00, 0.00, 0.00, 1.40, 4.30},
-    {0.00, 0.00, 0.00, 1.80, 4.30},
-    {0.00, 0.00, 0.00, 2.20, 4.30},
-    {0.00, 0.00, 0.00, 2.60, 4.30},
-    {0.00, 0.00, 0.00, 3.00, 4.30},
-    {0.00, 0.00, 0.00, 3.40, 4.30},
-    {0.00, 0.00, 0.00, 3.80, 4.30},
-    {0.00, 0.00, 0.00, 4.20, 4.30},
-    {0.00, 0.00, 0.00, 4.60, 4.30},
-    {0.00, 0.00, 0.00, 5.00, 4.30},
-    {0.00, 0.00, 0.00, 5.40, 4.30},
-    {0.00, 0.00, 0.00, 5.80, 4.30},
-    {0.00, 0.00, 0.00, 6.20, 4.30},
-    {0.00, 0.00, 0.00, 6.60, 4.30},
-    {0.00, 0.00, 0.00, 7.00, 4.30},
-    {0.00, 0.00, 0.00, 7.40, 4.30},
-    {0.00, 0.00, 0.00, 7.80, 4.30},
-    {0.00, 0.00, 0.00, 8.20, 4.30},
-    {0.00, 0.00, 0.00, 8.60, 4.30},
-    {0.00, 0.00, 0.00, 9.00, 4.30},
-    {0.00, 0.00, 0.00, 9.40, 4.30},
-    {0.00, 0.00, 0.00, 9.80, 4.30},
-    {0.00, 0.00, 0.00, 10.20, 4.30},
-    {0.00, 0.00, 0.00, 10.60, 4.30},
-    {0.00, 0.00, 0.00, 11.00, 4.30},
-    {0.00, 0.00, 0.00, 11.40, 4.30},
-    {0.00, 0.00, 0.00, 11.80, 4.30},
-    {0.00, 0.00, 0.00, 12.20, 4.30},
-    {0.00, 0.00, 0.00, 12.60, 4.30},
-    {0.00, 0.00, 0.00, 13.00, 4.30},
-    {0.00, 0.00, 0.00, 13.40, 4.30},
-    {0.00, 0.00, 0.00, 13.80, 4.30},
-    {0.00, 0.00, 0.00, 14.20, 4.30},
-    {0.00, 0.00, 0.00, 14.60, 4.30},
-    {0.00, 0.00, 0.00, 15.00, 4.30},
-    {0.00, 0.00, 0.00, 15.40, 4.30},
-    {0.00, 0.00, 0.00, 15.80, 4.30},
-    {0.00, 0.00, 0.00, 16.20, 4.30},
-    {0.00, 0.00, 0.00, 16.60, 4.30},
-    {0.00, 0.00, 0.00, 17.00, 4.30},
-    {0.00, 0.00, 0.00, 17.40, 4.30},
-    {0.00, 0.00, 0.00, 17.80, 4.30},
-    {0.00, 0.00, 0.00, 18.20, 4.30},
-    {0.00, 0.00, 0.00, 18.60, 4.30},
-    {0.00, 0.00, 0.00, 19.00, 4.30},
-    {0.00, 0.00, 0.00, 19.40, 4.30},
-    {0.00, 0.00, 0.00, 19.80, 4.30},
-    {0.00, 0.00, 0.00, 20.20, 4.30},
-    {0.00, 0.00, 0.00, 20.60, 4.30},
-    {0.00, 0.00, 0.00, 21.00, 4.30},
-    {0.00, 0.00, 0.00, 21.40, 4.30},
-    {0.00, 0.00, 0.00, 21.80, 4.30},
-    {0.00, 0.00, 0.00, 22.20, 4.30},
-    {0.00, 0.00, 0.00, 22.60, 4.30},
-    {0.00, 0.00, 0.00, 23.00, 4.30},
-    {0.00, 0.00, 0.00, 23.40, 4.30},
-    {0.00, 0.00, 0.00, 23.80, 4.30},
-    {0.00, 0.00, 0.00, 24.20, 4.30},
-    {0.00, 0.00, 0.00, 24.60, 4.30},
-    {0.00, 0.00, 0.00, 25.00, 4.30},
-    {0.00, 0.00, 0.00, 25.40, 4.30},
-    {0.00, 0.00, 0.00, 25.80, 4.30},
-    {0.00, 0.00, 0.00, 26.20, 4.30},
-    {0.00, 0.00, 0.00, 26.60, 4.30},
-    {0.00, 0.00, 0.00, 27.00, 4.30},
-    {0.00, 0.00, 0.00, 27.40, 4.30},
-    {0.00, 0.00, 0.00, 27.80, 4.30},
-    {0.00, 0.00, 0.00, 28.20, 4.30},
-    {0.00, 0.00, 0.00, 28.60, 4.30},
-    {0.00, 0.00, 0.00, 29.00, 4.30},
-    {0.00, 0.00, 0.00, 29.40, 4.30},
-    {0.00, 0.00, 0.00, 29.80, 4.30},
-    {0.00, 0.00, 0.00, 30.20, 4.30},
-    {0.00, 0.00, 0.00, 30.60, 4.30},
-    {0.00, 0.00, 0.00, 31.00, 4.30},
-    {0.00, 0.00, 0.00, 31.40, 4.30},
-    {0.00, 0.00, 0.00, 31.80, 4.30},
-    {0.00, 0.00, 0.00, 32.20, 4.30},
-    {0.00, 0.00, 0.00, 32.60, 4.30},
-    {0.00, 0.00, 0.00, 33.00, 4.30},
-    {0.00, 0.00, 0.00, 33.40, 4.30},
-    {0.00, 0.00, 0.00, 33.80, 4.30},
-    {0.00, 0.00, 0.00, 34.20, 4.30},
-    {0.00, 0.00, 0.00, 34.60, 4.30},
-    {0.00, 0.00, 0.00, 35.00, 4.30},
-    {0.00, 0.00, 0.00, 35.40, 4.30},
-    {0.00, 0.00, 0.00, 35.80, 4.30},
-    {0.00, 0.00, 0.00, 36.20, 4.30},
-    {0.00, 0.00, 0.00, 36.60, 4.30},
-    {0.00, 0.00, 0.00, 37.00, 4.30},
-    {0.00, 0.00, 0.00, 37.40, 4.30},
-    {0.00, 0.00, 0.00, 37.80, 4.30},
-    {0.00, 0.00, 0.00, 38.20, 4.30},
-    {0.00, 0.00, 0.00, 38.60, 4.30},
-    {0.00, 0.00, 0.00, 39.00, 4.30},
-    {0.00, 0.00, 0.00, 39.40, 4.30},
-    {0.00, 0.00, 0.00, 39.80, 4.30},
-    {0.00, 0.00, 0.00, 40.20, 4.30},
-    {0.00, 0.00, 0.00, 40.60, 4.30},
-    {0.00, 0.00, 0.00, 41.00, 4.30},
-    {0.00, 0.00, 0.00, 41.40, 4.30},
-    {0.00, 0.00, 0.00, 41.80, 4.30},
-    {0.00, 0.00, 0.00, 42.20, 4.30},
-    {0.00, 0.00, 0.00, 42.60, 4.30},
-    {0.00, 0.00, 0.00, 43.00, 4.30},
-    {0.00, 0.00, 0.00, 43.40, 4.30},
-    {0.00, 0.00, 0.00, 43.80, 4.30},
-    {0.00, 0.00, 0.00, 44.20, 4.30},
-    {0.00, 0.00, 0.00, 44.60, 4.30},
-    {0.00, 0.00, 0.00, 45.00, 4.30},
-    {0.00, 0.00, 0.00, 45.40, 4.30},
-    {0.00, 0.00, 0.00, 45.80, 4.30},
-    {0.00, 0.00, 0.00, 46.20, 4.30},
-    {0.00, 0.00, 0.00, 46.60, 4.30},
-    {0.00, 0.00, 0.00, 47.00, 4.30},
-    {0.00, 0.00, 0.00, 47.40, 4.30},
-    {0.00, 0.00, 0.00, 47.80, 4.30},
-    {0.00, 0.00, 0.00, 48.20, 4.30},
-    {0.00, 0.00, 0.00, 48.60, 4.30},
-    {0.00, 0.00, 0.00, 49.00, 4.30},
-    {0.00, 0.00, 0.00, 49.40, 4.30},
-    {0.00, 0.00, 0.00, 49.80, 4.30},
-    {0.00, 0.00, 0.00, 50.20, 4.30},
-    {0.00, 0.00, 0.00, 50.60, 4.30},
-    {0.00, 0.00, 0.00, 51.00, 4.30},
-    {0.00, 0.00, 0.00, 51.40, 4.30},
-    {0.00, 0.00, 0.00, 51.80, 4.30},
-    {0.00, 0.00, 0.00, 52.20, 4.30},
-    {0.00, 0.00, 0.00, 52.60, 4.30},
-    {0.00, 0.00, 0.00, 53.00, 4.30},
-    {0.00, 0.00, 0.00, 53.40, 4.30},
-    {0.00, 0.00, 0.00, 53.80, 4.30},
-    {0.00, 0.00, 0.00, 54.20, 4.30},
-    {0.00, 0.00, 0.00, 54.60, 4.30},
-    {0.00, 0.00, 0.00, 55.00, 4.30},
-    {0.00, 0.00, 0.00, 55.40, 4.30},
-    {0.00, 0.00, 0.00, 55.80, 4.30},
-    {0.00, 0.00, 0.00, 56.20, 4.30},
-    {0.00, 0.00, 0.00, 56.60, 4.30},
-    {0.00, 0.00, 0.00, 57.00, 4.30},
-    {0.00, 0.00, 0.00, 57.40, 4.30},
-    {0.00, 0.00, 0.00, 57.80, 4.30},
-    {0.00, 0.00, 0.00, 58.20, 4.30},
-    {0.00, 0.00, 0.00, 58.60, 4.30},
-    {0.00, 0.00, 0.00, 59.00, 4.30},
-    {0.00, 0.00, 0.00, 59.40, 4.30},
-    {0.00, 0.00, 0.00, 59.80, 4.30},
-    {0.00, 0.00, 0.00, -59.80, 4.50},
-    {0.00, 0.00, 0.00, -59.40, 4.50},
-    {0.00, 0.00, 0.00, -59.00, 4.50},
-    {0.00, 0.00, 0.00, -58.60, 4.50},
-    {0.00, 0.00, 0.00, -58.20, 4.50},
-    {0.00, 0.00, 0.00, -57.80, 4.50},
-    {0.00, 0.00, 0.00, -57.40, 4.50},
-    {0.00, 0.00, 0.00, -57.00, 4.50},
-    {0.00, 0.00, 0.00, -56.60, 4.50},
-    {0.00, 0.00, 0.00, -56.20, 4.50},
-    {0.00, 0.00, 0.00, -55.80, 4.50},
-    {0.00, 0.00, 0.00, -55.40, 4.50},
-    {0.00, 0.00, 0.00, -55.00, 4.50},
-    {0.00, 0.00, 0.00, -54.60, 4.50},
-    {0.00, 0.00, 0.00, -54.20, 4.50},
-    {0.00, 0.00, 0.00, -53.80, 4.50},
-    {0.00, 0.00, 0.00, -53.40, 4.50},
-    {0.00, 0.00, 0.00, -53.00, 4.50},
-    {0.00, 0.00, 0.00, -52.60, 4.50},
-    {0.00, 0.00, 0.00, -52.20, 4.50},
-    {0.00, 0.00, 0.00, -51.80, 4.50},
-    {0.00, 0.00, 0.00, -51.40, 4.50},
-    {0.00, 0.00, 0.00, -51.00, 4.50},
-    {0.00, 0.00, 0.00, -50.60, 4.50},
-    {0.00, 0.00, 0.00, -50.20, 4.50},
-    {0.00, 0.00, 0.00, -49.80, 4.50},
-    {0.00, 0.00, 0.00, -49.40, 4.50},
-    {0.00, 0.00, 0.00, -49.00, 4.50},
-    {0.00, 0.00, 0.00, -48.60, 4.50},
-    {0.00, 0.00, 0.00, -48.20, 4.50},
-    {0.00, 0.00, 0.00, -47.80, 4.50},
-    {0.00, 0.00, 0.00, -47.40, 4.50},
-    {0.00, 0.00, 0.00, -47.00, 4.50},
-    {0.00, 0.00, 0.00, -46.60, 4.50},
-    {0.00, 0.00, 0.00, -46.20, 4.50},
-    {0.00, 0.00, 0.00, -45.80, 4.50},
-    {0.00, 0.00, 0.00, -45.40, 4.50},
-    {0.00, 0.00, 0.00, -45.00, 4.50},
-    {0.00, 0.00, 0.00, -44.60, 4.50},
-    {0.00, 0.00, 0.00, -44.20, 4.50},
-    {0.00, 0.00, 0.00, -43.80, 4.50},
-    {0.00, 0.00, 0.00, -43.40, 4.50},
-    {0.00, 0.00, 0.00, -43.00, 4.50},
-    {0.00, 0.00, 0.00, -42.60, 4.50},
-    {0.00, 0.00, 0.00, -42.20, 4.50},
-    {0.00, 0.00, 0.00, -41.80, 4.50},
-    {0.00, 0.00, 0.00, -41.40, 4.50},
-    {0.00, 0.00, 0.00, -41.00, 4.50},
-    {0.00, 0.00, 0.00, -40.60, 4.50},
-    {0.00, 0.00, 0.00, -40.20, 4.50},
-    {0.00, 0.00, 0.00, -39.80, 4.50},
-    {0.00, 0.00, 0.00, -39.40, 4.50},
-    {0.00, 0.00, 0.00, -39.00, 4.50},
-    {0.00, 0.00, 0.00, -38.60, 4.50},
-    {0.00, 0.00, 0.00, -38.20, 4.50},
-    {0.00, 0.00, 0.00, -37.80, 4.50},
-    {0.00, 0.00, 0.00, -37.40, 4.50},
-    {0.00, 0.00, 0.00, -37.00, 4.50},
-    {0.00, 0.00, 0.00, -36.60, 4.50},
-    {0.00, 0.00, 0.00, -36.20, 4.50},
-    {0.00, 0.00, 0.00, -35.80, 4.50},
-    {0.00, 0.00, 0.00, -35.40, 4.50},
-    {0.00, 0.00, 0.00, -35.00, 4.50},
-    {0.00, 0.00, 0.00, -34.60, 4.50},
-    {0.00, 0.00, 0.00, -34.20, 4.50},
-    {0.00, 0.00, 0.00, -33.80, 4.50},
-    {0.00, 0.00, 0.00, -33.40, 4.50},
-    {0.00, 0.00, 0.00, -33.00, 4.50},
-    {0.00, 0.00, 0.00, -32.60, 4.50},
-    {0.00, 0.00, 0.00, -32.20, 4.50},
-    {0.00, 0.00, 0.00, -31.80, 4.50},
-    {0.00, 0.00, 0.00, -31.40, 4.50},
-    {0.00, 0.00, 0.00, -31.00, 4.50},
-    {0.00, 0.00, 0.00, -30.60, 4.50},
-    {0.00, 0.00, 0.00, -30.20, 4.50},
-    {0.00, 0.00, 0.00, -29.80, 4.50},
-    {0.00, 0.00, 0.00, -29.40, 4.50},
-    {0.00, 0.00, 0.00, -29.00, 4.50},
-    {0.00, 0.00, 0.00, -28.60, 4.50},
-    {0.00, 0.00, 0.00, -28.20, 4.50},
-    {0.00, 0.00, 0.00, -27.80, 4.50},
-    {0.00, 0.00, 0.00, -27.40, 4.50},
-    {0.00, 0.00, 0.00, -27.00, 4.50},
-    {0.00, 0.00, 0.00, -26.60, 4.50},
-    {0.00, 0.00, 0.00, -26.20, 4.50},
-    {0.00, 0.00, 0.00, -25.80, 4.50},
-    {0.00, 0.00, 0.00, -25.40, 4.50},
-    {0.00, 0.00, 0.00, -25.00, 4.50},
-    {0.00, 0.00, 0.00, -24.60, 4.50},
-    {0.00, 0.00, 0.00, -24.20, 4.50},
-    {0.00, 0.00, 0.00, -23.80, 4.50},
-    {0.00, 0.00, 0.00, -23.40, 4.50},
-    {0.00, 0.00, 0.00, -23.00, 4.50},
-    {0.00, 0.00, 0.00, -22.60, 4.50},
-    {0.00, 0.00, 0.00, -22.20, 4.50},
-    {0.00, 0.00, 0.00, -21.80, 4.50},
-    {0.00, 0.00, 0.00, -21.40, 4.50},
-    {0.00, 0.00, 0.00, -21.00, 4.50},
-    {0.00, 0.00, 0.00, -20.60, 4.50},
-    {0.00, 0.00, 0.00, -20.20, 4.50},
-    {0.00, 0.00, 0.00, -19.80, 4.50},
-    {0.00, 0.00, 0.00, -19.40, 4.50},
-    {0.00, 0.00, 0.00, -19.00, 4.50},
-    {0.00, 0.00, 0.00, -18.60, 4.50},
-    {0.00, 0.00, 0.00, -18.20, 4.50},
-    {0.00, 0.00, 0.00, -17.80, 4.50},
-    {0.00, 0.00, 0.00, -17.40, 4.50},
-    {0.00, 0.00, 0.00, -17.00, 4.50},
-    {0.00, 0.00, 0.00, -16.60, 4.50},
-    {0.00, 0.00, 0.00, -16.20, 4.50},
-    {0.00, 0.00, 0.00, -15.80, 4.50},
-    {0.00, 0.00, 0.00, -15.40, 4.50},
-    {0.00, 0.00, 0.00, -15.00, 4.50},
-    {0.00, 0.00, 0.00, -14.60, 4.50},
-    {0.00, 0.00, 0.00, -14.20, 4.50},
-    {0.00, 0.00, 0.00, -13.80, 4.50},
-    {0.00, 0.00, 0.00, -13.40, 4.50},
-    {0.00, 0.00, 0.00, -13.00, 4.50},
-    {0.00, 0.00, 0.00, -12.60, 4.50},
-    {0.00, 0.00, 0.00, -12.20, 4.50},
-    {0.00, 0.00, 0.00, -11.80, 4.50},
-    {0.00, 0.00, 0.00, -11.40, 4.50},
-    {0.00, 0.00, 0.00, -11.00, 4.50},
-    {0.00, 0.00, 0.00, -10.60, 4.50},
-    {0.00, 0.00, 0.00, -10.20, 4.50},
-    {0.00, 0.00, 0.00, -9.80, 4.50},
-    {0.00, 0.00, 0.00, -9.40, 4.50},
-    {0.00, 0.00, 0.00, -9.00, 4.50},
-    {0.00, 0.00, 0.00, -8.60, 4.50},
-    {0.00, 0.00, 0.00, -8.20, 4.50},
-    {0.00, 0.00, 0.00, -7.80, 4.50},
-    {0.00, 0.00, 0.00, -7.40, 4.50},
-    {0.00, 0.00, 0.00, -7.00, 4.50},
-    {0.00, 0.00, 0.00, -6.60, 4.50},
-    {0.00, 0.00, 0.00, -6.20, 4.50},
-    {0.00, 0.00, 0.00, -5.80, 4.50},
-    {0.00, 0.00, 0.00, -5.40, 4.50},
-    {0.00, 0.00, 0.00, -5.00, 4.50},
-    {0.00, 0.00, 0.00, -4.60, 4.50},
-    {0.00, 0.00, 0.00, -4.20, 4.50},
-    {0.00, 0.00, 0.00, -3.80, 4.50},
-    {0.00, 0.00, 0.00, -3.40, 4.50},
-    {0.00, 0.00, 0.00, -3.00, 4.50},
-    {0.00, 0.00, 0.00, -2.60, 4.50},
-    {0.00, 0.00, 0.00, -2.20, 4.50},
-    {0.00, 0.00, 0.00, -1.80, 4.50},
-    {0.00, 0.00, 0.00, -1.40, 4.50},
-    {0.00, 0.00, 0.00, -1.00, 4.50},
-    {0.00, 0.00, 0.00, -0.60, 4.50},
-    {0.00, 0.00, 0.00, -0.20, 4.50},
-    {0.00, 0.00, 0.00, 0.20, 4.50},
-    {0.00, 0.00, 0.00, 0.60, 4.50},
-    {0.00, 0.00, 0.00, 1.00, 4.50},
-    {0.00, 0.00, 0.00, 1.40, 4.50},
-    {0.00, 0.00, 0.00, 1.80, 4.50},
-    {0.00, 0.00, 0.00, 2.20, 4.50},
-    {0.00, 0.00, 0.00, 2.60, 4.50},
-    {0.00, 0.00, 0.00, 3.00, 4.50},
-    {0.00, 0.00, 0.00, 3.40, 4.50},
-    {0.00, 0.00, 0.00, 3.80, 4.50},
-    {0.00, 0.00, 0.00, 4.20, 4.50},
-    {0.00, 0.00, 0.00, 4.60, 4.50},
-    {0.00, 0.00, 0.00, 5.00, 4.50},
-    {0.00, 0.00, 0.00, 5.40, 4.50},
-    {0.00, 0.00, 0.00, 5.80, 4.50},
-    {0.00, 0.00, 0.00, 6.20, 4.50},
-    {0.00, 0.00, 0.00, 6.60, 4.50},
-    {0.00, 0.00, 0.00, 7.00, 4.50},
-    {0.00, 0.00, 0.00, 7.40, 4.50},
-    {0.00, 0.00, 0.00, 7.80, 4.50},
-    {0.00, 0.00, 0.00, 8.20, 4.50},
-    {0.00, 0.00, 0.00, 8.60, 4.50},
-    {0.00, 0.00, 0.00, 9.00, 4.50},
-    {0.00, 0.00, 0.00, 9.40, 4.50},
-    {0.00, 0.00, 0.00, 9.80, 4.50},
-    {0.00, 0.00, 0.00, 10.20, 4.50},
-    {0.00, 0.00, 0.00, 10.60, 4.50},
-    {0.00, 0.00, 0.00, 11.00, 4.50},
-    {0.00, 0.00, 0.00, 11.40, 4.50},
-    {0.00, 0.00, 0.00, 11.80, 4.50},
-    {0.00, 0.00, 0.00, 12.20, 4.50},
-    {0.00, 0.00, 0.00, 12.60, 4.50},
-    {0.00, 0.00, 0.00, 13.00, 4.50},
-    {0.00, 0.00, 0.00, 13.40, 4.50},
-    {0.00, 0.00, 0.00, 13.80, 4.50},
-    {0.00, 0.00, 0.00, 14.20, 4.50},
-    {0.00, 0.00, 0.00, 14.60, 4.50},
-    {0.00, 0.00, 0.00, 15.00, 4.50},
-    {0.00, 0.00, 0.00, 15.40, 4.50},
-    {0.00, 0.00, 0.00, 15.80, 4.50},
-    {0.00, 0.00, 0.00, 16.20, 4.50},
-    {0.00, 0.00, 0.00, 16.60, 4.50},
-    {0.00, 0.00, 0.00, 17.00, 4.50},
-    {0.00, 0.00, 0.00, 17.40, 4.50},
-    {0.00, 0.00, 0.00, 17.80, 4.50},
-    {0.00, 0.00, 0.00, 18.20, 4.50},
-    {0.00, 0.00, 0.00, 18.60, 4.50},
-    {0.00, 0.00, 0.00, 19.00, 4.50},
-    {0.00, 0.00, 0.00, 19.40, 4.50},
-    {0.00, 0.00, 0.00, 19.80, 4.50},
-    {0.00, 0.00, 0.00, 20.20, 4.50},
-    {0.00, 0.00, 0.00, 20.60, 4.50},
-    {0.00, 0.00, 0.00, 21.00, 4.50},
-    {0.00, 0.00, 0.00, 21.40, 4.50},
-    {0.00, 0.00, 0.00, 21.80, 4.50},
-    {0.00, 0.00, 0.00, 22.20, 4.50},
-    {0.00, 0.00, 0.00, 22.60, 4.50},
-    {0.00, 0.00, 0.00, 23.00, 4.50},
-    {0.00, 0.00, 0.00, 23.40, 4.50},
-    {0.00, 0.00, 0.00, 23.80, 4.50},
-    {0.00, 0.00, 0.00, 24.20, 4.50},
-    {0.00, 0.00, 0.00, 24.60, 4.50},
-    {0.00, 0.00, 0.00, 25.00, 4.50},
-    {0.00, 0.00, 0.00, 25.40, 4.50},
-    {0.00, 0.00, 0.00, 25.80, 4.50},
-    {0.00, 0.00, 0.00, 26.20, 4.50},
-    {0.00, 0.00, 0.00, 26.60, 4.50},
-    {0.00, 0.00, 0.00, 27.00, 4.50},
-    {0.00, 0.00, 0.00, 27.40, 4.50},
-    {0.00, 0.00, 0.00, 27.80, 4.50},
-    {0.00, 0.00, 0.00, 28.20, 4.50},
-    {0.00, 0.00, 0.00, 28.60, 4.50},
-    {0.00, 0.00, 0.00, 29.00, 4.50},
-    {0.00, 0.00, 0.00, 29.40, 4.50},
-    {0.00, 0.00, 0.00, 29.80, 4.50},
-    {0.00, 0.00, 0.00, 30.20, 4.50},
-    {0.00, 0.00, 0.00, 30.60, 4.50},
-    {0.00, 0.00, 0.00, 31.00, 4.50},
-    {0.00, 0.00, 0.00, 31.40, 4.50},
-    {0.00, 0.00, 0.00, 31.80, 4.50},
-    {0.00, 0.00, 0.00, 32.20, 4.50},
-    {0.00, 0.00, 0.00, 32.60, 4.50},
-    {0.00, 0.00, 0.00, 33.00, 4.50},
-    {0.00, 0.00, 0.00, 33.40, 4.50},
-    {0.00, 0.00, 0.00, 33.80, 4.50},
-    {0.00, 0.00, 0.00, 34.20, 4.50},
-    {0.00, 0.00, 0.00, 34.60, 4.50},
-    {0.00, 0.00, 0.00, 35.00, 4.50},
-    {0.00, 0.00, 0.00, 35.40, 4.50},
-    {0.00, 0.00, 0.00, 35.80, 4.50},
-    {0.00, 0.00, 0.00, 36.20, 4.50},
-    {0.00, 0.00, 0.00, 36.60, 4.50},
-    {0.00, 0.00, 0.00, 37.00, 4.50},
-    {0.00, 0.00, 0.00, 37.40, 4.50},
-    {0.00, 0.00, 0.00, 37.80, 4.50},
-    {0.00, 0.00, 0.00, 38.20, 4.50},
-    {0.00, 0.00, 0.00, 38.60, 4.50},
-    {0.00, 0.00, 0.00, 39.00, 4.50},
-    {0.00, 0.00, 0.00, 39.40, 4.50},
-    {0.00, 0.00, 0.00, 39.80, 4.50},
-    {0.00, 0.00, 0.00, 40.20, 4.50},
-    {0.00, 0.00, 0.00, 40.60, 4.50},
-    {0.00, 0.00, 0.00, 41.00, 4.50},
-    {0.00, 0.00, 0.00, 41.40, 4.50},
-    {0.00, 0.00, 0.00, 41.80, 4.50},
-    {0.00, 0.00, 0.00, 42.20, 4.50},
-    {0.00, 0.00, 0.00, 42.60, 4.50},
-    {0.00, 0.00, 0.00, 43.00, 4.50},
-    {0.00, 0.00, 0.00, 43.40, 4.50},
-    {0.00, 0.00, 0.00, 43.80, 4.50},
-    {0.00, 0.00, 0.00, 44.20, 4.50},
-    {0.00, 0.00, 0.00, 44.60, 4.50},
-    {0.00, 0.00, 0.00, 45.00, 4.50},
-    {0.00, 0.00, 0.00, 45.40, 4.50},
-    {0.00, 0.00, 0.00, 45.80, 4.50},
-    {0.00, 0.00, 0.00, 46.20, 4.50},
-    {0.00, 0.00, 0.00, 46.60, 4.50},
-    {0.00, 0.00, 0.00, 47.00, 4.50},
-    {0.00, 0.00, 0.00, 47.40, 4.50},
-    {0.00, 0.00, 0.00, 47.80, 4.50},
-    {0.00, 0.00, 0.00, 48.20, 4.50},
-    {0.00, 0.00, 0.00, 48.60, 4.50},
-    {0.00, 0.00, 0.00, 49.00, 4.50},
-    {0.00, 0.00, 0.00, 49.40, 4.50},
-    {0.00, 0.00, 0.00, 49.80, 4.50},
-    {0.00, 0.00, 0.00, 50.20, 4.50},
-    {0.00, 0.00, 0.00, 50.60, 4.50},
-    {0.00, 0.00, 0.00, 51.00, 4.50},
-    {0.00, 0.00, 0.00, 51.40, 4.50},
-    {0.00, 0.00, 0.00, 51.80, 4.50},
-    {0.00, 0.00, 0.00, 52.20, 4.50},
-    {0.00, 0.00, 0.00, 52.60, 4.50},
-    {0.00, 0.00, 0.00, 53.00, 4.50},
-    {0.00, 0.00, 0.00, 53.40, 4.50},
-    {0.00, 0.00, 0.00, 53.80, 4.50},
-    {0.00, 0.00, 0.00, 54.20, 4.50},
-    {0.00, 0.00, 0.00, 54.60, 4.50},
-    {0.00, 0.00, 0.00, 55.00, 4.50},
-    {0.00, 0.00, 0.00, 55.40, 4.50},
-    {0.00, 0.00, 0.00, 55.80, 4.50},
-    {0.00, 0.00, 0.00, 56.20, 4.50},
-    {0.00, 0.00, 0.00, 56.60, 4.50},
-    {0.00, 0.00, 0.00, 57.00, 4.50},
-    {0.00, 0.00, 0.00, 57.40, 4.50},
-    {0.00, 0.00, 0.00, 57.80, 4.50},
-    {0.00, 0.00, 0.00, 58.20, 4.50},
-    {0.00, 0.00, 0.00, 58.60, 4.50},
-    {0.00, 0.00, 0.00, 59.00, 4.50},
-    {0.00, 0.00, 0.00, 59.40, 4.50},
-    {0.00, 0.00, 0.00, 59.80, 4.50},
-    {0.00, 0.00, 0.00, -59.80, 4.70},
-    {0.00, 0.00, 0.00, -59.40, 4.70},
-    {0.00, 0.00, 0.00, -59.00, 4.70},
-    {0.00, 0.00, 0.00, -58.60, 4.70},
-    {0.00, 0.00, 0.00, -58.20, 4.70},
-    {0.00, 0.00, 0.00, -57.80, 4.70},
-    {0.00, 0.00, 0.00, -57.40, 4.70},
-    {0.00, 0.00, 0.00, -57.00, 4.70},
-    {0.00, 0.00, 0.00, -56.60, 4.70},
-    {0.00, 0.00, 0.00, -56.20, 4.70},
-    {0.00, 0.00, 0.00, -55.80, 4.70},
-    {0.00, 0.00, 0.00, -55.40, 4.70},
-    {0.00, 0.00, 0.00, -55.00, 4.70},
-    {0.00, 0.00, 0.00, -54.60, 4.70},
-    {0.00, 0.00, 0.00, -54.20, 4.70},
-    {0.00, 0.00, 0.00, -53.80, 4.70},
-    {0.00, 0.00, 0.00, -53.40, 4.70},
-    {0.00, 0.00, 0.00, -53.00, 4.70},
-    {0.00, 0.00, 0.00, -52.60, 4.70},
-    {0.00, 0.00, 0.00, -52.20, 4.70},
-    {0.00, 0.00, 0.00, -51.80, 4.70},
-    {0.00, 0.00, 0.00, -51.40, 4.70},
-    {0.00, 0.00, 0.00, -51.00, 4.70},
-    {0.00, 0.00, 0.00, -50.60, 4.70},
-    {0.00, 0.00, 0.00, -50.20, 4.70},
-    {0.00, 0.00, 0.00, -49.80, 4.70},
-    {0.00, 0.00, 0.00, -49.40, 4.70},
-    {0.00, 0.00, 0.00, -49.00, 4.70},
-    {0.00, 0.00, 0.00, -48.60, 4.70},
-    {0.00, 0.00, 0.00, -48.20, 4.70},
-    {0.00, 0.00, 0.00, -47.80, 4.70},
-    {0.00, 0.00, 0.00, -47.40, 4.70},
-    {0.00, 0.00, 0.00, -47.00, 4.70},
-    {0.00, 0.00, 0.00, -46.60, 4.70},
-    {0.00, 0.00, 0.00, -46.20, 4.70},
-    {0.00, 0.00, 0.00, -45.80, 4.70},
-    {0.00, 0.00, 0.00, -45.40, 4.70},
-    {0.00, 0.00, 0.00, -45.00, 4.70},
-    {0.00, 0.00, 0.00, -44.60, 4.70},
-    {0.00, 0.00, 0.00, -44.20, 4.70},
-    {0.00, 0.00, 0.00, -43.80, 4.70},
-    {0.00, 0.00, 0.00, -43.40, 4.70},
-    {0.00, 0.00, 0.00, -43.00, 4.70},
-    {0.00, 0.00, 0.00, -42.60, 4.70},
-    {0.00, 0.00, 0.00, -42.20, 4.70},
-    {0.00, 0.00, 0.00, -41.80, 4.70},
-    {0.00, 0.00, 0.00, -41.40, 4.70},
-    {0.00, 0.00, 0.00, -41.00, 4.70},
-    {0.00, 0.00, 0.00, -40.60, 4.70},
-    {0.00, 0.00, 0.00, -40.20, 4.70},
-    {0.00, 0.00, 0.00, -39.80, 4.70},
-    {0.00, 0.00, 0.00, -39.40, 4.70},
-    {0.00, 0.00, 0.00, -39.00, 4.70},
-    {0.00, 0.00, 0.00, -38.60, 4.70},
-    {0.00, 0.00, 0.00, -38.20, 4.70},
-    {0.00, 0.00, 0.00, -37.80, 4.70},
-    {0.00, 0.00, 0.00, -37.40, 4.70},
-    {0.00, 0.00, 0.00, -37.00, 4.70},
-    {0.00, 0.00, 0.00, -36.60, 4.70},
-    {0.00, 0.00, 0.00, -36.20, 4.70},
-    {0.00, 0.00, 0.00, -35.80, 4.70},
-    {0.00, 0.00, 0.00, -35.40, 4.70},
-    {0.00, 0.00, 0.00, -35.00, 4.70},
-    {0.00, 0.00, 0.00, -34.60, 4.70},
-    {0.00, 0.00, 0.00, -34.20, 4.70},
-    {0.00, 0.00, 0.00, -33.80, 4.70},
-    {0.00, 0.00, 0.00, -33.40, 4.70},
-    {0.00, 0.00, 0.00, -33.00, 4.70},
-    {0.00, 0.00, 0.00, -32.60, 4.70},
-    {0.00, 0.00, 0.00, -32.20, 4.70},
-    {0.00, 0.00, 0.00, -31.80, 4.70},
-    {0.00, 0.00, 0.00, -31.40, 4.70},
-    {0.00, 0.00, 0.00, -31.00, 4.70},
-    {0.00, 0.00, 0.00, -30.60, 4.70},
-    {0.00, 0.00, 0.00, -30.20, 4.70},
-    {0.00, 0.00, 0.00, -29.80, 4.70},
-    {0.00, 0.00, 0.00, -29.40, 4.70},
-    {0.00, 0.00, 0.00, -29.00, 4.70},
-    {0.00, 0.00, 0.00, -28.60, 4.70},
-    {0.00, 0.00, 0.00, -28.20, 4.70},
-    {0.00, 0.00, 0.00, -27.80, 4.70},
-    {0.00, 0.00, 0.00, -27.40, 4.70},
-    {0.00, 0.00, 0.00, -27.00, 4.70},
-    {0.00, 0.00, 0.00, -26.60, 4.70},
-    {0.00, 0.00, 0.00, -26.20, 4.70},
-    {0.00, 0.00, 0.00, -25.80, 4.70},
-    {0.00, 0.00, 0.00, -25.40, 4.70},
-    {0.00, 0.00, 0.00, -25.00, 4.70},
-    {0.00, 0.00, 0.00, -24.60, 4.70},
-    {0.00, 0.00, 0.00, -24.20, 4.70},
-    {0.00, 0.00, 0.00, -23.80, 4.70},
-    {0.00, 0.00, 0.00, -23.40, 4.70},
-    {0.00, 0.00, 0.00, -23.00, 4.70},
-    {0.00, 0.00, 0.00, -22.60, 4.70},
-    {0.00, 0.00, 0.00, -22.20, 4.70},
-    {0.00, 0.00, 0.00, -21.80, 4.70},
-    {0.00, 0.00, 0.00, -21.40, 4.70},
-    {0.00, 0.00, 0.00, -21.00, 4.70},
-    {0.00, 0.00, 0.00, -20.60, 4.70},
-    {0.00, 0.00, 0.00, -20.20, 4.70},
-    {0.00, 0.00, 0.00, -19.80, 4.70},
-    {0.00, 0.00, 0.00, -19.40, 4.70},
-    {0.00, 0.00, 0.00, -19.00, 4.70},
-    {0.00, 0.00, 0.00, -18.60, 4.70},
-    {0.00, 0.00, 0.00, -18.20, 4.70},
-    {0.00, 0.00, 0.00, -17.80, 4.70},
-    {0.00, 0.00, 0.00, -17.40, 4.70},
-    {0.00, 0.00, 0.00, -17.00, 4.70},
-    {0.00, 0.00, 0.00, -16.60, 4.70},
-    {0.00, 0.00, 0.00, -16.20, 4.70},
-    {0.00, 0.00, 0.00, -15.80, 4.70},
-    {0.00, 0.00, 0.00, -15.40, 4.70},
-    {0.00, 0.00, 0.00, -15.00, 4.70},
-    {0.00, 0.00, 0.00, -14.60, 4.70},
-    {0.00, 0.00, 0.00, -14.20, 4.70},
-    {0.00, 0.00, 0.00, -13.80, 4.70},
-    {0.00, 0.00, 0.00, -13.40, 4.70},
-    {0.00, 0.00, 0.00, -13.00, 4.70},
-    {0.00, 0.00, 0.00, -12.60, 4.70},
-    {0.00, 0.00, 0.00, -12.20, 4.70},
-    {0.00, 0.00, 0.00, -11.80, 4.70},
-    {0.00, 0.00, 0.00, -11.40, 4.70},
-    {0.00, 0.00, 0.00, -11.00, 4.70},
-    {0.00, 0.00, 0.00, -10.60, 4.70},
-    {0.00, 0.00, 0.00, -10.20, 4.70},
-    {0.00, 0.00, 0.00, -9.80, 4.70},
-    {0.00, 0.00, 0.00, -9.40, 4.70},
-    {0.00, 0.00, 0.00, -9.00, 4.70},
-    {0.00, 0.00, 0.00, -8.60, 4.70},
-    {0.00, 0.00, 0.00, -8.20, 4.70},
-    {0.00, 0.00, 0.00, -7.80, 4.70},
-    {0.00, 0.00, 0.00, -7.40, 4.70},
-    {0.00, 0.00, 0.00, -7.00, 4.70},
-    {0.00, 0.00, 0.00, -6.60, 4.70},
-    {0.00, 0.00, 0.00, -6.20, 4.70},
-    {0.00, 0.00, 0.00, -5.80, 4.70},
-    {0.00, 0.00, 0.00, -5.40, 4.70},
-    {0.00, 0.00, 0.00, -5.00, 4.70},
-    {0.00, 0.00, 0.00, -4.60, 4.70},
-    {0.00, 0.00, 0.00, -4.20, 4.70},
-    {0.00, 0.00, 0.00, -3.80, 4.70},
-    {0.00, 0.00, 0.00, -3.40, 4.70},
-    {0.00, 0.00, 0.00, -3.00, 4.70},
-    {0.00, 0.00, 0.00, -2.60, 4.70},
-    {0.00, 0.00, 0.00, -2.20, 4.70},
-    {0.00, 0.00, 0.00, -1.80, 4.70},
-    {0.00, 0.00, 0.00, -1.40, 4.70},
-    {0.00, 0.00, 0.00, -1.00, 4.70},
-    {0.00, 0.00, 0.00, -0.60, 4.70},
-    {0.00, 0.00, 0.00, -0.20, 4.70},
-    {0.00, 0.00, 0.00, 0.20, 4.70},
-    {0.00, 0.00, 0.00, 0.60, 4.70},
-    {0.00, 0.00, 0.00, 1.00, 4.70},
-    {0.00, 0.00, 0.00, 1.40, 4.70},
-    {0.00, 0.00, 0.00, 1.80, 4.70},
-    {0.00, 0.00, 0.00, 2.20, 4.70},
-    {0.00, 0.00, 0.00, 2.60, 4.70},
-    {0.00, 0.00, 0.00, 3.00, 4.70},
-    {0.00, 0.00, 0.00, 3.40, 4.70},
-    {0.00, 0.00, 0.00, 3.80, 4.70},
-    {0.00, 0.00, 0.00, 4.20, 4.70},
-    {0.00, 0.00, 0.00, 4.60, 4.70},
-    {0.00, 0.00, 0.00, 5.00, 4.70},
-    {0.00, 0.00, 0.00, 5.40, 4.70},
-    {0.00, 0.00, 0.00, 5.80, 4.70},
-    {0.00, 0.00, 0.00, 6.20, 4.70},
-    {0.00, 0.00, 0.00, 6.60, 4.70},
-    {0.00, 0.00, 0.00, 7.00, 4.70},
-    {0.00, 0.00, 0.00, 7.40, 4.70},
-    {0.00, 0.00, 0.00, 7.80, 4.70},
-    {0.00, 0.00, 0.00, 8.20, 4.70},
-    {0.00, 0.00, 0.00, 8.60, 4.70},
-    {0.00, 0.00, 0.00, 9.00, 4.70},
-    {0.00, 0.00, 0.00, 9.40, 4.70},
-    {0.00, 0.00, 0.00, 9.80, 4.70},
-    {0.00, 0.00, 0.00, 10.20, 4.70},
-    {0.00, 0.00, 0.00, 10.60, 4.70},
-    {0.00, 0.00, 0.00, 11.00, 4.70},
-    {0.00, 0.00, 0.00, 11.40, 4.70},
-    {0.00, 0.00, 0.00, 11.80, 4.70},
-    {0.00, 0.00, 0.00, 12.20, 4.70},
-    {0.00, 0.00, 0.00, 12.60, 4.70},
-    {0.00, 0.00, 0.00, 13.00, 4.70},
-    {0.00, 0.00, 0.00, 13.40, 4.70},
-    {0.00, 0.00, 0.00, 13.80, 4.70},
-    {0.00, 0.00, 0.00, 14.20, 4.70},
-    {0.00, 0.00, 0.00, 14.60, 4.70},
-    {0.00, 0.00, 0.00, 15.00, 4.70},
-    {0.00, 0.00, 0.00, 15.40, 4.70},
-    {0.00, 0.00, 0.00, 15.80, 4.70},
-    {0.00, 0.00, 0.00, 16.20, 4.70},
-    {0.00, 0.00, 0.00, 16.60, 4.70},
-    {0.00, 0.00, 0.00, 17.00, 4.70},
-    {0.00, 0.00, 0.00, 17.40, 4.70},
-    {0.00, 0.00, 0.00, 17.80, 4.70},
-    {0.00, 0.00, 0.00, 18.20, 4.70},
-    {0.00, 0.00, 0.00, 18.60, 4.70},
-    {0.00, 0.00, 0.00, 19.00, 4.70},
-    {0.00, 0.00, 0.00, 19.40, 4.70},
-    {0.00, 0.00, 0.00, 19.80, 4.70},
-    {0.00, 0.00, 0.00, 20.20, 4.70},
-    {0.00, 0.00, 0.00, 20.60, 4.70},
-    {0.00, 0.00, 0.00, 21.00, 4.70},
-    {0.00, 0.00, 0.00, 21.40, 4.70},
-    {0.00, 0.00, 0.00, 21.80, 4.70},
-    {0.00, 0.00, 0.00, 22.20, 4.70},
-    {0.00, 0.00, 0.00, 22.60, 4.70},
-    {0.00, 0.00, 0.00, 23.00, 4.70},
-    {0.00, 0.00, 0.00, 23.40, 4.70},
-    {0.00, 0.00, 0.00, 23.80, 4.70},
-    {0.00, 0.00, 0.00, 24.20, 4.70},
-    {0.00, 0.00, 0.00, 24.60, 4.70},
-    {0.00, 0.00, 0.00, 25.00, 4.70},
-    {0.00, 0.00, 0.00, 25.40, 4.70},
-    {0.00, 0.00, 0.00, 25.80, 4.70},
-    {0.00, 0.00, 0.00, 26.20, 4.70},
-    {0.00, 0.00, 0.00, 26.60, 4.70},
-    {0.00, 0.00, 0.00, 27.00, 4.70},
-    {0.00, 0.00, 0.00, 27.40, 4.70},
-    {0.00, 0.00, 0.00, 27.80, 4.70},
-    {0.00, 0.00, 0.00, 28.20, 4.70},
-    {0.00, 0.00, 0.00, 28.60, 4.70},
-    {0.00, 0.00, 0.00, 29.00, 4.70},
-    {0.00, 0.00, 0.00, 29.40, 4.70},
-    {0.00, 0.00, 0.00, 29.80, 4.70},
-    {0.00, 0.00, 0.00, 30.20, 4.70},
-    {0.00, 0.00, 0.00, 30.60, 4.70},
-    {0.00, 0.00, 0.00, 31.00, 4.70},
-    {0.00, 0.00, 0.00, 31.40, 4.70},
-    {0.00, 0.00, 0.00, 31.80, 4.70},
-    {0.00, 0.00, 0.00, 32.20, 4.70},
-    {0.00, 0.00, 0.00, 32.60, 4.70},
-    {0.00, 0.00, 0.00, 33.00, 4.70},
-    {0.00, 0.00, 0.00, 33.40, 4.70},
-    {0.00, 0.00, 0.00, 33.80, 4.70},
-    {0.00, 0.00, 0.00, 34.20, 4.70},
-    {0.00, 0.00, 0.00, 34.60, 4.70},
-    {0.00, 0.00, 0.00, 35.00, 4.70},
-    {0.00, 0.00, 0.00, 35.40, 4.70},
-    {0.00, 0.00, 0.00, 35.80, 4.70},
-    {0.00, 0.00, 0.00, 36.20, 4.70},
-    {0.00, 0.00, 0.00, 36.60, 4.70},
-    {0.00, 0.00, 0.00, 37.00, 4.70},
-    {0.00, 0.00, 0.00, 37.40, 4.70},
-    {0.00, 0.00, 0.00, 37.80, 4.70},
-    {0.00, 0.00, 0.00, 38.20, 4.70},
-    {0.00, 0.00, 0.00, 38.60, 4.70},
-    {0.00, 0.00, 0.00, 39.00, 4.70},
-    {0.00, 0.00, 0.00, 39.40, 4.70},
-    {0.00, 0.00, 0.00, 39.80, 4.70},
-    {0.00, 0.00, 0.00, 40.20, 4.70},
-    {0.00, 0.00, 0.00, 40.60, 4.70},
-    {0.00, 0.00, 0.00, 41.00, 4.70},
-    {0.00, 0.00, 0.00, 41.40, 4.70},
-    {0.00, 0.00, 0.00, 41.80, 4.70},
-    {0.00, 0.00, 0.00, 42.20, 4.70},
-    {0.00, 0.00, 0.00, 42.60, 4.70},
-    {0.00, 0.00, 0.00, 43.00, 4.70},
-    {0.00, 0.00, 0.00, 43.40, 4.70},
-    {0.00, 0.00, 0.00, 43.80, 4.70},
-    {0.00, 0.00, 0.00, 44.20, 4.70},
-    {0.00, 0.00, 0.00, 44.60, 4.70},
-    {0.00, 0.00, 0.00, 45.00, 4.70},
-    {0.00, 0.00, 0.00, 45.40, 4.70},
-    {0.00, 0.00, 0.00, 45.80, 4.70},
-    {0.00, 0.00, 0.00, 46.20, 4.70},
-    {0.00, 0.00, 0.00, 46.60, 4.70},
-    {0.00, 0.00, 0.00, 47.00, 4.70},
-    {0.00, 0.00, 0.00, 47.40, 4.70},
-    {0.00, 0.00, 0.00, 47.80, 4.70},
-    {0.00, 0.00, 0.00, 48.20, 4.70},
-    {0.00, 0.00, 0.00, 48.60, 4.70},
-    {0.00, 0.00, 0.00, 49.00, 4.70},
-    {0.00, 0.00, 0.00, 49.40, 4.70},
-    {0.00, 0.00, 0.00, 49.80, 4.70},
-    {0.00, 0.00, 0.00, 50.20, 4.70},
-    {0.00, 0.00, 0.00, 50.60, 4.70},
-    {0.00, 0.00, 0.00, 51.00, 4.70},
-    {0.00, 0.00, 0.00, 51.40, 4.70},
-    {0.00, 0.00, 0.00, 51.80, 4.70},
-    {0.00, 0.00, 0.00, 52.20, 4.70},
-    {0.00, 0.00, 0.00, 52.60, 4.70},
-    {0.00, 0.00, 0.00, 53.00, 4.70},
-    {0.00, 0.00, 0.00, 53.40, 4.70},
-    {0.00, 0.00, 0.00, 53.80, 4.70},
-    {0.00, 0.00, 0.00, 54.20, 4.70},
-    {0.00, 0.00, 0.00, 54.60, 4.70},
-    {0.00, 0.00, 0.00, 55.00, 4.70},
-    {0.00, 0.00, 0.00, 55.40, 4.70},
-    {0.00, 0.00, 0.00, 55.80, 4.70},
-    {0.00, 0.00, 0.00, 56.20, 4.70},
-    {0.00, 0.00, 0.00, 56.60, 4.70},
-    {0.00, 0.00, 0.00, 57.00, 4.70},
-    {0.00, 0.00, 0.00, 57.40, 4.70},
-    {0.00, 0.00, 0.00, 57.80, 4.70},
-    {0.00, 0.00, 0.00, 58.20, 4.70},
-    {0.00, 0.00, 0.00, 58.60, 4.70},
-    {0.00, 0.00, 0.00, 59.00, 4.70},
-    {0.00, 0.00, 0.00, 59.40, 4.70},
-    {0.00, 0.00, 0.00, 59.80, 4.70},
-    {0.00, 0.00, 0.00, -59.80, 4.90},
-    {0.00, 0.00, 0.00, -59.40, 4.90},
-    {0.00, 0.00, 0.00, -59.00, 4.90},
-    {0.00, 0.00, 0.00, -58.60, 4.90},
-    {0.00, 0.00, 0.00, -58.20, 4.90},
-    {0.00, 0.00, 0.00, -57.80, 4.90},
-    {0.00, 0.00, 0.00, -57.40, 4.90},
-    {0.00, 0.00, 0.00, -57.00, 4.90},
-    {0.00, 0.00, 0.00, -56.60, 4.90},
-    {0.00, 0.00, 0.00, -56.20, 4.90},
-    {0.00, 0.00, 0.00, -55.80, 4.90},
-    {0.00, 0.00, 0.00, -55.40, 4.90},
-    {0.00, 0.00, 0.00, -55.00, 4.90},
-    {0.00, 0.00, 0.00, -54.60, 4.90},
-    {0.00, 0.00, 0.00, -54.20, 4.90},
-    {0.00, 0.00, 0.00, -53.80, 4.90},
-    {0.00, 0.00, 0.00, -53.40, 4.90},
-    {0.00, 0.00, 0.00, -53.00, 4.90},
-    {0.00, 0.00, 0.00, -52.60, 4.90},
-    {0.00, 0.00, 0.00, -52.20, 4.90},
-    {0.00, 0.00, 0.00, -51.80, 4.90},
-    {0.00, 0.00, 0.00, -51.40, 4.90},
-    {0.00, 0.00, 0.00, -51.00, 4.90},
-    {0.00, 0.00, 0.00, -50.60, 4.90},
-    {0.00, 0.00, 0.00, -50.20, 4.90},
-    {0.00, 0.00, 0.00, -49.80, 4.90},
-    {0.00, 0.00, 0.00, -49.40, 4.90},
-    {0.00, 0.00, 0.00, -49.00, 4.90},
-    {0.00, 0.00, 0.00, -48.60, 4.90},
-    {0.00, 0.00, 0.00, -48.20, 4.90},
-    {0.00, 0.00, 0.00, -47.80, 4.90},
-    {0.00, 0.00, 0.00, -47.40, 4.90},
-    {0.00, 0.00, 0.00, -47.00, 4.90},
-    {0.00, 0.00, 0.00, -46.60, 4.90},
-    {0.00, 0.00, 0.00, -46.20, 4.90},
-    {0.00, 0.00, 0.00, -45.80, 4.90},
-    {0.00, 0.00, 0.00, -45.40, 4.90},
-    {0.00, 0.00, 0.00, -45.00, 4.90},
-    {0.00, 0.00, 0.00, -44.60, 4.90},
-    {0.00, 0.00, 0.00, -44.20, 4.90},
-    {0.00, 0.00, 0.00, -43.80, 4.90},
-    {0.00, 0.00, 0.00, -43.40, 4.90},
-    {0.00, 0.00, 0.00, -43.00, 4.90},
-    {0.00, 0.00, 0.00, -42.60, 4.90},
-    {0.00, 0.00, 0.00, -42.20, 4.90},
-    {0.00, 0.00, 0.00, -41.80, 4.90},
-    {0.00, 0.00, 0.00, -41.40, 4.90},
-    {0.00, 0.00, 0.00, -41.00, 4.90},
-    {0.00, 0.00, 0.00, -40.60, 4.90},
-    {0.00, 0.00, 0.00, -40.20, 4.90},
-    {0.00, 0.00, 0.00, -39.80, 4.90},
-    {0.00, 0.00, 0.00, -39.40, 4.90},
-    {0.00, 0.00, 0.00, -39.00, 4.90},
-    {0.00, 0.00, 0.00, -38.60, 4.90},
-    {0.00, 0.00, 0.00, -38.20, 4.90},
-    {0.00, 0.00, 0.00, -37.80, 4.90},
-    {0.00, 0.00, 0.00, -37.40, 4.90},
-    {0.00, 0.00, 0.00, -37.00, 4.90},
-    {0.00, 0.00, 0.00, -36.60, 4.90},
-    {0.00, 0.00, 0.00, -36.20, 4.90},
-    {0.00, 0.00, 0.00, -35.80, 4.90},
-    {0.00, 0.00, 0.00, -35.40, 4.90},
-    {0.00, 0.00, 0.00, -35.00, 4.90},
-    {0.00, 0.00, 0.00, -34.60, 4.90},
-    {0.00, 0.00, 0.00, -34.20, 4.90},
-    {0.00, 0.00, 0.00, -33.80, 4.90},
-    {0.00, 0.00, 0.00, -33.40, 4.90},
-    {0.00, 0.00, 0.00, -33.00, 4.90},
-    {0.00, 0.00, 0.00, -32.60, 4.90},
-    {0.00, 0.00, 0.00, -32.20, 4.90},
-    {0.00, 0.00, 0.00, -31.80, 4.90},
-    {0.00, 0.00, 0.00, -31.40, 4.90},
-    {0.00, 0.00, 0.00, -31.00, 4.90},
-    {0.00, 0.00, 0.00, -30.60, 4.90},
-    {0.00, 0.00, 0.00, -30.20, 4.90},
-    {0.00, 0.00, 0.00, -29.80, 4.90},
-    {0.00, 0.00, 0.00, -29.40, 4.90},
-    {0.00, 0.00, 0.00, -29.00, 4.90},
-    {0.00, 0.00, 0.00, -28.60, 4.90},
-    {0.00, 0.00, 0.00, -28.20, 4.90},
-    {0.00, 0.00, 0.00, -27.80, 4.90},
-    {0.00, 0.00, 0.00, -27.40, 4.90},
-    {0.00, 0.00, 0.00, -27.00, 4.90},
-    {0.00, 0.00, 0.00, -26.60, 4.90},
-    {0.00, 0.00, 0.00, -26.20, 4.90},
-    {0.00, 0.00, 0.00, -25.80, 4.90},
-    {0.00, 0.00, 0.00, -25.40, 4.90},
-    {0.00, 0.00, 0.00, -25.00, 4.90},
-    {0.00, 0.00, 0.00, -24.60, 4.90},
-    {0.00, 0.00, 0.00, -24.20, 4.90},
-    {0.00, 0.00, 0.00, -23.80, 4.90},
-    {0.00, 0.00, 0.00, -23.40, 4.90},
-    {0.00, 0.00, 0.00, -23.00, 4.90},
-    {0.00, 0.00, 0.00, -22.60, 4.90},
-    {0.00, 0.00, 0.00, -22.20, 4.90},
-    {0.00, 0.00, 0.00, -21.80, 4.90},
-    {0.00, 0.00, 0.00, -21.40, 4.90},
-    {0.00, 0.00, 0.00, -21.00, 4.90},
-    {0.00, 0.00, 0.00, -20.60, 4.90},
-    {0.00, 0.00, 0.00, -20.20, 4.90},
-    {0.00, 0.00, 0.00, -19.80, 4.90},
-    {0.00, 0.00, 0.00, -19.40, 4.90},
-    {0.00, 0.00, 0.00, -19.00, 4.90},
-    {0.00, 0.00, 0.00, -18.60, 4.90},
-    {0.00, 0.00, 0.00, -18.20, 4.90},
-    {0.00, 0.00, 0.00, -17.80, 4.90},
-    {0.00, 0.00, 0.00, -17.40, 4.90},
-    {0.00, 0.00, 0.00, -17.00, 4.90},
-    {0.00, 0.00, 0.00, -16.60, 4.90},
-    {0.00, 0.00, 0.00, -16.20, 4.90},
-    {0.00, 0.00, 0.00, -15.80, 4.90},
-    {0.00, 0.00, 0.00, -15.40, 4.90},
-    {0.00, 0.00, 0.00, -15.00, 4.90},
-    {0.00, 0.00, 0.00, -14.60, 4.90},
-    {0.00, 0.00, 0.00, -14.20, 4.90},
-    {0.00, 0.00, 0.00, -13.80, 4.90},
-    {0.00, 0.00, 0.00, -13.40, 4.90},
-    {0.00, 0.00, 0.00, -13.00, 4.90},
-    {0.00, 0.00, 0.00, -12.60, 4.90},
-    {0.00, 0.00, 0.00, -12.20, 4.90},
-    {0.00, 0.00, 0.00, -11.80, 4.90},
-    {0.00, 0.00, 0.00, -11.40, 4.90},
-    {0.00, 0.00, 0.00, -11.00, 4.90},
-    {0.00, 0.00, 0.00, -10.60, 4.90},
-    {0.00, 0.00, 0.00, -10.20, 4.90},
-    {0.00, 0.00, 0.00, -9.80, 4.90},
-    {0.00, 0.00, 0.00, -9.40, 4.90},
-    {0.00, 0.00, 0.00, -9.00, 4.90},
-    {0.00, 0.00, 0.00, -8.60, 4.90},
-    {0.00, 0.00, 0.00, -8.20, 4.90},
-    {0.00, 0.00, 0.00, -7.80, 4.90},
-    {0.00, 0.00, 0.00, -7.40, 4.90},
-    {0.00, 0.00, 0.00, -7.00, 4.90},
-    {0.00, 0.00, 0.00, -6.60, 4.90},
-    {0.00, 0.00, 0.00, -6.20, 4.90},
-    {0.00, 0.00, 0.00, -5.80, 4.90},
-    {0.00, 0.00, 0.00, -5.40, 4.90},
-    {0.00, 0.00, 0.00, -5.00, 4.90},
-    {0.00, 0.00, 0.00, -4.60, 4.90},
-    {0.00, 0.00, 0.00, -4.20, 4.90},
-    {0.00, 0.00, 0.00, -3.80, 4.90},
-    {0.00, 0.00, 0.00, -3.40, 4.90},
-    {0.00, 0.00, 0.00, -3.00, 4.90},
-    {0.00, 0.00, 0.00, -2.60, 4.90},
-    {0.00, 0.00, 0.00, -2.20, 4.90},
-    {0.00, 0.00, 0.00, -1.80, 4.90},
-    {0.00, 0.00, 0.00, -1.40, 4.90},
-    {0.00, 0.00, 0.00, -1.00, 4.90},
-    {0.00, 0.00, 0.00, -0.60, 4.90},
-    {0.00, 0.00, 0.00, -0.20, 4.90},
-    {0.00, 0.00, 0.00, 0.20, 4.90},
-    {0.00, 0.00, 0.00, 0.60, 4.90},
-    {0.00, 0.00, 0.00, 1.00, 4.90},
-    {0.00, 0.00, 0.00, 1.40, 4.90},
-    {0.00, 0.00, 0.00, 1.80, 4.90},
-    {0.00, 0.00, 0.00, 2.20, 4.90},
-    {0.00, 0.00, 0.00, 2.60, 4.90},
-    {0.00, 0.00, 0.00, 3.00, 4.90},
-    {0.00, 0.00, 0.00, 3.40, 4.90},
-    {0.00, 0.00, 0.00, 3.80, 4.90},
-    {0.00, 0.00, 0.00, 4.20, 4.90},
-    {0.00, 0.00, 0.00, 4.60, 4.90},
-    {0.00, 0.00, 0.00, 5.00, 4.90},
-    {0.00, 0.00, 0.00, 5.40, 4.90},
-    {0.00, 0.00, 0.00, 5.80, 4.90},
-    {0.00, 0.00, 0.00, 6.20, 4.90},
-    {0.00, 0.00, 0.00, 6.60, 4.90},
-    {0.00, 0.00, 0.00, 7.00, 4.90},
-    {0.00, 0.00, 0.00, 7.40, 4.90},
-    {0.00, 0.00, 0.00, 7.80, 4.90},
-    {0.00, 0.00, 0.00, 8.20, 4.90},
-    {0.00, 0.00, 0.00, 8.60, 4.90},
-    {0.00, 0.00, 0.00, 9.00, 4.90},
-    {0.00, 0.00, 0.00, 9.40, 4.90},
-    {0.00, 0.00, 0.00, 9.80, 4.90},
-    {0.00, 0.00, 0.00, 10.20, 4.90},
-    {0.00, 0.00, 0.00, 10.60, 4.90},
-    {0.00, 0.00, 0.00, 11.00, 4.90},
-    {0.00, 0.00, 0.00, 11.40, 4.90},
-    {0.00, 0.00, 0.00, 11.80, 4.90},
-    {0.00, 0.00, 0.00, 12.20, 4.90},
-    {0.00, 0.00, 0.00, 12.60, 4.90},
-    {0.00, 0.00, 0.00, 13.00, 4.90},
-    {0.00, 0.00, 0.00, 13.40, 4.90},
-    {0.00, 0.00, 0.00, 13.80, 4.90},
-    {0.00, 0.00, 0.00, 14.20, 4.90},
-    {0.00, 0.00, 0.00, 14.60, 4.90},
-    {0.00, 0.00, 0.00, 15.00, 4.90},
-    {0.00, 0.00, 0.00, 15.40, 4.90},
-    {0.00, 0.00, 0.00, 15.80, 4.90},
-    {0.00, 0.00, 0.00, 16.20, 4.90},
-    {0.00, 0.00, 0.00, 16.60, 4.90},
-    {0.00, 0.00, 0.00, 17.00, 4.90},
-    {0.00, 0.00, 0.00, 17.40, 4.90},
-    {0.00, 0.00, 0.00, 17.80, 4.90},
-    {0.00, 0.00, 0.00, 18.20, 4.90},
-    {0.00, 0.00, 0.00, 18.60, 4.90},
-    {0.00, 0.00, 0.00, 19.00, 4.90},
-    {0.00, 0.00, 0.00, 19.40, 4.90},
-    {0.00, 0.00, 0.00, 19.80, 4.90},
-    {0.00, 0.00, 0.00, 20.20, 4.90},
-    {0.00, 0.00, 0.00, 20.60, 4.90},
-    {0.00, 0.00, 0.00, 21.00, 4.90},
-    {0.00, 0.00, 0.00, 21.40, 4.90},
-    {0.00, 0.00, 0.00, 21.80, 4.90},
-    {0.00, 0.00, 0.00, 22.20, 4.90},
-    {0.00, 0.00, 0.00, 22.60, 4.90},
-    {0.00, 0.00, 0.00, 23.00, 4.90},
-    {0.00, 0.00, 0.00, 23.40, 4.90},
-    {0.00, 0.00, 0.00, 23.80, 4.90},
-    {0.00, 0.00, 0.00, 24.20, 4.90},
-    {0.00, 0.00, 0.00, 24.60, 4.90},
-    {0.00, 0.00, 0.00, 25.00, 4.90},
-    {0.00, 0.00, 0.00, 25.40, 4.90},
-    {0.00, 0.00, 0.00, 25.80, 4.90},
-    {0.00, 0.00, 0.00, 26.20, 4.90},
-    {0.00, 0.00, 0.00, 26.60, 4.90},
-    {0.00, 0.00, 0.00, 27.00, 4.90},
-    {0.00, 0.00, 0.00, 27.40, 4.90},
-    {0.00, 0.00, 0.00, 27.80, 4.90},
-    {0.00, 0.00, 0.00, 28.20, 4.90},
-    {0.00, 0.00, 0.00, 28.60, 4.90},
-    {0.00, 0.00, 0.00, 29.00, 4.90},
-    {0.00, 0.00, 0.00, 29.40, 4.90},
-    {0.00, 0.00, 0.00, 29.80, 4.90},
-    {0.00, 0.00, 0.00, 30.20, 4.90},
-    {0.00, 0.00, 0.00, 30.60, 4.90},
-    {0.00, 0.00, 0.00, 31.00, 4.90},
-    {0.00, 0.00, 0.00, 31.40, 4.90},
-    {0.00, 0.00, 0.00, 31.80, 4.90},
-    {0.00, 0.00, 0.00, 32.20, 4.90},
-    {0.00, 0.00, 0.00, 32.60, 4.90},
-    {0.00, 0.00, 0.00, 33.00, 4.90},
-    {0.00, 0.00, 0.00, 33.40, 4.90},
-    {0.00, 0.00, 0.00, 33.80, 4.90},
-    {0.00, 0.00, 0.00, 34.20, 4.90},
-    {0.00, 0.00, 0.00, 34.60, 4.90},
-    {0.00, 0.00, 0.00, 35.00, 4.90},
-    {0.00, 0.00, 0.00, 35.40, 4.90},
-    {0.00, 0.00, 0.00, 35.80, 4.90},
-    {0.00, 0.00, 0.00, 36.20, 4.90},
-    {0.00, 0.00, 0.00, 36.60, 4.90},
-    {0.00, 0.00, 0.00, 37.00, 4.90},
-    {0.00, 0.00, 0.00, 37.40, 4.90},
-    {0.00, 0.00, 0.00, 37.80, 4.90},
-    {0.00, 0.00, 0.00, 38.20, 4.90},
-    {0.00, 0.00, 0.00, 38.60, 4.90},
-    {0.00, 0.00, 0.00, 39.00, 4.90},
-    {0.00, 0.00, 0.00, 39.40, 4.90},
-    {0.00, 0.00, 0.00, 39.80, 4.90},
-    {0.00, 0.00, 0.00, 40.20, 4.90},
-    {0.00, 0.00, 0.00, 40.60, 4.90},
-    {0.00, 0.00, 0.00, 41.00, 4.90},
-    {0.00, 0.00, 0.00, 41.40, 4.90},
-    {0.00, 0.00, 0.00, 41.80, 4.90},
-    {0.00, 0.00, 0.00, 42.20, 4.90},
-    {0.00, 0.00, 0.00, 42.60, 4.90},
-    {0.00, 0.00, 0.00, 43.00, 4.90},
-    {0.00, 0.00, 0.00, 43.40, 4.90},
-    {0.00, 0.00, 0.00, 43.80, 4.90},
-    {0.00, 0.00, 0.00, 44.20, 4.90},
-    {0.00, 0.00, 0.00, 44.60, 4.90},
-    {0.00, 0.00, 0.00, 45.00, 4.90},
-    {0.00, 0.00, 0.00, 45.40, 4.90},
-    {0.00, 0.00, 0.00, 45.80, 4.90},
-    {0.00, 0.00, 0.00, 46.20, 4.90},
-    {0.00, 0.00, 0.00, 46.60, 4.90},
-    {0.00, 0.00, 0.00, 47.00, 4.90},
-    {0.00, 0.00, 0.00, 47.40, 4.90},
-    {0.00, 0.00, 0.00, 47.80, 4.90},
-    {0.00, 0.00, 0.00, 48.20, 4.90},
-    {0.00, 0.00, 0.00, 48.60, 4.90},
-    {0.00, 0.00, 0.00, 49.00, 4.90},
-    {0.00, 0.00, 0.00, 49.40, 4.90},
-    {0.00, 0.00, 0.00, 49.80, 4.90},
-    {0.00, 0.00, 0.00, 50.20, 4.90},
-    {0.00, 0.00, 0.00, 50.60, 4.90},
-    {0.00, 0.00, 0.00, 51.00, 4.90},
-    {0.00, 0.00, 0.00, 51.40, 4.90},
-    {0.00, 0.00, 0.00, 51.80, 4.90},
-    {0.00, 0.00, 0.00, 52.20, 4.90},
-    {0.00, 0.00, 0.00, 52.60, 4.90},
-    {0.00, 0.00, 0.00, 53.00, 4.90},
-    {0.00, 0.00, 0.00, 53.40, 4.90},
-    {0.00, 0.00, 0.00, 53.80, 4.90},
-    {0.00, 0.00, 0.00, 54.20, 4.90},
-    {0.00, 0.00, 0.00, 54.60, 4.90},
-    {0.00, 0.00, 0.00, 55.00, 4.90},
-    {0.00, 0.00, 0.00, 55.40, 4.90},
-    {0.00, 0.00, 0.00, 55.80, 4.90},
-    {0.00, 0.00, 0.00, 56.20, 4.90},
-    {0.00, 0.00, 0.00, 56.60, 4.90},
-    {0.00, 0.00, 0.00, 57.00, 4.90},
-    {0.00, 0.00, 0.00, 57.40, 4.90},
-    {0.00, 0.00, 0.00, 57.80, 4.90},
-    {0.00, 0.00, 0.00, 58.20, 4.90},
-    {0.00, 0.00, 0.00, 58.60, 4.90},
-    {0.00, 0.00, 0.00, 59.00, 4.90},
-    {0.00, 0.00, 0.00, 59.40, 4.90},
-    {0.00, 0.00, 0.00, 59.80, 4.90}
-};
\ No newline at end of file
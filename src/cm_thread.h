@@ -0,0 +1,178 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cm_thread.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  Thread, Mutex and Condition Wrappers
+**
+***************************************************************/
+
+#ifndef CM_THREAD_H
+#define CM_THREAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdbool.h>
+
+#if WIN32
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/* thread entry points are declared with CM_THREAD_FUNC(name) and end with CM_THREAD_RETURN */
+#if WIN32
+    #define CM_THREAD_FUNC(name) DWORD WINAPI name(LPVOID arg)
+    #define CM_THREAD_RETURN return 0
+#else
+    #define CM_THREAD_FUNC(name) void *name(void *arg)
+    #define CM_THREAD_RETURN return NULL
+#endif
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/* what a full bounded queue between two threads gives up */
+typedef enum
+{
+    CM_DROP_OLDEST = 0, // discard the oldest entry
+    CM_DROP_NEWEST,     // reject the incoming entry
+} cm_drop_policy_t;
+
+#if WIN32
+    typedef HANDLE cm_thread_t;
+    typedef CRITICAL_SECTION cm_mutex_t;
+    typedef CONDITION_VARIABLE cm_cond_t;
+    typedef LPTHREAD_START_ROUTINE cm_thread_func_t;
+#else
+    typedef pthread_t cm_thread_t;
+    typedef pthread_mutex_t cm_mutex_t;
+    typedef pthread_cond_t cm_cond_t;
+    typedef void *(*cm_thread_func_t)(void *);
+#endif
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+static inline bool cm_thread_start(cm_thread_t *thread, cm_thread_func_t func, void *arg)
+{
+    #if WIN32
+        *thread = CreateThread(NULL, 0, func, arg, 0, NULL);
+        return *thread != NULL;
+    #else
+        return pthread_create(thread, NULL, func, arg) == 0;
+    #endif
+}
+
+static inline void cm_thread_join(cm_thread_t thread)
+{
+    #if WIN32
+        WaitForSingleObject(thread, INFINITE);
+        CloseHandle(thread);
+    #else
+        pthread_join(thread, NULL);
+    #endif
+}
+
+static inline void cm_mutex_init(cm_mutex_t *mutex)
+{
+    #if WIN32
+        InitializeCriticalSection(mutex);
+    #else
+        pthread_mutex_init(mutex, NULL);
+    #endif
+}
+
+static inline void cm_mutex_destroy(cm_mutex_t *mutex)
+{
+    #if WIN32
+        DeleteCriticalSection(mutex);
+    #else
+        pthread_mutex_destroy(mutex);
+    #endif
+}
+
+static inline void cm_mutex_lock(cm_mutex_t *mutex)
+{
+    #if WIN32
+        EnterCriticalSection(mutex);
+    #else
+        pthread_mutex_lock(mutex);
+    #endif
+}
+
+static inline void cm_mutex_unlock(cm_mutex_t *mutex)
+{
+    #if WIN32
+        LeaveCriticalSection(mutex);
+    #else
+        pthread_mutex_unlock(mutex);
+    #endif
+}
+
+static inline void cm_cond_init(cm_cond_t *cond)
+{
+    #if WIN32
+        InitializeConditionVariable(cond);
+    #else
+        pthread_cond_init(cond, NULL);
+    #endif
+}
+
+static inline void cm_cond_destroy(cm_cond_t *cond)
+{
+    #if WIN32
+        (void)cond; // nothing to release
+    #else
+        pthread_cond_destroy(cond);
+    #endif
+}
+
+static inline void cm_cond_wait(cm_cond_t *cond, cm_mutex_t *mutex)
+{
+    #if WIN32
+        SleepConditionVariableCS(cond, mutex, INFINITE);
+    #else
+        pthread_cond_wait(cond, mutex);
+    #endif
+}
+
+static inline void cm_cond_signal(cm_cond_t *cond)
+{
+    #if WIN32
+        WakeConditionVariable(cond);
+    #else
+        pthread_cond_signal(cond);
+    #endif
+}
+
+static inline void cm_cond_broadcast(cm_cond_t *cond)
+{
+    #if WIN32
+        WakeAllConditionVariable(cond);
+    #else
+        pthread_cond_broadcast(cond);
+    #endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CM_THREAD_H */
@@ -0,0 +1,72 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cm_util.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  Clock and Byte Order Helpers
+**
+***************************************************************/
+
+#ifndef CM_UTIL_H
+#define CM_UTIL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+
+#if WIN32
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+/* monotonic clock in nanoseconds, for intervals and ordering; unaffected by wall clock steps */
+static inline uint64_t cm_now_ns(void)
+{
+    #if WIN32
+        static LARGE_INTEGER freq;
+        LARGE_INTEGER now;
+        if (freq.QuadPart == 0)
+            QueryPerformanceFrequency(&freq);
+        QueryPerformanceCounter(&now);
+        return (uint64_t)((double)now.QuadPart * 1e9 / (double)freq.QuadPart);
+    #else
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+    #endif
+}
+
+/* little endian, for the headers of files and tagged blobs */
+static inline void cm_put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v);
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static inline uint32_t cm_get_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CM_UTIL_H */
@@ -0,0 +1,238 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmbatch.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  Headless Batch Mode
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmbatch.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#if WIN32
+    #include <direct.h>
+#else
+    #include <sys/stat.h>
+#endif
+
+#include "cm_util.h"
+#include "cmlog.h"
+#include "cmxif.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define DIR_SIZE (1024)
+
+/* the directory and a file name in it */
+#define PATH_SIZE (DIR_SIZE + 32)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef struct
+{
+    uint64_t totalNs;
+    uint64_t maxNs;
+} tPhase;
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static int make_dir(const char *dir);
+static void write_result(int status, double simS, double wallS, uint64_t loopNs);
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+static struct {
+    bool enabled;
+    char dir[DIR_SIZE];
+
+    uint64_t start;         // wall clock, ns
+    bool started;
+    uint64_t last;          // simulation time, ms
+    uint64_t simMs;         // advanced, across restarts of the simulation time
+
+    unsigned long cycles;
+    tPhase phases[CMBATCH_PHASES];
+} Batch;
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmbatch_set_option(const char *dir)
+{
+    size_t len = strlen(dir);
+
+    if (len == 0 || len >= DIR_SIZE)
+    {
+        fprintf(stderr, "cmbatch: '%s' isn't a usable output directory\n", dir);
+        return -1;
+    }
+
+    if (make_dir(dir) != 0)
+    {
+        fprintf(stderr, "cmbatch: can't create output directory %s: %s\n", dir, strerror(errno));
+        return -1;
+    }
+
+    memcpy(Batch.dir, dir, len + 1);
+    Batch.enabled = true;
+
+    return 0;
+}
+
+bool cmbatch_enabled(void)
+{
+    return Batch.enabled;
+}
+
+int cmbatch_start(void)
+{
+    char path[PATH_SIZE];
+
+    snprintf(path, sizeof(path), "%s/%s", Batch.dir, CMBATCH_SINK_FILE);
+
+    if (cmxif_set_sink(path) != 0)
+        return -1;
+
+    Batch.start = cm_now_ns();
+
+    CMLOG(CMLOG_MAIN, CMLOG_INFO, "batch mode, sensor output to %s", path);
+
+    return 0;
+}
+
+void cmbatch_cycle(uint64_t now, const uint64_t ns[CMBATCH_PHASES])
+{
+    // a new test run starts the simulation time over, only what it advanced counts
+    if (Batch.started && now > Batch.last)
+        Batch.simMs += now - Batch.last;
+
+    Batch.started = true;
+    Batch.last = now;
+    Batch.cycles++;
+
+    for (int i = 0; i < CMBATCH_PHASES; ++i)
+    {
+        tPhase *p = &Batch.phases[i];
+
+        p->totalNs += ns[i];
+        if (ns[i] > p->maxNs)
+            p->maxNs = ns[i];
+    }
+}
+
+void cmbatch_finish(int status)
+{
+    if (!Batch.enabled)
+        return;
+
+    double wallS = (cm_now_ns() - Batch.start) * 1e-9;
+    double simS = Batch.simMs * 1e-3;
+    uint64_t loopNs = 0;
+
+    for (int i = 0; i < CMBATCH_PHASES; ++i)
+    {
+        loopNs += Batch.phases[i].totalNs;
+    }
+
+    CMLOG(CMLOG_MAIN, CMLOG_INFO, "%.3f s simulated in %.3f s, real time factor %.2f, %lu cycles, exit status %d",
+          simS, wallS, wallS > 0.0 ? simS / wallS : 0.0, Batch.cycles, status);
+
+    for (int i = 0; i < CMBATCH_PHASES && Batch.cycles > 0; ++i)
+    {
+        const tPhase *p = &Batch.phases[i];
+
+        CMLOG(CMLOG_MAIN, CMLOG_INFO, "  %-8s mean %8.1f us, max %9.1f us, %5.1f %% of the loop",
+              cmbatch_phase_name((cmbatch_phase_t)i), p->totalNs * 1e-3 / Batch.cycles, p->maxNs * 1e-3,
+              loopNs > 0 ? 100.0 * p->totalNs / loopNs : 0.0);
+    }
+
+    CMLOG(CMLOG_MAIN, CMLOG_INFO, "  %.3f s outside the loop, start up and shut down", wallS - loopNs * 1e-9);
+
+    write_result(status, simS, wallS, loopNs);
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static int make_dir(const char *dir)
+{
+    #if WIN32
+        int rv = _mkdir(dir);
+    #else
+        int rv = mkdir(dir, 0777);
+    #endif
+
+    return (rv == 0 || errno == EEXIST) ? 0 : -1;
+}
+
+/* the same figures as JSON, for collecting the results of many runs */
+static void write_result(int status, double simS, double wallS, uint64_t loopNs)
+{
+    char path[PATH_SIZE];
+    FILE *f;
+
+    snprintf(path, sizeof(path), "%s/%s", Batch.dir, CMBATCH_RESULT_FILE);
+
+    if ((f = fopen(path, "w")) == NULL)
+    {
+        CMLOG(CMLOG_MAIN, CMLOG_ERROR, "can't write %s", path);
+        return;
+    }
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"status\": %d,\n", status);
+    fprintf(f, "  \"sim_s\": %.3f,\n", simS);
+    fprintf(f, "  \"wall_s\": %.3f,\n", wallS);
+    fprintf(f, "  \"rtf\": %.3f,\n", wallS > 0.0 ? simS / wallS : 0.0);
+    fprintf(f, "  \"cycles\": %lu,\n", Batch.cycles);
+    fprintf(f, "  \"loop_s\": %.3f,\n", loopNs * 1e-9);
+
+    fprintf(f, "  \"phases\": {\n");
+    for (int i = 0; i < CMBATCH_PHASES; ++i)
+    {
+        const tPhase *p = &Batch.phases[i];
+
+        fprintf(f, "    \"%s\": { \"total_s\": %.6f, \"mean_us\": %.3f, \"max_us\": %.3f }%s\n",
+                cmbatch_phase_name((cmbatch_phase_t)i), p->totalNs * 1e-9, Batch.cycles > 0 ? p->totalNs * 1e-3 / Batch.cycles : 0.0,
+                p->maxNs * 1e-3, i + 1 < CMBATCH_PHASES ? "," : "");
+    }
+    fprintf(f, "  },\n");
+
+    fprintf(f, "  \"streams\": {\n");
+    for (int i = 0; i < CMXIF_STREAMS; ++i)
+    {
+        cmxif_stats_t stats;
+        cmxif_stats((cmxif_stream_t)i, &stats);
+
+        fprintf(f, "    \"%s\": { \"sent\": %lu, \"dropped\": %lu }%s\n",
+                cmxif_stream_name((cmxif_stream_t)i), stats.sent, stats.dropped, i + 1 < CMXIF_STREAMS ? "," : "");
+    }
+    fprintf(f, "  }\n");
+    fprintf(f, "}\n");
+
+    if (fclose(f) != 0)
+        CMLOG(CMLOG_MAIN, CMLOG_ERROR, "can't write %s", path);
+}
@@ -0,0 +1,86 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmbatch.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  Headless Batch Mode
+**
+***************************************************************/
+
+#ifndef CMBATCH_H
+#define CMBATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/* time acceleration the simulation runs at, far beyond what any host reaches */
+#define CMBATCH_TACCEL (1e6)
+
+#define CMBATCH_SINK_FILE "sensors.cmxs"
+#define CMBATCH_RESULT_FILE "batch.json"
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/* the parts of a main loop cycle that are timed */
+typedef enum
+{
+    CMBATCH_MODEL = 0,  // inputs and vehicle models, CM_Main_running()
+    CMBATCH_TASKS,      // scheduled sensor tasks, cmsched_run()
+    CMBATCH_FINISH,     // outputs and end of cycle, CM_Main_update()
+    CMBATCH_PHASES
+} cmbatch_phase_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+/* as in the log and batch.json: model, tasks or finish */
+static inline const char *cmbatch_phase_name(cmbatch_phase_t phase)
+{
+    static const char *const names[CMBATCH_PHASES] = { "model", "tasks", "finish" };
+
+    return ((unsigned int)phase < CMBATCH_PHASES) ? names[phase] : "unknown";
+}
+
+/*
+ * Run headless: no image client, the main loop as fast as it goes and
+ * XIF messages written to dir/sensors.cmxs, a directory created if it
+ * doesn't exist.
+ */
+int cmbatch_set_option(const char *dir);
+
+bool cmbatch_enabled(void);
+
+/* open the sink and start the wall clock, before cmxif_start() */
+int cmbatch_start(void);
+
+/* one main loop cycle ending at simulation time now in ms, ns of wall time per phase */
+void cmbatch_cycle(uint64_t now, const uint64_t ns[CMBATCH_PHASES]);
+
+/* log the real time factor and phase timing and write them to dir/batch.json, after cmxif_stop() */
+void cmbatch_finish(int status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMBATCH_H */
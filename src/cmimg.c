@@ -26,6 +26,7 @@
 
 #include <signal.h>
 #include <inttypes.h>
+#include <stdatomic.h>
 
 
 #if WIN32
@@ -43,15 +44,39 @@
     #include <arpa/inet.h>
     #include <netdb.h>
     #include <pthread.h>
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <sys/timerfd.h>
 #endif
 
 #include <fcntl.h>
 #include <xif_server.h>
 
+#include "cm_util.h"
+#include "cmimg_pool.h"
+#include "cmimg_queue.h"
+#include "cmimg_rsds.h"
+#include "cmimg_convert.h"
+#include "cmimg_resize.h"
+#include "cmimg_encode.h"
+#include "cmimg_metrics.h"
+#include "cmimg_embedded.h"
+#include "cmlog.h"
+#include "cmxif.h"
+
 /***************************************************************
 ** MARK: CONSTANTS & MACROS
 ***************************************************************/
 
+#define CMIMG_MAX_CHANNELS (8)
+
+#define RSDS_RECONNECT_MIN_MS (100)
+#define RSDS_RECONNECT_MAX_MS (2000)
+#define RSDS_SOCKET_RCVBUF (8 * 1024 * 1024)
+
+_Static_assert(CMIMG_MAX_CHANNELS <= CMIMG_METRICS_CHANNELS, "metrics must cover every channel");
+_Static_assert(CMIMG_ENCODE_HEADER_SIZE <= CMIMG_POOL_HEADROOM, "raw frames are published with their header in the slot headroom");
+
 #if WIN32
     #define close closesocket
     #define snprintf _snprintf
@@ -76,17 +101,48 @@ typedef enum {
 } tSaveFormat;
 
 static struct {
-    FILE *EmbeddedDataCollectionFile;
+    FILE *EmbeddedDataCollectionFile; // CSV mode only
+    char *EmbeddedDataPath; // NULL -> embedded data isn't saved
+    bool EmbeddedDataBinary; // records through the binary writer instead of CSV text
     char *MovieHost; // pc on which IPGMovie or Movie NX runs
     int MoviePort; // TCP/IP port for RSDS
     int sock; // TCP/IP Socket
-    char sbuf[64]; // Buffer for transmitted information
-    int RecvFlags; // Receive Flags
     int Verbose; // Logging Output
     int ConnectionTries;
     tSaveFormat SaveFormat;
     int TerminationRequested;
-} RSDScfg;
+    int PoolDepth; // Number of preallocated image slots
+    int QueueDepth; // Frames buffered between receive thread and main loop
+    cm_drop_policy_t DropPolicy; // What to discard when the queue is full
+    unsigned int PublishMask; // Bit n set -> channel n is published through XIF
+    cmimg_convert_cfg_t Convert; // Pixel format conversion before publishing
+    char SIMD[8]; // Conversion kernels: auto, avx2, sse4.1 or scalar
+    cmimg_resize_cfg_t Resize[CMIMG_MAX_CHANNELS]; // ROI crop and downscale before publishing
+    cmimg_encoding_t Encoding[CMIMG_MAX_CHANNELS]; // Compression of the published frames
+    int EncodeThreads; // Workers shared by all compressed channels
+    int JpegQuality;
+    char *MetricsSink; // JSON lines file or udp:<host>:<port>, NULL -> no export
+    int MetricsPeriod; // ms between two metric samples
+} RSDScfg = {
+    .MovieHost = "localhost",
+    .MoviePort = 2210,
+    .sock = -1,
+    .Verbose = 0,
+    .ConnectionTries = 5,
+    .SaveFormat = SaveFormat_DataNotSaved,
+    .PoolDepth = CMIMG_POOL_DEFAULT_DEPTH,
+    .QueueDepth = CMIMG_QUEUE_DEFAULT_DEPTH,
+    .DropPolicy = CM_DROP_OLDEST,
+    .PublishMask = (1u << CMIMG_MAX_CHANNELS) - 1u,
+    .Convert = { .bgr = true, .grey_to_rgb = false },
+    .SIMD = "auto",
+    .EncodeThreads = 2,
+    .JpegQuality = 85,
+    .MetricsSink = NULL,
+    .MetricsPeriod = CMIMG_METRICS_DEFAULT_PERIOD_MS,
+    .EmbeddedDataPath = NULL,
+    .EmbeddedDataBinary = true,
+};
 
 struct {
     double tFirstDataTime;
@@ -97,25 +153,82 @@ struct {
     unsigned long long int nBytesSim;
     unsigned long int nImagesTotal;
     unsigned long int nImagesSim;
+    unsigned long int nImagesDropped;
     unsigned char nChannels;
+    struct {
+        unsigned long long int nBytes;
+        unsigned long int nImages;
+        unsigned long int nDropped;
+        int Width;
+        int Height;
+        char ImgType[32];
+    } Channel[CMIMG_MAX_CHANNELS];
 } RSDSIF;
 
+typedef enum {
+    RxState_Greeting = 0,
+    RxState_Header,
+    RxState_Payload,
+} tRxState;
+
+/* receive side parser state, only touched by the receive thread */
+static struct {
+    cmimg_rsds_stream_t stream;
+    tRxState state;
+    cmimg_rsds_header_t hdr;
+    cmimg_frame_t *frame; // slot the current image payload goes to
+    bool staged; // payload goes to the channel's staging buffer, the slot is taken after resizing
+    char *dest; // where payload bytes go, NULL -> discard
+    unsigned int got;
+    char *embedded; // reused buffer for *RSDSEmbeddedData payloads
+    size_t embeddedSize;
+} RSDSrx;
+
+/* every camera channel gets its own slots and queue so channels can't starve each other */
+typedef struct {
+    cmimg_pool_t pool;
+    cmimg_queue_t queue;
+    cmimg_resize_t resize;
+    cmimg_frame_t stage; // full size frame, only used when resizing
+
+    /* touched by the encoder workers only */
+    uint64_t lastEncoded; // timestamp of the newest compressed frame queued
+    atomic_ulong nEncodeDropped;
+    atomic_ullong nBytesEncoded;
+} tChannel;
+
 
 /***************************************************************
 ** MARK: STATIC FUNCTION DEFS
 ***************************************************************/
 
 static void cmimg_thread_main(void);
+#if !WIN32
+static void RSDS_ArmReconnect(int delay_ms);
+#endif
+static void cmimg_publish(cmimg_frame_t *frame);
+static void cmimg_sent(void *ctx, bool sent);
+static void cmimg_encoded(cmimg_frame_t *frame);
+static bool option_is(const char *option, size_t keyLen, const char *key);
+static unsigned int option_channels(const char **value);
 
 static int connect_with_timeout(int sockfd, struct sockaddr *addr, socklen_t addrlen, int timeout_ms);
 
 static void RSDS_Init(void);
-static int RSDS_GetData(void);
+static int RSDS_Pump(void);
+static void RSDS_Parse(void);
+static void RSDS_BeginPayload(char *hdr);
+static void RSDS_EndPayload(void);
+static cmimg_frame_t *RSDS_ResizeFrame(tChannel *chan, const cmimg_frame_t *staged);
 static int RSDS_Connect(void);
-static int RSDS_RecvHdr(int sock, char *buf);
+static void RSDS_Disconnect(void);
+#if WIN32
+static int RSDS_WaitReadable(int timeout_ms);
+#endif
 static void RSDS_PrintSimInfo();
 static void RSDS_PrintClosingInfo(void);
-static void RSDSIF_AddDataToStats(unsigned int len);
+static void RSDSIF_AddDataToStats(int Channel, unsigned int len);
+static void RSDSIF_AddDropToStats(int Channel);
 static void RSDSIF_UpdateStats(unsigned int ImgLen, const char *ImgType, int Channel, int ImgWidth, int ImgHeight, float SimTime);
 static void RSDSIF_UpdateEndSimTime();
 static void WriteEmbeddedDataToCSVFile(const char* data, unsigned int dataLen, int Channel, float SimTime, const char* AniMode);
@@ -147,14 +260,16 @@ static inline double GetTime()  // in seconds
 ***************************************************************/
 
 static pthread_t cmimg_thread;
-static volatile bool running = true;
+static atomic_bool running = true;
+
+static tChannel channels[CMIMG_MAX_CHANNELS];
+static bool encoderRunning = false;
 
-static volatile bool new_image = false;
-static volatile int ImgWidth = 0;
-static volatile int ImgHeight = 0;
-static volatile char* image_data = NULL;
-static volatile size_t image_size = 0;
-static volatile unsigned long long sim_time = 0;
+#if !WIN32
+static int epoll_fd = -1;
+static int wakeup_fd = -1; // signalled by cmimg_quit()
+static int timer_fd = -1; // reconnect backoff
+#endif
 
 /***************************************************************
 ** MARK: PUBLIC FUNCTIONS
@@ -162,9 +277,83 @@ static volatile unsigned long long sim_time = 0;
 
 int cmimg_init(void)
 {
-    printf("cmimg_init\n");
+    CMLOG(CMLOG_IMG, CMLOG_INFO, "cmimg_init");
+
+    atomic_store(&running, true);
+
+    bool anyEncoded = false;
+    for (int ch = 0; ch < CMIMG_MAX_CHANNELS; ++ch)
+    {
+        if (!cmimg_encode_available(RSDScfg.Encoding[ch]))
+        {
+            CMLOG(CMLOG_IMG, CMLOG_WARN, "built without %s support, channel %d is published raw",
+                  cmimg_encode_name(RSDScfg.Encoding[ch]), ch);
+            RSDScfg.Encoding[ch] = CMIMG_ENC_NONE;
+        }
+        anyEncoded |= (RSDScfg.Encoding[ch] != CMIMG_ENC_NONE);
+    }
+
+    // one slot being filled and one being sent on top of the frames queued here and
+    // in the XIF camera stream, plus one per encoder worker
+    cmxif_stats_t xif;
+    cmxif_stats(CMXIF_CAMERA, &xif);
+    int minPoolDepth = RSDScfg.QueueDepth + (int)xif.depth + 2 + (anyEncoded ? RSDScfg.EncodeThreads : 0);
+    if (minPoolDepth > CMIMG_POOL_MAX_DEPTH)
+        minPoolDepth = CMIMG_POOL_MAX_DEPTH;
+    if (RSDScfg.PoolDepth < minPoolDepth)
+    {
+        RSDScfg.PoolDepth = minPoolDepth;
+        CMLOG(CMLOG_IMG, CMLOG_INFO, "PoolDepth raised to %d for QueueDepth %d", RSDScfg.PoolDepth, RSDScfg.QueueDepth);
+    }
+
+    if (cmimg_convert_init(RSDScfg.SIMD) != 0)
+    {
+        return -1;
+    }
+    CMLOG(CMLOG_IMG, CMLOG_INFO, "pixel conversion uses %s kernels", cmimg_convert_isa());
 
-    running = true;
+    if (cmimg_rsds_init(&RSDSrx.stream, CMIMG_RSDS_WINDOW_SIZE) != 0)
+    {
+        return -1;
+    }
+
+    if (RSDScfg.EmbeddedDataPath != NULL)
+    {
+        if (RSDScfg.EmbeddedDataBinary)
+        {
+            if (cmimg_embedded_open(RSDScfg.EmbeddedDataPath) != 0)
+                return -1;
+        }
+        else if ((RSDScfg.EmbeddedDataCollectionFile = fopen(RSDScfg.EmbeddedDataPath, "w")) == NULL)
+        {
+            fprintf(stderr, "cmimg: can't open %s\n", RSDScfg.EmbeddedDataPath);
+            return -1;
+        }
+    }
+
+    // slots are only allocated once a channel delivers its first frame
+    for (int ch = 0; ch < CMIMG_MAX_CHANNELS; ++ch)
+    {
+        if (cmimg_pool_init(&channels[ch].pool, RSDScfg.PoolDepth) != 0
+         || cmimg_queue_init(&channels[ch].queue, RSDScfg.QueueDepth, RSDScfg.DropPolicy) != 0)
+        {
+            return -1;
+        }
+
+        cmimg_resize_init(&channels[ch].resize, &RSDScfg.Resize[ch]);
+        channels[ch].lastEncoded = 0;
+        atomic_init(&channels[ch].nEncodeDropped, 0ul);
+        atomic_init(&channels[ch].nBytesEncoded, 0ull);
+    }
+
+    if (anyEncoded)
+    {
+        if (cmimg_encode_init(RSDScfg.EncodeThreads, RSDScfg.JpegQuality, RSDScfg.Convert.bgr, cmimg_encoded) != 0)
+        {
+            return -1;
+        }
+        encoderRunning = true;
+    }
 
     #if WIN32
         WSADATA WSAdata;
@@ -179,6 +368,22 @@ int cmimg_init(void)
             return -1;
         }
     #else
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+        if (epoll_fd < 0 || wakeup_fd < 0 || timer_fd < 0)
+        {
+            fprintf(stderr, "Error creating event loop: %s\n", strerror(errno));
+            return -1;
+        }
+
+        struct epoll_event ev = { .events = EPOLLIN };
+        ev.data.fd = wakeup_fd;
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wakeup_fd, &ev);
+        ev.data.fd = timer_fd;
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, timer_fd, &ev);
+
         if (pthread_create(&cmimg_thread, NULL, (void *)cmimg_thread_main, NULL) != 0)
         {
             fprintf(stderr, "Error creating thread\n");
@@ -186,36 +391,45 @@ int cmimg_init(void)
         }
     #endif
 
+    // sockets are usable from here on, also on Windows
+    if (RSDScfg.MetricsSink != NULL && cmimg_metrics_open(RSDScfg.MetricsSink, RSDScfg.MetricsPeriod) != 0)
+    {
+        CMLOG(CMLOG_IMG, CMLOG_WARN, "metrics export to %s disabled", RSDScfg.MetricsSink);
+    }
+
     return 0;   
 }
 
 void cmimg_update(void)
 {
-    // This function is intentionally left empty.
-    // The thread will handle the updates in its main loop.
-    // If you need to perform any periodic updates, you can implement them here.
-    // For now, we just keep the thread running.
-
-    if (new_image)
-    {
-        xif_image_t image;
-        image.timestamp = sim_time;
-        image.width = ImgWidth;
-        image.height = ImgHeight;
-        image.channels = 3; // Assuming RGB image
-        image.data = image_data;
-        
-        xifs_transmit_image(image);
-        
-        free(image_data);
+    // Publish whatever the receive thread has queued since the last cycle.
+    // Never blocks: an empty queue returns straight away. Channels are
+    // drained one frame at a time in turn so a busy channel can't delay the others.
+    bool pending = true;
+
+    for (int n = 0; n < RSDScfg.QueueDepth && pending; ++n)
+    {
+        pending = false;
 
-        new_image = false;
+        for (int ch = 0; ch < CMIMG_MAX_CHANNELS; ++ch)
+        {
+            cmimg_frame_t *frame = cmimg_queue_pop(&channels[ch].queue);
+
+            if (frame != NULL)
+            {
+                // the slot goes back to the receive thread once XIF is done with it
+                cmimg_publish(frame);
+                pending = true;
+            }
+        }
     }
+
+    cmimg_metrics_poll();
 }
 
 void cmimg_quit(void)
 {
-    running = false;
+    atomic_store(&running, false);
 
     #if WIN32
         if (cmimg_thread != NULL)
@@ -226,18 +440,306 @@ void cmimg_quit(void)
             cmimg_thread = NULL;
         }
     #else
-        if (pthread_cancel(cmimg_thread) != 0)
+        // wake the receive thread out of epoll_wait() instead of cancelling it
+        uint64_t one = 1;
+        if (write(wakeup_fd, &one, sizeof(one)) != sizeof(one))
         {
-            fprintf(stderr, "Error cancelling thread\n");
+            fprintf(stderr, "Error waking thread\n");
         }
         
         if (pthread_join(cmimg_thread, NULL) != 0)
         {
             fprintf(stderr, "Error joining thread\n");
         }
+
+        close(timer_fd);
+        close(wakeup_fd);
+        close(epoll_fd);
+        timer_fd = wakeup_fd = epoll_fd = -1;
     #endif
 
-    printf("cmimg_quit\n");
+    // the receive thread is gone, no new jobs; the workers hand back what they still hold
+    if (encoderRunning)
+    {
+        cmimg_encode_quit();
+        encoderRunning = false;
+    }
+
+    // return anything left in the queues
+    for (int ch = 0; ch < CMIMG_MAX_CHANNELS; ++ch)
+    {
+        cmimg_frame_t *frame;
+        while ((frame = cmimg_queue_pop(&channels[ch].queue)) != NULL)
+        {
+            cmimg_pool_release(&channels[ch].pool, frame);
+        }
+
+        cmimg_pool_free(&channels[ch].pool);
+        cmimg_resize_free(&channels[ch].resize);
+        free(channels[ch].stage.data);
+        memset(&channels[ch].stage, 0, sizeof(channels[ch].stage));
+    }
+
+    cmimg_metrics_close();
+    cmimg_embedded_close();
+
+    cmimg_rsds_free(&RSDSrx.stream);
+    free(RSDSrx.embedded);
+    RSDSrx.embedded = NULL;
+    RSDSrx.embeddedSize = 0;
+
+    CMLOG(CMLOG_IMG, CMLOG_INFO, "cmimg_quit");
+}
+
+int cmimg_set_option(const char *option)
+{
+    const char *value = strchr(option, '=');
+
+    if (value == NULL)
+    {
+        fprintf(stderr, "cmimg: option '%s' is not of the form Key=Value\n", option);
+        return -1;
+    }
+
+    size_t keyLen = (size_t)(value - option);
+    value++;
+
+    if (option_is(option, keyLen, "PoolDepth"))
+    {
+        int depth = atoi(value);
+        if (depth < 1 || depth > CMIMG_POOL_MAX_DEPTH)
+        {
+            fprintf(stderr, "cmimg: PoolDepth must be within 1..%d\n", CMIMG_POOL_MAX_DEPTH);
+            return -1;
+        }
+        RSDScfg.PoolDepth = depth;
+    }
+    else if (option_is(option, keyLen, "QueueDepth"))
+    {
+        int depth = atoi(value);
+        if (depth < 1 || depth > CMIMG_QUEUE_MAX_DEPTH || depth + 2 > CMIMG_POOL_MAX_DEPTH)
+        {
+            fprintf(stderr, "cmimg: QueueDepth must be within 1..%d\n", CMIMG_QUEUE_MAX_DEPTH);
+            return -1;
+        }
+        RSDScfg.QueueDepth = depth;
+    }
+    else if (option_is(option, keyLen, "DropPolicy"))
+    {
+        if (strcasecmp(value, "oldest") == 0)
+            RSDScfg.DropPolicy = CM_DROP_OLDEST;
+        else if (strcasecmp(value, "newest") == 0)
+            RSDScfg.DropPolicy = CM_DROP_NEWEST;
+        else
+        {
+            fprintf(stderr, "cmimg: DropPolicy must be 'oldest' or 'newest'\n");
+            return -1;
+        }
+    }
+    else if (option_is(option, keyLen, "Channels"))
+    {
+        // comma separated list of channels to publish, e.g. Channels=0,1,2
+        unsigned int mask = 0;
+        const char *p = value;
+        while (*p != '\0')
+        {
+            char *end;
+            long ch = strtol(p, &end, 10);
+            if (end == p || ch < 0 || ch >= CMIMG_MAX_CHANNELS)
+            {
+                fprintf(stderr, "cmimg: Channels must list channel numbers within 0..%d\n", CMIMG_MAX_CHANNELS - 1);
+                return -1;
+            }
+            mask |= 1u << ch;
+            p = (*end == ',') ? end + 1 : end;
+        }
+        RSDScfg.PublishMask = mask;
+    }
+    else if (option_is(option, keyLen, "Crop"))
+    {
+        // [<ch>:]x,y,w,h in source pixels, e.g. Crop=0:0,360,1920,720
+        unsigned int mask = option_channels(&value);
+        int x, y, w, h;
+        if (mask == 0 || sscanf(value, "%d,%d,%d,%d", &x, &y, &w, &h) != 4 || x < 0 || y < 0 || w < 0 || h < 0)
+        {
+            fprintf(stderr, "cmimg: Crop must be [<ch>:]x,y,w,h\n");
+            return -1;
+        }
+        for (int ch = 0; ch < CMIMG_MAX_CHANNELS; ++ch)
+        {
+            if (mask & (1u << ch))
+            {
+                RSDScfg.Resize[ch].crop_x = x;
+                RSDScfg.Resize[ch].crop_y = y;
+                RSDScfg.Resize[ch].crop_w = w;
+                RSDScfg.Resize[ch].crop_h = h;
+            }
+        }
+    }
+    else if (option_is(option, keyLen, "Resize"))
+    {
+        // [<ch>:]WxH, [<ch>:]Wx0 or [<ch>:]0xH, one zero keeps the aspect ratio of the ROI
+        unsigned int mask = option_channels(&value);
+        int w, h;
+        if (mask == 0 || sscanf(value, "%dx%d", &w, &h) != 2 || w < 0 || h < 0)
+        {
+            fprintf(stderr, "cmimg: Resize must be [<ch>:]WxH\n");
+            return -1;
+        }
+        for (int ch = 0; ch < CMIMG_MAX_CHANNELS; ++ch)
+        {
+            if (mask & (1u << ch))
+            {
+                RSDScfg.Resize[ch].out_w = w;
+                RSDScfg.Resize[ch].out_h = h;
+            }
+        }
+    }
+    else if (option_is(option, keyLen, "Scale"))
+    {
+        // [<ch>:]N, divide the ROI by N in both directions
+        unsigned int mask = option_channels(&value);
+        int scale = atoi(value);
+        if (mask == 0 || scale < 1)
+        {
+            fprintf(stderr, "cmimg: Scale must be [<ch>:]N with N >= 1\n");
+            return -1;
+        }
+        for (int ch = 0; ch < CMIMG_MAX_CHANNELS; ++ch)
+        {
+            if (mask & (1u << ch))
+                RSDScfg.Resize[ch].scale = scale;
+        }
+    }
+    else if (option_is(option, keyLen, "Filter"))
+    {
+        unsigned int mask = option_channels(&value);
+        cmimg_filter_t filter = CMIMG_FILTER_BOX;
+        if (strcasecmp(value, "box") == 0)
+            filter = CMIMG_FILTER_BOX;
+        else if (strcasecmp(value, "bilinear") == 0)
+            filter = CMIMG_FILTER_BILINEAR;
+        else
+            mask = 0;
+        if (mask == 0)
+        {
+            fprintf(stderr, "cmimg: Filter must be [<ch>:]box or [<ch>:]bilinear\n");
+            return -1;
+        }
+        for (int ch = 0; ch < CMIMG_MAX_CHANNELS; ++ch)
+        {
+            if (mask & (1u << ch))
+                RSDScfg.Resize[ch].filter = filter;
+        }
+    }
+    else if (option_is(option, keyLen, "Encode"))
+    {
+        // [<ch>:]none|lz4|jpeg
+        unsigned int mask = option_channels(&value);
+        cmimg_encoding_t encoding = CMIMG_ENC_NONE;
+        if (strcasecmp(value, "lz4") == 0)
+            encoding = CMIMG_ENC_LZ4;
+        else if (strcasecmp(value, "jpeg") == 0)
+            encoding = CMIMG_ENC_JPEG;
+        else if (strcasecmp(value, "none") != 0)
+            mask = 0;
+        if (mask == 0)
+        {
+            fprintf(stderr, "cmimg: Encode must be [<ch>:]none, [<ch>:]lz4 or [<ch>:]jpeg\n");
+            return -1;
+        }
+        for (int ch = 0; ch < CMIMG_MAX_CHANNELS; ++ch)
+        {
+            if (mask & (1u << ch))
+                RSDScfg.Encoding[ch] = encoding;
+        }
+    }
+    else if (option_is(option, keyLen, "EncodeThreads"))
+    {
+        int threads = atoi(value);
+        if (threads < 1 || threads > CMIMG_ENCODE_MAX_THREADS)
+        {
+            fprintf(stderr, "cmimg: EncodeThreads must be within 1..%d\n", CMIMG_ENCODE_MAX_THREADS);
+            return -1;
+        }
+        RSDScfg.EncodeThreads = threads;
+    }
+    else if (option_is(option, keyLen, "JpegQuality"))
+    {
+        int quality = atoi(value);
+        if (quality < 1 || quality > 100)
+        {
+            fprintf(stderr, "cmimg: JpegQuality must be within 1..100\n");
+            return -1;
+        }
+        RSDScfg.JpegQuality = quality;
+    }
+    else if (option_is(option, keyLen, "Metrics"))
+    {
+        free(RSDScfg.MetricsSink);
+        RSDScfg.MetricsSink = strdup(value);
+    }
+    else if (option_is(option, keyLen, "MetricsPeriod"))
+    {
+        int period = atoi(value);
+        if (period < 10)
+        {
+            fprintf(stderr, "cmimg: MetricsPeriod must be at least 10 ms\n");
+            return -1;
+        }
+        RSDScfg.MetricsPeriod = period;
+    }
+    else if (option_is(option, keyLen, "EmbeddedData"))
+    {
+        free(RSDScfg.EmbeddedDataPath);
+        RSDScfg.EmbeddedDataPath = strdup(value);
+    }
+    else if (option_is(option, keyLen, "EmbeddedFormat"))
+    {
+        // bin is converted offline with cmimg-embedded2csv
+        if (strcasecmp(value, "bin") == 0)
+            RSDScfg.EmbeddedDataBinary = true;
+        else if (strcasecmp(value, "csv") == 0)
+            RSDScfg.EmbeddedDataBinary = false;
+        else
+        {
+            fprintf(stderr, "cmimg: EmbeddedFormat must be 'bin' or 'csv'\n");
+            return -1;
+        }
+    }
+    else if (option_is(option, keyLen, "ColorOrder"))
+    {
+        if (strcasecmp(value, "bgr") == 0)
+            RSDScfg.Convert.bgr = true;
+        else if (strcasecmp(value, "rgb") == 0)
+            RSDScfg.Convert.bgr = false;
+        else
+        {
+            fprintf(stderr, "cmimg: ColorOrder must be 'bgr' or 'rgb'\n");
+            return -1;
+        }
+    }
+    else if (option_is(option, keyLen, "GreyToRGB"))
+    {
+        RSDScfg.Convert.grey_to_rgb = (atoi(value) != 0);
+    }
+    else if (option_is(option, keyLen, "SIMD"))
+    {
+        if (strcmp(value, "auto") != 0 && strcmp(value, "avx2") != 0
+         && strcmp(value, "sse4.1") != 0 && strcmp(value, "scalar") != 0)
+        {
+            fprintf(stderr, "cmimg: SIMD must be 'auto', 'avx2', 'sse4.1' or 'scalar'\n");
+            return -1;
+        }
+        snprintf(RSDScfg.SIMD, sizeof(RSDScfg.SIMD), "%s", value);
+    }
+    else
+    {
+        fprintf(stderr, "cmimg: unknown option '%.*s'\n", (int)keyLen, option);
+        return -1;
+    }
+
+    return 0;
 }
 
 
@@ -246,40 +748,210 @@ void cmimg_quit(void)
 ** MARK: STATIC FUNCTIONS
 ***************************************************************/
 
+static void cmimg_publish(cmimg_frame_t *frame)
+{
+    if (!(RSDScfg.PublishMask & (1u << frame->channel)))
+    {
+        cmimg_pool_release(&channels[frame->channel].pool, frame);
+        return;
+    }
+
+    // XIF images carry no channel, element size or encoding: every frame goes out as a tagged blob, see cmxif.h
+    xif_image_t image;
+    image.timestamp = frame->timestamp;
+    image.height = 1;
+    image.channels = 1;
+
+    if (frame->encoding != CMIMG_ENC_NONE)
+    {
+        image.width = (int)frame->encoded_size;
+        image.data = frame->encoded;
+    }
+    else
+    {
+        // the header goes into the slot's headroom, the pixels stay where they are
+        uint8_t *blob = frame->data - CMIMG_ENCODE_HEADER_SIZE;
+        cmimg_encode_header(frame, RSDScfg.Convert.bgr, frame->size, blob);
+
+        image.width = (int)(CMIMG_ENCODE_HEADER_SIZE + frame->size);
+        image.data = blob;
+    }
+
+    cmxif_image(CMXIF_CAMERA, image, cmimg_sent, frame);
+}
+
+/* transmit thread, or the main loop when the camera stream dropped the frame */
+static void cmimg_sent(void *ctx, bool sent)
+{
+    cmimg_frame_t *frame = ctx;
+
+    if (sent)
+    {
+        size_t bytes = (frame->encoding != CMIMG_ENC_NONE) ? frame->encoded_size : frame->size;
+        cmimg_metrics_published(frame->channel, bytes, frame->received);
+    }
+    else
+    {
+        cmimg_metrics_dropped(frame->channel);
+    }
+
+    cmimg_pool_release(&channels[frame->channel].pool, frame);
+}
+
+/* encoder worker: queue a compressed frame for publishing */
+static void cmimg_encoded(cmimg_frame_t *frame)
+{
+    tChannel *chan = &channels[frame->channel];
+
+    // workers finish out of order; never publish a frame older than one already queued
+    if (frame->timestamp < chan->lastEncoded)
+    {
+        atomic_fetch_add(&chan->nEncodeDropped, 1);
+        cmimg_metrics_dropped(frame->channel);
+        cmimg_pool_release(&chan->pool, frame);
+        return;
+    }
+
+    chan->lastEncoded = frame->timestamp;
+    atomic_fetch_add(&chan->nBytesEncoded, frame->encoding != CMIMG_ENC_NONE ? frame->encoded_size : frame->size);
+
+    // the workers are serialised here, so the queue still has a single producer
+    cmimg_frame_t *dropped = cmimg_queue_push(&chan->queue, frame);
+    if (dropped)
+    {
+        atomic_fetch_add(&chan->nEncodeDropped, 1);
+        cmimg_metrics_dropped(frame->channel);
+        cmimg_pool_release(&chan->pool, dropped);
+    }
+}
+
+static bool option_is(const char *option, size_t keyLen, const char *key)
+{
+    return keyLen == strlen(key) && strncmp(option, key, keyLen) == 0;
+}
+
+/* strip an optional "<ch>:" prefix off a per-channel option value, no prefix -> all channels */
+static unsigned int option_channels(const char **value)
+{
+    const char *colon = strchr(*value, ':');
+
+    if (colon == NULL)
+    {
+        return (1u << CMIMG_MAX_CHANNELS) - 1u;
+    }
+
+    char *end;
+    long ch = strtol(*value, &end, 10);
+    if (end != colon || ch < 0 || ch >= CMIMG_MAX_CHANNELS)
+    {
+        return 0;
+    }
+
+    *value = colon + 1;
+    return 1u << ch;
+}
+
 static void cmimg_thread_main(void)
 {
+    RSDS_Init();
+
+#if WIN32
     int connectState = -1;
 
-    RSDS_Init();
+    while (atomic_load(&running))
+    {
+        if (connectState != 0)
+        {
+            if ((connectState = RSDS_Connect()) != 0)
+            {
+                Sleep(RSDS_RECONNECT_MIN_MS);
+            }
+        }
+        else if (RSDS_WaitReadable(RSDS_RECONNECT_MIN_MS) == 0 && RSDS_Pump() < 0)
+        {
+            connectState = -1; // connection lost
+        }
+    }
+#else
+    int backoff_ms = RSDS_RECONNECT_MIN_MS;
+
+    // first connection attempt right away
+    RSDS_ArmReconnect(0);
 
-    while (running)
+    while (atomic_load(&running))
     {
+        struct epoll_event events[3];
+        int n = epoll_wait(epoll_fd, events, 3, -1);
 
-        //printf("cmimg_thread_main\n");
-        
-        if (connectState != 0)
+        if (n < 0)
         {
-            connectState = RSDS_Connect();
+            if (errno == EINTR)
+                continue;
+            CMLOG(CMLOG_RSDS, CMLOG_ERROR, "epoll_wait failed: %s", strerror(errno));
+            break;
         }
-        else
+
+        // a wakeup_fd event needs no handling, running is already false
+        for (int i = 0; i < n && atomic_load(&running); ++i)
         {
-            RSDS_RecvHdr(RSDScfg.sock, RSDScfg.sbuf);
+            int fd = events[i].data.fd;
+
+            if (fd == timer_fd)
+            {
+                uint64_t expirations;
+                if (read(timer_fd, &expirations, sizeof(expirations)) < 0)
+                    continue;
 
-            if (!RSDScfg.TerminationRequested)
+                if (RSDS_Connect() == 0)
+                {
+                    backoff_ms = RSDS_RECONNECT_MIN_MS;
+                }
+                else
+                {
+                    RSDS_ArmReconnect(backoff_ms);
+                    backoff_ms = (2 * backoff_ms < RSDS_RECONNECT_MAX_MS) ? 2 * backoff_ms : RSDS_RECONNECT_MAX_MS;
+                }
+            }
+            else if (fd == RSDScfg.sock && RSDScfg.sock >= 0)
             {
-                RSDS_GetData();
+                // keep reading while the socket fills our buffers completely
+                int rc = 0;
+                while (atomic_load(&running) && (rc = RSDS_Pump()) > 0)
+                    ;
+
                 fflush(stdout);
+
+                if (rc < 0 && atomic_load(&running))
+                {
+                    CMLOG(CMLOG_RSDS, CMLOG_WARN, "connection lost, reconnecting");
+                    RSDS_Disconnect();
+                    RSDS_ArmReconnect(backoff_ms);
+                }
             }
         }
-
-        sleep(0);
     }
+#endif
     
     RSDScfg.TerminationRequested = 1;
 
     RSDS_PrintClosingInfo();
-    close(RSDScfg.sock);
+    RSDS_Disconnect();
+}
+
+#if !WIN32
+static void RSDS_ArmReconnect(int delay_ms)
+{
+    struct itimerspec its = { 0 };
+    its.it_value.tv_sec = delay_ms / 1000;
+    its.it_value.tv_nsec = (delay_ms % 1000) * 1000000L;
+
+    // a zero it_value would disarm the timer
+    if (delay_ms <= 0)
+        its.it_value.tv_nsec = 1;
+
+    timerfd_settime(timer_fd, 0, &its, NULL);
 }
+#endif
 
 int connect_with_timeout(int sockfd, struct sockaddr *addr, socklen_t addrlen, int timeout_ms) {
     // Set non-blocking
@@ -350,13 +1022,6 @@ int connect_with_timeout(int sockfd, struct sockaddr *addr, socklen_t addrlen, i
 
 static void RSDS_Init(void)
 {
-    RSDScfg.MovieHost = "localhost";
-    RSDScfg.MoviePort = 2210;
-    RSDScfg.Verbose = 0;
-    RSDScfg.SaveFormat = SaveFormat_DataNotSaved;
-    RSDScfg.EmbeddedDataCollectionFile = NULL;
-    RSDScfg.RecvFlags = 0;
-    RSDScfg.ConnectionTries = 5;
     RSDScfg.TerminationRequested = 0;
 
     RSDSIF.tFirstDataTime = 0.0;
@@ -365,9 +1030,11 @@ static void RSDS_Init(void)
     RSDSIF.tLastSimTime = -1.0;
     RSDSIF.nImagesSim = 0;
     RSDSIF.nImagesTotal = 0;
+    RSDSIF.nImagesDropped = 0;
     RSDSIF.nBytesTotal = 0;
     RSDSIF.nBytesSim = 0;
     RSDSIF.nChannels = 0;
+    memset(RSDSIF.Channel, 0, sizeof(RSDSIF.Channel));
 }
 
 static void RSDS_PrintSimInfo()
@@ -384,6 +1051,7 @@ static void RSDS_PrintSimInfo()
     }
     if (RSDScfg.EmbeddedDataCollectionFile != NULL)
         fflush(RSDScfg.EmbeddedDataCollectionFile);
+    cmimg_embedded_flush();
 
 }
 
@@ -400,20 +1068,47 @@ static void RSDS_PrintClosingInfo()
         double MiBytes = RSDSIF.nBytesTotal / (1024.0 * 1024.0);
         printf("Duration: %g seconds\n", dtSession);
         printf("Images:   %ld (%.3f FPS)\n", RSDSIF.nImagesTotal, RSDSIF.nImagesTotal / dtSession);
+        printf("Dropped:  %ld\n", RSDSIF.nImagesDropped);
+        printf("Reads:    %llu (%.2f per image)\n", RSDSrx.stream.nReads,
+               RSDSIF.nImagesTotal ? (double)RSDSrx.stream.nReads / RSDSIF.nImagesTotal : 0.0);
+        for (int ch = 0; ch < RSDSIF.nChannels && ch < CMIMG_MAX_CHANNELS; ++ch) {
+            printf("  Ch %-2d %-8s %dx%d: %ld images (%.3f FPS), %ld dropped, %.3f MiB\n", ch,
+                   RSDSIF.Channel[ch].ImgType, RSDSIF.Channel[ch].Width, RSDSIF.Channel[ch].Height,
+                   RSDSIF.Channel[ch].nImages, RSDSIF.Channel[ch].nImages / dtSession,
+                   RSDSIF.Channel[ch].nDropped + atomic_load(&channels[ch].nEncodeDropped),
+                   RSDSIF.Channel[ch].nBytes / (1024.0 * 1024.0));
+            if (RSDScfg.Encoding[ch] != CMIMG_ENC_NONE)
+                printf("        %s: %.3f MiB published\n", cmimg_encode_name(RSDScfg.Encoding[ch]),
+                       atomic_load(&channels[ch].nBytesEncoded) / (1024.0 * 1024.0));
+        }
         printf("Bytes:    %.3f MiB (%.3f MiB per second)\n", MiBytes, MiBytes / dtSession);
     }
     fflush(stdout);
 
+    if (cmimg_embedded_dropped() > 0)
+        printf("Embedded data: %lu records lost, the disk couldn't keep up\n", cmimg_embedded_dropped());
+
     if (RSDScfg.EmbeddedDataCollectionFile != NULL)
         fclose(RSDScfg.EmbeddedDataCollectionFile);
+    RSDScfg.EmbeddedDataCollectionFile = NULL;
 }
 
-static void RSDSIF_AddDataToStats(unsigned int len)
+static void RSDSIF_AddDataToStats(int Channel, unsigned int len)
 {
     RSDSIF.nImagesTotal++;
     RSDSIF.nBytesTotal += len;
     RSDSIF.nImagesSim++;
     RSDSIF.nBytesSim += len;
+
+    RSDSIF.Channel[Channel].nImages++;
+    RSDSIF.Channel[Channel].nBytes += len;
+}
+
+static void RSDSIF_AddDropToStats(int Channel)
+{
+    RSDSIF.nImagesDropped++;
+    RSDSIF.Channel[Channel].nDropped++;
+    cmimg_metrics_dropped(Channel);
 }
 
 static void RSDSIF_UpdateStats(unsigned int ImgLen, const char *ImgType, int Channel, int ImgWidth, int ImgHeight, float SimTime)
@@ -425,7 +1120,7 @@ static void RSDSIF_UpdateStats(unsigned int ImgLen, const char *ImgType, int Cha
         if (Channel == 0) {
             if (RSDSIF.tLastSimTime > 0)
                 RSDS_PrintSimInfo();
-            printf("-> Simulation started... (@ %.3f)\n", SimTime);
+            CMLOG(CMLOG_RSDS, CMLOG_INFO, "-> Simulation started... (@ %.3f)", SimTime);
             RSDSIF.tStartSim = GetTime();
             RSDSIF.nBytesSim = 0;
             RSDSIF.nImagesSim = 0;
@@ -433,7 +1128,7 @@ static void RSDSIF_UpdateStats(unsigned int ImgLen, const char *ImgType, int Cha
         }
         // this text will appear only for the first img of each channel
         if (RSDScfg.Verbose == 2)
-            printf("%-6.3f : %-2d : %-8s %dx%d %d\n", SimTime, Channel, ImgType, ImgWidth, ImgHeight, ImgLen);
+            CMLOG(CMLOG_RSDS, CMLOG_INFO, "%-6.3f : %-2d : %-8s %dx%d %d", SimTime, Channel, ImgType, ImgWidth, ImgHeight, ImgLen);
     }
     if (Channel == 0)
         RSDSIF.tLastSimTime = SimTime;
@@ -473,48 +1168,100 @@ static void PrintEmbeddedData (const char* data, unsigned int dataLen)
 }
 
 
+#if WIN32
 /*
- ** RSDS_RecvHdr
+ ** RSDS_WaitReadable
  **
- ** Scan TCP/IP Socket and writes to buffer
+ ** Sleep until the socket has data. Returns 0 when readable,
+ ** -1 on timeout.
  */
-static int RSDS_RecvHdr(int sock, char *hdr)
+static int RSDS_WaitReadable(int timeout_ms)
 {
-    const int HdrSize = 64;
-    int len = 0;
-    int nSkipped = 0;
-    int i;
+    fd_set wait_set;
+    FD_ZERO(&wait_set);
+    FD_SET(RSDScfg.sock, &wait_set);
 
-    //while (1) {
-        if (RSDScfg.TerminationRequested)
-            return -1;
-        for (; len < HdrSize; len += i) {
-            if ((i = recv(sock, hdr + len, HdrSize - len, RSDScfg.RecvFlags)) <= 0) {
-                if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                    return 1; // indicate would-block; try again later
-                }
-                if (!RSDScfg.TerminationRequested) {
-                    printf("RSDS_RecvHdr Error during recv: %s\n", strerror(errno));
-                    RSDScfg.TerminationRequested = 1;
-                }
-                return -1;
-            }
-        }
-        if (hdr[0] == '*' && hdr[1] >= 'A' && hdr[1] <= 'Z') {
-            /* remove white spaces at end of line */
-            while (len > 0 && hdr[len - 1] <= ' ')
-                len--;
-            hdr[len] = 0;
-            if (RSDScfg.Verbose == 1 && nSkipped > 0)
-                printf("RSDS: HDR resync, %d bytes skipped\n", nSkipped);
+    struct timeval tv;
+    tv.tv_sec = timeout_ms / 1000;
+    tv.tv_usec = (timeout_ms % 1000) * 1000;
+
+    return (select(RSDScfg.sock + 1, &wait_set, NULL, NULL, &tv) > 0) ? 0 : -1;
+}
+#endif
+
+/*
+ ** RSDS_Pump
+ **
+ ** One read from the socket, then parse everything it delivered.
+ ** Returns 1 if more data may be pending, 0 if the socket is
+ ** drained and -1 if the connection is gone.
+ */
+static int RSDS_Pump(void)
+{
+    char *direct = NULL;
+    size_t directLen = 0, directGot = 0;
+
+    // once the window is empty, payload bytes go straight into their slot
+    if (RSDSrx.state == RxState_Payload && RSDSrx.dest != NULL && cmimg_rsds_avail(&RSDSrx.stream) == 0) {
+        direct = RSDSrx.dest + RSDSrx.got;
+        directLen = RSDSrx.hdr.length - RSDSrx.got;
+    }
+
+    size_t requested = directLen + RSDSrx.stream.size - cmimg_rsds_avail(&RSDSrx.stream);
+    int res = cmimg_rsds_fill(&RSDSrx.stream, RSDScfg.sock, direct, directLen, &directGot);
+
+    if (res < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
             return 0;
+        CMLOG(CMLOG_RSDS, CMLOG_ERROR, "socket reading failure: %s", strerror(errno));
+        return -1;
+    }
+    if (res == 0) {
+        CMLOG(CMLOG_RSDS, CMLOG_ERROR, "socket reading failure: connection closed");
+        return -1;
+    }
+
+    RSDSrx.got += directGot;
+    RSDS_Parse();
+
+    // a short read means the kernel buffer is empty, no need to ask again
+    return ((size_t)res < requested) ? 0 : 1;
+}
+
+/*
+ ** RSDS_Parse
+ **
+ ** Walk the receive window: finish the current payload, then
+ ** start on the next header, until the window runs dry
+ */
+static void RSDS_Parse(void)
+{
+    char hdr[CMIMG_RSDS_HDR_SIZE + 1];
+
+    for (;;) {
+        if (RSDSrx.state == RxState_Payload) {
+            unsigned int remaining = RSDSrx.hdr.length - RSDSrx.got;
+            RSDSrx.got += cmimg_rsds_take(&RSDSrx.stream, RSDSrx.dest ? RSDSrx.dest + RSDSrx.got : NULL, remaining);
+            if (RSDSrx.got < RSDSrx.hdr.length)
+                return;
+            RSDS_EndPayload();
+            RSDSrx.state = RxState_Header;
+        }
+
+        if (!cmimg_rsds_next_header(&RSDSrx.stream, hdr))
+            return;
+
+        if (RSDScfg.Verbose == 1 && RSDSrx.stream.skipped > 0)
+            CMLOG(CMLOG_RSDS, CMLOG_INFO, "HDR resync, %zu bytes skipped", RSDSrx.stream.skipped);
+        RSDSrx.stream.skipped = 0;
+
+        if (RSDSrx.state == RxState_Greeting) {
+            CMLOG(CMLOG_RSDS, CMLOG_INFO, "connected: %s", hdr + 1);
+            RSDSrx.state = RxState_Header;
+        } else {
+            RSDS_BeginPayload(hdr);
         }
-        for (i = 1; i < len && hdr[i] != '*'; i++)
-            ;
-        len -= i;
-        nSkipped += i;
-        memmove(hdr, hdr + i, len);
-    //}
+    }
 }
 
 /*
@@ -532,14 +1279,10 @@ static int RSDS_Connect(void)
     }
 #endif
 
-    if (RSDScfg.sock > 0)
-    {
-        close(RSDScfg.sock);
-    }
+    RSDS_Disconnect();
     
     struct sockaddr_in DestAddr;
     struct hostent *he;
-    int tries = RSDScfg.ConnectionTries;
 
     if ((he = gethostbyname(RSDScfg.MovieHost)) == NULL) {
         fprintf(stderr, "RSDS: unknown host: %s\n", RSDScfg.MovieHost);
@@ -551,123 +1294,239 @@ static int RSDS_Connect(void)
 
     RSDScfg.sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
 
+    // a deep kernel buffer lets a whole frame arrive between two reads
+    int rcvbuf = RSDS_SOCKET_RCVBUF;
+    setsockopt(RSDScfg.sock, SOL_SOCKET, SO_RCVBUF, (const char *)&rcvbuf, sizeof(rcvbuf));
+
     int result = connect_with_timeout(RSDScfg.sock, (struct sockaddr*)&DestAddr, sizeof(DestAddr), 100);
 
     if (result != 0) {
         //fprintf(stderr, "RSDS: can't connect '%s:%d'\n", RSDScfg.MovieHost, RSDScfg.MoviePort);
+        RSDS_Disconnect();
         return -4;
     }
-    
-    if (RSDS_RecvHdr(RSDScfg.sock, RSDScfg.sbuf) < 0)
-    {
-        return -3;
-    }
 
-    printf("RSDS: Connected: %s\n", RSDScfg.sbuf + 1);
+#if !WIN32
+    // all reads are non-blocking, the event loop waits for data instead
+    fcntl(RSDScfg.sock, F_SETFL, fcntl(RSDScfg.sock, F_GETFL, 0) | O_NONBLOCK);
 
-    memset(RSDScfg.sbuf, 0, 64);
+    struct epoll_event ev = { .events = EPOLLIN };
+    ev.data.fd = RSDScfg.sock;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, RSDScfg.sock, &ev);
+#endif
 
+    // the greeting header is picked up by RSDS_Parse()
     return 0;
 }
 
 /*
- ** RSDS_GetData
+ ** RSDS_Disconnect
  **
- ** data and image processing
+ ** Close the socket and forget about the current connection
  */
-static int RSDS_GetData(void)
+static void RSDS_Disconnect(void)
 {
-    unsigned int len = 0;
-    int res = 0;
+    if (RSDScfg.sock >= 0)
+    {
+#if !WIN32
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, RSDScfg.sock, NULL);
+#endif
+        close(RSDScfg.sock);
+        RSDScfg.sock = -1;
+    }
 
-    /* Variables for Image Processing */
-    char ImgType[32], AniMode[16];
-    int Channel;
-    float SimTime;
-    unsigned int ImgLen, dataLen;
+    // a half received frame is of no use after reconnecting
+    if (RSDSrx.frame != NULL) {
+        cmimg_pool_release(&channels[RSDSrx.frame->channel].pool, RSDSrx.frame);
+        RSDSrx.frame = NULL;
+    }
+    RSDSrx.staged = false;
+    RSDSrx.dest = NULL;
+    RSDSrx.state = RxState_Greeting;
+    if (RSDSrx.stream.buf != NULL)
+        cmimg_rsds_reset(&RSDSrx.stream);
 
-    if (sscanf(RSDScfg.sbuf, "*RSDS %d %s %f %dx%d %u", &Channel, ImgType, &SimTime, &ImgWidth, &ImgHeight, &ImgLen) == 6) {
+    RSDScfg.TerminationRequested = 0;
+}
+
+/*
+ ** RSDS_BeginPayload
+ **
+ ** Evaluate a header and decide where its payload goes
+ */
+static void RSDS_BeginPayload(char *hdr)
+{
+    cmimg_rsds_header_t *h = &RSDSrx.hdr;
 
-        RSDSIF_UpdateStats(ImgLen, ImgType,Channel, ImgWidth, ImgHeight, SimTime);
+    if (!cmimg_rsds_parse_header(hdr, h)) {
+        //printf("RSDS: not handled: %s\n", hdr);
+        return;
+    }
+
+    RSDSrx.state = RxState_Payload;
+    RSDSrx.frame = NULL;
+    RSDSrx.staged = false;
+    RSDSrx.dest = NULL;
+    RSDSrx.got = 0;
+
+    if (h->kind == CMIMG_RSDS_IMAGE) {
+
+        RSDSIF_UpdateStats(h->length, h->type, h->channel, h->width, h->height, h->sim_time);
 
         if (RSDScfg.Verbose == 1)
-            printf("%-6.3f : %-2d : %-8s %dx%d %d\n", SimTime, Channel, ImgType, ImgWidth, ImgHeight, ImgLen);
-
-        if (ImgLen > 0 && !new_image) {
-
-            // this is how we get the data
-            image_data = (char *) malloc(ImgLen);
-            for (len = 0; len < ImgLen; len += res) {
-                if ((res = recv(RSDScfg.sock, image_data + len, ImgLen - len, RSDScfg.RecvFlags)) < 0) {
-                    printf("RSDS: Socket Reading Failure\n");
-                    free(image_data);
-                    image_data = NULL;
-                    break;
-                }
-            }
+            CMLOG(CMLOG_RSDS, CMLOG_INFO, "%-6.3f : %-2d : %-8s %dx%d %d", h->sim_time, h->channel, h->type, h->width, h->height, h->length);
 
-	    // save the data to disc
-            //WriteImgDataToFile(img, ImgLen, ImgType, Channel, ImgWidth, ImgHeight, SimTime);
-
-            // Publish the image to ROS
-            //node->PublishImage(img, ImgLen, ImgType, Channel, ImgWidth, ImgHeight, SimTime);
-            printf("GOT IMAGE WITH SIZE %u %u LEN %d CHANNEL %d TYPE %d at time %lu\n", ImgWidth, ImgHeight, ImgLen, Channel, ImgType, SimTime);
-
-            
-            // Call the image callback if set
-            
-            /*
-            xif_image_t image;
-            image.timestamp = (uint64_t)(SimTime * 1000.0); // Convert seconds to milliseconds
-            image.width = ImgWidth;
-            image.height = ImgHeight;
-            image.channels = 3; // Assuming RGB image
-            image.data = img;
-                
-            xifs_transmit_image(image);
-            */
-
-            if (image_data)
-            {
-                /* write to file */
-                image_size = ImgLen;
-                sim_time = (unsigned long long)(SimTime * 1000.0); // Convert seconds to milliseconds
-                new_image = true;
+        // needed for all channels, since we want the time until the last image
+        RSDSIF_UpdateEndSimTime();
+
+        if (h->channel < 0 || h->channel >= CMIMG_MAX_CHANNELS || h->length == 0)
+            return;
+
+        tChannel *chan = &channels[h->channel];
+        size_t capacity = cmimg_convert_capacity(cmimg_convert_format(h->type), h->length, &RSDScfg.Convert);
+
+        if (cmimg_resize_enabled(&chan->resize.cfg)) {
+            // receive at full size, the slot is sized for the output once the frame is complete
+            if (chan->stage.capacity < capacity) {
+                uint8_t *buf = realloc(chan->stage.data, capacity);
+                if (buf == NULL)
+                    return;
+                chan->stage.data = buf;
+                chan->stage.capacity = capacity;
             }
-            
-            
+            RSDSrx.staged = true;
+            RSDSrx.dest = (char *)chan->stage.data;
+            return;
+        }
 
-            RSDSIF_AddDataToStats(len);
+        // (re)size the slots once per resolution, not per frame
+        cmimg_pool_reserve(&chan->pool, capacity);
+
+        if ((RSDSrx.frame = cmimg_pool_acquire(&chan->pool, capacity)) == NULL) {
+            // no free slot: consume the payload anyway so the stream stays in sync
+            RSDSIF_AddDropToStats(h->channel);
+            return;
         }
-        // needed for all channels, since we want the time until the last image
-        RSDSIF_UpdateEndSimTime();
-    } else if (sscanf(RSDScfg.sbuf, "*RSDSEmbeddedData %d %f %u %s", &Channel, &SimTime, &dataLen, AniMode) == 4) {
+
+        RSDSrx.frame->channel = h->channel;
+        RSDSrx.dest = (char *)RSDSrx.frame->data;
+
+    } else if (h->kind == CMIMG_RSDS_EMBEDDED) {
 
         if (RSDScfg.Verbose == 1)
-            printf("Embedded Data: %d %f %d %s\n", Channel, SimTime, dataLen, AniMode);
+            CMLOG(CMLOG_RSDS, CMLOG_INFO, "embedded data: %d %f %d %s", h->channel, h->sim_time, h->length, h->ani_mode);
+
+        if (h->length > RSDSrx.embeddedSize) {
+            char *buf = realloc(RSDSrx.embedded, h->length);
+            if (buf == NULL)
+                return;
+            RSDSrx.embedded = buf;
+            RSDSrx.embeddedSize = h->length;
+        }
 
-        if (dataLen > 0) {
-            char *data = (char *) malloc(dataLen);
+        RSDSrx.dest = RSDSrx.embedded;
+    }
+}
 
-            // get the data
-            for (len = 0; len < dataLen; len += res) {
-                if ((res = recv(RSDScfg.sock, data + len, dataLen - len, RSDScfg.RecvFlags)) < 0) {
-                    printf("RSDS: Socket Reading Failure\n");
-                    free(data);
-                    break;
-                }
-            }
+/*
+ ** RSDS_EndPayload
+ **
+ ** data and image processing, once a payload is complete
+ */
+static void RSDS_EndPayload(void)
+{
+    cmimg_rsds_header_t *h = &RSDSrx.hdr;
+
+    if (h->kind == CMIMG_RSDS_IMAGE && (RSDSrx.frame != NULL || RSDSrx.staged)) {
+
+        tChannel *chan = &channels[h->channel];
+        cmimg_frame_t *frame = RSDSrx.staged ? &chan->stage : RSDSrx.frame;
+
+	// save the data to disc
+        //WriteImgDataToFile(img, ImgLen, ImgType, Channel, ImgWidth, ImgHeight, SimTime);
+
+        // Publish the image to ROS
+        //node->PublishImage(img, ImgLen, ImgType, Channel, ImgWidth, ImgHeight, SimTime);
+        CMLOG(CMLOG_RSDS, CMLOG_DEBUG, "got image with size %d %d len %u channel %d type %s at time %.3f", h->width, h->height, h->length, h->channel, h->type, h->sim_time);
 
-	    // save the data to disc
-            WriteEmbeddedDataToCSVFile(data, dataLen, Channel, SimTime, AniMode);
-            if (RSDScfg.Verbose == 1)
-                PrintEmbeddedData(data, dataLen);
+        frame->size = h->length;
+        frame->channel = h->channel;
+        frame->width = h->width;
+        frame->height = h->height;
+        snprintf(frame->type, sizeof(frame->type), "%s", h->type);
+        frame->timestamp = (uint64_t)(h->sim_time * 1000.0); // Convert seconds to milliseconds
+        frame->received = cm_now_ns();
 
-            free(data);
+        cmimg_metrics_received(h->channel, h->length, h->sim_time);
+
+        // convert here so the main loop only has to hand the slot to XIF
+        if (cmimg_convert_frame(frame, &RSDScfg.Convert) != 0 && RSDScfg.Verbose == 1)
+            CMLOG(CMLOG_RSDS, CMLOG_INFO, "%s frame of %u bytes doesn't match %dx%d, published as is", h->type, h->length, h->width, h->height);
+
+        if (RSDSrx.staged)
+            frame = RSDS_ResizeFrame(chan, frame);
+
+        cmimg_frame_t *dropped = NULL;
+        if (frame != NULL && RSDScfg.Encoding[h->channel] != CMIMG_ENC_NONE) {
+            // the worker queues the frame once it is compressed
+            frame->encoding = RSDScfg.Encoding[h->channel];
+            if (cmimg_encode_submit(frame) != 0)
+                dropped = frame;
+        } else if (frame != NULL) {
+            dropped = cmimg_queue_push(&chan->queue, frame);
         }
-    } else {
-        //printf("RSDS: not handled: %s\n", RSDScfg.sbuf);
+        if (dropped)
+        {
+            RSDSIF_AddDropToStats(h->channel);
+            cmimg_pool_release(&chan->pool, dropped);
+        }
+
+        RSDSIF.Channel[h->channel].Width = h->width;
+        RSDSIF.Channel[h->channel].Height = h->height;
+        snprintf(RSDSIF.Channel[h->channel].ImgType, sizeof(RSDSIF.Channel[h->channel].ImgType), "%s", h->type);
+
+        RSDSIF_AddDataToStats(h->channel, h->length);
+
+    } else if (h->kind == CMIMG_RSDS_EMBEDDED && RSDSrx.dest != NULL) {
+
+	// save the data to disc
+        if (RSDScfg.EmbeddedDataBinary)
+            cmimg_embedded_write(h->channel, h->sim_time, h->ani_mode, RSDSrx.embedded, h->length);
+        else
+            WriteEmbeddedDataToCSVFile(RSDSrx.embedded, h->length, h->channel, h->sim_time, h->ani_mode);
+        if (RSDScfg.Verbose == 1)
+            PrintEmbeddedData(RSDSrx.embedded, h->length);
     }
 
-    return 0;
+    RSDSrx.frame = NULL;
+    RSDSrx.staged = false;
+    RSDSrx.dest = NULL;
+}
+
+/*
+ ** RSDS_ResizeFrame
+ **
+ ** crop and scale a staged frame into a pool slot, NULL if no slot is free
+ */
+static cmimg_frame_t *RSDS_ResizeFrame(tChannel *chan, const cmimg_frame_t *staged)
+{
+    size_t size = cmimg_resize_prepare(&chan->resize, staged);
+
+    if (size == 0) {
+        // nothing we can scale, publish nothing rather than a frame of the wrong size
+        RSDSIF_AddDropToStats(staged->channel);
+        return NULL;
+    }
+
+    cmimg_pool_reserve(&chan->pool, size);
+
+    cmimg_frame_t *frame = cmimg_pool_acquire(&chan->pool, size);
+    if (frame == NULL) {
+        RSDSIF_AddDropToStats(staged->channel);
+        return NULL;
+    }
+
+    cmimg_resize_frame(&chan->resize, staged, frame);
+
+    return frame;
 }
@@ -45,6 +45,9 @@ void cmimg_update(void);
 
 void cmimg_quit(void);
 
+/* set a client option given as Key=Value, e.g. "PoolDepth=6"; call before cmimg_init() */
+int cmimg_set_option(const char *option);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,464 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmimg_convert.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - Pixel Format Conversion
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmimg_convert.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define CMIMG_CONVERT_X86 1
+    #include <immintrin.h>
+#endif
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#if CMIMG_CONVERT_X86
+    #define TARGET_SSE41 __attribute__((target("ssse3,sse4.1")))
+    #define TARGET_AVX2  __attribute__((target("avx2")))
+#endif
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/* all kernels work in place on n pixels */
+typedef struct
+{
+    const char *isa;
+    void (*swap_rgb)(uint8_t *p, size_t n);
+    void (*rgba_to_rgb)(uint8_t *p, size_t n, bool bgr);
+    void (*depth_to_mm)(uint8_t *p, size_t n);
+    void (*grey_to_rgb)(uint8_t *p, size_t n);
+} tKernels;
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static void swap_rgb_scalar(uint8_t *p, size_t n);
+static void rgba_to_rgb_scalar(uint8_t *p, size_t n, bool bgr);
+static void depth_to_mm_scalar(uint8_t *p, size_t n);
+static void grey_to_rgb_scalar(uint8_t *p, size_t n);
+
+#if CMIMG_CONVERT_X86
+static void swap_rgb_sse41(uint8_t *p, size_t n);
+static void rgba_to_rgb_sse41(uint8_t *p, size_t n, bool bgr);
+static void depth_to_mm_sse41(uint8_t *p, size_t n);
+static void grey_to_rgb_sse41(uint8_t *p, size_t n);
+
+static void swap_rgb_avx2(uint8_t *p, size_t n);
+static void rgba_to_rgb_avx2(uint8_t *p, size_t n, bool bgr);
+static void depth_to_mm_avx2(uint8_t *p, size_t n);
+#endif
+
+static inline uint16_t depth_mm(float metres);
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+static const tKernels kernels_scalar = {
+    "scalar", swap_rgb_scalar, rgba_to_rgb_scalar, depth_to_mm_scalar, grey_to_rgb_scalar
+};
+
+#if CMIMG_CONVERT_X86
+static const tKernels kernels_sse41 = {
+    "sse4.1", swap_rgb_sse41, rgba_to_rgb_sse41, depth_to_mm_sse41, grey_to_rgb_sse41
+};
+
+// grey expansion is store bound, the 128 bit kernel is as fast as a 256 bit one
+static const tKernels kernels_avx2 = {
+    "avx2", swap_rgb_avx2, rgba_to_rgb_avx2, depth_to_mm_avx2, grey_to_rgb_sse41
+};
+#endif
+
+static const tKernels *kernels = &kernels_scalar;
+
+static const struct {
+    const char *name;
+    cmimg_format_t format;
+} format_names[] = {
+    { "rgb",     CMIMG_FMT_RGB },
+    { "rgba",    CMIMG_FMT_RGBA },
+    { "grey",    CMIMG_FMT_GREY },
+    { "gray",    CMIMG_FMT_GREY },
+    { "grey16",  CMIMG_FMT_GREY16 },
+    { "gray16",  CMIMG_FMT_GREY16 },
+    { "depth",   CMIMG_FMT_DEPTH },
+    { "float",   CMIMG_FMT_DEPTH },
+};
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmimg_convert_init(const char *isa)
+{
+    bool automatic = (isa == NULL || strcmp(isa, "auto") == 0);
+
+    kernels = &kernels_scalar;
+
+    #if CMIMG_CONVERT_X86
+        __builtin_cpu_init();
+
+        if ((automatic || strcmp(isa, "avx2") == 0) && __builtin_cpu_supports("avx2"))
+        {
+            kernels = &kernels_avx2;
+        }
+        else if ((automatic || strcmp(isa, "sse4.1") == 0 || strcmp(isa, "avx2") == 0)
+              && __builtin_cpu_supports("sse4.1"))
+        {
+            kernels = &kernels_sse41;
+        }
+    #endif
+
+    if (!automatic && strcmp(isa, kernels->isa) != 0)
+    {
+        // the faster kernels are an optimisation, not worth refusing to start over
+        fprintf(stderr, "cmimg_convert: %s not available, using %s\n", isa, kernels->isa);
+    }
+
+    return 0;
+}
+
+const char *cmimg_convert_isa(void)
+{
+    return kernels->isa;
+}
+
+cmimg_format_t cmimg_convert_format(const char *type)
+{
+    for (size_t i = 0; i < sizeof(format_names) / sizeof(format_names[0]); ++i)
+    {
+        if (strcmp(type, format_names[i].name) == 0)
+        {
+            return format_names[i].format;
+        }
+    }
+
+    return CMIMG_FMT_UNKNOWN;
+}
+
+size_t cmimg_convert_capacity(cmimg_format_t format, size_t length, const cmimg_convert_cfg_t *cfg)
+{
+    // only the grey expansion grows a frame, everything else shrinks or stays put
+    if (format == CMIMG_FMT_GREY && cfg->grey_to_rgb)
+    {
+        return 3 * length;
+    }
+
+    return length;
+}
+
+int cmimg_convert_frame(cmimg_frame_t *frame, const cmimg_convert_cfg_t *cfg)
+{
+    size_t pixels = (size_t)frame->width * (size_t)frame->height;
+    cmimg_format_t format = cmimg_convert_format(frame->type);
+
+    static const size_t bytes_in[] = {
+        [CMIMG_FMT_RGB] = 3, [CMIMG_FMT_RGBA] = 4, [CMIMG_FMT_GREY] = 1,
+        [CMIMG_FMT_GREY16] = 2, [CMIMG_FMT_DEPTH] = 4,
+    };
+
+    if (format == CMIMG_FMT_UNKNOWN || pixels * bytes_in[format] != frame->size)
+    {
+        // best guess: one byte per value
+        frame->channels = (pixels > 0) ? (int)(frame->size / pixels) : 0;
+        frame->elem_size = 1;
+        return (format == CMIMG_FMT_UNKNOWN) ? 0 : -1;
+    }
+
+    switch (format)
+    {
+        case CMIMG_FMT_RGB:
+            if (cfg->bgr)
+                kernels->swap_rgb(frame->data, pixels);
+            frame->channels = 3;
+            frame->elem_size = 1;
+            break;
+
+        case CMIMG_FMT_RGBA:
+            kernels->rgba_to_rgb(frame->data, pixels, cfg->bgr);
+            frame->channels = 3;
+            frame->elem_size = 1;
+            break;
+
+        case CMIMG_FMT_GREY:
+            if (cfg->grey_to_rgb && frame->capacity >= 3 * pixels)
+            {
+                kernels->grey_to_rgb(frame->data, pixels);
+                frame->channels = 3;
+            }
+            else
+            {
+                frame->channels = 1;
+            }
+            frame->elem_size = 1;
+            break;
+
+        case CMIMG_FMT_GREY16:
+            frame->channels = 1;
+            frame->elem_size = 2;
+            break;
+
+        case CMIMG_FMT_DEPTH:
+            kernels->depth_to_mm(frame->data, pixels);
+            frame->channels = 1;
+            frame->elem_size = 2;
+            break;
+
+        default:
+            break;
+    }
+
+    frame->size = pixels * (size_t)frame->channels * (size_t)frame->elem_size;
+
+    return 0;
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+/* metres -> millimetres, rounded to nearest even and clamped; NaN and negative give 0 */
+static inline uint16_t depth_mm(float metres)
+{
+    float v = metres * 1000.0f;
+
+    if (!(v > 0.0f))
+        v = 0.0f;
+    if (v > 65535.0f)
+        v = 65535.0f;
+
+    return (uint16_t)lrintf(v);
+}
+
+static void swap_rgb_scalar(uint8_t *p, size_t n)
+{
+    for (size_t i = 0; i < n; ++i, p += 3)
+    {
+        uint8_t r = p[0];
+        p[0] = p[2];
+        p[2] = r;
+    }
+}
+
+static void rgba_to_rgb_scalar(uint8_t *p, size_t n, bool bgr)
+{
+    const uint8_t *in = p;
+    uint8_t *out = p;
+
+    for (size_t i = 0; i < n; ++i, in += 4, out += 3)
+    {
+        uint8_t r = in[0], g = in[1], b = in[2];
+        out[0] = bgr ? b : r;
+        out[1] = g;
+        out[2] = bgr ? r : b;
+    }
+}
+
+static void depth_to_mm_scalar(uint8_t *p, size_t n)
+{
+    uint16_t *out = (uint16_t *)p;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        float v;
+        memcpy(&v, p + 4 * i, sizeof(v));
+        out[i] = depth_mm(v);
+    }
+}
+
+static void grey_to_rgb_scalar(uint8_t *p, size_t n)
+{
+    // back to front so the expanding output never overtakes unread input
+    for (size_t i = n; i-- > 0;)
+    {
+        uint8_t v = p[i];
+        p[3 * i + 0] = v;
+        p[3 * i + 1] = v;
+        p[3 * i + 2] = v;
+    }
+}
+
+#if CMIMG_CONVERT_X86
+
+TARGET_SSE41 static void swap_rgb_sse41(uint8_t *p, size_t n)
+{
+    // 4 pixels per step; bytes 12..15 are written back unchanged
+    const __m128i mask = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 12, 13, 14, 15);
+    size_t i = 0;
+
+    for (; i + 6 <= n; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(p + 3 * i));
+        _mm_storeu_si128((__m128i *)(p + 3 * i), _mm_shuffle_epi8(v, mask));
+    }
+
+    swap_rgb_scalar(p + 3 * i, n - i);
+}
+
+TARGET_SSE41 static void rgba_to_rgb_sse41(uint8_t *p, size_t n, bool bgr)
+{
+    const __m128i mask = bgr
+        ? _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)
+        : _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    size_t i = 0;
+
+    // the 4 spare bytes of each store land where the next step writes anyway
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(p + 4 * i));
+        _mm_storeu_si128((__m128i *)(p + 3 * i), _mm_shuffle_epi8(v, mask));
+    }
+
+    for (; i < n; ++i)
+    {
+        uint8_t r = p[4 * i], g = p[4 * i + 1], b = p[4 * i + 2];
+        p[3 * i + 0] = bgr ? b : r;
+        p[3 * i + 1] = g;
+        p[3 * i + 2] = bgr ? r : b;
+    }
+}
+
+TARGET_SSE41 static void depth_to_mm_sse41(uint8_t *p, size_t n)
+{
+    const __m128 scale = _mm_set1_ps(1000.0f);
+    const __m128 lo = _mm_setzero_ps();
+    const __m128 hi = _mm_set1_ps(65535.0f);
+    uint16_t *out = (uint16_t *)p;
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 v = _mm_mul_ps(_mm_loadu_ps((const float *)(p + 4 * i)), scale);
+        v = _mm_min_ps(_mm_max_ps(v, lo), hi); // max_ps(NaN, 0) yields 0
+        __m128i mm = _mm_cvtps_epi32(v);
+        _mm_storel_epi64((__m128i *)(out + i), _mm_packus_epi32(mm, mm));
+    }
+
+    for (; i < n; ++i)
+    {
+        float v;
+        memcpy(&v, p + 4 * i, sizeof(v));
+        out[i] = depth_mm(v);
+    }
+}
+
+TARGET_SSE41 static void grey_to_rgb_sse41(uint8_t *p, size_t n)
+{
+    const __m128i m0 = _mm_setr_epi8(0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5);
+    const __m128i m1 = _mm_setr_epi8(5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10);
+    const __m128i m2 = _mm_setr_epi8(10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15);
+    size_t blocks = n / 16;
+
+    // tail first, then whole blocks back to front
+    for (size_t i = n; i-- > blocks * 16;)
+    {
+        uint8_t v = p[i];
+        p[3 * i + 0] = v;
+        p[3 * i + 1] = v;
+        p[3 * i + 2] = v;
+    }
+
+    for (size_t b = blocks; b-- > 0;)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(p + 16 * b));
+        uint8_t *out = p + 48 * b;
+        _mm_storeu_si128((__m128i *)(out + 32), _mm_shuffle_epi8(v, m2));
+        _mm_storeu_si128((__m128i *)(out + 16), _mm_shuffle_epi8(v, m1));
+        _mm_storeu_si128((__m128i *)(out + 0), _mm_shuffle_epi8(v, m0));
+    }
+}
+
+TARGET_AVX2 static void swap_rgb_avx2(uint8_t *p, size_t n)
+{
+    // 8 pixels per step: spread 24 bytes over both lanes, swap, pack back
+    const __m256i spread = _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6);
+    const __m256i pack = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 6, 7);
+    const __m256i mask = _mm256_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 12, 13, 14, 15,
+                                          2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 12, 13, 14, 15);
+    size_t i = 0;
+
+    for (; i + 11 <= n; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(p + 3 * i));
+        __m256i s = _mm256_shuffle_epi8(_mm256_permutevar8x32_epi32(v, spread), mask);
+        s = _mm256_permutevar8x32_epi32(s, pack);
+        // bytes 24..31 belong to the next step, keep them as loaded
+        _mm256_storeu_si256((__m256i *)(p + 3 * i), _mm256_blend_epi32(s, v, 0xC0));
+    }
+
+    swap_rgb_scalar(p + 3 * i, n - i);
+}
+
+TARGET_AVX2 static void rgba_to_rgb_avx2(uint8_t *p, size_t n, bool bgr)
+{
+    const __m256i pack = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+    const __m256i mask = bgr
+        ? _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                           2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)
+        : _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+                           0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(p + 4 * i));
+        v = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, mask), pack);
+        _mm256_storeu_si256((__m256i *)(p + 3 * i), v);
+    }
+
+    for (; i < n; ++i)
+    {
+        uint8_t r = p[4 * i], g = p[4 * i + 1], b = p[4 * i + 2];
+        p[3 * i + 0] = bgr ? b : r;
+        p[3 * i + 1] = g;
+        p[3 * i + 2] = bgr ? r : b;
+    }
+}
+
+TARGET_AVX2 static void depth_to_mm_avx2(uint8_t *p, size_t n)
+{
+    const __m256 scale = _mm256_set1_ps(1000.0f);
+    const __m256 lo = _mm256_setzero_ps();
+    const __m256 hi = _mm256_set1_ps(65535.0f);
+    uint16_t *out = (uint16_t *)p;
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 v = _mm256_mul_ps(_mm256_loadu_ps((const float *)(p + 4 * i)), scale);
+        v = _mm256_min_ps(_mm256_max_ps(v, lo), hi);
+        __m256i mm = _mm256_cvtps_epi32(v);
+        mm = _mm256_permute4x64_epi64(_mm256_packus_epi32(mm, mm), 0x08);
+        _mm_storeu_si128((__m128i *)(out + i), _mm256_castsi256_si128(mm));
+    }
+
+    for (; i < n; ++i)
+    {
+        float v;
+        memcpy(&v, p + 4 * i, sizeof(v));
+        out[i] = depth_mm(v);
+    }
+}
+
+#endif
@@ -0,0 +1,81 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmimg_convert.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - Pixel Format Conversion
+**
+***************************************************************/
+
+#ifndef CMIMG_CONVERT_H
+#define CMIMG_CONVERT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "cmimg_pool.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef enum
+{
+    CMIMG_FMT_UNKNOWN = 0, // published as received
+    CMIMG_FMT_RGB,         // 3 x uint8
+    CMIMG_FMT_RGBA,        // 4 x uint8
+    CMIMG_FMT_GREY,        // 1 x uint8
+    CMIMG_FMT_GREY16,      // 1 x uint16
+    CMIMG_FMT_DEPTH,       // 1 x float, metres
+} cmimg_format_t;
+
+typedef struct
+{
+    bool bgr;         // colour frames are published in BGR order
+    bool grey_to_rgb; // expand grey frames to three channels
+} cmimg_convert_cfg_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+/* pick the kernels: "auto", "avx2", "sse4.1" or "scalar", falling back to the best the CPU has */
+int cmimg_convert_init(const char *isa);
+
+const char *cmimg_convert_isa(void);
+
+cmimg_format_t cmimg_convert_format(const char *type);
+
+/* bytes a slot needs to hold the frame before and after in-place conversion */
+size_t cmimg_convert_capacity(cmimg_format_t format, size_t length, const cmimg_convert_cfg_t *cfg);
+
+/*
+ * Convert frame->data in place and fill in channels and elem_size:
+ * rgb -> bgr, rgba -> rgb/bgr, depth -> uint16 millimetres and,
+ * if requested, grey -> rgb. Frames whose size doesn't match their
+ * header are left untouched and -1 is returned.
+ */
+int cmimg_convert_frame(cmimg_frame_t *frame, const cmimg_convert_cfg_t *cfg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMIMG_CONVERT_H */
@@ -0,0 +1,322 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmimg_embedded.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - Binary Embedded Data Writer
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmimg_embedded.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cm_thread.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define PAD8(x) (((x) + 7u) & ~(size_t)7u)
+
+/* every regular buffer plus up to as many oversized one-off records */
+#define MAX_PENDING (2 * CMIMG_EMBEDDED_BUFFERS)
+
+_Static_assert(sizeof(cmimg_embedded_record_t) == 32, "record header layout is part of the file format");
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef struct
+{
+    char *data;
+    size_t size;
+    size_t used;
+    bool oneOff; // allocated for a single oversized record, freed once written
+} tBuffer;
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static CM_THREAD_FUNC(writer_main);
+static void submit(tBuffer *buffer);
+static tBuffer *take_free(void);
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+static struct {
+    FILE *file;
+    cm_thread_t thread;
+
+    tBuffer buffers[CMIMG_EMBEDDED_BUFFERS];
+    tBuffer *current; // receive thread only
+
+    /* handoff between receive thread and writer, guarded by lock */
+    cm_mutex_t lock;
+    cm_cond_t wake;
+    tBuffer *pending[MAX_PENDING];
+    int nPending;
+    tBuffer *free[CMIMG_EMBEDDED_BUFFERS];
+    int nFree;
+    bool stop;
+
+    unsigned long dropped;
+} Writer;
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmimg_embedded_open(const char *path)
+{
+    memset(&Writer, 0, sizeof(Writer));
+
+    if ((Writer.file = fopen(path, "wb")) == NULL)
+    {
+        fprintf(stderr, "cmimg_embedded: can't open %s\n", path);
+        return -1;
+    }
+
+    // the writer thread does its own buffering
+    setvbuf(Writer.file, NULL, _IONBF, 0);
+    fwrite(CMIMG_EMBEDDED_MAGIC, 1, 8, Writer.file);
+
+    for (int i = 0; i < CMIMG_EMBEDDED_BUFFERS; ++i)
+    {
+        if ((Writer.buffers[i].data = malloc(CMIMG_EMBEDDED_BUFFER_SIZE)) == NULL)
+        {
+            fprintf(stderr, "cmimg_embedded: failed to allocate write buffers\n");
+            for (int j = 0; j < i; ++j)
+                free(Writer.buffers[j].data);
+            fclose(Writer.file);
+            Writer.file = NULL;
+            return -1;
+        }
+        Writer.buffers[i].size = CMIMG_EMBEDDED_BUFFER_SIZE;
+        Writer.free[Writer.nFree++] = &Writer.buffers[i];
+    }
+
+    Writer.current = Writer.free[--Writer.nFree];
+
+    cm_mutex_init(&Writer.lock);
+    cm_cond_init(&Writer.wake);
+
+    if (!cm_thread_start(&Writer.thread, writer_main, NULL))
+    {
+        fprintf(stderr, "cmimg_embedded: failed to start writer thread\n");
+        cm_mutex_destroy(&Writer.lock);
+        cm_cond_destroy(&Writer.wake);
+        for (int i = 0; i < CMIMG_EMBEDDED_BUFFERS; ++i)
+            free(Writer.buffers[i].data);
+        fclose(Writer.file);
+        Writer.file = NULL;
+        return -1;
+    }
+
+    return 0;
+}
+
+void cmimg_embedded_write(int channel, float simTime, const char *aniMode, const void *data, unsigned int len)
+{
+    size_t need = sizeof(cmimg_embedded_record_t) + PAD8((size_t)len);
+
+    if (Writer.file == NULL)
+        return;
+
+    if (Writer.current == NULL)
+    {
+        Writer.current = take_free();
+    }
+    else if (Writer.current->size - Writer.current->used < need)
+    {
+        submit(Writer.current);
+        Writer.current = take_free();
+    }
+
+    tBuffer *buffer = Writer.current;
+    tBuffer oneOff = { NULL, 0, 0, true };
+
+    if (need > CMIMG_EMBEDDED_BUFFER_SIZE)
+    {
+        // larger than a whole buffer: give it one of its own, written in order after the others
+        if ((oneOff.data = malloc(need)) == NULL)
+        {
+            Writer.dropped++;
+            return;
+        }
+        oneOff.size = need;
+        buffer = &oneOff;
+    }
+    else if (buffer == NULL)
+    {
+        // the disk can't keep up; losing a record beats stalling the socket
+        Writer.dropped++;
+        return;
+    }
+
+    cmimg_embedded_record_t rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.length = len;
+    rec.channel = channel;
+    rec.sim_time = simTime;
+    snprintf(rec.ani_mode, sizeof(rec.ani_mode), "%s", aniMode);
+
+    char *p = buffer->data + buffer->used;
+    memcpy(p, &rec, sizeof(rec));
+    memcpy(p + sizeof(rec), data, len);
+    memset(p + sizeof(rec) + len, 0, PAD8((size_t)len) - len);
+    buffer->used += need;
+
+    if (buffer == &oneOff)
+    {
+        tBuffer *copy = malloc(sizeof(*copy));
+        if (copy == NULL)
+        {
+            free(oneOff.data);
+            Writer.dropped++;
+            return;
+        }
+        *copy = oneOff;
+        submit(copy);
+    }
+}
+
+void cmimg_embedded_flush(void)
+{
+    if (Writer.file == NULL || Writer.current == NULL || Writer.current->used == 0)
+        return;
+
+    submit(Writer.current);
+    Writer.current = take_free();
+}
+
+void cmimg_embedded_close(void)
+{
+    if (Writer.file == NULL)
+        return;
+
+    cmimg_embedded_flush();
+
+    cm_mutex_lock(&Writer.lock);
+    Writer.stop = true;
+    cm_cond_signal(&Writer.wake);
+    cm_mutex_unlock(&Writer.lock);
+
+    cm_thread_join(Writer.thread);
+
+    cm_mutex_destroy(&Writer.lock);
+    cm_cond_destroy(&Writer.wake);
+
+    for (int i = 0; i < CMIMG_EMBEDDED_BUFFERS; ++i)
+    {
+        free(Writer.buffers[i].data);
+        Writer.buffers[i].data = NULL;
+    }
+
+    fclose(Writer.file);
+    Writer.file = NULL;
+    Writer.current = NULL;
+}
+
+unsigned long cmimg_embedded_dropped(void)
+{
+    return Writer.dropped;
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static CM_THREAD_FUNC(writer_main)
+{
+    (void)arg;
+
+    for (;;)
+    {
+        cm_mutex_lock(&Writer.lock);
+        while (Writer.nPending == 0 && !Writer.stop)
+        {
+            cm_cond_wait(&Writer.wake, &Writer.lock);
+        }
+
+        if (Writer.nPending == 0)
+        {
+            cm_mutex_unlock(&Writer.lock);
+            break;
+        }
+
+        tBuffer *buffer = Writer.pending[0];
+        memmove(Writer.pending, Writer.pending + 1, --Writer.nPending * sizeof(Writer.pending[0]));
+        cm_mutex_unlock(&Writer.lock);
+
+        if (fwrite(buffer->data, 1, buffer->used, Writer.file) != buffer->used)
+        {
+            fprintf(stderr, "cmimg_embedded: write failed, %zu bytes lost\n", buffer->used);
+        }
+
+        if (buffer->oneOff)
+        {
+            free(buffer->data);
+            free(buffer);
+            continue;
+        }
+
+        buffer->used = 0;
+
+        cm_mutex_lock(&Writer.lock);
+        Writer.free[Writer.nFree++] = buffer;
+        cm_mutex_unlock(&Writer.lock);
+    }
+
+    CM_THREAD_RETURN;
+}
+
+static void submit(tBuffer *buffer)
+{
+    // regular buffers always find a place, one-offs may only use the spare half
+    int limit = buffer->oneOff ? MAX_PENDING - CMIMG_EMBEDDED_BUFFERS : MAX_PENDING;
+
+    cm_mutex_lock(&Writer.lock);
+    if (Writer.nPending < limit)
+    {
+        Writer.pending[Writer.nPending++] = buffer;
+        cm_cond_signal(&Writer.wake);
+        buffer = NULL;
+    }
+    cm_mutex_unlock(&Writer.lock);
+
+    if (buffer != NULL)
+    {
+        Writer.dropped++;
+        free(buffer->data);
+        free(buffer);
+    }
+}
+
+static tBuffer *take_free(void)
+{
+    tBuffer *buffer = NULL;
+
+    cm_mutex_lock(&Writer.lock);
+    if (Writer.nFree > 0)
+    {
+        buffer = Writer.free[--Writer.nFree];
+    }
+    cm_mutex_unlock(&Writer.lock);
+
+    return buffer;
+}
@@ -0,0 +1,78 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmimg_embedded.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - Binary Embedded Data Writer
+**
+***************************************************************/
+
+#ifndef CMIMG_EMBEDDED_H
+#define CMIMG_EMBEDDED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/* 8 byte file header, followed by records until the end of the file */
+#define CMIMG_EMBEDDED_MAGIC "CMEMBED1"
+
+#define CMIMG_EMBEDDED_BUFFERS     (4)
+#define CMIMG_EMBEDDED_BUFFER_SIZE (4u * 1024 * 1024)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/*
+ * Record header, host byte order (little endian on every CarMaker
+ * platform). length bytes of raw doubles follow, padded to a multiple
+ * of 8 so the doubles stay aligned when the file is mapped.
+ */
+typedef struct
+{
+    uint32_t length;
+    int32_t channel;
+    double sim_time;
+    char ani_mode[16];
+} cmimg_embedded_record_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+int cmimg_embedded_open(const char *path);
+
+/* receive thread: append one *RSDSEmbeddedData packet, never waits for the disk */
+void cmimg_embedded_write(int channel, float simTime, const char *aniMode, const void *data, unsigned int len);
+
+/* receive thread: hand the partly filled buffer to the writer, e.g. at the end of a test run */
+void cmimg_embedded_flush(void);
+
+/* write everything still buffered and close the file */
+void cmimg_embedded_close(void);
+
+/* records lost because the writer thread fell behind */
+unsigned long cmimg_embedded_dropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMIMG_EMBEDDED_H */
@@ -0,0 +1,481 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmimg_encode.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - Frame Compression Workers
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmimg_encode.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+
+#include "cm_thread.h"
+#include "cm_util.h"
+
+#if CMIMG_HAVE_LZ4
+    #include <lz4.h>
+#endif
+
+#if CMIMG_HAVE_JPEG
+    #include <jpeglib.h>
+#endif
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+_Static_assert(sizeof(cmimg_encode_header_t) == CMIMG_ENCODE_HEADER_SIZE, "header layout is part of the wire format");
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+#if CMIMG_HAVE_JPEG
+typedef struct
+{
+    struct jpeg_error_mgr mgr;
+    jmp_buf jump;
+} tJpegError;
+#endif
+
+/* per worker state, reused from frame to frame */
+typedef struct
+{
+    cm_thread_t thread;
+
+    #if CMIMG_HAVE_JPEG
+        struct jpeg_compress_struct jpeg;
+        tJpegError jerr;
+        uint8_t *row; // scanline with swapped colour order
+        size_t rowSize;
+    #endif
+} tWorker;
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static CM_THREAD_FUNC(worker_main);
+
+static void encode_frame(tWorker *worker, cmimg_frame_t *frame);
+
+#if CMIMG_HAVE_LZ4 || CMIMG_HAVE_JPEG
+static bool reserve_output(cmimg_frame_t *frame, size_t payload);
+static void put_header(cmimg_frame_t *frame, size_t payload);
+#endif
+
+#if CMIMG_HAVE_LZ4
+static bool encode_lz4(cmimg_frame_t *frame);
+#endif
+
+#if CMIMG_HAVE_JPEG
+static bool encode_jpeg(tWorker *worker, cmimg_frame_t *frame);
+static void jpeg_error_exit(j_common_ptr cinfo);
+#endif
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+static struct {
+    tWorker workers[CMIMG_ENCODE_MAX_THREADS];
+    int nWorkers;
+
+    int quality;
+    bool bgr;
+    cmimg_encode_done_t done;
+
+    /* job ring, guarded by lock */
+    cm_mutex_t lock;
+    cm_cond_t wake;
+    cmimg_frame_t *jobs[CMIMG_ENCODE_MAX_JOBS];
+    unsigned int head;
+    unsigned int count;
+    bool stop;
+
+    /* serialises the done callbacks */
+    cm_mutex_t doneLock;
+} Encoder;
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+bool cmimg_encode_available(cmimg_encoding_t encoding)
+{
+    switch (encoding)
+    {
+        case CMIMG_ENC_NONE:
+            return true;
+        #if CMIMG_HAVE_LZ4
+        case CMIMG_ENC_LZ4:
+            return true;
+        #endif
+        #if CMIMG_HAVE_JPEG
+        case CMIMG_ENC_JPEG:
+            return true;
+        #endif
+        default:
+            return false;
+    }
+}
+
+const char *cmimg_encode_name(cmimg_encoding_t encoding)
+{
+    switch (encoding)
+    {
+        case CMIMG_ENC_LZ4:  return "lz4";
+        case CMIMG_ENC_JPEG: return "jpeg";
+        default:             return "none";
+    }
+}
+
+void cmimg_encode_header(const cmimg_frame_t *frame, bool bgr, size_t payload, uint8_t *out)
+{
+    memcpy(out, CMIMG_ENCODE_MAGIC, 4);
+    out[4] = (uint8_t)frame->encoding;
+    out[5] = (uint8_t)frame->channel;
+    out[6] = (uint8_t)frame->channels;
+    out[7] = (uint8_t)frame->elem_size;
+    out[8] = (uint8_t)bgr;
+    out[9] = 0;
+    out[10] = 0;
+    out[11] = 0;
+    cm_put_u32(out + 12, (uint32_t)frame->width);
+    cm_put_u32(out + 16, (uint32_t)frame->height);
+    cm_put_u32(out + 20, (uint32_t)frame->size);
+    cm_put_u32(out + 24, (uint32_t)payload);
+}
+
+int cmimg_encode_init(int threads, int jpegQuality, bool bgr, cmimg_encode_done_t done)
+{
+    if (threads < 1 || threads > CMIMG_ENCODE_MAX_THREADS)
+    {
+        fprintf(stderr, "cmimg_encode: invalid thread count %d (1..%d)\n", threads, CMIMG_ENCODE_MAX_THREADS);
+        return -1;
+    }
+
+    memset(Encoder.workers, 0, sizeof(Encoder.workers));
+    Encoder.quality = jpegQuality;
+    Encoder.bgr = bgr;
+    Encoder.done = done;
+    Encoder.head = 0;
+    Encoder.count = 0;
+    Encoder.stop = false;
+
+    cm_mutex_init(&Encoder.lock);
+    cm_mutex_init(&Encoder.doneLock);
+    cm_cond_init(&Encoder.wake);
+
+    for (Encoder.nWorkers = 0; Encoder.nWorkers < threads; ++Encoder.nWorkers)
+    {
+        tWorker *worker = &Encoder.workers[Encoder.nWorkers];
+
+        #if CMIMG_HAVE_JPEG
+            worker->jpeg.err = jpeg_std_error(&worker->jerr.mgr);
+            worker->jerr.mgr.error_exit = jpeg_error_exit;
+            jpeg_create_compress(&worker->jpeg);
+        #endif
+
+        if (!cm_thread_start(&worker->thread, worker_main, worker))
+        {
+            fprintf(stderr, "cmimg_encode: failed to start worker %d\n", Encoder.nWorkers);
+            #if CMIMG_HAVE_JPEG
+                jpeg_destroy_compress(&worker->jpeg);
+            #endif
+            cmimg_encode_quit();
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+void cmimg_encode_quit(void)
+{
+    cm_mutex_lock(&Encoder.lock);
+    Encoder.stop = true;
+    cm_cond_broadcast(&Encoder.wake);
+    cm_mutex_unlock(&Encoder.lock);
+
+    for (int i = 0; i < Encoder.nWorkers; ++i)
+    {
+        tWorker *worker = &Encoder.workers[i];
+
+        cm_thread_join(worker->thread);
+
+        #if CMIMG_HAVE_JPEG
+            jpeg_destroy_compress(&worker->jpeg);
+            free(worker->row);
+        #endif
+    }
+
+    Encoder.nWorkers = 0;
+
+    cm_mutex_destroy(&Encoder.lock);
+    cm_mutex_destroy(&Encoder.doneLock);
+    cm_cond_destroy(&Encoder.wake);
+}
+
+int cmimg_encode_submit(cmimg_frame_t *frame)
+{
+    int res = -1;
+
+    cm_mutex_lock(&Encoder.lock);
+    if (!Encoder.stop && Encoder.count < CMIMG_ENCODE_MAX_JOBS)
+    {
+        Encoder.jobs[(Encoder.head + Encoder.count) % CMIMG_ENCODE_MAX_JOBS] = frame;
+        Encoder.count++;
+        cm_cond_signal(&Encoder.wake);
+        res = 0;
+    }
+    cm_mutex_unlock(&Encoder.lock);
+
+    return res;
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static CM_THREAD_FUNC(worker_main)
+{
+    tWorker *worker = arg;
+
+    for (;;)
+    {
+        cm_mutex_lock(&Encoder.lock);
+        while (Encoder.count == 0 && !Encoder.stop)
+        {
+            cm_cond_wait(&Encoder.wake, &Encoder.lock);
+        }
+
+        // queued jobs are still finished on stop, their frames have to come back
+        if (Encoder.count == 0)
+        {
+            cm_mutex_unlock(&Encoder.lock);
+            break;
+        }
+
+        cmimg_frame_t *frame = Encoder.jobs[Encoder.head];
+        Encoder.head = (Encoder.head + 1) % CMIMG_ENCODE_MAX_JOBS;
+        Encoder.count--;
+        cm_mutex_unlock(&Encoder.lock);
+
+        encode_frame(worker, frame);
+
+        cm_mutex_lock(&Encoder.doneLock);
+        Encoder.done(frame);
+        cm_mutex_unlock(&Encoder.doneLock);
+    }
+
+    CM_THREAD_RETURN;
+}
+
+/* a frame that can't be encoded is published raw rather than lost */
+static void encode_frame(tWorker *worker, cmimg_frame_t *frame)
+{
+    bool ok = false;
+
+    switch (frame->encoding)
+    {
+        #if CMIMG_HAVE_JPEG
+        case CMIMG_ENC_JPEG:
+            if (frame->elem_size == 1 && (frame->channels == 1 || frame->channels == 3))
+            {
+                ok = encode_jpeg(worker, frame);
+                break;
+            }
+            // 16 bit and odd channel counts go lossless instead
+            #if CMIMG_HAVE_LZ4
+                frame->encoding = CMIMG_ENC_LZ4;
+                ok = encode_lz4(frame);
+            #endif
+            break;
+        #endif
+
+        #if CMIMG_HAVE_LZ4
+        case CMIMG_ENC_LZ4:
+            ok = encode_lz4(frame);
+            break;
+        #endif
+
+        default:
+            break;
+    }
+
+    if (!ok)
+    {
+        frame->encoding = CMIMG_ENC_NONE;
+        frame->encoded_size = 0;
+    }
+
+    (void)worker;
+}
+
+#if CMIMG_HAVE_LZ4 || CMIMG_HAVE_JPEG
+static bool reserve_output(cmimg_frame_t *frame, size_t payload)
+{
+    size_t size = CMIMG_ENCODE_HEADER_SIZE + payload;
+
+    if (frame->encoded_capacity >= size)
+    {
+        return true;
+    }
+
+    uint8_t *buf = realloc(frame->encoded, size);
+    if (buf == NULL)
+    {
+        fprintf(stderr, "cmimg_encode: failed to allocate %zu byte output\n", size);
+        return false;
+    }
+
+    frame->encoded = buf;
+    frame->encoded_capacity = size;
+
+    return true;
+}
+
+static void put_header(cmimg_frame_t *frame, size_t payload)
+{
+    cmimg_encode_header(frame, Encoder.bgr, payload, frame->encoded);
+
+    frame->encoded_size = CMIMG_ENCODE_HEADER_SIZE + payload;
+}
+#endif
+
+#if CMIMG_HAVE_LZ4
+static bool encode_lz4(cmimg_frame_t *frame)
+{
+    int bound = LZ4_compressBound((int)frame->size);
+
+    if (bound <= 0 || !reserve_output(frame, (size_t)bound))
+    {
+        return false;
+    }
+
+    int n = LZ4_compress_default((const char *)frame->data,
+                                 (char *)frame->encoded + CMIMG_ENCODE_HEADER_SIZE,
+                                 (int)frame->size, bound);
+    if (n <= 0)
+    {
+        return false;
+    }
+
+    put_header(frame, (size_t)n);
+
+    return true;
+}
+#endif
+
+#if CMIMG_HAVE_JPEG
+static bool encode_jpeg(tWorker *worker, cmimg_frame_t *frame)
+{
+    struct jpeg_compress_struct *jpeg = &worker->jpeg;
+    size_t stride = (size_t)frame->width * frame->channels;
+    bool swap = (frame->channels == 3 && Encoder.bgr);
+
+    // a JPEG of a frame worth sending is far below the raw size; libjpeg grows the buffer if not
+    if (!reserve_output(frame, frame->size / 2 + 4096))
+    {
+        return false;
+    }
+
+    unsigned char *out = frame->encoded + CMIMG_ENCODE_HEADER_SIZE;
+    unsigned long outSize = (unsigned long)(frame->encoded_capacity - CMIMG_ENCODE_HEADER_SIZE);
+
+    if (setjmp(worker->jerr.jump))
+    {
+        jpeg_abort_compress(jpeg);
+        return false;
+    }
+
+    #ifdef JCS_EXTENSIONS
+        bool swapRows = false;
+    #else
+        bool swapRows = swap;
+    #endif
+
+    if (swapRows && worker->rowSize < stride)
+    {
+        uint8_t *row = realloc(worker->row, stride);
+        if (row == NULL)
+            return false;
+        worker->row = row;
+        worker->rowSize = stride;
+    }
+
+    jpeg_mem_dest(jpeg, &out, &outSize);
+
+    jpeg->image_width = (JDIMENSION)frame->width;
+    jpeg->image_height = (JDIMENSION)frame->height;
+    jpeg->input_components = frame->channels;
+    jpeg->in_color_space = (frame->channels == 1) ? JCS_GRAYSCALE : JCS_RGB;
+    #ifdef JCS_EXTENSIONS
+        if (swap)
+            jpeg->in_color_space = JCS_EXT_BGR;
+    #endif
+
+    jpeg_set_defaults(jpeg);
+    jpeg_set_quality(jpeg, Encoder.quality, TRUE);
+    jpeg->dct_method = JDCT_IFAST;
+
+    jpeg_start_compress(jpeg, TRUE);
+
+    while (jpeg->next_scanline < jpeg->image_height)
+    {
+        JSAMPROW row = frame->data + (size_t)jpeg->next_scanline * stride;
+
+        if (swapRows)
+        {
+            for (size_t i = 0; i < stride; i += 3)
+            {
+                worker->row[i + 0] = row[i + 2];
+                worker->row[i + 1] = row[i + 1];
+                worker->row[i + 2] = row[i + 0];
+            }
+            row = worker->row;
+        }
+
+        jpeg_write_scanlines(jpeg, &row, 1);
+    }
+
+    jpeg_finish_compress(jpeg);
+
+    // libjpeg moved to a buffer of its own, take the result over
+    if (out != frame->encoded + CMIMG_ENCODE_HEADER_SIZE)
+    {
+        bool ok = reserve_output(frame, outSize);
+        if (ok)
+            memcpy(frame->encoded + CMIMG_ENCODE_HEADER_SIZE, out, outSize);
+        free(out);
+        if (!ok)
+            return false;
+    }
+
+    put_header(frame, outSize);
+
+    return true;
+}
+
+static void jpeg_error_exit(j_common_ptr cinfo)
+{
+    tJpegError *err = (tJpegError *)cinfo->err;
+
+    (*cinfo->err->output_message)(cinfo);
+    longjmp(err->jump, 1);
+}
+#endif
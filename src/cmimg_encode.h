@@ -0,0 +1,104 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmimg_encode.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - Frame Compression Workers
+**
+***************************************************************/
+
+#ifndef CMIMG_ENCODE_H
+#define CMIMG_ENCODE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "cmimg_pool.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define CMIMG_ENCODE_MAX_THREADS (8)
+#define CMIMG_ENCODE_MAX_JOBS    (64)
+
+/* first bytes of every published frame */
+#define CMIMG_ENCODE_MAGIC "CMIE"
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef enum
+{
+    CMIMG_ENC_NONE = 0,
+    CMIMG_ENC_LZ4,  // lossless, for ground truth channels
+    CMIMG_ENC_JPEG, // 8 bit grey or colour only
+} cmimg_encoding_t;
+
+/*
+ * Prefix of every published frame, all fields little endian. Frames go
+ * out as tagged blobs, see cmxif.h, so clients can tell the channels
+ * apart; an unencoded frame carries its raw_size bytes as payload.
+ */
+typedef struct
+{
+    char magic[4];
+    uint8_t encoding;  // cmimg_encoding_t
+    uint8_t channel;   // image client channel the frame came in on
+    uint8_t channels;
+    uint8_t elem_size;
+    uint8_t bgr;       // colour order of the decoded pixels
+    uint8_t reserved[3];
+    uint32_t width;
+    uint32_t height;
+    uint32_t raw_size; // decoded size in bytes
+    uint32_t payload_size;
+} cmimg_encode_header_t;
+
+#define CMIMG_ENCODE_HEADER_SIZE (28)
+
+/* called from the workers, one call at a time; frames that failed to encode come back with CMIMG_ENC_NONE */
+typedef void (*cmimg_encode_done_t)(cmimg_frame_t *frame);
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+bool cmimg_encode_available(cmimg_encoding_t encoding);
+
+const char *cmimg_encode_name(cmimg_encoding_t encoding);
+
+/* write the header of frame to out, CMIMG_ENCODE_HEADER_SIZE bytes, for payload bytes following it */
+void cmimg_encode_header(const cmimg_frame_t *frame, bool bgr, size_t payload, uint8_t *out);
+
+int cmimg_encode_init(int threads, int jpegQuality, bool bgr, cmimg_encode_done_t done);
+
+/* finish queued jobs and stop the workers */
+void cmimg_encode_quit(void);
+
+/*
+ * Queue frame for compression with frame->encoding. The frame belongs
+ * to the workers until it comes back through the done callback.
+ * Returns -1 if the job queue is full, the frame is still the caller's then.
+ */
+int cmimg_encode_submit(cmimg_frame_t *frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMIMG_ENCODE_H */
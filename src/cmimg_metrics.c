@@ -0,0 +1,402 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmimg_metrics.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - Pipeline Metrics
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmimg_metrics.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#if WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+    #include <windows.h>
+#else
+    #include <unistd.h>
+    #include <sys/socket.h>
+    #include <sys/types.h>
+    #include <netdb.h>
+#endif
+
+#include "cm_util.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define LINE_SIZE (8192)
+
+#if WIN32
+    #define close closesocket
+#endif
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/* written by the receive thread only */
+typedef struct {
+    _Alignas(64) atomic_ullong frames[CMIMG_METRICS_CHANNELS];
+    atomic_ullong bytes[CMIMG_METRICS_CHANNELS];
+    atomic_ullong simFirst;  // sim time of the first frame, microseconds
+    atomic_ullong wallFirst; // cm_now_ns() of the first frame
+    atomic_ullong simLast;
+    atomic_ullong wallLast;
+} tRxCounters;
+
+/* written by the XIF transmit thread only, the main loop exports them */
+typedef struct {
+    _Alignas(64) atomic_ullong frames[CMIMG_METRICS_CHANNELS];
+    atomic_ullong bytes[CMIMG_METRICS_CHANNELS];
+    atomic_ullong latencyMax[CMIMG_METRICS_CHANNELS]; // per period
+    atomic_ullong histogram[CMIMG_METRICS_CHANNELS][CMIMG_METRICS_BUCKETS];
+} tPubCounters;
+
+/* drops happen on the receive thread and on the encoder workers */
+typedef struct {
+    _Alignas(64) atomic_ullong frames[CMIMG_METRICS_CHANNELS];
+} tDropCounters;
+
+/* values at the previous export, for rates and per period histograms */
+typedef struct {
+    uint64_t time;
+    uint64_t simTime;
+    unsigned long long received[CMIMG_METRICS_CHANNELS];
+    unsigned long long receivedBytes[CMIMG_METRICS_CHANNELS];
+    unsigned long long published[CMIMG_METRICS_CHANNELS];
+    unsigned long long publishedBytes[CMIMG_METRICS_CHANNELS];
+    unsigned long long histogram[CMIMG_METRICS_CHANNELS][CMIMG_METRICS_BUCKETS];
+} tSnapshot;
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static inline void bump(atomic_ullong *counter, unsigned long long n);
+static inline unsigned long long get(atomic_ullong *counter);
+static int latency_bucket(uint64_t us);
+static unsigned long long percentile(const unsigned long long *hist, unsigned long long total, double p);
+static void export_sample(void);
+static void append(char *buf, size_t *len, const char *fmt, ...);
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+static tRxCounters Rx;
+static tPubCounters Pub;
+static tDropCounters Drop;
+
+static struct {
+    FILE *file;
+    int sock;
+    uint64_t period;
+    tSnapshot last;
+} Sink = { .file = NULL, .sock = -1 };
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+void cmimg_metrics_received(int channel, size_t bytes, float simTime)
+{
+    uint64_t now = cm_now_ns();
+    uint64_t sim = (simTime > 0.0f) ? (uint64_t)(simTime * 1e6) : 0;
+
+    if (channel < 0 || channel >= CMIMG_METRICS_CHANNELS)
+        return;
+
+    // restart the lag reference when a new test run starts over at sim time 0
+    if (get(&Rx.wallFirst) == 0 || sim < get(&Rx.simLast))
+    {
+        atomic_store_explicit(&Rx.simFirst, sim, memory_order_relaxed);
+        atomic_store_explicit(&Rx.wallFirst, now, memory_order_relaxed);
+    }
+
+    bump(&Rx.frames[channel], 1);
+    bump(&Rx.bytes[channel], bytes);
+    atomic_store_explicit(&Rx.simLast, sim, memory_order_relaxed);
+    atomic_store_explicit(&Rx.wallLast, now, memory_order_relaxed);
+}
+
+void cmimg_metrics_dropped(int channel)
+{
+    if (channel < 0 || channel >= CMIMG_METRICS_CHANNELS)
+        return;
+
+    atomic_fetch_add_explicit(&Drop.frames[channel], 1, memory_order_relaxed);
+}
+
+void cmimg_metrics_published(int channel, size_t bytes, uint64_t received)
+{
+    if (channel < 0 || channel >= CMIMG_METRICS_CHANNELS)
+        return;
+
+    uint64_t now = cm_now_ns();
+    uint64_t us = (received != 0 && now > received) ? (now - received) / 1000 : 0;
+
+    bump(&Pub.frames[channel], 1);
+    bump(&Pub.bytes[channel], bytes);
+    bump(&Pub.histogram[channel][latency_bucket(us)], 1);
+
+    if (us > get(&Pub.latencyMax[channel]))
+        atomic_store_explicit(&Pub.latencyMax[channel], us, memory_order_relaxed);
+}
+
+int cmimg_metrics_open(const char *sink, int period_ms)
+{
+    if (period_ms <= 0)
+        period_ms = CMIMG_METRICS_DEFAULT_PERIOD_MS;
+
+    if (strncmp(sink, "udp:", 4) == 0)
+    {
+        char host[256];
+        const char *port = strrchr(sink + 4, ':');
+
+        if (port == NULL || (size_t)(port - (sink + 4)) >= sizeof(host))
+        {
+            fprintf(stderr, "cmimg_metrics: expected udp:<host>:<port>, got '%s'\n", sink);
+            return -1;
+        }
+
+        memcpy(host, sink + 4, (size_t)(port - (sink + 4)));
+        host[port - (sink + 4)] = '\0';
+
+        struct addrinfo hints, *res = NULL;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_DGRAM;
+
+        if (getaddrinfo(host, port + 1, &hints, &res) != 0 || res == NULL)
+        {
+            fprintf(stderr, "cmimg_metrics: can't resolve %s\n", sink + 4);
+            return -1;
+        }
+
+        Sink.sock = (int)socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+        if (Sink.sock < 0 || connect(Sink.sock, res->ai_addr, (int)res->ai_addrlen) != 0)
+        {
+            fprintf(stderr, "cmimg_metrics: can't open %s\n", sink);
+            if (Sink.sock >= 0)
+                close(Sink.sock);
+            Sink.sock = -1;
+            freeaddrinfo(res);
+            return -1;
+        }
+
+        freeaddrinfo(res);
+    }
+    else if ((Sink.file = fopen(sink, "a")) == NULL)
+    {
+        fprintf(stderr, "cmimg_metrics: can't open %s\n", sink);
+        return -1;
+    }
+
+    Sink.period = (uint64_t)period_ms * 1000000ull;
+    memset(&Sink.last, 0, sizeof(Sink.last));
+    Sink.last.time = cm_now_ns();
+
+    return 0;
+}
+
+void cmimg_metrics_poll(void)
+{
+    if (Sink.file == NULL && Sink.sock < 0)
+        return;
+
+    if (cm_now_ns() - Sink.last.time >= Sink.period)
+        export_sample();
+}
+
+void cmimg_metrics_close(void)
+{
+    if (Sink.file == NULL && Sink.sock < 0)
+        return;
+
+    export_sample();
+
+    if (Sink.file != NULL)
+        fclose(Sink.file);
+    if (Sink.sock >= 0)
+        close(Sink.sock);
+
+    Sink.file = NULL;
+    Sink.sock = -1;
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+/* single writer: a load and a store, no locked instruction */
+static inline void bump(atomic_ullong *counter, unsigned long long n)
+{
+    atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + n, memory_order_relaxed);
+}
+
+static inline unsigned long long get(atomic_ullong *counter)
+{
+    return atomic_load_explicit(counter, memory_order_relaxed);
+}
+
+static int latency_bucket(uint64_t us)
+{
+    int n = 0;
+
+    while (us != 0 && n < CMIMG_METRICS_BUCKETS - 1)
+    {
+        us >>= 1;
+        n++;
+    }
+
+    return n;
+}
+
+/* upper bound of the bucket holding the p-th fraction of the samples */
+static unsigned long long percentile(const unsigned long long *hist, unsigned long long total, double p)
+{
+    unsigned long long rank = (unsigned long long)(p * total + 0.5), seen = 0;
+
+    for (int n = 0; n < CMIMG_METRICS_BUCKETS; ++n)
+    {
+        seen += hist[n];
+        if (seen >= rank && seen > 0)
+            return 1ull << n;
+    }
+
+    return 0;
+}
+
+static void export_sample(void)
+{
+    static char line[LINE_SIZE];
+    size_t len = 0;
+
+    uint64_t now = cm_now_ns();
+    double dt = (now - Sink.last.time) / 1e9;
+    uint64_t sim = get(&Rx.simLast);
+    uint64_t wallFirst = get(&Rx.wallFirst);
+
+    if (dt <= 0.0)
+        dt = 1e-9;
+
+    struct timespec wall;
+    timespec_get(&wall, TIME_UTC);
+
+    append(line, &len, "{\"time\":%lld.%03ld,\"period\":%.3f", (long long)wall.tv_sec, wall.tv_nsec / 1000000, dt);
+
+    if (wallFirst != 0)
+    {
+        // positive lag: the simulation runs behind wall clock time
+        double lag = ((double)(get(&Rx.wallLast) - wallFirst) / 1e3
+                    - (double)(sim - get(&Rx.simFirst))) / 1e3;
+        double rate = (sim >= Sink.last.simTime) ? (sim - Sink.last.simTime) / 1e6 / dt : 0.0;
+
+        append(line, &len, ",\"sim_time\":%.3f,\"sim_rate\":%.3f,\"sim_lag_ms\":%.1f", sim / 1e6, rate, lag);
+    }
+
+    append(line, &len, ",\"channels\":[");
+
+    bool first = true;
+    for (int ch = 0; ch < CMIMG_METRICS_CHANNELS; ++ch)
+    {
+        unsigned long long received = get(&Rx.frames[ch]);
+        unsigned long long receivedBytes = get(&Rx.bytes[ch]);
+        unsigned long long published = get(&Pub.frames[ch]);
+        unsigned long long publishedBytes = get(&Pub.bytes[ch]);
+        unsigned long long dropped = get(&Drop.frames[ch]);
+        unsigned long long hist[CMIMG_METRICS_BUCKETS], samples = 0;
+
+        if (received == 0 && dropped == 0)
+            continue;
+
+        for (int n = 0; n < CMIMG_METRICS_BUCKETS; ++n)
+        {
+            unsigned long long count = get(&Pub.histogram[ch][n]);
+            hist[n] = count - Sink.last.histogram[ch][n];
+            Sink.last.histogram[ch][n] = count;
+            samples += hist[n];
+        }
+
+        append(line, &len, "%s{\"channel\":%d,\"received\":%llu,\"dropped\":%llu,\"published\":%llu"
+                           ",\"rx_fps\":%.2f,\"pub_fps\":%.2f,\"rx_MiBps\":%.3f,\"pub_MiBps\":%.3f",
+               first ? "" : ",", ch, received, dropped, published,
+               (received - Sink.last.received[ch]) / dt,
+               (published - Sink.last.published[ch]) / dt,
+               (receivedBytes - Sink.last.receivedBytes[ch]) / dt / (1024.0 * 1024.0),
+               (publishedBytes - Sink.last.publishedBytes[ch]) / dt / (1024.0 * 1024.0));
+
+        // bucket bounds overshoot, the exact maximum caps them
+        unsigned long long max = get(&Pub.latencyMax[ch]);
+        unsigned long long p50 = percentile(hist, samples, 0.50);
+        unsigned long long p90 = percentile(hist, samples, 0.90);
+        unsigned long long p99 = percentile(hist, samples, 0.99);
+
+        append(line, &len, ",\"latency_us\":{\"p50\":%llu,\"p90\":%llu,\"p99\":%llu,\"max\":%llu},\"histogram\":[",
+               p50 < max ? p50 : max, p90 < max ? p90 : max, p99 < max ? p99 : max, max);
+
+        for (int n = 0; n < CMIMG_METRICS_BUCKETS; ++n)
+            append(line, &len, n ? ",%llu" : "%llu", hist[n]);
+
+        append(line, &len, "]}");
+
+        atomic_store_explicit(&Pub.latencyMax[ch], 0, memory_order_relaxed);
+        Sink.last.received[ch] = received;
+        Sink.last.receivedBytes[ch] = receivedBytes;
+        Sink.last.published[ch] = published;
+        Sink.last.publishedBytes[ch] = publishedBytes;
+        first = false;
+    }
+
+    append(line, &len, "]}\n");
+
+    Sink.last.time = now;
+    Sink.last.simTime = sim;
+
+    if (Sink.file != NULL)
+    {
+        fputs(line, Sink.file);
+        fflush(Sink.file);
+    }
+    if (Sink.sock >= 0)
+    {
+        // best effort, a missing listener must not stall the main loop
+        #if WIN32
+            send(Sink.sock, line, (int)len, 0);
+        #else
+            send(Sink.sock, line, len, MSG_DONTWAIT);
+        #endif
+    }
+}
+
+static void append(char *buf, size_t *len, const char *fmt, ...)
+{
+    va_list args;
+
+    if (*len >= LINE_SIZE)
+        return;
+
+    va_start(args, fmt);
+    int n = vsnprintf(buf + *len, LINE_SIZE - *len, fmt, args);
+    va_end(args);
+
+    if (n > 0)
+        *len = (*len + (size_t)n < LINE_SIZE) ? *len + (size_t)n : LINE_SIZE - 1;
+}
@@ -0,0 +1,78 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmimg_metrics.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - Pipeline Metrics
+**
+***************************************************************/
+
+#ifndef CMIMG_METRICS_H
+#define CMIMG_METRICS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define CMIMG_METRICS_CHANNELS (8)
+
+/* latency histogram: bucket n counts latencies below 2^n microseconds */
+#define CMIMG_METRICS_BUCKETS (24)
+
+#define CMIMG_METRICS_DEFAULT_PERIOD_MS (1000)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+/*
+ * Counters are split by the thread that writes them, so every counter
+ * has a single writer and updating it is a plain relaxed store.
+ */
+
+/* receive thread: a complete frame came off the socket */
+void cmimg_metrics_received(int channel, size_t bytes, float simTime);
+
+/* any thread: a frame was thrown away before it got published */
+void cmimg_metrics_dropped(int channel);
+
+/* transmit thread: a frame went out through XIF, received is its cm_now_ns() stamp */
+void cmimg_metrics_published(int channel, size_t bytes, uint64_t received);
+
+/*
+ * Start exporting to sink every period_ms: a file path (one JSON object
+ * per line, appended) or udp:<host>:<port> (one JSON object per datagram).
+ */
+int cmimg_metrics_open(const char *sink, int period_ms);
+
+/* main loop: write a sample if the period is over */
+void cmimg_metrics_poll(void);
+
+/* write a last sample and close the sink */
+void cmimg_metrics_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMIMG_METRICS_H */
@@ -0,0 +1,207 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmimg_pool.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - Frame Slot Pool
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmimg_pool.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if WIN32
+    #include <malloc.h>
+#endif
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define ROUND_UP(x, a) ((((x) + (a) - 1) / (a)) * (a))
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static int frame_alloc(cmimg_frame_t *frame, size_t size);
+static void frame_free(cmimg_frame_t *frame);
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmimg_pool_init(cmimg_pool_t *pool, int depth)
+{
+    if (depth < 1 || depth > CMIMG_POOL_MAX_DEPTH)
+    {
+        fprintf(stderr, "cmimg_pool: invalid depth %d (1..%d)\n", depth, CMIMG_POOL_MAX_DEPTH);
+        return -1;
+    }
+
+    memset(pool->frames, 0, sizeof(pool->frames));
+
+    for (int i = 0; i < depth; ++i)
+    {
+        pool->frames[i].index = i;
+    }
+
+    pool->depth = depth;
+    pool->frame_size = 0;
+
+    unsigned int mask = (depth == 32) ? 0xFFFFFFFFu : ((1u << depth) - 1u);
+    atomic_init(&pool->free_mask, mask);
+
+    return 0;
+}
+
+void cmimg_pool_free(cmimg_pool_t *pool)
+{
+    for (int i = 0; i < pool->depth; ++i)
+    {
+        frame_free(&pool->frames[i]);
+
+        free(pool->frames[i].encoded);
+        pool->frames[i].encoded = NULL;
+        pool->frames[i].encoded_capacity = 0;
+    }
+
+    pool->depth = 0;
+    pool->frame_size = 0;
+    atomic_store(&pool->free_mask, 0u);
+}
+
+int cmimg_pool_reserve(cmimg_pool_t *pool, size_t size)
+{
+    if (size == pool->frame_size)
+    {
+        return 0;
+    }
+
+    pool->frame_size = size;
+
+    /* slots currently held by the main loop are grown on their next acquire */
+    unsigned int mask = atomic_load_explicit(&pool->free_mask, memory_order_acquire);
+
+    for (int i = 0; i < pool->depth; ++i)
+    {
+        if ((mask & (1u << i)) && pool->frames[i].capacity < size)
+        {
+            if (frame_alloc(&pool->frames[i], size) != 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+cmimg_frame_t *cmimg_pool_acquire(cmimg_pool_t *pool, size_t size)
+{
+    unsigned int mask = atomic_load_explicit(&pool->free_mask, memory_order_acquire);
+
+    if (mask == 0)
+    {
+        return NULL;
+    }
+
+    /* only the receive thread clears bits, so the lowest free slot stays ours */
+    int index = 0;
+    while (!(mask & (1u << index)))
+    {
+        ++index;
+    }
+
+    atomic_fetch_and_explicit(&pool->free_mask, ~(1u << index), memory_order_acq_rel);
+
+    cmimg_frame_t *frame = &pool->frames[index];
+
+    if (frame->capacity < size && frame_alloc(frame, size) != 0)
+    {
+        cmimg_pool_release(pool, frame);
+        return NULL;
+    }
+
+    frame->size = 0;
+    frame->encoding = 0;
+    frame->encoded_size = 0;
+
+    return frame;
+}
+
+void cmimg_pool_release(cmimg_pool_t *pool, cmimg_frame_t *frame)
+{
+    if (frame == NULL)
+    {
+        return;
+    }
+
+    atomic_fetch_or_explicit(&pool->free_mask, 1u << frame->index, memory_order_release);
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static int frame_alloc(cmimg_frame_t *frame, size_t size)
+{
+    size_t capacity = ROUND_UP(size, CMIMG_POOL_ALIGNMENT);
+    void *data = NULL;
+
+    frame_free(frame);
+
+    #if WIN32
+        data = _aligned_malloc(CMIMG_POOL_HEADROOM + capacity, CMIMG_POOL_ALIGNMENT);
+    #else
+        if (posix_memalign(&data, CMIMG_POOL_ALIGNMENT, CMIMG_POOL_HEADROOM + capacity) != 0)
+        {
+            data = NULL;
+        }
+    #endif
+
+    if (data == NULL)
+    {
+        fprintf(stderr, "cmimg_pool: failed to allocate %zu byte slot\n", capacity);
+        return -1;
+    }
+
+    frame->data = (uint8_t *)data + CMIMG_POOL_HEADROOM;
+    frame->capacity = capacity;
+
+    return 0;
+}
+
+static void frame_free(cmimg_frame_t *frame)
+{
+    if (frame->data != NULL)
+    {
+        #if WIN32
+            _aligned_free(frame->data - CMIMG_POOL_HEADROOM);
+        #else
+            free(frame->data - CMIMG_POOL_HEADROOM);
+        #endif
+    }
+
+    frame->data = NULL;
+    frame->capacity = 0;
+}
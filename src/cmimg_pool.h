@@ -0,0 +1,98 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmimg_pool.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - Frame Slot Pool
+**
+***************************************************************/
+
+#ifndef CMIMG_POOL_H
+#define CMIMG_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define CMIMG_POOL_MAX_DEPTH     (32)
+#define CMIMG_POOL_DEFAULT_DEPTH (4)
+#define CMIMG_POOL_ALIGNMENT     (4096)
+#define CMIMG_POOL_HEADROOM      (CMIMG_POOL_ALIGNMENT) // free bytes in front of data, for a publish header
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/* one image slot, owned either by the receive thread or the main loop */
+typedef struct
+{
+    uint8_t *data;
+    size_t capacity;
+    size_t size;
+
+    int index;
+    int channel;
+    int width;
+    int height;
+    int channels;  // after conversion
+    int elem_size; // bytes per channel value after conversion
+    char type[32];
+    uint64_t timestamp;
+    uint64_t received; // monotonic ns when the payload was complete
+
+    /* compressed copy of data, filled by the encoder workers */
+    int encoding; // cmimg_encoding_t, 0 -> publish data as is
+    uint8_t *encoded;
+    size_t encoded_capacity;
+    size_t encoded_size;
+} cmimg_frame_t;
+
+typedef struct
+{
+    cmimg_frame_t frames[CMIMG_POOL_MAX_DEPTH];
+    int depth;
+    size_t frame_size;
+
+    /* bit n set -> frames[n] is free to be filled by the receive thread */
+    atomic_uint free_mask;
+} cmimg_pool_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+int cmimg_pool_init(cmimg_pool_t *pool, int depth);
+
+void cmimg_pool_free(cmimg_pool_t *pool);
+
+/* receive thread: size all free slots for frames of size bytes */
+int cmimg_pool_reserve(cmimg_pool_t *pool, size_t size);
+
+/* receive thread: take a free slot able to hold size bytes, NULL if none left */
+cmimg_frame_t *cmimg_pool_acquire(cmimg_pool_t *pool, size_t size);
+
+/* either side: hand a slot back to the pool */
+void cmimg_pool_release(cmimg_pool_t *pool, cmimg_frame_t *frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMIMG_POOL_H */
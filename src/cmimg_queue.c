@@ -0,0 +1,131 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmimg_queue.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - SPSC Frame Queue
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmimg_queue.h"
+
+#include <stdio.h>
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/* entries[] is indexed modulo the max depth so the counters may wrap */
+#define SLOT(i) ((i) % CMIMG_QUEUE_MAX_DEPTH)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmimg_queue_init(cmimg_queue_t *queue, int depth, cm_drop_policy_t policy)
+{
+    if (depth < 1 || depth > CMIMG_QUEUE_MAX_DEPTH)
+    {
+        fprintf(stderr, "cmimg_queue: invalid depth %d (1..%d)\n", depth, CMIMG_QUEUE_MAX_DEPTH);
+        return -1;
+    }
+
+    for (int i = 0; i < CMIMG_QUEUE_MAX_DEPTH; ++i)
+    {
+        atomic_init(&queue->entries[i], NULL);
+    }
+
+    queue->depth = (unsigned int)depth;
+    queue->policy = policy;
+
+    atomic_init(&queue->head, 0u);
+    atomic_init(&queue->tail, 0u);
+
+    return 0;
+}
+
+cmimg_frame_t *cmimg_queue_push(cmimg_queue_t *queue, cmimg_frame_t *frame)
+{
+    cmimg_frame_t *dropped = NULL;
+
+    unsigned int tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+    if (tail - head >= queue->depth)
+    {
+        if (queue->policy == CM_DROP_NEWEST)
+        {
+            return frame;
+        }
+
+        /* evict the oldest entry; if the consumer got there first there is room anyway */
+        cmimg_frame_t *oldest = atomic_load_explicit(&queue->entries[SLOT(head)], memory_order_relaxed);
+
+        if (atomic_compare_exchange_strong_explicit(&queue->head, &head, head + 1,
+                                                    memory_order_acq_rel, memory_order_acquire))
+        {
+            dropped = oldest;
+        }
+    }
+
+    atomic_store_explicit(&queue->entries[SLOT(tail)], frame, memory_order_relaxed);
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+    return dropped;
+}
+
+cmimg_frame_t *cmimg_queue_pop(cmimg_queue_t *queue)
+{
+    unsigned int head = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+    /* a failed exchange means the producer evicted head; it can do so at most once per push */
+    for (;;)
+    {
+        unsigned int tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+        if (head == tail)
+        {
+            return NULL;
+        }
+
+        cmimg_frame_t *frame = atomic_load_explicit(&queue->entries[SLOT(head)], memory_order_relaxed);
+
+        if (atomic_compare_exchange_weak_explicit(&queue->head, &head, head + 1,
+                                                  memory_order_acq_rel, memory_order_acquire))
+        {
+            return frame;
+        }
+    }
+}
+
+unsigned int cmimg_queue_count(cmimg_queue_t *queue)
+{
+    unsigned int tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    unsigned int head = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+    return tail - head;
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
@@ -0,0 +1,78 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmimg_queue.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - SPSC Frame Queue
+**
+***************************************************************/
+
+#ifndef CMIMG_QUEUE_H
+#define CMIMG_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "cm_thread.h"
+#include "cmimg_pool.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define CMIMG_QUEUE_MAX_DEPTH     (16)
+#define CMIMG_QUEUE_DEFAULT_DEPTH (2)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/*
+ * Single producer (receive thread), single consumer (main loop).
+ * head and tail are free-running counters; the producer may also
+ * advance head to evict the oldest frame, which is why the consumer
+ * claims entries with a compare-exchange instead of a plain store.
+ */
+typedef struct
+{
+    _Alignas(64) atomic_uint head;
+    _Alignas(64) atomic_uint tail;
+
+    _Alignas(64) _Atomic(cmimg_frame_t *) entries[CMIMG_QUEUE_MAX_DEPTH];
+    unsigned int depth;
+    cm_drop_policy_t policy;
+} cmimg_queue_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+int cmimg_queue_init(cmimg_queue_t *queue, int depth, cm_drop_policy_t policy);
+
+/* producer: enqueue frame; a frame dropped by the policy is returned, NULL otherwise */
+cmimg_frame_t *cmimg_queue_push(cmimg_queue_t *queue, cmimg_frame_t *frame);
+
+/* consumer: dequeue the oldest frame without blocking, NULL if empty */
+cmimg_frame_t *cmimg_queue_pop(cmimg_queue_t *queue);
+
+unsigned int cmimg_queue_count(cmimg_queue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMIMG_QUEUE_H */
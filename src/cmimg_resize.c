@@ -0,0 +1,351 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmimg_resize.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - ROI Crop and Downscale
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmimg_resize.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #define CMIMG_RESIZE_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define CLAMP(v, lo, hi) ((v) < (lo) ? (lo) : ((v) > (hi) ? (hi) : (v)))
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static void box_u8(cmimg_resize_t *r, const cmimg_frame_t *src, uint8_t *out);
+static void bilinear_u8(cmimg_resize_t *r, const cmimg_frame_t *src, uint8_t *out);
+static void nearest_u16(cmimg_resize_t *r, const cmimg_frame_t *src, uint16_t *out);
+
+static void rows_accumulate(uint32_t *acc, const uint8_t *row, size_t n);
+static void rows_blend(uint16_t *line, const uint8_t *a, const uint8_t *b, size_t n, unsigned int fy);
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+bool cmimg_resize_enabled(const cmimg_resize_cfg_t *cfg)
+{
+    return cfg->crop_x > 0 || cfg->crop_y > 0 || cfg->crop_w > 0 || cfg->crop_h > 0
+        || cfg->out_w > 0 || cfg->out_h > 0 || cfg->scale > 1;
+}
+
+void cmimg_resize_init(cmimg_resize_t *resize, const cmimg_resize_cfg_t *cfg)
+{
+    memset(resize, 0, sizeof(*resize));
+    resize->cfg = *cfg;
+}
+
+void cmimg_resize_free(cmimg_resize_t *resize)
+{
+    free(resize->xofs);
+    free(resize->xw);
+    free(resize->acc);
+    free(resize->line);
+
+    cmimg_resize_init(resize, &resize->cfg);
+}
+
+size_t cmimg_resize_prepare(cmimg_resize_t *resize, const cmimg_frame_t *src)
+{
+    const cmimg_resize_cfg_t *cfg = &resize->cfg;
+
+    if (src->width <= 0 || src->height <= 0 || src->channels <= 0
+     || (src->elem_size != 1 && src->elem_size != 2))
+    {
+        return 0;
+    }
+
+    if (src->width == resize->in_w && src->height == resize->in_h
+     && src->channels == resize->channels && src->elem_size == resize->elem_size)
+    {
+        return (size_t)resize->ow * resize->oh * resize->channels * resize->elem_size;
+    }
+
+    int cx = CLAMP(cfg->crop_x, 0, src->width - 1);
+    int cy = CLAMP(cfg->crop_y, 0, src->height - 1);
+    int cw = (cfg->crop_w > 0) ? CLAMP(cfg->crop_w, 1, src->width - cx) : src->width - cx;
+    int ch = (cfg->crop_h > 0) ? CLAMP(cfg->crop_h, 1, src->height - cy) : src->height - cy;
+    int scale = (cfg->scale > 1) ? cfg->scale : 1;
+    int ow, oh;
+
+    // a single given dimension keeps the aspect ratio of the ROI
+    if (cfg->out_w > 0 && cfg->out_h > 0)
+    {
+        ow = cfg->out_w;
+        oh = cfg->out_h;
+    }
+    else if (cfg->out_w > 0)
+    {
+        ow = cfg->out_w;
+        oh = (int)((long long)ch * ow / cw);
+    }
+    else if (cfg->out_h > 0)
+    {
+        oh = cfg->out_h;
+        ow = (int)((long long)cw * oh / ch);
+    }
+    else
+    {
+        ow = cw / scale;
+        oh = ch / scale;
+    }
+
+    ow = (ow > 0) ? ow : 1;
+    oh = (oh > 0) ? oh : 1;
+
+    size_t n = (size_t)cw * src->channels;
+    int *xofs = realloc(resize->xofs, (ow + 1) * sizeof(int));
+    uint16_t *xw = realloc(resize->xw, ow * sizeof(uint16_t));
+    uint32_t *acc = realloc(resize->acc, n * sizeof(uint32_t));
+    uint16_t *line = realloc(resize->line, n * sizeof(uint16_t));
+
+    if (xofs) resize->xofs = xofs;
+    if (xw) resize->xw = xw;
+    if (acc) resize->acc = acc;
+    if (line) resize->line = line;
+
+    if (!xofs || !xw || !acc || !line)
+    {
+        fprintf(stderr, "cmimg_resize: failed to allocate line buffers for %d pixels\n", cw);
+        resize->in_w = 0;
+        return 0;
+    }
+
+    for (int x = 0; x < ow; ++x)
+    {
+        if (src->elem_size == 2)
+        {
+            // nearest, centred: blending depth across object edges invents surfaces
+            xofs[x] = (int)(((2LL * x + 1) * cw) / (2LL * ow));
+            xw[x] = 0;
+        }
+        else if (cfg->filter == CMIMG_FILTER_BILINEAR)
+        {
+            double sx = (x + 0.5) * cw / ow - 0.5;
+            int x0 = (sx > 0.0) ? (int)sx : 0;
+            if (x0 > cw - 1)
+                x0 = cw - 1;
+            double fx = sx - x0;
+            xofs[x] = x0;
+            xw[x] = (uint16_t)(CLAMP(fx, 0.0, 1.0) * 256.0 + 0.5);
+        }
+        else
+        {
+            xofs[x] = (int)((long long)x * cw / ow);
+            xw[x] = 0;
+        }
+    }
+    xofs[ow] = cw;
+
+    resize->in_w = src->width;
+    resize->in_h = src->height;
+    resize->channels = src->channels;
+    resize->elem_size = src->elem_size;
+    resize->cx = cx;
+    resize->cy = cy;
+    resize->cw = cw;
+    resize->ch = ch;
+    resize->ow = ow;
+    resize->oh = oh;
+
+    return (size_t)ow * oh * src->channels * src->elem_size;
+}
+
+void cmimg_resize_frame(cmimg_resize_t *resize, const cmimg_frame_t *src, cmimg_frame_t *dst)
+{
+    if (resize->elem_size == 2)
+        nearest_u16(resize, src, (uint16_t *)dst->data);
+    else if (resize->cfg.filter == CMIMG_FILTER_BILINEAR)
+        bilinear_u8(resize, src, dst->data);
+    else
+        box_u8(resize, src, dst->data);
+
+    dst->channel = src->channel;
+    dst->width = resize->ow;
+    dst->height = resize->oh;
+    dst->channels = resize->channels;
+    dst->elem_size = resize->elem_size;
+    dst->size = (size_t)resize->ow * resize->oh * resize->channels * resize->elem_size;
+    dst->timestamp = src->timestamp;
+    dst->received = src->received;
+    memcpy(dst->type, src->type, sizeof(dst->type));
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static void box_u8(cmimg_resize_t *r, const cmimg_frame_t *src, uint8_t *out)
+{
+    const int c = r->channels;
+    const size_t stride = (size_t)r->in_w * c;
+    const size_t n = (size_t)r->cw * c;
+    const uint8_t *base = src->data + (size_t)r->cy * stride + (size_t)r->cx * c;
+
+    for (int y = 0; y < r->oh; ++y)
+    {
+        int y0 = (int)((long long)y * r->ch / r->oh);
+        int y1 = (int)((long long)(y + 1) * r->ch / r->oh);
+        if (y1 <= y0)
+            y1 = y0 + 1;
+
+        // the vertical pass touches every source byte and is vectorised,
+        // the horizontal one only runs over the summed line
+        memset(r->acc, 0, n * sizeof(uint32_t));
+        for (int sy = y0; sy < y1; ++sy)
+            rows_accumulate(r->acc, base + (size_t)sy * stride, n);
+
+        for (int x = 0; x < r->ow; ++x)
+        {
+            int x0 = r->xofs[x];
+            int x1 = (r->xofs[x + 1] > x0) ? r->xofs[x + 1] : x0 + 1;
+            uint32_t count = (uint32_t)(x1 - x0) * (uint32_t)(y1 - y0);
+
+            for (int k = 0; k < c; ++k)
+            {
+                uint32_t sum = 0;
+                for (int sx = x0; sx < x1; ++sx)
+                    sum += r->acc[sx * c + k];
+                *out++ = (uint8_t)((sum + count / 2) / count);
+            }
+        }
+    }
+}
+
+static void bilinear_u8(cmimg_resize_t *r, const cmimg_frame_t *src, uint8_t *out)
+{
+    const int c = r->channels;
+    const size_t stride = (size_t)r->in_w * c;
+    const size_t n = (size_t)r->cw * c;
+    const uint8_t *base = src->data + (size_t)r->cy * stride + (size_t)r->cx * c;
+
+    for (int y = 0; y < r->oh; ++y)
+    {
+        double sy = (y + 0.5) * r->ch / r->oh - 0.5;
+        int y0 = (sy > 0.0) ? (int)sy : 0;
+        if (y0 > r->ch - 1)
+            y0 = r->ch - 1;
+        int y1 = (y0 < r->ch - 1) ? y0 + 1 : y0;
+        double fy = CLAMP(sy - y0, 0.0, 1.0);
+
+        rows_blend(r->line, base + (size_t)y0 * stride, base + (size_t)y1 * stride, n,
+                   (unsigned int)(fy * 256.0 + 0.5));
+
+        for (int x = 0; x < r->ow; ++x)
+        {
+            int x0 = r->xofs[x];
+            int x1 = (x0 < r->cw - 1) ? x0 + 1 : x0;
+            uint32_t fx = r->xw[x];
+
+            for (int k = 0; k < c; ++k)
+            {
+                uint32_t v = r->line[x0 * c + k] * (256u - fx) + r->line[x1 * c + k] * fx;
+                *out++ = (uint8_t)((v + 32768u) >> 16);
+            }
+        }
+    }
+}
+
+static void nearest_u16(cmimg_resize_t *r, const cmimg_frame_t *src, uint16_t *out)
+{
+    const int c = r->channels;
+    const uint16_t *base = (const uint16_t *)src->data;
+
+    for (int y = 0; y < r->oh; ++y)
+    {
+        int sy = r->cy + (int)(((2LL * y + 1) * r->ch) / (2LL * r->oh));
+        const uint16_t *row = base + ((size_t)sy * r->in_w + r->cx) * c;
+
+        for (int x = 0; x < r->ow; ++x)
+        {
+            memcpy(out, row + (size_t)r->xofs[x] * c, c * sizeof(uint16_t));
+            out += c;
+        }
+    }
+}
+
+/* acc[i] += row[i] */
+static void rows_accumulate(uint32_t *acc, const uint8_t *row, size_t n)
+{
+    size_t i = 0;
+
+    #if CMIMG_RESIZE_SSE2
+        const __m128i zero = _mm_setzero_si128();
+
+        for (; i + 16 <= n; i += 16)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i *)(row + i));
+            __m128i lo = _mm_unpacklo_epi8(v, zero);
+            __m128i hi = _mm_unpackhi_epi8(v, zero);
+            __m128i *a = (__m128i *)(acc + i);
+
+            _mm_storeu_si128(a + 0, _mm_add_epi32(_mm_loadu_si128(a + 0), _mm_unpacklo_epi16(lo, zero)));
+            _mm_storeu_si128(a + 1, _mm_add_epi32(_mm_loadu_si128(a + 1), _mm_unpackhi_epi16(lo, zero)));
+            _mm_storeu_si128(a + 2, _mm_add_epi32(_mm_loadu_si128(a + 2), _mm_unpacklo_epi16(hi, zero)));
+            _mm_storeu_si128(a + 3, _mm_add_epi32(_mm_loadu_si128(a + 3), _mm_unpackhi_epi16(hi, zero)));
+        }
+    #endif
+
+    for (; i < n; ++i)
+        acc[i] += row[i];
+}
+
+/* line[i] = a[i] * (256 - fy) + b[i] * fy, at most 255 * 256 so it fits 16 bits */
+static void rows_blend(uint16_t *line, const uint8_t *a, const uint8_t *b, size_t n, unsigned int fy)
+{
+    size_t i = 0;
+
+    #if CMIMG_RESIZE_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i wa = _mm_set1_epi16((short)(256 - fy));
+        const __m128i wb = _mm_set1_epi16((short)fy);
+
+        for (; i + 16 <= n; i += 16)
+        {
+            __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+            __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+            __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(va, zero), wa),
+                                       _mm_mullo_epi16(_mm_unpacklo_epi8(vb, zero), wb));
+            __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(va, zero), wa),
+                                       _mm_mullo_epi16(_mm_unpackhi_epi8(vb, zero), wb));
+
+            _mm_storeu_si128((__m128i *)(line + i), lo);
+            _mm_storeu_si128((__m128i *)(line + i + 8), hi);
+        }
+    #endif
+
+    for (; i < n; ++i)
+        line[i] = (uint16_t)(a[i] * (256u - fy) + b[i] * fy);
+}
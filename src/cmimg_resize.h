@@ -0,0 +1,99 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmimg_resize.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - ROI Crop and Downscale
+**
+***************************************************************/
+
+#ifndef CMIMG_RESIZE_H
+#define CMIMG_RESIZE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "cmimg_pool.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef enum
+{
+    CMIMG_FILTER_BOX = 0, // area average, the right choice for downscaling
+    CMIMG_FILTER_BILINEAR,
+} cmimg_filter_t;
+
+typedef struct
+{
+    /* region of interest in source pixels, w or h of 0 -> up to the image border */
+    int crop_x;
+    int crop_y;
+    int crop_w;
+    int crop_h;
+
+    /* output size; 0 -> derived from the ROI, divided by scale */
+    int out_w;
+    int out_h;
+    int scale;
+
+    cmimg_filter_t filter;
+} cmimg_resize_cfg_t;
+
+/* per channel state; tables and line buffers are kept until the geometry changes */
+typedef struct
+{
+    cmimg_resize_cfg_t cfg;
+
+    int in_w, in_h, channels, elem_size;
+    int cx, cy, cw, ch;
+    int ow, oh;
+
+    int *xofs;      // first source column per output column
+    uint16_t *xw;   // bilinear weight of the right neighbour, 0..256
+    uint32_t *acc;  // box: column sums of the current output row
+    uint16_t *line; // bilinear: vertically blended row, 8.8 fixed point
+} cmimg_resize_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+bool cmimg_resize_enabled(const cmimg_resize_cfg_t *cfg);
+
+void cmimg_resize_init(cmimg_resize_t *resize, const cmimg_resize_cfg_t *cfg);
+
+void cmimg_resize_free(cmimg_resize_t *resize);
+
+/*
+ * Work out the output geometry of a (converted) frame and size the
+ * line buffers for it. Returns the output size in bytes, 0 on failure.
+ */
+size_t cmimg_resize_prepare(cmimg_resize_t *resize, const cmimg_frame_t *src);
+
+/* crop and scale src into dst, dst must hold cmimg_resize_prepare() bytes */
+void cmimg_resize_frame(cmimg_resize_t *resize, const cmimg_frame_t *src, cmimg_frame_t *dst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMIMG_RESIZE_H */
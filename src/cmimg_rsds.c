@@ -0,0 +1,421 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmimg_rsds.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - RSDS Stream Parser
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmimg_rsds.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if WIN32
+    #include <winsock2.h>
+#else
+    #include <sys/types.h>
+    #include <sys/socket.h>
+    #include <sys/uio.h>
+#endif
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define MAX_TOKENS (8)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static size_t window_peek(const cmimg_rsds_stream_t *stream, char *dst, size_t len);
+static int tokenize(char *hdr, char **tokens);
+static bool parse_uint(const char *s, unsigned int *out);
+static bool parse_int(const char *s, int *out);
+static bool parse_float(const char *s, float *out);
+static bool parse_size(const char *s, int *width, int *height);
+static void copy_token(char *dst, size_t size, const char *src);
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmimg_rsds_init(cmimg_rsds_stream_t *stream, size_t size)
+{
+    // the ring arithmetic masks offsets, so the window has to be a power of two
+    if (size < 2 * CMIMG_RSDS_HDR_SIZE || (size & (size - 1)) != 0)
+    {
+        fprintf(stderr, "cmimg_rsds: window size %zu is not a power of two\n", size);
+        return -1;
+    }
+
+    stream->buf = malloc(size);
+    if (stream->buf == NULL)
+    {
+        fprintf(stderr, "cmimg_rsds: failed to allocate %zu byte window\n", size);
+        return -1;
+    }
+
+    stream->size = size;
+    cmimg_rsds_reset(stream);
+    stream->nReads = 0;
+
+    return 0;
+}
+
+void cmimg_rsds_free(cmimg_rsds_stream_t *stream)
+{
+    free(stream->buf);
+    stream->buf = NULL;
+    stream->size = 0;
+}
+
+void cmimg_rsds_reset(cmimg_rsds_stream_t *stream)
+{
+    stream->rd = 0;
+    stream->wr = 0;
+    stream->skipped = 0;
+}
+
+size_t cmimg_rsds_avail(const cmimg_rsds_stream_t *stream)
+{
+    return stream->wr - stream->rd;
+}
+
+int cmimg_rsds_fill(cmimg_rsds_stream_t *stream, int sock, void *direct, size_t directLen, size_t *directGot)
+{
+    size_t mask = stream->size - 1;
+    size_t space = stream->size - cmimg_rsds_avail(stream);
+    size_t offset = stream->wr & mask;
+    size_t first = (space < stream->size - offset) ? space : stream->size - offset;
+
+    if (directGot != NULL)
+    {
+        *directGot = 0;
+    }
+
+    if (direct == NULL)
+    {
+        directLen = 0;
+    }
+
+    #if WIN32
+        // no readv() on Winsock; read into whichever target comes first
+        char *target = (directLen > 0) ? (char *)direct : stream->buf + offset;
+        size_t targetLen = (directLen > 0) ? directLen : first;
+        int res = recv(sock, target, (int)targetLen, 0);
+        if (res > 0 && directLen == 0)
+        {
+            stream->wr += res;
+        }
+        else if (res > 0 && directGot != NULL)
+        {
+            *directGot = (size_t)res;
+        }
+    #else
+        struct iovec iov[3];
+        int iovcnt = 0;
+
+        if (directLen > 0)
+        {
+            iov[iovcnt].iov_base = direct;
+            iov[iovcnt].iov_len = directLen;
+            iovcnt++;
+        }
+        if (first > 0)
+        {
+            iov[iovcnt].iov_base = stream->buf + offset;
+            iov[iovcnt].iov_len = first;
+            iovcnt++;
+        }
+        if (space > first)
+        {
+            iov[iovcnt].iov_base = stream->buf;
+            iov[iovcnt].iov_len = space - first;
+            iovcnt++;
+        }
+
+        ssize_t res = readv(sock, iov, iovcnt);
+        if (res > 0)
+        {
+            size_t toDirect = ((size_t)res < directLen) ? (size_t)res : directLen;
+            if (directGot != NULL)
+            {
+                *directGot = toDirect;
+            }
+            stream->wr += (size_t)res - toDirect;
+        }
+    #endif
+
+    stream->nReads++;
+
+    return (res < 0) ? -1 : (int)res;
+}
+
+bool cmimg_rsds_next_header(cmimg_rsds_stream_t *stream, char hdr[CMIMG_RSDS_HDR_SIZE + 1])
+{
+    size_t mask = stream->size - 1;
+
+    for (;;)
+    {
+        size_t avail = cmimg_rsds_avail(stream);
+
+        if (avail == 0)
+        {
+            return false;
+        }
+
+        // resync: jump straight to the next '*' instead of shifting byte by byte
+        if (stream->buf[stream->rd & mask] != '*')
+        {
+            size_t offset = stream->rd & mask;
+            size_t first = (avail < stream->size - offset) ? avail : stream->size - offset;
+            const char *hit = memchr(stream->buf + offset, '*', first);
+
+            if (hit == NULL && avail > first)
+            {
+                hit = memchr(stream->buf, '*', avail - first);
+                if (hit != NULL)
+                {
+                    size_t skip = first + (size_t)(hit - stream->buf);
+                    stream->rd += skip;
+                    stream->skipped += skip;
+                }
+            }
+            else if (hit != NULL)
+            {
+                size_t skip = (size_t)(hit - (stream->buf + offset));
+                stream->rd += skip;
+                stream->skipped += skip;
+            }
+
+            if (hit == NULL)
+            {
+                stream->rd += avail;
+                stream->skipped += avail;
+                return false;
+            }
+
+            continue;
+        }
+
+        if (avail < CMIMG_RSDS_HDR_SIZE)
+        {
+            return false;
+        }
+
+        window_peek(stream, hdr, CMIMG_RSDS_HDR_SIZE);
+
+        if (hdr[1] < 'A' || hdr[1] > 'Z')
+        {
+            stream->rd++;
+            stream->skipped++;
+            continue;
+        }
+
+        stream->rd += CMIMG_RSDS_HDR_SIZE;
+
+        /* remove white spaces at end of line */
+        int len = CMIMG_RSDS_HDR_SIZE;
+        while (len > 0 && hdr[len - 1] <= ' ')
+            len--;
+        hdr[len] = 0;
+
+        return true;
+    }
+}
+
+size_t cmimg_rsds_take(cmimg_rsds_stream_t *stream, void *dst, size_t len)
+{
+    size_t avail = cmimg_rsds_avail(stream);
+    size_t n = (len < avail) ? len : avail;
+
+    if (dst != NULL)
+    {
+        window_peek(stream, dst, n);
+    }
+
+    stream->rd += n;
+
+    return n;
+}
+
+bool cmimg_rsds_parse_header(char *hdr, cmimg_rsds_header_t *out)
+{
+    char *tokens[MAX_TOKENS];
+    int n = tokenize(hdr, tokens);
+
+    out->kind = CMIMG_RSDS_UNKNOWN;
+
+    if (n == 6 && strcmp(tokens[0], "*RSDS") == 0)
+    {
+        if (!parse_int(tokens[1], &out->channel)
+         || !parse_float(tokens[3], &out->sim_time)
+         || !parse_size(tokens[4], &out->width, &out->height)
+         || !parse_uint(tokens[5], &out->length))
+        {
+            return false;
+        }
+        copy_token(out->type, sizeof(out->type), tokens[2]);
+        out->kind = CMIMG_RSDS_IMAGE;
+        return true;
+    }
+
+    if (n == 5 && strcmp(tokens[0], "*RSDSEmbeddedData") == 0)
+    {
+        if (!parse_int(tokens[1], &out->channel)
+         || !parse_float(tokens[2], &out->sim_time)
+         || !parse_uint(tokens[3], &out->length))
+        {
+            return false;
+        }
+        copy_token(out->ani_mode, sizeof(out->ani_mode), tokens[4]);
+        out->kind = CMIMG_RSDS_EMBEDDED;
+        return true;
+    }
+
+    return false;
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static size_t window_peek(const cmimg_rsds_stream_t *stream, char *dst, size_t len)
+{
+    size_t offset = stream->rd & (stream->size - 1);
+    size_t first = (len < stream->size - offset) ? len : stream->size - offset;
+
+    memcpy(dst, stream->buf + offset, first);
+    memcpy(dst + first, stream->buf, len - first);
+
+    return len;
+}
+
+static int tokenize(char *hdr, char **tokens)
+{
+    int n = 0;
+    char *p = hdr;
+
+    while (*p != '\0' && n < MAX_TOKENS)
+    {
+        while (*p == ' ' || *p == '\t')
+            p++;
+        if (*p == '\0')
+            break;
+
+        tokens[n++] = p;
+
+        while (*p != '\0' && *p != ' ' && *p != '\t')
+            p++;
+        if (*p != '\0')
+            *p++ = '\0';
+    }
+
+    return n;
+}
+
+static bool parse_uint(const char *s, unsigned int *out)
+{
+    unsigned int v = 0;
+
+    if (*s < '0' || *s > '9')
+        return false;
+
+    for (; *s >= '0' && *s <= '9'; ++s)
+        v = v * 10u + (unsigned int)(*s - '0');
+
+    *out = v;
+    return *s == '\0';
+}
+
+static bool parse_int(const char *s, int *out)
+{
+    unsigned int v;
+    bool negative = (*s == '-');
+
+    if (!parse_uint(negative ? s + 1 : s, &v))
+        return false;
+
+    *out = negative ? -(int)v : (int)v;
+    return true;
+}
+
+static bool parse_float(const char *s, float *out)
+{
+    // Movie NX sends plain fixed point, e.g. "12.345"; anything fancier goes to strtod
+    const char *p = s;
+    bool negative = (*p == '-');
+    double v = 0.0, scale = 1.0;
+
+    if (negative)
+        p++;
+
+    for (; *p >= '0' && *p <= '9'; ++p)
+        v = v * 10.0 + (*p - '0');
+
+    if (*p == '.')
+    {
+        for (++p; *p >= '0' && *p <= '9'; ++p)
+        {
+            v = v * 10.0 + (*p - '0');
+            scale *= 10.0;
+        }
+    }
+
+    if (*p != '\0')
+    {
+        char *end;
+        v = strtod(s, &end);
+        if (end == s || *end != '\0')
+            return false;
+        *out = (float)v;
+        return true;
+    }
+
+    *out = (float)((negative ? -v : v) / scale);
+    return true;
+}
+
+static bool parse_size(const char *s, int *width, int *height)
+{
+    char buf[32];
+    char *x;
+
+    copy_token(buf, sizeof(buf), s);
+    if ((x = strchr(buf, 'x')) == NULL)
+        return false;
+    *x = '\0';
+
+    return parse_int(buf, width) && parse_int(x + 1, height);
+}
+
+static void copy_token(char *dst, size_t size, const char *src)
+{
+    size_t len = strlen(src);
+
+    if (len >= size)
+        len = size - 1;
+
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
@@ -0,0 +1,104 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmimg_rsds.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - RSDS Stream Parser
+**
+***************************************************************/
+
+#ifndef CMIMG_RSDS_H
+#define CMIMG_RSDS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define CMIMG_RSDS_HDR_SIZE    (64)
+#define CMIMG_RSDS_WINDOW_SIZE (1u << 20)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef enum
+{
+    CMIMG_RSDS_UNKNOWN = 0,
+    CMIMG_RSDS_IMAGE,    // *RSDS <ch> <type> <time> <w>x<h> <len>
+    CMIMG_RSDS_EMBEDDED, // *RSDSEmbeddedData <ch> <time> <len> <animode>
+} cmimg_rsds_kind_t;
+
+typedef struct
+{
+    cmimg_rsds_kind_t kind;
+    int channel;
+    char type[32];
+    float sim_time;
+    int width;
+    int height;
+    unsigned int length;
+    char ani_mode[16];
+} cmimg_rsds_header_t;
+
+/* ring-buffered receive window; rd and wr are free-running byte counters */
+typedef struct
+{
+    char *buf;
+    size_t size;
+    size_t rd;
+    size_t wr;
+    size_t skipped; // bytes thrown away while looking for the next header
+
+    unsigned long long nReads;
+} cmimg_rsds_stream_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+int cmimg_rsds_init(cmimg_rsds_stream_t *stream, size_t size);
+
+void cmimg_rsds_free(cmimg_rsds_stream_t *stream);
+
+void cmimg_rsds_reset(cmimg_rsds_stream_t *stream);
+
+size_t cmimg_rsds_avail(const cmimg_rsds_stream_t *stream);
+
+/*
+ * One read from sock. If direct is given, the socket data lands there
+ * first and only the overflow goes into the window, so a payload and
+ * the headers behind it arrive with a single readv().
+ * Returns bytes read, 0 on orderly close, -1 on error (check errno).
+ */
+int cmimg_rsds_fill(cmimg_rsds_stream_t *stream, int sock, void *direct, size_t directLen, size_t *directGot);
+
+/* extract the next header into hdr (NUL terminated); false if more data is needed */
+bool cmimg_rsds_next_header(cmimg_rsds_stream_t *stream, char hdr[CMIMG_RSDS_HDR_SIZE + 1]);
+
+/* copy up to len buffered bytes to dst, or drop them if dst is NULL */
+size_t cmimg_rsds_take(cmimg_rsds_stream_t *stream, void *dst, size_t len);
+
+/* tokenize an *RSDS or *RSDSEmbeddedData header, modifies hdr */
+bool cmimg_rsds_parse_header(char *hdr, cmimg_rsds_header_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMIMG_RSDS_H */
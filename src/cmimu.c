@@ -0,0 +1,152 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmimu.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker IMU - Sample Batching
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmimu.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cm_util.h"
+#include "cmlog.h"
+#include "cmxif.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define MAX_RATE (1000.0)
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+static struct {
+    double period;      // ms, 0 -> no batching
+    uint64_t start;     // timestamp of the first sample queued
+
+    /* header and samples, transmitted as one blob */
+    uint8_t buffer[CMIMU_HEADER_SIZE + CMIMU_MAX_BATCH * sizeof(cmimu_sample_t)];
+    int count;
+
+    unsigned long messages;
+    unsigned long samples;
+} Imu;
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmimu_init(double rate)
+{
+    memset(&Imu, 0, sizeof(Imu));
+
+    if (!(rate >= 0.0) || rate > MAX_RATE)
+    {
+        fprintf(stderr, "cmimu: flush rate must be between 0 and %g Hz\n", MAX_RATE);
+        return -1;
+    }
+
+    if (rate > 0.0)
+    {
+        Imu.period = 1000.0 / rate;
+        CMLOG(CMLOG_IMU, CMLOG_INFO, "samples batched, flushed at %g Hz", rate);
+    }
+
+    return 0;
+}
+
+void cmimu_add(const xif_imu_t *sample)
+{
+    if (Imu.period == 0.0)
+    {
+        cmxif_imu(*sample);
+        Imu.messages++;
+        Imu.samples++;
+        return;
+    }
+
+    // a new test run starts the clock over, don't mix its samples into the old batch
+    if (Imu.count > 0 && sample->timestamp < Imu.start)
+    {
+        cmimu_flush();
+    }
+
+    if (Imu.count == 0)
+    {
+        Imu.start = sample->timestamp;
+    }
+
+    cmimu_sample_t s;
+    s.timestamp = sample->timestamp;
+    s.orientation[0] = sample->orientation.x;
+    s.orientation[1] = sample->orientation.y;
+    s.orientation[2] = sample->orientation.z;
+    s.angular_velocity[0] = sample->angular_velocity.x;
+    s.angular_velocity[1] = sample->angular_velocity.y;
+    s.angular_velocity[2] = sample->angular_velocity.z;
+    s.linear_acceleration[0] = sample->linear_acceleration.x;
+    s.linear_acceleration[1] = sample->linear_acceleration.y;
+    s.linear_acceleration[2] = sample->linear_acceleration.z;
+    s.reserved = 0.0f;
+
+    memcpy(Imu.buffer + CMIMU_HEADER_SIZE + Imu.count * sizeof(s), &s, sizeof(s));
+    Imu.count++;
+
+    // timestamps are whole ms: flush once the next one would fall outside this period
+    if (Imu.count == CMIMU_MAX_BATCH || (double)(sample->timestamp + 1 - Imu.start) >= Imu.period)
+    {
+        cmimu_flush();
+    }
+}
+
+void cmimu_flush(void)
+{
+    if (Imu.count == 0)
+        return;
+
+    memcpy(Imu.buffer, CMIMU_MAGIC, 4);
+    cm_put_u32(Imu.buffer + 4, (uint32_t)Imu.count);
+    cm_put_u32(Imu.buffer + 8, (uint32_t)sizeof(cmimu_sample_t));
+    cm_put_u32(Imu.buffer + 12, 0);
+
+    uint64_t last;
+    memcpy(&last, Imu.buffer + CMIMU_HEADER_SIZE + (Imu.count - 1) * sizeof(cmimu_sample_t), sizeof(last));
+
+    xif_image_t image;
+    image.timestamp = last;
+    image.width = (int)(CMIMU_HEADER_SIZE + Imu.count * sizeof(cmimu_sample_t));
+    image.height = 1;
+    image.channels = 1;
+    image.data = Imu.buffer;
+
+    // copied, the buffer takes the next batch straight away
+    cmxif_image(CMXIF_IMU, image, NULL, NULL);
+
+    Imu.messages++;
+    Imu.samples += (unsigned long)Imu.count;
+    Imu.count = 0;
+}
+
+void cmimu_quit(void)
+{
+    cmimu_flush();
+
+    if (Imu.period > 0.0 && Imu.messages > 0)
+    {
+        CMLOG(CMLOG_IMU, CMLOG_INFO, "%lu samples in %lu batches", Imu.samples, Imu.messages);
+    }
+}
@@ -0,0 +1,89 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmimu.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker IMU - Sample Batching
+**
+***************************************************************/
+
+#ifndef CMIMU_H
+#define CMIMU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include <xif_server.h>
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/* first bytes of every batch */
+#define CMIMU_MAGIC "CMIB"
+
+#define CMIMU_HEADER_SIZE (16)
+
+/* batches never get longer than this, whatever the rate */
+#define CMIMU_MAX_BATCH (1000)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/*
+ * Prefix of a batch, all fields little endian, followed by count
+ * samples of sample_size bytes. Batches go out as tagged blobs, see
+ * cmxif.h.
+ */
+typedef struct
+{
+    char magic[4];
+    uint32_t count;
+    uint32_t sample_size;   // sizeof(cmimu_sample_t), room to append fields
+    uint32_t reserved;
+} cmimu_header_t;
+
+/* one sample on the wire, same axes and units as xif_imu_t */
+typedef struct
+{
+    uint64_t timestamp;     // ms
+    float orientation[3];
+    float angular_velocity[3];
+    float linear_acceleration[3];
+    float reserved;
+} cmimu_sample_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+/* rate in Hz batches are flushed at, 0 transmits every sample as its own xif_imu_t */
+int cmimu_init(double rate);
+
+/* main loop: queue one sample, flushes the batch once it spans the flush period */
+void cmimu_add(const xif_imu_t *sample);
+
+/* transmit whatever is queued */
+void cmimu_flush(void);
+
+void cmimu_quit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMIMU_H */
@@ -0,0 +1,722 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmlidar.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Capture Pipeline
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmlidar.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <xif_server.h>
+
+#include "cm_thread.h"
+#include "cmlog.h"
+#include "cmxif.h"
+#include "cmlidar_beams.h"
+#include "cmlidar_convert.h"
+#include "cmlidar_range.h"
+#include "cmlidar_voxel.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+// only used when a beam file can't be read
+#define DEFAULT_N_H   (360)
+#define DEFAULT_N_V   (16)
+#define DEFAULT_FOV_H (60.0f)
+#define DEFAULT_FOV_V (5.0f)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/* worker thread only, apart from setup */
+typedef struct
+{
+    char name[64];
+    cmlidar_beams_t beams;  // directions and origins in the vehicle frame
+    float period;           // scan period for deskewing, s
+    vector4_t *points;      // this sensor's slice of Lidar.points
+    size_t capacity;
+
+    double scanTime;        // of the last scan converted
+    // vehicle motion during that scan, period 0 if not deskewed
+    cmlidar_deskew_t motion;
+    bool seen;              // has delivered at least one scan
+    bool fresh;             // converted scan not yet in a merged cloud
+    size_t converted;       // its points
+
+    uint8_t *image;         // range image, CMLIDAR_RANGE_IMAGES only
+    bool beamsSent;         // beam table delivered this test run, set by beams_sent()
+} tSensor;
+
+/* raw scan points as copied from the simulator, one slot per sensor */
+typedef struct
+{
+    char *raw[CMLIDAR_MAX_SENSORS];
+    size_t capacity[CMLIDAR_MAX_SENSORS]; // points
+    int n[CMLIDAR_MAX_SENSORS];
+    double scanTime[CMLIDAR_MAX_SENSORS];
+    cmlidar_deskew_t deskew[CMLIDAR_MAX_SENSORS]; // motion at the time of the copy
+    bool present[CMLIDAR_MAX_SENSORS];
+} tSnapshot;
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static CM_THREAD_FUNC(worker_main);
+static void process(tSnapshot *snapshot);
+static int layout(void);
+static void publish_merged(void);
+static void publish_range(tSnapshot *snapshot);
+static tSnapshot *take_snapshot(void);
+static void send_pointcloud(xif_pointcloud_t pointcloud);
+static void sent(void *ctx, bool delivered);
+static void beams_sent(void *ctx, bool delivered);
+static void wait_sent(void);
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+static struct {
+    cmlidar_layout_t layout;
+    cmlidar_output_t output;
+    bool deskew;
+
+    tSensor sensors[CMLIDAR_MAX_SENSORS];
+    int nSensors;
+
+    // one slice per sensor, sized from the beam tables and grown if a scan carries more points
+    vector4_t *points;
+
+    cmlidar_voxel_t voxel; // worker thread, reserved for all slices together
+
+    tSnapshot snapshots[CMLIDAR_SNAPSHOTS];
+    tSnapshot *filling; // simulation thread only
+    cmlidar_deskew_t motion; // simulation thread only, period left 0
+
+    cm_thread_t thread;
+    bool running;
+
+    /* handoff between simulation thread and worker, guarded by lock */
+    cm_mutex_t lock;
+    cm_cond_t wake;
+    tSnapshot *queued;
+    tSnapshot *converting;
+    bool stop;
+    int inflight; // clouds and range images the transmit thread still reads from our buffers
+
+    unsigned long dropped;
+} Lidar;
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmlidar_open(const cmlidar_layout_t *layout, cmlidar_output_t output, bool deskew)
+{
+    cmlidar_close();
+
+    Lidar.layout = *layout;
+    Lidar.output = output;
+    Lidar.deskew = deskew;
+
+    return 0;
+}
+
+int cmlidar_add(const char *name, const char *beamFile, const double rot[3], const double pos[3], double period)
+{
+    if (Lidar.nSensors == CMLIDAR_MAX_SENSORS)
+    {
+        CMLOG(CMLOG_LIDAR, CMLOG_WARN, "%s ignored, at most %d lidars are captured", name, CMLIDAR_MAX_SENSORS);
+        return -1;
+    }
+
+    tSensor *s = &Lidar.sensors[Lidar.nSensors];
+
+    memset(s, 0, sizeof(*s));
+    snprintf(s->name, sizeof(s->name), "%s", name);
+    s->period = (period > 0.0) ? (float)period : 0.0f;
+
+    if (cmlidar_beams_load(&s->beams, beamFile) != 0)
+    {
+        CMLOG(CMLOG_LIDAR, CMLOG_WARN, "%s: beam file %s not usable, using the %dx%d default grid",
+              name, beamFile, DEFAULT_N_H, DEFAULT_N_V);
+
+        if (cmlidar_beams_grid(&s->beams, -DEFAULT_FOV_H, DEFAULT_FOV_H, DEFAULT_N_H,
+                               -DEFAULT_FOV_V, DEFAULT_FOV_V, DEFAULT_N_V) != 0)
+        {
+            return -1;
+        }
+    }
+
+    if (cmlidar_beams_mount(&s->beams, rot, pos) != 0)
+        return -1;
+
+    // one point per beam, so the capture path normally never allocates
+    s->capacity = (size_t)s->beams.count;
+
+    CMLOG(CMLOG_LIDAR, CMLOG_INFO, "%s: %d beams (%dx%d, FoV %g..%g x %g..%g deg) at %g %g %g, %s kernels, %s",
+          s->name, s->beams.count, s->beams.n_h, s->beams.n_v,
+          s->beams.fov_h[0], s->beams.fov_h[1], s->beams.fov_v[0], s->beams.fov_v[1],
+          pos[0], pos[1], pos[2], cmlidar_convert_isa(),
+          (Lidar.deskew && s->period > 0.0f && Lidar.output != CMLIDAR_RANGE_IMAGES) ? "deskewed" : "not deskewed");
+
+    return Lidar.nSensors++;
+}
+
+int cmlidar_set_voxel(float size, bool centroid)
+{
+    cmlidar_voxel_free(&Lidar.voxel);
+
+    if (cmlidar_voxel_init(&Lidar.voxel, size, centroid) != 0)
+        return -1;
+
+    if (size > 0.0f)
+    {
+        CMLOG(CMLOG_LIDAR, CMLOG_INFO, "clouds downsampled to %g m voxels, %s point", size, centroid ? "centroid" : "first");
+    }
+
+    return 0;
+}
+
+int cmlidar_start(void)
+{
+    if (layout() != 0)
+        return -1;
+
+    for (int k = 0; k < CMLIDAR_SNAPSHOTS; ++k)
+    {
+        for (int i = 0; i < Lidar.nSensors; ++i)
+        {
+            tSnapshot *snap = &Lidar.snapshots[k];
+
+            snap->capacity[i] = Lidar.sensors[i].capacity;
+            if ((snap->raw[i] = malloc(snap->capacity[i] * Lidar.layout.stride)) == NULL)
+            {
+                CMLOG(CMLOG_LIDAR, CMLOG_ERROR, "failed to allocate scan snapshots");
+                return -1;
+            }
+        }
+    }
+
+    if (Lidar.output == CMLIDAR_RANGE_IMAGES)
+    {
+        for (int i = 0; i < Lidar.nSensors; ++i)
+        {
+            tSensor *s = &Lidar.sensors[i];
+            if ((s->image = malloc(cmlidar_range_buffer_size(&s->beams))) == NULL)
+            {
+                CMLOG(CMLOG_LIDAR, CMLOG_ERROR, "failed to allocate range images");
+                return -1;
+            }
+        }
+    }
+
+    cm_mutex_init(&Lidar.lock);
+    cm_cond_init(&Lidar.wake);
+
+    // the worker converts one sensor itself, helpers take the others
+    cmlidar_pool_start(Lidar.nSensors - 1);
+
+    if (!cm_thread_start(&Lidar.thread, worker_main, NULL))
+    {
+        CMLOG(CMLOG_LIDAR, CMLOG_ERROR, "failed to start worker thread");
+        cmlidar_pool_stop();
+        cm_mutex_destroy(&Lidar.lock);
+        cm_cond_destroy(&Lidar.wake);
+        return -1;
+    }
+
+    Lidar.running = true;
+
+    return 0;
+}
+
+int cmlidar_copy(int sensor, const void *points, int n, double scanTime)
+{
+    if (!Lidar.running || sensor < 0 || sensor >= Lidar.nSensors || n < 0)
+        return -1;
+
+    if (Lidar.filling == NULL)
+    {
+        Lidar.filling = take_snapshot();
+    }
+
+    tSnapshot *snap = Lidar.filling;
+
+    if ((size_t)n > snap->capacity[sensor])
+    {
+        char *grown = realloc(snap->raw[sensor], (size_t)n * Lidar.layout.stride);
+        if (grown == NULL)
+        {
+            CMLOG(CMLOG_LIDAR, CMLOG_ERROR, "scan of %d points doesn't fit into memory", n);
+            return -1;
+        }
+        snap->raw[sensor] = grown;
+        snap->capacity[sensor] = (size_t)n;
+    }
+
+    if (snap->present[sensor])
+    {
+        Lidar.dropped++; // reclaimed from the queue before the worker saw this scan
+    }
+
+    if (n > 0)
+    {
+        memcpy(snap->raw[sensor], points, (size_t)n * Lidar.layout.stride);
+    }
+    snap->n[sensor] = n;
+    snap->scanTime[sensor] = scanTime;
+    snap->present[sensor] = true;
+
+    snap->deskew[sensor] = Lidar.motion;
+    snap->deskew[sensor].period = Lidar.deskew ? Lidar.sensors[sensor].period : 0.0f;
+
+    return 0;
+}
+
+void cmlidar_motion(const double velocity[3], double yawRate)
+{
+    // published axes, see cmlidar_beams_t
+    Lidar.motion.vx = (float)-velocity[1];
+    Lidar.motion.vy = (float)velocity[0];
+    Lidar.motion.vz = (float)velocity[2];
+    Lidar.motion.yaw_rate = (float)yawRate;
+}
+
+void cmlidar_submit(void)
+{
+    if (Lidar.filling == NULL)
+        return;
+
+    cm_mutex_lock(&Lidar.lock);
+    Lidar.queued = Lidar.filling;
+    cm_cond_signal(&Lidar.wake);
+    cm_mutex_unlock(&Lidar.lock);
+
+    Lidar.filling = NULL;
+}
+
+unsigned long cmlidar_dropped(void)
+{
+    return Lidar.dropped;
+}
+
+void cmlidar_close(void)
+{
+    if (Lidar.running)
+    {
+        cm_mutex_lock(&Lidar.lock);
+        Lidar.stop = true;
+        cm_cond_signal(&Lidar.wake);
+        cm_mutex_unlock(&Lidar.lock);
+
+        cm_thread_join(Lidar.thread);
+        cmlidar_pool_stop();
+        wait_sent();
+
+        cm_mutex_destroy(&Lidar.lock);
+        cm_cond_destroy(&Lidar.wake);
+
+        if (Lidar.dropped > 0)
+        {
+            CMLOG(CMLOG_LIDAR, CMLOG_WARN, "%lu scans dropped, conversion fell behind", Lidar.dropped);
+        }
+    }
+
+    for (int k = 0; k < CMLIDAR_SNAPSHOTS; ++k)
+    {
+        for (int i = 0; i < CMLIDAR_MAX_SENSORS; ++i)
+        {
+            free(Lidar.snapshots[k].raw[i]);
+        }
+    }
+
+    for (int i = 0; i < Lidar.nSensors; ++i)
+    {
+        cmlidar_beams_free(&Lidar.sensors[i].beams);
+        free(Lidar.sensors[i].image);
+    }
+
+    free(Lidar.points);
+    cmlidar_voxel_free(&Lidar.voxel);
+
+    memset(&Lidar, 0, sizeof(Lidar));
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static CM_THREAD_FUNC(worker_main)
+{
+    (void)arg;
+
+    for (;;)
+    {
+        cm_mutex_lock(&Lidar.lock);
+        while (Lidar.queued == NULL && !Lidar.stop)
+        {
+            cm_cond_wait(&Lidar.wake, &Lidar.lock);
+        }
+
+        // a scan queued before the stop is still published, the worker leaves once none is left
+        if (Lidar.queued == NULL)
+        {
+            cm_mutex_unlock(&Lidar.lock);
+            break;
+        }
+
+        Lidar.converting = Lidar.queued;
+        Lidar.queued = NULL;
+        cm_mutex_unlock(&Lidar.lock);
+
+        process(Lidar.converting);
+
+        cm_mutex_lock(&Lidar.lock);
+        Lidar.converting = NULL;
+        cm_mutex_unlock(&Lidar.lock);
+    }
+
+    CM_THREAD_RETURN;
+}
+
+/* snapshot for the simulation thread; one the worker hasn't picked up yet is taken back, else a free one */
+static tSnapshot *take_snapshot(void)
+{
+    // scans of other sensors in a queued one are kept, the ones overwritten are counted in cmlidar_copy()
+    cm_mutex_lock(&Lidar.lock);
+    tSnapshot *snap = Lidar.queued;
+    Lidar.queued = NULL;
+
+    for (int k = 0; k < CMLIDAR_SNAPSHOTS && snap == NULL; ++k)
+    {
+        if (&Lidar.snapshots[k] != Lidar.converting)
+        {
+            snap = &Lidar.snapshots[k];
+        }
+    }
+    cm_mutex_unlock(&Lidar.lock);
+
+    return snap;
+}
+
+static void process(tSnapshot *snap)
+{
+    cmlidar_job_t jobs[CMLIDAR_MAX_SENSORS];
+    int owners[CMLIDAR_MAX_SENSORS]; // sensor of each job
+    int scans[CMLIDAR_MAX_SENSORS];  // sensors with a scan in the snapshot, with or without points
+    int nScans = 0;
+    bool relayout = false;
+    bool flush = false;
+    int nJobs = 0;
+
+    // point and image buffers are reused from here on
+    wait_sent();
+
+    if (Lidar.output == CMLIDAR_RANGE_IMAGES)
+    {
+        publish_range(snap);
+        return;
+    }
+
+    for (int i = 0; i < Lidar.nSensors; ++i)
+    {
+        tSensor *s = &Lidar.sensors[i];
+
+        if (!snap->present[i])
+            continue;
+
+        // a second scan before the others caught up: publish what we have before its slice is reused
+        flush |= s->fresh;
+        s->seen = true;
+
+        if ((size_t)snap->n[i] > s->capacity)
+        {
+            CMLOG(CMLOG_LIDAR, CMLOG_INFO, "%s point buffer grown from %zu to %d points", s->name, s->capacity, snap->n[i]);
+            s->capacity = (size_t)snap->n[i];
+            relayout = true;
+        }
+    }
+
+    // pending points live in the old buffer, so they go out before a relayout too
+    if (Lidar.output == CMLIDAR_CLOUD_MERGED && (flush || relayout))
+    {
+        publish_merged();
+        wait_sent();
+    }
+
+    if ((relayout || Lidar.points == NULL) && layout() != 0)
+    {
+        memset(snap->present, 0, sizeof(snap->present));
+        return;
+    }
+
+    for (int i = 0; i < Lidar.nSensors; ++i)
+    {
+        if (!snap->present[i])
+            continue;
+
+        Lidar.sensors[i].scanTime = snap->scanTime[i];
+        Lidar.sensors[i].motion = snap->deskew[i];
+        Lidar.sensors[i].converted = 0;
+        scans[nScans++] = i;
+
+        // no returns, nothing to convert but the scan still counts
+        if (snap->n[i] == 0)
+            continue;
+
+        cmlidar_job_t *job = &jobs[nJobs];
+        job->scan.points = snap->raw[i];
+        job->scan.stride = Lidar.layout.stride;
+        job->scan.beam_offset = Lidar.layout.beam_offset;
+        job->scan.length_offset = Lidar.layout.length_offset;
+        job->scan.intensity_offset = Lidar.layout.intensity_offset;
+        job->n = (size_t)snap->n[i];
+        job->beams = &Lidar.sensors[i].beams;
+        job->deskew = &snap->deskew[i];
+        job->out = Lidar.sensors[i].points;
+        job->points = 0;
+        owners[nJobs++] = i;
+    }
+
+    memset(snap->present, 0, sizeof(snap->present));
+
+    // one sensor per thread
+    if (nJobs > 0)
+    {
+        cmlidar_pool_run(jobs, nJobs);
+    }
+
+    for (int j = 0; j < nJobs; ++j)
+    {
+        Lidar.sensors[owners[j]].converted = jobs[j].points;
+    }
+
+    if (Lidar.output == CMLIDAR_CLOUD_MERGED)
+    {
+        bool complete = true;
+
+        for (int j = 0; j < nScans; ++j)
+        {
+            Lidar.sensors[scans[j]].fresh = true;
+        }
+
+        // wait for every sensor's next scan, so sensors in different clusters still end up in one cloud
+        for (int i = 0; i < Lidar.nSensors; ++i)
+        {
+            complete &= (Lidar.sensors[i].fresh || !Lidar.sensors[i].seen);
+        }
+
+        if (complete && nScans > 0)
+            publish_merged();
+
+        return;
+    }
+
+    // an empty scan goes out as an empty cloud
+    for (int j = 0; j < nScans; ++j)
+    {
+        tSensor *s = &Lidar.sensors[scans[j]];
+
+        xif_pointcloud_t pointcloud;
+        pointcloud.num_points = cmlidar_voxel_filter(&Lidar.voxel, s->points, s->converted);
+        pointcloud.points = s->points;
+        pointcloud.timestamp = (uint64_t)llround(s->scanTime * 1000.0);
+
+        send_pointcloud(pointcloud);
+    }
+}
+
+/* every scan converted since the last merged cloud, stamped with the newest scan's time */
+static void publish_merged(void)
+{
+    size_t points = 0;
+    double scanTime = -1.0;
+
+    // the newest scan end stamps the cloud
+    for (int i = 0; i < Lidar.nSensors; ++i)
+    {
+        if (Lidar.sensors[i].fresh && Lidar.sensors[i].scanTime > scanTime)
+            scanTime = Lidar.sensors[i].scanTime;
+    }
+
+    if (scanTime < 0.0)
+        return;
+
+    // slices are in sensor order, close the gaps left by shorter scans
+    for (int i = 0; i < Lidar.nSensors; ++i)
+    {
+        tSensor *s = &Lidar.sensors[i];
+
+        if (!s->fresh)
+            continue;
+
+        if (s->points != Lidar.points + points)
+        {
+            memmove(Lidar.points + points, s->points, s->converted * sizeof(vector4_t));
+        }
+
+        // deskewed slices of scans that ended earlier follow on to that pose
+        if (s->motion.period > 0.0f && s->scanTime < scanTime)
+        {
+            cmlidar_convert_advance(Lidar.points + points, s->converted, &s->motion, (float)(scanTime - s->scanTime));
+        }
+        points += s->converted;
+
+        s->fresh = false;
+    }
+
+    xif_pointcloud_t pointcloud;
+    pointcloud.num_points = cmlidar_voxel_filter(&Lidar.voxel, Lidar.points, points);
+    pointcloud.points = Lidar.points;
+    pointcloud.timestamp = (uint64_t)llround(scanTime * 1000.0);
+
+    send_pointcloud(pointcloud);
+}
+
+/* no Cartesian conversion: every sensor's scan goes out as its range image, after the beam table the first time */
+static void publish_range(tSnapshot *snap)
+{
+    for (int i = 0; i < Lidar.nSensors; ++i)
+    {
+        tSensor *s = &Lidar.sensors[i];
+
+        if (!snap->present[i])
+            continue;
+
+        xif_image_t image;
+        image.timestamp = (uint64_t)llround(snap->scanTime[i] * 1000.0);
+        image.height = 1;
+        image.channels = 1;
+        image.data = s->image;
+
+        if (!s->beamsSent)
+        {
+            image.width = (int)cmlidar_range_beams(&s->beams, i, s->image);
+
+            cm_mutex_lock(&Lidar.lock);
+            Lidar.inflight++;
+            cm_mutex_unlock(&Lidar.lock);
+
+            // the range image is written to the same buffer; a dropped table is sent again with the next scan
+            cmxif_image(CMXIF_LIDAR, image, beams_sent, s);
+            wait_sent();
+        }
+
+        const cmlidar_scan_t scan = {
+            snap->raw[i], Lidar.layout.stride,
+            Lidar.layout.beam_offset, Lidar.layout.length_offset, Lidar.layout.intensity_offset
+        };
+
+        image.width = (int)cmlidar_range_image(&scan, (size_t)snap->n[i], &s->beams, i, s->image);
+
+        cm_mutex_lock(&Lidar.lock);
+        Lidar.inflight++;
+        cm_mutex_unlock(&Lidar.lock);
+
+        cmxif_image(CMXIF_LIDAR, image, sent, NULL);
+    }
+
+    memset(snap->present, 0, sizeof(snap->present));
+}
+
+static void send_pointcloud(xif_pointcloud_t pointcloud)
+{
+    cm_mutex_lock(&Lidar.lock);
+    Lidar.inflight++;
+    cm_mutex_unlock(&Lidar.lock);
+
+    cmxif_pointcloud(CMXIF_LIDAR, pointcloud, sent, NULL);
+}
+
+/* transmit thread, or the worker itself when the lidar stream dropped the message */
+static void sent(void *ctx, bool delivered)
+{
+    (void)ctx;
+    (void)delivered;
+
+    cm_mutex_lock(&Lidar.lock);
+    Lidar.inflight--;
+    cm_cond_signal(&Lidar.wake);
+    cm_mutex_unlock(&Lidar.lock);
+}
+
+/* like sent(), for a beam table */
+static void beams_sent(void *ctx, bool delivered)
+{
+    tSensor *s = ctx;
+
+    cm_mutex_lock(&Lidar.lock);
+    s->beamsSent = delivered;
+    Lidar.inflight--;
+    cm_cond_signal(&Lidar.wake);
+    cm_mutex_unlock(&Lidar.lock);
+}
+
+/* worker: until XIF no longer reads from Lidar.points or the range images */
+static void wait_sent(void)
+{
+    cm_mutex_lock(&Lidar.lock);
+    while (Lidar.inflight > 0)
+    {
+        cm_cond_wait(&Lidar.wake, &Lidar.lock);
+    }
+    cm_mutex_unlock(&Lidar.lock);
+}
+
+/* one buffer, one slice per sensor in sensor order so a merged cloud only has to close gaps */
+static int layout(void)
+{
+    size_t total = 0;
+    for (int i = 0; i < Lidar.nSensors; ++i)
+    {
+        total += Lidar.sensors[i].capacity;
+    }
+
+    free(Lidar.points);
+    if ((Lidar.points = malloc(total * sizeof(vector4_t))) == NULL)
+    {
+        CMLOG(CMLOG_LIDAR, CMLOG_ERROR, "failed to allocate %zu points", total);
+        for (int i = 0; i < Lidar.nSensors; ++i)
+        {
+            Lidar.sensors[i].points = NULL;
+            Lidar.sensors[i].fresh = false;
+        }
+        return -1;
+    }
+
+    vector4_t *slice = Lidar.points;
+    for (int i = 0; i < Lidar.nSensors; ++i)
+    {
+        Lidar.sensors[i].points = slice;
+        slice += Lidar.sensors[i].capacity;
+    }
+
+    // a merged cloud can be as large as all slices, filtering must not allocate per scan
+    if (Lidar.voxel.size > 0.0f)
+    {
+        cmlidar_voxel_reserve(&Lidar.voxel, total);
+    }
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmlidar.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Capture Pipeline
+**
+***************************************************************/
+
+#ifndef CMLIDAR_H
+#define CMLIDAR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "cmlidar_pool.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define CMLIDAR_MAX_SENSORS (CMLIDAR_POOL_MAX_THREADS + 1)
+
+/* raw scans in flight: one being filled by the simulation, one being converted */
+#define CMLIDAR_SNAPSHOTS (2)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/* layout of the simulator's scan point struct, see cmlidar_scan_t */
+typedef struct
+{
+    size_t stride;
+    size_t beam_offset;
+    size_t length_offset;
+    size_t intensity_offset;
+} cmlidar_layout_t;
+
+typedef enum
+{
+    CMLIDAR_CLOUD_MERGED = 0,   // one point cloud for all sensors
+    CMLIDAR_CLOUD_SENSOR,       // one point cloud per sensor
+    CMLIDAR_RANGE_IMAGES,       // one range image per sensor, see cmlidar_range.h
+} cmlidar_output_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+/*
+ * Start describing a new set of sensors, e.g. at test run start. deskew
+ * moves every cloud point to the vehicle pose at the cloud's timestamp:
+ * the end of its scan, or for a merged cloud the end of the newest scan
+ * in it. Without deskew each sensor's points stay as measured. Range
+ * images are always published as measured.
+ */
+int cmlidar_open(const cmlidar_layout_t *layout, cmlidar_output_t output, bool deskew);
+
+/*
+ * Returns the sensor's id; an unreadable beam file falls back to the
+ * default 360x16 grid. period is the scan period in seconds the firing
+ * times are spread over, 0 if unknown.
+ */
+int cmlidar_add(const char *name, const char *beamFile, const double rot[3], const double pos[3], double period);
+
+/* downsample published clouds to one point per voxel of size metres, the voxel's mean or its first point; 0 turns it off */
+int cmlidar_set_voxel(float size, bool centroid);
+
+/* allocate the buffers for the sensors added and start the worker */
+int cmlidar_start(void);
+
+/*
+ * Simulation thread: copy one sensor's finished scan into the snapshot
+ * being filled. Never waits for the worker; if it is still busy with an
+ * older snapshot, the queued one is overwritten and counted as dropped.
+ */
+int cmlidar_copy(int sensor, const void *points, int n, double scanTime);
+
+/* simulation thread: vehicle velocity (CarMaker vehicle axes, m/s) and yaw rate (rad/s) for the scans copied next */
+void cmlidar_motion(const double velocity[3], double yawRate);
+
+/* simulation thread: hand the snapshot filled since the last call to the worker */
+void cmlidar_submit(void);
+
+/* sensor scans overwritten before the worker got to them */
+unsigned long cmlidar_dropped(void);
+
+/* a scan still queued is published before the worker stops */
+void cmlidar_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMLIDAR_H */
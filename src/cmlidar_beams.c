@@ -0,0 +1,387 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmlidar_beams.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Beam Direction Table
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmlidar_beams.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "cmlog.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#ifndef M_PI
+    #define M_PI 3.14159265358979323846
+#endif
+
+#define DEG2RAD (M_PI / 180.0)
+
+#define ROUND_UP(x, a) (((x) + (a) - 1) / (a) * (a))
+
+/* BeamIDs beyond this are treated as a broken file rather than allocated for */
+#define MAX_BEAMS (1 << 20)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef struct
+{
+    int id;
+    double x, y, z;
+    double azimuth, elevation;
+} tBeamRow;
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static int beams_alloc(cmlidar_beams_t *beams, int count, bool origins);
+static void beams_set(cmlidar_beams_t *beams, int id, double azimuth, double elevation, double fire);
+static void published_rotation(const double rot[3], double q[3][3]);
+static float *array_alloc(size_t count);
+static void array_free(float *array);
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmlidar_beams_load(cmlidar_beams_t *beams, const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+    {
+        CMLOG(CMLOG_LIDAR, CMLOG_ERROR, "can't open beam file %s", path);
+        return -1;
+    }
+
+    float fovH[2] = { 0.0f, 0.0f };
+    float fovV[2] = { 0.0f, 0.0f };
+    int nH = 0;
+    int nV = 0;
+
+    tBeamRow *rows = NULL;
+    int nRows = 0;
+    int capacity = 0;
+    int maxId = -1;
+    bool origins = false;
+    bool inTable = false;
+
+    char line[512];
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        // table rows are the tab indented lines following "Beams:"
+        if (inTable && (line[0] == '\t' || line[0] == ' '))
+        {
+            tBeamRow row;
+            if (sscanf(line, "%d %lf %lf %lf %lf %lf", &row.id, &row.x, &row.y, &row.z, &row.azimuth, &row.elevation) != 6)
+                continue;
+
+            if (row.id < 0 || row.id >= MAX_BEAMS)
+            {
+                CMLOG(CMLOG_LIDAR, CMLOG_WARN, "%s: BeamID %d out of range", path, row.id);
+                continue;
+            }
+
+            if (nRows == capacity)
+            {
+                int grow = capacity ? 2 * capacity : 1024;
+                tBeamRow *tmp = realloc(rows, grow * sizeof(*rows));
+                if (tmp == NULL)
+                {
+                    CMLOG(CMLOG_LIDAR, CMLOG_ERROR, "out of memory reading %s", path);
+                    free(rows);
+                    fclose(file);
+                    return -1;
+                }
+                rows = tmp;
+                capacity = grow;
+            }
+
+            rows[nRows++] = row;
+            maxId = (row.id > maxId) ? row.id : maxId;
+            origins |= (row.x != 0.0 || row.y != 0.0 || row.z != 0.0);
+            continue;
+        }
+
+        inTable = (strncmp(line, "Beams:", 6) == 0);
+
+        if (sscanf(line, "Beams.FoVH = %f %f", &fovH[0], &fovH[1]) == 2)
+            continue;
+        if (sscanf(line, "Beams.FoVV = %f %f", &fovV[0], &fovV[1]) == 2)
+            continue;
+        if (sscanf(line, "Beams.N = %d %d", &nH, &nV) == 2)
+            continue;
+    }
+
+    fclose(file);
+
+    int rv;
+
+    if (nRows == 0)
+    {
+        // no explicit table, the header alone describes a regular grid
+        if (nH <= 0 || nV <= 0)
+        {
+            CMLOG(CMLOG_LIDAR, CMLOG_ERROR, "%s has neither a Beams: table nor Beams.N", path);
+            return -1;
+        }
+
+        rv = cmlidar_beams_grid(beams, fovH[0], fovH[1], nH, fovV[0], fovV[1], nV);
+    }
+    else if ((rv = beams_alloc(beams, maxId + 1, origins)) == 0)
+    {
+        // the sweep covers Beams.FoVH, or the table's own azimuth span when the header has none
+        double sweep[2] = { fovH[0], fovH[1] };
+        if (sweep[1] <= sweep[0])
+        {
+            sweep[0] = sweep[1] = rows[0].azimuth;
+            for (int i = 1; i < nRows; ++i)
+            {
+                sweep[0] = fmin(sweep[0], rows[i].azimuth);
+                sweep[1] = fmax(sweep[1], rows[i].azimuth);
+            }
+        }
+
+        for (int i = 0; i < nRows; ++i)
+        {
+            double fire = (sweep[1] > sweep[0]) ? (rows[i].azimuth - sweep[0]) / (sweep[1] - sweep[0]) : 0.0;
+            beams_set(beams, rows[i].id, rows[i].azimuth, rows[i].elevation, fmin(fmax(fire, 0.0), 1.0));
+
+            if (origins)
+            {
+                // beam file origins are in sensor axes (x forward, y left)
+                beams->ox[rows[i].id] = (float)(-rows[i].y);
+                beams->oy[rows[i].id] = (float)rows[i].x;
+                beams->oz[rows[i].id] = (float)rows[i].z;
+            }
+        }
+
+        beams->n_h = nH;
+        beams->n_v = nV;
+        beams->fov_h[0] = fovH[0];
+        beams->fov_h[1] = fovH[1];
+        beams->fov_v[0] = fovV[0];
+        beams->fov_v[1] = fovV[1];
+    }
+
+    free(rows);
+
+    return rv;
+}
+
+int cmlidar_beams_grid(cmlidar_beams_t *beams, float hMin, float hMax, int nH, float vMin, float vMax, int nV)
+{
+    if (nH <= 0 || nV <= 0 || (long)nH * nV > MAX_BEAMS)
+    {
+        CMLOG(CMLOG_LIDAR, CMLOG_ERROR, "invalid beam grid %dx%d", nH, nV);
+        return -1;
+    }
+
+    if (beams_alloc(beams, nH * nV, false) != 0)
+        return -1;
+
+    const double dh = ((double)hMax - hMin) / nH;
+    const double dv = ((double)vMax - vMin) / nV;
+
+    for (int v = 0; v < nV; ++v)
+    {
+        for (int h = 0; h < nH; ++h)
+        {
+            beams_set(beams, v * nH + h, hMin + (h + 0.5) * dh, vMin + (v + 0.5) * dv, (h + 0.5) / nH);
+        }
+    }
+
+    beams->n_h = nH;
+    beams->n_v = nV;
+    beams->fov_h[0] = hMin;
+    beams->fov_h[1] = hMax;
+    beams->fov_v[0] = vMin;
+    beams->fov_v[1] = vMax;
+
+    return 0;
+}
+
+int cmlidar_beams_mount(cmlidar_beams_t *beams, const double rot[3], const double pos[3])
+{
+    if (rot[0] == 0.0 && rot[1] == 0.0 && rot[2] == 0.0 && pos[0] == 0.0 && pos[1] == 0.0 && pos[2] == 0.0)
+        return 0;
+
+    if (beams->ox == NULL)
+    {
+        beams->ox = array_alloc(beams->count);
+        beams->oy = array_alloc(beams->count);
+        beams->oz = array_alloc(beams->count);
+
+        if (beams->ox == NULL || beams->oy == NULL || beams->oz == NULL)
+        {
+            CMLOG(CMLOG_LIDAR, CMLOG_ERROR, "failed to allocate origins for %d beams", beams->count);
+            cmlidar_beams_free(beams);
+            return -1;
+        }
+    }
+
+    double q[3][3];
+    published_rotation(rot, q);
+
+    // mounting position in the published axes
+    const double t[3] = { -pos[1], pos[0], pos[2] };
+
+    for (int i = 0; i < beams->count; ++i)
+    {
+        const double d[3] = { beams->dx[i], beams->dy[i], beams->dz[i] };
+        const double o[3] = { beams->ox[i], beams->oy[i], beams->oz[i] };
+
+        beams->dx[i] = (float)(q[0][0] * d[0] + q[0][1] * d[1] + q[0][2] * d[2]);
+        beams->dy[i] = (float)(q[1][0] * d[0] + q[1][1] * d[1] + q[1][2] * d[2]);
+        beams->dz[i] = (float)(q[2][0] * d[0] + q[2][1] * d[1] + q[2][2] * d[2]);
+
+        beams->ox[i] = (float)(q[0][0] * o[0] + q[0][1] * o[1] + q[0][2] * o[2] + t[0]);
+        beams->oy[i] = (float)(q[1][0] * o[0] + q[1][1] * o[1] + q[1][2] * o[2] + t[1]);
+        beams->oz[i] = (float)(q[2][0] * o[0] + q[2][1] * o[1] + q[2][2] * o[2] + t[2]);
+    }
+
+    return 0;
+}
+
+void cmlidar_beams_free(cmlidar_beams_t *beams)
+{
+    array_free(beams->dx);
+    array_free(beams->dy);
+    array_free(beams->dz);
+    array_free(beams->ox);
+    array_free(beams->oy);
+    array_free(beams->oz);
+    array_free(beams->ft);
+
+    memset(beams, 0, sizeof(*beams));
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static int beams_alloc(cmlidar_beams_t *beams, int count, bool origins)
+{
+    cmlidar_beams_free(beams);
+
+    beams->dx = array_alloc(count);
+    beams->dy = array_alloc(count);
+    beams->dz = array_alloc(count);
+    beams->ft = array_alloc(count);
+
+    bool ok = beams->dx != NULL && beams->dy != NULL && beams->dz != NULL && beams->ft != NULL;
+
+    if (ok && origins)
+    {
+        beams->ox = array_alloc(count);
+        beams->oy = array_alloc(count);
+        beams->oz = array_alloc(count);
+
+        ok = beams->ox != NULL && beams->oy != NULL && beams->oz != NULL;
+    }
+
+    if (!ok)
+    {
+        CMLOG(CMLOG_LIDAR, CMLOG_ERROR, "failed to allocate table for %d beams", count);
+        cmlidar_beams_free(beams);
+        return -1;
+    }
+
+    beams->count = count;
+
+    return 0;
+}
+
+static void beams_set(cmlidar_beams_t *beams, int id, double azimuth, double elevation, double fire)
+{
+    const double az = azimuth * DEG2RAD;
+    const double el = elevation * DEG2RAD;
+
+    // same axes the point cloud has always been published in
+    beams->dx[id] = (float)(-cos(el) * sin(az));
+    beams->dy[id] = (float)(cos(el) * cos(az));
+    beams->dz[id] = (float)sin(el);
+    beams->ft[id] = (float)fire;
+}
+
+/* mounting rotation expressed in the published axes: q = P * Rz * Ry * Rx * P^T with P (x, y, z) -> (-y, x, z) */
+static void published_rotation(const double rot[3], double q[3][3])
+{
+    const double cr = cos(rot[0] * DEG2RAD), sr = sin(rot[0] * DEG2RAD);
+    const double cp = cos(rot[1] * DEG2RAD), sp = sin(rot[1] * DEG2RAD);
+    const double cy = cos(rot[2] * DEG2RAD), sy = sin(rot[2] * DEG2RAD);
+
+    const double r[3][3] = {
+        { cy * cp, cy * sp * sr - sy * cr, cy * sp * cr + sy * sr },
+        { sy * cp, sy * sp * sr + cy * cr, sy * sp * cr - cy * sr },
+        { -sp,     cp * sr,                cp * cr },
+    };
+
+    // P^T maps published (X, Y, Z) to (Y, -X, Z), P maps (x, y, z) back to (-y, x, z)
+    for (int j = 0; j < 3; ++j)
+    {
+        double s[3] = { 0.0, 0.0, 0.0 };
+        const double a[3] = { j == 1 ? 1.0 : 0.0, j == 0 ? -1.0 : 0.0, j == 2 ? 1.0 : 0.0 };
+
+        for (int k = 0; k < 3; ++k)
+            s[k] = r[k][0] * a[0] + r[k][1] * a[1] + r[k][2] * a[2];
+
+        q[0][j] = -s[1];
+        q[1][j] = s[0];
+        q[2][j] = s[2];
+    }
+}
+
+static float *array_alloc(size_t count)
+{
+    // padded to whole cache lines, zeroed so BeamIDs missing from the file map to the origin
+    size_t size = ROUND_UP(count * sizeof(float), CMLIDAR_BEAMS_ALIGNMENT);
+    void *data = NULL;
+
+    #if WIN32
+        data = _aligned_malloc(size, CMLIDAR_BEAMS_ALIGNMENT);
+    #else
+        if (posix_memalign(&data, CMLIDAR_BEAMS_ALIGNMENT, size) != 0)
+        {
+            data = NULL;
+        }
+    #endif
+
+    if (data != NULL)
+    {
+        memset(data, 0, size);
+    }
+
+    return data;
+}
+
+static void array_free(float *array)
+{
+    if (array == NULL)
+        return;
+
+    #if WIN32
+        _aligned_free(array);
+    #else
+        free(array);
+    #endif
+}
@@ -0,0 +1,89 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmlidar_beams.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Beam Direction Table
+**
+***************************************************************/
+
+#ifndef CMLIDAR_BEAMS_H
+#define CMLIDAR_BEAMS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define CMLIDAR_BEAMS_ALIGNMENT (64)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/*
+ * Per beam unit direction vectors in the published point cloud frame
+ * (x flipped, y forward, z up), indexed by tScanPoint.BeamID. The
+ * components are kept in separate cache line aligned arrays so a scan
+ * converts with one multiply per axis and no trigonometry.
+ */
+typedef struct
+{
+    int count;          // entries in each array, highest BeamID + 1
+
+    int n_h;            // Beams.N
+    int n_v;
+    float fov_h[2];     // Beams.FoVH, degrees
+    float fov_v[2];     // Beams.FoVV, degrees
+
+    float *dx;
+    float *dy;
+    float *dz;
+
+    float *ox;          // beam origins, NULL when every beam starts at the sensor
+    float *oy;
+    float *oz;
+
+    float *ft;          // firing time as a fraction of the scan period, the sweep runs from fov_h[0] to fov_h[1]
+} cmlidar_beams_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+/* read a CarMaker LidarRSI beam file, either the Beams: table or the regular grid it declares */
+int cmlidar_beams_load(cmlidar_beams_t *beams, const char *path);
+
+/* regular grid, beam id = row * n_h + column, angles at the cell centres */
+int cmlidar_beams_grid(cmlidar_beams_t *beams, float hMin, float hMax, int nH, float vMin, float vMax, int nV);
+
+/*
+ * Rotate and move the table from sensor to vehicle axes, rot being the
+ * mounting roll, pitch and yaw in degrees (applied z-y-x) and pos the
+ * mounting position in metres, both in CarMaker axes. Converted points
+ * then come out in the vehicle frame at no extra cost per point.
+ */
+int cmlidar_beams_mount(cmlidar_beams_t *beams, const double rot[3], const double pos[3]);
+
+void cmlidar_beams_free(cmlidar_beams_t *beams);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMLIDAR_BEAMS_H */
@@ -0,0 +1,380 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmlidar_convert.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Scan Point to Cartesian Conversion
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmlidar_convert.h"
+
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define CMLIDAR_CONVERT_X86 1
+    #include <immintrin.h>
+#endif
+
+#include "cmlog.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#if CMLIDAR_CONVERT_X86
+    #define TARGET_SSE41 __attribute__((target("sse4.1")))
+    #define TARGET_AVX2  __attribute__((target("avx2")))
+#endif
+
+#define FIELD(scan, i, offset, type) (*(const type *)((const char *)(scan)->points + (i) * (scan)->stride + (offset)))
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef size_t (*tKernel)(const cmlidar_scan_t *scan, size_t n, const cmlidar_beams_t *beams, const cmlidar_deskew_t *deskew, vector4_t *out);
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static size_t convert_scalar(const cmlidar_scan_t *scan, size_t n, const cmlidar_beams_t *beams, const cmlidar_deskew_t *deskew, vector4_t *out);
+static size_t convert_points(const cmlidar_scan_t *scan, size_t first, size_t n, const cmlidar_beams_t *beams, const cmlidar_deskew_t *deskew, vector4_t *out);
+static inline void deskew_point(const cmlidar_deskew_t *deskew, float ft, float *x, float *y, float *z);
+
+#if CMLIDAR_CONVERT_X86
+static size_t convert_sse41(const cmlidar_scan_t *scan, size_t n, const cmlidar_beams_t *beams, const cmlidar_deskew_t *deskew, vector4_t *out);
+static size_t convert_avx2(const cmlidar_scan_t *scan, size_t n, const cmlidar_beams_t *beams, const cmlidar_deskew_t *deskew, vector4_t *out);
+#endif
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+static const char *kernelIsa = "scalar";
+static tKernel kernel = convert_scalar;
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmlidar_convert_init(const char *isa)
+{
+    bool automatic = (isa == NULL || strcmp(isa, "auto") == 0);
+
+    kernelIsa = "scalar";
+    kernel = convert_scalar;
+
+    #if CMLIDAR_CONVERT_X86
+        __builtin_cpu_init();
+
+        if ((automatic || strcmp(isa, "avx2") == 0) && __builtin_cpu_supports("avx2"))
+        {
+            kernelIsa = "avx2";
+            kernel = convert_avx2;
+        }
+        else if ((automatic || strcmp(isa, "sse4.1") == 0 || strcmp(isa, "avx2") == 0)
+              && __builtin_cpu_supports("sse4.1"))
+        {
+            kernelIsa = "sse4.1";
+            kernel = convert_sse41;
+        }
+    #endif
+
+    if (!automatic && strcmp(isa, kernelIsa) != 0)
+    {
+        CMLOG(CMLOG_LIDAR, CMLOG_WARN, "%s conversion kernels not available, using %s", isa, kernelIsa);
+        return strcmp(isa, "scalar") == 0 ? 0 : -1;
+    }
+
+    return 0;
+}
+
+const char *cmlidar_convert_isa(void)
+{
+    return kernelIsa;
+}
+
+size_t cmlidar_convert(const cmlidar_scan_t *scan, size_t n, const cmlidar_beams_t *beams, const cmlidar_deskew_t *deskew, vector4_t *out)
+{
+    if (deskew != NULL && !(deskew->period > 0.0f))
+    {
+        deskew = NULL;
+    }
+
+    return kernel(scan, n, beams, deskew, out);
+}
+
+void cmlidar_convert_advance(vector4_t *points, size_t n, const cmlidar_deskew_t *deskew, float dt)
+{
+    // a point fired dt before the end of a scan that long
+    cmlidar_deskew_t motion = *deskew;
+    motion.period = dt;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        deskew_point(&motion, 0.0f, &points[i].x, &points[i].y, &points[i].z);
+    }
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static size_t convert_scalar(const cmlidar_scan_t *scan, size_t n, const cmlidar_beams_t *beams, const cmlidar_deskew_t *deskew, vector4_t *out)
+{
+    return convert_points(scan, 0, n, beams, deskew, out);
+}
+
+/* reference conversion, the vector kernels fall back to it for tails and blocks with unknown beams */
+static size_t convert_points(const cmlidar_scan_t *scan, size_t first, size_t n, const cmlidar_beams_t *beams, const cmlidar_deskew_t *deskew, vector4_t *out)
+{
+    size_t points = 0;
+
+    for (size_t i = first; i < first + n; ++i)
+    {
+        int beam = FIELD(scan, i, scan->beam_offset, int);
+
+        if (beam < 0 || beam >= beams->count)
+            continue;
+
+        // rounding the halved double once keeps every kernel on the same result
+        float range = (float)(FIELD(scan, i, scan->length_offset, double) * 0.5);
+
+        vector4_t *p = &out[points++];
+        p->x = range * beams->dx[beam];
+        p->y = range * beams->dy[beam];
+        p->z = range * beams->dz[beam];
+        p->w = (float)FIELD(scan, i, scan->intensity_offset, double);
+
+        if (beams->ox != NULL)
+        {
+            p->x += beams->ox[beam];
+            p->y += beams->oy[beam];
+            p->z += beams->oz[beam];
+        }
+
+        if (deskew != NULL)
+        {
+            deskew_point(deskew, beams->ft[beam], &p->x, &p->y, &p->z);
+        }
+    }
+
+    return points;
+}
+
+/*
+ * Move a point from the pose at its firing time to the pose at the scan
+ * end: a yaw rotation by theta = yaw_rate * t, t <= 0 being the firing
+ * time relative to the scan end, plus the distance travelled turned by
+ * half of it. theta stays around 0.1 rad, so third and second order
+ * series replace sin and cos. The vector kernels repeat these operations
+ * one for one to stay bit identical.
+ */
+static inline void deskew_point(const cmlidar_deskew_t *deskew, float ft, float *x, float *y, float *z)
+{
+    const float t = (ft - 1.0f) * deskew->period;
+    const float theta = deskew->yaw_rate * t;
+    const float theta2 = theta * theta;
+    const float c = 1.0f - 0.5f * theta2;
+    const float s = theta - theta2 * theta * (1.0f / 6.0f);
+    const float h = 0.5f * theta;
+
+    const float tx = (deskew->vx - h * deskew->vy) * t;
+    const float ty = (deskew->vy + h * deskew->vx) * t;
+    const float tz = deskew->vz * t;
+
+    const float px = *x;
+    const float py = *y;
+
+    *x = (c * px - s * py) + tx;
+    *y = (s * px + c * py) + ty;
+    *z = *z + tz;
+}
+
+#if CMLIDAR_CONVERT_X86
+
+TARGET_SSE41 static size_t convert_sse41(const cmlidar_scan_t *scan, size_t n, const cmlidar_beams_t *beams, const cmlidar_deskew_t *deskew, vector4_t *out)
+{
+    // no gathers before AVX2: load 4 points' fields, do the maths and the AoS transpose in vector registers
+    size_t points = 0;
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        int b[4];
+        bool valid = true;
+
+        for (int k = 0; k < 4; ++k)
+        {
+            b[k] = FIELD(scan, i + k, scan->beam_offset, int);
+            valid &= (b[k] >= 0 && b[k] < beams->count);
+        }
+
+        if (!valid)
+        {
+            points += convert_points(scan, i, 4, beams, deskew, out + points);
+            continue;
+        }
+
+        __m128d l01 = _mm_set_pd(FIELD(scan, i + 1, scan->length_offset, double), FIELD(scan, i + 0, scan->length_offset, double));
+        __m128d l23 = _mm_set_pd(FIELD(scan, i + 3, scan->length_offset, double), FIELD(scan, i + 2, scan->length_offset, double));
+        __m128d i01 = _mm_set_pd(FIELD(scan, i + 1, scan->intensity_offset, double), FIELD(scan, i + 0, scan->intensity_offset, double));
+        __m128d i23 = _mm_set_pd(FIELD(scan, i + 3, scan->intensity_offset, double), FIELD(scan, i + 2, scan->intensity_offset, double));
+
+        const __m128d half = _mm_set1_pd(0.5);
+        __m128 range = _mm_movelh_ps(_mm_cvtpd_ps(_mm_mul_pd(l01, half)), _mm_cvtpd_ps(_mm_mul_pd(l23, half)));
+
+        __m128 x = _mm_mul_ps(range, _mm_setr_ps(beams->dx[b[0]], beams->dx[b[1]], beams->dx[b[2]], beams->dx[b[3]]));
+        __m128 y = _mm_mul_ps(range, _mm_setr_ps(beams->dy[b[0]], beams->dy[b[1]], beams->dy[b[2]], beams->dy[b[3]]));
+        __m128 z = _mm_mul_ps(range, _mm_setr_ps(beams->dz[b[0]], beams->dz[b[1]], beams->dz[b[2]], beams->dz[b[3]]));
+        __m128 w = _mm_movelh_ps(_mm_cvtpd_ps(i01), _mm_cvtpd_ps(i23));
+
+        if (beams->ox != NULL)
+        {
+            x = _mm_add_ps(x, _mm_setr_ps(beams->ox[b[0]], beams->ox[b[1]], beams->ox[b[2]], beams->ox[b[3]]));
+            y = _mm_add_ps(y, _mm_setr_ps(beams->oy[b[0]], beams->oy[b[1]], beams->oy[b[2]], beams->oy[b[3]]));
+            z = _mm_add_ps(z, _mm_setr_ps(beams->oz[b[0]], beams->oz[b[1]], beams->oz[b[2]], beams->oz[b[3]]));
+        }
+
+        if (deskew != NULL)
+        {
+            // deskew_point() on 4 points
+            const __m128 t = _mm_mul_ps(_mm_sub_ps(_mm_setr_ps(beams->ft[b[0]], beams->ft[b[1]], beams->ft[b[2]], beams->ft[b[3]]),
+                                                   _mm_set1_ps(1.0f)), _mm_set1_ps(deskew->period));
+            const __m128 theta = _mm_mul_ps(_mm_set1_ps(deskew->yaw_rate), t);
+            const __m128 theta2 = _mm_mul_ps(theta, theta);
+            const __m128 c = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), theta2));
+            const __m128 s = _mm_sub_ps(theta, _mm_mul_ps(_mm_mul_ps(theta2, theta), _mm_set1_ps(1.0f / 6.0f)));
+            const __m128 h = _mm_mul_ps(_mm_set1_ps(0.5f), theta);
+
+            const __m128 vx = _mm_set1_ps(deskew->vx);
+            const __m128 vy = _mm_set1_ps(deskew->vy);
+            const __m128 tx = _mm_mul_ps(_mm_sub_ps(vx, _mm_mul_ps(h, vy)), t);
+            const __m128 ty = _mm_mul_ps(_mm_add_ps(vy, _mm_mul_ps(h, vx)), t);
+            const __m128 tz = _mm_mul_ps(_mm_set1_ps(deskew->vz), t);
+
+            const __m128 px = x;
+            x = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(c, px), _mm_mul_ps(s, y)), tx);
+            y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(s, px), _mm_mul_ps(c, y)), ty);
+            z = _mm_add_ps(z, tz);
+        }
+
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+
+        float *p = (float *)(out + points);
+        _mm_storeu_ps(p + 0, x);
+        _mm_storeu_ps(p + 4, y);
+        _mm_storeu_ps(p + 8, z);
+        _mm_storeu_ps(p + 12, w);
+        points += 4;
+    }
+
+    return points + convert_points(scan, i, n - i, beams, deskew, out + points);
+}
+
+TARGET_AVX2 static size_t convert_avx2(const cmlidar_scan_t *scan, size_t n, const cmlidar_beams_t *beams, const cmlidar_deskew_t *deskew, vector4_t *out)
+{
+    // byte offsets of 8 consecutive points; stays well inside int32 because the base moves every block
+    const int stride = (int)scan->stride;
+    const __m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(stride));
+    const __m128i offsetsLo = _mm256_castsi256_si128(offsets);
+    const __m128i offsetsHi = _mm256_extracti128_si256(offsets, 1);
+
+    const __m256i count = _mm256_set1_epi32(beams->count);
+    const __m256i minusOne = _mm256_set1_epi32(-1);
+    const __m256d half = _mm256_set1_pd(0.5);
+
+    size_t points = 0;
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        const char *base = (const char *)scan->points + i * scan->stride;
+
+        __m256i beam = _mm256_i32gather_epi32((const int *)(base + scan->beam_offset), offsets, 1);
+        __m256i valid = _mm256_and_si256(_mm256_cmpgt_epi32(beam, minusOne), _mm256_cmpgt_epi32(count, beam));
+
+        if (_mm256_movemask_epi8(valid) != -1)
+        {
+            points += convert_points(scan, i, 8, beams, deskew, out + points);
+            continue;
+        }
+
+        const double *length = (const double *)(base + scan->length_offset);
+        const double *intensity = (const double *)(base + scan->intensity_offset);
+
+        __m128 rLo = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_i32gather_pd(length, offsetsLo, 1), half));
+        __m128 rHi = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_i32gather_pd(length, offsetsHi, 1), half));
+        __m256 range = _mm256_insertf128_ps(_mm256_castps128_ps256(rLo), rHi, 1);
+
+        __m128 wLo = _mm256_cvtpd_ps(_mm256_i32gather_pd(intensity, offsetsLo, 1));
+        __m128 wHi = _mm256_cvtpd_ps(_mm256_i32gather_pd(intensity, offsetsHi, 1));
+        __m256 w = _mm256_insertf128_ps(_mm256_castps128_ps256(wLo), wHi, 1);
+
+        __m256 x = _mm256_mul_ps(range, _mm256_i32gather_ps(beams->dx, beam, 4));
+        __m256 y = _mm256_mul_ps(range, _mm256_i32gather_ps(beams->dy, beam, 4));
+        __m256 z = _mm256_mul_ps(range, _mm256_i32gather_ps(beams->dz, beam, 4));
+
+        if (beams->ox != NULL)
+        {
+            x = _mm256_add_ps(x, _mm256_i32gather_ps(beams->ox, beam, 4));
+            y = _mm256_add_ps(y, _mm256_i32gather_ps(beams->oy, beam, 4));
+            z = _mm256_add_ps(z, _mm256_i32gather_ps(beams->oz, beam, 4));
+        }
+
+        if (deskew != NULL)
+        {
+            // deskew_point() on 8 points
+            const __m256 t = _mm256_mul_ps(_mm256_sub_ps(_mm256_i32gather_ps(beams->ft, beam, 4), _mm256_set1_ps(1.0f)),
+                                           _mm256_set1_ps(deskew->period));
+            const __m256 theta = _mm256_mul_ps(_mm256_set1_ps(deskew->yaw_rate), t);
+            const __m256 theta2 = _mm256_mul_ps(theta, theta);
+            const __m256 c = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(_mm256_set1_ps(0.5f), theta2));
+            const __m256 s = _mm256_sub_ps(theta, _mm256_mul_ps(_mm256_mul_ps(theta2, theta), _mm256_set1_ps(1.0f / 6.0f)));
+            const __m256 h = _mm256_mul_ps(_mm256_set1_ps(0.5f), theta);
+
+            const __m256 vx = _mm256_set1_ps(deskew->vx);
+            const __m256 vy = _mm256_set1_ps(deskew->vy);
+            const __m256 tx = _mm256_mul_ps(_mm256_sub_ps(vx, _mm256_mul_ps(h, vy)), t);
+            const __m256 ty = _mm256_mul_ps(_mm256_add_ps(vy, _mm256_mul_ps(h, vx)), t);
+            const __m256 tz = _mm256_mul_ps(_mm256_set1_ps(deskew->vz), t);
+
+            const __m256 px = x;
+            x = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(c, px), _mm256_mul_ps(s, y)), tx);
+            y = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(s, px), _mm256_mul_ps(c, y)), ty);
+            z = _mm256_add_ps(z, tz);
+        }
+
+        // 4x4 transpose in each lane leaves points 0-3 in the low and 4-7 in the high halves
+        __m256 xy0 = _mm256_unpacklo_ps(x, y);
+        __m256 xy1 = _mm256_unpackhi_ps(x, y);
+        __m256 zw0 = _mm256_unpacklo_ps(z, w);
+        __m256 zw1 = _mm256_unpackhi_ps(z, w);
+
+        __m256 p04 = _mm256_shuffle_ps(xy0, zw0, 0x44);
+        __m256 p15 = _mm256_shuffle_ps(xy0, zw0, 0xEE);
+        __m256 p26 = _mm256_shuffle_ps(xy1, zw1, 0x44);
+        __m256 p37 = _mm256_shuffle_ps(xy1, zw1, 0xEE);
+
+        float *p = (float *)(out + points);
+        _mm256_storeu_ps(p + 0, _mm256_permute2f128_ps(p04, p15, 0x20));
+        _mm256_storeu_ps(p + 8, _mm256_permute2f128_ps(p26, p37, 0x20));
+        _mm256_storeu_ps(p + 16, _mm256_permute2f128_ps(p04, p15, 0x31));
+        _mm256_storeu_ps(p + 24, _mm256_permute2f128_ps(p26, p37, 0x31));
+        points += 8;
+    }
+
+    return points + convert_points(scan, i, n - i, beams, deskew, out + points);
+}
+
+#endif
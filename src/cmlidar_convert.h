@@ -0,0 +1,100 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmlidar_convert.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Scan Point to Cartesian Conversion
+**
+***************************************************************/
+
+#ifndef CMLIDAR_CONVERT_H
+#define CMLIDAR_CONVERT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include <xif_server.h>
+
+#include "cmlidar_beams.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/*
+ * Where the fields of the simulator's scan point array live, so the
+ * kernels can read tScanPoint in place without depending on the
+ * CarMaker headers. BeamID is an int, LengthOF and Intensity doubles.
+ */
+typedef struct
+{
+    const void *points;
+    size_t stride;
+    size_t beam_offset;
+    size_t length_offset;
+    size_t intensity_offset;
+} cmlidar_scan_t;
+
+/*
+ * Vehicle motion during one scan, in the published axes. A point is
+ * fired at its beam's fraction of the period before the scan ends; it is
+ * moved from the vehicle pose at that time to the pose at the end of the
+ * scan, assuming constant velocity and yaw rate over the period.
+ */
+typedef struct
+{
+    float period;       // s, 0 leaves the points where they were measured
+    float vx;           // vehicle velocity in the vehicle frame, m/s
+    float vy;
+    float vz;
+    float yaw_rate;     // rad/s, positive turning left
+} cmlidar_deskew_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+/* pick the kernels: "auto", "avx2", "sse4.1" or "scalar" */
+int cmlidar_convert_init(const char *isa);
+
+const char *cmlidar_convert_isa(void);
+
+/*
+ * Convert n scan points to x, y, z, intensity. The range is half the
+ * time-of-flight length along the beam's direction from the table, then
+ * the point is deskewed to the scan end pose unless deskew is NULL.
+ * Points whose BeamID isn't in the table are skipped, the number of
+ * points written is returned. Every kernel produces bit identical output.
+ */
+size_t cmlidar_convert(const cmlidar_scan_t *scan, size_t n, const cmlidar_beams_t *beams,
+                       const cmlidar_deskew_t *deskew, vector4_t *out);
+
+/*
+ * Move n converted points on by dt seconds of the motion in deskew, its
+ * period aside: from the vehicle pose at the end of their scan to the
+ * pose dt later, with the same approximation as deskewing.
+ */
+void cmlidar_convert_advance(vector4_t *points, size_t n, const cmlidar_deskew_t *deskew, float dt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMLIDAR_CONVERT_H */
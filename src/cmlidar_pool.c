@@ -0,0 +1,169 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmlidar_pool.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Conversion Worker Pool
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmlidar_pool.h"
+
+#include <string.h>
+
+#include "cm_thread.h"
+#include "cmlog.h"
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static CM_THREAD_FUNC(worker_main);
+static bool run_one(void);
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+static struct {
+    cm_thread_t threads[CMLIDAR_POOL_MAX_THREADS];
+    int nThreads;
+    bool started;
+
+    /* current batch, guarded by lock */
+    cm_mutex_t lock;
+    cm_cond_t wake;
+    cm_cond_t done;
+    cmlidar_job_t *jobs;
+    int nJobs;
+    int next;
+    int finished;
+    bool stop;
+} Pool;
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmlidar_pool_start(int threads)
+{
+    cmlidar_pool_stop();
+
+    memset(&Pool, 0, sizeof(Pool));
+    cm_mutex_init(&Pool.lock);
+    cm_cond_init(&Pool.wake);
+    cm_cond_init(&Pool.done);
+    Pool.started = true;
+
+    if (threads > CMLIDAR_POOL_MAX_THREADS)
+        threads = CMLIDAR_POOL_MAX_THREADS;
+
+    for (int i = 0; i < threads; ++i)
+    {
+        if (!cm_thread_start(&Pool.threads[i], worker_main, NULL))
+        {
+            // fewer helpers only costs wall time, the caller converts whatever is left
+            CMLOG(CMLOG_LIDAR, CMLOG_WARN, "started %d of %d conversion threads", i, threads);
+            break;
+        }
+        Pool.nThreads++;
+    }
+
+    return 0;
+}
+
+void cmlidar_pool_run(cmlidar_job_t *jobs, int nJobs)
+{
+    cm_mutex_lock(&Pool.lock);
+    Pool.jobs = jobs;
+    Pool.nJobs = nJobs;
+    Pool.next = 0;
+    Pool.finished = 0;
+    if (Pool.nThreads > 0 && nJobs > 1)
+    {
+        cm_cond_broadcast(&Pool.wake);
+    }
+
+    while (run_one())
+        ;
+
+    while (Pool.finished < Pool.nJobs)
+    {
+        cm_cond_wait(&Pool.done, &Pool.lock);
+    }
+
+    Pool.jobs = NULL;
+    Pool.nJobs = 0;
+    cm_mutex_unlock(&Pool.lock);
+}
+
+void cmlidar_pool_stop(void)
+{
+    if (!Pool.started)
+        return;
+
+    cm_mutex_lock(&Pool.lock);
+    Pool.stop = true;
+    cm_cond_broadcast(&Pool.wake);
+    cm_mutex_unlock(&Pool.lock);
+
+    for (int i = 0; i < Pool.nThreads; ++i)
+    {
+        cm_thread_join(Pool.threads[i]);
+    }
+
+    cm_mutex_destroy(&Pool.lock);
+    cm_cond_destroy(&Pool.wake);
+    cm_cond_destroy(&Pool.done);
+
+    memset(&Pool, 0, sizeof(Pool));
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static CM_THREAD_FUNC(worker_main)
+{
+    (void)arg;
+
+    cm_mutex_lock(&Pool.lock);
+    while (!Pool.stop)
+    {
+        if (!run_one())
+        {
+            cm_cond_wait(&Pool.wake, &Pool.lock);
+        }
+    }
+    cm_mutex_unlock(&Pool.lock);
+
+    CM_THREAD_RETURN;
+}
+
+/* called and returns with lock held, converts one job with it released */
+static bool run_one(void)
+{
+    if (Pool.next >= Pool.nJobs)
+        return false;
+
+    cmlidar_job_t *job = &Pool.jobs[Pool.next++];
+    cm_mutex_unlock(&Pool.lock);
+
+    job->points = cmlidar_convert(&job->scan, job->n, job->beams, job->deskew, job->out);
+
+    cm_mutex_lock(&Pool.lock);
+    if (++Pool.finished == Pool.nJobs)
+    {
+        cm_cond_signal(&Pool.done);
+    }
+
+    return true;
+}
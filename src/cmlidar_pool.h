@@ -0,0 +1,68 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmlidar_pool.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Conversion Worker Pool
+**
+***************************************************************/
+
+#ifndef CMLIDAR_POOL_H
+#define CMLIDAR_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "cmlidar_convert.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define CMLIDAR_POOL_MAX_THREADS (7)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/* one sensor's scan, points is filled in by the pool */
+typedef struct
+{
+    cmlidar_scan_t scan;
+    size_t n;
+    const cmlidar_beams_t *beams;
+    const cmlidar_deskew_t *deskew; // NULL to skip motion compensation
+    vector4_t *out;
+    size_t points;
+} cmlidar_job_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+/* threads helpers besides the calling thread, 0 converts everything inline */
+int cmlidar_pool_start(int threads);
+
+/* convert every job, the calling thread takes part and returns once all are done */
+void cmlidar_pool_run(cmlidar_job_t *jobs, int nJobs);
+
+void cmlidar_pool_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMLIDAR_POOL_H */
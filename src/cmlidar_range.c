@@ -0,0 +1,116 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmlidar_range.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Organized Range Images
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmlidar_range.h"
+
+#include <string.h>
+
+#include "cm_util.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define IMAGE_CHANNELS (2)
+#define BEAMS_CHANNELS (6)
+
+#define FIELD(scan, i, offset, type) (*(const type *)((const char *)(scan)->points + (i) * (scan)->stride + (offset)))
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static void put_header(uint8_t *out, cmlidar_range_kind_t kind, int sensor, int channels, const cmlidar_beams_t *beams);
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+size_t cmlidar_range_buffer_size(const cmlidar_beams_t *beams)
+{
+    return CMLIDAR_RANGE_HEADER_SIZE + (size_t)beams->count * BEAMS_CHANNELS * sizeof(float);
+}
+
+size_t cmlidar_range_beams(const cmlidar_beams_t *beams, int sensor, uint8_t *out)
+{
+    float *cell = (float *)(out + CMLIDAR_RANGE_HEADER_SIZE);
+
+    put_header(out, CMLIDAR_RANGE_BEAMS, sensor, BEAMS_CHANNELS, beams);
+
+    for (int i = 0; i < beams->count; ++i, cell += BEAMS_CHANNELS)
+    {
+        cell[0] = beams->dx[i];
+        cell[1] = beams->dy[i];
+        cell[2] = beams->dz[i];
+        cell[3] = beams->ox ? beams->ox[i] : 0.0f;
+        cell[4] = beams->oy ? beams->oy[i] : 0.0f;
+        cell[5] = beams->oz ? beams->oz[i] : 0.0f;
+    }
+
+    return CMLIDAR_RANGE_HEADER_SIZE + (size_t)beams->count * BEAMS_CHANNELS * sizeof(float);
+}
+
+size_t cmlidar_range_image(const cmlidar_scan_t *scan, size_t n, const cmlidar_beams_t *beams, int sensor, uint8_t *out)
+{
+    float *cells = (float *)(out + CMLIDAR_RANGE_HEADER_SIZE);
+    size_t size = (size_t)beams->count * IMAGE_CHANNELS * sizeof(float);
+
+    put_header(out, CMLIDAR_RANGE_IMAGE, sensor, IMAGE_CHANNELS, beams);
+    memset(cells, 0, size);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        int beam = FIELD(scan, i, scan->beam_offset, int);
+
+        if (beam < 0 || beam >= beams->count)
+            continue;
+
+        // same rounding as cmlidar_convert(), so range * direction is the published point
+        float range = (float)(FIELD(scan, i, scan->length_offset, double) * 0.5);
+        float *cell = &cells[IMAGE_CHANNELS * beam];
+
+        if (cell[0] > 0.0f && cell[0] <= range)
+            continue;
+
+        cell[0] = range;
+        cell[1] = (float)FIELD(scan, i, scan->intensity_offset, double);
+    }
+
+    return CMLIDAR_RANGE_HEADER_SIZE + size;
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static void put_header(uint8_t *out, cmlidar_range_kind_t kind, int sensor, int channels, const cmlidar_beams_t *beams)
+{
+    // a beam table that isn't a full grid is published as a single row
+    bool grid = beams->n_h > 0 && beams->n_v > 0 && beams->n_h * beams->n_v == beams->count;
+    uint32_t width = grid ? (uint32_t)beams->n_h : (uint32_t)beams->count;
+    uint32_t height = grid ? (uint32_t)beams->n_v : 1u;
+
+    memcpy(out, CMLIDAR_RANGE_MAGIC, 4);
+    out[4] = (uint8_t)kind;
+    out[5] = (uint8_t)sensor;
+    out[6] = (uint8_t)channels;
+    out[7] = 0;
+    cm_put_u32(out + 8, width);
+    cm_put_u32(out + 12, height);
+    cm_put_u32(out + 16, (uint32_t)beams->count);
+    cm_put_u32(out + 20, (uint32_t)((size_t)beams->count * channels * sizeof(float)));
+}
@@ -0,0 +1,93 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmlidar_range.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Organized Range Images
+**
+***************************************************************/
+
+#ifndef CMLIDAR_RANGE_H
+#define CMLIDAR_RANGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "cmlidar_beams.h"
+#include "cmlidar_convert.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/* first bytes of every range image and beam table */
+#define CMLIDAR_RANGE_MAGIC "CMLR"
+
+#define CMLIDAR_RANGE_HEADER_SIZE (24)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef enum
+{
+    CMLIDAR_RANGE_IMAGE = 1,  // range, intensity per cell
+    CMLIDAR_RANGE_BEAMS = 2,  // dx, dy, dz, ox, oy, oz per cell, once per test run
+} cmlidar_range_kind_t;
+
+/*
+ * Prefix of a range image or beam table, all fields little endian,
+ * followed by count cells of channels floats. Cell i belongs to BeamID
+ * i, so a regular grid is row-major with width columns. Both go out as
+ * tagged blobs, see cmxif.h. A cell's point is origin + range *
+ * direction in the same vehicle frame the point clouds are published
+ * in; range 0 means the beam had no return.
+ */
+typedef struct
+{
+    char magic[4];
+    uint8_t kind;       // cmlidar_range_kind_t
+    uint8_t sensor;     // cmlidar sensor id
+    uint8_t channels;   // floats per cell
+    uint8_t reserved;
+    uint32_t width;
+    uint32_t height;
+    uint32_t count;     // cells, width * height
+    uint32_t payload_size;
+} cmlidar_range_header_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+/* bytes needed for the larger of the two, the beam table */
+size_t cmlidar_range_buffer_size(const cmlidar_beams_t *beams);
+
+/* write the beam table to out, returns its size in bytes */
+size_t cmlidar_range_beams(const cmlidar_beams_t *beams, int sensor, uint8_t *out);
+
+/*
+ * Write the range image of n scan points to out, returns its size in
+ * bytes. Of several echoes of one beam the nearest is kept; points
+ * whose BeamID isn't in the table are skipped.
+ */
+size_t cmlidar_range_image(const cmlidar_scan_t *scan, size_t n, const cmlidar_beams_t *beams, int sensor, uint8_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMLIDAR_RANGE_H */
@@ -0,0 +1,237 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmlidar_voxel.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Voxel Grid Downsampling
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmlidar_voxel.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/* voxel coordinates are packed into 21 bits each, points further out share the outermost voxels */
+#define COORD_BITS  (21)
+#define COORD_LIMIT ((1 << (COORD_BITS - 1)) - 1)
+#define COORD_MASK  ((UINT64_C(1) << COORD_BITS) - 1)
+
+/* the table has at least twice the slots of points reserved, which keeps the linear probes short */
+#define MIN_SLOTS   (1024)
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static bool voxel_key(const vector4_t *p, float inv, uint64_t *key);
+static int64_t voxel_coord(float v, float inv);
+static void arena_free(cmlidar_voxel_t *grid);
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmlidar_voxel_init(cmlidar_voxel_t *grid, float size, bool centroid)
+{
+    memset(grid, 0, sizeof(*grid));
+
+    if (!(size >= 0.0f))
+    {
+        fprintf(stderr, "cmlidar_voxel: invalid voxel size %g\n", size);
+        return -1;
+    }
+
+    grid->size = size;
+    grid->centroid = centroid;
+
+    return 0;
+}
+
+int cmlidar_voxel_reserve(cmlidar_voxel_t *grid, size_t n)
+{
+    if (n <= grid->capacity)
+        return 0;
+
+    size_t slots = MIN_SLOTS;
+    while (slots < 2 * n)
+    {
+        slots *= 2;
+    }
+
+    arena_free(grid);
+
+    grid->slots = calloc(slots, sizeof(*grid->slots));
+    grid->sums = malloc(4 * n * sizeof(*grid->sums));
+    grid->counts = malloc(n * sizeof(*grid->counts));
+
+    if (grid->slots == NULL || grid->sums == NULL || grid->counts == NULL)
+    {
+        fprintf(stderr, "cmlidar_voxel: failed to allocate the map for %zu points\n", n);
+        arena_free(grid);
+        return -1;
+    }
+
+    grid->capacity = n;
+    grid->mask = slots - 1;
+    grid->generation = 0;
+
+    return 0;
+}
+
+size_t cmlidar_voxel_filter(cmlidar_voxel_t *grid, vector4_t *points, size_t n)
+{
+    if (!(grid->size > 0.0f) || n == 0)
+        return n;
+
+    if (n > grid->capacity && cmlidar_voxel_reserve(grid, n) != 0)
+        return n;
+
+    // a new generation empties the map; on wrap around the stamps really have to be cleared once
+    if (++grid->generation == 0)
+    {
+        memset(grid->slots, 0, (grid->mask + 1) * sizeof(*grid->slots));
+        grid->generation = 1;
+    }
+
+    // stale stamps make any prefix of the table an empty map of its own
+    size_t mask = MIN_SLOTS - 1;
+    while (mask < 2 * n - 1)
+    {
+        mask = 2 * mask + 1;
+    }
+
+    cmlidar_voxel_slot_t *slots = grid->slots;
+    const uint32_t generation = grid->generation;
+    const float inv = 1.0f / grid->size;
+    size_t kept = 0;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        const vector4_t p = points[i];
+        uint64_t key;
+
+        if (!voxel_key(&p, inv, &key))
+            continue; // not finite
+
+        // Fibonacci hashing spreads the neighbouring voxels of a scan over the table
+        cmlidar_voxel_slot_t *slot = &slots[(size_t)((key * UINT64_C(0x9E3779B97F4A7C15)) >> 32) & mask];
+
+        while (slot->stamp == generation && slot->key != key)
+        {
+            slot = &slots[(size_t)(slot - slots + 1) & mask];
+        }
+
+        if (slot->stamp != generation)
+        {
+            // first point in this voxel, kept <= i so it can be written in place
+            slot->stamp = generation;
+            slot->key = key;
+            slot->voxel = (uint32_t)kept;
+
+            if (grid->centroid)
+            {
+                float *sum = &grid->sums[4 * kept];
+                sum[0] = p.x;
+                sum[1] = p.y;
+                sum[2] = p.z;
+                sum[3] = p.w;
+                grid->counts[kept] = 1;
+            }
+
+            points[kept++] = p;
+        }
+        else if (grid->centroid)
+        {
+            const uint32_t v = slot->voxel;
+            float *sum = &grid->sums[4 * v];
+            sum[0] += p.x;
+            sum[1] += p.y;
+            sum[2] += p.z;
+            sum[3] += p.w;
+            grid->counts[v]++;
+        }
+    }
+
+    if (grid->centroid)
+    {
+        for (size_t k = 0; k < kept; ++k)
+        {
+            if (grid->counts[k] == 1)
+                continue;
+
+            const float *sum = &grid->sums[4 * k];
+            const float scale = 1.0f / (float)grid->counts[k];
+
+            points[k].x = sum[0] * scale;
+            points[k].y = sum[1] * scale;
+            points[k].z = sum[2] * scale;
+            points[k].w = sum[3] * scale;
+        }
+    }
+
+    return kept;
+}
+
+void cmlidar_voxel_free(cmlidar_voxel_t *grid)
+{
+    arena_free(grid);
+    memset(grid, 0, sizeof(*grid));
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static bool voxel_key(const vector4_t *p, float inv, uint64_t *key)
+{
+    if (!isfinite(p->x) || !isfinite(p->y) || !isfinite(p->z))
+        return false;
+
+    const uint64_t x = (uint64_t)voxel_coord(p->x, inv) & COORD_MASK;
+    const uint64_t y = (uint64_t)voxel_coord(p->y, inv) & COORD_MASK;
+    const uint64_t z = (uint64_t)voxel_coord(p->z, inv) & COORD_MASK;
+
+    *key = (x << (2 * COORD_BITS)) | (y << COORD_BITS) | z;
+
+    return true;
+}
+
+static int64_t voxel_coord(float v, float inv)
+{
+    const float c = floorf(v * inv);
+
+    if (c < (float)-COORD_LIMIT)
+        return -COORD_LIMIT;
+    if (c > (float)COORD_LIMIT)
+        return COORD_LIMIT;
+
+    return (int64_t)c;
+}
+
+static void arena_free(cmlidar_voxel_t *grid)
+{
+    free(grid->slots);
+    free(grid->sums);
+    free(grid->counts);
+
+    grid->slots = NULL;
+    grid->sums = NULL;
+    grid->counts = NULL;
+    grid->capacity = 0;
+    grid->mask = 0;
+}
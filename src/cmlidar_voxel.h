@@ -0,0 +1,91 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmlidar_voxel.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Voxel Grid Downsampling
+**
+***************************************************************/
+
+#ifndef CMLIDAR_VOXEL_H
+#define CMLIDAR_VOXEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include <xif_server.h>
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/* one map entry, key, stamp and voxel in the same cache line */
+typedef struct
+{
+    uint64_t key;       // packed voxel coordinates
+    uint32_t stamp;     // generation the slot was last written in
+    uint32_t voxel;     // index into sums
+} cmlidar_voxel_slot_t;
+
+/*
+ * Open addressing voxel map and per voxel accumulators, sized once for
+ * the largest cloud expected. Slots are invalidated by bumping the
+ * generation rather than clearing the table, and a pass only hashes
+ * into as much of the table as its point count needs, so small clouds
+ * stay in cache.
+ */
+typedef struct
+{
+    float size;         // voxel edge, m
+    bool centroid;      // keep the mean of each voxel, otherwise its first point
+
+    size_t capacity;    // points a pass can take without growing
+    size_t mask;        // slots - 1
+    uint32_t generation;
+
+    cmlidar_voxel_slot_t *slots;
+    float *sums;        // x, y, z, w per voxel
+    uint32_t *counts;
+} cmlidar_voxel_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+int cmlidar_voxel_init(cmlidar_voxel_t *grid, float size, bool centroid);
+
+/* size the arena for clouds of up to n points */
+int cmlidar_voxel_reserve(cmlidar_voxel_t *grid, size_t n);
+
+/*
+ * Downsample n points in place, one point per occupied voxel in the
+ * order the voxels were first hit. Returns the points kept; a cloud
+ * larger than reserved grows the arena first and is passed through
+ * unfiltered if that fails.
+ */
+size_t cmlidar_voxel_filter(cmlidar_voxel_t *grid, vector4_t *points, size_t n);
+
+void cmlidar_voxel_free(cmlidar_voxel_t *grid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMLIDAR_VOXEL_H */
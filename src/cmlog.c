@@ -0,0 +1,696 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmlog.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  Asynchronous Logging
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmlog.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#include "cm_thread.h"
+#include "cm_util.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/* the log thread polls the rings, so a logging thread never has to wake it */
+#define IDLE_MS (2)
+
+/* records written per pass before the stop flag is looked at again */
+#define MAX_PASS (4096)
+
+#define RECORD_TEXT (144)
+#define LINE_SIZE   (1024)
+#define SPEC_SIZE   (32)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef enum
+{
+    ARG_INT,
+    ARG_UINT,
+    ARG_LONG,
+    ARG_ULONG,
+    ARG_LLONG,
+    ARG_ULLONG,
+    ARG_SIZE,
+    ARG_INTMAX,
+    ARG_UINTMAX,
+    ARG_PTRDIFF,
+    ARG_DOUBLE,
+    ARG_STRING,     // offset into tRecord.text
+    ARG_POINTER,
+} tArgType;
+
+typedef union
+{
+    long long i;
+    unsigned long long u;
+    double d;
+    const void *p;
+    size_t offset;
+} tArg;
+
+/* one message as the hot path leaves it: the format pointer and its arguments, strings copied */
+typedef struct
+{
+    uint64_t time;
+    const char *format;
+    uint8_t module;
+    uint8_t level;
+    uint8_t nArgs;
+    uint8_t types[CMLOG_MAX_ARGS];
+    tArg args[CMLOG_MAX_ARGS];
+    char text[RECORD_TEXT];
+} tRecord;
+
+typedef enum
+{
+    RING_FREE = 0,
+    RING_OWNED,
+    RING_RETIRED,   // owner exited, free again once drained
+} tRingState;
+
+/* single producer, single consumer */
+typedef struct
+{
+    atomic_int state;
+    atomic_size_t head;     // next record the log thread reads
+    atomic_size_t tail;     // next record the owner writes
+    atomic_ulong dropped;
+} tRing;
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static CM_THREAD_FUNC(log_main);
+static size_t drain(void);
+static tRing *thread_ring(void);
+static void release_ring(void *ring);
+static bool capture(tRecord *record, const char *format, va_list ap);
+static size_t format_record(const tRecord *record, char *line, size_t size);
+static size_t format_prefix(uint64_t time, int module, int level, char *line, size_t size);
+static void write_line(int level, const char *line);
+static const char *parse_spec(const char *f, int *stars, int *precision, char *length, char *conversion);
+static void sleep_ms(int ms);
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+static const char *levelNames[CMLOG_LEVELS] = { "error", "warn", "info", "debug", "trace" };
+static const char levelTags[CMLOG_LEVELS] = { 'E', 'W', 'I', 'D', 'T' };
+static const char *moduleNames[CMLOG_MODULES] = { "main", "img", "rsds", "lidar", "imu", "xif" };
+
+static struct {
+    tRing rings[CMLOG_MAX_THREADS];
+    tRecord records[CMLOG_MAX_THREADS][CMLOG_RING_DEPTH]; // static, only the pages used get touched
+
+    cm_thread_t thread;
+    atomic_bool running;
+    atomic_bool stop;
+    bool keyCreated;
+    uint64_t start;
+
+    #if WIN32
+        DWORD key;
+    #else
+        pthread_key_t key;
+    #endif
+} Log;
+
+static _Thread_local tRing *threadRing;
+
+unsigned char cmlog_threshold[CMLOG_MODULES] = { CMLOG_INFO, CMLOG_INFO, CMLOG_INFO, CMLOG_INFO, CMLOG_INFO, CMLOG_INFO };
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmlog_set_option(const char *option)
+{
+    const char *p = option;
+
+    while (*p != '\0')
+    {
+        const char *end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        const char *eq = memchr(p, '=', len);
+
+        const char *levelName = eq ? eq + 1 : p;
+        size_t levelLen = eq ? len - (size_t)(eq + 1 - p) : len;
+        int level = -1;
+        int module = -1;
+
+        for (int l = 0; l < CMLOG_LEVELS; ++l)
+        {
+            if (strlen(levelNames[l]) == levelLen && strncmp(levelName, levelNames[l], levelLen) == 0)
+                level = l;
+        }
+
+        for (int m = 0; eq != NULL && m < CMLOG_MODULES; ++m)
+        {
+            if (strlen(moduleNames[m]) == (size_t)(eq - p) && strncmp(p, moduleNames[m], (size_t)(eq - p)) == 0)
+                module = m;
+        }
+
+        if (level < 0 || (eq != NULL && module < 0))
+        {
+            fprintf(stderr, "cmlog: '%.*s' is neither a level nor module=level, modules are "
+                            "main, img, rsds, lidar, imu, xif and levels error, warn, info, debug, trace\n", (int)len, p);
+            return -1;
+        }
+
+        for (int m = 0; m < CMLOG_MODULES; ++m)
+        {
+            if (module < 0 || module == m)
+                cmlog_threshold[m] = (unsigned char)level;
+        }
+
+        p += len + (end ? 1 : 0);
+    }
+
+    return 0;
+}
+
+int cmlog_start(void)
+{
+    if (atomic_load(&Log.running))
+        return 0;
+
+    if (!Log.keyCreated)
+    {
+        // hands a ring back when the thread owning it exits
+        #if WIN32
+            Log.key = FlsAlloc((PFLS_CALLBACK_FUNCTION)release_ring);
+            Log.keyCreated = (Log.key != FLS_OUT_OF_INDEXES);
+        #else
+            Log.keyCreated = (pthread_key_create(&Log.key, release_ring) == 0);
+        #endif
+    }
+
+    Log.start = cm_now_ns();
+    atomic_store(&Log.stop, false);
+
+    if (!Log.keyCreated || !cm_thread_start(&Log.thread, log_main, NULL))
+    {
+        fprintf(stderr, "cmlog: failed to start log thread, logging synchronously\n");
+        return -1;
+    }
+
+    atomic_store(&Log.running, true);
+
+    return 0;
+}
+
+void cmlog_stop(void)
+{
+    if (!atomic_load(&Log.running))
+        return;
+
+    // from here on messages are written directly, the thread writes out what was queued before
+    atomic_store(&Log.running, false);
+    atomic_store(&Log.stop, true);
+    cm_thread_join(Log.thread);
+
+    drain();
+}
+
+void cmlog_write(cmlog_module_t module, cmlog_level_t level, const char *format, ...)
+{
+    va_list ap;
+    tRing *ring = atomic_load_explicit(&Log.running, memory_order_relaxed) ? thread_ring() : NULL;
+
+    if (ring == NULL)
+    {
+        // no log thread, or more threads than rings
+        char line[LINE_SIZE];
+        size_t len = format_prefix(cm_now_ns(), module, level, line, sizeof(line));
+
+        va_start(ap, format);
+        vsnprintf(line + len, sizeof(line) - len, format, ap);
+        va_end(ap);
+
+        write_line(level, line);
+        return;
+    }
+
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+    if (tail - head == CMLOG_RING_DEPTH)
+    {
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return;
+    }
+
+    tRecord *record = &Log.records[ring - Log.rings][tail % CMLOG_RING_DEPTH];
+    record->time = cm_now_ns();
+    record->format = format;
+    record->module = (uint8_t)module;
+    record->level = (uint8_t)level;
+
+    va_start(ap, format);
+    bool ok = capture(record, format, ap);
+    va_end(ap);
+
+    if (!ok)
+    {
+        record->format = "unsupported log format: %s";
+        record->nArgs = 1;
+        record->types[0] = ARG_STRING;
+        record->args[0].offset = 0;
+        snprintf(record->text, sizeof(record->text), "%s", format);
+    }
+
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static CM_THREAD_FUNC(log_main)
+{
+    (void)arg;
+
+    while (!atomic_load(&Log.stop))
+    {
+        if (drain() == 0)
+        {
+            sleep_ms(IDLE_MS);
+        }
+    }
+
+    CM_THREAD_RETURN;
+}
+
+/* log thread, or the caller of cmlog_stop(): write queued records oldest first across all rings */
+static size_t drain(void)
+{
+    char line[LINE_SIZE];
+    size_t written = 0;
+
+    for (; written < MAX_PASS; ++written)
+    {
+        tRing *oldest = NULL;
+        const tRecord *next = NULL;
+
+        for (int i = 0; i < CMLOG_MAX_THREADS; ++i)
+        {
+            tRing *ring = &Log.rings[i];
+            size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+            if (head == atomic_load_explicit(&ring->tail, memory_order_acquire))
+            {
+                int retired = RING_RETIRED;
+                atomic_compare_exchange_strong(&ring->state, &retired, RING_FREE);
+                continue;
+            }
+
+            const tRecord *record = &Log.records[i][head % CMLOG_RING_DEPTH];
+            if (next == NULL || record->time < next->time)
+            {
+                oldest = ring;
+                next = record;
+            }
+        }
+
+        if (next == NULL)
+            break;
+
+        format_record(next, line, sizeof(line));
+        write_line(next->level, line);
+
+        atomic_fetch_add_explicit(&oldest->head, 1, memory_order_release);
+    }
+
+    for (int i = 0; i < CMLOG_MAX_THREADS; ++i)
+    {
+        unsigned long dropped = atomic_exchange_explicit(&Log.rings[i].dropped, 0, memory_order_relaxed);
+        if (dropped > 0)
+        {
+            format_prefix(cm_now_ns(), CMLOG_MAIN, CMLOG_WARN, line, sizeof(line));
+            size_t len = strlen(line);
+            snprintf(line + len, sizeof(line) - len, "%lu log messages dropped, ring %d was full", dropped, i);
+            write_line(CMLOG_WARN, line);
+        }
+    }
+
+    if (written > 0)
+    {
+        fflush(stdout);
+        fflush(stderr);
+    }
+
+    return written;
+}
+
+/* the calling thread's ring, claimed the first time it logs */
+static tRing *thread_ring(void)
+{
+    if (threadRing != NULL)
+        return threadRing;
+
+    for (int i = 0; i < CMLOG_MAX_THREADS; ++i)
+    {
+        int expected = RING_FREE;
+        if (atomic_compare_exchange_strong(&Log.rings[i].state, &expected, RING_OWNED))
+        {
+            threadRing = &Log.rings[i];
+
+            #if WIN32
+                FlsSetValue(Log.key, threadRing);
+            #else
+                pthread_setspecific(Log.key, threadRing);
+            #endif
+
+            return threadRing;
+        }
+    }
+
+    return NULL;
+}
+
+static void release_ring(void *ring)
+{
+    if (ring != NULL)
+    {
+        atomic_store(&((tRing *)ring)->state, RING_RETIRED);
+    }
+}
+
+/* copy the arguments format asks for; false for conversions we can't replay */
+static bool capture(tRecord *record, const char *format, va_list ap)
+{
+    size_t used = 0;
+    record->nArgs = 0;
+    record->text[RECORD_TEXT - 1] = '\0';
+
+    for (const char *f = strchr(format, '%'); f != NULL; f = strchr(f, '%'))
+    {
+        int stars;
+        int precision;
+        char length;
+        char conversion;
+
+        f = parse_spec(f, &stars, &precision, &length, &conversion);
+
+        if (conversion == '%')
+            continue;
+
+        if (record->nArgs + stars + 1 > CMLOG_MAX_ARGS)
+            return true; // the rest comes out as '?'
+
+        for (int s = 0; s < stars; ++s)
+        {
+            int value = va_arg(ap, int);
+            record->types[record->nArgs] = ARG_INT;
+            record->args[record->nArgs++].i = value;
+
+            // a * precision bounds %.*s, which needn't be terminated
+            if (s == stars - 1 && precision == -2)
+                precision = value < 0 ? -1 : value;
+        }
+
+        uint8_t *type = &record->types[record->nArgs];
+        tArg *a = &record->args[record->nArgs++];
+
+        switch (conversion)
+        {
+            case 'd':
+            case 'i':
+            case 'c':
+                switch (length)
+                {
+                    case 'l': *type = ARG_LONG;    a->i = va_arg(ap, long);      break;
+                    case 'q': *type = ARG_LLONG;   a->i = va_arg(ap, long long); break;
+                    case 'z': *type = ARG_SIZE;    a->u = va_arg(ap, size_t);    break;
+                    case 'j': *type = ARG_INTMAX;  a->i = va_arg(ap, intmax_t);  break;
+                    case 't': *type = ARG_PTRDIFF; a->i = va_arg(ap, ptrdiff_t); break;
+                    default:  *type = ARG_INT;     a->i = va_arg(ap, int);       break;
+                }
+                break;
+
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                switch (length)
+                {
+                    case 'l': *type = ARG_ULONG;   a->u = va_arg(ap, unsigned long);      break;
+                    case 'q': *type = ARG_ULLONG;  a->u = va_arg(ap, unsigned long long); break;
+                    case 'z': *type = ARG_SIZE;    a->u = va_arg(ap, size_t);             break;
+                    case 'j': *type = ARG_UINTMAX; a->u = va_arg(ap, uintmax_t);          break;
+                    case 't': *type = ARG_PTRDIFF; a->i = va_arg(ap, ptrdiff_t);          break;
+                    default:  *type = ARG_UINT;    a->u = va_arg(ap, unsigned int);       break;
+                }
+                break;
+
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                if (length == 'L')
+                    return false;
+                *type = ARG_DOUBLE;
+                a->d = va_arg(ap, double);
+                break;
+
+            case 'p':
+                *type = ARG_POINTER;
+                a->p = va_arg(ap, void *);
+                break;
+
+            case 's':
+            {
+                const char *s = va_arg(ap, const char *);
+                size_t room = (used < RECORD_TEXT - 1) ? RECORD_TEXT - 1 - used : 0;
+                size_t n = 0;
+
+                if (s == NULL)
+                    s = "(null)";
+
+                while (n < room && s[n] != '\0' && (precision < 0 || n < (size_t)precision))
+                    ++n;
+
+                *type = ARG_STRING;
+                a->offset = (room > 0) ? used : RECORD_TEXT - 1;
+
+                if (room > 0)
+                {
+                    memcpy(record->text + used, s, n);
+                    record->text[used + n] = '\0';
+                    used += n + 1;
+                }
+                break;
+            }
+
+            default:
+                return false; // %n, wide characters, malformed
+        }
+    }
+
+    return true;
+}
+
+/* the log line of a record, the same conversions capture() copied replayed one by one */
+static size_t format_record(const tRecord *record, char *line, size_t size)
+{
+    size_t len = format_prefix(record->time, record->module, record->level, line, size);
+    const char *f = record->format;
+    int arg = 0;
+
+    while (*f != '\0' && len + 1 < size)
+    {
+        const char *percent = strchr(f, '%');
+        size_t literal = percent ? (size_t)(percent - f) : strlen(f);
+
+        if (literal > size - 1 - len)
+            literal = size - 1 - len;
+
+        memcpy(line + len, f, literal);
+        len += literal;
+        line[len] = '\0';
+
+        if (percent == NULL || len + 1 >= size)
+            break;
+
+        int stars;
+        int precision;
+        char length;
+        char conversion;
+        const char *end = parse_spec(percent, &stars, &precision, &length, &conversion);
+        f = end;
+
+        if (conversion == '%')
+        {
+            line[len++] = '%';
+            line[len] = '\0';
+            continue;
+        }
+
+        if (arg + stars >= record->nArgs || (size_t)(end - percent) >= SPEC_SIZE)
+        {
+            line[len++] = '?';
+            line[len] = '\0';
+            arg = record->nArgs;
+            continue;
+        }
+
+        // the spec with every * replaced by its captured value
+        char spec[SPEC_SIZE + 2 * 12];
+        size_t s = 0;
+        for (const char *c = percent; c < end; ++c)
+        {
+            if (*c == '*')
+                s += (size_t)snprintf(spec + s, sizeof(spec) - s, "%lld", record->args[arg++].i);
+            else
+                spec[s++] = *c;
+        }
+        spec[s] = '\0';
+
+        const tArg *a = &record->args[arg];
+        char *out = line + len;
+        size_t room = size - len;
+        int n = 0;
+
+        switch (record->types[arg++])
+        {
+            case ARG_INT:     n = snprintf(out, room, spec, (int)a->i); break;
+            case ARG_UINT:    n = snprintf(out, room, spec, (unsigned int)a->u); break;
+            case ARG_LONG:    n = snprintf(out, room, spec, (long)a->i); break;
+            case ARG_ULONG:   n = snprintf(out, room, spec, (unsigned long)a->u); break;
+            case ARG_LLONG:   n = snprintf(out, room, spec, (long long)a->i); break;
+            case ARG_ULLONG:  n = snprintf(out, room, spec, (unsigned long long)a->u); break;
+            case ARG_SIZE:    n = snprintf(out, room, spec, (size_t)a->u); break;
+            case ARG_INTMAX:  n = snprintf(out, room, spec, (intmax_t)a->i); break;
+            case ARG_UINTMAX: n = snprintf(out, room, spec, (uintmax_t)a->u); break;
+            case ARG_PTRDIFF: n = snprintf(out, room, spec, (ptrdiff_t)a->i); break;
+            case ARG_DOUBLE:  n = snprintf(out, room, spec, a->d); break;
+            case ARG_POINTER: n = snprintf(out, room, spec, a->p); break;
+            case ARG_STRING:  n = snprintf(out, room, spec, record->text + a->offset); break;
+        }
+
+        len += (n < 0) ? 0 : ((size_t)n < room ? (size_t)n : room - 1);
+    }
+
+    return len;
+}
+
+/* seconds since cmlog_start(), level and module in front of every line */
+static size_t format_prefix(uint64_t time, int module, int level, char *line, size_t size)
+{
+    double seconds = (Log.start != 0 && time >= Log.start) ? (time - Log.start) * 1e-9 : 0.0;
+    int n = snprintf(line, size, "%10.6f %c %-5s ", seconds, levelTags[level], moduleNames[module]);
+
+    return (n < 0) ? 0 : (size_t)n;
+}
+
+static void write_line(int level, const char *line)
+{
+    FILE *stream = (level <= CMLOG_WARN) ? stderr : stdout;
+
+    fputs(line, stream);
+    fputc('\n', stream);
+}
+
+/*
+ * Skip one conversion spec starting at f == '%', returns the first
+ * character after it. stars counts the * width and precision arguments,
+ * precision is -1 without one, -2 for .* and the value otherwise. length
+ * is 0 or one of h, l, q (ll), z, j, t, L (hh reads as h).
+ */
+static const char *parse_spec(const char *f, int *stars, int *precision, char *length, char *conversion)
+{
+    *stars = 0;
+    *precision = -1;
+    *length = 0;
+
+    ++f;
+
+    while (*f != '\0' && strchr("-+ #0", *f) != NULL)
+        ++f;
+
+    if (*f == '*')
+    {
+        ++*stars;
+        ++f;
+    }
+    while (*f >= '0' && *f <= '9')
+        ++f;
+
+    if (*f == '.')
+    {
+        ++f;
+        if (*f == '*')
+        {
+            ++*stars;
+            *precision = -2;
+            ++f;
+        }
+        else
+        {
+            *precision = 0;
+            while (*f >= '0' && *f <= '9')
+                *precision = *precision * 10 + (*f++ - '0');
+        }
+    }
+
+    switch (*f)
+    {
+        case 'h':
+            *length = 'h';
+            f += (f[1] == 'h') ? 2 : 1;
+            break;
+        case 'l':
+            *length = (f[1] == 'l') ? 'q' : 'l';
+            f += (f[1] == 'l') ? 2 : 1;
+            break;
+        case 'z':
+        case 'j':
+        case 't':
+        case 'L':
+            *length = *f++;
+            break;
+    }
+
+    *conversion = *f;
+
+    return (*f != '\0') ? f + 1 : f;
+}
+
+static void sleep_ms(int ms)
+{
+    #if WIN32
+        Sleep((DWORD)ms);
+    #else
+        struct timespec ts = { 0, ms * 1000000L };
+        nanosleep(&ts, NULL);
+    #endif
+}
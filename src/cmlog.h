@@ -0,0 +1,110 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmlog.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  Asynchronous Logging
+**
+***************************************************************/
+
+#ifndef CMLOG_H
+#define CMLOG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/* threads logging at the same time with a ring of their own, more fall back to writing directly */
+#define CMLOG_MAX_THREADS (32)
+
+/* records per thread ring */
+#define CMLOG_RING_DEPTH (1024)
+
+/* conversions per record, further ones are printed as '?' */
+#define CMLOG_MAX_ARGS (10)
+
+#if defined(__GNUC__)
+    #define CMLOG_PRINTF(f, a) __attribute__((format(printf, f, a)))
+#else
+    #define CMLOG_PRINTF(f, a)
+#endif
+
+/*
+ * Log a printf style message. A level the module filters out costs the
+ * one comparison; otherwise the arguments are copied into the calling
+ * thread's ring and formatted later by the log thread. The format must
+ * be a string literal, %n and long double aren't supported.
+ */
+#define CMLOG(module, level, ...) \
+    do { \
+        if ((int)(level) <= (int)cmlog_threshold[(module)]) \
+            cmlog_write((module), (level), __VA_ARGS__); \
+    } while (0)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef enum
+{
+    CMLOG_ERROR = 0,
+    CMLOG_WARN,
+    CMLOG_INFO,
+    CMLOG_DEBUG,
+    CMLOG_TRACE,
+    CMLOG_LEVELS
+} cmlog_level_t;
+
+typedef enum
+{
+    CMLOG_MAIN = 0,
+    CMLOG_IMG,      // image client, publishing side
+    CMLOG_RSDS,     // image client, receive thread
+    CMLOG_LIDAR,
+    CMLOG_IMU,
+    CMLOG_XIF,      // transmit thread
+    CMLOG_MODULES
+} cmlog_module_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+/* highest level logged per module, written by cmlog_set_option() only */
+extern unsigned char cmlog_threshold[CMLOG_MODULES];
+
+/*
+ * Level for all modules ("debug") or a comma separated list of
+ * module=level pairs ("lidar=debug,rsds=warn"); the default is info.
+ */
+int cmlog_set_option(const char *option);
+
+/* start the log thread; before and after it, messages are written directly */
+int cmlog_start(void);
+
+/* write out what is queued and stop the log thread */
+void cmlog_stop(void);
+
+void cmlog_write(cmlog_module_t module, cmlog_level_t level, const char *format, ...) CMLOG_PRINTF(3, 4);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMLOG_H */
@@ -0,0 +1,396 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmsched.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  Rate-Monotonic Main Loop Scheduler
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmsched.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cm_util.h"
+#include "cmlog.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/* execution times in power of two buckets of us, the last one open ended */
+#define HISTOGRAM_BUCKETS (24)
+
+#define NAME_SIZE (32)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef struct
+{
+    cmsched_task_t cfg;
+    uint64_t next;          // next release, ms of simulation time
+
+    unsigned long runs;
+    unsigned long missed;   // releases that passed while the task hadn't run yet
+    unsigned long overruns;
+    uint64_t totalNs;
+    uint64_t maxNs;
+    unsigned long histogram[HISTOGRAM_BUCKETS];
+} tTask;
+
+typedef struct
+{
+    char name[NAME_SIZE];
+    uint32_t period;
+    uint32_t phase;
+    uint32_t budget;
+    bool hasPhase;
+    bool hasBudget;
+} tOverride;
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static void align(tTask *t, uint64_t now);
+static void run_task(tTask *t, uint64_t now);
+static uint32_t auto_phase(uint32_t period);
+static uint32_t gcd(uint32_t a, uint32_t b);
+static int bucket(uint64_t ns);
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+static struct {
+    tTask tasks[CMSCHED_MAX_TASKS];     // shortest period first
+    int nTasks;
+
+    tOverride overrides[CMSCHED_MAX_TASKS];
+    int nOverrides;
+
+    bool started;
+    uint64_t last;
+
+    unsigned long cycles;
+    uint64_t cycleTotalNs;
+    uint64_t cycleMaxNs;
+    uint64_t cycleMaxAt;    // simulation time of the busiest cycle
+} Sched;
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmsched_set_option(const char *option)
+{
+    const char *p = option;
+
+    while (*p != '\0')
+    {
+        const char *end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        const char *eq = memchr(p, '=', len);
+        tOverride o;
+        char *next;
+
+        memset(&o, 0, sizeof(o));
+
+        if (eq == NULL || eq == p || (size_t)(eq - p) >= sizeof(o.name) || Sched.nOverrides == CMSCHED_MAX_TASKS)
+            goto invalid;
+
+        memcpy(o.name, p, (size_t)(eq - p));
+
+        o.period = (uint32_t)strtoul(eq + 1, &next, 10);
+        if (next == eq + 1)
+            goto invalid;
+
+        if (*next == ':')
+        {
+            const char *phase = next + 1;
+            o.hasPhase = true;
+
+            if (strncmp(phase, "auto", 4) == 0)
+            {
+                o.phase = CMSCHED_PHASE_AUTO;
+                next = (char *)phase + 4;
+            }
+            else
+            {
+                o.phase = (uint32_t)strtoul(phase, &next, 10);
+                if (next == phase)
+                    goto invalid;
+            }
+        }
+
+        if (*next == ':')
+        {
+            const char *budget = next + 1;
+            o.hasBudget = true;
+            o.budget = (uint32_t)strtoul(budget, &next, 10);
+            if (next == budget)
+                goto invalid;
+        }
+
+        if (next != p + len)
+            goto invalid;
+
+        Sched.overrides[Sched.nOverrides++] = o;
+        p += len + (end ? 1 : 0);
+        continue;
+
+    invalid:
+        fprintf(stderr, "cmsched: '%.*s' must be task=period[:phase[:budget]], "
+                        "period and phase in ms, phase may be auto, budget in us\n", (int)len, p);
+        return -1;
+    }
+
+    return 0;
+}
+
+int cmsched_add(const cmsched_task_t *task)
+{
+    if (Sched.nTasks == CMSCHED_MAX_TASKS)
+    {
+        fprintf(stderr, "cmsched: %s not added, at most %d tasks are scheduled\n", task->name, CMSCHED_MAX_TASKS);
+        return -1;
+    }
+
+    cmsched_task_t cfg = *task;
+
+    for (int i = 0; i < Sched.nOverrides; ++i)
+    {
+        const tOverride *o = &Sched.overrides[i];
+
+        if (strcmp(o->name, cfg.name) != 0)
+            continue;
+
+        cfg.period = o->period;
+        if (o->hasPhase)
+            cfg.phase = o->phase;
+        if (o->hasBudget)
+            cfg.budget = o->budget;
+    }
+
+    if (cfg.period == 0)
+    {
+        cfg.phase = 0;
+    }
+    else if (cfg.phase == CMSCHED_PHASE_AUTO)
+    {
+        cfg.phase = auto_phase(cfg.period);
+    }
+    else if (cfg.phase >= cfg.period)
+    {
+        fprintf(stderr, "cmsched: %s phase %u ms isn't below its period of %u ms\n", cfg.name, cfg.phase, cfg.period);
+        return -1;
+    }
+
+    // rate monotonic, shorter periods run first; equal periods in the order added
+    int at = Sched.nTasks;
+    while (at > 0 && Sched.tasks[at - 1].cfg.period > cfg.period)
+    {
+        Sched.tasks[at] = Sched.tasks[at - 1];
+        --at;
+    }
+
+    memset(&Sched.tasks[at], 0, sizeof(Sched.tasks[at]));
+    Sched.tasks[at].cfg = cfg;
+    Sched.nTasks++;
+
+    // a task added while running starts with the next release
+    if (Sched.started)
+        align(&Sched.tasks[at], Sched.last);
+
+    CMLOG(CMLOG_MAIN, CMLOG_INFO, "task %s every %u ms at +%u ms, budget %u us", cfg.name, cfg.period, cfg.phase, cfg.budget);
+
+    return at;
+}
+
+void cmsched_run(uint64_t now)
+{
+    if (!Sched.started || now < Sched.last)
+    {
+        for (int i = 0; i < Sched.nTasks; ++i)
+            align(&Sched.tasks[i], now);
+    }
+
+    Sched.started = true;
+    Sched.last = now;
+
+    uint64_t start = cm_now_ns();
+
+    for (int i = 0; i < Sched.nTasks; ++i)
+    {
+        tTask *t = &Sched.tasks[i];
+
+        if (t->cfg.period == 0)
+        {
+            run_task(t, now);
+        }
+        else if (now >= t->next)
+        {
+            uint64_t late = (now - t->next) / t->cfg.period;
+
+            t->missed += (unsigned long)late;
+            t->next += (late + 1) * t->cfg.period;
+            run_task(t, now);
+        }
+    }
+
+    uint64_t ns = cm_now_ns() - start;
+
+    Sched.cycles++;
+    Sched.cycleTotalNs += ns;
+    if (ns > Sched.cycleMaxNs)
+    {
+        Sched.cycleMaxNs = ns;
+        Sched.cycleMaxAt = now;
+    }
+}
+
+void cmsched_report(void)
+{
+    if (Sched.cycles == 0)
+        return;
+
+    CMLOG(CMLOG_MAIN, CMLOG_INFO, "%lu cycles, mean %.1f us, max %.1f us at %.3f s",
+          Sched.cycles, Sched.cycleTotalNs * 1e-3 / Sched.cycles, Sched.cycleMaxNs * 1e-3, Sched.cycleMaxAt * 1e-3);
+
+    for (int i = 0; i < Sched.nTasks; ++i)
+    {
+        const tTask *t = &Sched.tasks[i];
+
+        if (t->runs == 0)
+        {
+            CMLOG(CMLOG_MAIN, CMLOG_INFO, "  %-10s never ran", t->cfg.name);
+            continue;
+        }
+
+        // upper end of the bucket holding the 99th percentile
+        unsigned long count = 0;
+        int b = 0;
+        while (b < HISTOGRAM_BUCKETS - 1 && (count += t->histogram[b]) * 100 < t->runs * 99)
+            ++b;
+
+        CMLOG(CMLOG_MAIN, CMLOG_INFO, "  %-10s %4u ms +%-3u %9lu runs, mean %8.1f us, p99 < %6lu us, max %8.1f us, "
+                                      "%lu over %u us budget, %lu releases missed",
+              t->cfg.name, t->cfg.period, t->cfg.phase, t->runs, t->totalNs * 1e-3 / t->runs, 1ul << b,
+              t->maxNs * 1e-3, t->overruns, t->cfg.budget, t->missed);
+    }
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+/* first release at or after now */
+static void align(tTask *t, uint64_t now)
+{
+    uint32_t period = t->cfg.period;
+    uint32_t phase = t->cfg.phase;
+
+    if (period == 0 || now <= phase)
+        t->next = phase;
+    else
+        t->next = phase + (now - phase + period - 1) / period * period;
+}
+
+static void run_task(tTask *t, uint64_t now)
+{
+    uint64_t start = cm_now_ns();
+    t->cfg.func(now, t->cfg.arg);
+    uint64_t ns = cm_now_ns() - start;
+
+    t->runs++;
+    t->totalNs += ns;
+    t->histogram[bucket(ns)]++;
+    if (ns > t->maxNs)
+        t->maxNs = ns;
+
+    if (t->cfg.budget > 0 && ns > (uint64_t)t->cfg.budget * 1000)
+    {
+        t->overruns++;
+
+        // first, second, fourth, ... overrun, a task that never fits won't flood the log
+        if ((t->overruns & (t->overruns - 1)) == 0)
+        {
+            CMLOG(CMLOG_MAIN, CMLOG_WARN, "task %s took %.1f us at %.3f s, budget %u us (%lu overruns)",
+                  t->cfg.name, ns * 1e-3, now * 1e-3, t->cfg.budget, t->overruns);
+        }
+    }
+}
+
+/*
+ * The phase whose releases coincide with the least budget of the
+ * periodic tasks already added. Releases of periods a and b at phases
+ * p and q meet iff p - q is a multiple of gcd(a, b). A task without a
+ * budget weighs 1.
+ */
+static uint32_t auto_phase(uint32_t period)
+{
+    uint32_t best = 0;
+    uint64_t bestCost = UINT64_MAX;
+
+    for (uint32_t p = 0; p < period; ++p)
+    {
+        uint64_t cost = 0;
+
+        for (int i = 0; i < Sched.nTasks; ++i)
+        {
+            const cmsched_task_t *other = &Sched.tasks[i].cfg;
+
+            if (other->period == 0)
+                continue;
+
+            uint32_t g = gcd(period, other->period);
+            if ((p % g) == (other->phase % g))
+                cost += other->budget > 0 ? other->budget : 1;
+        }
+
+        if (cost < bestCost)
+        {
+            best = p;
+            bestCost = cost;
+        }
+    }
+
+    return best;
+}
+
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+    while (b != 0)
+    {
+        uint32_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+static int bucket(uint64_t ns)
+{
+    uint64_t us = ns / 1000;
+    int b = 0;
+
+    while (us > 0 && b < HISTOGRAM_BUCKETS - 1)
+    {
+        us >>= 1;
+        ++b;
+    }
+
+    return b;
+}
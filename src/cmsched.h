@@ -0,0 +1,91 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmsched.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  Rate-Monotonic Main Loop Scheduler
+**
+***************************************************************/
+
+#ifndef CMSCHED_H
+#define CMSCHED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define CMSCHED_MAX_TASKS (16)
+
+/* let cmsched_add() pick the phase that collides least with the tasks already added */
+#define CMSCHED_PHASE_AUTO (UINT32_MAX)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/* now is the simulation time in ms the task was released at */
+typedef void (*cmsched_func_t)(uint64_t now, void *arg);
+
+/*
+ * A periodic task of the main loop. Releases are in simulation time,
+ * at phase, phase + period, ... ms; period 0 runs the task every
+ * cycle. The budget is wall time per run, a run taking longer is
+ * counted as an overrun, it isn't interrupted.
+ */
+typedef struct
+{
+    const char *name;
+    cmsched_func_t func;
+    void *arg;
+    uint32_t period;    // ms
+    uint32_t phase;     // ms, below period, or CMSCHED_PHASE_AUTO
+    uint32_t budget;    // us, 0 for none
+} cmsched_task_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+/*
+ * Override the period, phase and budget of tasks by name, given as a
+ * comma separated list of name=period[:phase[:budget]], phase may be
+ * auto; e.g. "lidar=10:auto:2000,imu=2". Applies to cmsched_add() calls
+ * after it.
+ */
+int cmsched_set_option(const char *option);
+
+/* add a task, returns its id or -1 if the table is full */
+int cmsched_add(const cmsched_task_t *task);
+
+/*
+ * Run the tasks released since the last call, shortest period first.
+ * A task released more than once since its last run runs once, the
+ * other releases are counted as missed. Simulation time going
+ * backwards, a new test run, starts every task over at its phase.
+ */
+void cmsched_run(uint64_t now);
+
+/* log execution time statistics per task */
+void cmsched_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMSCHED_H */
@@ -0,0 +1,702 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmxif.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  XIF Transmit Thread
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include "cmxif.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#include "cm_thread.h"
+#include "cm_util.h"
+#include "cmlog.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+/* the queued messages, the one being sent and the one being filled */
+#define NODES (CMXIF_MAX_DEPTH + 2)
+
+/* entries[] is indexed modulo the max depth so the counters may wrap */
+#define SLOT(i) ((i) % CMXIF_MAX_DEPTH)
+
+#define FLUSH_POLL_US (1000)
+
+/* how often a producer looks for room in a full queue while writing to a sink */
+#define SINK_POLL_US (100)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef enum
+{
+    MSG_TIMESTEP,
+    MSG_IMU,
+    MSG_POINTCLOUD,
+    MSG_IMAGE,
+} tKind;
+
+typedef struct
+{
+    tKind kind;
+    union {
+        uint64_t time;
+        xif_imu_t imu;
+        xif_pointcloud_t pointcloud;
+        xif_image_t image;
+    } u;
+
+    cmxif_done_t done;
+    void *ctx;
+
+    void *copy;             // payload owned by the node, kept for the next message
+    size_t copyCapacity;
+} tMessage;
+
+/*
+ * The same single producer, single consumer queue as cmimg_queue_t,
+ * holding messages from the stream's own nodes. Nodes are taken by the
+ * producer and handed back by whoever completes the message.
+ */
+typedef struct
+{
+    _Alignas(64) atomic_uint head;
+    _Alignas(64) atomic_uint tail;
+
+    _Alignas(64) _Atomic(tMessage *) entries[CMXIF_MAX_DEPTH];
+    unsigned int depth;
+    cm_drop_policy_t policy;
+
+    atomic_uint freeMask;
+    tMessage nodes[NODES];
+
+    atomic_uint maxQueued;
+    atomic_ulong sent;
+    atomic_ulong dropped;
+} tStream;
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static CM_THREAD_FUNC(transmit_main);
+static bool send_next(void);
+static void transmit(cmxif_stream_t stream, const tMessage *m);
+static void write_record(cmxif_stream_t stream, const tMessage *m);
+static void submit(cmxif_stream_t stream, const tMessage *msg, size_t copy);
+static tMessage *take(tStream *s);
+static bool copy_payload(tMessage *m, const void *data, size_t size);
+static void push(tStream *s, tMessage *m);
+static tMessage *pop(tStream *s);
+static void complete(tStream *s, tMessage *m, bool sent);
+static void close_sink(void);
+static void put_f32(uint8_t *p, float v);
+static void sleep_us(long us);
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+static struct {
+    tStream streams[CMXIF_STREAMS];
+
+    cm_thread_t thread;
+    atomic_bool running;    // producers queue instead of sending themselves
+    atomic_bool stop;
+
+    /* a producer only takes the lock to wake a sleeping thread */
+    atomic_bool sleeping;
+    atomic_long pending;    // queued, not yet sent or dropped
+    cm_mutex_t lock;
+    cm_cond_t wake;
+
+    /* with a sink, messages go to this file instead of XIF and are never dropped */
+    FILE *sink;
+    cm_mutex_t sinkLock;    // a record in one piece, producers write themselves without the thread
+    uint64_t sinkBytes;
+    bool sinkFailed;
+} Xif = {
+    .streams = {
+        [CMXIF_TIMESTEP] = { .depth = 16, .policy = CM_DROP_OLDEST },
+        [CMXIF_IMU]      = { .depth = 16, .policy = CM_DROP_OLDEST },
+        [CMXIF_LIDAR]    = { .depth = 16, .policy = CM_DROP_OLDEST }, // the worker waits for a scan's messages, up to two per sensor
+        [CMXIF_CAMERA]   = { .depth = 2,  .policy = CM_DROP_OLDEST },
+    },
+};
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int cmxif_set_option(const char *option)
+{
+    const char *p = option;
+
+    while (*p != '\0')
+    {
+        const char *end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        const char *eq = memchr(p, '=', len);
+        int stream = -1;
+
+        for (int i = 0; eq != NULL && i < CMXIF_STREAMS; ++i)
+        {
+            const char *name = cmxif_stream_name((cmxif_stream_t)i);
+
+            if (strlen(name) == (size_t)(eq - p) && strncmp(p, name, (size_t)(eq - p)) == 0)
+                stream = i;
+        }
+
+        char *next = NULL;
+        long depth = (stream >= 0) ? strtol(eq + 1, &next, 10) : 0;
+        cm_drop_policy_t policy = (stream >= 0) ? Xif.streams[stream].policy : CM_DROP_OLDEST;
+
+        if (next != NULL && next != eq + 1 && *next == ':')
+        {
+            size_t rest = len - (size_t)(next + 1 - p);
+
+            if (rest == 6 && strncmp(next + 1, "oldest", 6) == 0)
+                policy = CM_DROP_OLDEST;
+            else if (rest == 6 && strncmp(next + 1, "newest", 6) == 0)
+                policy = CM_DROP_NEWEST;
+            else
+                next = NULL;
+
+            if (next != NULL)
+                next += 1 + rest;
+        }
+
+        if (stream < 0 || next == NULL || next != p + len || depth < 1 || depth > CMXIF_MAX_DEPTH)
+        {
+            fprintf(stderr, "cmxif: '%.*s' must be stream=depth[:oldest|newest], streams are "
+                            "timestep, imu, lidar, camera and depth 1..%d\n", (int)len, p, CMXIF_MAX_DEPTH);
+            return -1;
+        }
+
+        Xif.streams[stream].depth = (unsigned int)depth;
+        Xif.streams[stream].policy = policy;
+
+        p += len + (end ? 1 : 0);
+    }
+
+    return 0;
+}
+
+int cmxif_set_sink(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    uint8_t header[CMXIF_SINK_HEADER_SIZE];
+
+    if (f == NULL)
+    {
+        fprintf(stderr, "cmxif: can't create sink %s\n", path);
+        return -1;
+    }
+
+    memcpy(header, CMXIF_SINK_MAGIC, 4);
+    cm_put_u32(header + 4, CMXIF_SINK_VERSION);
+
+    if (fwrite(header, sizeof(header), 1, f) != 1)
+    {
+        fprintf(stderr, "cmxif: can't write sink %s\n", path);
+        fclose(f);
+        return -1;
+    }
+
+    close_sink();
+
+    cm_mutex_init(&Xif.sinkLock);
+    Xif.sink = f;
+    Xif.sinkBytes = sizeof(header);
+    Xif.sinkFailed = false;
+
+    return 0;
+}
+
+int cmxif_start(void)
+{
+    if (atomic_load(&Xif.running))
+        return 0;
+
+    for (int i = 0; i < CMXIF_STREAMS; ++i)
+    {
+        tStream *s = &Xif.streams[i];
+
+        atomic_store(&s->head, 0u);
+        atomic_store(&s->tail, 0u);
+        atomic_store(&s->freeMask, (1u << NODES) - 1);
+    }
+
+    atomic_store(&Xif.stop, false);
+    atomic_store(&Xif.sleeping, false);
+    atomic_store(&Xif.pending, 0);
+
+    cm_mutex_init(&Xif.lock);
+    cm_cond_init(&Xif.wake);
+
+    if (!cm_thread_start(&Xif.thread, transmit_main, NULL))
+    {
+        CMLOG(CMLOG_XIF, CMLOG_ERROR, "failed to start transmit thread, sending on the simulation thread");
+        cm_mutex_destroy(&Xif.lock);
+        cm_cond_destroy(&Xif.wake);
+        return -1;
+    }
+
+    atomic_store(&Xif.running, true);
+
+    return 0;
+}
+
+void cmxif_flush(void)
+{
+    while (atomic_load(&Xif.running) && atomic_load(&Xif.pending) > 0)
+    {
+        sleep_us(FLUSH_POLL_US);
+    }
+}
+
+void cmxif_stop(void)
+{
+    if (!atomic_load(&Xif.running))
+    {
+        close_sink();
+        return;
+    }
+
+    atomic_store(&Xif.running, false);
+    atomic_store(&Xif.stop, true);
+
+    cm_mutex_lock(&Xif.lock);
+    cm_cond_signal(&Xif.wake);
+    cm_mutex_unlock(&Xif.lock);
+
+    // the thread leaves once the queues are empty
+    cm_thread_join(Xif.thread);
+
+    cm_mutex_destroy(&Xif.lock);
+    cm_cond_destroy(&Xif.wake);
+
+    for (int i = 0; i < CMXIF_STREAMS; ++i)
+    {
+        for (int n = 0; n < NODES; ++n)
+        {
+            free(Xif.streams[i].nodes[n].copy);
+            Xif.streams[i].nodes[n].copy = NULL;
+            Xif.streams[i].nodes[n].copyCapacity = 0;
+        }
+    }
+
+    cmxif_report();
+    close_sink();
+}
+
+void cmxif_timestep(uint64_t time)
+{
+    tMessage msg = { .kind = MSG_TIMESTEP, .u.time = time };
+    submit(CMXIF_TIMESTEP, &msg, 0);
+}
+
+void cmxif_imu(xif_imu_t imu)
+{
+    tMessage msg = { .kind = MSG_IMU, .u.imu = imu };
+    submit(CMXIF_IMU, &msg, 0);
+}
+
+void cmxif_pointcloud(cmxif_stream_t stream, xif_pointcloud_t pointcloud, cmxif_done_t done, void *ctx)
+{
+    tMessage msg = { .kind = MSG_POINTCLOUD, .u.pointcloud = pointcloud, .done = done, .ctx = ctx };
+    submit(stream, &msg, done ? 0 : pointcloud.num_points * sizeof(vector4_t));
+}
+
+void cmxif_image(cmxif_stream_t stream, xif_image_t image, cmxif_done_t done, void *ctx)
+{
+    tMessage msg = { .kind = MSG_IMAGE, .u.image = image, .done = done, .ctx = ctx };
+    submit(stream, &msg, done ? 0 : (size_t)image.width * image.height * image.channels);
+}
+
+void cmxif_stats(cmxif_stream_t stream, cmxif_stats_t *stats)
+{
+    tStream *s = &Xif.streams[stream];
+
+    stats->depth = s->depth;
+    stats->policy = s->policy;
+    stats->queued = atomic_load(&s->tail) - atomic_load(&s->head);
+    stats->maxQueued = atomic_load(&s->maxQueued);
+    stats->sent = atomic_load(&s->sent);
+    stats->dropped = atomic_load(&s->dropped);
+}
+
+void cmxif_report(void)
+{
+    for (int i = 0; i < CMXIF_STREAMS; ++i)
+    {
+        cmxif_stats_t stats;
+        cmxif_stats((cmxif_stream_t)i, &stats);
+
+        if (stats.sent == 0 && stats.dropped == 0)
+            continue;
+
+        CMLOG(CMLOG_XIF, CMLOG_INFO, "%-8s %9lu sent, %6lu dropped, up to %2u of %2u queued, drop %s",
+              cmxif_stream_name((cmxif_stream_t)i), stats.sent, stats.dropped, stats.maxQueued, stats.depth,
+              stats.policy == CM_DROP_NEWEST ? "newest" : "oldest");
+    }
+
+    if (Xif.sink != NULL)
+    {
+        CMLOG(CMLOG_XIF, Xif.sinkFailed ? CMLOG_ERROR : CMLOG_INFO, "%.1f MB written to the sink%s",
+              Xif.sinkBytes / 1e6, Xif.sinkFailed ? ", incomplete after a write error" : "");
+    }
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static CM_THREAD_FUNC(transmit_main)
+{
+    (void)arg;
+
+    for (;;)
+    {
+        if (send_next())
+            continue;
+
+        cm_mutex_lock(&Xif.lock);
+        atomic_store(&Xif.sleeping, true);
+        while (atomic_load(&Xif.pending) == 0 && !atomic_load(&Xif.stop))
+        {
+            cm_cond_wait(&Xif.wake, &Xif.lock);
+        }
+        atomic_store(&Xif.sleeping, false);
+        cm_mutex_unlock(&Xif.lock);
+
+        if (atomic_load(&Xif.stop) && atomic_load(&Xif.pending) == 0)
+            break;
+    }
+
+    CM_THREAD_RETURN;
+}
+
+/* one message of the highest priority stream that has one */
+static bool send_next(void)
+{
+    for (int i = 0; i < CMXIF_STREAMS; ++i)
+    {
+        tStream *s = &Xif.streams[i];
+        tMessage *m = pop(s);
+
+        if (m != NULL)
+        {
+            transmit((cmxif_stream_t)i, m);
+            complete(s, m, true);
+            atomic_fetch_sub(&Xif.pending, 1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void transmit(cmxif_stream_t stream, const tMessage *m)
+{
+    if (Xif.sink != NULL)
+    {
+        write_record(stream, m);
+        return;
+    }
+
+    switch (m->kind)
+    {
+        case MSG_TIMESTEP:   xifs_transmit_timestep(m->u.time);         break;
+        case MSG_IMU:        xifs_transmit_imu(m->u.imu);               break;
+        case MSG_POINTCLOUD: xifs_transmit_pointcloud(m->u.pointcloud); break;
+        case MSG_IMAGE:      xifs_transmit_image(m->u.image);           break;
+    }
+}
+
+/* one record of the layout described with CMXIF_SINK_MAGIC */
+static void write_record(cmxif_stream_t stream, const tMessage *m)
+{
+    uint8_t header[CMXIF_SINK_RECORD_SIZE + 9 * 4];
+    size_t headerSize = CMXIF_SINK_RECORD_SIZE;
+    const void *data = NULL;
+    size_t dataSize = 0;
+    uint64_t timestamp = 0;
+
+    switch (m->kind)
+    {
+        case MSG_TIMESTEP:
+            timestamp = m->u.time;
+            break;
+
+        case MSG_IMU:
+        {
+            const xif_imu_t *imu = &m->u.imu;
+            const float values[9] = {
+                imu->orientation.x, imu->orientation.y, imu->orientation.z,
+                imu->angular_velocity.x, imu->angular_velocity.y, imu->angular_velocity.z,
+                imu->linear_acceleration.x, imu->linear_acceleration.y, imu->linear_acceleration.z,
+            };
+
+            timestamp = imu->timestamp;
+            for (int i = 0; i < 9; ++i)
+                put_f32(header + headerSize + 4 * i, values[i]);
+            headerSize += 9 * 4;
+            break;
+        }
+
+        case MSG_POINTCLOUD:
+            timestamp = m->u.pointcloud.timestamp;
+            data = m->u.pointcloud.points;
+            dataSize = m->u.pointcloud.num_points * sizeof(vector4_t);
+            break;
+
+        case MSG_IMAGE:
+            timestamp = m->u.image.timestamp;
+            cm_put_u32(header + headerSize, (uint32_t)m->u.image.width);
+            cm_put_u32(header + headerSize + 4, (uint32_t)m->u.image.height);
+            cm_put_u32(header + headerSize + 8, (uint32_t)m->u.image.channels);
+            headerSize += 12;
+            data = m->u.image.data;
+            dataSize = (size_t)m->u.image.width * m->u.image.height * m->u.image.channels;
+            break;
+    }
+
+    header[0] = (uint8_t)(m->kind + 1);
+    header[1] = (uint8_t)stream;
+    header[2] = 0;
+    header[3] = 0;
+    cm_put_u32(header + 4, (uint32_t)(headerSize - CMXIF_SINK_RECORD_SIZE + dataSize));
+    cm_put_u32(header + 8, (uint32_t)timestamp);
+    cm_put_u32(header + 12, (uint32_t)(timestamp >> 32));
+
+    cm_mutex_lock(&Xif.sinkLock);
+
+    // after a failed write nothing more is written, a record missing in the middle would go unnoticed
+    if (!Xif.sinkFailed)
+    {
+        // points are floats already, written as they are on little endian hosts
+        if (fwrite(header, headerSize, 1, Xif.sink) == 1
+         && (dataSize == 0 || fwrite(data, dataSize, 1, Xif.sink) == 1))
+        {
+            Xif.sinkBytes += headerSize + dataSize;
+        }
+        else
+        {
+            CMLOG(CMLOG_XIF, CMLOG_ERROR, "writing the sink failed, the rest of the output is discarded");
+            Xif.sinkFailed = true;
+        }
+    }
+
+    cm_mutex_unlock(&Xif.sinkLock);
+}
+
+/* producer: queue msg, copying copy bytes of its payload; sent right away without the thread */
+static void submit(cmxif_stream_t stream, const tMessage *msg, size_t copy)
+{
+    tStream *s = &Xif.streams[stream];
+    tMessage *m = take(s);
+
+    if (m == NULL)
+    {
+        transmit(stream, msg);
+        atomic_fetch_add_explicit(&s->sent, 1, memory_order_relaxed);
+        if (msg->done != NULL)
+            msg->done(msg->ctx, true);
+        return;
+    }
+
+    m->kind = msg->kind;
+    m->u = msg->u;
+    m->done = msg->done;
+    m->ctx = msg->ctx;
+
+    if (copy > 0)
+    {
+        const void *data = (m->kind == MSG_IMAGE) ? m->u.image.data : (const void *)m->u.pointcloud.points;
+
+        if (!copy_payload(m, data, copy))
+        {
+            complete(s, m, false);
+            return;
+        }
+
+        if (m->kind == MSG_IMAGE)
+            m->u.image.data = m->copy;
+        else
+            m->u.pointcloud.points = m->copy;
+    }
+
+    push(s, m);
+}
+
+/* producer: a free node of the stream, NULL to send directly */
+static tMessage *take(tStream *s)
+{
+    if (!atomic_load_explicit(&Xif.running, memory_order_acquire))
+        return NULL;
+
+    unsigned int mask = atomic_load_explicit(&s->freeMask, memory_order_acquire);
+
+    // NODES covers a full queue, so this doesn't happen with a single producer
+    if (mask == 0)
+        return NULL;
+
+    // only the producer clears bits, so the lowest free node stays ours
+    int index = 0;
+    while (!(mask & (1u << index)))
+    {
+        ++index;
+    }
+
+    atomic_fetch_and_explicit(&s->freeMask, ~(1u << index), memory_order_acq_rel);
+
+    return &s->nodes[index];
+}
+
+static bool copy_payload(tMessage *m, const void *data, size_t size)
+{
+    if (size > m->copyCapacity)
+    {
+        void *grown = realloc(m->copy, size);
+        if (grown == NULL)
+            return false;
+
+        m->copy = grown;
+        m->copyCapacity = size;
+    }
+
+    if (size > 0)
+        memcpy(m->copy, data, size);
+
+    return true;
+}
+
+static void push(tStream *s, tMessage *m)
+{
+    unsigned int tail = atomic_load_explicit(&s->tail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&s->head, memory_order_acquire);
+
+    // a sink records everything, the producer waits for room instead
+    while (Xif.sink != NULL && tail - head >= s->depth)
+    {
+        sleep_us(SINK_POLL_US);
+        head = atomic_load_explicit(&s->head, memory_order_acquire);
+    }
+
+    if (tail - head >= s->depth)
+    {
+        if (s->policy == CM_DROP_NEWEST)
+        {
+            complete(s, m, false);
+            return;
+        }
+
+        // evict the oldest entry; if the transmit thread got there first there is room anyway
+        tMessage *oldest = atomic_load_explicit(&s->entries[SLOT(head)], memory_order_relaxed);
+
+        if (atomic_compare_exchange_strong_explicit(&s->head, &head, head + 1,
+                                                    memory_order_acq_rel, memory_order_acquire))
+        {
+            complete(s, oldest, false);
+            atomic_fetch_sub(&Xif.pending, 1);
+        }
+    }
+
+    atomic_store_explicit(&s->entries[SLOT(tail)], m, memory_order_relaxed);
+    atomic_store_explicit(&s->tail, tail + 1, memory_order_release);
+
+    unsigned int queued = tail + 1 - atomic_load_explicit(&s->head, memory_order_relaxed);
+    if (queued > atomic_load_explicit(&s->maxQueued, memory_order_relaxed))
+        atomic_store_explicit(&s->maxQueued, queued, memory_order_relaxed);
+
+    // pairs with the thread setting sleeping before it looks at pending
+    atomic_fetch_add(&Xif.pending, 1);
+
+    if (atomic_load(&Xif.sleeping))
+    {
+        cm_mutex_lock(&Xif.lock);
+        cm_cond_signal(&Xif.wake);
+        cm_mutex_unlock(&Xif.lock);
+    }
+}
+
+static tMessage *pop(tStream *s)
+{
+    unsigned int head = atomic_load_explicit(&s->head, memory_order_acquire);
+
+    // a failed exchange means the producer evicted head; it can do so at most once per push
+    for (;;)
+    {
+        unsigned int tail = atomic_load_explicit(&s->tail, memory_order_acquire);
+
+        if (head == tail)
+            return NULL;
+
+        tMessage *m = atomic_load_explicit(&s->entries[SLOT(head)], memory_order_relaxed);
+
+        if (atomic_compare_exchange_weak_explicit(&s->head, &head, head + 1,
+                                                  memory_order_acq_rel, memory_order_acquire))
+        {
+            return m;
+        }
+    }
+}
+
+/* hand the caller's memory back and the node to the producer */
+static void complete(tStream *s, tMessage *m, bool sent)
+{
+    atomic_fetch_add_explicit(sent ? &s->sent : &s->dropped, 1, memory_order_relaxed);
+
+    if (m->done != NULL)
+        m->done(m->ctx, sent);
+
+    atomic_fetch_or_explicit(&s->freeMask, 1u << (m - s->nodes), memory_order_release);
+}
+
+static void close_sink(void)
+{
+    if (Xif.sink == NULL)
+        return;
+
+    if (fclose(Xif.sink) != 0 && !Xif.sinkFailed)
+        CMLOG(CMLOG_XIF, CMLOG_ERROR, "closing the sink failed, its output may be incomplete");
+
+    cm_mutex_destroy(&Xif.sinkLock);
+    Xif.sink = NULL;
+}
+
+static void put_f32(uint8_t *p, float v)
+{
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    cm_put_u32(p, bits);
+}
+
+static void sleep_us(long us)
+{
+    #if WIN32
+        Sleep((DWORD)((us + 999) / 1000));
+    #else
+        struct timespec ts = { us / 1000000, (us % 1000000) * 1000 };
+        nanosleep(&ts, NULL);
+    #endif
+}
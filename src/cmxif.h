@@ -0,0 +1,148 @@
+/***************************************************************
+**
+** TBReAI Header File
+**
+** File         :  cmxif.h
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  XIF Transmit Thread
+**
+***************************************************************/
+
+#ifndef CMXIF_H
+#define CMXIF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include <xif_server.h>
+
+#include "cm_thread.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define CMXIF_MAX_DEPTH (16)
+
+/*
+ * Tagged blobs: data XIF has no message for goes out as an image of
+ * width bytes, height 1 and channels 1, on the stream of the sensor it
+ * belongs to. Its first four bytes are a magic clients dispatch on,
+ * followed by a little endian header of that type:
+ *
+ *   "CMIE"  camera frame, raw or encoded, cmimg_encode.h
+ *   "CMLR"  lidar range image or beam table, cmlidar_range.h
+ *   "CMIB"  IMU sample batch, cmimu.h
+ */
+
+/*
+ * A sink file is the magic and a u32 version, then one record per
+ * message: u8 kind (1 timestep, 2 imu, 3 pointcloud, 4 image), u8
+ * stream, u16 0, u32 payload size, u64 timestamp and the payload; nine
+ * floats of orientation, angular velocity and linear acceleration, x,
+ * y, z, w per point, or u32 width, height, channels and the bytes.
+ * Little endian throughout.
+ */
+#define CMXIF_SINK_MAGIC "CMXS"
+#define CMXIF_SINK_VERSION (1)
+#define CMXIF_SINK_HEADER_SIZE (8)
+#define CMXIF_SINK_RECORD_SIZE (16)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/* one bounded queue each, sent in this order of priority; each has a single producer thread */
+typedef enum
+{
+    CMXIF_TIMESTEP = 0, // main loop
+    CMXIF_IMU,          // main loop, samples and batches
+    CMXIF_LIDAR,        // lidar worker, clouds and range images
+    CMXIF_CAMERA,       // main loop
+    CMXIF_STREAMS
+} cmxif_stream_t;
+
+/*
+ * Called once per message that referenced caller memory, on the
+ * transmit thread after sending it (sent true), or on the producer if
+ * the drop policy discarded it. The memory may be reused from then on.
+ */
+typedef void (*cmxif_done_t)(void *ctx, bool sent);
+
+typedef struct
+{
+    unsigned int depth;
+    cm_drop_policy_t policy;
+    unsigned int queued;        // now
+    unsigned int maxQueued;
+    unsigned long sent;
+    unsigned long dropped;
+} cmxif_stats_t;
+
+/***************************************************************
+** MARK: FUNCTION DEFS
+***************************************************************/
+
+/*
+ * Queue depth and drop policy per stream, a comma separated list of
+ * stream=depth[:oldest|newest], streams being timestep, imu, lidar and
+ * camera; e.g. "camera=4:newest".
+ */
+int cmxif_set_option(const char *option);
+
+/*
+ * Write every message to a file at path instead of sending it over XIF,
+ * before cmxif_start(). Queues then never drop, a producer waits for
+ * room instead. The file is closed by cmxif_stop().
+ */
+int cmxif_set_sink(const char *path);
+
+/* start the transmit thread; before it, and if it fails, messages are sent on the calling thread */
+int cmxif_start(void);
+
+/* wait until everything queued so far went out */
+void cmxif_flush(void);
+
+/* send what is still queued and stop the thread, once no producer sends any more */
+void cmxif_stop(void);
+
+void cmxif_timestep(uint64_t time);
+
+void cmxif_imu(xif_imu_t imu);
+
+/* with done NULL the points are copied, otherwise they must stay valid until done is called */
+void cmxif_pointcloud(cmxif_stream_t stream, xif_pointcloud_t pointcloud, cmxif_done_t done, void *ctx);
+
+/* as cmxif_pointcloud(), for width * height * channels bytes of data */
+void cmxif_image(cmxif_stream_t stream, xif_image_t image, cmxif_done_t done, void *ctx);
+
+void cmxif_stats(cmxif_stream_t stream, cmxif_stats_t *stats);
+
+/* as in options, reports and batch results: timestep, imu, lidar or camera */
+static inline const char *cmxif_stream_name(cmxif_stream_t stream)
+{
+    static const char *const names[CMXIF_STREAMS] = { "timestep", "imu", "lidar", "camera" };
+
+    return ((unsigned int)stream < CMXIF_STREAMS) ? names[stream] : "unknown";
+}
+
+/* log the counters of every stream */
+void cmxif_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMXIF_H */
@@ -25,7 +25,12 @@
 
 #include "carmaker/CM_Main.h"
 
+#include "cm_util.h"
+#include "cmbatch.h"
 #include "cmimg.h" // Include the cmimg header for CarMaker image client functionality
+#include "cmlog.h"
+#include "cmsched.h"
+#include "cmxif.h"
 
 /***************************************************************
 ** MARK: CONSTANTS & MACROS
@@ -39,17 +44,30 @@
 ** MARK: STATIC FUNCTION DEFS
 ***************************************************************/
 
+static void task_camera(uint64_t now, void *arg);
+static void task_timestep(uint64_t now, void *arg);
+static void task_imu(uint64_t now, void *arg);
+static void task_lidar(uint64_t now, void *arg);
+static bool run_cycle(void);
+
 /***************************************************************
 ** MARK: STATIC VARIABLES
 ***************************************************************/
 
+/* default rates, phases and budgets, -sched overrides them per task */
+static const cmsched_task_t tasks[] = {
+    { "camera",   task_camera,   NULL, 0, 0,                  500  }, // hands received frames to XIF
+    { "timestep", task_timestep, NULL, 1, 0,                  50   },
+    { "imu",      task_imu,      NULL, 1, CMSCHED_PHASE_AUTO, 100  },
+    { "lidar",    task_lidar,    NULL, 1, CMSCHED_PHASE_AUTO, 2000 }, // publishes only when a lidar finished a new scan
+};
+
 /***************************************************************
 ** MARK: PUBLIC FUNCTIONS
 ***************************************************************/
 
 int main(int argc, char **argv)
 {
-    xifs_init();
     int cmInit = CM_Main_init(argc, argv);
 
     if (cmInit != 0) 
@@ -58,51 +76,128 @@ int main(int argc, char **argv)
         return EXIT_FAILURE;
     }
 
-    cmimg_init(); // Initialize the CarMaker image client
+    bool batch = cmbatch_enabled(); // headless: no camera, output to a local sink
 
+    // a batch run has no XIF endpoint, so any number of them can run side by side
+    if (!batch)
+    {
+        xifs_init();
+    }
 
-    uint64_t time = 0;
+    cmlog_start(); // messages from the sim loop on are formatted off the hot path
 
-    uint64_t last_lidar = 0;
-    uint64_t last_imu = 0;
+    if (batch && cmbatch_start() != 0)
+    {
+        CM_Main_quit();
+        cmlog_stop();
+        return EXIT_FAILURE;
+    }
 
-    while (CM_Main_running()) 
+    if (!batch)
     {
+        cmimg_init(); // Initialize the CarMaker image client
+    }
 
-        cmimg_update(); // Update the CarMaker image client
+    cmxif_start(); // XIF sends leave the simulation thread from here on
 
-        uint64_t time_now = CM_Main_get_ms();
+    for (size_t i = 0; i < sizeof(tasks) / sizeof(tasks[0]); ++i)
+    {
+        if (batch && tasks[i].func == task_camera)
+            continue;
 
-        if (time_now > time) 
-        {
-            time = time_now;
+        cmsched_add(&tasks[i]);
+    }
 
-            xifs_transmit_timestep(time);
+    if (batch)
+    {
+        while (run_cycle())
+        {
         }
-
-        if (time_now - last_lidar > 50) 
+    }
+    else
+    {
+        while (CM_Main_running()) 
         {
-            CM_Main_capture_pointcloud();
+            cmsched_run(CM_Main_get_ms());
 
-            last_lidar = time_now;
+            CM_Main_update();
         }
+    }
 
-        if (time_now - last_imu > 0) 
-        {
-            CM_Main_capture_imu();
+    cmsched_report();
 
-            last_imu = time_now;
-        }
+    if (!batch)
+    {
+        // camera frames in flight live in the image client's pools
+        cmxif_flush();
 
-        
-        CM_Main_update();
+        cmimg_quit(); // Clean up the CarMaker image client
     }
 
-    cmimg_quit(); // Clean up the CarMaker image client
-    return CM_Main_quit();
+    int rv = CM_Main_quit();
+
+    // lidar and IMU sent their last messages while quitting
+    cmxif_stop();
+
+    cmbatch_finish(rv);
+
+    cmlog_stop();
+    return rv;
 }
 
 /***************************************************************
 ** MARK: STATIC FUNCTIONS
 ***************************************************************/
 
+static void task_camera(uint64_t now, void *arg)
+{
+    (void)now;
+    (void)arg;
+    cmimg_update();
+}
+
+static void task_timestep(uint64_t now, void *arg)
+{
+    (void)arg;
+    cmxif_timestep(now);
+}
+
+static void task_imu(uint64_t now, void *arg)
+{
+    (void)now;
+    (void)arg;
+    CM_Main_capture_imu();
+}
+
+static void task_lidar(uint64_t now, void *arg)
+{
+    (void)now;
+    (void)arg;
+    CM_Main_capture_pointcloud();
+}
+
+/* one main loop cycle of batch mode, its phases timed */
+static bool run_cycle(void)
+{
+    uint64_t ns[CMBATCH_PHASES];
+    uint64_t t0 = cm_now_ns();
+
+    if (!CM_Main_running())
+        return false;
+
+    uint64_t t1 = cm_now_ns();
+    uint64_t now = CM_Main_get_ms();
+    cmsched_run(now);
+
+    uint64_t t2 = cm_now_ns();
+    CM_Main_update();
+
+    uint64_t t3 = cm_now_ns();
+
+    ns[CMBATCH_MODEL] = t1 - t0;
+    ns[CMBATCH_TASKS] = t2 - t1;
+    ns[CMBATCH_FINISH] = t3 - t2;
+    cmbatch_cycle(now, ns);
+
+    return true;
+}
@@ -0,0 +1,976 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmbatch_runner.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  Parallel Batch Mode Runner
+**
+** Usage        :  cmbatch-runner [options] <jobs file> [-- CarMaker-XIF options]
+**
+** Runs the jobs of the file, one "testrun [variation [seed]]" per
+** line, on up to -j CarMaker-XIF instances in -batch mode at once.
+** Every job gets its own directory under -out with the project's Data
+** linked in and its own test run, the base one with the keys of the
+** variation file replaced; @SEED@ in the variation becomes the seed,
+** the only way it reaches the simulation. The cores are split evenly
+** between the instances. A batch run writes its messages to a sink
+** file instead of an XIF endpoint, the runner reads the sinks back and
+** writes every job's timing and message counts to summary.csv.
+**
+** Options      :  -exe <file>      CarMaker-XIF executable (CarMaker-XIF.linux64)
+**                 -project <dir>   project with Data and Movie (.)
+**                 -out <dir>       job directories and summary (batch)
+**                 -j <n>           instances at once (one per core)
+**                 -cores <list>    cores to run on, e.g. 0-7,16-23 (all allowed)
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include <sched.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "cm_util.h"
+#include "cmbatch.h"
+#include "cmxif.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define PATH_SIZE (4096)
+#define NAME_SIZE (256)
+
+#define MAX_ARGS (64)
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+typedef struct
+{
+    char testrun[NAME_SIZE];
+    char variation[PATH_SIZE];  // empty for none
+    unsigned long seed;
+    char dir[PATH_SIZE];
+
+    int slot;
+    pid_t pid;
+    double start;
+    double end;
+    int status;                 // exit status, 128 + signal, -1 if it never ran
+
+    bool haveResult;
+    double simS;
+    double wallS;
+    double rtf;
+    double phaseUs[CMBATCH_PHASES];
+    unsigned long sent[CMXIF_STREAMS];
+    unsigned long dropped[CMXIF_STREAMS];
+
+    unsigned long records[CMXIF_STREAMS];
+    uint64_t sinkBytes;
+    const char *sinkError;      // NULL if the sink read back in full
+} tJob;
+
+/* one piece of an infofile, a key line and its indented continuation lines */
+typedef struct
+{
+    const char *text;
+    size_t len;
+    const char *key;
+    size_t keyLen;
+} tBlock;
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static int read_jobs(const char *path);
+static int parse_cores(const char *list);
+static int prepare(tJob *job, int index);
+static int write_testrun(const tJob *job);
+static char *read_variation(const tJob *job);
+static void write_block(FILE *f, const tBlock *b);
+static bool next_block(const char **p, tBlock *b);
+static int launch(tJob *job, int slot);
+static void collect(tJob *job);
+static void read_result(tJob *job);
+static void read_sink(tJob *job);
+static double json_number(const char *text, const char *section, const char *key);
+static int write_summary(double makespan);
+static char *read_file(const char *path, size_t *size);
+static char *make_path(char *path, const char *format, ...);
+static int make_dirs(const char *path);
+static double now_s(void);
+
+/***************************************************************
+** MARK: STATIC VARIABLES
+***************************************************************/
+
+static struct {
+    char exe[PATH_SIZE];
+    char project[PATH_SIZE];
+    char out[PATH_SIZE];
+    char jobsDir[PATH_SIZE];    // variations are relative to the jobs file
+
+    char **args;                // passed on to every instance
+    int nArgs;
+
+    int cores[CPU_SETSIZE];
+    int nCores;
+    int nSlots;
+
+    tJob *jobs;
+    int nJobs;
+} Runner;
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int main(int argc, char **argv)
+{
+    const char *exe = "CarMaker-XIF.linux64";
+    const char *project = ".";
+    const char *out = "batch";
+    const char *jobs = NULL;
+    const char *cores = NULL;
+    int slots = 0;
+    bool usage = false;
+
+    for (int i = 1; i < argc && !usage; ++i)
+    {
+        if (strcmp(argv[i], "--") == 0)
+        {
+            Runner.args = argv + i + 1;
+            Runner.nArgs = argc - i - 1;
+            break;
+        }
+        else if (strcmp(argv[i], "-exe") == 0 && i + 1 < argc)
+            exe = argv[++i];
+        else if (strcmp(argv[i], "-project") == 0 && i + 1 < argc)
+            project = argv[++i];
+        else if (strcmp(argv[i], "-out") == 0 && i + 1 < argc)
+            out = argv[++i];
+        else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+            slots = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-cores") == 0 && i + 1 < argc)
+            cores = argv[++i];
+        else if (argv[i][0] != '-' && jobs == NULL)
+            jobs = argv[i];
+        else
+            usage = true;
+    }
+
+    if (usage || jobs == NULL || Runner.nArgs + 5 > MAX_ARGS)
+    {
+        fprintf(stderr, "usage: %s [-exe file] [-project dir] [-out dir] [-j n] [-cores list] "
+                        "<jobs file> [-- CarMaker-XIF options]\n", argv[0]);
+        return 1;
+    }
+
+    if (realpath(exe, Runner.exe) == NULL || access(Runner.exe, X_OK) != 0)
+    {
+        fprintf(stderr, "%s isn't an executable\n", exe);
+        return 1;
+    }
+
+    if (realpath(project, Runner.project) == NULL)
+    {
+        fprintf(stderr, "can't find project %s\n", project);
+        return 1;
+    }
+
+    if (make_dirs(out) != 0 || realpath(out, Runner.out) == NULL)
+    {
+        fprintf(stderr, "can't create %s: %s\n", out, strerror(errno));
+        return 1;
+    }
+
+    if (parse_cores(cores) != 0 || read_jobs(jobs) != 0)
+        return 1;
+
+    Runner.nSlots = (slots > 0) ? slots : Runner.nCores;
+    if (Runner.nSlots > Runner.nJobs)
+        Runner.nSlots = Runner.nJobs;
+
+    for (int i = 0; i < Runner.nJobs; ++i)
+    {
+        if (prepare(&Runner.jobs[i], i) != 0)
+            return 1;
+    }
+
+    printf("%d jobs on %d instances, %d cores\n", Runner.nJobs, Runner.nSlots, Runner.nCores);
+
+    // a queue in file order, each job taking the next free instance
+    int next = 0;
+    int running = 0;
+    int *slotJob = calloc((size_t)Runner.nSlots, sizeof(int));
+    double start = now_s();
+
+    if (slotJob == NULL)
+        return 1;
+
+    while (next < Runner.nJobs || running > 0)
+    {
+        for (int s = 0; s < Runner.nSlots && next < Runner.nJobs; ++s)
+        {
+            if (slotJob[s] != 0)
+                continue;
+
+            tJob *job = &Runner.jobs[next++];
+
+            if (launch(job, s) == 0)
+            {
+                slotJob[s] = (int)(job - Runner.jobs) + 1;
+                running++;
+            }
+        }
+
+        if (running == 0)
+            continue;
+
+        int status;
+        pid_t pid = waitpid(-1, &status, 0);
+
+        if (pid < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            fprintf(stderr, "waitpid: %s\n", strerror(errno));
+            return 1;
+        }
+
+        for (int s = 0; s < Runner.nSlots; ++s)
+        {
+            tJob *job = (slotJob[s] != 0) ? &Runner.jobs[slotJob[s] - 1] : NULL;
+
+            if (job == NULL || job->pid != pid)
+                continue;
+
+            job->end = now_s();
+            job->status = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+            collect(job);
+
+            printf("[%3d/%d] %-32s %-16s seed %-6lu %s, %.1f s simulated in %.1f s, rtf %.2f\n",
+                   (int)(job - Runner.jobs) + 1, Runner.nJobs, job->testrun,
+                   job->variation[0] ? strrchr(job->variation, '/') + 1 : "-", job->seed,
+                   job->status == 0 ? "ok" : "FAILED", job->simS, job->end - job->start, job->rtf);
+
+            slotJob[s] = 0;
+            running--;
+        }
+    }
+
+    double makespan = now_s() - start;
+    free(slotJob);
+
+    return write_summary(makespan);
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+static int read_jobs(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[PATH_SIZE];
+    char resolved[PATH_SIZE];
+    int lineNo = 0;
+
+    if (f == NULL || realpath(path, resolved) == NULL)
+    {
+        fprintf(stderr, "can't open %s\n", path);
+        return -1;
+    }
+
+    make_path(Runner.jobsDir, "%s", resolved);
+    *strrchr(Runner.jobsDir, '/') = '\0';
+
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        char testrun[NAME_SIZE] = "";
+        char variation[NAME_SIZE] = "-";
+        unsigned long seed = 0;
+
+        lineNo++;
+
+        char *hash = strchr(line, '#');
+        if (hash != NULL)
+            *hash = '\0';
+
+        int n = sscanf(line, "%255s %255s %lu", testrun, variation, &seed);
+        if (n <= 0)
+            continue;
+
+        tJob *jobs = realloc(Runner.jobs, (size_t)(Runner.nJobs + 1) * sizeof(tJob));
+        if (jobs == NULL)
+            return -1;
+
+        Runner.jobs = jobs;
+        tJob *job = &Runner.jobs[Runner.nJobs++];
+
+        memset(job, 0, sizeof(*job));
+        snprintf(job->testrun, sizeof(job->testrun), "%s", testrun);
+        job->seed = seed;
+        job->status = -1;
+
+        if (strcmp(variation, "-") != 0)
+        {
+            if (variation[0] == '/')
+                make_path(job->variation, "%s", variation);
+            else
+                make_path(job->variation, "%s/%s", Runner.jobsDir, variation);
+
+            if (access(job->variation, R_OK) != 0)
+            {
+                fprintf(stderr, "%s:%d: can't read variation %s\n", path, lineNo, job->variation);
+                return -1;
+            }
+        }
+    }
+
+    fclose(f);
+
+    if (Runner.nJobs == 0)
+    {
+        fprintf(stderr, "%s has no jobs\n", path);
+        return -1;
+    }
+
+    return 0;
+}
+
+/* cores as in taskset, NULL for all the runner may use */
+static int parse_cores(const char *list)
+{
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+
+    if (list == NULL)
+    {
+        sched_getaffinity(0, sizeof(set), &set);
+    }
+    else
+    {
+        const char *p = list;
+
+        while (*p != '\0')
+        {
+            char *end;
+            long first = strtol(p, &end, 10);
+            long last = first;
+
+            if (end == p)
+                goto invalid;
+
+            if (*end == '-')
+            {
+                p = end + 1;
+                last = strtol(p, &end, 10);
+                if (end == p)
+                    goto invalid;
+            }
+
+            if (first < 0 || last < first || last >= CPU_SETSIZE || (*end != ',' && *end != '\0'))
+                goto invalid;
+
+            for (long c = first; c <= last; ++c)
+                CPU_SET((int)c, &set);
+
+            p = (*end == ',') ? end + 1 : end;
+        }
+    }
+
+    for (int c = 0; c < CPU_SETSIZE; ++c)
+    {
+        if (CPU_ISSET(c, &set))
+            Runner.cores[Runner.nCores++] = c;
+    }
+
+    if (Runner.nCores > 0)
+        return 0;
+
+invalid:
+    fprintf(stderr, "cores must be a list like 0-7,16-23\n");
+    return -1;
+}
+
+/* the job's directory, the project's Data linked in but for its own TestRun */
+static int prepare(tJob *job, int index)
+{
+    char path[PATH_SIZE];
+    char target[PATH_SIZE];
+    DIR *data;
+    struct dirent *e;
+
+    make_path(job->dir, "%s/job%03d", Runner.out, index + 1);
+    make_path(path, "%s/Data/TestRun", job->dir);
+
+    if (make_dirs(path) != 0)
+    {
+        fprintf(stderr, "can't create %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    make_path(path, "%s/Data", Runner.project);
+    if ((data = opendir(path)) == NULL)
+    {
+        fprintf(stderr, "%s has no Data directory\n", Runner.project);
+        return -1;
+    }
+
+    while ((e = readdir(data)) != NULL)
+    {
+        if (e->d_name[0] == '.' || strcmp(e->d_name, "TestRun") == 0)
+            continue;
+
+        make_path(target, "%s/Data/%s", Runner.project, e->d_name);
+        make_path(path, "%s/Data/%s", job->dir, e->d_name);
+        unlink(path);
+        if (symlink(target, path) != 0)
+        {
+            fprintf(stderr, "can't link %s: %s\n", path, strerror(errno));
+            closedir(data);
+            return -1;
+        }
+    }
+
+    closedir(data);
+
+    make_path(target, "%s/Movie", Runner.project);
+    make_path(path, "%s/Movie", job->dir);
+    unlink(path);
+    if (access(target, F_OK) == 0 && symlink(target, path) != 0)
+    {
+        fprintf(stderr, "can't link %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    // results of an earlier run of the same directory mustn't be taken for this one's
+    make_path(path, "%s/%s", job->dir, CMBATCH_RESULT_FILE);
+    unlink(path);
+    make_path(path, "%s/%s", job->dir, CMBATCH_SINK_FILE);
+    unlink(path);
+
+    return write_testrun(job);
+}
+
+/* the base test run, a key the variation has replaced by its lines, new keys appended */
+static int write_testrun(const tJob *job)
+{
+    char path[PATH_SIZE];
+    char *base;
+    char *variation = NULL;
+    tBlock *blocks = NULL;
+    bool *used = NULL;
+    int nBlocks = 0;
+    FILE *f;
+    tBlock b;
+
+    make_path(path, "%s/Data/TestRun/%s", Runner.project, job->testrun);
+    if ((base = read_file(path, NULL)) == NULL)
+    {
+        fprintf(stderr, "can't read test run %s\n", path);
+        return -1;
+    }
+
+    if (job->variation[0] != '\0')
+    {
+        if ((variation = read_variation(job)) == NULL)
+        {
+            fprintf(stderr, "can't read variation %s\n", job->variation);
+            return -1;
+        }
+
+        for (const char *p = variation; next_block(&p, &b);)
+        {
+            if (b.key == NULL)
+                continue;
+
+            tBlock *grown = realloc(blocks, (size_t)(nBlocks + 1) * sizeof(tBlock));
+            if (grown == NULL)
+                return -1;
+
+            blocks = grown;
+            blocks[nBlocks++] = b;
+        }
+
+        if (nBlocks > 0 && (used = calloc((size_t)nBlocks, sizeof(bool))) == NULL)
+            return -1;
+    }
+
+    make_path(path, "%s/Data/TestRun/%s", job->dir, job->testrun);
+    *strrchr(path, '/') = '\0';
+    make_dirs(path);
+    make_path(path, "%s/Data/TestRun/%s", job->dir, job->testrun);
+
+    if ((f = fopen(path, "w")) == NULL)
+    {
+        fprintf(stderr, "can't write %s\n", path);
+        return -1;
+    }
+
+    for (const char *p = base; next_block(&p, &b);)
+    {
+        int i = 0;
+
+        while (i < nBlocks && !(b.key != NULL && blocks[i].keyLen == b.keyLen
+                                && strncmp(blocks[i].key, b.key, b.keyLen) == 0))
+        {
+            ++i;
+        }
+
+        if (i < nBlocks)
+        {
+            write_block(f, &blocks[i]);
+            used[i] = true;
+        }
+        else
+        {
+            write_block(f, &b);
+        }
+    }
+
+    for (int i = 0; i < nBlocks; ++i)
+    {
+        if (!used[i])
+            write_block(f, &blocks[i]);
+    }
+
+    free(base);
+    free(variation);
+    free(blocks);
+    free(used);
+
+    if (fclose(f) != 0)
+    {
+        fprintf(stderr, "can't write %s\n", path);
+        return -1;
+    }
+
+    return 0;
+}
+
+/* the variation file with @SEED@ replaced by the job's seed */
+static char *read_variation(const tJob *job)
+{
+    char seed[32];
+    size_t size;
+    char *raw = read_file(job->variation, &size);
+    int count = 0;
+
+    if (raw == NULL)
+        return NULL;
+
+    for (const char *p = raw; (p = strstr(p, "@SEED@")) != NULL; p += 6)
+        ++count;
+
+    int len = snprintf(seed, sizeof(seed), "%lu", job->seed);
+    char *text = malloc(size + (size_t)count * (size_t)len + 1);
+    char *out = text;
+
+    if (text == NULL)
+    {
+        free(raw);
+        return NULL;
+    }
+
+    for (const char *p = raw; *p != '\0';)
+    {
+        if (strncmp(p, "@SEED@", 6) == 0)
+        {
+            memcpy(out, seed, (size_t)len);
+            out += len;
+            p += 6;
+        }
+        else
+        {
+            *out++ = *p++;
+        }
+    }
+
+    *out = '\0';
+    free(raw);
+
+    return text;
+}
+
+static void write_block(FILE *f, const tBlock *b)
+{
+    fwrite(b->text, 1, b->len, f);
+
+    // the last line of a file may lack its newline
+    if (b->text[b->len - 1] != '\n')
+        fputc('\n', f);
+}
+
+/* comments and blank lines are blocks without a key */
+static bool next_block(const char **p, tBlock *b)
+{
+    const char *s = *p;
+    const char *e = s;
+
+    if (*s == '\0')
+        return false;
+
+    do
+    {
+        const char *nl = strchr(e, '\n');
+        e = nl ? nl + 1 : e + strlen(e);
+    } while (*e == '\t' || *e == ' ');
+
+    b->text = s;
+    b->len = (size_t)(e - s);
+    b->key = NULL;
+    b->keyLen = 0;
+
+    if (*s != '#' && *s != '\n' && *s != '\r')
+    {
+        size_t k = strcspn(s, "=:\n");
+
+        while (k > 0 && (s[k - 1] == ' ' || s[k - 1] == '\t'))
+            --k;
+
+        if (k > 0)
+        {
+            b->key = s;
+            b->keyLen = k;
+        }
+    }
+
+    *p = e;
+    return true;
+}
+
+static int launch(tJob *job, int slot)
+{
+    char *args[MAX_ARGS];
+    char log[PATH_SIZE];
+    int n = 0;
+
+    args[n++] = Runner.exe;
+    for (int i = 0; i < Runner.nArgs; ++i)
+        args[n++] = Runner.args[i];
+    args[n++] = "-batch";
+    args[n++] = ".";
+    args[n++] = job->testrun;
+    args[n] = NULL;
+
+    make_path(log, "%s/log.txt", job->dir);
+
+    // consecutive cores per instance, instances share them if there are more of those
+    cpu_set_t set;
+    int per = Runner.nCores / Runner.nSlots;
+
+    CPU_ZERO(&set);
+    if (per == 0)
+    {
+        CPU_SET(Runner.cores[slot % Runner.nCores], &set);
+    }
+    else
+    {
+        for (int c = 0; c < per; ++c)
+            CPU_SET(Runner.cores[slot * per + c], &set);
+    }
+
+    fflush(stdout);
+    job->slot = slot;
+    job->start = now_s();
+    job->pid = fork();
+
+    if (job->pid < 0)
+    {
+        fprintf(stderr, "fork: %s\n", strerror(errno));
+        return -1;
+    }
+
+    if (job->pid == 0)
+    {
+        int fd = open(log, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+        if (fd < 0 || chdir(job->dir) != 0 || sched_setaffinity(0, sizeof(set), &set) != 0)
+            _exit(127);
+
+        dup2(fd, STDOUT_FILENO);
+        dup2(fd, STDERR_FILENO);
+        close(fd);
+
+        execv(Runner.exe, args);
+        _exit(127);
+    }
+
+    return 0;
+}
+
+static void collect(tJob *job)
+{
+    read_result(job);
+    read_sink(job);
+
+    // a run that exited fine but left no complete output still failed
+    if (job->status == 0 && (!job->haveResult || job->sinkError != NULL))
+        job->status = 1;
+}
+
+static void read_result(tJob *job)
+{
+    char path[PATH_SIZE];
+    char *text;
+
+    make_path(path, "%s/%s", job->dir, CMBATCH_RESULT_FILE);
+    if ((text = read_file(path, NULL)) == NULL)
+        return;
+
+    job->haveResult = true;
+    job->simS = json_number(text, NULL, "sim_s");
+    job->wallS = json_number(text, NULL, "wall_s");
+    job->rtf = json_number(text, NULL, "rtf");
+
+    for (int i = 0; i < CMBATCH_PHASES; ++i)
+        job->phaseUs[i] = json_number(text, cmbatch_phase_name((cmbatch_phase_t)i), "mean_us");
+
+    for (int i = 0; i < CMXIF_STREAMS; ++i)
+    {
+        const char *name = cmxif_stream_name((cmxif_stream_t)i);
+
+        job->sent[i] = (unsigned long)json_number(text, name, "sent");
+        job->dropped[i] = (unsigned long)json_number(text, name, "dropped");
+    }
+
+    free(text);
+}
+
+/* the stand-in for the XIF client, counts the records of the sink per stream */
+static void read_sink(tJob *job)
+{
+    char path[PATH_SIZE];
+    uint8_t header[CMXIF_SINK_RECORD_SIZE];
+    FILE *f;
+
+    make_path(path, "%s/%s", job->dir, CMBATCH_SINK_FILE);
+
+    if ((f = fopen(path, "rb")) == NULL)
+    {
+        job->sinkError = "missing";
+        return;
+    }
+
+    if (fread(header, CMXIF_SINK_HEADER_SIZE, 1, f) != 1 || memcmp(header, CMXIF_SINK_MAGIC, 4) != 0
+     || cm_get_u32(header + 4) != CMXIF_SINK_VERSION)
+    {
+        job->sinkError = "not a sink file";
+        fclose(f);
+        return;
+    }
+
+    job->sinkBytes = CMXIF_SINK_HEADER_SIZE;
+
+    while (fread(header, CMXIF_SINK_RECORD_SIZE, 1, f) == 1)
+    {
+        uint32_t size = cm_get_u32(header + 4);
+
+        if (header[0] < 1 || header[0] > 4 || header[1] >= CMXIF_STREAMS || fseek(f, size, SEEK_CUR) != 0)
+        {
+            job->sinkError = "corrupt";
+            break;
+        }
+
+        job->records[header[1]]++;
+        job->sinkBytes += CMXIF_SINK_RECORD_SIZE + size;
+    }
+
+    // fseek past the end succeeds, a record cut short shows in the size
+    if (job->sinkError == NULL && (fseek(f, 0, SEEK_END) != 0 || (uint64_t)ftell(f) != job->sinkBytes))
+        job->sinkError = "truncated";
+
+    fclose(f);
+}
+
+/* the first "key": number, after "section" if given; 0 if there is none */
+static double json_number(const char *text, const char *section, const char *key)
+{
+    char quoted[NAME_SIZE];
+
+    if (section != NULL)
+    {
+        snprintf(quoted, sizeof(quoted), "\"%s\"", section);
+        if ((text = strstr(text, quoted)) == NULL)
+            return 0.0;
+    }
+
+    snprintf(quoted, sizeof(quoted), "\"%s\":", key);
+    if ((text = strstr(text, quoted)) == NULL)
+        return 0.0;
+
+    return strtod(text + strlen(quoted), NULL);
+}
+
+static int write_summary(double makespan)
+{
+    char path[PATH_SIZE];
+    FILE *f;
+    int failed = 0;
+    double simS = 0.0;
+    double busyS = 0.0;
+
+    make_path(path, "%s/summary.csv", Runner.out);
+    if ((f = fopen(path, "w")) == NULL)
+    {
+        fprintf(stderr, "can't write %s\n", path);
+        return 1;
+    }
+
+    fprintf(f, "job,testrun,variation,seed,cores,status,sim_s,wall_s,run_s,rtf");
+    for (int i = 0; i < CMBATCH_PHASES; ++i)
+        fprintf(f, ",%s_us", cmbatch_phase_name((cmbatch_phase_t)i));
+    for (int i = 0; i < CMXIF_STREAMS; ++i)
+    {
+        const char *name = cmxif_stream_name((cmxif_stream_t)i);
+        fprintf(f, ",%s_sent,%s_dropped,%s_records", name, name, name);
+    }
+    fprintf(f, ",sink_bytes,sink\n");
+
+    for (int j = 0; j < Runner.nJobs; ++j)
+    {
+        const tJob *job = &Runner.jobs[j];
+        int per = Runner.nCores / Runner.nSlots;
+        int first = (per == 0) ? Runner.cores[job->slot % Runner.nCores] : Runner.cores[job->slot * per];
+        int last = (per == 0) ? first : Runner.cores[job->slot * per + per - 1];
+
+        fprintf(f, "%d,%s,%s,%lu,%d-%d,%d,%.3f,%.3f,%.3f,%.3f", j + 1, job->testrun,
+                job->variation[0] ? strrchr(job->variation, '/') + 1 : "-", job->seed, first, last,
+                job->status, job->simS, job->wallS, job->end - job->start, job->rtf);
+        for (int i = 0; i < CMBATCH_PHASES; ++i)
+            fprintf(f, ",%.3f", job->phaseUs[i]);
+        for (int i = 0; i < CMXIF_STREAMS; ++i)
+            fprintf(f, ",%lu,%lu,%lu", job->sent[i], job->dropped[i], job->records[i]);
+        fprintf(f, ",%llu,%s\n", (unsigned long long)job->sinkBytes, job->sinkError ? job->sinkError : "ok");
+
+        failed += (job->status != 0);
+        simS += job->simS;
+        busyS += job->end - job->start;
+    }
+
+    if (fclose(f) != 0)
+    {
+        fprintf(stderr, "can't write %s\n", path);
+        return 1;
+    }
+
+    printf("%d of %d jobs failed, %.1f s simulated in %.1f s, %.2f x real time overall, "
+           "%.1f s of runs, %.1f x speedup over running them in turn\n",
+           failed, Runner.nJobs, simS, makespan, makespan > 0.0 ? simS / makespan : 0.0,
+           busyS, makespan > 0.0 ? busyS / makespan : 0.0);
+    printf("summary in %s\n", path);
+
+    return failed == 0 ? 0 : 1;
+}
+
+static char *read_file(const char *path, size_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    char *text = NULL;
+    size_t len = 0;
+    size_t capacity = 0;
+    size_t n;
+
+    if (f == NULL)
+        return NULL;
+
+    do
+    {
+        if (len + 4096 + 1 > capacity)
+        {
+            char *grown = realloc(text, capacity = 2 * capacity + 4096 + 1);
+            if (grown == NULL)
+            {
+                free(text);
+                fclose(f);
+                return NULL;
+            }
+            text = grown;
+        }
+
+        n = fread(text + len, 1, 4096, f);
+        len += n;
+    } while (n > 0);
+
+    fclose(f);
+
+    text[len] = '\0';
+    if (size != NULL)
+        *size = len;
+
+    return text;
+}
+
+/* snprintf() into a PATH_SIZE buffer; a path that doesn't fit ends the run */
+static char *make_path(char *path, const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    int len = vsnprintf(path, PATH_SIZE, format, args);
+    va_end(args);
+
+    if (len < 0 || len >= PATH_SIZE)
+    {
+        fprintf(stderr, "path too long: %s...\n", path);
+        exit(1);
+    }
+
+    return path;
+}
+
+/* mkdir -p */
+static int make_dirs(const char *path)
+{
+    char dir[PATH_SIZE];
+
+    snprintf(dir, sizeof(dir), "%s", path);
+
+    for (char *p = dir + 1; ; ++p)
+    {
+        if (*p == '/' || *p == '\0')
+        {
+            char c = *p;
+            *p = '\0';
+            if (mkdir(dir, 0777) != 0 && errno != EEXIST)
+                return -1;
+            if ((*p = c) == '\0')
+                break;
+        }
+    }
+
+    return 0;
+}
+
+static double now_s(void)
+{
+    return cm_now_ns() * 1e-9;
+}
@@ -0,0 +1,109 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmimg_embedded2csv.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Image Client - Embedded Data to CSV Converter
+**
+** Usage        :  cmimg-embedded2csv <in.bin> [out.csv]
+**
+** Writes the same lines the client's CSV mode does:
+** <channel>,<sim time>,<ani mode>,<value>,<value>,...
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmimg_embedded.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define PAD8(x) (((x) + 7u) & ~(size_t)7u)
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <in.bin> [out.csv]\n", argv[0]);
+        return 1;
+    }
+
+    FILE *in = fopen(argv[1], "rb");
+    FILE *out = (argc > 2) ? fopen(argv[2], "w") : stdout;
+
+    if (in == NULL || out == NULL)
+    {
+        fprintf(stderr, "can't open %s\n", in == NULL ? argv[1] : argv[2]);
+        return 1;
+    }
+
+    char magic[8];
+    if (fread(magic, 1, sizeof(magic), in) != sizeof(magic) || memcmp(magic, CMIMG_EMBEDDED_MAGIC, 8) != 0)
+    {
+        fprintf(stderr, "%s is not an embedded data file\n", argv[1]);
+        return 1;
+    }
+
+    double *values = NULL;
+    size_t capacity = 0;
+    unsigned long records = 0;
+    cmimg_embedded_record_t rec;
+
+    while (fread(&rec, sizeof(rec), 1, in) == 1)
+    {
+        size_t size = PAD8((size_t)rec.length);
+
+        if (size > capacity)
+        {
+            double *buf = realloc(values, size);
+            if (buf == NULL)
+            {
+                fprintf(stderr, "record %lu: %u bytes don't fit into memory\n", records, rec.length);
+                return 1;
+            }
+            values = buf;
+            capacity = size;
+        }
+
+        if (fread(values, 1, size, in) != size)
+        {
+            fprintf(stderr, "record %lu is truncated\n", records);
+            break;
+        }
+
+        rec.ani_mode[sizeof(rec.ani_mode) - 1] = '\0';
+        fprintf(out, "%d,%f,%s", rec.channel, rec.sim_time, rec.ani_mode);
+        for (size_t i = 0; i < rec.length / sizeof(double); ++i)
+        {
+            fprintf(out, ",%f", values[i]);
+        }
+        fprintf(out, "\n");
+
+        records++;
+    }
+
+    fprintf(stderr, "%lu records\n", records);
+
+    free(values);
+    fclose(in);
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmlidar_bench.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Conversion Kernel Benchmark
+**
+** Usage        :  cmlidar-bench [beam file] [scans]
+**
+** Converts synthetic scans with every kernel the CPU supports, with
+** and without deskewing, checks the output is bit identical to the
+** scalar kernel and prints the time per scan. Some points have invalid
+** BeamIDs, which every kernel has to skip.
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <limits.h>
+
+#include "cm_util.h"
+#include "cmlidar_beams.h"
+#include "cmlidar_convert.h"
+
+/***************************************************************
+** MARK: TYPEDEFS
+***************************************************************/
+
+/* same fields and size class as CarMaker's tScanPoint */
+typedef struct
+{
+    int BeamID;
+    int EchoID;
+    double TimeOF;
+    double LengthOF;
+    double Origin[3];
+    double Intensity;
+    double PulseWidth;
+    int nRefl;
+} tScanPoint;
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int main(int argc, char **argv)
+{
+    const char *isas[] = { "scalar", "sse4.1", "avx2" };
+    cmlidar_beams_t beams = { 0 };
+    int scans = (argc > 2) ? atoi(argv[2]) : 2000;
+
+    if (argc > 1 ? cmlidar_beams_load(&beams, argv[1]) : cmlidar_beams_grid(&beams, -60.0f, 60.0f, 360, -5.0f, 5.0f, 16))
+        return 1;
+
+    size_t n = (size_t)beams.count;
+    tScanPoint *scan = calloc(n, sizeof(*scan));
+    vector4_t *reference = calloc(n, sizeof(*reference));
+    vector4_t *out = calloc(n, sizeof(*out));
+
+    if (scan == NULL || reference == NULL || out == NULL || scans <= 0)
+        return 1;
+
+    // a few BeamIDs outside the table, so the kernels' fallback is compared too; too rare to skew the timing
+    const int unknown[] = { -1, beams.count, INT_MAX, INT_MIN };
+
+    srand(1);
+    for (size_t i = 0; i < n; ++i)
+    {
+        scan[i].BeamID = (i % 1009 == 0) ? unknown[(i / 1009) % 4] : (int)i;
+        scan[i].LengthOF = 2.0 * (0.5 + 100.0 * rand() / RAND_MAX);
+        scan[i].Intensity = (double)rand() / RAND_MAX;
+    }
+
+    cmlidar_scan_t desc = {
+        scan, sizeof(tScanPoint),
+        offsetof(tScanPoint, BeamID), offsetof(tScanPoint, LengthOF), offsetof(tScanPoint, Intensity)
+    };
+
+    // 30 m/s through a 1 rad/s left turn, 50 ms scans
+    const cmlidar_deskew_t motion = { 0.05f, 0.0f, 30.0f, 0.0f, 1.0f };
+    const cmlidar_deskew_t *deskews[] = { NULL, &motion };
+
+    for (size_t d = 0; d < sizeof(deskews) / sizeof(deskews[0]); ++d)
+    {
+        double scalarNs = 0.0;
+        size_t points = 0;
+
+        for (size_t k = 0; k < sizeof(isas) / sizeof(isas[0]); ++k)
+        {
+            if (cmlidar_convert_init(isas[k]) != 0)
+                continue;
+
+            memset(out, 0, n * sizeof(*out));
+            size_t written = cmlidar_convert(&desc, n, &beams, deskews[d], out);
+
+            if (k == 0)
+            {
+                memcpy(reference, out, n * sizeof(*out));
+                points = written;
+            }
+            else if (written != points || memcmp(reference, out, n * sizeof(*out)) != 0)
+            {
+                printf("%-7s output differs from scalar\n", isas[k]);
+                return 1;
+            }
+
+            double start = cm_now_ns();
+            for (int s = 0; s < scans; ++s)
+            {
+                cmlidar_convert(&desc, n, &beams, deskews[d], out);
+            }
+            double ns = (cm_now_ns() - start) / scans;
+
+            if (k == 0)
+                scalarNs = ns;
+
+            printf("%-7s %-6s %zu points  %8.1f us/scan  %5.2f ns/point  x%.2f\n",
+                   isas[k], deskews[d] ? "deskew" : "", written, ns / 1000.0, ns / (double)n, scalarNs / ns);
+        }
+    }
+
+    free(scan);
+    free(reference);
+    free(out);
+    cmlidar_beams_free(&beams);
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+/***************************************************************
+**
+** TBReAI Source File
+**
+** File         :  cmlidar_voxel_bench.c
+** Module       :  tbrert
+** Author       :  SH
+** Created      :  2026-10-17 (YYYY-MM-DD)
+** License      :  MIT
+** Description  :  CarMaker Lidar - Voxel Filter Benchmark
+**
+** Usage        :  cmlidar-voxel-bench [voxel size] [scans]
+**
+** Downsamples synthetic clouds of growing size with both point
+** modes and prints the time per scan and the points kept.
+**
+***************************************************************/
+
+/***************************************************************
+** MARK: INCLUDES
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "cm_util.h"
+#include "cmlidar_voxel.h"
+
+/***************************************************************
+** MARK: CONSTANTS & MACROS
+***************************************************************/
+
+#define MAX_POINTS (1 << 18)
+
+/***************************************************************
+** MARK: STATIC FUNCTION DEFS
+***************************************************************/
+
+static void make_cloud(vector4_t *cloud, size_t n);
+
+/***************************************************************
+** MARK: PUBLIC FUNCTIONS
+***************************************************************/
+
+int main(int argc, char **argv)
+{
+    float size = (argc > 1) ? (float)atof(argv[1]) : 0.1f;
+    int scans = (argc > 2) ? atoi(argv[2]) : 200;
+
+    vector4_t *cloud = malloc(MAX_POINTS * sizeof(*cloud));
+    vector4_t *work = malloc(MAX_POINTS * sizeof(*work));
+
+    if (cloud == NULL || work == NULL || !(size > 0.0f) || scans <= 0)
+        return 1;
+
+    make_cloud(cloud, MAX_POINTS);
+
+    for (int mode = 0; mode < 2; ++mode)
+    {
+        cmlidar_voxel_t grid;
+        if (cmlidar_voxel_init(&grid, size, mode == 0) != 0 || cmlidar_voxel_reserve(&grid, MAX_POINTS) != 0)
+            return 1;
+
+        for (size_t n = 1024; n <= MAX_POINTS; n *= 4)
+        {
+            size_t kept = 0;
+            double ns = 0.0;
+
+            // the filter works in place, so every pass starts from a fresh copy that isn't timed
+            for (int s = 0; s < scans; ++s)
+            {
+                memcpy(work, cloud, n * sizeof(*work));
+
+                double start = cm_now_ns();
+                kept = cmlidar_voxel_filter(&grid, work, n);
+                ns += cm_now_ns() - start;
+            }
+            ns /= scans;
+
+            printf("%-8s %4.2f m  %7zu points -> %7zu  %9.1f us/scan  %5.2f ns/point\n",
+                   mode == 0 ? "centroid" : "first", size, n, kept, ns / 1000.0, ns / (double)n);
+        }
+
+        cmlidar_voxel_free(&grid);
+    }
+
+    free(cloud);
+    free(work);
+
+    return 0;
+}
+
+/***************************************************************
+** MARK: STATIC FUNCTIONS
+***************************************************************/
+
+/* ground returns thinning out with range plus a few dense cones, roughly what a track scan looks like */
+static void make_cloud(vector4_t *cloud, size_t n)
+{
+    srand(1);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        float u = (float)rand() / RAND_MAX;
+        float v = (float)rand() / RAND_MAX;
+        float w = (float)rand() / RAND_MAX;
+
+        if (i % 4 == 0)
+        {
+            // cone: 0.3 m wide, 0.5 m high, on a 5 m raster ahead
+            float cx = 5.0f * (float)(rand() % 8) - 17.5f;
+            float cy = 5.0f * (float)(rand() % 10) + 5.0f;
+            cloud[i].x = cx + 0.3f * (u - 0.5f);
+            cloud[i].y = cy + 0.3f * (v - 0.5f);
+            cloud[i].z = 0.5f * w;
+        }
+        else
+        {
+            float range = 2.0f + 80.0f * u * u;
+            float azimuth = 2.1f * (v - 0.5f);
+            cloud[i].x = -range * sinf(azimuth);
+            cloud[i].y = range * cosf(azimuth);
+            cloud[i].z = 0.02f * (w - 0.5f);
+        }
+
+        cloud[i].w = (float)rand() / RAND_MAX;
+    }
+}